@@ -0,0 +1,6643 @@
+/* Auto‑generated by gen_codepage_table.py — DO NOT EDIT */
+#pragma once
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#  define CP_TABLE_CONST inline constexpr
+#else
+#  define CP_TABLE_CONST static const
+#endif
+
+#define CP_NOMAP  0xFFFF   /* 未定義 (順引き / 逆引きとも) */
+
+#ifndef CP_TABLE_T_DEFINED
+#define CP_TABLE_T_DEFINED
+/* 1 つのコードページの表 (codepage_table.h / ebcdic_table.h で共通) */
+typedef struct {
+    const uint16_t* sb2u;          /* [256] 1 byte → Unicode                        */
+    const uint8_t*  lead2row;      /* [256] lead byte の分類 (0 = 1 byte、他は db2u の行) */
+    const uint16_t (*db2u)[256];   /* [行][trail] → Unicode                          */
+    const uint8_t*  u2cp_page;     /* [256] Unicode 上位 8 bit → u2cp のページ        */
+    const uint16_t (*u2cp)[256];   /* [ページ][下位 8 bit] → コード                    */
+} cp_table_t;
+#endif
+
+/*----------------------------------------------------------------------
+ *  IBM930
+ *--------------------------------------------------------------------*/
+CP_TABLE_CONST uint16_t IBM930_SB2U[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0xFFFF, 0xFFFF,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+  0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+  0x0020, 0xFF61, 0xFF62, 0xFF63, 0xFF64, 0xFF65, 0xFF66, 0xFF67, 0xFF68, 0xFF69, 0x00A3, 0x002E, 0x003C, 0x0028, 0x002B, 0x007C,
+  0x0026, 0xFF6A, 0xFF6B, 0xFF6C, 0xFF6D, 0xFF6E, 0xFF6F, 0xFFFF, 0xFF70, 0xFFFF, 0x0021, 0x00A5, 0x002A, 0x0029, 0x003B, 0x00AC,
+  0x002D, 0x002F, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0xFFFF, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+  0x005B, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+  0x005D, 0xFF71, 0xFF72, 0xFF73, 0xFF74, 0xFF75, 0xFF76, 0xFF77, 0xFF78, 0xFF79, 0xFF7A, 0x0071, 0xFF7B, 0xFF7C, 0xFF7D, 0xFF7E,
+  0xFF7F, 0xFF80, 0xFF81, 0xFF82, 0xFF83, 0xFF84, 0xFF85, 0xFF86, 0xFF87, 0xFF88, 0xFF89, 0x0072, 0xFFFF, 0xFF8A, 0xFF8B, 0xFF8C,
+  0x007E, 0x203E, 0xFF8D, 0xFF8E, 0xFF8F, 0xFF90, 0xFF91, 0xFF92, 0xFF93, 0xFF94, 0xFF95, 0x0073, 0xFF96, 0xFF97, 0xFF98, 0xFF99,
+  0x005E, 0x00A2, 0x005C, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0xFF9A, 0xFF9B, 0xFF9C, 0xFF9D, 0xFF9E, 0xFF9F,
+  0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0024, 0xFFFF, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x009F,
+};
+
+CP_TABLE_CONST uint8_t IBM930_LEAD2ROW[256] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+   17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,
+   33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,
+   49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+CP_TABLE_CONST uint16_t IBM930_DB2U[65][256] = {
+  { /* not a lead byte */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x40 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x3000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x41 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+    0x03C0, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+    0x03A0, 0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0451, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+    0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E,
+    0x044F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0401, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+    0x041F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E,
+    0x042F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x42 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFE1, 0xFF0E, 0xFF1C, 0xFF08, 0xFF0B, 0xFF5C,
+    0xFF06, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF01, 0xFFE5, 0xFF0A, 0xFF09, 0xFF1B, 0xFFE2,
+    0x2212, 0xFF0F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00A6, 0xFF0C, 0xFF05, 0xFF3F, 0xFF1E, 0xFF1F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF40, 0xFF1A, 0xFF03, 0xFF20, 0xFF07, 0xFF1D, 0xFF02,
+    0xFFFF, 0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFE3, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFF5B, 0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFF5D, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30, 0xFF31, 0xFF32, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFF04, 0xFFFF, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39, 0xFF3A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFF10, 0xFF11, 0xFF12, 0xFF13, 0xFF14, 0xFF15, 0xFF16, 0xFF17, 0xFF18, 0xFF19, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x43 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3, 0x30A5, 0xFFE0, 0x2220, 0x22A5, 0x2312, 0x2202, 0x2207,
+    0xFFFF, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30EE, 0x30FC, 0x30F5, 0x30F6, 0x2261, 0x2252, 0x226A, 0x226B, 0x221A,
+    0x223D, 0x221D, 0x222B, 0x222C, 0x2208, 0x220B, 0x2286, 0x2287, 0x2282, 0x2283, 0x222A, 0x2229, 0x2227, 0x2228, 0x21D2, 0x21D4,
+    0x2200, 0x2203, 0x212B, 0x2030, 0x266F, 0x266D, 0x266A, 0x2020, 0x2021, 0x00B6, 0x25EF, 0xFFFF, 0x2500, 0x2502, 0x250C, 0x2510,
+    0xFFFF, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0xFFFF, 0x30B5, 0x30B7, 0x30B9, 0x30BB,
+    0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0xFFFF, 0xFFFF, 0x30CF, 0x30D2, 0x30D5,
+    0xFFFF, 0x301C, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0xFFFF, 0x30E8, 0x30E9, 0x30EA, 0x30EB,
+    0x2518, 0x2514, 0x251C, 0x252C, 0x2524, 0x2534, 0x253C, 0x2501, 0x2503, 0x250F, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x309B, 0x309C,
+    0x30AC, 0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7, 0x30C9, 0x30D0,
+    0x30D3, 0x30D6, 0x30D9, 0x30DC, 0x30F4, 0x30D1, 0x30D4, 0x30D7, 0x30DA, 0x30DD, 0x30F0, 0x30F1, 0x30FD, 0x30FE, 0xFFFF, 0xFFFF,
+    0xFF3C, 0x2513, 0x251B, 0x2517, 0x2523, 0x2533, 0x252B, 0x253B, 0x254B, 0x2520, 0x252F, 0x2528, 0x2537, 0x253F, 0x251D, 0x2530,
+    0x2525, 0x2538, 0x2542, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x44 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x300E, 0x300F, 0xFF3B, 0xFF3D, 0x3092, 0x3041, 0x3043, 0x3045, 0x2014, 0x00B1, 0x2260, 0x221E, 0x2103, 0xFFFF,
+    0x00B4, 0x3047, 0x3049, 0x3083, 0x3085, 0x3087, 0x3063, 0x308E, 0xFFFF, 0xFFFF, 0x2010, 0x3003, 0x4EDD, 0x3005, 0x3006, 0x3007,
+    0x00A8, 0x2018, 0x201C, 0x3014, 0x3008, 0x300A, 0x3010, 0x2266, 0x2234, 0x2642, 0x00A7, 0x203B, 0x3012, 0x3231, 0x2116, 0x2121,
+    0xFF3E, 0x2019, 0x201D, 0x3015, 0x3009, 0x300B, 0x3011, 0x2267, 0x2235, 0x2640, 0x00D7, 0x00F7, 0x2016, 0x3013, 0x2025, 0x2026,
+    0xFFFF, 0x3042, 0x3044, 0x3046, 0x3048, 0x304A, 0x304B, 0x304D, 0x304F, 0x3051, 0x3053, 0xFFFF, 0x3055, 0x3057, 0x3059, 0x305B,
+    0x305D, 0x305F, 0x3061, 0x3064, 0x3066, 0x3068, 0x306A, 0x306B, 0x306C, 0x306D, 0x306E, 0xFFFF, 0xFFFF, 0x306F, 0x3072, 0x3075,
+    0xFFFF, 0xFFFF, 0x3078, 0x307B, 0x307E, 0x307F, 0x3080, 0x3081, 0x3082, 0x3084, 0x3086, 0xFFFF, 0x3088, 0x3089, 0x308A, 0x308B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x308C, 0x308D, 0x308F, 0x3093, 0xFFFF, 0xFFFF,
+    0x304C, 0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A, 0x305C, 0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070,
+    0x3073, 0x3076, 0x3079, 0x307C, 0xFFFF, 0x3071, 0x3074, 0x3077, 0x307A, 0x307D, 0x3090, 0x3091, 0x309D, 0x309E, 0xFFFF, 0xFFFF,
+    0x25CB, 0x25CF, 0x25B3, 0x25B2, 0x25CE, 0x2606, 0x2605, 0x25C7, 0x25C6, 0x25A1, 0x25A0, 0x25BD, 0x25BC, 0x00B0, 0x2032, 0x2033,
+    0x2192, 0x2190, 0x2191, 0x2193, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x45 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B, 0x4E5D, 0x5341, 0x767E, 0x5343, 0x4E07, 0x5104, 0x90FD,
+    0x9053, 0x5E9C, 0x770C, 0x5E02, 0x533A, 0x753A, 0x6751, 0x6771, 0x897F, 0x5357, 0x5317, 0x5927, 0x4E2D, 0x5C0F, 0x4E0A, 0x4E0B,
+    0x5E74, 0x6708, 0x65E5, 0x7530, 0x5B50, 0x5C71, 0x672C, 0x5DDD, 0x85E4, 0x91CE, 0x5DE5, 0x696D, 0x6728, 0x4E95, 0x90CE, 0x5CF6,
+    0x96C4, 0x9AD8, 0x5CA1, 0x592B, 0x539F, 0x4EAC, 0x4F50, 0x6B63, 0x677E, 0x6A5F, 0x548C, 0x88FD, 0x7537, 0x7F8E, 0x5409, 0x5D0E,
+    0x77F3, 0x8C37, 0x96FB, 0x9577, 0x6CBB, 0x6CA2, 0x91D1, 0x65B0, 0x53E3, 0x6A4B, 0x4E45, 0x798F, 0x6240, 0x5E73, 0x5185, 0x56FD,
+    0x5316, 0x962A, 0x5BAE, 0x4EBA, 0x4F5C, 0x90E8, 0x6E05, 0x6B21, 0x7FA9, 0x751F, 0x4EE3, 0x51FA, 0x6C34, 0x68EE, 0x5149, 0x52A0,
+    0x5408, 0x795E, 0x6797, 0x91CD, 0x884C, 0x4FE1, 0x660E, 0x6D77, 0x5B89, 0x5E78, 0x4FDD, 0x592A, 0x5BCC, 0x6C5F, 0x9234, 0x524D,
+    0x77E5, 0x6B66, 0x4F0A, 0x662D, 0x5206, 0x52DD, 0x7528, 0x5E83, 0x9020, 0x6C17, 0x6210, 0x898B, 0x5229, 0x4F1A, 0x5B66, 0x5CA9,
+    0x7523, 0x9593, 0x5730, 0x81EA, 0x826F, 0x95A2, 0x611B, 0x653F, 0x5C3E, 0x8A08, 0x6587, 0x624B, 0x7236, 0x65B9, 0x4E8B, 0x6238,
+    0x54C1, 0x559C, 0x6E21, 0x5F18, 0x53E4, 0x8FBA, 0x5009, 0x9244, 0x4E4B, 0x5834, 0x6D0B, 0x57CE, 0x6D25, 0x7ACB, 0x5EA6, 0x5348,
+    0x4ECA, 0x5F66, 0x8A2D, 0x901A, 0x52D5, 0x5F8C, 0x5948, 0x5B9A, 0x6C60, 0x5C4B, 0x6D5C, 0x7406, 0x5742, 0x5B9F, 0x82F1, 0x7684,
+    0x53F8, 0x79C0, 0x6A2A, 0x540D, 0x5B5D, 0x7AF9, 0x535A, 0x529B, 0x5EAB, 0x8449, 0x6804, 0x6C38, 0x5668, 0x7389, 0x591A, 0xFFFF,
+  },
+  { /* lead 0x46 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8CC0, 0x771F, 0x6075, 0x9759, 0x5186, 0x8302, 0x654F, 0x8C4A, 0x5175, 0x6CD5, 0x767A, 0x9752, 0x5897, 0x6599, 0x5FE0,
+    0x8CC7, 0x6642, 0x7269, 0x8ECA, 0x5FB3, 0x8981, 0x5BFE, 0x585A, 0x79CB, 0x767D, 0x6CB3, 0x702C, 0x6CB9, 0x9686, 0x8535, 0x5F53,
+    0x4FCA, 0x5FD7, 0x6625, 0x793E, 0x99AC, 0x5165, 0x5EFA, 0x6839, 0x6749, 0x9032, 0x8208, 0x6D66, 0x7CBE, 0x540C, 0x6027, 0x7C73,
+    0x8005, 0x52A9, 0x679D, 0x8FD1, 0x76F4, 0x76EE, 0x6765, 0x753B, 0x76F8, 0x9ED2, 0x4E38, 0x8239, 0x7531, 0x58EB, 0x7B2C, 0x718A,
+    0x7D19, 0x5065, 0x68B0, 0x82B3, 0x571F, 0x6709, 0x5BB6, 0x7DDA, 0x7D4C, 0x8ABF, 0x5929, 0x671F, 0x7F6E, 0x6D45, 0x6589, 0x5F0F,
+    0x5F62, 0x9762, 0x7A2E, 0x8F38, 0x5916, 0x5143, 0x4F53, 0x9E7F, 0x5FA1, 0x5973, 0x5EB7, 0x4E16, 0x52C7, 0x5800, 0x597D, 0x5150,
+    0x5BFA, 0x92FC, 0x7279, 0x57FC, 0x9054, 0x5411, 0x53D6, 0x7B49, 0x667A, 0x56DE, 0x9580, 0x904B, 0x5099, 0x601D, 0x963F, 0x4E0D,
+    0x9808, 0x5168, 0x5BFF, 0x5584, 0x677F, 0x98EF, 0x8C9E, 0x73FE, 0x98DF, 0x7D44, 0x985E, 0x516C, 0x6750, 0x9999, 0x5546, 0x7D50,
+    0x8868, 0x77E2, 0x6F5F, 0x79C1, 0x5236, 0x90A6, 0x6CBC, 0x7CF8, 0x5B8F, 0x7B56, 0x6CE2, 0x54E1, 0x6570, 0x958B, 0x6E96, 0x6A39,
+    0x8CBB, 0x660C, 0x5F37, 0x7814, 0x53CB, 0x5B87, 0x82E5, 0x83CA, 0x6301, 0x82B1, 0x5F15, 0x7D00, 0x8352, 0x5225, 0x4FEE, 0x8D8A,
+    0x4F4F, 0x85AC, 0x6BDB, 0x9060, 0x554F, 0x5965, 0x578B, 0x5FC3, 0x767B, 0x65E9, 0x67F3, 0x6D69, 0x8CEA, 0x52D9, 0x6CC9, 0x5E38,
+    0x5B88, 0x57FA, 0x7BA1, 0x6CF0, 0x4F38, 0x6700, 0x4EE5, 0x6B4C, 0x88D5, 0x8D64, 0x8DB3, 0x898F, 0x6D41, 0x8AA0, 0x6607, 0xFFFF,
+  },
+  { /* lead 0x47 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DDE, 0x7167, 0x5869, 0x9001, 0x96C5, 0x672B, 0x54F2, 0x5CB8, 0x4E5F, 0x5C90, 0x521D, 0x8328, 0x5247, 0x6BD4, 0x80FD,
+    0x8A71, 0x6295, 0x8EE2, 0x83C5, 0x9023, 0x4ED6, 0x6C11, 0x7D66, 0x9152, 0x7E41, 0x4FA1, 0x6E80, 0x671D, 0x4ED8, 0x6761, 0x7121,
+    0x8003, 0x697D, 0x4E3B, 0x610F, 0x6226, 0x5207, 0x5264, 0x7247, 0x7D30, 0x6E08, 0x7A32, 0x5E03, 0x91CC, 0x5C5E, 0x7AE0, 0x5909,
+    0x4F55, 0x685C, 0x5F7C, 0x67FB, 0x76CA, 0x58F2, 0x4EC1, 0x6DF1, 0x53F0, 0x9CE5, 0x9DB4, 0x652F, 0x6574, 0x89D2, 0x5609, 0x5473,
+    0x885B, 0x8B70, 0x5727, 0x7387, 0x8DEF, 0x706B, 0x961C, 0x8F1D, 0x70B9, 0x4E0E, 0x6E1B, 0x7551, 0x9280, 0x7A7A, 0x4EA4, 0x7FBD,
+    0x534A, 0x53CE, 0x592E, 0x7DCF, 0x8A18, 0x6674, 0x69CB, 0x969B, 0x6885, 0x5370, 0x8A00, 0x6817, 0x8EAB, 0x66F8, 0x514B, 0x7D20,
+    0x96C6, 0x7BC0, 0x5148, 0x6EDD, 0x6C7A, 0x6559, 0x7D14, 0x67F4, 0x63A5, 0x661F, 0x7740, 0x7559, 0x6620, 0x5DF1, 0x754C, 0x5177,
+    0x656C, 0x7FA4, 0x9806, 0x5171, 0x6D3B, 0x91CF, 0x6307, 0x89E3, 0x5BA4, 0x679C, 0x5404, 0x671B, 0x9632, 0x7D04, 0x61B2, 0x967D,
+    0x4E80, 0x56F3, 0x4E88, 0x8272, 0x7A0E, 0x690D, 0x53EF, 0x6052, 0x4F4D, 0x5178, 0x5FC5, 0x7D9A, 0x6025, 0x5728, 0x57A3, 0x541B,
+    0x5EF6, 0x5D8B, 0x4F01, 0x6803, 0x670D, 0x71B1, 0x5272, 0x5354, 0x6B69, 0x53F2, 0x512A, 0x658E, 0x623F, 0x5B97, 0x683C, 0x8FB0,
+    0x7B20, 0x5712, 0x8AF8, 0x8107, 0x5553, 0x8CE2, 0x5F25, 0x98A8, 0x5F97, 0x6613, 0x6253, 0x982D, 0x65ED, 0x6BB5, 0x52E2, 0x7136,
+    0x56E3, 0x984D, 0x843D, 0x914D, 0x7A0B, 0x8FBB, 0x543E, 0x611F, 0x5BDB, 0x53CD, 0x7A14, 0x9700, 0x6E90, 0x6C96, 0x984C, 0xFFFF,
+  },
+  { /* lead 0x48 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8FBC, 0x8349, 0x7B97, 0x76DB, 0x8FB2, 0x90A3, 0x7701, 0x69D8, 0x6BBF, 0x5C11, 0x4ECB, 0x53D7, 0x97F3, 0x7DE8, 0x59D4,
+    0x5E84, 0x4FC2, 0x72B6, 0x793A, 0x5E97, 0x5A9B, 0x682A, 0x6ECB, 0x68A8, 0x7E04, 0x53F3, 0x5DE6, 0x53CA, 0x9078, 0x5C45, 0x60C5,
+    0x7DF4, 0x70AD, 0x9928, 0x9271, 0x6A21, 0x6B8A, 0x7E3E, 0x4E9C, 0x7E4A, 0x4EF2, 0x5857, 0x6D88, 0x8853, 0x691C, 0x6717, 0x5B85,
+    0x529F, 0x5C1A, 0x8CBF, 0x60A6, 0x8102, 0x7BE0, 0x4F73, 0x7D21, 0x51A8, 0x6851, 0x78BA, 0x7267, 0x4E26, 0x5024, 0x89B3, 0x8CB4,
+    0x7DAD, 0x7D71, 0x5BBF, 0x4E21, 0x7CD6, 0x89AA, 0x9332, 0x6F84, 0x65BD, 0x5BB9, 0x98DB, 0x5C40, 0x7950, 0x904E, 0x6C0F, 0x6539,
+    0x76E4, 0x7A4D, 0x6E0B, 0x5DFB, 0x6DF3, 0x5FDC, 0x4E89, 0x8ECD, 0x88C5, 0x9178, 0x7E54, 0x67D3, 0x5E1D, 0x7DBF, 0x7C89, 0x822A,
+    0x7532, 0x5468, 0x4ED9, 0x5F85, 0x4F4E, 0x7DD1, 0x8EFD, 0x9EBB, 0x6176, 0x52B4, 0x78EF, 0x4E39, 0x80B2, 0x9650, 0x5C0E, 0x653E,
+    0x6643, 0x5EA7, 0x4EF6, 0x60F3, 0x9A13, 0x4ED5, 0x4F7F, 0x8F2A, 0x9854, 0x756A, 0x5F35, 0x805E, 0x4F9B, 0x6E6F, 0x6EB6, 0x6821,
+    0x9285, 0x92F3, 0x878D, 0x9756, 0x5199, 0x5B8C, 0x6E2F, 0x935B, 0x591C, 0x5145, 0x9F8D, 0x7DB1, 0x83F1, 0x901F, 0x52C9, 0x5237,
+    0x8D77, 0x6469, 0x53C2, 0x55B6, 0x7A42, 0x63A8, 0x8FD4, 0x8077, 0x6B62, 0x4F1D, 0x5E79, 0x7403, 0x6A29, 0x5C55, 0x5E61, 0x845B,
+    0x5EAD, 0x975E, 0x53F7, 0x5358, 0x6B73, 0x62E1, 0x51E6, 0x8A9E, 0x6628, 0x57DF, 0x6DF5, 0x518D, 0x50CD, 0x79D1, 0x9B5A, 0x7AEF,
+    0x9014, 0x6848, 0x5B57, 0x8AD6, 0x517C, 0x53C8, 0x632F, 0x6280, 0x5FB9, 0x672D, 0x7CFB, 0x5F93, 0x51B7, 0x614B, 0x5CF0, 0xFFFF,
+  },
+  { /* lead 0x49 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5931, 0x539A, 0x5074, 0x6CE8, 0x6E2C, 0x9803, 0x4E57, 0x8A66, 0x576A, 0x8429, 0x515A, 0x6C7D, 0x5B9D, 0x606D, 0x6A0B,
+    0x6E29, 0x6577, 0x8AAC, 0x82B8, 0x544A, 0x6B74, 0x822C, 0x98FE, 0x793C, 0x5C06, 0x96E3, 0x7802, 0x5224, 0x5F79, 0x5F71, 0x66FD,
+    0x5E2F, 0x9678, 0x938C, 0x8AC7, 0x5F70, 0x60AA, 0x6A19, 0x7533, 0x5BB3, 0x6BCD, 0x88DC, 0x5E4C, 0x58F0, 0x9664, 0x7B39, 0x5A66,
+    0x4E7E, 0x7AF6, 0x829D, 0x725B, 0x8CB7, 0x79FB, 0x785D, 0x8336, 0x52B9, 0x990A, 0x52F2, 0x80A5, 0x8B19, 0x7089, 0x590F, 0x5802,
+    0x67CF, 0x6255, 0x5E30, 0x713C, 0x786B, 0x8001, 0x7A76, 0x5BE9, 0x91DD, 0x65AD, 0x5C04, 0x5DEE, 0x5D50, 0x6298, 0x8010, 0x5BA3,
+    0x59CB, 0x5F8B, 0x6B8B, 0x666F, 0x8C61, 0x90F7, 0x5353, 0x96E2, 0x85AB, 0x6B7B, 0x8015, 0x64CD, 0x4EAE, 0x4E91, 0x90E1, 0x52E4,
+    0x6C42, 0x8CAB, 0x5B98, 0x59BB, 0x88CF, 0x773C, 0x4F2F, 0x7AAF, 0x7BC9, 0x968E, 0x63DB, 0x6842, 0x99C5, 0x68B6, 0x5747, 0x8CA1,
+    0x547D, 0x738B, 0x84B2, 0x90C1, 0x78E8, 0x7B11, 0x66F2, 0x6975, 0x5831, 0x63D0, 0x8A3C, 0x96EA, 0x9055, 0x88C1, 0x9996, 0x75C5,
+    0x6850, 0x4F59, 0x74E6, 0x4EE4, 0x5439, 0x732A, 0x672A, 0x525B, 0x8CA0, 0x4F34, 0x5100, 0x542B, 0x9069, 0x8FC4, 0x5C3B, 0x5DCC,
+    0x7B54, 0x8FFD, 0x8A0E, 0x4E08, 0x925B, 0x71C3, 0x8AB2, 0x70BA, 0x9662, 0x679A, 0x76AE, 0x8B77, 0x7DBE, 0x96E8, 0x6211, 0x5BC4,
+    0x837B, 0x62BC, 0x7D0D, 0x76E3, 0x7E2B, 0x964D, 0x572D, 0x7ADC, 0x7BC4, 0x6BBA, 0x8C9D, 0x698E, 0x9047, 0x6F14, 0x5360, 0x8FEB,
+    0x5287, 0x624D, 0x6566, 0x7D1A, 0x7D42, 0x6BCE, 0x7D79, 0x7E2E, 0x666E, 0x7965, 0x500B, 0x5C02, 0x99D2, 0x8A55, 0x7560, 0xFFFF,
+  },
+  { /* lead 0x4A */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5B58, 0x8089, 0x50BE, 0x5E2B, 0x6DB2, 0x4F8B, 0x81E3, 0x81F3, 0x56E0, 0x7D99, 0x5DF2, 0x899A, 0x6E9D, 0x6D17, 0x8AAD,
+    0x8996, 0x731B, 0x5DE8, 0x7DB2, 0x888B, 0x4EFB, 0x5BC6, 0x8896, 0x6CC1, 0x8457, 0x8F03, 0x6BC5, 0x97FF, 0x8CA9, 0x5E45, 0x82E6,
+    0x63AA, 0x5F81, 0x78C1, 0x821E, 0x52AA, 0x7AAA, 0x5999, 0x6297, 0x8F14, 0x7FD2, 0x4FC3, 0x54C9, 0x967A, 0x66F4, 0x8B1B, 0x5E72,
+    0x5FA9, 0x8A2A, 0x6D3E, 0x7763, 0x6483, 0x8B58, 0x614E, 0x5A5A, 0x8D85, 0x71D0, 0x983C, 0x72E9, 0x583A, 0x5DFE, 0x8A8D, 0x67C4,
+    0x7DE0, 0x4F11, 0x77ED, 0x4F0F, 0x5BC5, 0x629C, 0x5C3C, 0x533B, 0x6DC0, 0x81FC, 0x96D1, 0x904A, 0x6D6E, 0x93E1, 0x5C64, 0x98FC,
+    0x524A, 0x6DFB, 0x8584, 0x968A, 0x56FA, 0x5883, 0x7766, 0x9805, 0x4E73, 0x8C46, 0x8A31, 0x7DD2, 0x8FF0, 0x6D6A, 0x4F9D, 0x6B6F,
+    0x6B27, 0x62C5, 0x511F, 0x9769, 0x5374, 0x9AA8, 0x6775, 0x887F, 0x5305, 0x7570, 0x8D70, 0x864E, 0x5CEF, 0x8CDE, 0x5FF5, 0x725F,
+    0x7686, 0x609F, 0x80CC, 0x59EB, 0x8131, 0x5E0C, 0x8A17, 0x9676, 0x82D7, 0x74B0, 0x84B8, 0x50D5, 0x96F2, 0x7248, 0x7834, 0x6DD1,
+    0x6E09, 0x67FF, 0x6F54, 0x5915, 0x500D, 0x72AC, 0x9EC4, 0x7B46, 0x9B3C, 0x6563, 0x53BB, 0x8A98, 0x91DC, 0x9818, 0x6FC3, 0x65C5,
+    0x501F, 0x7F8A, 0x6F64, 0x9031, 0x5F3E, 0x63F4, 0x9038, 0x8B66, 0x7BE4, 0x7206, 0x6843, 0x72EC, 0x65CF, 0x82A6, 0x5BA2, 0x6960,
+    0x9EA6, 0x52DF, 0x6790, 0x639B, 0x7D75, 0x9855, 0x5DF3, 0x5805, 0x8ACB, 0x95A3, 0x8863, 0x8CA8, 0x5B63, 0x5E8A, 0x5449, 0x786C,
+    0x7D2B, 0x8CA2, 0x5352, 0x7D76, 0x8CB8, 0x7070, 0x547C, 0x6545, 0x6676, 0x73B2, 0x56F2, 0x7BB1, 0x58A8, 0x7A81, 0x66AE, 0xFFFF,
+  },
+  { /* lead 0x4B */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8087, 0x59FF, 0x8840, 0x56F0, 0x7B51, 0x6DF7, 0x5F01, 0x934B, 0x9000, 0x4FE3, 0x675F, 0x4FBF, 0x8CC3, 0x526F, 0x63A1,
+    0x5442, 0x8907, 0x698A, 0x5E2D, 0x5A18, 0x7518, 0x514D, 0x5E7E, 0x50B5, 0x5BDD, 0x68D2, 0x745E, 0x69FB, 0x5FAE, 0x55E3, 0x8A70,
+    0x5BF8, 0x5824, 0x8358, 0x5F13, 0x5E95, 0x706F, 0x751A, 0x7D05, 0x60E3, 0x7E70, 0x5012, 0x5238, 0x83EF, 0x5373, 0x5F31, 0x6A2B,
+    0x9CF4, 0x53CC, 0x6D32, 0x4EAB, 0x4E92, 0x842C, 0x8A8C, 0x65E2, 0x6F01, 0x80A9, 0x9DF9, 0x8B72, 0x7B52, 0x9589, 0x6D74, 0x63A2,
+    0x6590, 0x5BD2, 0x6319, 0x8AB0, 0x76DF, 0x99A8, 0x7A74, 0x8236, 0x8846, 0x8061, 0x6557, 0x5922, 0x9644, 0x88AB, 0x9326, 0x7B4B,
+    0x62B5, 0x5371, 0x5E81, 0x5BDF, 0x4F75, 0x58C1, 0x7058, 0x7DCA, 0x5438, 0x73E0, 0x52D8, 0x5208, 0x78D0, 0x6B23, 0x6838, 0x4E43,
+    0x690E, 0x8377, 0x6ED1, 0x98F2, 0x8170, 0x8857, 0x8EF8, 0x798E, 0x83DC, 0x8FCE, 0x7E01, 0x5510, 0x4EA8, 0x8A33, 0x9162, 0x5EFB,
+    0x606F, 0x4E86, 0x664B, 0x6368, 0x5217, 0x8056, 0x51FD, 0x7642, 0x821F, 0x9685, 0x50CF, 0x662F, 0x4F3C, 0x4E59, 0x6A3D, 0x4E71,
+    0x523A, 0x8ACF, 0x6A58, 0x66FF, 0x670B, 0x653B, 0x9732, 0x5EC3, 0x8A13, 0x5782, 0x604B, 0x866B, 0x95D8, 0x60A9, 0x4E01, 0x63CF,
+    0x6FC0, 0x659C, 0x8CAC, 0x8305, 0x7CA7, 0x6050, 0x96F7, 0x5FCD, 0x640D, 0x5B54, 0x900F, 0x62D3, 0x59B9, 0x7159, 0x51AC, 0x79F0,
+    0x552F, 0x5275, 0x6697, 0x80F8, 0x4E98, 0x4ECF, 0x51CD, 0x9D5C, 0x5144, 0x7A93, 0x67F1, 0x5841, 0x7C21, 0x8861, 0x5C31, 0x68DA,
+    0x91E7, 0x9DF2, 0x63EE, 0x6575, 0x84EE, 0x523B, 0x6B32, 0x7C98, 0x5982, 0x969C, 0x8987, 0x7C9F, 0x9006, 0x62DB, 0x66DC, 0xFFFF,
+  },
+  { /* lead 0x4C */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6355, 0x6982, 0x50AC, 0x623B, 0x5FD8, 0x63DA, 0x75DB, 0x627F, 0x616E, 0x8266, 0x7C95, 0x716E, 0x96C7, 0x7F6A, 0x5426,
+    0x5200, 0x83D3, 0x5211, 0x594F, 0x9D28, 0x574A, 0x66C7, 0x9858, 0x820E, 0x6614, 0x733F, 0x50B7, 0x6551, 0x5EB8, 0x5B6B, 0x55AC,
+    0x5FEB, 0x6388, 0x8CAF, 0x676F, 0x5951, 0x5A01, 0x71E5, 0x5DE3, 0x8C6A, 0x6271, 0x81F4, 0x5C3A, 0x5F92, 0x9045, 0x7384, 0x7149,
+    0x79D8, 0x796D, 0x9003, 0x83CC, 0x5FB4, 0x5B8D, 0x6279, 0x64AE, 0x7D18, 0x723E, 0x5BEE, 0x65E7, 0x8D08, 0x9E78, 0x52E7, 0x5D07,
+    0x9F62, 0x6069, 0x536F, 0x6681, 0x9663, 0x5E3D, 0x62B1, 0x722A, 0x6E4A, 0x93AE, 0x79E6, 0x53E5, 0x809D, 0x88FE, 0x53B3, 0x6C88,
+    0x6E7F, 0x5141, 0x9091, 0x6F6E, 0x84C4, 0x85EA, 0x8129, 0x6BD2, 0x663C, 0x7F72, 0x73C2, 0x5F1F, 0x790E, 0x60B2, 0x72ED, 0x58EE,
+    0x8179, 0x8E8D, 0x5C65, 0x5DE7, 0x6C37, 0x6DE1, 0x862D, 0x72AF, 0x8E0A, 0x7C92, 0x8218, 0x8033, 0x63A7, 0x9291, 0x5019, 0x8155,
+    0x8A69, 0x8EDF, 0x66B4, 0x8133, 0x7591, 0x6B20, 0x6669, 0x90F5, 0x4E32, 0x73EA, 0x693F, 0x7687, 0x707D, 0x7D3A, 0x6148, 0x8607,
+    0x99FF, 0x59C9, 0x7832, 0x7815, 0x907F, 0x80A1, 0x5C3F, 0x66A2, 0x9418, 0x6D44, 0x5E55, 0x5854, 0x7B95, 0x8DE1, 0x4EA1, 0x8C5A,
+    0x81E8, 0x89E6, 0x9670, 0x5263, 0x74F6, 0x9A5A, 0x6012, 0x520A, 0x7434, 0x9801, 0x907A, 0x5504, 0x7956, 0x5230, 0x54B2, 0x8A34,
+    0x96A3, 0x4FF3, 0x9283, 0x91E3, 0x7D39, 0x9688, 0x4F51, 0x7D61, 0x5DBA, 0x9BAE, 0x5F80, 0x795D, 0x8597, 0x8DA3, 0x7C60, 0x5C0A,
+    0x7565, 0x85A9, 0x63D6, 0x9E97, 0x7D22, 0x5375, 0x9AEA, 0x9042, 0x6B3D, 0x7D0B, 0x6392, 0x80AA, 0x7DE9, 0x9F3B, 0x99C6, 0xFFFF,
+  },
+  { /* lead 0x4D */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6D78, 0x6731, 0x5531, 0x6398, 0x7825, 0x5CB3, 0x5DE1, 0x92AD, 0x98FD, 0x9810, 0x6CE3, 0x6B64, 0x5321, 0x6B53, 0x5E8F,
+    0x7AE5, 0x502B, 0x6E56, 0x62BD, 0x8276, 0x6A9C, 0x4E18, 0x57F7, 0x752B, 0x7C97, 0x82EB, 0x9802, 0x811A, 0x73CD, 0x8F9B, 0x5C0B,
+    0x63E1, 0x7372, 0x8150, 0x80E1, 0x5B99, 0x76D7, 0x6291, 0x65EC, 0x8A3A, 0x5947, 0x65E8, 0x6E7E, 0x6696, 0x55AB, 0x8F09, 0x92ED,
+    0x9396, 0x4EEE, 0x755C, 0x6F38, 0x8F9E, 0x7981, 0x5C01, 0x62E0, 0x9BE8, 0x91C8, 0x6276, 0x65CB, 0x8E0F, 0x8B21, 0x699B, 0x6216,
+    0x5A92, 0x90B8, 0x50DA, 0x79DF, 0x6C41, 0x5270, 0x9175, 0x8B39, 0x685D, 0x5875, 0x819C, 0x5B9C, 0x8A89, 0x8A72, 0x9D8F, 0x6377,
+    0x5974, 0x8AA4, 0x52B1, 0x6962, 0x5C48, 0x9CE9, 0x673A, 0x75B2, 0x6D1E, 0x4F0D, 0x7E6D, 0x7B48, 0x7FCC, 0x65E6, 0x59A5, 0x79E9,
+    0x6212, 0x6EDE, 0x770B, 0x8CA7, 0x65BC, 0x885D, 0x6ADB, 0x5C4A, 0x8074, 0x9084, 0x8ECC, 0x65D7, 0x57F9, 0x708E, 0x6F06, 0x5E7C,
+    0x77AC, 0x4FF5, 0x5949, 0x81ED, 0x9B45, 0x7FFC, 0x8178, 0x69FD, 0x6CCA, 0x69C7, 0x79D2, 0x8B1D, 0x9ED9, 0x81D3, 0x7A3C, 0x7968,
+    0x6F5C, 0x63B2, 0x8DDD, 0x6383, 0x6E9C, 0x5E33, 0x61F8, 0x76BF, 0x642C, 0x7DB4, 0x6247, 0x6458, 0x6816, 0x5F69, 0x9022, 0x7A1A,
+    0x82B9, 0x70C8, 0x9A12, 0x6163, 0x6FEF, 0x53EB, 0x9D3B, 0x62FE, 0x60A0, 0x9591, 0x6D99, 0x6162, 0x9298, 0x635C, 0x9707, 0x8972,
+    0x683D, 0x51E1, 0x9B54, 0x608C, 0x5B22, 0x99C4, 0x7126, 0x8A73, 0x971C, 0x7396, 0x67D4, 0x60A3, 0x4E11, 0x4EF0, 0x8CDB, 0x8CB0,
+    0x7912, 0x9774, 0x8986, 0x5146, 0x57DC, 0x99D0, 0x80C3, 0x8338, 0x78A7, 0x86CD, 0x7F85, 0x5049, 0x8247, 0x690B, 0x7C4D, 0xFFFF,
+  },
+  { /* lead 0x4E */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x53EA, 0x5F26, 0x6E25, 0x6881, 0x9375, 0x5DFD, 0x5347, 0x9727, 0x643A, 0x75C7, 0x6FA4, 0x73A9, 0x77E9, 0x9451, 0x8B5C,
+    0x808C, 0x674E, 0x4EAD, 0x582F, 0x7573, 0x8ED2, 0x6CE5, 0x9320, 0x8FF7, 0x7D33, 0x72C2, 0x8217, 0x7422, 0x82C5, 0x9A30, 0x773A,
+    0x5F84, 0x9673, 0x64AD, 0x920D, 0x74DC, 0x60C7, 0x86ED, 0x4FFA, 0x52A3, 0x6A3A, 0x7720, 0x5320, 0x61B6, 0x5674, 0x8776, 0x6CBF,
+    0x505C, 0x602A, 0x8466, 0x6B96, 0x6DBC, 0x97D3, 0x968F, 0x6876, 0x60D1, 0x5378, 0x64A4, 0x51A0, 0x9154, 0x5DF4, 0x629E, 0x5E63,
+    0x929A, 0x7693, 0x6C5A, 0x6597, 0x50E7, 0x7C82, 0x5F6B, 0x6CE1, 0x5F6C, 0x5AC1, 0x6F2C, 0x852D, 0x6442, 0x5750, 0x58C7, 0x8CFC,
+    0x8A5E, 0x7A7F, 0x689D, 0x7E26, 0x7A40, 0x7344, 0x8AEB, 0x4FD7, 0x7A63, 0x8036, 0x7DEF, 0x80C6, 0x8AED, 0x731F, 0x8FEA, 0x4F0E,
+    0x758B, 0x518A, 0x6734, 0x5FD9, 0x61C7, 0x65AF, 0x9CF3, 0x5ECA, 0x9262, 0x68DF, 0x6CB8, 0x80F4, 0x57CB, 0x6C99, 0x96A0, 0x5B64,
+    0x58F1, 0x68C4, 0x5410, 0x982C, 0x8A87, 0x4E5E, 0x6167, 0x9BAB, 0x90AA, 0x55B0, 0x82BD, 0x596A, 0x66F3, 0x8299, 0x5893, 0x719F,
+    0x6284, 0x67D1, 0x9063, 0x5ACC, 0x6C57, 0x7CE7, 0x5851, 0x64B2, 0x58CA, 0x830E, 0x5968, 0x5302, 0x5A46, 0x8702, 0x6065, 0x72D9,
+    0x89A7, 0x6689, 0x66F9, 0x5D6F, 0x5BB0, 0x96BC, 0x636E, 0x60DC, 0x7948, 0x51DD, 0x8606, 0x5EC9, 0x7554, 0x596E, 0x6B04, 0x4F43,
+    0x7B94, 0x67DA, 0x62DD, 0x628A, 0x971E, 0x62ED, 0x6EC5, 0x508D, 0x67B6, 0x80E4, 0x9EBF, 0x5EB5, 0x638C, 0x85CD, 0x9867, 0x52C5,
+    0x6016, 0x68CB, 0x61D0, 0x5751, 0x8F29, 0x5FAA, 0x81A8, 0x7D62, 0x71C8, 0x54C0, 0x69CC, 0x6B3E, 0x65AC, 0x63C3, 0x4F46, 0xFFFF,
+  },
+  { /* lead 0x4F */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x7B1B, 0x6B86, 0x88F8, 0x5203, 0x732E, 0x6687, 0x7D17, 0x57F4, 0x570F, 0x618E, 0x970A, 0x7C3F, 0x8B00, 0x7881, 0x8CE0,
+    0x548B, 0x7B87, 0x745B, 0x7C11, 0x8870, 0x5398, 0x5448, 0x6CF3, 0x6F22, 0x53F6, 0x88B4, 0x5301, 0x7A6B, 0x8695, 0x586B, 0x5D29,
+    0x88C2, 0x62D2, 0x4E1E, 0x5036, 0x96C0, 0x7363, 0x8A3B, 0x5176, 0x7199, 0x7FE0, 0x8888, 0x7E1E, 0x4E4F, 0x84CB, 0x6F2B, 0x5859,
+    0x936C, 0x53E9, 0x865A, 0x9149, 0x86EF, 0x5E06, 0x5507, 0x902E, 0x6795, 0x846C, 0x5BA5, 0x82A5, 0x8431, 0x6D8C, 0x63FA, 0x4EA5,
+    0x51C6, 0x6328, 0x7F70, 0x5B5F, 0x5DBD, 0x99C8, 0x53EC, 0x7985, 0x8A54, 0x7962, 0x88DF, 0x5B09, 0x4FB5, 0x4F91, 0x9B8E, 0x5192,
+    0x96F0, 0x6DAF, 0x622F, 0x8490, 0x8CDC, 0x5075, 0x5CE0, 0x4E14, 0x4F83, 0x7C54, 0x84D1, 0x77B3, 0x8AEE, 0x5CE8, 0x62F6, 0x663B,
+    0x8A93, 0x8526, 0x8A95, 0x65FA, 0x6714, 0x53D4, 0x62AB, 0x8CE6, 0x88F3, 0x5BE7, 0x868A, 0x668E, 0x582A, 0x6170, 0x696F, 0x9F13,
+    0x7A92, 0x7893, 0x6A7F, 0x9017, 0x9266, 0x7D10, 0x7BC7, 0x6EF4, 0x821C, 0x5C3D, 0x62CD, 0x85C1, 0x6F02, 0x6E67, 0x6691, 0x85A6,
+    0x637A, 0x821B, 0x4F8D, 0x5091, 0x8A02, 0x62EC, 0x9BC9, 0x7A3D, 0x7C9B, 0x50C5, 0x9019, 0x708A, 0x7C8B, 0x64EC, 0x665F, 0x6562,
+    0x732B, 0x5339, 0x67A0, 0x55A7, 0x6D2A, 0x7A3F, 0x64E6, 0x79A7, 0x67D8, 0x7B26, 0x96BB, 0x6311, 0x72A0, 0x5C6F, 0x7026, 0x97EE,
+    0x60DF, 0x8AFE, 0x8B04, 0x8494, 0x9BD6, 0x82AF, 0x932C, 0x6606, 0x9640, 0x5BC2, 0x86C7, 0x7949, 0x8017, 0x6919, 0x7092, 0x963B,
+    0x7C7E, 0x59D3, 0x5B5C, 0x7D1B, 0x91D8, 0x6A80, 0x85E9, 0x6905, 0x6C93, 0x502D, 0x4EA6, 0x7FC1, 0x61A4, 0x8CCA, 0x9665, 0xFFFF,
+  },
+  { /* lead 0x50 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x93D1, 0x53F1, 0x598A, 0x8EAC, 0x62D8, 0x6867, 0x71D5, 0x7B67, 0x504F, 0x67D0, 0x82D1, 0x978D, 0x748B, 0x80BA, 0x7336,
+    0x514E, 0x8105, 0x90CA, 0x584A, 0x67FE, 0x6FF1, 0x5FFD, 0x76C6, 0x9A0E, 0x507D, 0x9694, 0x5EF7, 0x7BB8, 0x904D, 0x6C4E, 0x85FB,
+    0x819D, 0x67AF, 0x564C, 0x5606, 0x8C8C, 0x56DA, 0x73ED, 0x8CC4, 0x8FC5, 0x96F6, 0x6C50, 0x8944, 0x8F3F, 0x7D5E, 0x60E8, 0x72FC,
+    0x7D9C, 0x8463, 0x5CFB, 0x5446, 0x5D16, 0x6CA1, 0x81B3, 0x58FA, 0x5BB4, 0x8108, 0x541F, 0x8CBC, 0x6182, 0x78A9, 0x6FE1, 0x91A4,
+    0x76F2, 0x6020, 0x76FE, 0x84C9, 0x7F36, 0x4EC7, 0x755D, 0x7A17, 0x84EC, 0x75F4, 0x4F3A, 0x676D, 0x7460, 0x62F3, 0x6F20, 0x79E4,
+    0x87F9, 0x6094, 0x6234, 0x66AB, 0x820C, 0x8499, 0x723A, 0x5FCC, 0x6109, 0x70CF, 0x7261, 0x7A50, 0x5098, 0x9AED, 0x5D69, 0x601C,
+    0x6667, 0x99B4, 0x5E7B, 0x643E, 0x5830, 0x53C9, 0x7A9F, 0x990C, 0x9B42, 0x8F5F, 0x7AAE, 0x5B9B, 0x68A2, 0x6249, 0x7984, 0x9DFA,
+    0x5451, 0x932F, 0x8AC4, 0x5F90, 0x8DF3, 0x5A2F, 0x80DE, 0x6D29, 0x7A4F, 0x84BC, 0x9D2B, 0x9010, 0x6D38, 0x916A, 0x6FC1, 0x9905,
+    0x6BBB, 0x5EB6, 0x91B8, 0x5076, 0x6F0F, 0x4E19, 0x540F, 0x9675, 0x6C72, 0x51B4, 0x5631, 0x9F20, 0x66A6, 0x5F0A, 0x75AB, 0x51F8,
+    0x674F, 0x8DF5, 0x6C70, 0x8A6B, 0x757F, 0x5CAC, 0x6841, 0x8CD3, 0x9BDB, 0x8475, 0x6893, 0x840C, 0x72DB, 0x7577, 0x8568, 0x783A,
+    0x847A, 0x5F10, 0x831C, 0x6813, 0x6E1A, 0x9DAF, 0x51F9, 0x7980, 0x4E99, 0x5EE3, 0x908A, 0x80AF, 0x59A8, 0x77DB, 0x8D74, 0x8A1F,
+    0x673D, 0x533F, 0x8A0A, 0x5618, 0x6756, 0x53D9, 0x4F10, 0x7409, 0x5A41, 0x4FF8, 0x79B0, 0x9838, 0x8E2A, 0x9D60, 0x8F44, 0xFFFF,
+  },
+  { /* lead 0x51 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x65A5, 0x75BE, 0x906D, 0x867B, 0x60BC, 0x51B6, 0x5937, 0x7D2F, 0x916C, 0x69AE, 0x7CE0, 0x792A, 0x5D14, 0x64C1, 0x58EC,
+    0x589C, 0x8D66, 0x66D9, 0x61F2, 0x912D, 0x6E58, 0x9435, 0x965B, 0x7272, 0x5F6A, 0x5E9A, 0x8F1B, 0x5B95, 0x5C39, 0x9013, 0x834F,
+    0x7CCE, 0x620A, 0x90ED, 0x691B, 0x6E15, 0x65DB, 0x66FE, 0x4E9F, 0x55AA, 0x7A83, 0x83E9, 0x8B83, 0x846D, 0x83F0, 0x7F50, 0x918D,
+    0x9190, 0x758E, 0x95A5, 0x81E7, 0x75E2, 0x61A9, 0x8A50, 0x95B2, 0x53A8, 0x59F6, 0x9813, 0x7891, 0x7C17, 0x6B3A, 0x57E0, 0x620E,
+    0x83D6, 0x8AD2, 0x75D4, 0x927E, 0x59DC, 0x5289, 0x9087, 0x6FFE, 0x7473, 0x5C09, 0x9D6C, 0x84FC, 0x7CDF, 0x7BAD, 0x8A6E, 0x594E,
+    0x56A2, 0x819A, 0x7947, 0x6636, 0x53E1, 0x7887, 0x58CC, 0x9397, 0x6E13, 0x5256, 0x828B, 0x9E9F, 0x9583, 0x658C, 0x9E93, 0x7345,
+    0x6E26, 0x9D07, 0x5983, 0x7DAC, 0x96C1, 0x61BE, 0x6762, 0x9ECE, 0x90A8, 0x9187, 0x9F0E, 0x7C38, 0x51F1, 0x8599, 0x524C, 0x540E,
+    0x7901, 0x655E, 0x6668, 0x5CE1, 0x7566, 0x76C8, 0x8679, 0x531D, 0x5506, 0x7926, 0x8912, 0x77EF, 0x7CC0, 0x570B, 0x515C, 0x7E8A,
+    0x535C, 0x8A60, 0x65A7, 0x8766, 0x5766, 0x6AE8, 0x87FB, 0x5E16, 0x7AEA, 0x8D73, 0x771E, 0x737A, 0x66E0, 0x9410, 0x816B, 0x7B08,
+    0x91FC, 0x5737, 0x6FE4, 0x856A, 0x7E55, 0x9957, 0x87BA, 0x694A, 0x818F, 0x5EFF, 0x891C, 0x72D0, 0x9846, 0x9EDB, 0x8D99, 0x5DD6,
+    0x62B9, 0x64AB, 0x4F76, 0x613F, 0x68AF, 0x5F14, 0x800C, 0x92F8, 0x7BC1, 0x52FE, 0x664F, 0x9177, 0x51F6, 0x97A0, 0x839E, 0x647A,
+    0x9C3A, 0x67F5, 0x7C4F, 0x685F, 0x9B6F, 0x9F4B, 0x7FFB, 0x9348, 0x4FF6, 0x9E92, 0x9197, 0x96DB, 0x5BE6, 0x6CCC, 0x7CFE, 0xFFFF,
+  },
+  { /* lead 0x52 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9453, 0x6822, 0x66B9, 0x5BD4, 0x98F4, 0x8AE6, 0x8154, 0x7827, 0x74BD, 0x6ED3, 0x9288, 0x5A20, 0x5B8B, 0x86F8, 0x760D,
+    0x865C, 0x6641, 0x91C9, 0x5589, 0x7A4E, 0x59E5, 0x6042, 0x932B, 0x5B5A, 0x849C, 0x5C91, 0x96CD, 0x62D9, 0x675C, 0x6787, 0x5E7D,
+    0x8650, 0x9EB9, 0x5CB1, 0x80CE, 0x7A00, 0x8ABC, 0x5700, 0x8096, 0x7D72, 0x9211, 0x8098, 0x907C, 0x7761, 0x8737, 0x9075, 0x817A,
+    0x7C3E, 0x6EA2, 0x965E, 0x7E90, 0x72D7, 0x58FD, 0x60B3, 0x9786, 0x7E88, 0x587E, 0x6E20, 0x84DC, 0x6961, 0x77AD, 0x5197, 0x652A,
+    0x6777, 0x5DCD, 0x6101, 0x932E, 0x5954, 0x6367, 0x798D, 0x7AFF, 0x80D6, 0x58B3, 0x6168, 0x6AC3, 0x7483, 0x9B92, 0x660A, 0x642D,
+    0x5118, 0x6763, 0x809B, 0x9C10, 0x4FC9, 0x6953, 0x7A1C, 0x52FF, 0x6055, 0x768E, 0x817F, 0x5642, 0x5F6D, 0x7194, 0x70BB, 0x7436,
+    0x8000, 0x874B, 0x55DA, 0x7435, 0x7690, 0x96EB, 0x66DD, 0x751C, 0x633D, 0x6EC9, 0x7C64, 0x7CA5, 0x6D35, 0x935C, 0x7027, 0x5E25,
+    0x701D, 0x54BD, 0x611A, 0x6973, 0x6C6A, 0x559A, 0x6D19, 0x96CC, 0x5BE1, 0x59FB, 0x697C, 0x914C, 0x7709, 0x8500, 0x7A46, 0x7872,
+    0x92E4, 0x8CED, 0x7CFA, 0x9D1B, 0x814E, 0x9AC4, 0x68A0, 0x6DCB, 0x5918, 0x83B1, 0x5629, 0x9B41, 0x6897, 0x70B3, 0x9771, 0x9419,
+    0x67A2, 0x6802, 0x7895, 0x68A7, 0x50D6, 0x80B1, 0x5EF8, 0x82D4, 0x797A, 0x67CA, 0x7E4D, 0x69CD, 0x51C4, 0x723D, 0x6829, 0x99B3,
+    0x5F3C, 0x8F61, 0x682B, 0x6155, 0x6591, 0x8FB1, 0x7E1B, 0x9798, 0x9952, 0x8877, 0x5B2C, 0x6631, 0x4FA0, 0x6939, 0x6AFB, 0x5BB5,
+    0x7AC8, 0x5026, 0x5944, 0x9059, 0x7B25, 0x7B4F, 0x8E74, 0x8543, 0x5858, 0x8B0E, 0x5039, 0x8654, 0x97F6, 0x7569, 0x72F8, 0xFFFF,
+  },
+  { /* lead 0x53 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4EF7, 0x9D89, 0x5016, 0x51CC, 0x62CC, 0x91C6, 0x8755, 0x649A, 0x88F4, 0x91E6, 0x6854, 0x695A, 0x6C40, 0x7B6C, 0x6741,
+    0x77D7, 0x8823, 0x5384, 0x8EAF, 0x7280, 0x8C6B, 0x788D, 0x7165, 0x8207, 0x68B1, 0x8D04, 0x9077, 0x701E, 0x8FE6, 0x810A, 0x81BF,
+    0x89DC, 0x68B3, 0x6ADF, 0x92EA, 0x95C7, 0x7957, 0x7A20, 0x53A9, 0x8E5F, 0x786F, 0x79B9, 0x5F27, 0x5ED6, 0x6853, 0x93AC, 0x919C,
+    0x691A, 0x5806, 0x64B0, 0x7E4B, 0x7D8F, 0x68F2, 0x6EA5, 0x82DB, 0x9192, 0x5243, 0x8EB0, 0x9081, 0x721B, 0x7DCB, 0x7656, 0x59AC,
+    0x6FE0, 0x8B28, 0x80A2, 0x5544, 0x6070, 0x5F4A, 0x68C8, 0x633A, 0x9438, 0x9B4F, 0x81E5, 0x6A17, 0x70DD, 0x69A7, 0x614C, 0x920E,
+    0x9310, 0x9BAD, 0x52D7, 0x925E, 0x92F9, 0x5993, 0x7696, 0x66FB, 0x5769, 0x73CA, 0x7678, 0x6A1F, 0x7E9C, 0x9811, 0x8CD1, 0x5840,
+    0x6349, 0x871C, 0x62D0, 0x60B4, 0x6B89, 0x86EE, 0x5764, 0x581D, 0x8549, 0x7235, 0x7652, 0x983B, 0x8237, 0x5351, 0x5C24, 0x59BE,
+    0x5815, 0x901D, 0x69B4, 0x834A, 0x9EA9, 0x976B, 0x8086, 0x53AD, 0x6068, 0x4FAE, 0x76C3, 0x6A05, 0x689B, 0x937E, 0x99D5, 0x91C7,
+    0x5C16, 0x585E, 0x61A7, 0x9699, 0x4FDF, 0x8278, 0x9C52, 0x5F45, 0x6108, 0x7C8D, 0x806F, 0x5DF7, 0x8D6B, 0x57B0, 0x98E2, 0x5703,
+    0x79BF, 0x5996, 0x7941, 0x540A, 0x83DF, 0x9C39, 0x52D2, 0x6BD8, 0x86CB, 0x4EC0, 0x9A28, 0x5366, 0x8006, 0x7337, 0x6492, 0x8FED,
+    0x5AC9, 0x5420, 0x537F, 0x4FAF, 0x807E, 0x543B, 0x7515, 0x7B18, 0x8749, 0x54B3, 0x704C, 0x8997, 0x6CAB, 0x85FA, 0x7114, 0x696E,
+    0x9328, 0x745A, 0x59D1, 0x6E5B, 0x617E, 0x53E2, 0x8317, 0x76E7, 0x848B, 0x85AF, 0x6925, 0x5C60, 0x7259, 0x75D5, 0x8B90, 0xFFFF,
+  },
+  { /* lead 0x54 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6E07, 0x82AD, 0x5C4F, 0x7BED, 0x9784, 0x6F70, 0x764C, 0x88B7, 0x92D2, 0x4F36, 0x5EFE, 0x9061, 0x88E1, 0x8471, 0x711A,
+    0x6D1B, 0x80B4, 0x74E2, 0x7433, 0x5A7F, 0x905C, 0x980C, 0x5319, 0x906E, 0x6BB4, 0x85AA, 0x7897, 0x7AFA, 0x6AAE, 0x8910, 0x958F,
+    0x620C, 0x4F3D, 0x4F7C, 0x79BE, 0x9D0E, 0x4ED4, 0x57A2, 0x51A5, 0x6900, 0x6089, 0x707C, 0x7AE3, 0x8956, 0x93A7, 0x9C2D, 0x5112,
+    0x52FA, 0x7CCA, 0x60F9, 0x7078, 0x81C6, 0x559D, 0x6991, 0x96C9, 0x553E, 0x805A, 0x8304, 0x8332, 0x54FA, 0x565B, 0x8FBF, 0x5634,
+    0x6760, 0x5265, 0x840E, 0x5E5F, 0x7B65, 0x9035, 0x8387, 0x6B4E, 0x58BE, 0x6309, 0x727D, 0x97AD, 0x69D0, 0x546A, 0x984E, 0x632B,
+    0x714E, 0x8557, 0x7CDE, 0x6372, 0x68F9, 0x7511, 0x8602, 0x6EBA, 0x5A3C, 0x7A84, 0x851A, 0x95A4, 0x59D0, 0x60DA, 0x51EA, 0x5A29,
+    0x7169, 0x6F15, 0x696B, 0x63BB, 0x75E9, 0x4E4E, 0x7DBB, 0x6934, 0x8521, 0x8FFA, 0x9354, 0x9C3B, 0x5F17, 0x5ED3, 0x8258, 0x895F,
+    0x82E7, 0x52C3, 0x5C51, 0x83AB, 0x7826, 0x79E1, 0x7FF0, 0x626E, 0x60F0, 0x5CA8, 0x6F97, 0x71A8, 0x9909, 0x5132, 0x5E37, 0x5F04,
+    0x637B, 0x6753, 0x68D7, 0x6652, 0x9CF6, 0x88B0, 0x52AB, 0x4FC4, 0x4E3C, 0x67B3, 0x7BAA, 0x7F4D, 0x8A23, 0x63B4, 0x71E6, 0x65A4,
+    0x6F09, 0x853D, 0x5072, 0x7DBA, 0x5516, 0x7B04, 0x72FD, 0x6CD3, 0x8422, 0x621F, 0x50AD, 0x8235, 0x8718, 0x5919, 0x6028, 0x677C,
+    0x6F23, 0x75B9, 0x695C, 0x520E, 0x8018, 0x8B01, 0x71ED, 0x5713, 0x660F, 0x83EB, 0x7164, 0x7D9B, 0x5617, 0x7D7D, 0x8F4D, 0x9318,
+    0x8569, 0x5D17, 0x678C, 0x67DE, 0x87C7, 0x79AE, 0x5835, 0x8404, 0x9041, 0x7FD4, 0x6E8C, 0x8A63, 0x9D08, 0x670F, 0x939A, 0xFFFF,
+  },
+  { /* lead 0x55 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63AC, 0x602F, 0x64E2, 0x608D, 0x96B7, 0x6357, 0x8461, 0x914B, 0x75D8, 0x60E7, 0x9913, 0x9C57, 0x5984, 0x6DEB, 0x5E96,
+    0x6D9C, 0x9BF0, 0x58BB, 0x7977, 0x60B6, 0x633F, 0x5BF5, 0x9812, 0x558B, 0x82D3, 0x5147, 0x6190, 0x7953, 0x79BD, 0x6C5D, 0x9EBA,
+    0x9C48, 0x8DA8, 0x5EE0, 0x7D43, 0x5EFC, 0x854E, 0x8CE4, 0x5AE1, 0x54E8, 0x5023, 0x52BE, 0x7DEC, 0x8511, 0x6666, 0x6C3E, 0x724C,
+    0x8ADC, 0x9C0D, 0x77A5, 0x8B02, 0x8D05, 0x6F11, 0x9834, 0x97FB, 0x50FB, 0x7F75, 0x5A03, 0x8513, 0x4FB6, 0x634C, 0x9D61, 0x808B,
+    0x5294, 0x65A1, 0x567A, 0x5957, 0x8D0B, 0x6A35, 0x6AD3, 0x70F9, 0x865E, 0x6FB1, 0x51E7, 0x7FEB, 0x59EA, 0x5E87, 0x6B6A, 0x754F,
+    0x717D, 0x914E, 0x7D2C, 0x8C79, 0x6062, 0x621A, 0x7FA8, 0x5F1B, 0x6C8C, 0x86FE, 0x7562, 0x7B86, 0x9AB8, 0x6627, 0x7ABA, 0x844E,
+    0x6F81, 0x8B2C, 0x86A4, 0x6FEB, 0x7B8B, 0x7F77, 0x8F2F, 0x8E44, 0x7E23, 0x4E4D, 0x79A6, 0x8AFA, 0x903C, 0x50D1, 0x9ECD, 0x5EDF,
+    0x758F, 0x631F, 0x53DB, 0x9910, 0x826E, 0x62F7, 0x68FA, 0x725D, 0x803D, 0x58D5, 0x5C4D, 0x86D9, 0x540B, 0x8805, 0x92F2, 0x9237,
+    0x5C61, 0x985B, 0x86E4, 0x966A, 0x7262, 0x6955, 0x6CD7, 0x6994, 0x9C2F, 0x77E7, 0x68C9, 0x8DE8, 0x6D6C, 0x67C1, 0x9BAA, 0x619A,
+    0x63A9, 0x7015, 0x9306, 0x934D, 0x6A61, 0x6258, 0x5283, 0x7525, 0x5687, 0x6C83, 0x6834, 0x649E, 0x4E9B, 0x7252, 0x59E6, 0x8FC2,
+    0x5FBD, 0x6DD8, 0x85F7, 0x8A51, 0x9817, 0x99C1, 0x63A0, 0x7C81, 0x5B30, 0x8139, 0x5403, 0x7E82, 0x8106, 0x532A, 0x6A8E, 0x7F6B,
+    0x54E9, 0x5678, 0x8AB9, 0x6715, 0x5BD3, 0x6478, 0x64FE, 0x6B1D, 0x8CC2, 0x51CB, 0x7E8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x56 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5F0C, 0x4E10, 0x4E15, 0x4E28, 0x4E2A, 0x4E31, 0x4E36, 0x4E3F, 0x4E42, 0x4E56, 0x4E58, 0x4E62, 0x4E82, 0x4E85, 0x4E8A,
+    0x4E8E, 0x5F0D, 0x4E9E, 0x4EA0, 0x4EA2, 0x4EB0, 0x4EB3, 0x4EB6, 0x4ECE, 0x4ECD, 0x4EC4, 0x4EC6, 0x4EC2, 0x4EE1, 0x4ED7, 0x4EDE,
+    0x4EED, 0x4EDF, 0x4EFC, 0x4F09, 0x4F1C, 0x4F00, 0x4F03, 0x4F5A, 0x4F30, 0x4F5D, 0x4F39, 0x4F57, 0x4F47, 0x4F5E, 0x4F56, 0x4F5B,
+    0x4F92, 0x4F8A, 0x4F88, 0x4F8F, 0x4F9A, 0x4FAD, 0x4F98, 0x4F7B, 0x4FAB, 0x4F69, 0x4F70, 0x4F94, 0x4F6F, 0x4F86, 0x4F96, 0x4FD4,
+    0x4FCE, 0x4FD8, 0x4FDB, 0x4FD1, 0x4FDA, 0x4FD0, 0x4FCD, 0x4FE4, 0x4FE5, 0x501A, 0x5040, 0x5028, 0x5014, 0x502A, 0x5025, 0x5005,
+    0x5021, 0x5022, 0x5029, 0x502C, 0x4FFF, 0x4FFE, 0x4FEF, 0x5011, 0x501E, 0x5006, 0x5043, 0x5047, 0x5055, 0x5050, 0x5048, 0x505A,
+    0x5056, 0x500F, 0x5046, 0x5070, 0x5042, 0x506C, 0x5078, 0x5080, 0x5094, 0x509A, 0x5085, 0x50B4, 0x6703, 0x50B2, 0x50C9, 0x50CA,
+    0x50B3, 0x50C2, 0x50F4, 0x50DE, 0x50E5, 0x50D8, 0x50ED, 0x50E3, 0x50EE, 0x50F9, 0x50F5, 0x5109, 0x5101, 0x5102, 0x511A, 0x5115,
+    0x5114, 0x5116, 0x5121, 0x513A, 0x5137, 0x513C, 0x513B, 0x513F, 0x5140, 0x514A, 0x514C, 0x5152, 0x5154, 0x5162, 0x5164, 0x5169,
+    0x516A, 0x516E, 0x5180, 0x5182, 0x56D8, 0x518C, 0x5189, 0x518F, 0x5191, 0x5193, 0x5195, 0x5196, 0x519D, 0x51A4, 0x51A6, 0x51A2,
+    0x51A9, 0x51AA, 0x51AB, 0x51B3, 0x51B1, 0x51B2, 0x51B0, 0x51B5, 0x51BE, 0x51BD, 0x51C5, 0x51C9, 0x51DB, 0x51E0, 0x51E9, 0x51EC,
+    0x51ED, 0x51F0, 0x51F5, 0x51FE, 0x5204, 0x520B, 0x5214, 0x5215, 0x5227, 0x522A, 0x522E, 0x5233, 0x5239, 0x5244, 0x524B, 0xFFFF,
+  },
+  { /* lead 0x57 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x524F, 0x525E, 0x5254, 0x5271, 0x526A, 0x5273, 0x5274, 0x5269, 0x527F, 0x527D, 0x528D, 0x5288, 0x5292, 0x5291, 0x529C,
+    0x52A6, 0x52AC, 0x52AD, 0x52BC, 0x52B5, 0x52C1, 0x52C0, 0x52CD, 0x52DB, 0x52DE, 0x52E3, 0x52E6, 0x52E0, 0x52F3, 0x52F5, 0x52F8,
+    0x52F9, 0x5300, 0x5306, 0x5307, 0x5308, 0x7538, 0x530D, 0x5310, 0x530F, 0x5315, 0x531A, 0x5324, 0x5323, 0x532F, 0x5331, 0x5333,
+    0x5338, 0x5340, 0x5345, 0x5346, 0x5349, 0x4E17, 0x534D, 0x51D6, 0x8209, 0x535E, 0x5369, 0x536E, 0x5372, 0x5377, 0x537B, 0x5382,
+    0x5393, 0x5396, 0x53A0, 0x53A6, 0x53A5, 0x53AE, 0x53B0, 0x53B2, 0x53B6, 0x53C3, 0x7C12, 0x53DD, 0x53DF, 0x66FC, 0xFA0E, 0x71EE,
+    0x53EE, 0x53E8, 0x53ED, 0x53FA, 0x5401, 0x543D, 0x5440, 0x542C, 0x542D, 0x543C, 0x542E, 0x5436, 0x5429, 0x541D, 0x544E, 0x548F,
+    0x5475, 0x548E, 0x545F, 0x5471, 0x5477, 0x5470, 0x5492, 0x547B, 0x5480, 0x549C, 0x5476, 0x5484, 0x5490, 0x5486, 0x548A, 0x54C7,
+    0x54BC, 0x54AF, 0x54A2, 0x54B8, 0x54A5, 0x54AC, 0x54C4, 0x54D8, 0x54C8, 0x54A8, 0x54AB, 0x54C2, 0x54A4, 0x54A9, 0x54BE, 0x54E5,
+    0x54FF, 0x54E6, 0x550F, 0x5514, 0x54FD, 0x54EE, 0x54ED, 0x54E2, 0x5539, 0x5540, 0x5563, 0x554C, 0x552E, 0x555C, 0x5545, 0x5556,
+    0x5557, 0x5538, 0x5533, 0x555D, 0x5599, 0x5580, 0x558A, 0x559F, 0x557B, 0x557E, 0x5598, 0x559E, 0x55AE, 0x557C, 0x5586, 0x5583,
+    0x55A9, 0x5587, 0x55A8, 0x55C5, 0x55DF, 0x55C4, 0x55DC, 0x55E4, 0x55D4, 0x55F9, 0x5614, 0x55F7, 0x5616, 0x55FE, 0x55FD, 0x561B,
+    0x564E, 0x5650, 0x5636, 0x5632, 0x5638, 0x566B, 0x5664, 0x5686, 0x562F, 0x566C, 0x566A, 0x71DF, 0x5694, 0x568F, 0x5680, 0xFFFF,
+  },
+  { /* lead 0x58 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x568A, 0x56A0, 0x56A5, 0x56AE, 0x56B6, 0x56B4, 0x56C8, 0x56C2, 0x56BC, 0x56C1, 0x56C3, 0x56C0, 0x56CE, 0x56D3, 0x56D1,
+    0x56D7, 0x56EE, 0x56F9, 0x56FF, 0x5704, 0x5709, 0x5708, 0x570D, 0x55C7, 0x5718, 0x5716, 0x571C, 0x5726, 0x5738, 0x574E, 0x573B,
+    0x5759, 0x5740, 0x574F, 0x5765, 0x5788, 0x5761, 0x577F, 0x5789, 0x5793, 0x57A0, 0x57A4, 0x57B3, 0x57AC, 0x57AA, 0x57C3, 0x57C6,
+    0x57C8, 0x57C0, 0x57D4, 0x57C7, 0x57D2, 0x57D3, 0x57D6, 0xFA0F, 0x580A, 0x57E3, 0x580B, 0x5819, 0x5821, 0x584B, 0x5862, 0x6BC0,
+    0x583D, 0x5852, 0xFA10, 0x5870, 0x5879, 0x5885, 0x5872, 0x589F, 0x58AB, 0x58B8, 0x589E, 0x58AE, 0x58B2, 0x58B9, 0x58BA, 0x58C5,
+    0x58D3, 0x58D1, 0x58D7, 0x58D9, 0x58D8, 0x58DE, 0x58DC, 0x58DF, 0x58E4, 0x58E5, 0x58EF, 0x58F7, 0x58F9, 0x58FB, 0x58FC, 0x5902,
+    0x590A, 0x590B, 0x5910, 0x591B, 0x68A6, 0x5925, 0x592C, 0x592D, 0x5932, 0x5938, 0x593E, 0x5955, 0x5950, 0x5953, 0x595A, 0x5958,
+    0x595B, 0x595D, 0x5963, 0x5962, 0x5960, 0x5967, 0x596C, 0x5969, 0x5978, 0x5981, 0x598D, 0x599B, 0x599D, 0x59A3, 0x59A4, 0x59B2,
+    0x59BA, 0x59C6, 0x59E8, 0x59D9, 0x59DA, 0x5A25, 0x5A1F, 0x5A11, 0x5A1C, 0x5A1A, 0x5A09, 0x5A40, 0x5A6C, 0x5A49, 0x5A35, 0x5A36,
+    0x5A62, 0x5A6A, 0x5A9A, 0x5ABC, 0x5ABE, 0x5AD0, 0x5ACB, 0x5AC2, 0x5ABD, 0x5AE3, 0x5AD7, 0x5AE6, 0x5AE9, 0x5AD6, 0x5AFA, 0x5AFB,
+    0x5B0C, 0x5B0B, 0x5B16, 0x5B32, 0x5B2A, 0x5B36, 0x5B3E, 0x5B43, 0x5B45, 0x5B40, 0x5B51, 0x5B55, 0x5B56, 0x6588, 0x5B5B, 0x5B65,
+    0x5B69, 0x5B70, 0x5B73, 0x5B75, 0x5B78, 0x5B7A, 0x5B80, 0x5B83, 0x5BA6, 0x5BB8, 0x5BC3, 0x5BC7, 0x5BC0, 0x5BC9, 0x752F, 0xFFFF,
+  },
+  { /* lead 0x59 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5BD0, 0x5BD8, 0x5BDE, 0x5BEC, 0x5BE4, 0x5BE2, 0x5BE5, 0x5BEB, 0x5BF0, 0x5BF3, 0x5BF6, 0x5C05, 0x5C07, 0x5C08, 0x5C0D,
+    0x5C13, 0x5C1E, 0x5C20, 0x5C22, 0x5C28, 0x5C38, 0x5C41, 0x5C46, 0x5C4E, 0x5C53, 0x5C50, 0x5B71, 0x5C6C, 0x5C6E, 0x5C76, 0x5C79,
+    0x5C8C, 0x5C94, 0x5CBE, 0x5CAB, 0x5CBB, 0x5CB6, 0x5CB7, 0x5CA6, 0x5CBA, 0x5CC5, 0x5CBC, 0x5CC7, 0x5CD9, 0x5CE9, 0x5CFD, 0x5CFA,
+    0x5CF5, 0x5CED, 0x5CEA, 0x5D0B, 0x5D15, 0x5D1F, 0x5D1B, 0x5D11, 0x5D27, 0x5D22, 0x5D1A, 0x5D19, 0x5D18, 0x5D4C, 0x5D52, 0x5D53,
+    0xFA11, 0x5D5C, 0x5D4E, 0x5D4B, 0x5D42, 0x5D6C, 0x5D73, 0x5D6D, 0x5D76, 0x5D87, 0x5D84, 0x5D82, 0x5D8C, 0x5DA2, 0x5D9D, 0x5D90,
+    0x5DAC, 0x5DAE, 0x5DB7, 0x5DB8, 0x5DBC, 0x5DB9, 0x5DC9, 0x5DD0, 0x5DD3, 0x5DD2, 0x5DDB, 0x5DEB, 0x5DF5, 0x5E0B, 0x5E1A, 0x5E19,
+    0x5E11, 0x5E1B, 0x5E36, 0x5E44, 0x5E43, 0x5E40, 0x5E47, 0x5E4E, 0x5E57, 0x5E54, 0x5E62, 0x5E64, 0x5E75, 0x5E76, 0x5E7A, 0x5E7F,
+    0x5EA0, 0x5EC1, 0x5EC2, 0x5EC8, 0x5ED0, 0x5ECF, 0x5EDD, 0x5EDA, 0x5EDB, 0x5EE2, 0x5EE1, 0x5EE8, 0x5EE9, 0x5EEC, 0x5EF0, 0x5EF1,
+    0x5EF3, 0x5EF4, 0x5F03, 0x5F09, 0x5F0B, 0x5F11, 0x5F16, 0x5F21, 0x5F29, 0x5F2D, 0x5F2F, 0x5F34, 0x5F38, 0x5F41, 0x5F48, 0x5F4C,
+    0x5F4E, 0x5F51, 0x5F56, 0x5F57, 0x5F59, 0x5F5C, 0x5F5D, 0x5F61, 0x5F67, 0x5F73, 0x5F77, 0x5F83, 0x5F82, 0x5F7F, 0x5F8A, 0x5F88,
+    0x5F87, 0x5F91, 0x5F99, 0x5F9E, 0x5F98, 0x5FA0, 0x5FA8, 0x5FAD, 0x5FB7, 0x5FBC, 0x5FD6, 0x5FFB, 0x5FE4, 0x5FF8, 0x5FF1, 0x5FF0,
+    0x5FDD, 0x5FDE, 0x5FFF, 0x6021, 0x6019, 0x6010, 0x6029, 0x600E, 0x6031, 0x601B, 0x6015, 0x602B, 0x6026, 0x600F, 0x603A, 0xFFFF,
+  },
+  { /* lead 0x5A */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x605A, 0x6041, 0x6060, 0x605D, 0x606A, 0x6077, 0x605F, 0x604A, 0x6046, 0x604D, 0x6063, 0x6043, 0x6064, 0x606C, 0x606B,
+    0x6059, 0x6085, 0x6081, 0x6083, 0x609A, 0x6084, 0x609B, 0x608A, 0x6096, 0x6097, 0x6092, 0x60A7, 0x608B, 0x60E1, 0x60B8, 0x60DE,
+    0x60E0, 0x60D3, 0x60BD, 0x60C6, 0x60B5, 0x60D5, 0x60D8, 0x6120, 0x60F2, 0x6115, 0x6106, 0x60F6, 0x60F7, 0x6100, 0x60F4, 0x60FA,
+    0x6103, 0x6121, 0x60FB, 0x60F1, 0x610D, 0x610E, 0x6111, 0x6147, 0x614D, 0x6137, 0x6128, 0x6127, 0x613E, 0x614A, 0x6130, 0x613C,
+    0x612C, 0x6134, 0x6165, 0x615D, 0x613D, 0x6142, 0x6144, 0x6173, 0x6187, 0x6177, 0x6158, 0x6159, 0x615A, 0x616B, 0x6174, 0x616F,
+    0x6171, 0x615F, 0x6153, 0x6175, 0x6198, 0x6199, 0x6196, 0x61AC, 0x6194, 0x618A, 0x6191, 0x61AB, 0x61AE, 0x61CC, 0x61CA, 0x61C9,
+    0x61C8, 0x61C3, 0x61C6, 0x61BA, 0x61CB, 0x7F79, 0x61CD, 0x61E6, 0x61E3, 0x61F4, 0x61F7, 0x61F6, 0x61FD, 0x61FA, 0x61FF, 0x61FC,
+    0x61FE, 0x6200, 0x6208, 0x6209, 0x620D, 0x6213, 0x6214, 0x621B, 0x621E, 0x6221, 0x622A, 0x622E, 0x6230, 0x6232, 0x6233, 0x6241,
+    0x624E, 0x625E, 0x6263, 0x625B, 0x6260, 0x6268, 0x627C, 0x6282, 0x6289, 0x6292, 0x627E, 0x6293, 0x6296, 0x6283, 0x6294, 0x62D7,
+    0x62D1, 0x62BB, 0x62CF, 0x62AC, 0x62C6, 0x62C8, 0x62DC, 0x62D4, 0x62CA, 0x62C2, 0x62A6, 0x62C7, 0x629B, 0x62C9, 0x630C, 0x62EE,
+    0x62F1, 0x6327, 0x6302, 0x6308, 0x62EF, 0x62F5, 0x62FF, 0x6350, 0x634D, 0x633E, 0x634F, 0x6396, 0x638E, 0x6380, 0x63AB, 0x6376,
+    0x63A3, 0x638F, 0x6389, 0x639F, 0x636B, 0x6369, 0x63B5, 0x63BE, 0x63E9, 0x63C0, 0x63C6, 0x63F5, 0x63E3, 0x63C9, 0x63D2, 0xFFFF,
+  },
+  { /* lead 0x5B */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63F6, 0x63C4, 0x6434, 0x6406, 0x6413, 0x6426, 0x6436, 0x641C, 0x6417, 0x6428, 0x640F, 0x6416, 0x644E, 0x6467, 0x646F,
+    0x6460, 0x6476, 0x64B9, 0x649D, 0x64CE, 0x6495, 0x64BB, 0x6493, 0x64A5, 0x64A9, 0x6488, 0x64BC, 0x64DA, 0x64D2, 0x64C5, 0x64C7,
+    0x64D4, 0x64D8, 0x64C2, 0x64F1, 0x64E7, 0x64E0, 0x64E1, 0x64E3, 0x64EF, 0x64F4, 0x64F6, 0x64F2, 0x64FA, 0x6500, 0x64FD, 0x6518,
+    0x651C, 0x651D, 0x6505, 0x6524, 0x6523, 0x652B, 0x652C, 0x6534, 0x6535, 0x6537, 0x6536, 0x6538, 0x754B, 0x6548, 0x654E, 0x6556,
+    0x654D, 0x6558, 0x6555, 0x655D, 0x6572, 0x6578, 0x6582, 0x6583, 0x8B8A, 0x659B, 0x659F, 0x65AB, 0x65B7, 0x65C3, 0x65C6, 0x65C1,
+    0x65C4, 0x65CC, 0x65D2, 0x65D9, 0x65E1, 0x65E0, 0x65F1, 0x6600, 0x6615, 0x6602, 0x6772, 0x6603, 0x65FB, 0x6609, 0x663F, 0x6635,
+    0x662E, 0x661E, 0x6634, 0x661C, 0x6624, 0x6644, 0x6649, 0x6665, 0x6657, 0x665E, 0x6664, 0x6659, 0x6662, 0x665D, 0xFA12, 0x6673,
+    0x6670, 0x6683, 0x6688, 0x6684, 0x6699, 0x6698, 0x66A0, 0x669D, 0x66B2, 0x66C4, 0x66C1, 0x66BF, 0x66C9, 0x66BE, 0x66BC, 0x66B8,
+    0x66D6, 0x66DA, 0x66E6, 0x66E9, 0x66F0, 0x66F5, 0x66F7, 0x66FA, 0x670E, 0xF929, 0x6716, 0x671E, 0x7E22, 0x6726, 0x6727, 0x9738,
+    0x672E, 0x673F, 0x6736, 0x6737, 0x6738, 0x6746, 0x675E, 0x6759, 0x6766, 0x6764, 0x6789, 0x6785, 0x6770, 0x67A9, 0x676A, 0x678B,
+    0x6773, 0x67A6, 0x67A1, 0x67BB, 0x67B7, 0x67EF, 0x67B4, 0x67EC, 0x67E9, 0x67B8, 0x67E7, 0x67E4, 0x6852, 0x67DD, 0x67E2, 0x67EE,
+    0x67C0, 0x67CE, 0x67B9, 0x6801, 0x67C6, 0x681E, 0x6846, 0x684D, 0x6840, 0x6844, 0x6832, 0x684E, 0x6863, 0x6859, 0x688D, 0xFFFF,
+  },
+  { /* lead 0x5C */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6877, 0x687F, 0x689F, 0x687E, 0x688F, 0x68AD, 0x6894, 0x6883, 0x68BC, 0x68B9, 0x6874, 0x68B5, 0x68BA, 0x690F, 0x6901,
+    0x68CA, 0x6908, 0x68D8, 0x6926, 0x68E1, 0x690C, 0x68CD, 0x68D4, 0x68E7, 0x68D5, 0x6912, 0x68EF, 0x6904, 0x68E3, 0x68E0, 0x68CF,
+    0x68C6, 0x6922, 0x692A, 0x6921, 0x6923, 0x6928, 0xFA13, 0x6979, 0x6977, 0x6936, 0x6978, 0x6954, 0x696A, 0x6974, 0x6968, 0x693D,
+    0x6959, 0x6930, 0x695E, 0x695D, 0x697E, 0x6981, 0x69B2, 0x69BF, 0xFA14, 0x6998, 0x69C1, 0x69D3, 0x69BE, 0x69CE, 0x5BE8, 0x69CA,
+    0x69B1, 0x69DD, 0x69BB, 0x69C3, 0x69A0, 0x699C, 0x6995, 0x69DE, 0x6A2E, 0x69E8, 0x6A02, 0x6A1B, 0x69FF, 0x69F9, 0x69F2, 0x69E7,
+    0x69E2, 0x6A1E, 0x69ED, 0x6A14, 0x69EB, 0x6A0A, 0x6A22, 0x6A12, 0x6A23, 0x6A13, 0x6A30, 0x6A6B, 0x6A44, 0x6A0C, 0x6AA0, 0x6A36,
+    0x6A78, 0x6A47, 0x6A62, 0x6A59, 0x6A66, 0x6A48, 0x6A46, 0x6A38, 0x6A72, 0x6A73, 0x6A90, 0x6A8D, 0x6A84, 0x6AA2, 0x6AA3, 0x6A7E,
+    0x6A97, 0x6AAC, 0x6AAA, 0x6ABB, 0x6AC2, 0x6AB8, 0x6AB3, 0x6AC1, 0x6ADE, 0x6AE2, 0x6AD1, 0x6ADA, 0x6AE4, 0x8616, 0x8617, 0x6AEA,
+    0x6B05, 0x6B0A, 0x6AFA, 0x6B12, 0x6B16, 0x6B1F, 0x6B38, 0x6B37, 0x6B39, 0x76DC, 0x98EE, 0x6B47, 0x6B43, 0x6B49, 0x6B50, 0x6B59,
+    0x6B54, 0x6B5B, 0x6B5F, 0x6B61, 0x6B78, 0x6B79, 0x6B7F, 0x6B80, 0x6B84, 0x6B83, 0x6B8D, 0x6B98, 0x6B95, 0x6B9E, 0x6BA4, 0x6BAA,
+    0x6BAB, 0x6BAF, 0x6BB1, 0x6BB2, 0x6BB3, 0x6BB7, 0x6BBC, 0x6BC6, 0x6BCB, 0x6BD3, 0x6BD6, 0x6BDF, 0x6BEC, 0x6BEB, 0x6BF3, 0x6BEF,
+    0x6C08, 0x6C13, 0x6C14, 0x6C1B, 0x6C24, 0x6C23, 0x6C3F, 0x6C5E, 0x6C55, 0x6C5C, 0x6C62, 0x6C82, 0x6C8D, 0x6C86, 0x6C6F, 0xFFFF,
+  },
+  { /* lead 0x5D */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6C9A, 0x6C81, 0x6C9B, 0x6C7E, 0x6C68, 0x6C73, 0x6C92, 0x6C90, 0x6CC4, 0x6CF1, 0x6CBD, 0x6CC5, 0x6CAE, 0x6CDA, 0x6CDD,
+    0x6CB1, 0x6CBE, 0x6CBA, 0x6CDB, 0x6CEF, 0x6CD9, 0x6CEA, 0x6D1F, 0x6D04, 0x6D36, 0x6D2B, 0x6D3D, 0x6D33, 0x6D12, 0x6D0C, 0x6D63,
+    0x6D87, 0x6D93, 0x6D6F, 0x6D64, 0x6D5A, 0x6D79, 0x6D59, 0x6D8E, 0x6D95, 0x6D9B, 0x6D85, 0x6D96, 0x6DF9, 0x6E0A, 0x6E2E, 0x6DB5,
+    0x6DE6, 0x6DC7, 0x6DAC, 0x6DB8, 0x6DCF, 0x6DC6, 0x6DEC, 0x6DDE, 0x6DCC, 0x6DE8, 0x6DF8, 0x6DD2, 0x6DC5, 0x6DFA, 0x6DD9, 0x6DF2,
+    0x6DFC, 0x6DE4, 0x6DD5, 0x6DEA, 0x6DEE, 0x6E2D, 0x6E6E, 0x6E19, 0x6E72, 0x6E5F, 0x6E39, 0x6E3E, 0x6E23, 0x6E6B, 0x6E5C, 0x6E2B,
+    0x6E76, 0x6E4D, 0x6E1F, 0x6E27, 0x6E43, 0x6E3C, 0x6E3A, 0x6E4E, 0x6E24, 0x6E1D, 0x6E38, 0x6E82, 0x6EAA, 0x6E98, 0x6EB7, 0x6EBD,
+    0x6EAF, 0x6EC4, 0x6EB2, 0x6ED4, 0x6ED5, 0x6E8F, 0x6EBF, 0x6EC2, 0x6E9F, 0x6F41, 0x6F45, 0x6EEC, 0x6EF8, 0x6EFE, 0x6F3F, 0x6EF2,
+    0x6F31, 0x6EEF, 0x6F32, 0x6ECC, 0x6EFF, 0x6F3E, 0x6F13, 0x6EF7, 0x6F86, 0x6F7A, 0x6F78, 0x6F80, 0x6F6F, 0x6F5B, 0x6F6D, 0x6F74,
+    0x6F82, 0x6F88, 0x6F7C, 0x6F58, 0x6FC6, 0x6F8E, 0x6F91, 0x6F66, 0x6FB3, 0x6FA3, 0x6FB5, 0x6FA1, 0x6FB9, 0x6FDB, 0x6FAA, 0x6FC2,
+    0x6FDF, 0x6FD5, 0x6FEC, 0x6FD8, 0x6FD4, 0x6FF5, 0x6FEE, 0x7005, 0x7007, 0x7009, 0x700B, 0x6FFA, 0x7011, 0x7001, 0x700F, 0x701B,
+    0x701A, 0x701F, 0x6FF3, 0x7028, 0x7018, 0x7030, 0x703E, 0x7032, 0x7051, 0x7063, 0x7085, 0x7099, 0x70AF, 0x70AB, 0x70AC, 0x70B8,
+    0x70AE, 0x70DF, 0x70CB, 0x70D9, 0x7109, 0x710F, 0x7104, 0x70F1, 0x70FD, 0x711C, 0x7119, 0x715C, 0x7146, 0x7147, 0x7166, 0xFFFF,
+  },
+  { /* lead 0x5E */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x7162, 0x714C, 0x7156, 0x716C, 0x7188, 0x718F, 0x7184, 0x7195, 0xFA15, 0x71AC, 0x71C1, 0x71B9, 0x71BE, 0x71D2, 0x71E7,
+    0x71C9, 0x71D4, 0x71D7, 0x71CE, 0x71F5, 0x71E0, 0x71EC, 0x71FB, 0x71FC, 0x71F9, 0x71FE, 0x71FF, 0x720D, 0x7210, 0x7228, 0x722D,
+    0x722C, 0x7230, 0x7232, 0x723B, 0x723C, 0x723F, 0x7240, 0x7246, 0x724B, 0x7258, 0x7274, 0x727E, 0x7281, 0x7287, 0x7282, 0x7292,
+    0x7296, 0x72A2, 0x72A7, 0x72B1, 0x72B2, 0x72BE, 0x72C3, 0x72C6, 0x72C4, 0x72B9, 0x72CE, 0x72D2, 0x72E2, 0x72E0, 0x72E1, 0x72F9,
+    0x72F7, 0x7317, 0x730A, 0x731C, 0x7316, 0x731D, 0x7324, 0x7334, 0x7329, 0x732F, 0xFA16, 0x7325, 0x733E, 0x734F, 0x734E, 0x7357,
+    0x9ED8, 0x736A, 0x7368, 0x7370, 0x7377, 0x7378, 0x7375, 0x737B, 0x73C8, 0x73BD, 0x73B3, 0x73CE, 0x73BB, 0x73C0, 0x73C9, 0x73D6,
+    0x73E5, 0x73E3, 0x73D2, 0x73EE, 0x73F1, 0x73DE, 0x73F8, 0x7407, 0x73F5, 0x7405, 0x7426, 0x742A, 0x7425, 0x7429, 0x742E, 0x7432,
+    0x743A, 0x7455, 0x743F, 0x745F, 0x7459, 0x7441, 0x745C, 0x7469, 0x7470, 0x7463, 0x746A, 0x7464, 0x7462, 0x7489, 0x746F, 0x747E,
+    0x749F, 0x749E, 0x74A2, 0x74A7, 0x74CA, 0x74CF, 0x74D4, 0x74E0, 0x74E3, 0x74E7, 0x74E9, 0x74EE, 0x74F0, 0x74F2, 0x74F1, 0x74F7,
+    0x74F8, 0x7501, 0x7504, 0x7503, 0x7505, 0x750D, 0x750C, 0x750E, 0x7513, 0x751E, 0x7526, 0x752C, 0x753C, 0x7544, 0x754D, 0x754A,
+    0x7549, 0x7546, 0x755B, 0x755A, 0x7564, 0x7567, 0x756B, 0x756F, 0x7574, 0x756D, 0x7578, 0x7576, 0x7582, 0x7586, 0x7587, 0x758A,
+    0x7589, 0x7594, 0x759A, 0x759D, 0x75A5, 0x75A3, 0x75C2, 0x75B3, 0x75C3, 0x75B5, 0x75BD, 0x75B8, 0x75BC, 0x75B1, 0x75CD, 0xFFFF,
+  },
+  { /* lead 0x5F */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x75CA, 0x75D2, 0x75D9, 0x75E3, 0x75DE, 0x75FE, 0x75FF, 0x75FC, 0x7601, 0x75F0, 0x75FA, 0x75F2, 0x75F3, 0x760B, 0x7609,
+    0x761F, 0x7627, 0x7620, 0x7621, 0x7622, 0x7624, 0x7634, 0x7630, 0x763B, 0x7647, 0x7648, 0x7658, 0x7646, 0x765C, 0x7661, 0x7662,
+    0x7668, 0x7669, 0x7667, 0x766A, 0x766C, 0x7670, 0x7672, 0x7676, 0x767C, 0x7682, 0x7680, 0x7683, 0x7688, 0x768B, 0x7699, 0x769A,
+    0x769C, 0x769E, 0x769B, 0x76A6, 0x76B0, 0x76B4, 0x76B8, 0x76B9, 0x76BA, 0x76C2, 0xFA17, 0x76CD, 0x76D6, 0x76D2, 0x76DE, 0x76E1,
+    0x76E5, 0x76EA, 0x862F, 0x76FB, 0x7708, 0x7707, 0x7704, 0x7724, 0x7729, 0x7725, 0x7726, 0x771B, 0x7737, 0x7738, 0x7746, 0x7747,
+    0x775A, 0x7768, 0x776B, 0x775B, 0x7765, 0x777F, 0x777E, 0x7779, 0x778E, 0x778B, 0x7791, 0x77A0, 0x779E, 0x77B0, 0x77B6, 0x77B9,
+    0x77BF, 0x77BC, 0x77BD, 0x77BB, 0x77C7, 0x77CD, 0x77DA, 0x77DC, 0x77E3, 0x77EE, 0x52AF, 0x77FC, 0x780C, 0x7812, 0x7821, 0x783F,
+    0x7820, 0x7845, 0x784E, 0x7864, 0x7874, 0x788E, 0x787A, 0x7886, 0x789A, 0x787C, 0x788C, 0x78A3, 0x78B5, 0x78AA, 0x78AF, 0x78D1,
+    0x78C6, 0x78CB, 0x78D4, 0x78BE, 0x78BC, 0x78C5, 0x78CA, 0x78EC, 0x78E7, 0x78DA, 0x78FD, 0x78F4, 0x7907, 0x7911, 0x7919, 0x792C,
+    0x792B, 0x7930, 0xFA18, 0x7940, 0x7960, 0xFA19, 0x795F, 0x795A, 0x7955, 0xFA1A, 0x797F, 0x798A, 0x7994, 0xFA1B, 0x799D, 0x799B,
+    0x79AA, 0x79B3, 0x79BA, 0x79C9, 0x79D5, 0x79E7, 0x79EC, 0x79E3, 0x7A08, 0x7A0D, 0x7A18, 0x7A19, 0x7A1F, 0x7A31, 0x7A3E, 0x7A37,
+    0x7A3B, 0x7A43, 0x7A57, 0x7A49, 0x7A62, 0x7A61, 0x7A69, 0x9F9D, 0x7A70, 0x7A79, 0x7A7D, 0x7A88, 0x7A95, 0x7A98, 0x7A96, 0xFFFF,
+  },
+  { /* lead 0x60 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x7A97, 0x7AA9, 0x7AB0, 0x7AB6, 0x9083, 0x7AC3, 0x7ABF, 0x7AC5, 0x7AC4, 0x7AC7, 0x7ACA, 0x7ACD, 0x7ACF, 0x7AD2, 0x7AD1,
+    0x7AD5, 0x7AD3, 0x7AD9, 0x7ADA, 0x7ADD, 0x7AE1, 0x7AE2, 0x7AE6, 0x7AE7, 0xFA1C, 0x7AEB, 0x7AED, 0x7AF0, 0x7AF8, 0x7B02, 0x7B0F,
+    0x7B0B, 0x7B0A, 0x7B06, 0x7B33, 0x7B36, 0x7B19, 0x7B1E, 0x7B35, 0x7B28, 0x7B50, 0x7B4D, 0x7B4C, 0x7B45, 0x7B5D, 0x7B75, 0x7B7A,
+    0x7B74, 0x7B70, 0x7B71, 0x7B6E, 0x7B9D, 0x7B98, 0x7B9F, 0x7B8D, 0x7B9C, 0x7B9A, 0x7B92, 0x7B8F, 0x7B99, 0x7BCF, 0x7BCB, 0x7BCC,
+    0x7BB4, 0x7BC6, 0x7B9E, 0x7BDD, 0x7BE9, 0x7BE6, 0x7BF7, 0x7BE5, 0x7C14, 0x7C00, 0x7C13, 0x7C07, 0x7BF3, 0x7C0D, 0x7BF6, 0x7C23,
+    0x7C27, 0x7C2A, 0x7C1F, 0x7C37, 0x7C2B, 0x7C3D, 0x7C40, 0x7C4C, 0x7C43, 0x7C56, 0x7C50, 0x7C58, 0x7C5F, 0x7C65, 0x7C6C, 0x7C75,
+    0x7C83, 0x7C90, 0x7CA4, 0x7CA2, 0x7CAB, 0x7CA1, 0x7CAD, 0x7CA8, 0x7CB3, 0x7CB2, 0x7CB1, 0x7CAE, 0x7CB9, 0xFA1D, 0x7CBD, 0x7CC5,
+    0x7CC2, 0x7CD2, 0x7CE2, 0x7CD8, 0x7CDC, 0x7CEF, 0x7CF2, 0x7CF4, 0x7CF6, 0x7D06, 0x7D02, 0x7D1C, 0x7D15, 0x7D0A, 0x7D45, 0x7D4B,
+    0x7D2E, 0x7D32, 0x7D3F, 0x7D35, 0x7D48, 0x7D46, 0x7D5C, 0x7D73, 0x7D56, 0x7D4E, 0x7D68, 0x7D6E, 0x7D4F, 0x7D63, 0x7D93, 0x7D89,
+    0x7D5B, 0x7DAE, 0x7DA3, 0x7DB5, 0x7DB7, 0x7DC7, 0x7DBD, 0x7DAB, 0x7DA2, 0x7DAF, 0x7DA0, 0x7DB8, 0x7D9F, 0x7DB0, 0x7DD5, 0x7DD8,
+    0x7DDD, 0x7DD6, 0x7DE4, 0x7DDE, 0x7DFB, 0x7E0B, 0x7DF2, 0x7DE1, 0x7DDC, 0x7E05, 0x7E0A, 0x7E21, 0x7E12, 0x7E1F, 0x7E09, 0x7E3A,
+    0x7E46, 0x7E66, 0x7E31, 0x7E3D, 0x7E35, 0x7E3B, 0x7E39, 0x7E43, 0x7E37, 0x7E32, 0x7E5D, 0x7E56, 0x7E5E, 0x7E52, 0x7E59, 0xFFFF,
+  },
+  { /* lead 0x61 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x7E5A, 0x7E67, 0x7E79, 0x7E6A, 0x7E69, 0x7E7C, 0x7E7B, 0x7E7D, 0x8FAE, 0x7E7F, 0x7E83, 0x7E89, 0x7E8E, 0x7E8C, 0x7E92,
+    0x7E93, 0x7E94, 0x7E96, 0x7E9B, 0x7F38, 0x7F3A, 0x7F45, 0x7F47, 0x7F4C, 0x7F4E, 0x7F51, 0x7F55, 0x7F54, 0x7F58, 0x7F5F, 0x7F60,
+    0x7F68, 0x7F67, 0x7F69, 0x7F78, 0x7F82, 0x7F86, 0x7F83, 0x7F87, 0x7F88, 0x7F8C, 0x7F94, 0x7F9E, 0x7F9D, 0x7F9A, 0x7FA1, 0x7FA3,
+    0x7FAF, 0x7FAE, 0x7FB2, 0x7FB9, 0x7FB6, 0x7FB8, 0x8B71, 0xFA1E, 0x7FC5, 0x7FC6, 0x7FCA, 0x7FD5, 0x7FE1, 0x7FE6, 0x7FE9, 0x7FF3,
+    0x7FF9, 0x8004, 0x800B, 0x8012, 0x8019, 0x801C, 0x8021, 0x8028, 0x803F, 0x803B, 0x804A, 0x8046, 0x8052, 0x8058, 0x805F, 0x8062,
+    0x8068, 0x8073, 0x8072, 0x8070, 0x8076, 0x8079, 0x807D, 0x807F, 0x8084, 0x8085, 0x8093, 0x809A, 0x80AD, 0x5190, 0x80AC, 0x80DB,
+    0x80E5, 0x80D9, 0x80DD, 0x80C4, 0x80DA, 0x8109, 0x80EF, 0x80F1, 0x811B, 0x8123, 0x812F, 0x814B, 0x8146, 0x813E, 0x8153, 0x8151,
+    0x80FC, 0x8171, 0x816E, 0x8165, 0x815F, 0x8166, 0x8174, 0x8183, 0x8188, 0x818A, 0x8180, 0x8182, 0x81A0, 0x8195, 0x81A3, 0x8193,
+    0x81B5, 0x81A4, 0x81A9, 0x81B8, 0x81B0, 0x81C8, 0x81BE, 0x81BD, 0x81C0, 0x81C2, 0x81BA, 0x81C9, 0x81CD, 0x81D1, 0x81D8, 0x81D9,
+    0x81DA, 0x81DF, 0x81E0, 0x81FA, 0x81FB, 0x81FE, 0x8201, 0x8202, 0x8205, 0x820D, 0x8210, 0x8212, 0x8216, 0x8229, 0x822B, 0x822E,
+    0x8238, 0x8233, 0x8240, 0x8259, 0x825A, 0x825D, 0x825F, 0x8264, 0x8262, 0x8268, 0x826A, 0x826B, 0x8271, 0x8277, 0x827E, 0x828D,
+    0x8292, 0x82AB, 0x829F, 0x82BB, 0x82AC, 0x82E1, 0x82E3, 0x82DF, 0x8301, 0x82D2, 0x82F4, 0x82F3, 0x8303, 0x82FB, 0x82F9, 0xFFFF,
+  },
+  { /* lead 0x62 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x82DE, 0x8306, 0x82DC, 0x82FA, 0x8309, 0x82D9, 0x8335, 0x8362, 0x8334, 0x8316, 0x8331, 0x8340, 0x8339, 0x8350, 0x8345,
+    0x832F, 0x832B, 0x8318, 0x839A, 0x83AA, 0x839F, 0x83A2, 0x8396, 0x8323, 0x838E, 0x8375, 0x837F, 0x838A, 0x837C, 0x83B5, 0x8373,
+    0x8393, 0x83A0, 0x8385, 0x8389, 0x83A8, 0x83F4, 0x8413, 0x83C7, 0x83CE, 0x83F7, 0x83FD, 0x8403, 0x83D8, 0x840B, 0x83C1, 0x8407,
+    0x83E0, 0x83F2, 0x840D, 0x8420, 0x83F6, 0x83BD, 0x83FB, 0x842A, 0x8462, 0x843C, 0x8484, 0x8477, 0x846B, 0x8479, 0x8448, 0x846E,
+    0x8482, 0x8469, 0x8446, 0x846F, 0x8438, 0x8435, 0x84CA, 0x84B9, 0x84BF, 0x849F, 0x84B4, 0x84CD, 0x84BB, 0x84DA, 0x84D0, 0x84C1,
+    0x84AD, 0x84C6, 0x84D6, 0x84A1, 0x84D9, 0x84FF, 0x84F4, 0x8517, 0x8518, 0x852C, 0x851F, 0x8515, 0x8514, 0x8506, 0x8553, 0x855A,
+    0x8540, 0x8559, 0x8563, 0x8558, 0x8548, 0x8541, 0x854A, 0x854B, 0x856B, 0x8555, 0x8580, 0x85A4, 0x8588, 0x8591, 0x858A, 0x85A8,
+    0x856D, 0x8594, 0x859B, 0x85AE, 0x8587, 0x859C, 0x8577, 0x857E, 0x8590, 0xFA1F, 0x820A, 0x85B0, 0x85C9, 0x85BA, 0x85CF, 0x85B9,
+    0x85D0, 0x85D5, 0x85DD, 0x85E5, 0x85DC, 0x85F9, 0x860A, 0x8613, 0x860B, 0x85FE, 0x8622, 0x861A, 0x8630, 0x863F, 0xFA20, 0x864D,
+    0x4E55, 0x8655, 0x865F, 0x8667, 0x8671, 0x8693, 0x86A3, 0x86A9, 0x868B, 0x86AA, 0x868C, 0x86B6, 0x86AF, 0x86C4, 0x86C6, 0x86B0,
+    0x86C9, 0x86CE, 0xFA21, 0x86AB, 0x86D4, 0x86DE, 0x86E9, 0x86EC, 0x86DF, 0x86DB, 0x8712, 0x8706, 0x8708, 0x8700, 0x8703, 0x86FB,
+    0x8711, 0x8709, 0x870D, 0x86F9, 0x870A, 0x8734, 0x873F, 0x873B, 0x8725, 0x8729, 0x871A, 0x875F, 0x8778, 0x874C, 0x874E, 0xFFFF,
+  },
+  { /* lead 0x63 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8774, 0x8757, 0x8768, 0x8782, 0x876A, 0x8760, 0x876E, 0x8759, 0x8753, 0x8763, 0x877F, 0x87A2, 0x87C6, 0x879F, 0x87AF,
+    0x87CB, 0x87BD, 0x87C0, 0x87D0, 0x96D6, 0x87AB, 0x87C4, 0x87B3, 0x87D2, 0x87BB, 0x87EF, 0x87F2, 0x87E0, 0x880E, 0x8807, 0x880F,
+    0x8816, 0x880D, 0x87FE, 0x87F6, 0x87F7, 0x8811, 0x8815, 0x8822, 0x8821, 0x8827, 0x8831, 0x8836, 0x8839, 0x883B, 0x8842, 0x8844,
+    0x884D, 0x8852, 0x8859, 0x885E, 0x8862, 0x886B, 0x8881, 0x887E, 0x8875, 0x887D, 0x8872, 0x8882, 0x889E, 0x8897, 0x8892, 0x88AE,
+    0x8899, 0x88A2, 0x888D, 0x88A4, 0x88BF, 0x88B5, 0x88B1, 0x88C3, 0x88C4, 0x88D4, 0x88D8, 0x88D9, 0x88DD, 0x88F9, 0x8902, 0x88FC,
+    0x88F5, 0x88E8, 0x88F2, 0x8904, 0x890C, 0x892A, 0x891D, 0x890A, 0x8913, 0x891E, 0x8925, 0x892B, 0x8941, 0x893B, 0x8936, 0x8943,
+    0x8938, 0x894D, 0x894C, 0x8960, 0x895E, 0x8966, 0x896A, 0x8964, 0x896D, 0x896F, 0x8974, 0x8977, 0x897E, 0x8983, 0x8988, 0x898A,
+    0x8993, 0x8998, 0x89A1, 0x89A9, 0x89A6, 0x89AC, 0x89AF, 0x89B2, 0x89BA, 0x89BF, 0x89BD, 0x89C0, 0x89DA, 0x89DD, 0x89E7, 0x89F4,
+    0x89F8, 0x8A03, 0x8A16, 0x8A10, 0x8A0C, 0x8A12, 0x8A1B, 0x8A1D, 0x8A25, 0x8A36, 0x8A41, 0x8A37, 0x8A5B, 0x8A52, 0x8A46, 0x8A48,
+    0x8A7C, 0x8A6D, 0x8A6C, 0x8A62, 0x8A79, 0x8A85, 0x8A82, 0x8A84, 0x8AA8, 0x8AA1, 0x8A91, 0x8AA5, 0x8AA6, 0x8A9A, 0x8AA3, 0x8AA7,
+    0x8ACC, 0x8ABE, 0x8ACD, 0x8AC2, 0x8ADA, 0x8AF3, 0x8AE7, 0x8AE4, 0x8AF1, 0x8B14, 0x8AE0, 0x8AE2, 0x8AE1, 0x8ADF, 0xFA22, 0x8AF6,
+    0x8AF7, 0x8ADE, 0x8ADB, 0x8B0C, 0x8B07, 0x8B1A, 0x8B16, 0x8B10, 0x8B17, 0x8B20, 0x8B33, 0x8B41, 0x97AB, 0x8B26, 0x8B2B, 0xFFFF,
+  },
+  { /* lead 0x64 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8B3E, 0x8B4C, 0x8B4F, 0x8B4E, 0x8B53, 0x8B49, 0x8B56, 0x8B5B, 0x8B5A, 0x8B74, 0x8B6B, 0x8B5F, 0x8B6C, 0x8B6F, 0x8B7D,
+    0x8B7F, 0x8B80, 0x8B8C, 0x8B8E, 0x8B99, 0x8B92, 0x8B93, 0x8B96, 0x8B9A, 0x8C3A, 0x8C41, 0x8C3F, 0x8C48, 0x8C4C, 0x8C4E, 0x8C50,
+    0x8C55, 0x8C62, 0x8C6C, 0x8C78, 0x8C7A, 0x8C7C, 0x8C82, 0x8C89, 0x8C85, 0x8C8A, 0x8C8D, 0x8C8E, 0x8C98, 0x8C94, 0x621D, 0x8CAD,
+    0x8CAA, 0x8CAE, 0x8CBD, 0x8CB2, 0x8CB3, 0x8CC1, 0x8CB6, 0x8CC8, 0x8CCE, 0x8CCD, 0x8CE3, 0x8CDA, 0x8CF0, 0x8CF4, 0x8CFD, 0x8CFA,
+    0x8CFB, 0x8D07, 0x8D0A, 0x8D0F, 0x8D0D, 0x8D12, 0x8D10, 0x8D13, 0x8D14, 0x8D16, 0x8D67, 0x8D6D, 0x8D71, 0x8D76, 0xFA23, 0x8D81,
+    0x8DC2, 0x8DBE, 0x8DBA, 0x8DCF, 0x8DDA, 0x8DD6, 0x8DCC, 0x8DDB, 0x8DCB, 0x8DEA, 0x8DEB, 0x8DDF, 0x8DE3, 0x8DFC, 0x8E08, 0x8DFF,
+    0x8E09, 0x8E1D, 0x8E1E, 0x8E10, 0x8E1F, 0x8E42, 0x8E35, 0x8E30, 0x8E34, 0x8E4A, 0x8E47, 0x8E49, 0x8E4C, 0x8E50, 0x8E48, 0x8E59,
+    0x8E64, 0x8E60, 0x8E55, 0x8E63, 0x8E76, 0x8E72, 0x8E87, 0x8E7C, 0x8E81, 0x8E85, 0x8E84, 0x8E8B, 0x8E8A, 0x8E93, 0x8E91, 0x8E94,
+    0x8E99, 0x8EA1, 0x8EAA, 0x8EB1, 0x8EBE, 0x8EC6, 0x8EC5, 0x8EC8, 0x8ECB, 0x8ECF, 0x8EDB, 0x8EE3, 0x8EFC, 0x8EFB, 0x8EEB, 0x8EFE,
+    0x8F0A, 0x8F0C, 0x8F05, 0x8F15, 0x8F12, 0x8F13, 0x8F1C, 0x8F19, 0x8F1F, 0x8F26, 0x8F33, 0x8F3B, 0x8F39, 0x8F45, 0x8F42, 0x8F3E,
+    0x8F49, 0x8F46, 0x8F4C, 0x8F4E, 0x8F57, 0x8F5C, 0x8F62, 0x8F63, 0x8F64, 0x8F9C, 0x8F9F, 0x8FA3, 0x8FA8, 0x8FA7, 0x8FAD, 0x8FAF,
+    0x8FB7, 0xFA24, 0x8FDA, 0x8FE5, 0x8FE2, 0x8FEF, 0x8FE9, 0x8FF4, 0x9005, 0x8FF9, 0x8FF8, 0x9011, 0x9015, 0x900E, 0x9021, 0xFFFF,
+  },
+  { /* lead 0x65 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x900D, 0x901E, 0x9016, 0x900B, 0x9027, 0x9036, 0x9039, 0x904F, 0xFA25, 0x9050, 0x9051, 0x9052, 0x9049, 0x903E, 0x9056,
+    0x9058, 0x905E, 0x9068, 0x9067, 0x906F, 0x9076, 0x96A8, 0x9072, 0x9082, 0x907D, 0x9089, 0x9080, 0x908F, 0x6248, 0x90AF, 0x90B1,
+    0x90B5, 0x90E2, 0x90E4, 0x90DB, 0x90DE, 0x9102, 0xFA26, 0x9115, 0x9112, 0x9119, 0x9132, 0x9127, 0x9130, 0x914A, 0x9156, 0x9158,
+    0x9163, 0x9165, 0x9169, 0x9173, 0x9172, 0x918B, 0x9189, 0x9182, 0x91A2, 0x91AB, 0x91AF, 0x91AA, 0x91B5, 0x91B4, 0x91BA, 0x91C0,
+    0x91C1, 0x91CB, 0x91D0, 0x91DA, 0x91DB, 0x91D7, 0x91DE, 0x91D6, 0x91DF, 0x91E1, 0x91ED, 0x91F5, 0x91EE, 0x91E4, 0x91F6, 0x91E5,
+    0x9206, 0x921E, 0x91FF, 0x9210, 0x9214, 0x920A, 0x922C, 0x9215, 0x9229, 0x9257, 0x9245, 0x923A, 0x9249, 0x9264, 0x9240, 0x923C,
+    0x9248, 0x924E, 0x9250, 0x9259, 0x923F, 0x9251, 0x9239, 0x924B, 0x9267, 0x925A, 0x929C, 0x92A7, 0x9277, 0x9278, 0x9296, 0x9293,
+    0x929B, 0x9295, 0x92E9, 0x92CF, 0x92E7, 0x92D7, 0x92D9, 0x92D0, 0xFA27, 0x92D5, 0x92B9, 0x92B7, 0x92E0, 0x92D3, 0x933A, 0x9335,
+    0x930F, 0x9325, 0x92FA, 0x9321, 0x9344, 0x92FB, 0xFA28, 0x9319, 0x931E, 0x92FF, 0x9322, 0x931A, 0x931D, 0x9323, 0x9302, 0x933B,
+    0x9370, 0x9360, 0x937C, 0x936E, 0x9356, 0x9357, 0x93B9, 0x93B0, 0x93A4, 0x93AD, 0x9394, 0x93C8, 0x93D6, 0x93C6, 0x93D7, 0x93E8,
+    0x93E5, 0x93D8, 0x93C3, 0x93DD, 0x93DE, 0x93D0, 0x93E4, 0x941A, 0x93F8, 0x9414, 0x9413, 0x9421, 0x9403, 0x9407, 0x9436, 0x942B,
+    0x9431, 0x943A, 0x9441, 0x9452, 0x9445, 0x9444, 0x9448, 0x945B, 0x945A, 0x9460, 0x9462, 0x945E, 0x946A, 0x9475, 0x9470, 0xFFFF,
+  },
+  { /* lead 0x66 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9477, 0x947F, 0x947D, 0x947C, 0x947E, 0x9481, 0x9582, 0x9587, 0x958A, 0x9592, 0x9594, 0x9596, 0x9598, 0x9599, 0x95A0,
+    0x95A8, 0x95A7, 0x95AD, 0x95BC, 0x95BB, 0x95B9, 0x95BE, 0x95CA, 0x6FF6, 0x95C3, 0x95CD, 0x95CC, 0x95D5, 0x95D4, 0x95D6, 0x95DC,
+    0x95E1, 0x95E5, 0x95E2, 0x9621, 0x9628, 0x962E, 0x962F, 0x9642, 0x964F, 0x964C, 0x964B, 0x965C, 0x965D, 0x965F, 0x9666, 0x9677,
+    0x9672, 0x966C, 0x968D, 0x968B, 0xF9DC, 0x9698, 0x9695, 0x9697, 0xFA29, 0x969D, 0x96A7, 0x96AA, 0x96B1, 0x96B2, 0x96B0, 0x96AF,
+    0x96B4, 0x96B6, 0x96B8, 0x96B9, 0x96CE, 0x96CB, 0x96D5, 0x96DC, 0x96D9, 0x96F9, 0x9704, 0x9706, 0x9708, 0x9719, 0x970D, 0x9713,
+    0x970E, 0x9711, 0x970F, 0x9716, 0x9724, 0x972A, 0x9730, 0x9733, 0x9739, 0x973B, 0x973D, 0x973E, 0x9746, 0x9744, 0x9743, 0x9748,
+    0x9742, 0x9749, 0x974D, 0x974F, 0x9751, 0x9755, 0x975C, 0x9760, 0x9764, 0x9766, 0x9768, 0x976D, 0x9779, 0x9785, 0x977C, 0x9781,
+    0x977A, 0x978B, 0x978F, 0x9790, 0x979C, 0x97A8, 0x97A6, 0x97A3, 0x97B3, 0x97B4, 0x97C3, 0x97C6, 0x97C8, 0x97CB, 0x97DC, 0x97ED,
+    0x97F2, 0x7ADF, 0x97F5, 0x980F, 0x981A, 0x9824, 0x9821, 0x9837, 0x983D, 0x984F, 0x984B, 0x9857, 0x9865, 0x986B, 0x986F, 0x9870,
+    0x9871, 0x9874, 0x9873, 0x98AA, 0x98AF, 0x98B1, 0x98B6, 0x98C4, 0x98C3, 0x98C6, 0x98DC, 0x98ED, 0x98E9, 0xFA2A, 0x98EB, 0xFA2B,
+    0x9903, 0x991D, 0x9912, 0x9914, 0x9918, 0x9927, 0xFA2C, 0x9921, 0x991E, 0x9924, 0x9920, 0x992C, 0x992E, 0x993D, 0x993E, 0x9942,
+    0x9949, 0x9945, 0x9950, 0x994B, 0x9951, 0x994C, 0x9955, 0x9997, 0x9998, 0x999E, 0x99A5, 0x99AD, 0x99AE, 0x99BC, 0x99DF, 0xFFFF,
+  },
+  { /* lead 0x67 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x99DB, 0x99DD, 0x99D8, 0x99D1, 0x99ED, 0x99EE, 0x99E2, 0x99F1, 0x99F2, 0x99FB, 0x99F8, 0x9A01, 0x9A0F, 0x9A05, 0x9A19,
+    0x9A2B, 0x9A37, 0x9A40, 0x9A45, 0x9A42, 0x9A43, 0x9A3E, 0x9A55, 0x9A4D, 0x9A4E, 0x9A5B, 0x9A57, 0x9A5F, 0x9A62, 0x9A69, 0x9A65,
+    0x9A64, 0x9A6A, 0x9A6B, 0x9AAD, 0x9AB0, 0x9ABC, 0x9AC0, 0x9ACF, 0x9AD3, 0x9AD4, 0x9AD1, 0x9AD9, 0x9ADC, 0x9ADE, 0x9ADF, 0x9AE2,
+    0x9AE3, 0x9AE6, 0x9AEF, 0x9AEB, 0x9AEE, 0x9AF4, 0x9AF1, 0x9AF7, 0x9AFB, 0x9B06, 0x9B18, 0x9B1A, 0x9B1F, 0x9B22, 0x9B23, 0x9B25,
+    0x9B27, 0x9B28, 0x9B29, 0x9B2A, 0x9B2E, 0x9B2F, 0x9B31, 0x9B32, 0x9B3B, 0x9B44, 0x9B43, 0x9B4D, 0x9B4E, 0x9B51, 0x9B58, 0x9B75,
+    0x9B74, 0x9B72, 0x9B93, 0x9B8F, 0x9B83, 0x9B91, 0x9B96, 0x9B97, 0x9B9F, 0x9BA0, 0x9BA8, 0x9BB1, 0x9BB4, 0x9BC0, 0x9BCA, 0x9BBB,
+    0x9BB9, 0x9BC6, 0x9BCF, 0x9BD1, 0x9BD2, 0x9BE3, 0x9BE2, 0x9BE4, 0x9BD4, 0x9BE1, 0x9BF5, 0x9BF1, 0x9BF2, 0x9C04, 0x9C1B, 0x9C15,
+    0x9C14, 0x9C00, 0x9C09, 0x9C13, 0x9C0C, 0x9C06, 0x9C08, 0x9C12, 0x9C0A, 0x9C2E, 0x9C25, 0x9C24, 0x9C21, 0x9C30, 0x9C47, 0x9C32,
+    0x9C46, 0x9C3E, 0x9C5A, 0x9C60, 0x9C67, 0x9C76, 0x9C78, 0x9CEB, 0x9CE7, 0x9CEC, 0x9CF0, 0x9D09, 0x9D03, 0x9D06, 0x9D2A, 0x9D26,
+    0x9D2C, 0x9D23, 0x9D1F, 0x9D15, 0x9D12, 0x9D41, 0x9D3F, 0x9D44, 0x9D3E, 0x9D46, 0x9D48, 0x9D5D, 0x9D5E, 0x9D59, 0x9D51, 0x9D50,
+    0x9D64, 0x9D72, 0x9D70, 0x9D87, 0x9D6B, 0x9D6F, 0x9D7A, 0x9D9A, 0x9DA4, 0x9DA9, 0x9DAB, 0x9DB2, 0x9DC4, 0x9DC1, 0x9DBB, 0x9DB8,
+    0x9DBA, 0x9DC6, 0x9DCF, 0x9DC2, 0xFA2D, 0x9DD9, 0x9DD3, 0x9DF8, 0x9DE6, 0x9DED, 0x9DEF, 0x9DFD, 0x9E1A, 0x9E1B, 0x9E19, 0xFFFF,
+  },
+  { /* lead 0x68 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9E1E, 0x9E75, 0x9E79, 0x9E7D, 0x9E81, 0x9E88, 0x9E8B, 0x9E8C, 0x9E95, 0x9E91, 0x9E9D, 0x9EA5, 0x9EB8, 0x9EAA, 0x9EAD,
+    0x9EBC, 0x9EBE, 0x9761, 0x9ECC, 0x9ECF, 0x9ED0, 0x9ED1, 0x9ED4, 0x9EDC, 0x9EDE, 0x9EDD, 0x9EE0, 0x9EE5, 0x9EE8, 0x9EEF, 0x9EF4,
+    0x9EF6, 0x9EF7, 0x9EF9, 0x9EFB, 0x9EFC, 0x9EFD, 0x9F07, 0x9F08, 0x76B7, 0x9F15, 0x9F21, 0x9F2C, 0x9F3E, 0x9F4A, 0x9F4E, 0x9F4F,
+    0x9F52, 0x9F54, 0x9F63, 0x9F5F, 0x9F60, 0x9F61, 0x9F66, 0x9F67, 0x9F6C, 0x9F6A, 0x9F77, 0x9F72, 0x9F76, 0x9F95, 0x9F9C, 0x9FA0,
+    0x5C2D, 0x69D9, 0x9065, 0x7476, 0x51DC, 0x7155, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x69 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE000, 0xE001, 0xE002, 0xE003, 0xE004, 0xE005, 0xE006, 0xE007, 0xE008, 0xE009, 0xE00A, 0xE00B, 0xE00C, 0xE00D, 0xE00E,
+    0xE00F, 0xE010, 0xE011, 0xE012, 0xE013, 0xE014, 0xE015, 0xE016, 0xE017, 0xE018, 0xE019, 0xE01A, 0xE01B, 0xE01C, 0xE01D, 0xE01E,
+    0xE01F, 0xE020, 0xE021, 0xE022, 0xE023, 0xE024, 0xE025, 0xE026, 0xE027, 0xE028, 0xE029, 0xE02A, 0xE02B, 0xE02C, 0xE02D, 0xE02E,
+    0xE02F, 0xE030, 0xE031, 0xE032, 0xE033, 0xE034, 0xE035, 0xE036, 0xE037, 0xE038, 0xE039, 0xE03A, 0xE03B, 0xE03C, 0xE03D, 0xE03E,
+    0xE03F, 0xE040, 0xE041, 0xE042, 0xE043, 0xE044, 0xE045, 0xE046, 0xE047, 0xE048, 0xE049, 0xE04A, 0xE04B, 0xE04C, 0xE04D, 0xE04E,
+    0xE04F, 0xE050, 0xE051, 0xE052, 0xE053, 0xE054, 0xE055, 0xE056, 0xE057, 0xE058, 0xE059, 0xE05A, 0xE05B, 0xE05C, 0xE05D, 0xE05E,
+    0xE05F, 0xE060, 0xE061, 0xE062, 0xE063, 0xE064, 0xE065, 0xE066, 0xE067, 0xE068, 0xE069, 0xE06A, 0xE06B, 0xE06C, 0xE06D, 0xE06E,
+    0xE06F, 0xE070, 0xE071, 0xE072, 0xE073, 0xE074, 0xE075, 0xE076, 0xE077, 0xE078, 0xE079, 0xE07A, 0xE07B, 0xE07C, 0xE07D, 0xE07E,
+    0xE07F, 0xE080, 0xE081, 0xE082, 0xE083, 0xE084, 0xE085, 0xE086, 0xE087, 0xE088, 0xE089, 0xE08A, 0xE08B, 0xE08C, 0xE08D, 0xE08E,
+    0xE08F, 0xE090, 0xE091, 0xE092, 0xE093, 0xE094, 0xE095, 0xE096, 0xE097, 0xE098, 0xE099, 0xE09A, 0xE09B, 0xE09C, 0xE09D, 0xE09E,
+    0xE09F, 0xE0A0, 0xE0A1, 0xE0A2, 0xE0A3, 0xE0A4, 0xE0A5, 0xE0A6, 0xE0A7, 0xE0A8, 0xE0A9, 0xE0AA, 0xE0AB, 0xE0AC, 0xE0AD, 0xE0AE,
+    0xE0AF, 0xE0B0, 0xE0B1, 0xE0B2, 0xE0B3, 0xE0B4, 0xE0B5, 0xE0B6, 0xE0B7, 0xE0B8, 0xE0B9, 0xE0BA, 0xE0BB, 0xE0BC, 0xE0BD, 0xFFFF,
+  },
+  { /* lead 0x6A */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE0BE, 0xE0BF, 0xE0C0, 0xE0C1, 0xE0C2, 0xE0C3, 0xE0C4, 0xE0C5, 0xE0C6, 0xE0C7, 0xE0C8, 0xE0C9, 0xE0CA, 0xE0CB, 0xE0CC,
+    0xE0CD, 0xE0CE, 0xE0CF, 0xE0D0, 0xE0D1, 0xE0D2, 0xE0D3, 0xE0D4, 0xE0D5, 0xE0D6, 0xE0D7, 0xE0D8, 0xE0D9, 0xE0DA, 0xE0DB, 0xE0DC,
+    0xE0DD, 0xE0DE, 0xE0DF, 0xE0E0, 0xE0E1, 0xE0E2, 0xE0E3, 0xE0E4, 0xE0E5, 0xE0E6, 0xE0E7, 0xE0E8, 0xE0E9, 0xE0EA, 0xE0EB, 0xE0EC,
+    0xE0ED, 0xE0EE, 0xE0EF, 0xE0F0, 0xE0F1, 0xE0F2, 0xE0F3, 0xE0F4, 0xE0F5, 0xE0F6, 0xE0F7, 0xE0F8, 0xE0F9, 0xE0FA, 0xE0FB, 0xE0FC,
+    0xE0FD, 0xE0FE, 0xE0FF, 0xE100, 0xE101, 0xE102, 0xE103, 0xE104, 0xE105, 0xE106, 0xE107, 0xE108, 0xE109, 0xE10A, 0xE10B, 0xE10C,
+    0xE10D, 0xE10E, 0xE10F, 0xE110, 0xE111, 0xE112, 0xE113, 0xE114, 0xE115, 0xE116, 0xE117, 0xE118, 0xE119, 0xE11A, 0xE11B, 0xE11C,
+    0xE11D, 0xE11E, 0xE11F, 0xE120, 0xE121, 0xE122, 0xE123, 0xE124, 0xE125, 0xE126, 0xE127, 0xE128, 0xE129, 0xE12A, 0xE12B, 0xE12C,
+    0xE12D, 0xE12E, 0xE12F, 0xE130, 0xE131, 0xE132, 0xE133, 0xE134, 0xE135, 0xE136, 0xE137, 0xE138, 0xE139, 0xE13A, 0xE13B, 0xE13C,
+    0xE13D, 0xE13E, 0xE13F, 0xE140, 0xE141, 0xE142, 0xE143, 0xE144, 0xE145, 0xE146, 0xE147, 0xE148, 0xE149, 0xE14A, 0xE14B, 0xE14C,
+    0xE14D, 0xE14E, 0xE14F, 0xE150, 0xE151, 0xE152, 0xE153, 0xE154, 0xE155, 0xE156, 0xE157, 0xE158, 0xE159, 0xE15A, 0xE15B, 0xE15C,
+    0xE15D, 0xE15E, 0xE15F, 0xE160, 0xE161, 0xE162, 0xE163, 0xE164, 0xE165, 0xE166, 0xE167, 0xE168, 0xE169, 0xE16A, 0xE16B, 0xE16C,
+    0xE16D, 0xE16E, 0xE16F, 0xE170, 0xE171, 0xE172, 0xE173, 0xE174, 0xE175, 0xE176, 0xE177, 0xE178, 0xE179, 0xE17A, 0xE17B, 0xFFFF,
+  },
+  { /* lead 0x6B */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE17C, 0xE17D, 0xE17E, 0xE17F, 0xE180, 0xE181, 0xE182, 0xE183, 0xE184, 0xE185, 0xE186, 0xE187, 0xE188, 0xE189, 0xE18A,
+    0xE18B, 0xE18C, 0xE18D, 0xE18E, 0xE18F, 0xE190, 0xE191, 0xE192, 0xE193, 0xE194, 0xE195, 0xE196, 0xE197, 0xE198, 0xE199, 0xE19A,
+    0xE19B, 0xE19C, 0xE19D, 0xE19E, 0xE19F, 0xE1A0, 0xE1A1, 0xE1A2, 0xE1A3, 0xE1A4, 0xE1A5, 0xE1A6, 0xE1A7, 0xE1A8, 0xE1A9, 0xE1AA,
+    0xE1AB, 0xE1AC, 0xE1AD, 0xE1AE, 0xE1AF, 0xE1B0, 0xE1B1, 0xE1B2, 0xE1B3, 0xE1B4, 0xE1B5, 0xE1B6, 0xE1B7, 0xE1B8, 0xE1B9, 0xE1BA,
+    0xE1BB, 0xE1BC, 0xE1BD, 0xE1BE, 0xE1BF, 0xE1C0, 0xE1C1, 0xE1C2, 0xE1C3, 0xE1C4, 0xE1C5, 0xE1C6, 0xE1C7, 0xE1C8, 0xE1C9, 0xE1CA,
+    0xE1CB, 0xE1CC, 0xE1CD, 0xE1CE, 0xE1CF, 0xE1D0, 0xE1D1, 0xE1D2, 0xE1D3, 0xE1D4, 0xE1D5, 0xE1D6, 0xE1D7, 0xE1D8, 0xE1D9, 0xE1DA,
+    0xE1DB, 0xE1DC, 0xE1DD, 0xE1DE, 0xE1DF, 0xE1E0, 0xE1E1, 0xE1E2, 0xE1E3, 0xE1E4, 0xE1E5, 0xE1E6, 0xE1E7, 0xE1E8, 0xE1E9, 0xE1EA,
+    0xE1EB, 0xE1EC, 0xE1ED, 0xE1EE, 0xE1EF, 0xE1F0, 0xE1F1, 0xE1F2, 0xE1F3, 0xE1F4, 0xE1F5, 0xE1F6, 0xE1F7, 0xE1F8, 0xE1F9, 0xE1FA,
+    0xE1FB, 0xE1FC, 0xE1FD, 0xE1FE, 0xE1FF, 0xE200, 0xE201, 0xE202, 0xE203, 0xE204, 0xE205, 0xE206, 0xE207, 0xE208, 0xE209, 0xE20A,
+    0xE20B, 0xE20C, 0xE20D, 0xE20E, 0xE20F, 0xE210, 0xE211, 0xE212, 0xE213, 0xE214, 0xE215, 0xE216, 0xE217, 0xE218, 0xE219, 0xE21A,
+    0xE21B, 0xE21C, 0xE21D, 0xE21E, 0xE21F, 0xE220, 0xE221, 0xE222, 0xE223, 0xE224, 0xE225, 0xE226, 0xE227, 0xE228, 0xE229, 0xE22A,
+    0xE22B, 0xE22C, 0xE22D, 0xE22E, 0xE22F, 0xE230, 0xE231, 0xE232, 0xE233, 0xE234, 0xE235, 0xE236, 0xE237, 0xE238, 0xE239, 0xFFFF,
+  },
+  { /* lead 0x6C */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE23A, 0xE23B, 0xE23C, 0xE23D, 0xE23E, 0xE23F, 0xE240, 0xE241, 0xE242, 0xE243, 0xE244, 0xE245, 0xE246, 0xE247, 0xE248,
+    0xE249, 0xE24A, 0xE24B, 0xE24C, 0xE24D, 0xE24E, 0xE24F, 0xE250, 0xE251, 0xE252, 0xE253, 0xE254, 0xE255, 0xE256, 0xE257, 0xE258,
+    0xE259, 0xE25A, 0xE25B, 0xE25C, 0xE25D, 0xE25E, 0xE25F, 0xE260, 0xE261, 0xE262, 0xE263, 0xE264, 0xE265, 0xE266, 0xE267, 0xE268,
+    0xE269, 0xE26A, 0xE26B, 0xE26C, 0xE26D, 0xE26E, 0xE26F, 0xE270, 0xE271, 0xE272, 0xE273, 0xE274, 0xE275, 0xE276, 0xE277, 0xE278,
+    0xE279, 0xE27A, 0xE27B, 0xE27C, 0xE27D, 0xE27E, 0xE27F, 0xE280, 0xE281, 0xE282, 0xE283, 0xE284, 0xE285, 0xE286, 0xE287, 0xE288,
+    0xE289, 0xE28A, 0xE28B, 0xE28C, 0xE28D, 0xE28E, 0xE28F, 0xE290, 0xE291, 0xE292, 0xE293, 0xE294, 0xE295, 0xE296, 0xE297, 0xE298,
+    0xE299, 0xE29A, 0xE29B, 0xE29C, 0xE29D, 0xE29E, 0xE29F, 0xE2A0, 0xE2A1, 0xE2A2, 0xE2A3, 0xE2A4, 0xE2A5, 0xE2A6, 0xE2A7, 0xE2A8,
+    0xE2A9, 0xE2AA, 0xE2AB, 0xE2AC, 0xE2AD, 0xE2AE, 0xE2AF, 0xE2B0, 0xE2B1, 0xE2B2, 0xE2B3, 0xE2B4, 0xE2B5, 0xE2B6, 0xE2B7, 0xE2B8,
+    0xE2B9, 0xE2BA, 0xE2BB, 0xE2BC, 0xE2BD, 0xE2BE, 0xE2BF, 0xE2C0, 0xE2C1, 0xE2C2, 0xE2C3, 0xE2C4, 0xE2C5, 0xE2C6, 0xE2C7, 0xE2C8,
+    0xE2C9, 0xE2CA, 0xE2CB, 0xE2CC, 0xE2CD, 0xE2CE, 0xE2CF, 0xE2D0, 0xE2D1, 0xE2D2, 0xE2D3, 0xE2D4, 0xE2D5, 0xE2D6, 0xE2D7, 0xE2D8,
+    0xE2D9, 0xE2DA, 0xE2DB, 0xE2DC, 0xE2DD, 0xE2DE, 0xE2DF, 0xE2E0, 0xE2E1, 0xE2E2, 0xE2E3, 0xE2E4, 0xE2E5, 0xE2E6, 0xE2E7, 0xE2E8,
+    0xE2E9, 0xE2EA, 0xE2EB, 0xE2EC, 0xE2ED, 0xE2EE, 0xE2EF, 0xE2F0, 0xE2F1, 0xE2F2, 0xE2F3, 0xE2F4, 0xE2F5, 0xE2F6, 0xE2F7, 0xFFFF,
+  },
+  { /* lead 0x6D */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE2F8, 0xE2F9, 0xE2FA, 0xE2FB, 0xE2FC, 0xE2FD, 0xE2FE, 0xE2FF, 0xE300, 0xE301, 0xE302, 0xE303, 0xE304, 0xE305, 0xE306,
+    0xE307, 0xE308, 0xE309, 0xE30A, 0xE30B, 0xE30C, 0xE30D, 0xE30E, 0xE30F, 0xE310, 0xE311, 0xE312, 0xE313, 0xE314, 0xE315, 0xE316,
+    0xE317, 0xE318, 0xE319, 0xE31A, 0xE31B, 0xE31C, 0xE31D, 0xE31E, 0xE31F, 0xE320, 0xE321, 0xE322, 0xE323, 0xE324, 0xE325, 0xE326,
+    0xE327, 0xE328, 0xE329, 0xE32A, 0xE32B, 0xE32C, 0xE32D, 0xE32E, 0xE32F, 0xE330, 0xE331, 0xE332, 0xE333, 0xE334, 0xE335, 0xE336,
+    0xE337, 0xE338, 0xE339, 0xE33A, 0xE33B, 0xE33C, 0xE33D, 0xE33E, 0xE33F, 0xE340, 0xE341, 0xE342, 0xE343, 0xE344, 0xE345, 0xE346,
+    0xE347, 0xE348, 0xE349, 0xE34A, 0xE34B, 0xE34C, 0xE34D, 0xE34E, 0xE34F, 0xE350, 0xE351, 0xE352, 0xE353, 0xE354, 0xE355, 0xE356,
+    0xE357, 0xE358, 0xE359, 0xE35A, 0xE35B, 0xE35C, 0xE35D, 0xE35E, 0xE35F, 0xE360, 0xE361, 0xE362, 0xE363, 0xE364, 0xE365, 0xE366,
+    0xE367, 0xE368, 0xE369, 0xE36A, 0xE36B, 0xE36C, 0xE36D, 0xE36E, 0xE36F, 0xE370, 0xE371, 0xE372, 0xE373, 0xE374, 0xE375, 0xE376,
+    0xE377, 0xE378, 0xE379, 0xE37A, 0xE37B, 0xE37C, 0xE37D, 0xE37E, 0xE37F, 0xE380, 0xE381, 0xE382, 0xE383, 0xE384, 0xE385, 0xE386,
+    0xE387, 0xE388, 0xE389, 0xE38A, 0xE38B, 0xE38C, 0xE38D, 0xE38E, 0xE38F, 0xE390, 0xE391, 0xE392, 0xE393, 0xE394, 0xE395, 0xE396,
+    0xE397, 0xE398, 0xE399, 0xE39A, 0xE39B, 0xE39C, 0xE39D, 0xE39E, 0xE39F, 0xE3A0, 0xE3A1, 0xE3A2, 0xE3A3, 0xE3A4, 0xE3A5, 0xE3A6,
+    0xE3A7, 0xE3A8, 0xE3A9, 0xE3AA, 0xE3AB, 0xE3AC, 0xE3AD, 0xE3AE, 0xE3AF, 0xE3B0, 0xE3B1, 0xE3B2, 0xE3B3, 0xE3B4, 0xE3B5, 0xFFFF,
+  },
+  { /* lead 0x6E */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE3B6, 0xE3B7, 0xE3B8, 0xE3B9, 0xE3BA, 0xE3BB, 0xE3BC, 0xE3BD, 0xE3BE, 0xE3BF, 0xE3C0, 0xE3C1, 0xE3C2, 0xE3C3, 0xE3C4,
+    0xE3C5, 0xE3C6, 0xE3C7, 0xE3C8, 0xE3C9, 0xE3CA, 0xE3CB, 0xE3CC, 0xE3CD, 0xE3CE, 0xE3CF, 0xE3D0, 0xE3D1, 0xE3D2, 0xE3D3, 0xE3D4,
+    0xE3D5, 0xE3D6, 0xE3D7, 0xE3D8, 0xE3D9, 0xE3DA, 0xE3DB, 0xE3DC, 0xE3DD, 0xE3DE, 0xE3DF, 0xE3E0, 0xE3E1, 0xE3E2, 0xE3E3, 0xE3E4,
+    0xE3E5, 0xE3E6, 0xE3E7, 0xE3E8, 0xE3E9, 0xE3EA, 0xE3EB, 0xE3EC, 0xE3ED, 0xE3EE, 0xE3EF, 0xE3F0, 0xE3F1, 0xE3F2, 0xE3F3, 0xE3F4,
+    0xE3F5, 0xE3F6, 0xE3F7, 0xE3F8, 0xE3F9, 0xE3FA, 0xE3FB, 0xE3FC, 0xE3FD, 0xE3FE, 0xE3FF, 0xE400, 0xE401, 0xE402, 0xE403, 0xE404,
+    0xE405, 0xE406, 0xE407, 0xE408, 0xE409, 0xE40A, 0xE40B, 0xE40C, 0xE40D, 0xE40E, 0xE40F, 0xE410, 0xE411, 0xE412, 0xE413, 0xE414,
+    0xE415, 0xE416, 0xE417, 0xE418, 0xE419, 0xE41A, 0xE41B, 0xE41C, 0xE41D, 0xE41E, 0xE41F, 0xE420, 0xE421, 0xE422, 0xE423, 0xE424,
+    0xE425, 0xE426, 0xE427, 0xE428, 0xE429, 0xE42A, 0xE42B, 0xE42C, 0xE42D, 0xE42E, 0xE42F, 0xE430, 0xE431, 0xE432, 0xE433, 0xE434,
+    0xE435, 0xE436, 0xE437, 0xE438, 0xE439, 0xE43A, 0xE43B, 0xE43C, 0xE43D, 0xE43E, 0xE43F, 0xE440, 0xE441, 0xE442, 0xE443, 0xE444,
+    0xE445, 0xE446, 0xE447, 0xE448, 0xE449, 0xE44A, 0xE44B, 0xE44C, 0xE44D, 0xE44E, 0xE44F, 0xE450, 0xE451, 0xE452, 0xE453, 0xE454,
+    0xE455, 0xE456, 0xE457, 0xE458, 0xE459, 0xE45A, 0xE45B, 0xE45C, 0xE45D, 0xE45E, 0xE45F, 0xE460, 0xE461, 0xE462, 0xE463, 0xE464,
+    0xE465, 0xE466, 0xE467, 0xE468, 0xE469, 0xE46A, 0xE46B, 0xE46C, 0xE46D, 0xE46E, 0xE46F, 0xE470, 0xE471, 0xE472, 0xE473, 0xFFFF,
+  },
+  { /* lead 0x6F */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE474, 0xE475, 0xE476, 0xE477, 0xE478, 0xE479, 0xE47A, 0xE47B, 0xE47C, 0xE47D, 0xE47E, 0xE47F, 0xE480, 0xE481, 0xE482,
+    0xE483, 0xE484, 0xE485, 0xE486, 0xE487, 0xE488, 0xE489, 0xE48A, 0xE48B, 0xE48C, 0xE48D, 0xE48E, 0xE48F, 0xE490, 0xE491, 0xE492,
+    0xE493, 0xE494, 0xE495, 0xE496, 0xE497, 0xE498, 0xE499, 0xE49A, 0xE49B, 0xE49C, 0xE49D, 0xE49E, 0xE49F, 0xE4A0, 0xE4A1, 0xE4A2,
+    0xE4A3, 0xE4A4, 0xE4A5, 0xE4A6, 0xE4A7, 0xE4A8, 0xE4A9, 0xE4AA, 0xE4AB, 0xE4AC, 0xE4AD, 0xE4AE, 0xE4AF, 0xE4B0, 0xE4B1, 0xE4B2,
+    0xE4B3, 0xE4B4, 0xE4B5, 0xE4B6, 0xE4B7, 0xE4B8, 0xE4B9, 0xE4BA, 0xE4BB, 0xE4BC, 0xE4BD, 0xE4BE, 0xE4BF, 0xE4C0, 0xE4C1, 0xE4C2,
+    0xE4C3, 0xE4C4, 0xE4C5, 0xE4C6, 0xE4C7, 0xE4C8, 0xE4C9, 0xE4CA, 0xE4CB, 0xE4CC, 0xE4CD, 0xE4CE, 0xE4CF, 0xE4D0, 0xE4D1, 0xE4D2,
+    0xE4D3, 0xE4D4, 0xE4D5, 0xE4D6, 0xE4D7, 0xE4D8, 0xE4D9, 0xE4DA, 0xE4DB, 0xE4DC, 0xE4DD, 0xE4DE, 0xE4DF, 0xE4E0, 0xE4E1, 0xE4E2,
+    0xE4E3, 0xE4E4, 0xE4E5, 0xE4E6, 0xE4E7, 0xE4E8, 0xE4E9, 0xE4EA, 0xE4EB, 0xE4EC, 0xE4ED, 0xE4EE, 0xE4EF, 0xE4F0, 0xE4F1, 0xE4F2,
+    0xE4F3, 0xE4F4, 0xE4F5, 0xE4F6, 0xE4F7, 0xE4F8, 0xE4F9, 0xE4FA, 0xE4FB, 0xE4FC, 0xE4FD, 0xE4FE, 0xE4FF, 0xE500, 0xE501, 0xE502,
+    0xE503, 0xE504, 0xE505, 0xE506, 0xE507, 0xE508, 0xE509, 0xE50A, 0xE50B, 0xE50C, 0xE50D, 0xE50E, 0xE50F, 0xE510, 0xE511, 0xE512,
+    0xE513, 0xE514, 0xE515, 0xE516, 0xE517, 0xE518, 0xE519, 0xE51A, 0xE51B, 0xE51C, 0xE51D, 0xE51E, 0xE51F, 0xE520, 0xE521, 0xE522,
+    0xE523, 0xE524, 0xE525, 0xE526, 0xE527, 0xE528, 0xE529, 0xE52A, 0xE52B, 0xE52C, 0xE52D, 0xE52E, 0xE52F, 0xE530, 0xE531, 0xFFFF,
+  },
+  { /* lead 0x70 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE532, 0xE533, 0xE534, 0xE535, 0xE536, 0xE537, 0xE538, 0xE539, 0xE53A, 0xE53B, 0xE53C, 0xE53D, 0xE53E, 0xE53F, 0xE540,
+    0xE541, 0xE542, 0xE543, 0xE544, 0xE545, 0xE546, 0xE547, 0xE548, 0xE549, 0xE54A, 0xE54B, 0xE54C, 0xE54D, 0xE54E, 0xE54F, 0xE550,
+    0xE551, 0xE552, 0xE553, 0xE554, 0xE555, 0xE556, 0xE557, 0xE558, 0xE559, 0xE55A, 0xE55B, 0xE55C, 0xE55D, 0xE55E, 0xE55F, 0xE560,
+    0xE561, 0xE562, 0xE563, 0xE564, 0xE565, 0xE566, 0xE567, 0xE568, 0xE569, 0xE56A, 0xE56B, 0xE56C, 0xE56D, 0xE56E, 0xE56F, 0xE570,
+    0xE571, 0xE572, 0xE573, 0xE574, 0xE575, 0xE576, 0xE577, 0xE578, 0xE579, 0xE57A, 0xE57B, 0xE57C, 0xE57D, 0xE57E, 0xE57F, 0xE580,
+    0xE581, 0xE582, 0xE583, 0xE584, 0xE585, 0xE586, 0xE587, 0xE588, 0xE589, 0xE58A, 0xE58B, 0xE58C, 0xE58D, 0xE58E, 0xE58F, 0xE590,
+    0xE591, 0xE592, 0xE593, 0xE594, 0xE595, 0xE596, 0xE597, 0xE598, 0xE599, 0xE59A, 0xE59B, 0xE59C, 0xE59D, 0xE59E, 0xE59F, 0xE5A0,
+    0xE5A1, 0xE5A2, 0xE5A3, 0xE5A4, 0xE5A5, 0xE5A6, 0xE5A7, 0xE5A8, 0xE5A9, 0xE5AA, 0xE5AB, 0xE5AC, 0xE5AD, 0xE5AE, 0xE5AF, 0xE5B0,
+    0xE5B1, 0xE5B2, 0xE5B3, 0xE5B4, 0xE5B5, 0xE5B6, 0xE5B7, 0xE5B8, 0xE5B9, 0xE5BA, 0xE5BB, 0xE5BC, 0xE5BD, 0xE5BE, 0xE5BF, 0xE5C0,
+    0xE5C1, 0xE5C2, 0xE5C3, 0xE5C4, 0xE5C5, 0xE5C6, 0xE5C7, 0xE5C8, 0xE5C9, 0xE5CA, 0xE5CB, 0xE5CC, 0xE5CD, 0xE5CE, 0xE5CF, 0xE5D0,
+    0xE5D1, 0xE5D2, 0xE5D3, 0xE5D4, 0xE5D5, 0xE5D6, 0xE5D7, 0xE5D8, 0xE5D9, 0xE5DA, 0xE5DB, 0xE5DC, 0xE5DD, 0xE5DE, 0xE5DF, 0xE5E0,
+    0xE5E1, 0xE5E2, 0xE5E3, 0xE5E4, 0xE5E5, 0xE5E6, 0xE5E7, 0xE5E8, 0xE5E9, 0xE5EA, 0xE5EB, 0xE5EC, 0xE5ED, 0xE5EE, 0xE5EF, 0xFFFF,
+  },
+  { /* lead 0x71 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE5F0, 0xE5F1, 0xE5F2, 0xE5F3, 0xE5F4, 0xE5F5, 0xE5F6, 0xE5F7, 0xE5F8, 0xE5F9, 0xE5FA, 0xE5FB, 0xE5FC, 0xE5FD, 0xE5FE,
+    0xE5FF, 0xE600, 0xE601, 0xE602, 0xE603, 0xE604, 0xE605, 0xE606, 0xE607, 0xE608, 0xE609, 0xE60A, 0xE60B, 0xE60C, 0xE60D, 0xE60E,
+    0xE60F, 0xE610, 0xE611, 0xE612, 0xE613, 0xE614, 0xE615, 0xE616, 0xE617, 0xE618, 0xE619, 0xE61A, 0xE61B, 0xE61C, 0xE61D, 0xE61E,
+    0xE61F, 0xE620, 0xE621, 0xE622, 0xE623, 0xE624, 0xE625, 0xE626, 0xE627, 0xE628, 0xE629, 0xE62A, 0xE62B, 0xE62C, 0xE62D, 0xE62E,
+    0xE62F, 0xE630, 0xE631, 0xE632, 0xE633, 0xE634, 0xE635, 0xE636, 0xE637, 0xE638, 0xE639, 0xE63A, 0xE63B, 0xE63C, 0xE63D, 0xE63E,
+    0xE63F, 0xE640, 0xE641, 0xE642, 0xE643, 0xE644, 0xE645, 0xE646, 0xE647, 0xE648, 0xE649, 0xE64A, 0xE64B, 0xE64C, 0xE64D, 0xE64E,
+    0xE64F, 0xE650, 0xE651, 0xE652, 0xE653, 0xE654, 0xE655, 0xE656, 0xE657, 0xE658, 0xE659, 0xE65A, 0xE65B, 0xE65C, 0xE65D, 0xE65E,
+    0xE65F, 0xE660, 0xE661, 0xE662, 0xE663, 0xE664, 0xE665, 0xE666, 0xE667, 0xE668, 0xE669, 0xE66A, 0xE66B, 0xE66C, 0xE66D, 0xE66E,
+    0xE66F, 0xE670, 0xE671, 0xE672, 0xE673, 0xE674, 0xE675, 0xE676, 0xE677, 0xE678, 0xE679, 0xE67A, 0xE67B, 0xE67C, 0xE67D, 0xE67E,
+    0xE67F, 0xE680, 0xE681, 0xE682, 0xE683, 0xE684, 0xE685, 0xE686, 0xE687, 0xE688, 0xE689, 0xE68A, 0xE68B, 0xE68C, 0xE68D, 0xE68E,
+    0xE68F, 0xE690, 0xE691, 0xE692, 0xE693, 0xE694, 0xE695, 0xE696, 0xE697, 0xE698, 0xE699, 0xE69A, 0xE69B, 0xE69C, 0xE69D, 0xE69E,
+    0xE69F, 0xE6A0, 0xE6A1, 0xE6A2, 0xE6A3, 0xE6A4, 0xE6A5, 0xE6A6, 0xE6A7, 0xE6A8, 0xE6A9, 0xE6AA, 0xE6AB, 0xE6AC, 0xE6AD, 0xFFFF,
+  },
+  { /* lead 0x72 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE6AE, 0xE6AF, 0xE6B0, 0xE6B1, 0xE6B2, 0xE6B3, 0xE6B4, 0xE6B5, 0xE6B6, 0xE6B7, 0xE6B8, 0xE6B9, 0xE6BA, 0xE6BB, 0xE6BC,
+    0xE6BD, 0xE6BE, 0xE6BF, 0xE6C0, 0xE6C1, 0xE6C2, 0xE6C3, 0xE6C4, 0xE6C5, 0xE6C6, 0xE6C7, 0xE6C8, 0xE6C9, 0xE6CA, 0xE6CB, 0xE6CC,
+    0xE6CD, 0xE6CE, 0xE6CF, 0xE6D0, 0xE6D1, 0xE6D2, 0xE6D3, 0xE6D4, 0xE6D5, 0xE6D6, 0xE6D7, 0xE6D8, 0xE6D9, 0xE6DA, 0xE6DB, 0xE6DC,
+    0xE6DD, 0xE6DE, 0xE6DF, 0xE6E0, 0xE6E1, 0xE6E2, 0xE6E3, 0xE6E4, 0xE6E5, 0xE6E6, 0xE6E7, 0xE6E8, 0xE6E9, 0xE6EA, 0xE6EB, 0xE6EC,
+    0xE6ED, 0xE6EE, 0xE6EF, 0xE6F0, 0xE6F1, 0xE6F2, 0xE6F3, 0xE6F4, 0xE6F5, 0xE6F6, 0xE6F7, 0xE6F8, 0xE6F9, 0xE6FA, 0xE6FB, 0xE6FC,
+    0xE6FD, 0xE6FE, 0xE6FF, 0xE700, 0xE701, 0xE702, 0xE703, 0xE704, 0xE705, 0xE706, 0xE707, 0xE708, 0xE709, 0xE70A, 0xE70B, 0xE70C,
+    0xE70D, 0xE70E, 0xE70F, 0xE710, 0xE711, 0xE712, 0xE713, 0xE714, 0xE715, 0xE716, 0xE717, 0xE718, 0xE719, 0xE71A, 0xE71B, 0xE71C,
+    0xE71D, 0xE71E, 0xE71F, 0xE720, 0xE721, 0xE722, 0xE723, 0xE724, 0xE725, 0xE726, 0xE727, 0xE728, 0xE729, 0xE72A, 0xE72B, 0xE72C,
+    0xE72D, 0xE72E, 0xE72F, 0xE730, 0xE731, 0xE732, 0xE733, 0xE734, 0xE735, 0xE736, 0xE737, 0xE738, 0xE739, 0xE73A, 0xE73B, 0xE73C,
+    0xE73D, 0xE73E, 0xE73F, 0xE740, 0xE741, 0xE742, 0xE743, 0xE744, 0xE745, 0xE746, 0xE747, 0xE748, 0xE749, 0xE74A, 0xE74B, 0xE74C,
+    0xE74D, 0xE74E, 0xE74F, 0xE750, 0xE751, 0xE752, 0xE753, 0xE754, 0xE755, 0xE756, 0xE757, 0xE758, 0xE759, 0xE75A, 0xE75B, 0xE75C,
+    0xE75D, 0xE75E, 0xE75F, 0xE760, 0xE761, 0xE762, 0xE763, 0xE764, 0xE765, 0xE766, 0xE767, 0xE768, 0xE769, 0xE76A, 0xE76B, 0xFFFF,
+  },
+  { /* lead 0x73 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE76C, 0xE76D, 0xE76E, 0xE76F, 0xE770, 0xE771, 0xE772, 0xE773, 0xE774, 0xE775, 0xE776, 0xE777, 0xE778, 0xE779, 0xE77A,
+    0xE77B, 0xE77C, 0xE77D, 0xE77E, 0xE77F, 0xE780, 0xE781, 0xE782, 0xE783, 0xE784, 0xE785, 0xE786, 0xE787, 0xE788, 0xE789, 0xE78A,
+    0xE78B, 0xE78C, 0xE78D, 0xE78E, 0xE78F, 0xE790, 0xE791, 0xE792, 0xE793, 0xE794, 0xE795, 0xE796, 0xE797, 0xE798, 0xE799, 0xE79A,
+    0xE79B, 0xE79C, 0xE79D, 0xE79E, 0xE79F, 0xE7A0, 0xE7A1, 0xE7A2, 0xE7A3, 0xE7A4, 0xE7A5, 0xE7A6, 0xE7A7, 0xE7A8, 0xE7A9, 0xE7AA,
+    0xE7AB, 0xE7AC, 0xE7AD, 0xE7AE, 0xE7AF, 0xE7B0, 0xE7B1, 0xE7B2, 0xE7B3, 0xE7B4, 0xE7B5, 0xE7B6, 0xE7B7, 0xE7B8, 0xE7B9, 0xE7BA,
+    0xE7BB, 0xE7BC, 0xE7BD, 0xE7BE, 0xE7BF, 0xE7C0, 0xE7C1, 0xE7C2, 0xE7C3, 0xE7C4, 0xE7C5, 0xE7C6, 0xE7C7, 0xE7C8, 0xE7C9, 0xE7CA,
+    0xE7CB, 0xE7CC, 0xE7CD, 0xE7CE, 0xE7CF, 0xE7D0, 0xE7D1, 0xE7D2, 0xE7D3, 0xE7D4, 0xE7D5, 0xE7D6, 0xE7D7, 0xE7D8, 0xE7D9, 0xE7DA,
+    0xE7DB, 0xE7DC, 0xE7DD, 0xE7DE, 0xE7DF, 0xE7E0, 0xE7E1, 0xE7E2, 0xE7E3, 0xE7E4, 0xE7E5, 0xE7E6, 0xE7E7, 0xE7E8, 0xE7E9, 0xE7EA,
+    0xE7EB, 0xE7EC, 0xE7ED, 0xE7EE, 0xE7EF, 0xE7F0, 0xE7F1, 0xE7F2, 0xE7F3, 0xE7F4, 0xE7F5, 0xE7F6, 0xE7F7, 0xE7F8, 0xE7F9, 0xE7FA,
+    0xE7FB, 0xE7FC, 0xE7FD, 0xE7FE, 0xE7FF, 0xE800, 0xE801, 0xE802, 0xE803, 0xE804, 0xE805, 0xE806, 0xE807, 0xE808, 0xE809, 0xE80A,
+    0xE80B, 0xE80C, 0xE80D, 0xE80E, 0xE80F, 0xE810, 0xE811, 0xE812, 0xE813, 0xE814, 0xE815, 0xE816, 0xE817, 0xE818, 0xE819, 0xE81A,
+    0xE81B, 0xE81C, 0xE81D, 0xE81E, 0xE81F, 0xE820, 0xE821, 0xE822, 0xE823, 0xE824, 0xE825, 0xE826, 0xE827, 0xE828, 0xE829, 0xFFFF,
+  },
+  { /* lead 0x74 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE82A, 0xE82B, 0xE82C, 0xE82D, 0xE82E, 0xE82F, 0xE830, 0xE831, 0xE832, 0xE833, 0xE834, 0xE835, 0xE836, 0xE837, 0xE838,
+    0xE839, 0xE83A, 0xE83B, 0xE83C, 0xE83D, 0xE83E, 0xE83F, 0xE840, 0xE841, 0xE842, 0xE843, 0xE844, 0xE845, 0xE846, 0xE847, 0xE848,
+    0xE849, 0xE84A, 0xE84B, 0xE84C, 0xE84D, 0xE84E, 0xE84F, 0xE850, 0xE851, 0xE852, 0xE853, 0xE854, 0xE855, 0xE856, 0xE857, 0xE858,
+    0xE859, 0xE85A, 0xE85B, 0xE85C, 0xE85D, 0xE85E, 0xE85F, 0xE860, 0xE861, 0xE862, 0xE863, 0xE864, 0xE865, 0xE866, 0xE867, 0xE868,
+    0xE869, 0xE86A, 0xE86B, 0xE86C, 0xE86D, 0xE86E, 0xE86F, 0xE870, 0xE871, 0xE872, 0xE873, 0xE874, 0xE875, 0xE876, 0xE877, 0xE878,
+    0xE879, 0xE87A, 0xE87B, 0xE87C, 0xE87D, 0xE87E, 0xE87F, 0xE880, 0xE881, 0xE882, 0xE883, 0xE884, 0xE885, 0xE886, 0xE887, 0xE888,
+    0xE889, 0xE88A, 0xE88B, 0xE88C, 0xE88D, 0xE88E, 0xE88F, 0xE890, 0xE891, 0xE892, 0xE893, 0xE894, 0xE895, 0xE896, 0xE897, 0xE898,
+    0xE899, 0xE89A, 0xE89B, 0xE89C, 0xE89D, 0xE89E, 0xE89F, 0xE8A0, 0xE8A1, 0xE8A2, 0xE8A3, 0xE8A4, 0xE8A5, 0xE8A6, 0xE8A7, 0xE8A8,
+    0xE8A9, 0xE8AA, 0xE8AB, 0xE8AC, 0xE8AD, 0xE8AE, 0xE8AF, 0xE8B0, 0xE8B1, 0xE8B2, 0xE8B3, 0xE8B4, 0xE8B5, 0xE8B6, 0xE8B7, 0xE8B8,
+    0xE8B9, 0xE8BA, 0xE8BB, 0xE8BC, 0xE8BD, 0xE8BE, 0xE8BF, 0xE8C0, 0xE8C1, 0xE8C2, 0xE8C3, 0xE8C4, 0xE8C5, 0xE8C6, 0xE8C7, 0xE8C8,
+    0xE8C9, 0xE8CA, 0xE8CB, 0xE8CC, 0xE8CD, 0xE8CE, 0xE8CF, 0xE8D0, 0xE8D1, 0xE8D2, 0xE8D3, 0xE8D4, 0xE8D5, 0xE8D6, 0xE8D7, 0xE8D8,
+    0xE8D9, 0xE8DA, 0xE8DB, 0xE8DC, 0xE8DD, 0xE8DE, 0xE8DF, 0xE8E0, 0xE8E1, 0xE8E2, 0xE8E3, 0xE8E4, 0xE8E5, 0xE8E6, 0xE8E7, 0xFFFF,
+  },
+  { /* lead 0x75 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE8E8, 0xE8E9, 0xE8EA, 0xE8EB, 0xE8EC, 0xE8ED, 0xE8EE, 0xE8EF, 0xE8F0, 0xE8F1, 0xE8F2, 0xE8F3, 0xE8F4, 0xE8F5, 0xE8F6,
+    0xE8F7, 0xE8F8, 0xE8F9, 0xE8FA, 0xE8FB, 0xE8FC, 0xE8FD, 0xE8FE, 0xE8FF, 0xE900, 0xE901, 0xE902, 0xE903, 0xE904, 0xE905, 0xE906,
+    0xE907, 0xE908, 0xE909, 0xE90A, 0xE90B, 0xE90C, 0xE90D, 0xE90E, 0xE90F, 0xE910, 0xE911, 0xE912, 0xE913, 0xE914, 0xE915, 0xE916,
+    0xE917, 0xE918, 0xE919, 0xE91A, 0xE91B, 0xE91C, 0xE91D, 0xE91E, 0xE91F, 0xE920, 0xE921, 0xE922, 0xE923, 0xE924, 0xE925, 0xE926,
+    0xE927, 0xE928, 0xE929, 0xE92A, 0xE92B, 0xE92C, 0xE92D, 0xE92E, 0xE92F, 0xE930, 0xE931, 0xE932, 0xE933, 0xE934, 0xE935, 0xE936,
+    0xE937, 0xE938, 0xE939, 0xE93A, 0xE93B, 0xE93C, 0xE93D, 0xE93E, 0xE93F, 0xE940, 0xE941, 0xE942, 0xE943, 0xE944, 0xE945, 0xE946,
+    0xE947, 0xE948, 0xE949, 0xE94A, 0xE94B, 0xE94C, 0xE94D, 0xE94E, 0xE94F, 0xE950, 0xE951, 0xE952, 0xE953, 0xE954, 0xE955, 0xE956,
+    0xE957, 0xE958, 0xE959, 0xE95A, 0xE95B, 0xE95C, 0xE95D, 0xE95E, 0xE95F, 0xE960, 0xE961, 0xE962, 0xE963, 0xE964, 0xE965, 0xE966,
+    0xE967, 0xE968, 0xE969, 0xE96A, 0xE96B, 0xE96C, 0xE96D, 0xE96E, 0xE96F, 0xE970, 0xE971, 0xE972, 0xE973, 0xE974, 0xE975, 0xE976,
+    0xE977, 0xE978, 0xE979, 0xE97A, 0xE97B, 0xE97C, 0xE97D, 0xE97E, 0xE97F, 0xE980, 0xE981, 0xE982, 0xE983, 0xE984, 0xE985, 0xE986,
+    0xE987, 0xE988, 0xE989, 0xE98A, 0xE98B, 0xE98C, 0xE98D, 0xE98E, 0xE98F, 0xE990, 0xE991, 0xE992, 0xE993, 0xE994, 0xE995, 0xE996,
+    0xE997, 0xE998, 0xE999, 0xE99A, 0xE99B, 0xE99C, 0xE99D, 0xE99E, 0xE99F, 0xE9A0, 0xE9A1, 0xE9A2, 0xE9A3, 0xE9A4, 0xE9A5, 0xFFFF,
+  },
+  { /* lead 0x76 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE9A6, 0xE9A7, 0xE9A8, 0xE9A9, 0xE9AA, 0xE9AB, 0xE9AC, 0xE9AD, 0xE9AE, 0xE9AF, 0xE9B0, 0xE9B1, 0xE9B2, 0xE9B3, 0xE9B4,
+    0xE9B5, 0xE9B6, 0xE9B7, 0xE9B8, 0xE9B9, 0xE9BA, 0xE9BB, 0xE9BC, 0xE9BD, 0xE9BE, 0xE9BF, 0xE9C0, 0xE9C1, 0xE9C2, 0xE9C3, 0xE9C4,
+    0xE9C5, 0xE9C6, 0xE9C7, 0xE9C8, 0xE9C9, 0xE9CA, 0xE9CB, 0xE9CC, 0xE9CD, 0xE9CE, 0xE9CF, 0xE9D0, 0xE9D1, 0xE9D2, 0xE9D3, 0xE9D4,
+    0xE9D5, 0xE9D6, 0xE9D7, 0xE9D8, 0xE9D9, 0xE9DA, 0xE9DB, 0xE9DC, 0xE9DD, 0xE9DE, 0xE9DF, 0xE9E0, 0xE9E1, 0xE9E2, 0xE9E3, 0xE9E4,
+    0xE9E5, 0xE9E6, 0xE9E7, 0xE9E8, 0xE9E9, 0xE9EA, 0xE9EB, 0xE9EC, 0xE9ED, 0xE9EE, 0xE9EF, 0xE9F0, 0xE9F1, 0xE9F2, 0xE9F3, 0xE9F4,
+    0xE9F5, 0xE9F6, 0xE9F7, 0xE9F8, 0xE9F9, 0xE9FA, 0xE9FB, 0xE9FC, 0xE9FD, 0xE9FE, 0xE9FF, 0xEA00, 0xEA01, 0xEA02, 0xEA03, 0xEA04,
+    0xEA05, 0xEA06, 0xEA07, 0xEA08, 0xEA09, 0xEA0A, 0xEA0B, 0xEA0C, 0xEA0D, 0xEA0E, 0xEA0F, 0xEA10, 0xEA11, 0xEA12, 0xEA13, 0xEA14,
+    0xEA15, 0xEA16, 0xEA17, 0xEA18, 0xEA19, 0xEA1A, 0xEA1B, 0xEA1C, 0xEA1D, 0xEA1E, 0xEA1F, 0xEA20, 0xEA21, 0xEA22, 0xEA23, 0xEA24,
+    0xEA25, 0xEA26, 0xEA27, 0xEA28, 0xEA29, 0xEA2A, 0xEA2B, 0xEA2C, 0xEA2D, 0xEA2E, 0xEA2F, 0xEA30, 0xEA31, 0xEA32, 0xEA33, 0xEA34,
+    0xEA35, 0xEA36, 0xEA37, 0xEA38, 0xEA39, 0xEA3A, 0xEA3B, 0xEA3C, 0xEA3D, 0xEA3E, 0xEA3F, 0xEA40, 0xEA41, 0xEA42, 0xEA43, 0xEA44,
+    0xEA45, 0xEA46, 0xEA47, 0xEA48, 0xEA49, 0xEA4A, 0xEA4B, 0xEA4C, 0xEA4D, 0xEA4E, 0xEA4F, 0xEA50, 0xEA51, 0xEA52, 0xEA53, 0xEA54,
+    0xEA55, 0xEA56, 0xEA57, 0xEA58, 0xEA59, 0xEA5A, 0xEA5B, 0xEA5C, 0xEA5D, 0xEA5E, 0xEA5F, 0xEA60, 0xEA61, 0xEA62, 0xEA63, 0xFFFF,
+  },
+  { /* lead 0x77 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEA64, 0xEA65, 0xEA66, 0xEA67, 0xEA68, 0xEA69, 0xEA6A, 0xEA6B, 0xEA6C, 0xEA6D, 0xEA6E, 0xEA6F, 0xEA70, 0xEA71, 0xEA72,
+    0xEA73, 0xEA74, 0xEA75, 0xEA76, 0xEA77, 0xEA78, 0xEA79, 0xEA7A, 0xEA7B, 0xEA7C, 0xEA7D, 0xEA7E, 0xEA7F, 0xEA80, 0xEA81, 0xEA82,
+    0xEA83, 0xEA84, 0xEA85, 0xEA86, 0xEA87, 0xEA88, 0xEA89, 0xEA8A, 0xEA8B, 0xEA8C, 0xEA8D, 0xEA8E, 0xEA8F, 0xEA90, 0xEA91, 0xEA92,
+    0xEA93, 0xEA94, 0xEA95, 0xEA96, 0xEA97, 0xEA98, 0xEA99, 0xEA9A, 0xEA9B, 0xEA9C, 0xEA9D, 0xEA9E, 0xEA9F, 0xEAA0, 0xEAA1, 0xEAA2,
+    0xEAA3, 0xEAA4, 0xEAA5, 0xEAA6, 0xEAA7, 0xEAA8, 0xEAA9, 0xEAAA, 0xEAAB, 0xEAAC, 0xEAAD, 0xEAAE, 0xEAAF, 0xEAB0, 0xEAB1, 0xEAB2,
+    0xEAB3, 0xEAB4, 0xEAB5, 0xEAB6, 0xEAB7, 0xEAB8, 0xEAB9, 0xEABA, 0xEABB, 0xEABC, 0xEABD, 0xEABE, 0xEABF, 0xEAC0, 0xEAC1, 0xEAC2,
+    0xEAC3, 0xEAC4, 0xEAC5, 0xEAC6, 0xEAC7, 0xEAC8, 0xEAC9, 0xEACA, 0xEACB, 0xEACC, 0xEACD, 0xEACE, 0xEACF, 0xEAD0, 0xEAD1, 0xEAD2,
+    0xEAD3, 0xEAD4, 0xEAD5, 0xEAD6, 0xEAD7, 0xEAD8, 0xEAD9, 0xEADA, 0xEADB, 0xEADC, 0xEADD, 0xEADE, 0xEADF, 0xEAE0, 0xEAE1, 0xEAE2,
+    0xEAE3, 0xEAE4, 0xEAE5, 0xEAE6, 0xEAE7, 0xEAE8, 0xEAE9, 0xEAEA, 0xEAEB, 0xEAEC, 0xEAED, 0xEAEE, 0xEAEF, 0xEAF0, 0xEAF1, 0xEAF2,
+    0xEAF3, 0xEAF4, 0xEAF5, 0xEAF6, 0xEAF7, 0xEAF8, 0xEAF9, 0xEAFA, 0xEAFB, 0xEAFC, 0xEAFD, 0xEAFE, 0xEAFF, 0xEB00, 0xEB01, 0xEB02,
+    0xEB03, 0xEB04, 0xEB05, 0xEB06, 0xEB07, 0xEB08, 0xEB09, 0xEB0A, 0xEB0B, 0xEB0C, 0xEB0D, 0xEB0E, 0xEB0F, 0xEB10, 0xEB11, 0xEB12,
+    0xEB13, 0xEB14, 0xEB15, 0xEB16, 0xEB17, 0xEB18, 0xEB19, 0xEB1A, 0xEB1B, 0xEB1C, 0xEB1D, 0xEB1E, 0xEB1F, 0xEB20, 0xEB21, 0xFFFF,
+  },
+  { /* lead 0x78 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEB22, 0xEB23, 0xEB24, 0xEB25, 0xEB26, 0xEB27, 0xEB28, 0xEB29, 0xEB2A, 0xEB2B, 0xEB2C, 0xEB2D, 0xEB2E, 0xEB2F, 0xEB30,
+    0xEB31, 0xEB32, 0xEB33, 0xEB34, 0xEB35, 0xEB36, 0xEB37, 0xEB38, 0xEB39, 0xEB3A, 0xEB3B, 0xEB3C, 0xEB3D, 0xEB3E, 0xEB3F, 0xEB40,
+    0xEB41, 0xEB42, 0xEB43, 0xEB44, 0xEB45, 0xEB46, 0xEB47, 0xEB48, 0xEB49, 0xEB4A, 0xEB4B, 0xEB4C, 0xEB4D, 0xEB4E, 0xEB4F, 0xEB50,
+    0xEB51, 0xEB52, 0xEB53, 0xEB54, 0xEB55, 0xEB56, 0xEB57, 0xEB58, 0xEB59, 0xEB5A, 0xEB5B, 0xEB5C, 0xEB5D, 0xEB5E, 0xEB5F, 0xEB60,
+    0xEB61, 0xEB62, 0xEB63, 0xEB64, 0xEB65, 0xEB66, 0xEB67, 0xEB68, 0xEB69, 0xEB6A, 0xEB6B, 0xEB6C, 0xEB6D, 0xEB6E, 0xEB6F, 0xEB70,
+    0xEB71, 0xEB72, 0xEB73, 0xEB74, 0xEB75, 0xEB76, 0xEB77, 0xEB78, 0xEB79, 0xEB7A, 0xEB7B, 0xEB7C, 0xEB7D, 0xEB7E, 0xEB7F, 0xEB80,
+    0xEB81, 0xEB82, 0xEB83, 0xEB84, 0xEB85, 0xEB86, 0xEB87, 0xEB88, 0xEB89, 0xEB8A, 0xEB8B, 0xEB8C, 0xEB8D, 0xEB8E, 0xEB8F, 0xEB90,
+    0xEB91, 0xEB92, 0xEB93, 0xEB94, 0xEB95, 0xEB96, 0xEB97, 0xEB98, 0xEB99, 0xEB9A, 0xEB9B, 0xEB9C, 0xEB9D, 0xEB9E, 0xEB9F, 0xEBA0,
+    0xEBA1, 0xEBA2, 0xEBA3, 0xEBA4, 0xEBA5, 0xEBA6, 0xEBA7, 0xEBA8, 0xEBA9, 0xEBAA, 0xEBAB, 0xEBAC, 0xEBAD, 0xEBAE, 0xEBAF, 0xEBB0,
+    0xEBB1, 0xEBB2, 0xEBB3, 0xEBB4, 0xEBB5, 0xEBB6, 0xEBB7, 0xEBB8, 0xEBB9, 0xEBBA, 0xEBBB, 0xEBBC, 0xEBBD, 0xEBBE, 0xEBBF, 0xEBC0,
+    0xEBC1, 0xEBC2, 0xEBC3, 0xEBC4, 0xEBC5, 0xEBC6, 0xEBC7, 0xEBC8, 0xEBC9, 0xEBCA, 0xEBCB, 0xEBCC, 0xEBCD, 0xEBCE, 0xEBCF, 0xEBD0,
+    0xEBD1, 0xEBD2, 0xEBD3, 0xEBD4, 0xEBD5, 0xEBD6, 0xEBD7, 0xEBD8, 0xEBD9, 0xEBDA, 0xEBDB, 0xEBDC, 0xEBDD, 0xEBDE, 0xEBDF, 0xFFFF,
+  },
+  { /* lead 0x79 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEBE0, 0xEBE1, 0xEBE2, 0xEBE3, 0xEBE4, 0xEBE5, 0xEBE6, 0xEBE7, 0xEBE8, 0xEBE9, 0xEBEA, 0xEBEB, 0xEBEC, 0xEBED, 0xEBEE,
+    0xEBEF, 0xEBF0, 0xEBF1, 0xEBF2, 0xEBF3, 0xEBF4, 0xEBF5, 0xEBF6, 0xEBF7, 0xEBF8, 0xEBF9, 0xEBFA, 0xEBFB, 0xEBFC, 0xEBFD, 0xEBFE,
+    0xEBFF, 0xEC00, 0xEC01, 0xEC02, 0xEC03, 0xEC04, 0xEC05, 0xEC06, 0xEC07, 0xEC08, 0xEC09, 0xEC0A, 0xEC0B, 0xEC0C, 0xEC0D, 0xEC0E,
+    0xEC0F, 0xEC10, 0xEC11, 0xEC12, 0xEC13, 0xEC14, 0xEC15, 0xEC16, 0xEC17, 0xEC18, 0xEC19, 0xEC1A, 0xEC1B, 0xEC1C, 0xEC1D, 0xEC1E,
+    0xEC1F, 0xEC20, 0xEC21, 0xEC22, 0xEC23, 0xEC24, 0xEC25, 0xEC26, 0xEC27, 0xEC28, 0xEC29, 0xEC2A, 0xEC2B, 0xEC2C, 0xEC2D, 0xEC2E,
+    0xEC2F, 0xEC30, 0xEC31, 0xEC32, 0xEC33, 0xEC34, 0xEC35, 0xEC36, 0xEC37, 0xEC38, 0xEC39, 0xEC3A, 0xEC3B, 0xEC3C, 0xEC3D, 0xEC3E,
+    0xEC3F, 0xEC40, 0xEC41, 0xEC42, 0xEC43, 0xEC44, 0xEC45, 0xEC46, 0xEC47, 0xEC48, 0xEC49, 0xEC4A, 0xEC4B, 0xEC4C, 0xEC4D, 0xEC4E,
+    0xEC4F, 0xEC50, 0xEC51, 0xEC52, 0xEC53, 0xEC54, 0xEC55, 0xEC56, 0xEC57, 0xEC58, 0xEC59, 0xEC5A, 0xEC5B, 0xEC5C, 0xEC5D, 0xEC5E,
+    0xEC5F, 0xEC60, 0xEC61, 0xEC62, 0xEC63, 0xEC64, 0xEC65, 0xEC66, 0xEC67, 0xEC68, 0xEC69, 0xEC6A, 0xEC6B, 0xEC6C, 0xEC6D, 0xEC6E,
+    0xEC6F, 0xEC70, 0xEC71, 0xEC72, 0xEC73, 0xEC74, 0xEC75, 0xEC76, 0xEC77, 0xEC78, 0xEC79, 0xEC7A, 0xEC7B, 0xEC7C, 0xEC7D, 0xEC7E,
+    0xEC7F, 0xEC80, 0xEC81, 0xEC82, 0xEC83, 0xEC84, 0xEC85, 0xEC86, 0xEC87, 0xEC88, 0xEC89, 0xEC8A, 0xEC8B, 0xEC8C, 0xEC8D, 0xEC8E,
+    0xEC8F, 0xEC90, 0xEC91, 0xEC92, 0xEC93, 0xEC94, 0xEC95, 0xEC96, 0xEC97, 0xEC98, 0xEC99, 0xEC9A, 0xEC9B, 0xEC9C, 0xEC9D, 0xFFFF,
+  },
+  { /* lead 0x7A */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEC9E, 0xEC9F, 0xECA0, 0xECA1, 0xECA2, 0xECA3, 0xECA4, 0xECA5, 0xECA6, 0xECA7, 0xECA8, 0xECA9, 0xECAA, 0xECAB, 0xECAC,
+    0xECAD, 0xECAE, 0xECAF, 0xECB0, 0xECB1, 0xECB2, 0xECB3, 0xECB4, 0xECB5, 0xECB6, 0xECB7, 0xECB8, 0xECB9, 0xECBA, 0xECBB, 0xECBC,
+    0xECBD, 0xECBE, 0xECBF, 0xECC0, 0xECC1, 0xECC2, 0xECC3, 0xECC4, 0xECC5, 0xECC6, 0xECC7, 0xECC8, 0xECC9, 0xECCA, 0xECCB, 0xECCC,
+    0xECCD, 0xECCE, 0xECCF, 0xECD0, 0xECD1, 0xECD2, 0xECD3, 0xECD4, 0xECD5, 0xECD6, 0xECD7, 0xECD8, 0xECD9, 0xECDA, 0xECDB, 0xECDC,
+    0xECDD, 0xECDE, 0xECDF, 0xECE0, 0xECE1, 0xECE2, 0xECE3, 0xECE4, 0xECE5, 0xECE6, 0xECE7, 0xECE8, 0xECE9, 0xECEA, 0xECEB, 0xECEC,
+    0xECED, 0xECEE, 0xECEF, 0xECF0, 0xECF1, 0xECF2, 0xECF3, 0xECF4, 0xECF5, 0xECF6, 0xECF7, 0xECF8, 0xECF9, 0xECFA, 0xECFB, 0xECFC,
+    0xECFD, 0xECFE, 0xECFF, 0xED00, 0xED01, 0xED02, 0xED03, 0xED04, 0xED05, 0xED06, 0xED07, 0xED08, 0xED09, 0xED0A, 0xED0B, 0xED0C,
+    0xED0D, 0xED0E, 0xED0F, 0xED10, 0xED11, 0xED12, 0xED13, 0xED14, 0xED15, 0xED16, 0xED17, 0xED18, 0xED19, 0xED1A, 0xED1B, 0xED1C,
+    0xED1D, 0xED1E, 0xED1F, 0xED20, 0xED21, 0xED22, 0xED23, 0xED24, 0xED25, 0xED26, 0xED27, 0xED28, 0xED29, 0xED2A, 0xED2B, 0xED2C,
+    0xED2D, 0xED2E, 0xED2F, 0xED30, 0xED31, 0xED32, 0xED33, 0xED34, 0xED35, 0xED36, 0xED37, 0xED38, 0xED39, 0xED3A, 0xED3B, 0xED3C,
+    0xED3D, 0xED3E, 0xED3F, 0xED40, 0xED41, 0xED42, 0xED43, 0xED44, 0xED45, 0xED46, 0xED47, 0xED48, 0xED49, 0xED4A, 0xED4B, 0xED4C,
+    0xED4D, 0xED4E, 0xED4F, 0xED50, 0xED51, 0xED52, 0xED53, 0xED54, 0xED55, 0xED56, 0xED57, 0xED58, 0xED59, 0xED5A, 0xED5B, 0xFFFF,
+  },
+  { /* lead 0x7B */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xED5C, 0xED5D, 0xED5E, 0xED5F, 0xED60, 0xED61, 0xED62, 0xED63, 0xED64, 0xED65, 0xED66, 0xED67, 0xED68, 0xED69, 0xED6A,
+    0xED6B, 0xED6C, 0xED6D, 0xED6E, 0xED6F, 0xED70, 0xED71, 0xED72, 0xED73, 0xED74, 0xED75, 0xED76, 0xED77, 0xED78, 0xED79, 0xED7A,
+    0xED7B, 0xED7C, 0xED7D, 0xED7E, 0xED7F, 0xED80, 0xED81, 0xED82, 0xED83, 0xED84, 0xED85, 0xED86, 0xED87, 0xED88, 0xED89, 0xED8A,
+    0xED8B, 0xED8C, 0xED8D, 0xED8E, 0xED8F, 0xED90, 0xED91, 0xED92, 0xED93, 0xED94, 0xED95, 0xED96, 0xED97, 0xED98, 0xED99, 0xED9A,
+    0xED9B, 0xED9C, 0xED9D, 0xED9E, 0xED9F, 0xEDA0, 0xEDA1, 0xEDA2, 0xEDA3, 0xEDA4, 0xEDA5, 0xEDA6, 0xEDA7, 0xEDA8, 0xEDA9, 0xEDAA,
+    0xEDAB, 0xEDAC, 0xEDAD, 0xEDAE, 0xEDAF, 0xEDB0, 0xEDB1, 0xEDB2, 0xEDB3, 0xEDB4, 0xEDB5, 0xEDB6, 0xEDB7, 0xEDB8, 0xEDB9, 0xEDBA,
+    0xEDBB, 0xEDBC, 0xEDBD, 0xEDBE, 0xEDBF, 0xEDC0, 0xEDC1, 0xEDC2, 0xEDC3, 0xEDC4, 0xEDC5, 0xEDC6, 0xEDC7, 0xEDC8, 0xEDC9, 0xEDCA,
+    0xEDCB, 0xEDCC, 0xEDCD, 0xEDCE, 0xEDCF, 0xEDD0, 0xEDD1, 0xEDD2, 0xEDD3, 0xEDD4, 0xEDD5, 0xEDD6, 0xEDD7, 0xEDD8, 0xEDD9, 0xEDDA,
+    0xEDDB, 0xEDDC, 0xEDDD, 0xEDDE, 0xEDDF, 0xEDE0, 0xEDE1, 0xEDE2, 0xEDE3, 0xEDE4, 0xEDE5, 0xEDE6, 0xEDE7, 0xEDE8, 0xEDE9, 0xEDEA,
+    0xEDEB, 0xEDEC, 0xEDED, 0xEDEE, 0xEDEF, 0xEDF0, 0xEDF1, 0xEDF2, 0xEDF3, 0xEDF4, 0xEDF5, 0xEDF6, 0xEDF7, 0xEDF8, 0xEDF9, 0xEDFA,
+    0xEDFB, 0xEDFC, 0xEDFD, 0xEDFE, 0xEDFF, 0xEE00, 0xEE01, 0xEE02, 0xEE03, 0xEE04, 0xEE05, 0xEE06, 0xEE07, 0xEE08, 0xEE09, 0xEE0A,
+    0xEE0B, 0xEE0C, 0xEE0D, 0xEE0E, 0xEE0F, 0xEE10, 0xEE11, 0xEE12, 0xEE13, 0xEE14, 0xEE15, 0xEE16, 0xEE17, 0xEE18, 0xEE19, 0xFFFF,
+  },
+  { /* lead 0x7C */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEE1A, 0xEE1B, 0xEE1C, 0xEE1D, 0xEE1E, 0xEE1F, 0xEE20, 0xEE21, 0xEE22, 0xEE23, 0xEE24, 0xEE25, 0xEE26, 0xEE27, 0xEE28,
+    0xEE29, 0xEE2A, 0xEE2B, 0xEE2C, 0xEE2D, 0xEE2E, 0xEE2F, 0xEE30, 0xEE31, 0xEE32, 0xEE33, 0xEE34, 0xEE35, 0xEE36, 0xEE37, 0xEE38,
+    0xEE39, 0xEE3A, 0xEE3B, 0xEE3C, 0xEE3D, 0xEE3E, 0xEE3F, 0xEE40, 0xEE41, 0xEE42, 0xEE43, 0xEE44, 0xEE45, 0xEE46, 0xEE47, 0xEE48,
+    0xEE49, 0xEE4A, 0xEE4B, 0xEE4C, 0xEE4D, 0xEE4E, 0xEE4F, 0xEE50, 0xEE51, 0xEE52, 0xEE53, 0xEE54, 0xEE55, 0xEE56, 0xEE57, 0xEE58,
+    0xEE59, 0xEE5A, 0xEE5B, 0xEE5C, 0xEE5D, 0xEE5E, 0xEE5F, 0xEE60, 0xEE61, 0xEE62, 0xEE63, 0xEE64, 0xEE65, 0xEE66, 0xEE67, 0xEE68,
+    0xEE69, 0xEE6A, 0xEE6B, 0xEE6C, 0xEE6D, 0xEE6E, 0xEE6F, 0xEE70, 0xEE71, 0xEE72, 0xEE73, 0xEE74, 0xEE75, 0xEE76, 0xEE77, 0xEE78,
+    0xEE79, 0xEE7A, 0xEE7B, 0xEE7C, 0xEE7D, 0xEE7E, 0xEE7F, 0xEE80, 0xEE81, 0xEE82, 0xEE83, 0xEE84, 0xEE85, 0xEE86, 0xEE87, 0xEE88,
+    0xEE89, 0xEE8A, 0xEE8B, 0xEE8C, 0xEE8D, 0xEE8E, 0xEE8F, 0xEE90, 0xEE91, 0xEE92, 0xEE93, 0xEE94, 0xEE95, 0xEE96, 0xEE97, 0xEE98,
+    0xEE99, 0xEE9A, 0xEE9B, 0xEE9C, 0xEE9D, 0xEE9E, 0xEE9F, 0xEEA0, 0xEEA1, 0xEEA2, 0xEEA3, 0xEEA4, 0xEEA5, 0xEEA6, 0xEEA7, 0xEEA8,
+    0xEEA9, 0xEEAA, 0xEEAB, 0xEEAC, 0xEEAD, 0xEEAE, 0xEEAF, 0xEEB0, 0xEEB1, 0xEEB2, 0xEEB3, 0xEEB4, 0xEEB5, 0xEEB6, 0xEEB7, 0xEEB8,
+    0xEEB9, 0xEEBA, 0xEEBB, 0xEEBC, 0xEEBD, 0xEEBE, 0xEEBF, 0xEEC0, 0xEEC1, 0xEEC2, 0xEEC3, 0xEEC4, 0xEEC5, 0xEEC6, 0xEEC7, 0xEEC8,
+    0xEEC9, 0xEECA, 0xEECB, 0xEECC, 0xEECD, 0xEECE, 0xEECF, 0xEED0, 0xEED1, 0xEED2, 0xEED3, 0xEED4, 0xEED5, 0xEED6, 0xEED7, 0xFFFF,
+  },
+  { /* lead 0x7D */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEED8, 0xEED9, 0xEEDA, 0xEEDB, 0xEEDC, 0xEEDD, 0xEEDE, 0xEEDF, 0xEEE0, 0xEEE1, 0xEEE2, 0xEEE3, 0xEEE4, 0xEEE5, 0xEEE6,
+    0xEEE7, 0xEEE8, 0xEEE9, 0xEEEA, 0xEEEB, 0xEEEC, 0xEEED, 0xEEEE, 0xEEEF, 0xEEF0, 0xEEF1, 0xEEF2, 0xEEF3, 0xEEF4, 0xEEF5, 0xEEF6,
+    0xEEF7, 0xEEF8, 0xEEF9, 0xEEFA, 0xEEFB, 0xEEFC, 0xEEFD, 0xEEFE, 0xEEFF, 0xEF00, 0xEF01, 0xEF02, 0xEF03, 0xEF04, 0xEF05, 0xEF06,
+    0xEF07, 0xEF08, 0xEF09, 0xEF0A, 0xEF0B, 0xEF0C, 0xEF0D, 0xEF0E, 0xEF0F, 0xEF10, 0xEF11, 0xEF12, 0xEF13, 0xEF14, 0xEF15, 0xEF16,
+    0xEF17, 0xEF18, 0xEF19, 0xEF1A, 0xEF1B, 0xEF1C, 0xEF1D, 0xEF1E, 0xEF1F, 0xEF20, 0xEF21, 0xEF22, 0xEF23, 0xEF24, 0xEF25, 0xEF26,
+    0xEF27, 0xEF28, 0xEF29, 0xEF2A, 0xEF2B, 0xEF2C, 0xEF2D, 0xEF2E, 0xEF2F, 0xEF30, 0xEF31, 0xEF32, 0xEF33, 0xEF34, 0xEF35, 0xEF36,
+    0xEF37, 0xEF38, 0xEF39, 0xEF3A, 0xEF3B, 0xEF3C, 0xEF3D, 0xEF3E, 0xEF3F, 0xEF40, 0xEF41, 0xEF42, 0xEF43, 0xEF44, 0xEF45, 0xEF46,
+    0xEF47, 0xEF48, 0xEF49, 0xEF4A, 0xEF4B, 0xEF4C, 0xEF4D, 0xEF4E, 0xEF4F, 0xEF50, 0xEF51, 0xEF52, 0xEF53, 0xEF54, 0xEF55, 0xEF56,
+    0xEF57, 0xEF58, 0xEF59, 0xEF5A, 0xEF5B, 0xEF5C, 0xEF5D, 0xEF5E, 0xEF5F, 0xEF60, 0xEF61, 0xEF62, 0xEF63, 0xEF64, 0xEF65, 0xEF66,
+    0xEF67, 0xEF68, 0xEF69, 0xEF6A, 0xEF6B, 0xEF6C, 0xEF6D, 0xEF6E, 0xEF6F, 0xEF70, 0xEF71, 0xEF72, 0xEF73, 0xEF74, 0xEF75, 0xEF76,
+    0xEF77, 0xEF78, 0xEF79, 0xEF7A, 0xEF7B, 0xEF7C, 0xEF7D, 0xEF7E, 0xEF7F, 0xEF80, 0xEF81, 0xEF82, 0xEF83, 0xEF84, 0xEF85, 0xEF86,
+    0xEF87, 0xEF88, 0xEF89, 0xEF8A, 0xEF8B, 0xEF8C, 0xEF8D, 0xEF8E, 0xEF8F, 0xEF90, 0xEF91, 0xEF92, 0xEF93, 0xEF94, 0xEF95, 0xFFFF,
+  },
+  { /* lead 0x7E */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEF96, 0xEF97, 0xEF98, 0xEF99, 0xEF9A, 0xEF9B, 0xEF9C, 0xEF9D, 0xEF9E, 0xEF9F, 0xEFA0, 0xEFA1, 0xEFA2, 0xEFA3, 0xEFA4,
+    0xEFA5, 0xEFA6, 0xEFA7, 0xEFA8, 0xEFA9, 0xEFAA, 0xEFAB, 0xEFAC, 0xEFAD, 0xEFAE, 0xEFAF, 0xEFB0, 0xEFB1, 0xEFB2, 0xEFB3, 0xEFB4,
+    0xEFB5, 0xEFB6, 0xEFB7, 0xEFB8, 0xEFB9, 0xEFBA, 0xEFBB, 0xEFBC, 0xEFBD, 0xEFBE, 0xEFBF, 0xEFC0, 0xEFC1, 0xEFC2, 0xEFC3, 0xEFC4,
+    0xEFC5, 0xEFC6, 0xEFC7, 0xEFC8, 0xEFC9, 0xEFCA, 0xEFCB, 0xEFCC, 0xEFCD, 0xEFCE, 0xEFCF, 0xEFD0, 0xEFD1, 0xEFD2, 0xEFD3, 0xEFD4,
+    0xEFD5, 0xEFD6, 0xEFD7, 0xEFD8, 0xEFD9, 0xEFDA, 0xEFDB, 0xEFDC, 0xEFDD, 0xEFDE, 0xEFDF, 0xEFE0, 0xEFE1, 0xEFE2, 0xEFE3, 0xEFE4,
+    0xEFE5, 0xEFE6, 0xEFE7, 0xEFE8, 0xEFE9, 0xEFEA, 0xEFEB, 0xEFEC, 0xEFED, 0xEFEE, 0xEFEF, 0xEFF0, 0xEFF1, 0xEFF2, 0xEFF3, 0xEFF4,
+    0xEFF5, 0xEFF6, 0xEFF7, 0xEFF8, 0xEFF9, 0xEFFA, 0xEFFB, 0xEFFC, 0xEFFD, 0xEFFE, 0xEFFF, 0xF000, 0xF001, 0xF002, 0xF003, 0xF004,
+    0xF005, 0xF006, 0xF007, 0xF008, 0xF009, 0xF00A, 0xF00B, 0xF00C, 0xF00D, 0xF00E, 0xF00F, 0xF010, 0xF011, 0xF012, 0xF013, 0xF014,
+    0xF015, 0xF016, 0xF017, 0xF018, 0xF019, 0xF01A, 0xF01B, 0xF01C, 0xF01D, 0xF01E, 0xF01F, 0xF020, 0xF021, 0xF022, 0xF023, 0xF024,
+    0xF025, 0xF026, 0xF027, 0xF028, 0xF029, 0xF02A, 0xF02B, 0xF02C, 0xF02D, 0xF02E, 0xF02F, 0xF030, 0xF031, 0xF032, 0xF033, 0xF034,
+    0xF035, 0xF036, 0xF037, 0xF038, 0xF039, 0xF03A, 0xF03B, 0xF03C, 0xF03D, 0xF03E, 0xF03F, 0xF040, 0xF041, 0xF042, 0xF043, 0xF044,
+    0xF045, 0xF046, 0xF047, 0xF048, 0xF049, 0xF04A, 0xF04B, 0xF04C, 0xF04D, 0xF04E, 0xF04F, 0xF050, 0xF051, 0xF052, 0xF053, 0xFFFF,
+  },
+  { /* lead 0x7F */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF054, 0xF055, 0xF056, 0xF057, 0xF058, 0xF059, 0xF05A, 0xF05B, 0xF05C, 0xF05D, 0xF05E, 0xF05F, 0xF060, 0xF061, 0xF062,
+    0xF063, 0xF064, 0xF065, 0xF066, 0xF067, 0xF068, 0xF069, 0xF06A, 0xF06B, 0xF06C, 0xF06D, 0xF06E, 0xF06F, 0xF070, 0xF071, 0xF072,
+    0xF073, 0xF074, 0xF075, 0xF076, 0xF077, 0xF078, 0xF079, 0xF07A, 0xF07B, 0xF07C, 0xF07D, 0xF07E, 0xF07F, 0xF080, 0xF081, 0xF082,
+    0xF083, 0xF084, 0xF085, 0xF086, 0xF087, 0xF088, 0xF089, 0xF08A, 0xF08B, 0xF08C, 0xF08D, 0xF08E, 0xF08F, 0xF090, 0xF091, 0xF092,
+    0xF093, 0xF094, 0xF095, 0xF096, 0xF097, 0xF098, 0xF099, 0xF09A, 0xF09B, 0xF09C, 0xF09D, 0xF09E, 0xF09F, 0xF0A0, 0xF0A1, 0xF0A2,
+    0xF0A3, 0xF0A4, 0xF0A5, 0xF0A6, 0xF0A7, 0xF0A8, 0xF0A9, 0xF0AA, 0xF0AB, 0xF0AC, 0xF0AD, 0xF0AE, 0xF0AF, 0xF0B0, 0xF0B1, 0xF0B2,
+    0xF0B3, 0xF0B4, 0xF0B5, 0xF0B6, 0xF0B7, 0xF0B8, 0xF0B9, 0xF0BA, 0xF0BB, 0xF0BC, 0xF0BD, 0xF0BE, 0xF0BF, 0xF0C0, 0xF0C1, 0xF0C2,
+    0xF0C3, 0xF0C4, 0xF0C5, 0xF0C6, 0xF0C7, 0xF0C8, 0xF0C9, 0xF0CA, 0xF0CB, 0xF0CC, 0xF0CD, 0xF0CE, 0xF0CF, 0xF0D0, 0xF0D1, 0xF0D2,
+    0xF0D3, 0xF0D4, 0xF0D5, 0xF0D6, 0xF0D7, 0xF0D8, 0xF0D9, 0xF0DA, 0xF0DB, 0xF0DC, 0xF0DD, 0xF0DE, 0xF0DF, 0xF0E0, 0xF0E1, 0xF0E2,
+    0xF0E3, 0xF0E4, 0xF0E5, 0xF0E6, 0xF0E7, 0xF0E8, 0xF0E9, 0xF0EA, 0xF0EB, 0xF0EC, 0xF0ED, 0xF0EE, 0xF0EF, 0xF0F0, 0xF0F1, 0xF0F2,
+    0xF0F3, 0xF0F4, 0xF0F5, 0xF0F6, 0xF0F7, 0xF0F8, 0xF0F9, 0xF0FA, 0xF0FB, 0xF0FC, 0xF0FD, 0xF0FE, 0xF0FF, 0xF100, 0xF101, 0xF102,
+    0xF103, 0xF104, 0xF105, 0xF106, 0xF107, 0xF108, 0xF109, 0xF10A, 0xF10B, 0xF10C, 0xF10D, 0xF10E, 0xF10F, 0xF110, 0xF111, 0xFFFF,
+  },
+};
+
+CP_TABLE_CONST uint8_t IBM930_U2CP_PAGE[256] = {
+    1,   0,   0,   2,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    4,   5,   6,   7,   0,   8,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+   10,   0,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,  13,
+   14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+   30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,
+   46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,
+   62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,
+   78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+   94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+  110, 111,   0,   0,   0,   0,   0,   0,   0, 112, 113,   0,   0,   0,   0, 114,
+};
+
+CP_TABLE_CONST uint16_t IBM930_U2CP[115][256] = {
+  { /* unmapped */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+00xx */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0037, 0x002D, 0x002E, 0x002F, 0x0016, 0x0005, 0x0025, 0x000B, 0x000C, 0x000D, 0xFFFF, 0xFFFF,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x003C, 0x003D, 0x0032, 0x0026, 0x0018, 0x0019, 0x003F, 0x0027, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0040, 0x005A, 0x007F, 0x007B, 0x00E0, 0x006C, 0x0050, 0x007D, 0x004D, 0x005D, 0x005C, 0x004E, 0x006B, 0x0060, 0x004B, 0x0061,
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x007A, 0x005E, 0x004C, 0x007E, 0x006E, 0x006F,
+    0x007C, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6,
+    0x00D7, 0x00D8, 0x00D9, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x0070, 0x00B2, 0x0080, 0x00B0, 0x006D,
+    0x0079, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077,
+    0x0078, 0x008B, 0x009B, 0x00AB, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00C0, 0x004F, 0x00D0, 0x00A0, 0x0007,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0015, 0x0006, 0x0017, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x0009, 0x000A, 0x001B,
+    0x0030, 0x0031, 0x001A, 0x0033, 0x0034, 0x0035, 0x0036, 0x0008, 0x0038, 0x0039, 0x003A, 0x003B, 0x0004, 0x0014, 0x003E, 0x00FF,
+    0xFFFF, 0xFFFF, 0x00B1, 0x004A, 0xFFFF, 0x005B, 0x426A, 0x446A, 0x4460, 0xFFFF, 0xFFFF, 0xFFFF, 0x005F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x44ED, 0x444B, 0xFFFF, 0xFFFF, 0x4450, 0xFFFF, 0x4379, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x447A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x447B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+03xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4161, 0x4162, 0x4163, 0x4164, 0x4165, 0x4166, 0x4167, 0x4168, 0x4169, 0x416A, 0x416B, 0x416C, 0x416D, 0x416E, 0x416F,
+    0x4170, 0x4171, 0xFFFF, 0x4172, 0x4173, 0x4174, 0x4175, 0x4176, 0x4177, 0x4178, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4141, 0x4142, 0x4143, 0x4144, 0x4145, 0x4146, 0x4147, 0x4148, 0x4149, 0x414A, 0x414B, 0x414C, 0x414D, 0x414E, 0x414F,
+    0x4150, 0x4151, 0xFFFF, 0x4152, 0x4153, 0x4154, 0x4155, 0x4156, 0x4157, 0x4158, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+04xx */
+    0xFFFF, 0x41C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x41C0, 0x41C1, 0x41C2, 0x41C3, 0x41C4, 0x41C5, 0x41C7, 0x41C8, 0x41C9, 0x41CA, 0x41CB, 0x41CC, 0x41CD, 0x41CE, 0x41CF, 0x41D0,
+    0x41D1, 0x41D2, 0x41D3, 0x41D4, 0x41D5, 0x41D6, 0x41D7, 0x41D8, 0x41D9, 0x41DA, 0x41DB, 0x41DC, 0x41DD, 0x41DE, 0x41DF, 0x41E0,
+    0x4180, 0x4181, 0x4182, 0x4183, 0x4184, 0x4185, 0x4187, 0x4188, 0x4189, 0x418A, 0x418B, 0x418C, 0x418D, 0x418E, 0x418F, 0x4190,
+    0x4191, 0x4192, 0x4193, 0x4194, 0x4195, 0x4196, 0x4197, 0x4198, 0x4199, 0x419A, 0x419B, 0x419C, 0x419D, 0x419E, 0x419F, 0x41A0,
+    0xFFFF, 0x4186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+20xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x445A, 0xFFFF, 0xFFFF, 0xFFFF, 0x444A, 0xFFFF, 0x447C, 0xFFFF, 0x4461, 0x4471, 0xFFFF, 0xFFFF, 0x4462, 0x4472, 0xFFFF, 0xFFFF,
+    0x4377, 0x4378, 0xFFFF, 0xFFFF, 0xFFFF, 0x447E, 0x447F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4373, 0xFFFF, 0x44EE, 0x44EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x446B, 0xFFFF, 0xFFFF, 0x00A1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+21xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x444E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x446E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x446F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4372, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x41F1, 0x41F2, 0x41F3, 0x41F4, 0x41F5, 0x41F6, 0x41F7, 0x41F8, 0x41F9, 0x41FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x41B1, 0x41B2, 0x41B3, 0x41B4, 0x41B5, 0x41B6, 0x41B7, 0x41B8, 0x41B9, 0x41BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x44F1, 0x44F2, 0x44F0, 0x44F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x436E, 0xFFFF, 0x436F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+22xx */
+    0x4370, 0xFFFF, 0x434E, 0x4371, 0xFFFF, 0xFFFF, 0xFFFF, 0x434F, 0x4364, 0xFFFF, 0xFFFF, 0x4365, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4260, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x435F, 0xFFFF, 0xFFFF, 0x4361, 0x444D, 0xFFFF,
+    0x434B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x436C, 0x436D, 0x436B, 0x436A, 0x4362, 0x4363, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4468, 0x4478, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4360, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x435C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x444C, 0x435B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4467, 0x4477, 0xFFFF, 0xFFFF, 0x435D, 0x435E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4368, 0x4369, 0xFFFF, 0xFFFF, 0x4366, 0x4367, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x434C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+23xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x434D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+25xx */
+    0x437C, 0x43B7, 0x437D, 0x43B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x437E, 0xFFFF, 0xFFFF, 0x43B9,
+    0x437F, 0xFFFF, 0xFFFF, 0x43E1, 0x43B1, 0xFFFF, 0xFFFF, 0x43E3, 0x43B0, 0xFFFF, 0xFFFF, 0x43E2, 0x43B2, 0x43EE, 0xFFFF, 0xFFFF,
+    0x43E9, 0xFFFF, 0xFFFF, 0x43E4, 0x43B4, 0x43F0, 0xFFFF, 0xFFFF, 0x43EB, 0xFFFF, 0xFFFF, 0x43E6, 0x43B3, 0xFFFF, 0xFFFF, 0x43EA,
+    0x43EF, 0xFFFF, 0xFFFF, 0x43E5, 0x43B5, 0xFFFF, 0xFFFF, 0x43EC, 0x43F1, 0xFFFF, 0xFFFF, 0x43E7, 0x43B6, 0xFFFF, 0xFFFF, 0x43ED,
+    0xFFFF, 0xFFFF, 0x43F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x43E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x44EA, 0x44E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x44E3, 0x44E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x44EC, 0x44EB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x44E8, 0x44E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x44E0, 0xFFFF, 0xFFFF, 0x44E4, 0x44E1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x437A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+26xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x44E6, 0x44E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4479, 0xFFFF, 0x4469, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4376, 0xFFFF, 0xFFFF, 0x4375, 0xFFFF, 0x4374,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+30xx */
+    0x4040, 0x4344, 0x4341, 0x445B, 0xFFFF, 0x445D, 0x445E, 0x445F, 0x4464, 0x4474, 0x4465, 0x4475, 0x4342, 0x4343, 0x4442, 0x4443,
+    0x4466, 0x4476, 0x446C, 0x447D, 0x4463, 0x4473, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x43A1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4447, 0x4481, 0x4448, 0x4482, 0x4449, 0x4483, 0x4451, 0x4484, 0x4452, 0x4485, 0x4486, 0x44C0, 0x4487, 0x44C1, 0x4488,
+    0x44C2, 0x4489, 0x44C3, 0x448A, 0x44C4, 0x448C, 0x44C5, 0x448D, 0x44C6, 0x448E, 0x44C7, 0x448F, 0x44C8, 0x4490, 0x44C9, 0x4491,
+    0x44CA, 0x4492, 0x44CB, 0x4456, 0x4493, 0x44CC, 0x4494, 0x44CD, 0x4495, 0x44CE, 0x4496, 0x4497, 0x4498, 0x4499, 0x449A, 0x449D,
+    0x44CF, 0x44D5, 0x449E, 0x44D0, 0x44D6, 0x449F, 0x44D1, 0x44D7, 0x44A2, 0x44D2, 0x44D8, 0x44A3, 0x44D3, 0x44D9, 0x44A4, 0x44A5,
+    0x44A6, 0x44A7, 0x44A8, 0x4453, 0x44A9, 0x4454, 0x44AA, 0x4455, 0x44AC, 0x44AD, 0x44AE, 0x44AF, 0x44BA, 0x44BB, 0x4457, 0x44BC,
+    0x44DA, 0x44DB, 0x4446, 0x44BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x43BE, 0x43BF, 0x44DC, 0x44DD, 0xFFFF,
+    0xFFFF, 0x4347, 0x4381, 0x4348, 0x4382, 0x4349, 0x4383, 0x4351, 0x4384, 0x4352, 0x4385, 0x4386, 0x43C0, 0x4387, 0x43C1, 0x4388,
+    0x43C2, 0x4389, 0x43C3, 0x438A, 0x43C4, 0x438C, 0x43C5, 0x438D, 0x43C6, 0x438E, 0x43C7, 0x438F, 0x43C8, 0x4390, 0x43C9, 0x4391,
+    0x43CA, 0x4392, 0x43CB, 0x4356, 0x4393, 0x43CC, 0x4394, 0x43CD, 0x4395, 0x43CE, 0x4396, 0x4397, 0x4398, 0x4399, 0x439A, 0x439D,
+    0x43CF, 0x43D5, 0x439E, 0x43D0, 0x43D6, 0x439F, 0x43D1, 0x43D7, 0x43A2, 0x43D2, 0x43D8, 0x43A3, 0x43D3, 0x43D9, 0x43A4, 0x43A5,
+    0x43A6, 0x43A7, 0x43A8, 0x4353, 0x43A9, 0x4354, 0x43AA, 0x4355, 0x43AC, 0x43AD, 0x43AE, 0x43AF, 0x43BA, 0x43BB, 0x4357, 0x43BC,
+    0x43DA, 0x43DB, 0x4346, 0x43BD, 0x43D4, 0x4359, 0x435A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4345, 0x4358, 0x43DC, 0x43DD, 0xFFFF,
+  },
+  { /* U+32xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x446D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Exx */
+    0x4541, 0x4BCE, 0xFFFF, 0x4547, 0xFFFF, 0xFFFF, 0xFFFF, 0x454D, 0x49D3, 0x4543, 0x455E, 0x455F, 0xFFFF, 0x46AF, 0x4789, 0xFFFF,
+    0x5642, 0x4DEC, 0xFFFF, 0xFFFF, 0x4F97, 0x5643, 0x469B, 0x5775, 0x4D56, 0x50C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F62, 0xFFFF,
+    0xFFFF, 0x4883, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x487C, 0xFFFF, 0x5644, 0xFFFF, 0x5645, 0xFFFF, 0xFFFF, 0x455C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5646, 0x4CB8, 0xFFFF, 0xFFFF, 0xFFFF, 0x5647, 0xFFFF, 0x467A, 0x48AB, 0xFFFF, 0x4762, 0x54C8, 0xFFFF, 0xFFFF, 0x5648,
+    0xFFFF, 0xFFFF, 0x5649, 0x4B9F, 0xFFFF, 0x458A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45D8, 0xFFFF, 0x55A9, 0x54A5, 0x4F6C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62D0, 0x564A, 0x4947, 0x564B, 0x4BBD, 0xFFFF, 0xFFFF, 0xFFFF, 0x4549, 0x4EB5, 0x4749,
+    0xFFFF, 0xFFFF, 0x564C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4BBF, 0xFFFF, 0x4A98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4970, 0xFFFF,
+    0x47C0, 0xFFFF, 0x564D, 0xFFFF, 0xFFFF, 0x564E, 0x4BB1, 0xFFFF, 0x47C2, 0x4896, 0x564F, 0x45CE, 0x4542, 0xFFFF, 0x5650, 0xFFFF,
+    0xFFFF, 0x499D, 0x4B74, 0xFFFF, 0x4545, 0x456D, 0xFFFF, 0xFFFF, 0x4BE4, 0x50E8, 0xFFFF, 0x55DC, 0x4867, 0xFFFF, 0x5652, 0x5167,
+    0x5653, 0x4CCE, 0x5654, 0xFFFF, 0x478E, 0x4F7F, 0x4FFA, 0xFFFF, 0x4BAC, 0xFFFF, 0xFFFF, 0x4B73, 0x4575, 0x4E52, 0x499C, 0xFFFF,
+    0x5655, 0xFFFF, 0xFFFF, 0x5656, 0xFFFF, 0xFFFF, 0x5657, 0xFFFF, 0xFFFF, 0xFFFF, 0x4593, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x53D9, 0x4776, 0x565C, 0xFFFF, 0x565A, 0xFFFF, 0x565B, 0x5085, 0xFFFF, 0xFFFF, 0x45E0, 0x484B, 0xFFFF, 0x5659, 0x5658, 0x4BE5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5465, 0x48B5, 0x4755, 0x565E, 0x475D, 0x48A2, 0xFFFF, 0xFFFF, 0xFFFF, 0x445C, 0x565F, 0x5661,
+    0xFFFF, 0x565D, 0xFFFF, 0x459A, 0x49C3, 0x46F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5660, 0x4D71, 0xFFFF,
+    0x4DED, 0xFFFF, 0x4869, 0xFFFF, 0xFFFF, 0xFFFF, 0x48B2, 0x5341, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A55, 0x5662, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Fxx */
+    0x5665, 0x47D2, 0xFFFF, 0x5666, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5663, 0x45B2, 0xFFFF, 0xFFFF, 0x4D99, 0x4E9F, 0x4A83,
+    0x50F6, 0x4A81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45BD, 0xFFFF, 0x5664, 0x48D9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49A6,
+    0x5668, 0xFFFF, 0xFFFF, 0xFFFF, 0x49C9, 0xFFFF, 0x544A, 0xFFFF, 0x46F4, 0x566A, 0x508A, 0xFFFF, 0x4BBC, 0x5461, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4EDF, 0xFFFF, 0xFFFF, 0x4EFE, 0x566C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47C8, 0x48A4, 0x46E0,
+    0x4576, 0x4CE6, 0xFFFF, 0x4696, 0xFFFF, 0x4770, 0x566E, 0x566B, 0xFFFF, 0x49C1, 0x5667, 0x566F, 0x4594, 0x5669, 0x566D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5679, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x567C,
+    0x567A, 0xFFFF, 0xFFFF, 0x4876, 0xFFFF, 0x4B94, 0x51E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5677, 0x5462, 0xFFFF, 0xFFFF, 0x48B6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4F98, 0xFFFF, 0xFFFF, 0x567D, 0xFFFF, 0x5672, 0xFFFF, 0x5671, 0x4A46, 0xFFFF, 0x4FC2, 0xFFFF, 0x5673,
+    0xFFFF, 0x4F8D, 0x5670, 0xFFFF, 0x567B, 0xFFFF, 0x567E, 0xFFFF, 0x5676, 0xFFFF, 0x5674, 0x48BC, 0xFFFF, 0x4A9E, 0xFFFF, 0xFFFF,
+    0x52EC, 0x475A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5678, 0xFFFF, 0x5675, 0x53B9, 0x53E3,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F8C, 0x557C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B4C,
+    0xFFFF, 0xFFFF, 0x4851, 0x4A6A, 0x54C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5294, 0x4660, 0xFFFF, 0xFFFF, 0x5686, 0x5680, 0xFFFF,
+    0x5685, 0x5683, 0xFFFF, 0xFFFF, 0x567F, 0xFFFF, 0xFFFF, 0x4E97, 0x5681, 0xFFFF, 0x5684, 0x5682, 0xFFFF, 0x45AA, 0xFFFF, 0x53C4,
+    0xFFFF, 0x45A5, 0xFFFF, 0x4B4A, 0x5687, 0x5688, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46DE, 0x5696,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4CE1, 0xFFFF, 0x4DB1, 0x51F8, 0xFFFF, 0x50F9, 0xFFFF, 0x4E67, 0xFFFF, 0xFFFF, 0xFFFF, 0x5695, 0x5694,
+  },
+  { /* U+50xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x568F, 0x5699, 0xFFFF, 0xFFFF, 0x45D6, 0xFFFF, 0x49FA, 0xFFFF, 0x4AC4, 0xFFFF, 0x56A1,
+    0xFFFF, 0x5697, 0x4B6A, 0xFFFF, 0x568C, 0xFFFF, 0x5343, 0xFFFF, 0xFFFF, 0x4CAE, 0x5689, 0xFFFF, 0xFFFF, 0xFFFF, 0x5698, 0x4AD0,
+    0xFFFF, 0x5690, 0x5691, 0x5569, 0x487D, 0x568E, 0x52F1, 0xFFFF, 0x568B, 0x5692, 0x568D, 0x4D51, 0x5693, 0x4FF9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F63, 0xFFFF, 0xFFFF, 0x52FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x568A, 0xFFFF, 0x56A4, 0x569A, 0xFFFF, 0xFFFF, 0x56A2, 0x569B, 0x569E, 0x4DFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5049,
+    0x569D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x569C, 0x56A0, 0xFFFF, 0xFFFF, 0xFFFF, 0x569F, 0xFFFF, 0x4E70, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4681, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56A5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x56A3, 0xFFFF, 0x54D2, 0xFFFF, 0x4943, 0x4F95, 0x50C3, 0xFFFF, 0x56A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5059, 0xFFFF, 0xFFFF,
+    0x56A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EE7, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4FC3, 0xFFFF, 0xFFFF, 0x56A8, 0xFFFF, 0xFFFF, 0xFFFF, 0x509C, 0x46AC, 0x56A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C43, 0x54DA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x56AD, 0x56B0, 0x56AB, 0x4B58, 0xFFFF, 0x4C5B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A43, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x56B1, 0xFFFF, 0xFFFF, 0x4FC9, 0xFFFF, 0xFFFF, 0xFFFF, 0x56AE, 0x56AF, 0xFFFF, 0xFFFF, 0x48EC, 0xFFFF, 0x4BBA,
+    0xFFFF, 0x55AD, 0xFFFF, 0xFFFF, 0xFFFF, 0x4ABB, 0x52D4, 0xFFFF, 0x56B5, 0xFFFF, 0x4D82, 0xFFFF, 0xFFFF, 0xFFFF, 0x56B3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x56B7, 0xFFFF, 0x56B4, 0xFFFF, 0x4E84, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56B6, 0x56B8, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56B2, 0x56BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x56B9, 0xFFFF, 0x5578, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+51xx */
+    0x49CA, 0x56BC, 0x56BD, 0xFFFF, 0x454E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x546F, 0xFFFF, 0x56C0, 0x56BF, 0x56C1, 0xFFFF, 0x5290, 0xFFFF, 0x56BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AA2,
+    0xFFFF, 0x56C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x54BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56C4, 0xFFFF, 0xFFFF, 0x56C3, 0x56C6, 0x56C5, 0xFFFF, 0xFFFF, 0x56C7,
+    0x56C8, 0x4C91, 0xFFFF, 0x4695, 0x4BE8, 0x48C9, 0x4DF3, 0x555A, 0x47A2, 0x459E, 0x56C9, 0x479E, 0x56CA, 0x4B56, 0x5050, 0xFFFF,
+    0x469F, 0xFFFF, 0x56CB, 0xFFFF, 0x56CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x494B, 0xFFFF, 0x51BE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x56CD, 0xFFFF, 0x56CE, 0x4665, 0xFFFF, 0xFFFF, 0x46B1, 0x56CF, 0x56D0, 0x4548, 0x46BB, 0x4546, 0x56D1, 0xFFFF,
+    0xFFFF, 0x47B3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4649, 0x4F67, 0x47AF, 0x47C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x48F4, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x56D2, 0xFFFF, 0x56D3, 0xFFFF, 0xFFFF, 0x458E, 0x4645, 0xFFFF, 0xFFFF, 0x56D6, 0x4EA1, 0xFFFF, 0x56D5, 0x48EB, 0xFFFF, 0x56D7,
+    0x619D, 0x56D8, 0x4F8F, 0x56D9, 0xFFFF, 0x56DA, 0x56DB, 0x527E, 0xFFFF, 0x48C4, 0xFFFF, 0xFFFF, 0xFFFF, 0x56DC, 0xFFFF, 0xFFFF,
+    0x4E7B, 0xFFFF, 0x56DF, 0xFFFF, 0x56DD, 0x5467, 0x56DE, 0xFFFF, 0x4878, 0x56E0, 0x56E1, 0x56E2, 0x4BDE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x56E6, 0x56E4, 0x56E5, 0x56E3, 0x50C9, 0x56E7, 0x5146, 0x48FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56E9, 0x56E8, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52DC, 0x56EA, 0x4F80, 0xFFFF, 0xFFFF, 0x56EB, 0xFFFF, 0x55F9, 0x5344, 0x4BE6, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5777, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56EC, 0x6884, 0x4ED9, 0xFFFF, 0xFFFF,
+    0x56ED, 0x4DE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48E6, 0x558A, 0xFFFF, 0x56EE, 0x549E, 0xFFFF, 0x56EF, 0x56F0, 0xFFFF, 0xFFFF,
+    0x56F1, 0x51AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x56F2, 0x51EC, 0xFFFF, 0x50CF, 0x50E6, 0x459B, 0xFFFF, 0xFFFF, 0x4BB6, 0x56F3, 0xFFFF,
+  },
+  { /* U+52xx */
+    0x4C50, 0xFFFF, 0xFFFF, 0x4F44, 0x56F4, 0xFFFF, 0x45B4, 0x4765, 0x4B9B, 0xFFFF, 0x4CD7, 0x56F5, 0xFFFF, 0xFFFF, 0x54E3, 0xFFFF,
+    0xFFFF, 0x4C52, 0xFFFF, 0xFFFF, 0x56F6, 0x56F7, 0xFFFF, 0x4BB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x474B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x495C, 0x46DD, 0xFFFF, 0x56F8, 0xFFFF, 0x45BC, 0x56F9, 0xFFFF, 0xFFFF, 0xFFFF, 0x56FA, 0xFFFF,
+    0x4CDD, 0xFFFF, 0xFFFF, 0x56FB, 0xFFFF, 0xFFFF, 0x46C4, 0x48CF, 0x4B6B, 0x56FC, 0x4BC0, 0x4BF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5379, 0x56FD, 0xFFFF, 0xFFFF, 0x474D, 0xFFFF, 0xFFFF, 0x4A90, 0x56FE, 0x51AE, 0x45AF, 0xFFFF, 0x5741,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5743, 0xFFFF, 0x5199, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49C7, 0xFFFF, 0xFFFF, 0x5742, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4CD3, 0x4766, 0x5481, 0xFFFF, 0xFFFF, 0xFFFF, 0x5748, 0x5745, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B4E,
+    0x4D85, 0x5744, 0x47D6, 0x5746, 0x5747, 0x4BE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x574A, 0xFFFF, 0x5749,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x55D6, 0xFFFF, 0xFFFF, 0xFFFF, 0x49F0, 0x574C, 0x5185, 0xFFFF, 0xFFFF, 0xFFFF, 0x574B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x574E, 0x574D, 0xFFFF, 0x5580, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45F7, 0x574F, 0xFFFF, 0xFFFF, 0x4870,
+    0x459F, 0xFFFF, 0xFFFF, 0x4E68, 0xFFFF, 0xFFFF, 0x5750, 0xFFFF, 0xFFFF, 0x4671, 0x4A64, 0x54C6, 0x5751, 0x5752, 0xFFFF, 0x5FAA,
+    0xFFFF, 0x4D92, 0xFFFF, 0xFFFF, 0x48A9, 0x5754, 0xFFFF, 0xFFFF, 0xFFFF, 0x4978, 0xFFFF, 0xFFFF, 0x5753, 0xFFFF, 0x556A, 0xFFFF,
+    0x5756, 0x5755, 0xFFFF, 0x54B1, 0xFFFF, 0x4EEF, 0xFFFF, 0x469C, 0xFFFF, 0x48CE, 0xFFFF, 0xFFFF, 0xFFFF, 0x5757, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x53D6, 0xFFFF, 0xFFFF, 0x45E4, 0xFFFF, 0x5392, 0x4B9A, 0x46ED, 0xFFFF, 0x5758, 0xFFFF, 0x45B5, 0x5759, 0x4AE1,
+    0x575C, 0xFFFF, 0x47EE, 0x575A, 0x499F, 0xFFFF, 0x575B, 0x4C7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x497A, 0x575D, 0xFFFF, 0x575E, 0xFFFF, 0xFFFF, 0x575F, 0x5760, 0x5470, 0xFFFF, 0xFFFF, 0xFFFF, 0x51E9, 0x5297,
+  },
+  { /* U+53xx */
+    0x5761, 0x4F5B, 0x4ECB, 0xFFFF, 0xFFFF, 0x4AA8, 0x5762, 0x5763, 0x5764, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5766, 0xFFFF, 0x5768,
+    0x5767, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5769, 0x4590, 0x455A, 0xFFFF, 0x5457, 0x576A, 0xFFFF, 0xFFFF, 0x51B7, 0xFFFF, 0xFFFF,
+    0x4E6B, 0x4D4D, 0xFFFF, 0x576C, 0x576B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x576D,
+    0xFFFF, 0x576E, 0xFFFF, 0x576F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5770, 0x4FD1, 0x4554, 0x4A87, 0xFFFF, 0xFFFF, 0xFFFF, 0x50F1,
+    0x5771, 0x454A, 0xFFFF, 0x454C, 0xFFFF, 0x5772, 0x5773, 0x4E47, 0x45DF, 0x5774, 0x4790, 0xFFFF, 0xFFFF, 0x5776, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x53AD, 0x4AF2, 0x4996, 0x47D7, 0xFFFF, 0xFFFF, 0x4559, 0x48E3, 0xFFFF, 0x45F6, 0xFFFF, 0x51C0, 0xFFFF, 0x5779, 0xFFFF,
+    0x49EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53DB, 0xFFFF, 0xFFFF, 0x577A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x577B, 0x4C82,
+    0x4799, 0x4B91, 0x577C, 0x4B6D, 0x4AA4, 0x4CF5, 0xFFFF, 0x577D, 0x4E79, 0xFFFF, 0xFFFF, 0x577E, 0xFFFF, 0xFFFF, 0xFFFF, 0x53E2,
+    0xFFFF, 0xFFFF, 0x577F, 0xFFFF, 0x5352, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5780, 0xFFFF, 0xFFFF, 0x5781, 0xFFFF, 0x4F55, 0xFFFF, 0x4942, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4574,
+    0x5782, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5784, 0x5783, 0xFFFF, 0x5178, 0x5367, 0xFFFF, 0xFFFF, 0xFFFF, 0x53B7, 0x5785, 0xFFFF,
+    0x5786, 0xFFFF, 0x5787, 0x4C8E, 0xFFFF, 0xFFFF, 0x5788, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4ACA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x48D2, 0x5789, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48F5, 0x50A5, 0x485C, 0x46D4, 0x4B71, 0x47F9, 0x4791, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA5, 0xFFFF, 0x46A6, 0x484C, 0xFFFF, 0x50F5, 0xFFFF, 0x55B2, 0xFFFF, 0x578B, 0xFFFF, 0x578C,
+    0xFFFF, 0x5194, 0x53F5, 0x4588, 0x45D4, 0x4C8B, 0xFFFF, 0xFFFF, 0x5791, 0x4F71, 0x4E41, 0x4DD5, 0x4F86, 0x5792, 0x5790, 0x47C6,
+    0x4778, 0x5042, 0x47D9, 0x485A, 0xFFFF, 0xFFFF, 0x4F59, 0x48E2, 0x45F0, 0xFFFF, 0x5793, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+54xx */
+    0xFFFF, 0x5794, 0xFFFF, 0x55EA, 0x47BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x45A0, 0x457E, 0x53D3, 0x55BC, 0x466D, 0x45F3, 0x51AF, 0x50C6,
+    0x4EB2, 0x46A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47CF, 0xFFFF, 0x579D, 0xFFFF, 0x507A,
+    0x53E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C4F, 0xFFFF, 0xFFFF, 0x579C, 0xFFFF, 0x49CB, 0x5797, 0x5798, 0x579A, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x579B, 0xFFFF, 0x4B98, 0x49C4, 0xFFFF, 0x53E5, 0x5799, 0x5795, 0x47F6, 0xFFFF,
+    0x5796, 0xFFFF, 0x4B50, 0xFFFF, 0xFFFF, 0xFFFF, 0x5073, 0xFFFF, 0x4F56, 0x4AEE, 0x4954, 0xFFFF, 0xFFFF, 0xFFFF, 0x579E, 0xFFFF,
+    0xFFFF, 0x50B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57A2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48A1, 0xFFFF, 0x548D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x57A5, 0x57A3, 0xFFFF, 0x477F, 0xFFFF, 0x57A0, 0x57AA, 0x57A4, 0xFFFF, 0xFFFF, 0xFFFF, 0x57A7, 0x4AF6, 0x49B0, 0xFFFF, 0xFFFF,
+    0x57A8, 0xFFFF, 0xFFFF, 0xFFFF, 0x57AB, 0xFFFF, 0x57AD, 0xFFFF, 0xFFFF, 0xFFFF, 0x57AE, 0x4F50, 0x457A, 0xFFFF, 0x57A1, 0x579F,
+    0x57AC, 0xFFFF, 0x57A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57A9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x57B2, 0xFFFF, 0x57BC, 0x57B4, 0xFFFF, 0xFFFF, 0x57B9, 0x57BD, 0xFFFF, 0x57BA, 0x57B5, 0xFFFF, 0xFFFF, 0x57B1,
+    0xFFFF, 0xFFFF, 0x4CDE, 0x53E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57B3, 0xFFFF, 0xFFFF, 0xFFFF, 0x57B0, 0x52B1, 0x57BE, 0xFFFF,
+    0x4EF9, 0x45D0, 0x57BB, 0xFFFF, 0x57B6, 0xFFFF, 0xFFFF, 0x57AF, 0x57B8, 0x4A6B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x46CB, 0x57C7, 0xFFFF, 0xFFFF, 0x57BF, 0x57C1, 0xFFFF, 0x5568, 0x55F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x57C6, 0x57C5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4747, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x547C, 0xFFFF, 0xFFFF, 0x57C4, 0xFFFF, 0x57C0,
+  },
+  { /* U+55xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CDB, 0xFFFF, 0x51B8, 0x4F76, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57C2,
+    0x4BAB, 0xFFFF, 0xFFFF, 0xFFFF, 0x57C3, 0xFFFF, 0x54D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57CC, 0x4BE0,
+    0xFFFF, 0x4D43, 0xFFFF, 0x57D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57D1, 0x57C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5478, 0xFFFF,
+    0x57C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5383, 0x57CE, 0x46BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57CB, 0xFFFF, 0xFFFF, 0x46E4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x47E4, 0xFFFF, 0xFFFF, 0x57CF, 0x57D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57CD, 0x57D3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x57CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57D8, 0x57DD, 0xFFFF, 0x57D9, 0xFFFF,
+    0x57D5, 0xFFFF, 0xFFFF, 0x57DF, 0x46B3, 0xFFFF, 0x57DE, 0x57E1, 0xFFFF, 0x5253, 0x57D6, 0x5558, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57DA, 0x57D4, 0x52B5, 0xFFFF, 0x45D1, 0x5475, 0x57DB, 0x57D7,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FD3, 0x57E2, 0x57E0, 0x5168, 0x4D6D, 0x4C5F, 0xFFFF, 0x57DC, 0xFFFF,
+    0x4EB9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57E5, 0x57E3, 0xFFFF, 0x5858, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52A2, 0xFFFF, 0x57E6, 0xFFFF, 0xFFFF, 0x57E4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4B5E, 0x57E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57EB, 0xFFFF, 0x57E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x57EE, 0x57ED, 0xFFFF,
+  },
+  { /* U+56xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5063, 0xFFFF, 0xFFFF, 0x477E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57EA, 0xFFFF, 0x57EC, 0x54EC, 0x50F3, 0xFFFF, 0xFFFF, 0x57EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57F8,
+    0xFFFF, 0x50CA, 0x57F3, 0xFFFF, 0x547F, 0xFFFF, 0x57F2, 0xFFFF, 0x57F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x529B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5062, 0xFFFF, 0x57F0, 0xFFFF,
+    0x57F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x547D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x45FC, 0xFFFF, 0x57FA, 0x57F5, 0x57F9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E6D, 0xFFFF, 0xFFFF, 0xFFFF, 0x55F1, 0xFFFF, 0x5582, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x57FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57F7, 0x55D8, 0xFFFF, 0xFFFF, 0x5841, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57FD,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5842, 0xFFFF, 0x5190, 0xFFFF, 0xFFFF, 0x5843, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5844, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5846, 0xFFFF, 0x5845, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5849, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x584C, 0x584A, 0x5848, 0x584B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5847, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x584D, 0xFFFF,
+    0xFFFF, 0x584F, 0xFFFF, 0x584E, 0xFFFF, 0xFFFF, 0xFFFF, 0x5850, 0x56D4, 0xFFFF, 0x5065, 0x4544, 0xFFFF, 0xFFFF, 0x46A9, 0xFFFF,
+    0x4A49, 0xFFFF, 0xFFFF, 0x47F0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5851, 0xFFFF,
+    0x4B44, 0xFFFF, 0x4AFA, 0x47C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5852, 0x4A94, 0xFFFF, 0xFFFF, 0x458F, 0xFFFF, 0x5853,
+  },
+  { /* U+57xx */
+    0x5266, 0xFFFF, 0xFFFF, 0x53CF, 0x5854, 0xFFFF, 0xFFFF, 0xFFFF, 0x5856, 0x5855, 0xFFFF, 0x51BD, 0xFFFF, 0x5857, 0xFFFF, 0x4F49,
+    0xFFFF, 0xFFFF, 0x47E1, 0x54E7, 0xFFFF, 0xFFFF, 0x585A, 0xFFFF, 0x5859, 0xFFFF, 0xFFFF, 0xFFFF, 0x585B, 0xFFFF, 0xFFFF, 0x4684,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x585C, 0x4782, 0x47CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49E6, 0xFFFF, 0xFFFF,
+    0x45C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D1, 0x585D, 0xFFFF, 0xFFFF, 0x585F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5861, 0xFFFF, 0x45EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49AE, 0xFFFF, 0xFFFF, 0x4C55, 0xFFFF, 0xFFFF, 0xFFFF, 0x585E, 0x5862,
+    0x4E8D, 0x4EF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5860, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5865, 0xFFFF, 0xFFFF, 0x53A6, 0x5863, 0x51C4, 0xFFFF, 0xFFFF, 0x5398, 0x4949, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5866,
+    0xFFFF, 0xFFFF, 0x4BC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5864, 0x5867, 0xFFFF, 0x46E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5868, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5869, 0xFFFF, 0x5466, 0x47CE, 0x586A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x586D, 0xFFFF, 0x586C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x53CD, 0xFFFF, 0xFFFF, 0x586B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5871, 0xFFFF, 0xFFFF, 0x586E, 0xFFFF, 0xFFFF, 0x586F, 0x5873, 0x5870, 0xFFFF, 0xFFFF, 0x4EAC, 0xFFFF, 0xFFFF, 0x45DB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5874, 0x5875, 0x5872, 0xFFFF, 0x5876, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DF4, 0xFFFF, 0xFFFF, 0x48E9,
+    0x517E, 0xFFFF, 0xFFFF, 0x5879, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F48, 0xFFFF, 0xFFFF, 0x4D57, 0xFFFF, 0x4DAC, 0x46F1, 0xFFFF, 0x46A3, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+58xx */
+    0x469D, 0xFFFF, 0x497F, 0xFFFF, 0xFFFF, 0x4AE7, 0x5371, 0xFFFF, 0xFFFF, 0xFFFF, 0x5878, 0x587A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x587B, 0xFFFF, 0xFFFF, 0xFFFF, 0x53A7, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x587C, 0xFFFF, 0xFFFF, 0x4B61, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E53,
+    0x50A4, 0x49B8, 0xFFFF, 0xFFFF, 0x45D9, 0x54F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A7C, 0xFFFF, 0xFFFF, 0x5880, 0xFFFF, 0xFFFF,
+    0x539F, 0x4BEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5053, 0x587D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4EC6, 0x5881, 0xFFFF, 0x4CCB, 0xFFFF, 0xFFFF, 0x486A, 0x52F8, 0x4F6F, 0x4657, 0xFFFF, 0xFFFF, 0xFFFF, 0x53C1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x587E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4743, 0xFFFF, 0x4F5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5883, 0xFFFF, 0x5886, 0xFFFF, 0xFFFF, 0x4D89, 0xFFFF, 0xFFFF, 0xFFFF, 0x5884, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5279, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4A95, 0xFFFF, 0x5885, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4EBE, 0xFFFF, 0xFFFF, 0xFFFF, 0x464D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5150, 0xFFFF, 0x588A, 0x5887,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AFC, 0xFFFF, 0xFFFF, 0x5888, 0xFFFF, 0xFFFF, 0x588B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x588C, 0x5289, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5889, 0x588D, 0x588E, 0x5552, 0xFFFF, 0xFFFF, 0x5488, 0xFFFF,
+    0xFFFF, 0x4B95, 0xFFFF, 0xFFFF, 0xFFFF, 0x588F, 0xFFFF, 0x4E8E, 0xFFFF, 0xFFFF, 0x4EC8, 0xFFFF, 0x5196, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5891, 0xFFFF, 0x5890, 0xFFFF, 0x55B9, 0xFFFF, 0x5892, 0x5894, 0x5893, 0xFFFF, 0xFFFF, 0x5896, 0xFFFF, 0x5895, 0x5897,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5898, 0x5899, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x467D, 0x514F, 0xFFFF, 0x4C9F, 0x589A,
+    0x496C, 0x4EB0, 0x4775, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x589B, 0xFFFF, 0x589C, 0x5077, 0x589D, 0x589E, 0x5275, 0xFFFF, 0xFFFF,
+  },
+  { /* U+59xx */
+    0xFFFF, 0xFFFF, 0x589F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x476F, 0x58A0, 0x58A1, 0xFFFF, 0xFFFF, 0xFFFF, 0x497E,
+    0x58A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AC3, 0x4694, 0xFFFF, 0x52C8, 0x54DD, 0x45FE, 0x58A3, 0x48C8, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4B8B, 0xFFFF, 0xFFFF, 0x58A5, 0xFFFF, 0x455B, 0xFFFF, 0x468A, 0x45AB, 0x4573, 0x58A6, 0x58A7, 0x4792, 0xFFFF,
+    0xFFFF, 0x4941, 0x58A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5147, 0x58A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58AA, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52F2, 0xFFFF, 0xFFFF, 0x4D69, 0x45E6, 0x4DB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x518F, 0x4C53,
+    0x58AC, 0x4C64, 0xFFFF, 0x58AD, 0x5284, 0x58AB, 0xFFFF, 0x5583, 0x58AF, 0xFFFF, 0x58AE, 0x58B0, 0xFFFF, 0x58B1, 0xFFFF, 0xFFFF,
+    0x58B4, 0xFFFF, 0x58B3, 0x58B2, 0xFFFF, 0x46E5, 0xFFFF, 0x58B5, 0x4ECA, 0x58B7, 0x4EBB, 0xFFFF, 0x58B6, 0xFFFF, 0x4EDD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4699, 0x4D90, 0xFFFF, 0xFFFF, 0xFFFF, 0x58B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x469E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x58B9, 0x4BF8, 0x51A2, 0x554D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5043, 0xFFFF, 0xFFFF, 0x58BA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5395, 0xFFFF, 0xFFFF, 0x53D1, 0xFFFF, 0xFFFF, 0x4A66, 0xFFFF, 0x58BB, 0xFFFF, 0x58BC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x58BD, 0x58BE, 0x4D9E, 0xFFFF, 0xFFFF, 0x50EC, 0xFFFF, 0xFFFF, 0xFFFF, 0x537F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x58BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BDC, 0x58C0, 0x49A3, 0xFFFF, 0xFFFF, 0x53AF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58C1, 0xFFFF, 0xFFFF, 0x4CC1, 0xFFFF, 0x4990, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x549C, 0x53F2, 0xFFFF, 0x4FF1, 0x484F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58C3, 0x58C4, 0xFFFF, 0x5184, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5255, 0x55DE, 0xFFFF, 0x58C2, 0xFFFF, 0x558C, 0x4AB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5179, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B42,
+  },
+  { /* U+5Axx */
+    0xFFFF, 0x4C65, 0xFFFF, 0x557A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x58C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B54, 0xFFFF, 0x58C9, 0xFFFF, 0x58C8, 0xFFFF, 0xFFFF, 0x58C6,
+    0x524C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58C5, 0xFFFF, 0xFFFF, 0xFFFF, 0x549F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50B5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58CE, 0x58CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5498, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x58CB, 0x50F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4ECC, 0xFFFF, 0xFFFF, 0x58CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x58D0, 0xFFFF, 0xFFFF, 0xFFFF, 0x496F, 0xFFFF, 0xFFFF, 0xFFFF, 0x58D1, 0xFFFF, 0x58CC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5454,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4D80, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58D2, 0x4855, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58D3, 0x58D8, 0x58D4, 0xFFFF,
+    0xFFFF, 0x4E89, 0x58D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53E0, 0xFFFF, 0x58D6, 0x4EC3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x58D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58DD, 0x58DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5567, 0xFFFF, 0x58D9, 0xFFFF, 0xFFFF, 0x58DB, 0xFFFF, 0xFFFF, 0x58DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58DE, 0x58DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+5Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F8B, 0xFFFF, 0x58E1, 0x58E0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4DE4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58E4, 0xFFFF, 0x52EA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x55E8, 0xFFFF, 0x58E3, 0xFFFF, 0xFFFF, 0xFFFF, 0x58E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58E6, 0xFFFF,
+    0x58E9, 0xFFFF, 0xFFFF, 0x58E7, 0xFFFF, 0x58E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4564, 0x58EA, 0xFFFF, 0xFFFF, 0x4BD9, 0x58EB, 0x58EC, 0x48F2, 0x4A41, 0xFFFF, 0x5258, 0x58EE, 0x4FF2, 0x45F4, 0xFFFF, 0x4F83,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4AEC, 0x4EAF, 0x58EF, 0x45BE, 0xFFFF, 0xFFFF, 0x58F0, 0xFFFF, 0x4C5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x58F1, 0x595B, 0xFFFF, 0x58F2, 0xFFFF, 0x58F3, 0xFFFF, 0xFFFF, 0x58F4, 0xFFFF, 0x58F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x58F6, 0xFFFF, 0xFFFF, 0x58F7, 0xFFFF, 0x486F, 0xFFFF, 0x46D5, 0x46F0, 0x45A8, 0xFFFF, 0x524D, 0x48C5, 0x4C75, 0xFFFF, 0x46C8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x515C, 0xFFFF, 0x47DD, 0x49A2, 0x4D64, 0x45E7, 0x50AB, 0x4D8B, 0x494D, 0xFFFF, 0x45ED,
+    0xFFFF, 0xFFFF, 0x4ADE, 0x498F, 0x47B8, 0x4F7A, 0x58F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4592, 0xFFFF,
+    0x4ED4, 0xFFFF, 0xFFFF, 0x4968, 0x5078, 0x52EF, 0x4686, 0xFFFF, 0x58F9, 0x4889, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4882,
+    0x58FC, 0xFFFF, 0x4FE9, 0x58FA, 0x49DF, 0x4A84, 0x4A56, 0x58FB, 0xFFFF, 0x58FD, 0xFFFF, 0xFFFF, 0x45AC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5941, 0xFFFF, 0x4B81, 0x55F4, 0x5244, 0xFFFF, 0xFFFF, 0xFFFF, 0x5942, 0xFFFF, 0xFFFF, 0x47F8, 0xFFFF, 0x4B59, 0x5943, 0x4B93,
+    0xFFFF, 0x52B8, 0x5946, 0xFFFF, 0x5945, 0x5947, 0x51FC, 0x4FA9, 0x5C7E, 0x4987, 0xFFFF, 0x5948, 0x5944, 0xFFFF, 0x4C7A, 0xFFFF,
+    0x5949, 0xFFFF, 0xFFFF, 0x594A, 0xFFFF, 0x5556, 0x594B, 0xFFFF, 0x4B60, 0xFFFF, 0x46A0, 0xFFFF, 0xFFFF, 0xFFFF, 0x4656, 0x46B2,
+  },
+  { /* U+5Cxx */
+    0xFFFF, 0x4D76, 0x49FB, 0xFFFF, 0x498A, 0x594C, 0x4959, 0x594D, 0x594E, 0x5189, 0x4CEF, 0x4D5F, 0xFFFF, 0x594F, 0x48AE, 0x455D,
+    0xFFFF, 0x484A, 0xFFFF, 0x5950, 0xFFFF, 0xFFFF, 0x53C0, 0xFFFF, 0xFFFF, 0xFFFF, 0x4871, 0xFFFF, 0xFFFF, 0xFFFF, 0x5951, 0xFFFF,
+    0x5952, 0xFFFF, 0x5953, 0xFFFF, 0x53AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x5954, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6880, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4BEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5955, 0x515D, 0x4C6B, 0x49CE, 0x4A86, 0x4FB9, 0x45C8, 0x4CC6,
+    0x488B, 0x5956, 0xFFFF, 0xFFFF, 0xFFFF, 0x485E, 0x5957, 0xFFFF, 0x4D94, 0xFFFF, 0x4DA7, 0x45E9, 0xFFFF, 0x55BA, 0x5958, 0x5443,
+    0x595A, 0x54B2, 0xFFFF, 0x5959, 0xFFFF, 0x48DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x476D, 0xFFFF,
+    0x53FB, 0x55C0, 0xFFFF, 0xFFFF, 0x4A8E, 0x4CA2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x595C, 0xFFFF, 0x595D, 0x4FDD,
+    0xFFFF, 0x4565, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x595E, 0xFFFF, 0xFFFF, 0x595F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5960, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x474A, 0x525A, 0xFFFF, 0xFFFF, 0x5961, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4572, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5967, 0xFFFF, 0x54B9, 0x45BF, 0xFFFF, 0x5963, 0x50D5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5262, 0xFFFF, 0x4D46, 0xFFFF, 0xFFFF, 0x5965, 0x5966, 0x4748, 0xFFFF, 0x5968, 0x5964, 0x596A, 0xFFFF, 0x5962, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5969, 0xFFFF, 0x596B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x596C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F96, 0x51B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F9D, 0x596D, 0x5972, 0xFFFF, 0xFFFF, 0x5971, 0xFFFF, 0x4AAC,
+    0x48FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5970, 0x456F, 0xFFFF, 0xFFFF, 0xFFFF, 0x596F, 0x5072, 0xFFFF, 0x596E, 0xFFFF, 0xFFFF,
+  },
+  { /* U+5Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C7F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5973, 0xFFFF, 0xFFFF, 0x457F, 0xFFFF,
+    0xFFFF, 0x5977, 0xFFFF, 0xFFFF, 0x514D, 0x5974, 0x5074, 0x54F1, 0x597C, 0x597B, 0x597A, 0x5976, 0xFFFF, 0xFFFF, 0xFFFF, 0x5975,
+    0xFFFF, 0xFFFF, 0x5979, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5978, 0xFFFF, 0x4F5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5984, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5983, 0x597D, 0xFFFF, 0x5982, 0xFFFF,
+    0x498C, 0xFFFF, 0x597E, 0x597F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5981, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x509E, 0xFFFF, 0xFFFF, 0x5985, 0x5987, 0xFFFF, 0x4ED3,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5986, 0xFFFF, 0xFFFF, 0x5988, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x598B, 0xFFFF, 0x598A, 0xFFFF, 0xFFFF, 0x5989, 0xFFFF, 0xFFFF, 0xFFFF, 0x47D1, 0x598C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x598F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x598E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x598D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5990, 0xFFFF, 0x5991, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5992, 0x5993, 0x5995, 0x4CE8, 0xFFFF, 0x5994, 0x4F84, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5996, 0xFFFF, 0xFFFF, 0x49CF, 0x5281, 0xFFFF, 0xFFFF,
+    0x5997, 0xFFFF, 0x5999, 0x5998, 0xFFFF, 0xFFFF, 0x51DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x599A, 0xFFFF, 0x4567, 0x4741, 0xFFFF,
+    0xFFFF, 0x4D47, 0xFFFF, 0x4C67, 0xFFFF, 0x456A, 0x485B, 0x4CA3, 0x4A52, 0xFFFF, 0xFFFF, 0x599B, 0xFFFF, 0xFFFF, 0x498B, 0xFFFF,
+    0xFFFF, 0x47AD, 0x4A4B, 0x4AE6, 0x4E7D, 0x599C, 0xFFFF, 0x53CB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4893, 0xFFFF, 0x4E46, 0x4A7D, 0xFFFF,
+  },
+  { /* U+5Exx */
+    0xFFFF, 0xFFFF, 0x4553, 0x476B, 0xFFFF, 0xFFFF, 0x4F75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x599D, 0x4AB5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x59A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51C7, 0xFFFF, 0xFFFF, 0x599F, 0x599E, 0x59A1, 0xFFFF, 0x489C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A44, 0xFFFF, 0x4B53, 0xFFFF, 0x4960,
+    0x4982, 0xFFFF, 0xFFFF, 0x4DC5, 0xFFFF, 0xFFFF, 0x59A2, 0x54BE, 0x46EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C85, 0xFFFF, 0xFFFF,
+    0x59A5, 0xFFFF, 0xFFFF, 0x59A4, 0x59A3, 0x4A5E, 0xFFFF, 0x59A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x496B, 0xFFFF, 0x59A7, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59A9, 0x4CCA, 0xFFFF, 0x59A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5483,
+    0xFFFF, 0x48DE, 0x59AA, 0x4E7F, 0x59AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4A6F, 0x458D, 0x4560, 0x59AC, 0x59AD, 0xFFFF, 0x45A9, 0x48DA, 0x59AE, 0x50A2, 0x4DAF, 0x525F, 0x4B57, 0x59AF,
+    0xFFFF, 0x4B92, 0xFFFF, 0x45B7, 0x4850, 0xFFFF, 0xFFFF, 0x558D, 0xFFFF, 0xFFFF, 0x4AED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D4F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B64, 0x554F, 0x4854, 0xFFFF, 0xFFFF, 0x515A, 0xFFFF, 0x4551, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x59B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45DE, 0x48B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x45F8, 0xFFFF, 0x48E0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EEB, 0x50C1, 0x469A, 0x4C5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x59B1, 0x59B2, 0x4BC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59B3, 0x4EDB, 0x4EA7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59B5,
+    0x59B4, 0xFFFF, 0xFFFF, 0x54AD, 0xFFFF, 0xFFFF, 0x536C, 0xFFFF, 0xFFFF, 0xFFFF, 0x59B7, 0x59B8, 0xFFFF, 0x59B6, 0xFFFF, 0x55AF,
+    0x5562, 0x59BA, 0x59B9, 0x50E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59BB, 0x59BC, 0xFFFF, 0xFFFF, 0x59BD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x59BE, 0x59BF, 0xFFFF, 0x59C0, 0x59C1, 0xFFFF, 0x47D0, 0x505B, 0x52D6, 0xFFFF, 0x4666, 0x4BAF, 0x5564, 0xFFFF, 0x544B, 0x51D9,
+  },
+  { /* U+5Fxx */
+    0xFFFF, 0x4B47, 0xFFFF, 0x59C2, 0x54BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59C3, 0x50CD, 0x59C4, 0x5641, 0x5651, 0xFFFF, 0x468F,
+    0x50E1, 0x59C5, 0xFFFF, 0x4B63, 0x51E5, 0x46DA, 0x59C6, 0x54AC, 0x45D3, 0xFFFF, 0xFFFF, 0x5597, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C9B,
+    0xFFFF, 0x59C7, 0xFFFF, 0xFFFF, 0xFFFF, 0x47E6, 0x4E42, 0x536B, 0xFFFF, 0x59C8, 0xFFFF, 0xFFFF, 0xFFFF, 0x59C9, 0xFFFF, 0x59CA,
+    0xFFFF, 0x4B6E, 0xFFFF, 0xFFFF, 0x59CB, 0x48BA, 0xFFFF, 0x46D2, 0x59CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x52E0, 0xFFFF, 0x4AD4, 0xFFFF,
+    0xFFFF, 0x59CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x53C7, 0xFFFF, 0xFFFF, 0x59CE, 0xFFFF, 0x5385, 0xFFFF, 0x59CF, 0xFFFF, 0x59D0, 0xFFFF,
+    0xFFFF, 0x59D1, 0xFFFF, 0x465F, 0xFFFF, 0xFFFF, 0x59D2, 0x59D3, 0xFFFF, 0x59D4, 0xFFFF, 0xFFFF, 0x59D5, 0x59D6, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x59D7, 0x4690, 0xFFFF, 0xFFFF, 0xFFFF, 0x45E1, 0x59D8, 0xFFFF, 0x4DCD, 0x5159, 0x4E86, 0x4E88, 0x529C, 0xFFFF, 0xFFFF,
+    0x4964, 0x495E, 0xFFFF, 0x59D9, 0xFFFF, 0xFFFF, 0xFFFF, 0x59DA, 0xFFFF, 0x495D, 0xFFFF, 0xFFFF, 0x4772, 0xFFFF, 0xFFFF, 0x59DD,
+    0x4CEA, 0x4A61, 0x59DC, 0x59DB, 0x4E60, 0x48A3, 0xFFFF, 0x59E0, 0x59DF, 0xFFFF, 0x59DE, 0x4991, 0x45E5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x50B3, 0x59E1, 0x4C6C, 0x48FB, 0xFFFF, 0xFFFF, 0xFFFF, 0x47E8, 0x59E4, 0x59E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59E3, 0xFFFF,
+    0x59E5, 0x4698, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59E6, 0x4A70, 0x4EF5, 0xFFFF, 0xFFFF, 0x59E7, 0x4B5D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4654, 0x4C74, 0xFFFF, 0xFFFF, 0x59E8, 0xFFFF, 0x48F8, 0xFFFF, 0xFFFF, 0x59E9, 0x55E0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x46E7, 0xFFFF, 0x47CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5097, 0x4BD7, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59EA, 0x4661, 0x4C45, 0x4EA3, 0xFFFF, 0xFFFF, 0x4895, 0x59F0, 0x59F1, 0xFFFF,
+    0x464F, 0xFFFF, 0xFFFF, 0xFFFF, 0x59EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C60, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x59EF, 0x59EE, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AAE, 0xFFFF, 0xFFFF, 0x59ED, 0xFFFF, 0xFFFF, 0x59EB, 0xFFFF, 0x5056, 0xFFFF, 0x59F2,
+  },
+  { /* U+60xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59F7, 0x59FD,
+    0x59F5, 0xFFFF, 0x4CD6, 0xFFFF, 0xFFFF, 0x59FA, 0x4EF0, 0xFFFF, 0xFFFF, 0x59F4, 0xFFFF, 0x59F9, 0x509F, 0x46AD, 0xFFFF, 0xFFFF,
+    0x5081, 0x59F3, 0xFFFF, 0xFFFF, 0xFFFF, 0x47CC, 0x59FC, 0x466E, 0x54DE, 0x59F6, 0x4E71, 0x59FB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5542,
+    0xFFFF, 0x59F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5A42, 0x5256, 0x5A4C, 0xFFFF, 0xFFFF, 0x5A49, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A48, 0x4BCA, 0xFFFF, 0x5A4A, 0xFFFF, 0xFFFF,
+    0x4BD5, 0xFFFF, 0x47C7, 0xFFFF, 0xFFFF, 0x5298, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A50, 0x5A41, 0xFFFF, 0xFFFF, 0x5A44, 0xFFFF, 0x5A47,
+    0x5A43, 0xFFFF, 0x5594, 0x5A4B, 0x5A4D, 0x4ECE, 0xFFFF, 0xFFFF, 0x53B8, 0x4C81, 0x5A45, 0x5A4F, 0x5A4E, 0x494E, 0xFFFF, 0x4BB0,
+    0x5384, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4643, 0xFFFF, 0x5A46, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5A52, 0xFFFF, 0x5A53, 0x5A55, 0x5A51, 0xFFFF, 0xFFFF, 0xFFFF, 0x5469, 0x5A57, 0x5A5C, 0x4DE3, 0x5544, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5A5A, 0xFFFF, 0x5091, 0xFFFF, 0x5A58, 0x5A59, 0xFFFF, 0xFFFF, 0x5A54, 0x5A56, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AB1,
+    0x4DD8, 0xFFFF, 0xFFFF, 0x4DEB, 0xFFFF, 0xFFFF, 0x4873, 0x5A5B, 0xFFFF, 0x4BCD, 0x4965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4C9D, 0x5276, 0x53A3, 0x5A64, 0x5554, 0xFFFF, 0x5A5E, 0xFFFF, 0xFFFF, 0xFFFF, 0x5145, 0x5A62, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x485F, 0x5A63, 0x4E65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4E78, 0xFFFF, 0x5A61, 0xFFFF, 0x5A65, 0xFFFF, 0xFFFF, 0x5A66, 0xFFFF, 0x549D, 0xFFFF, 0x4ED7, 0xFFFF, 0x5A5F, 0x4FE0,
+    0x5A60, 0x5A5D, 0xFFFF, 0x4B68, 0xFFFF, 0xFFFF, 0xFFFF, 0x554A, 0x506E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x54B8, 0x5A73, 0x5A68, 0x48B3, 0x5A6E, 0xFFFF, 0x5A6B, 0x5A6C, 0xFFFF, 0x5472, 0x5A6F, 0x5A72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+61xx */
+    0x5A6D, 0x5282, 0xFFFF, 0x5A70, 0xFFFF, 0xFFFF, 0x5A6A, 0xFFFF, 0x53C8, 0x5098, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A74, 0x5A75, 0x4763,
+    0xFFFF, 0x5A76, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52B2, 0x45C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x47F7,
+    0x5A67, 0x5A71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A7B, 0x5A7A, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A80, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5A7E, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A81, 0xFFFF, 0xFFFF, 0x5A79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A7F, 0x5A84, 0x5A7C, 0x51E3,
+    0xFFFF, 0xFFFF, 0x5A85, 0xFFFF, 0x5A86, 0xFFFF, 0xFFFF, 0x5A77, 0x4CBE, 0xFFFF, 0x5A7D, 0x48FD, 0x538E, 0x5A78, 0x4A76, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5A92, 0xFFFF, 0x52E3, 0xFFFF, 0xFFFF, 0x5A8A, 0x5A8B, 0x5A8C, 0xFFFF, 0xFFFF, 0x5A83, 0xFFFF, 0x5A91,
+    0xFFFF, 0xFFFF, 0x4DDB, 0x4DD3, 0xFFFF, 0x5A82, 0xFFFF, 0x4EB6, 0x528A, 0xFFFF, 0xFFFF, 0x5A8D, 0xFFFF, 0xFFFF, 0x4C49, 0x5A8F,
+    0x4FAD, 0x5A90, 0xFFFF, 0x5A87, 0x5A8E, 0x5A93, 0x48A8, 0x5A89, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53F4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x507C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A88, 0xFFFF, 0xFFFF, 0x5A99, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F4A, 0xFFFF,
+    0x555B, 0x5A9A, 0xFFFF, 0xFFFF, 0x5A98, 0xFFFF, 0x5A96, 0xFFFF, 0x5A94, 0x5A95, 0x55CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FFC, 0xFFFF, 0xFFFF, 0x53C2, 0xFFFF, 0x5175, 0xFFFF, 0x5A9B, 0x5A97, 0xFFFF, 0x5A9C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x47BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E6C, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AA3, 0xFFFF, 0xFFFF, 0xFFFF, 0x51A5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5AA1, 0xFFFF, 0xFFFF, 0x5AA2, 0x4EA4, 0x5AA0, 0x5A9F, 0x5A9E, 0x5AA4, 0x5A9D, 0x5AA6, 0xFFFF, 0xFFFF,
+    0x4EF2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5AA8, 0xFFFF, 0xFFFF, 0x5AA7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5153, 0xFFFF, 0x5AA9, 0xFFFF, 0x5AAB, 0x5AAA, 0x4DC6, 0xFFFF, 0x5AAD, 0xFFFF, 0x5AAF, 0x5AAC, 0x5AB0, 0x5AAE,
+  },
+  { /* U+62xx */
+    0x5AB1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AB2, 0x5AB3, 0x5161, 0xFFFF, 0x5460, 0x5AB4, 0x517F, 0xFFFF,
+    0x45BA, 0x49DE, 0x4DA0, 0x5AB5, 0x5AB6, 0xFFFF, 0x4D7F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5595, 0x5AB7, 0xFFFF, 0x646E, 0x5AB8, 0x54D9,
+    0xFFFF, 0x5AB9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4764, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ABA, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ABB, 0x4F92,
+    0x5ABC, 0xFFFF, 0x5ABD, 0x5ABE, 0x5092, 0xFFFF, 0xFFFF, 0xFFFF, 0x45CF, 0xFFFF, 0xFFFF, 0x4C44, 0xFFFF, 0xFFFF, 0xFFFF, 0x47DC,
+    0x458C, 0x5ABF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DCA, 0x655D, 0x50AD, 0xFFFF, 0x45CB, 0xFFFF, 0x49F1, 0x5AC0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x47EA, 0xFFFF, 0x4981, 0xFFFF, 0xFFFF, 0x55D5, 0xFFFF, 0xFFFF, 0x5AC3, 0xFFFF, 0xFFFF, 0x5AC1, 0xFFFF,
+    0x5AC4, 0xFFFF, 0xFFFF, 0x5AC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AC5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54B7, 0xFFFF,
+    0xFFFF, 0x4C69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D7A, 0xFFFF, 0xFFFF, 0x4C76, 0xFFFF, 0xFFFF, 0x5AC6, 0xFFFF, 0x5ACA, 0x4C48,
+    0x48F7, 0xFFFF, 0x5AC7, 0x5ACD, 0x4EC0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AC8, 0x4EE3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4D66, 0x5AC9, 0x5ACB, 0x5ACE, 0x4751, 0x5ACC, 0x4A67, 0x498D, 0xFFFF, 0xFFFF, 0x5ADC, 0x4A85, 0xFFFF, 0x4E7E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ADA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA6, 0x5AD3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4C86, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B90, 0xFFFF, 0xFFFF, 0xFFFF, 0x51E0, 0xFFFF, 0x5AD1, 0x49E1, 0x4D53, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5AD9, 0xFFFF, 0xFFFF, 0x4AA1, 0x5AD4, 0x5ADB, 0x5AD5, 0x5ADD, 0x5AD8, 0xFFFF, 0x5345, 0x4FBA, 0xFFFF, 0x5AD2,
+    0x53A2, 0x5AD0, 0x4F61, 0x4BDB, 0x5AD7, 0xFFFF, 0xFFFF, 0x5ACF, 0x5045, 0x525C, 0xFFFF, 0x4BFD, 0x5AD6, 0x4EE2, 0xFFFF, 0xFFFF,
+    0x4D77, 0x48E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FC5, 0x4EE5, 0x5ADF, 0x5AE4,
+    0xFFFF, 0x5AE0, 0xFFFF, 0x508D, 0xFFFF, 0x5AE5, 0x4F9E, 0x55B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DD7, 0x5AE6,
+  },
+  { /* U+63xx */
+    0xFFFF, 0x46D8, 0x5AE2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47B6, 0x5AE3, 0x5489, 0xFFFF, 0xFFFF, 0x5ADE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4FDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B82, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55B1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AE1, 0x4F81, 0xFFFF, 0xFFFF, 0x548F, 0xFFFF, 0xFFFF, 0xFFFF, 0x48F6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5387, 0xFFFF, 0xFFFF, 0x52A8, 0x5AE9, 0x5555,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53A0, 0xFFFF, 0xFFFF, 0x557D, 0x5AE8, 0xFFFF, 0x5AEA,
+    0x5AE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C41, 0xFFFF, 0x5546, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DDD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5285, 0x4BB3, 0x5AF5, 0xFFFF, 0x5AF4, 0xFFFF, 0xFFFF, 0x4ED6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5493, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AEF, 0x4D8F, 0xFFFF, 0xFFFF, 0x4FC0, 0x54C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5AED, 0xFFFF, 0xFFFF, 0x4DC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C61, 0x5AF2, 0xFFFF, 0xFFFF, 0x4EEC, 0xFFFF, 0x5AEC, 0x5AF1,
+    0xFFFF, 0xFFFF, 0x4CFA, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AEB, 0xFFFF, 0x4D44, 0xFFFF, 0xFFFF, 0x4AE3, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AF3,
+    0x55E6, 0x4B4F, 0x4B7F, 0x5AF0, 0xFFFF, 0x47A8, 0xFFFF, 0x4CAC, 0x48D5, 0x55D0, 0x4A60, 0x5AEE, 0x5541, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4DC1, 0xFFFF, 0x54CD, 0x5AF6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54A3, 0xFFFF, 0xFFFF, 0x5AF7, 0xFFFF,
+    0x5AF9, 0xFFFF, 0xFFFF, 0x4EFD, 0x5B42, 0xFFFF, 0x5AFA, 0xFFFF, 0xFFFF, 0x5AFD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BCF,
+    0x49B9, 0xFFFF, 0x5AFE, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CF2, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C46, 0x49AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4D60, 0xFFFF, 0x5AFC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AF8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BF2, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD5, 0x5AFB, 0x5B41, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+64xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B44, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD8, 0xFFFF, 0x5B4B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5B45, 0xFFFF, 0xFFFF, 0x5B4C, 0x5B49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B48, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B46, 0xFFFF, 0x5B4A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DC8, 0x528F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B43, 0xFFFF, 0x5B47, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E49, 0xFFFF, 0xFFFF, 0xFFFF, 0x50A3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4E8C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B4D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DCB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5B50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B4E, 0xFFFF, 0x48D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B4F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B51, 0xFFFF, 0x55F5, 0xFFFF, 0x51EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4A74, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x53DE, 0x5B57, 0xFFFF, 0x5B55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5348, 0xFFFF, 0xFFFF, 0x5B53, 0x55DB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E7A, 0x5B58, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B59, 0xFFFF, 0x51E1, 0xFFFF, 0x4E62, 0x4C77, 0xFFFF,
+    0x5372, 0xFFFF, 0x4EC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B52, 0xFFFF, 0x5B56, 0x5B5B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x514E, 0x5B62, 0xFFFF, 0xFFFF, 0x5B5E, 0xFFFF, 0x5B5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x499B, 0x5B54, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5B5D, 0xFFFF, 0x5B60, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B61, 0xFFFF, 0x5B5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5B65, 0x5B66, 0x5543, 0x5B67, 0xFFFF, 0xFFFF, 0x4FD6, 0x5B64, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FCD, 0xFFFF, 0xFFFF, 0x5B68,
+    0xFFFF, 0x5B63, 0x5B6B, 0xFFFF, 0x5B69, 0xFFFF, 0x5B6A, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B6C, 0xFFFF, 0xFFFF, 0x5B6E, 0x55F6, 0xFFFF,
+  },
+  { /* U+65xx */
+    0x5B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B6F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B70, 0x5B71, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5B74, 0x5B73, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x527F, 0x5B75, 0x5B76, 0xFFFF, 0xFFFF, 0x477B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B77, 0x5B78, 0x5B7A, 0x5B79, 0x5B7B, 0x488F, 0xFFFF, 0x4BC5, 0xFFFF, 0xFFFF, 0x48AF, 0x45C7,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AF7, 0xFFFF, 0xFFFF, 0x5B7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B80, 0x5B7E, 0x4647,
+    0xFFFF, 0x4C5C, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B82, 0x5B7F, 0x4B8A, 0x5B81, 0x47A5, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B83, 0x51B1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4FCF, 0x4AC9, 0xFFFF, 0xFFFF, 0x49F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47B0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x46CC, 0xFFFF, 0x5B84, 0xFFFF, 0x477C, 0x4BF3, 0xFFFF, 0x4951, 0x5B85, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5B86, 0x5B87, 0xFFFF, 0xFFFF, 0xFFFF, 0x45CA, 0x58ED, 0x468E, 0xFFFF, 0xFFFF, 0x519D, 0xFFFF, 0x47DB, 0xFFFF,
+    0x4B80, 0x52E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E83, 0xFFFF, 0x464E, 0xFFFF, 0x5B89, 0x4BD1, 0xFFFF, 0xFFFF, 0x5B8A,
+    0xFFFF, 0x5581, 0xFFFF, 0xFFFF, 0x54CF, 0x5141, 0xFFFF, 0x51C2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B8B, 0x4EFC, 0x4989, 0xFFFF, 0x4EA5,
+    0x4587, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B8C, 0xFFFF, 0x45CD, 0xFFFF, 0xFFFF, 0x4DA4, 0x4888, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5B8F, 0xFFFF, 0x5B8D, 0x5B90, 0x4ACF, 0x5B8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D7B, 0x5B91, 0xFFFF, 0xFFFF, 0x4ADC,
+    0xFFFF, 0xFFFF, 0x5B92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DAB, 0xFFFF, 0x5B93, 0xFFFF, 0x5165, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5B95, 0x5B94, 0x4B77, 0xFFFF, 0xFFFF, 0x4562, 0x4D9D, 0x4C7B, 0x4D6A, 0x46E9, 0xFFFF, 0xFFFF, 0x4D67, 0x47EC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5B96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA3, 0x5B9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+66xx */
+    0x5B97, 0xFFFF, 0x5B99, 0x5B9B, 0xFFFF, 0xFFFF, 0x4FE7, 0x46FE, 0xFFFF, 0x5B9D, 0x528E, 0xFFFF, 0x46D1, 0xFFFF, 0x45A6, 0x54E8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x47E9, 0x4C59, 0x5B98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BA3, 0xFFFF, 0x5BA1, 0x47A9,
+    0x47AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BA4, 0x4662, 0xFFFF, 0x559D, 0x48E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45B3, 0x5BA0, 0x4BBB,
+    0xFFFF, 0x52EB, 0xFFFF, 0xFFFF, 0x5BA2, 0x5B9F, 0x5193, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F9F, 0x4C98, 0xFFFF, 0xFFFF, 0x5B9E,
+    0xFFFF, 0x5251, 0x4651, 0x48B0, 0x5BA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BA6, 0xFFFF, 0x4BB2, 0xFFFF, 0xFFFF, 0xFFFF, 0x51EA,
+    0xFFFF, 0xFFFF, 0x54C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BA8, 0xFFFF, 0x5BAB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BAD, 0x5BA9, 0x4FCE,
+    0xFFFF, 0xFFFF, 0x5BAC, 0xFFFF, 0x5BAA, 0x5BA7, 0x556D, 0x50A0, 0x51B2, 0x4CB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49F8, 0x4993,
+    0x5BB0, 0xFFFF, 0xFFFF, 0x5BAF, 0x4795, 0xFFFF, 0x4AF8, 0xFFFF, 0xFFFF, 0xFFFF, 0x46A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4C83, 0xFFFF, 0x5BB1, 0x5BB3, 0xFFFF, 0xFFFF, 0x4F46, 0x5BB2, 0x4ED1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FAB, 0xFFFF,
+    0xFFFF, 0x4FBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D6C, 0x4BE2, 0x5BB5, 0x5BB4, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BB7, 0xFFFF, 0xFFFF,
+    0x5BB6, 0xFFFF, 0x4CC7, 0xFFFF, 0xFFFF, 0xFFFF, 0x50CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5093, 0xFFFF, 0xFFFF, 0x4AFE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5BB8, 0xFFFF, 0x4CB2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BBF, 0x5243, 0xFFFF, 0xFFFF, 0x5BBE, 0xFFFF, 0x5BBD, 0x5BBB,
+    0xFFFF, 0x5BBA, 0xFFFF, 0xFFFF, 0x5BB9, 0xFFFF, 0xFFFF, 0x4C56, 0xFFFF, 0x5BBC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BC0, 0xFFFF, 0xFFFF, 0x5152, 0x5BC1, 0xFFFF, 0x4BFE, 0x52A6, 0xFFFF, 0xFFFF,
+    0x51CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BC2, 0xFFFF, 0xFFFF, 0x5BC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5BC4, 0xFFFF, 0x49B6, 0x4EBC, 0x4A6D, 0x5BC5, 0xFFFF, 0x5BC6, 0x479D, 0x4ED2, 0x5BC7, 0x5397, 0x578D, 0x495F, 0x5166, 0x4BC3,
+  },
+  { /* U+67xx */
+    0x46F5, 0xFFFF, 0xFFFF, 0x56AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4561, 0x4685, 0xFFFF, 0x4BC4, 0xFFFF, 0x47D4, 0x5BC8, 0x54FD,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA4, 0x55F3, 0x5BCA, 0x486E, 0xFFFF, 0xFFFF, 0xFFFF, 0x47BB, 0xFFFF, 0x475C, 0x5BCB, 0x468B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BCD, 0x5BCE, 0x456C, 0xFFFF, 0x49C6, 0x4746, 0x4566, 0x48F9, 0x5BD0, 0xFFFF,
+    0xFFFF, 0x4D42, 0xFFFF, 0xFFFF, 0x4EA2, 0xFFFF, 0x5BD2, 0x5BD3, 0x5BD4, 0xFFFF, 0x4D96, 0xFFFF, 0xFFFF, 0x50F0, 0xFFFF, 0x5BD1,
+    0xFFFF, 0x534F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BD5, 0xFFFF, 0xFFFF, 0x4668, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E51, 0x50D0,
+    0x46BC, 0x4556, 0xFFFF, 0x54C1, 0xFFFF, 0xFFFF, 0x50F4, 0xFFFF, 0xFFFF, 0x5BD7, 0xFFFF, 0xFFFF, 0x525D, 0xFFFF, 0x5BD6, 0x4B4B,
+    0x5480, 0x475E, 0x51A6, 0x5291, 0x5BD9, 0x4676, 0x5BD8, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BDE, 0xFFFF, 0xFFFF, 0x508B, 0xFFFF, 0x4C63,
+    0x5BDC, 0x4557, 0x5B9A, 0x5BE0, 0xFFFF, 0x4AA6, 0xFFFF, 0x5280, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54DF, 0xFFFF, 0x4578, 0x46B4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BDB, 0xFFFF, 0x525E, 0xFFFF, 0x5BDA, 0xFFFF, 0x5BDF, 0x54F2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4AE2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F78, 0xFFFF, 0x45A2, 0xFFFF, 0xFFFF, 0x49D9, 0xFFFF, 0x47B9, 0x4672, 0xFFFF, 0xFFFF,
+    0x4FD2, 0x5BE2, 0x52D0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BE1, 0xFFFF, 0xFFFF, 0x5BDD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5061,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x54C9, 0x5BE6, 0xFFFF, 0x4EE8, 0x5BE4, 0x5BE9, 0x5BF2, 0xFFFF, 0x5BE3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5BF0, 0x55CD, 0xFFFF, 0xFFFF, 0x4A7F, 0xFFFF, 0x5BF4, 0xFFFF, 0xFFFF, 0xFFFF, 0x52D9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BF1, 0x4980,
+    0x504A, 0x4EC1, 0xFFFF, 0x489B, 0x4DEA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FD8, 0xFFFF, 0x4EE1, 0xFFFF, 0xFFFF, 0x5BED, 0x54F3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5BEE, 0xFFFF, 0x5BEB, 0xFFFF, 0xFFFF, 0x5BEA, 0xFFFF, 0x5BE8, 0xFFFF, 0xFFFF, 0x5BE7, 0xFFFF, 0x5BEF, 0x5BE5,
+    0xFFFF, 0x4BEA, 0xFFFF, 0x46EA, 0x47A7, 0x51F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4773, 0xFFFF, 0xFFFF, 0x5054, 0x4AC1,
+  },
+  { /* U+68xx */
+    0xFFFF, 0x5BF3, 0x52D1, 0x47D3, 0x45FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x50E3, 0xFFFF, 0xFFFF, 0x4DCC, 0x479B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BF5, 0xFFFF,
+    0xFFFF, 0x48BF, 0x5242, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52DE, 0x4856, 0x52E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5BFA, 0xFFFF, 0x55DA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B9E, 0x4667, 0xFFFF, 0xFFFF, 0x47DE, 0x4DE0, 0xFFFF, 0xFFFF,
+    0x5BF8, 0x50D6, 0x49AB, 0x4ADA, 0x5BF9, 0xFFFF, 0x5BF6, 0xFFFF, 0x48F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BF7, 0x5BFB, 0xFFFF,
+    0x49C0, 0x4879, 0x5BEC, 0x536D, 0x534B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BFD, 0xFFFF, 0xFFFF, 0x4771, 0x4D88, 0xFFFF, 0x51F3,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5BFC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5046, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C4B, 0xFFFF, 0x4E77, 0x5C41, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C44, 0x5C42,
+    0xFFFF, 0x4E44, 0xFFFF, 0x5C48, 0xFFFF, 0x4798, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BFE, 0xFFFF, 0x5C45,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x50DA, 0x5C47, 0xFFFF, 0xFFFF, 0x52CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x53BC, 0xFFFF, 0x4E92, 0xFFFF, 0x5C43,
+    0x52C6, 0xFFFF, 0x50AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x58A4, 0x52D3, 0x4858, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C46, 0xFFFF, 0x51E4,
+    0x4682, 0x5359, 0xFFFF, 0x5361, 0xFFFF, 0x5C4C, 0x49AD, 0xFFFF, 0xFFFF, 0x5C4A, 0x5C4D, 0xFFFF, 0x5C49, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EB1, 0xFFFF, 0x5C60, 0xFFFF, 0x5386, 0x55CA, 0x5C50, 0x4EF1, 0xFFFF, 0x5C56, 0xFFFF, 0x5C5F,
+    0xFFFF, 0xFFFF, 0x4B5A, 0xFFFF, 0x5C57, 0x5C59, 0xFFFF, 0x54C2, 0x5C52, 0xFFFF, 0x4BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EA9,
+    0x5C5E, 0x5C54, 0xFFFF, 0x5C5D, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C58, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x459D, 0x5C5B,
+    0xFFFF, 0xFFFF, 0x5375, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5494, 0x55B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+69xx */
+    0x5468, 0x5C4F, 0xFFFF, 0xFFFF, 0x5C5C, 0x4FF7, 0xFFFF, 0xFFFF, 0x5C51, 0xFFFF, 0xFFFF, 0x4DFD, 0x5C55, 0x47C5, 0x4BA0, 0x5C4E,
+    0xFFFF, 0xFFFF, 0x5C5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FED, 0x5370, 0x5163, 0x486D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5C63, 0x5C61, 0x5C64, 0xFFFF, 0x53FA, 0x5C53, 0xFFFF, 0x5C65, 0xFFFF, 0x5C62, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5C71, 0xFFFF, 0xFFFF, 0xFFFF, 0x54A7, 0xFFFF, 0x5C69, 0xFFFF, 0xFFFF, 0x52ED, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C6F, 0xFFFF, 0x4CBA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5295, 0x5C6B, 0x55C5, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C70, 0x534C, 0xFFFF, 0x54E2, 0x5C73, 0x5C72, 0xFFFF,
+    0x4ADF, 0x527C, 0x4D93, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C6E, 0xFFFF, 0x5C6C, 0x54A2, 0xFFFF, 0x456B, 0x53EF, 0x4FAE,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x52B3, 0x5C6D, 0x49B7, 0xFFFF, 0x5C68, 0x5C6A, 0x5C67, 0xFFFF, 0xFFFF, 0x52BA, 0x4761, 0x5C74, 0xFFFF,
+    0xFFFF, 0x5C75, 0x4C42, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B52, 0xFFFF, 0xFFFF, 0xFFFF, 0x49EB, 0xFFFF,
+    0xFFFF, 0x5476, 0xFFFF, 0xFFFF, 0x55C7, 0x5C86, 0xFFFF, 0xFFFF, 0x5C79, 0xFFFF, 0xFFFF, 0x4D7E, 0x5C85, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5C84, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x538D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x514A, 0xFFFF,
+    0xFFFF, 0x5C80, 0x5C76, 0xFFFF, 0x53B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C82, 0xFFFF, 0xFFFF, 0x5C7C, 0x5C77,
+    0xFFFF, 0x5C7A, 0xFFFF, 0x5C83, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DB9, 0xFFFF, 0xFFFF, 0x5C7F, 0x4796, 0x4EFA, 0x52DB, 0x5C7D, 0xFFFF,
+    0x548C, 0xFFFF, 0xFFFF, 0x5C7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4848, 0x6881, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C81, 0x5C87, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5C90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C8F, 0x5C89, 0xFFFF, 0xFFFF, 0x5C94, 0xFFFF, 0x5C92, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5C8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C8D, 0xFFFF, 0x4B5C, 0xFFFF, 0x4DB7, 0xFFFF, 0x5C8C,
+  },
+  { /* U+6Axx */
+    0xFFFF, 0xFFFF, 0x5C8A, 0xFFFF, 0xFFFF, 0x53BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C95, 0x494F, 0x5C9D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5C97, 0x5C99, 0x5C93, 0xFFFF, 0xFFFF, 0x538B, 0xFFFF, 0x4966, 0xFFFF, 0x5C8B, 0xFFFF, 0xFFFF, 0x5C91, 0x539B,
+    0xFFFF, 0x4864, 0x5C96, 0x5C98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48DC, 0x45F2, 0x4B6F, 0xFFFF, 0xFFFF, 0x5C88, 0xFFFF,
+    0x5C9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5585, 0x5C9F, 0xFFFF, 0x5CA7, 0x46CF, 0x4E69, 0xFFFF, 0xFFFF, 0x4BBE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C9C, 0xFFFF, 0x5CA6, 0x5CA1, 0x5CA5, 0xFFFF, 0xFFFF, 0x4589, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BC2, 0x5CA3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4579,
+    0xFFFF, 0x55D4, 0x5CA2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CA4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5CA8, 0x5CA9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CAF, 0x4FB2,
+    0x4FF5, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CAB, 0x55EE, 0xFFFF,
+    0x5CAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CB0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D55, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5C9E, 0xFFFF, 0x5CAD, 0x5CAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CB2, 0xFFFF, 0x5CB1, 0xFFFF, 0x545D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5CB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CB5, 0xFFFF, 0xFFFF, 0x5CB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5CB7, 0x5CB4, 0x528B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5CBA, 0xFFFF, 0x5586, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CBB, 0x4DA6, 0xFFFF, 0xFFFF, 0x5CB8, 0x5362,
+    0xFFFF, 0xFFFF, 0x5CB9, 0xFFFF, 0x5CBC, 0xFFFF, 0xFFFF, 0xFFFF, 0x51C5, 0xFFFF, 0x5CBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CC2, 0x52EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EDE, 0x5CC0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5CC3, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CC4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55F7, 0xFFFF, 0x5CC5,
+    0x4CB5, 0x4597, 0xFFFF, 0x4B9D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4BF6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CC7, 0x5CC6, 0x5CC8, 0x517D, 0xFFFF, 0xFFFF, 0x4CF8, 0x4EFB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5CCC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CCB, 0xFFFF, 0x5CCD, 0xFFFF, 0xFFFF, 0x46F7, 0xFFFF, 0x5487, 0xFFFF,
+    0x5CCE, 0xFFFF, 0xFFFF, 0x4D4E, 0x5CD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CCF, 0xFFFF, 0x5CD1, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CD2,
+    0xFFFF, 0x5CD3, 0x48D8, 0x4577, 0x4D4C, 0xFFFF, 0x45B1, 0xFFFF, 0xFFFF, 0x47D8, 0x558E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A9F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x48E4, 0x4955, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CD4, 0x5CD5, 0xFFFF, 0x4999, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CD6,
+    0x5CD7, 0xFFFF, 0xFFFF, 0x5CD9, 0x5CD8, 0xFFFF, 0x4F42, 0xFFFF, 0xFFFF, 0x53A4, 0x4865, 0x4992, 0xFFFF, 0x5CDA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CDC, 0x4E73, 0xFFFF, 0x5CDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CDD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CDF, 0x5CE0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CE1,
+    0xFFFF, 0x5CE2, 0x5CE3, 0x5CE4, 0x5459, 0x47ED, 0xFFFF, 0x5CE5, 0xFFFF, 0xFFFF, 0x49E9, 0x50C0, 0x5CE6, 0xFFFF, 0xFFFF, 0x4849,
+    0x587F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A5B, 0x5CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CE8, 0xFFFF, 0x4969, 0x49F5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4C97, 0x5CE9, 0x474E, 0xFFFF, 0x5CEA, 0xFFFF, 0x53D7, 0xFFFF, 0xFFFF, 0x46E2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CEB,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CED, 0x5CEC, 0xFFFF, 0xFFFF, 0x5CEF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5CEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x488E,
+    0xFFFF, 0x4756, 0xFFFF, 0x5CF1, 0x5CF2, 0xFFFF, 0xFFFF, 0x45B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5CF5, 0x5CF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x459C, 0xFFFF, 0xFFFF, 0x4CA4, 0x45FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x556E, 0x5CF6,
+    0x534D, 0x4D84, 0x49A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x505E, 0xFFFF,
+    0x506A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CF8, 0xFFFF, 0x4EC4, 0xFFFF, 0xFFFF, 0x4E82, 0xFFFF, 0x5CF9, 0x555E, 0x5CF7, 0x45AD,
+    0x45E8, 0xFFFF, 0x5CFA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D45, 0xFFFF, 0x52B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CFE,
+    0x50D2, 0xFFFF, 0x50C8, 0x5D46, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47A4, 0xFFFF, 0xFFFF, 0x494C, 0x5D44, 0xFFFF,
+    0xFFFF, 0x5D42, 0x5CFB, 0x55D9, 0xFFFF, 0xFFFF, 0x5CFD, 0xFFFF, 0x4C8F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5598, 0x5CFC, 0xFFFF, 0xFFFF,
+    0x5D48, 0xFFFF, 0x5D47, 0x4FF8, 0xFFFF, 0xFFFF, 0x47FD, 0xFFFF, 0xFFFF, 0x4EAD, 0x5D41, 0x5D43, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5075, 0x4585, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53EC, 0xFFFF, 0xFFFF, 0x5D4D, 0xFFFF,
+    0xFFFF, 0x5D50, 0xFFFF, 0x465A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EAA, 0x465C, 0x5D52, 0x4584, 0x46C6, 0x5D4B, 0x5D51, 0x4E6F,
+    0xFFFF, 0x4A58, 0xFFFF, 0xFFFF, 0x5D49, 0x5D4C, 0xFFFF, 0xFFFF, 0xFFFF, 0x46EE, 0x4DB8, 0xFFFF, 0x51FD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x54D7, 0xFFFF, 0x464A, 0xFFFF, 0x55C6, 0xFFFF, 0x5D55, 0x5D4E, 0x5D53, 0xFFFF, 0x5D4F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4E87, 0x46CA, 0x4D4B, 0xFFFF, 0x4E56, 0xFFFF, 0xFFFF, 0x4944, 0xFFFF, 0x5D56, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D54,
+    0x46F3, 0x5D4A, 0xFFFF, 0x4F57, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D58, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45DA, 0x5D5E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5D5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A4E, 0xFFFF, 0x52B6, 0xFFFF, 0x5450, 0xFFFF, 0xFFFF, 0x4D98, 0x5D57,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45DC, 0xFFFF, 0xFFFF, 0xFFFF, 0x50B7, 0x4FD4, 0x5D5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4B72, 0x5D5C, 0xFFFF, 0x52AC, 0x5D59, 0xFFFF, 0x50BC, 0xFFFF, 0xFFFF, 0x47B4, 0xFFFF, 0x5D5B, 0x4A72, 0xFFFF,
+    0xFFFF, 0x46FC, 0xFFFF, 0xFFFF, 0x4CC9, 0x468D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D66, 0x5D64, 0xFFFF, 0x45EA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5D5F, 0x5D63, 0xFFFF, 0x466B, 0xFFFF, 0xFFFF, 0x46EB, 0x4A9D, 0xFFFF, 0x55CC, 0xFFFF, 0x4A8C, 0x5D62,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B7E, 0xFFFF, 0xFFFF, 0x45A7, 0x4D41, 0x5D65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D6A, 0xFFFF, 0x5D60, 0x486B, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F7D, 0xFFFF, 0x5D67, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5D61, 0xFFFF, 0x5D68, 0x5D6B, 0xFFFF, 0xFFFF, 0x4DDA, 0xFFFF, 0x5D69, 0x5550, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D72, 0xFFFF, 0xFFFF, 0x4F91,
+    0xFFFF, 0xFFFF, 0x4A45, 0xFFFF, 0xFFFF, 0x5D6F, 0xFFFF, 0xFFFF, 0x5D73, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E74, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4A88, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D7C, 0x5D75, 0x5D71, 0xFFFF, 0xFFFF, 0xFFFF, 0x52C7, 0x5D78, 0xFFFF, 0xFFFF, 0x5D74,
+    0xFFFF, 0x4ABF, 0x5D7B, 0xFFFF, 0xFFFF, 0x5D82, 0xFFFF, 0xFFFF, 0x55E1, 0x5D7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D77, 0xFFFF,
+    0xFFFF, 0x4CA5, 0xFFFF, 0xFFFF, 0x5D81, 0xFFFF, 0x5D70, 0xFFFF, 0x5D79, 0xFFFF, 0x5D83, 0x554E, 0x5D76, 0xFFFF, 0x5D84, 0xFFFF,
+    0xFFFF, 0x4777, 0x5D7F, 0x4894, 0xFFFF, 0x48EA, 0xFFFF, 0x4B46, 0x5D7A, 0x5D6C, 0x5D7D, 0x4A91, 0x5D80, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4596, 0xFFFF, 0x5441, 0x4769, 0x4AC0, 0x5D6D, 0x4892, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5198, 0xFFFF, 0x5164, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D87, 0x50E4, 0x478A, 0xFFFF, 0x5D99, 0xFFFF, 0x5D92,
+    0x527A, 0x45D2, 0xFFFF, 0x5D8C, 0x5D98, 0x4E43, 0x51A0, 0x5D93, 0xFFFF, 0x4950, 0xFFFF, 0x5D8F, 0x4945, 0x5D85, 0x5D6E, 0x48C6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D9A, 0x5D8A, 0x5D96, 0xFFFF, 0x5D95, 0xFFFF, 0x5D8B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5D94, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C88, 0xFFFF, 0xFFFF, 0x5D91, 0x5D97, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D52, 0xFFFF, 0x5155, 0xFFFF, 0xFFFF, 0x53F3, 0x5D8E, 0xFFFF, 0xFFFF, 0x5D89,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FBD, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D8D, 0xFFFF, 0xFFFF, 0x5D86, 0x48BD,
+    0xFFFF, 0xFFFF, 0x5D88, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D6B, 0x4C90,
+    0x475B, 0xFFFF, 0x5D9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54FA, 0xFFFF, 0xFFFF, 0x5DA5,
+    0x47FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46CE, 0xFFFF, 0x5D9D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DC4, 0x4A4D, 0xFFFF, 0x5DA8,
+    0xFFFF, 0xFFFF, 0x5271, 0xFFFF, 0xFFFF, 0x5376, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DA0,
+    0xFFFF, 0xFFFF, 0x5DA2, 0xFFFF, 0xFFFF, 0xFFFF, 0x48BE, 0x5D9E, 0xFFFF, 0xFFFF, 0x5497, 0xFFFF, 0xFFFF, 0x5D9F, 0xFFFF, 0x5DA6,
+    0xFFFF, 0xFFFF, 0x5DA7, 0xFFFF, 0x5DA1, 0x4EE6, 0xFFFF, 0xFFFF, 0xFFFF, 0x52A9, 0xFFFF, 0x4857, 0x5DB3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4BA2, 0xFFFF, 0x524A, 0x5DA3, 0x5DA4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47A3, 0x4DA1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DAB, 0xFFFF, 0xFFFF, 0x5DB1,
+    0xFFFF, 0xFFFF, 0x5DAF, 0xFFFF, 0x4FB7, 0xFFFF, 0xFFFF, 0x5DB7, 0x5DAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DAD, 0x5DB4,
+  },
+  { /* U+6Fxx */
+    0xFFFF, 0x4B78, 0x4FBC, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DAE, 0xFFFF, 0xFFFF, 0x54D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50C4,
+    0xFFFF, 0x5575, 0xFFFF, 0x5DB6, 0x49ED, 0x54A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x508E, 0xFFFF, 0x4F58, 0x54E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F6E, 0x4E8A, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DB0, 0x5DB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D73, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DB5, 0x5DAE,
+    0xFFFF, 0x5DA9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AC2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DC3, 0xFFFF, 0xFFFF, 0x5DBD, 0x4DC0, 0xFFFF, 0xFFFF, 0x46C2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD2, 0xFFFF, 0x5DC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DBE, 0x4C93, 0x5DBC,
+    0x5446, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DBF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DBA, 0xFFFF, 0x5DB9, 0xFFFF, 0x5DC2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5DBB, 0x55A0, 0x5DC0, 0xFFFF, 0x4887, 0xFFFF, 0x5DB8, 0xFFFF, 0x5DC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DC5, 0xFFFF,
+    0xFFFF, 0x5DC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DCB, 0xFFFF, 0x5DC9, 0x4E4B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DCE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5589, 0xFFFF, 0x5DC8, 0xFFFF, 0x5DCA, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DCC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4BD0, 0x50BE, 0x5DCF, 0x4ACE, 0xFFFF, 0xFFFF, 0x5DC4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DD4, 0x5DD1, 0xFFFF, 0xFFFF, 0x5DD3, 0xFFFF, 0xFFFF, 0x5DCD, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DD0,
+    0x5380, 0x507E, 0xFFFF, 0xFFFF, 0x51D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55A3, 0x5DD2, 0xFFFF, 0x5DD6, 0x4DD4,
+    0xFFFF, 0x5055, 0xFFFF, 0x5DE2, 0xFFFF, 0x5DD5, 0x6658, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DDB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5187, 0xFFFF,
+  },
+  { /* U+70xx */
+    0xFFFF, 0x5DDD, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DD7, 0xFFFF, 0x5DD8, 0xFFFF, 0x5DD9, 0xFFFF, 0x5DDA, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DDE,
+    0xFFFF, 0x5DDC, 0xFFFF, 0xFFFF, 0xFFFF, 0x55D1, 0xFFFF, 0xFFFF, 0x5DE4, 0xFFFF, 0x5DE0, 0x5DDF, 0xFFFF, 0x52B0, 0x535C, 0x5DE1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FDE, 0x52AE, 0x5DE3, 0xFFFF, 0xFFFF, 0xFFFF, 0x465B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5DE5, 0xFFFF, 0x5DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53EA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DE8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5DE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4785, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B65,
+    0x4AF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5473, 0xFFFF, 0xFFFF, 0xFFFF, 0x546A, 0x4CBC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEA, 0xFFFF, 0xFFFF, 0xFFFF, 0x497D, 0x4FCB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DAD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4FEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DED, 0x5DEE, 0x4861, 0x5DF0, 0x5DEC,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x52CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEF, 0x4788, 0x49D7, 0x529E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DD1, 0xFFFF, 0xFFFF, 0x5DF2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5099,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF3, 0xFFFF, 0xFFFF, 0xFFFF, 0x538C, 0xFFFF, 0x5DF1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5587, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF8, 0xFFFF, 0xFFFF,
+  },
+  { /* U+71xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DFA, 0x544F, 0xFFFF, 0x5DF9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x475F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DE6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4983, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DFC, 0x5DFD, 0xFFFF, 0x4C6F, 0xFFFF, 0xFFFF, 0x5E42, 0xFFFF, 0x5490, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6885, 0x5E43, 0xFFFF, 0xFFFF, 0x4BDD, 0xFFFF, 0xFFFF, 0x5DFB, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5E41, 0xFFFF, 0x54EA, 0x5357, 0x5DFE, 0x4742, 0xFFFF, 0x54A0, 0xFFFF, 0xFFFF, 0x5E44, 0xFFFF, 0x4C4C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5590, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E47, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E45, 0xFFFF, 0x467F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E46,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x529D, 0x5E48, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F68, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EBF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54BB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E4A, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x47D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E4D, 0xFFFF,
+    0xFFFF, 0x5E4B, 0xFFFF, 0x49D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EF8, 0x5E50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E53, 0xFFFF,
+    0x4A79, 0xFFFF, 0x5E4E, 0xFFFF, 0x5E51, 0x5047, 0xFFFF, 0x5E52, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57FB,
+    0x5E55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C66, 0x54CE, 0x5E4F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E56, 0x54E6, 0x578F, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E54, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E59, 0xFFFF, 0x5E57, 0x5E58, 0xFFFF, 0x5E5A, 0x5E5B,
+  },
+  { /* U+72xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E5C, 0xFFFF, 0xFFFF,
+    0x5E5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x537C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E5E, 0xFFFF, 0x4C87, 0xFFFF, 0x5E60, 0x5E5F, 0xFFFF, 0xFFFF,
+    0x5E61, 0xFFFF, 0x5E62, 0xFFFF, 0xFFFF, 0x53A9, 0x45CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5096, 0x5E63, 0x5E64, 0x52DD, 0x4C79, 0x5E65,
+    0x5E66, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E67, 0x4767, 0x4ABD, 0xFFFF, 0xFFFF, 0x5E68, 0x556F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x55DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E69, 0x53FC, 0xFFFF, 0x4973, 0xFFFF, 0x55B7, 0xFFFF, 0x4AAF,
+    0xFFFF, 0x509A, 0x55C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x487B, 0xFFFF, 0x4652, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5158, 0xFFFF, 0x5E6A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46A2, 0xFFFF, 0xFFFF, 0xFFFF, 0x548A, 0x5E6B, 0xFFFF,
+    0x5354, 0x5E6C, 0x5E6E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5E6F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E70, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4FDC, 0xFFFF, 0x5E71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AC5, 0xFFFF, 0xFFFF, 0x4CA7,
+    0xFFFF, 0x5E73, 0x5E74, 0xFFFF, 0xFFFF, 0xFFFF, 0x4852, 0xFFFF, 0xFFFF, 0x5E79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E75, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4E5A, 0x5E76, 0x5E78, 0xFFFF, 0x5E77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E7A, 0xFFFF,
+    0x51DB, 0xFFFF, 0x5E7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5274, 0xFFFF, 0x4ECF, 0xFFFF, 0x50DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5E7D, 0x5E7E, 0x5E7C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A7B, 0xFFFF, 0xFFFF, 0x4ADB, 0x4C9E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E80, 0x52FE, 0x5E7F, 0xFFFF, 0xFFFF, 0x506F, 0x54D6, 0xFFFF, 0xFFFF,
+  },
+  { /* U+73xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E82, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E84, 0x5E81, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A51, 0x5E83, 0x5E85, 0xFFFF, 0x4E9D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E86, 0x5E8B, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E88, 0x49C5, 0x4FD0, 0xFFFF, 0xFFFF, 0x4F45, 0x5E89,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E87, 0xFFFF, 0x504F, 0x53DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E8C, 0x4C5A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E95, 0x519F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E8E, 0x5E8D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4F65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E92, 0xFFFF, 0x5E91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5E93, 0xFFFF, 0x4D61, 0xFFFF, 0xFFFF, 0x5E96, 0xFFFF, 0x5E94, 0x5E95, 0xFFFF, 0x51CB, 0x5E97, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C6E, 0xFFFF, 0xFFFF, 0x4783, 0xFFFF, 0x45FD, 0xFFFF, 0x49B1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4AF9, 0x5E9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E9C, 0xFFFF, 0x5E99, 0xFFFF, 0xFFFF,
+    0x5E9D, 0xFFFF, 0x4C9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E98, 0x5E9E, 0x5399, 0xFFFF, 0xFFFF, 0x4D5D, 0x5E9B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5EA2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EA5, 0xFFFF,
+    0x4B99, 0xFFFF, 0xFFFF, 0x5EA1, 0xFFFF, 0x5EA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CB9, 0xFFFF, 0xFFFF, 0x5066, 0x5EA3, 0xFFFF,
+    0xFFFF, 0x5EA4, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EA8, 0xFFFF, 0xFFFF, 0x5EA6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46B7, 0xFFFF,
+  },
+  { /* U+74xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x48DB, 0xFFFF, 0x5EA9, 0x45EB, 0x5EA7, 0xFFFF, 0x50F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4E5C, 0xFFFF, 0xFFFF, 0x5EAC, 0x5EAA, 0xFFFF, 0xFFFF, 0x5EAD, 0x5EAB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EAE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5EAF, 0x5453, 0x4CD8, 0x52A3, 0x529F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB2,
+    0xFFFF, 0x5EB5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB1, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB4, 0x53F1, 0x4F52, 0x5EB6, 0xFFFF, 0x4B5B, 0x5EB3,
+    0x508C, 0xFFFF, 0x5EBC, 0x5EB9, 0x5EBB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB7, 0x5EBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EBE,
+    0x5EB8, 0xFFFF, 0xFFFF, 0x5188, 0xFFFF, 0xFFFF, 0x6883, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EBF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x528C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EBD, 0xFFFF, 0x504D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC1, 0x5EC0,
+    0xFFFF, 0xFFFF, 0x5EC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4AB9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5249, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E64, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5EC7, 0xFFFF, 0x5452, 0x5EC8, 0xFFFF, 0xFFFF, 0x49C2, 0x5EC9, 0xFFFF, 0x5ECA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ECB, 0xFFFF,
+    0x5ECC, 0x5ECE, 0x5ECD, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CD4, 0x5ECF, 0x5ED0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+75xx */
+    0xFFFF, 0x5ED1, 0xFFFF, 0x5ED3, 0x5ED2, 0x5ED4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ED6, 0x5ED5, 0x5ED7, 0xFFFF,
+    0xFFFF, 0x5495, 0xFFFF, 0x5ED8, 0xFFFF, 0x53E6, 0xFFFF, 0xFFFF, 0x4B55, 0xFFFF, 0x4B66, 0xFFFF, 0x52A7, 0xFFFF, 0x5ED9, 0x4599,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x45C0, 0xFFFF, 0x55D7, 0x5EDA, 0xFFFF, 0x45B6, 0xFFFF, 0xFFFF, 0x4D58, 0x5EDB, 0xFFFF, 0xFFFF, 0x58FE,
+    0x4563, 0x467C, 0x48A0, 0x4967, 0xFFFF, 0xFFFF, 0xFFFF, 0x457C, 0x5765, 0xFFFF, 0x4555, 0x4677, 0x5EDC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EDD, 0xFFFF, 0x5EE1, 0xFFFF, 0xFFFF, 0x5EE0, 0x5EDF, 0x5B7C, 0x47AE, 0x5EDE, 0xFFFF, 0x558F,
+    0xFFFF, 0x478B, 0xFFFF, 0xFFFF, 0x4EDC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47AB, 0x5EE3, 0x5EE2, 0x4D72, 0x5086, 0xFFFF, 0xFFFF,
+    0x49FE, 0xFFFF, 0x559A, 0xFFFF, 0x5EE4, 0x4CF0, 0x51B4, 0x5EE5, 0xFFFF, 0x52FD, 0x48B9, 0x5EE6, 0xFFFF, 0x5EE9, 0xFFFF, 0x5EE7,
+    0x4AA9, 0xFFFF, 0xFFFF, 0x4E54, 0x5EE8, 0xFFFF, 0x5EEB, 0x50DD, 0x5EEA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50D4,
+    0xFFFF, 0xFFFF, 0x5EEC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EED, 0x5EEE, 0xFFFF, 0x5EF0, 0x5EEF, 0x4EA0, 0xFFFF, 0xFFFF, 0x5171, 0x55B0,
+    0xFFFF, 0x4CB4, 0xFFFF, 0xFFFF, 0x5EF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EF2, 0xFFFF, 0xFFFF, 0x5EF3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5EF5, 0xFFFF, 0x5EF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5EFD, 0x4D97, 0x5EF7, 0xFFFF, 0x5EF9, 0xFFFF, 0xFFFF, 0x5EFB, 0x54E1, 0xFFFF, 0xFFFF, 0x5EFC, 0x5EFA, 0x5142, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5EF6, 0x5EF8, 0xFFFF, 0x49BF, 0xFFFF, 0x4E4A, 0xFFFF, 0xFFFF, 0x5F41, 0xFFFF, 0xFFFF, 0x5EFE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5F42, 0xFFFF, 0x5182, 0x53FD, 0xFFFF, 0xFFFF, 0x5549, 0x5F43, 0xFFFF, 0x4C47, 0xFFFF, 0xFFFF, 0x5F45, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5174, 0x5F44, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54A4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5F4A, 0xFFFF, 0x5F4C, 0x5F4D, 0x5089, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F4B, 0xFFFF, 0x5F48, 0xFFFF, 0x5F46, 0x5F47,
+  },
+  { /* U+76xx */
+    0xFFFF, 0x5F49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F4F, 0xFFFF, 0x5F4E, 0xFFFF, 0x524F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F50,
+    0x5F52, 0x5F53, 0x5F54, 0xFFFF, 0x5F55, 0xFFFF, 0xFFFF, 0x5F51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5F57, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F56, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F58, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4BB7, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F5C, 0x5F59, 0x5F5A, 0xFFFF, 0xFFFF, 0xFFFF, 0x5447, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x53AA, 0xFFFF, 0xFFFF, 0xFFFF, 0x537E, 0xFFFF, 0x5F5B, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F5D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5F5E, 0x5F5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F62, 0x5F60, 0x5F61, 0x5F63, 0xFFFF, 0x5F64, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5F65, 0xFFFF, 0x5F66, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F67, 0xFFFF, 0x539A, 0xFFFF, 0x464B, 0x46E8, 0x5F68, 0x4659, 0x454B, 0xFFFF,
+    0x5F6A, 0xFFFF, 0x5F69, 0x5F6B, 0x45EF, 0xFFFF, 0x4AB0, 0x4CBB, 0x5F6C, 0xFFFF, 0xFFFF, 0x5F6D, 0xFFFF, 0xFFFF, 0x5299, 0xFFFF,
+    0x52A4, 0xFFFF, 0xFFFF, 0x4E81, 0xFFFF, 0xFFFF, 0x5396, 0xFFFF, 0xFFFF, 0x5F6E, 0x5F6F, 0x5F72, 0x5F70, 0xFFFF, 0x5F71, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F73, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49DA, 0xFFFF,
+    0x5F74, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F75, 0xFFFF, 0xFFFF, 0x6868, 0x5F76, 0x5F77, 0x5F78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DC7,
+    0xFFFF, 0xFFFF, 0x5F79, 0x53BA, 0xFFFF, 0xFFFF, 0x5057, 0xFFFF, 0x51B5, 0xFFFF, 0x4774, 0xFFFF, 0xFFFF, 0x5F7B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5F7D, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F7C, 0x4D65, 0xFFFF, 0xFFFF, 0xFFFF, 0x4844, 0x5CC9, 0xFFFF, 0x5F7E, 0x4B84,
+    0xFFFF, 0x5F7F, 0xFFFF, 0x49E3, 0x4890, 0x5F80, 0xFFFF, 0x53F7, 0xFFFF, 0xFFFF, 0x5F81, 0xFFFF, 0xFFFF, 0xFFFF, 0x4675, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5080, 0xFFFF, 0x4674, 0xFFFF, 0xFFFF, 0xFFFF, 0x4678, 0xFFFF, 0xFFFF, 0x5F83, 0xFFFF, 0xFFFF, 0x5082, 0xFFFF,
+  },
+  { /* U+77xx */
+    0xFFFF, 0x4847, 0xFFFF, 0xFFFF, 0x5F86, 0xFFFF, 0xFFFF, 0x5F85, 0x5F84, 0x52BC, 0xFFFF, 0x4DA2, 0x4552, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F8B, 0xFFFF, 0xFFFF, 0x51CA, 0x4642,
+    0x4E6A, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F87, 0x5F89, 0x5F8A, 0xFFFF, 0xFFFF, 0x5F88, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F8C, 0x5F8D, 0xFFFF, 0x4E5F, 0xFFFF, 0x49A5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x47AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F8E, 0x5F8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F90, 0x5F93, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x526C, 0xFFFF, 0x4A73, 0xFFFF, 0x5F94, 0x4A96, 0xFFFF, 0x5F91, 0xFFFF, 0xFFFF, 0x5F92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F97, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F96, 0x5F95,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F99, 0xFFFF, 0xFFFF, 0x5F98, 0xFFFF,
+    0xFFFF, 0x5F9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F9C, 0xFFFF,
+    0x5F9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5572, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DB0, 0x527D, 0xFFFF, 0xFFFF,
+    0x5F9D, 0xFFFF, 0xFFFF, 0x4F9B, 0xFFFF, 0xFFFF, 0x5F9E, 0xFFFF, 0xFFFF, 0x5F9F, 0xFFFF, 0x5FA3, 0x5FA1, 0x5FA2, 0xFFFF, 0x5FA0,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FA4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FA5, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5350, 0xFFFF, 0xFFFF, 0x5FA6, 0x50ED, 0x5FA7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x46C1, 0x5FA8, 0xFFFF, 0x45B0, 0xFFFF, 0x55C9, 0xFFFF, 0x4E4D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A82, 0x5FA9, 0x51BB,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4580, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FAB, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+78xx */
+    0xFFFF, 0xFFFF, 0x495B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FAC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5FAD, 0xFFFF, 0x46D3, 0x4CC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5FB0, 0x5FAE, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D45, 0x54B4, 0x5248, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4CC2, 0xFFFF, 0x4ABE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FAF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB2, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4976, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4984, 0x4AEF, 0xFFFF, 0xFFFF, 0x5369,
+    0xFFFF, 0xFFFF, 0x52BF, 0xFFFF, 0x5FB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB6, 0xFFFF, 0x5FB9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4F4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB7, 0x5195, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FBA, 0x5356, 0x5FB5, 0xFFFF,
+    0xFFFF, 0x517B, 0xFFFF, 0x4FB1, 0xFFFF, 0x52D2, 0xFFFF, 0x545B, 0xFFFF, 0xFFFF, 0x5FB8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5FBB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DF8, 0xFFFF, 0x507D, 0x5FBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FBE,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FBC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x487A, 0xFFFF, 0x5FC4, 0xFFFF, 0x5FC3, 0xFFFF,
+    0xFFFF, 0x4A62, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC5, 0x5FC0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC6, 0x5FC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4B9C, 0x5FBF, 0xFFFF, 0xFFFF, 0x5FC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC8, 0x49B4, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC7, 0xFFFF, 0xFFFF, 0x48AA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FCB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FCA, 0xFFFF, 0xFFFF,
+  },
+  { /* U+79xx */
+    0xFFFF, 0x51B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FCC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C9C, 0xFFFF,
+    0xFFFF, 0x5FCD, 0x4DF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FCE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x514C, 0x5FD0, 0x5FCF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5FD1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4853, 0xFFFF, 0x4958, 0xFFFF, 0x4663, 0xFFFF,
+    0x5FD3, 0x53D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5192, 0x4ED8, 0x4FEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x488C, 0xFFFF, 0xFFFF, 0x555C, 0xFFFF, 0x5FD8, 0x4CDC, 0x5365, 0xFFFF, 0xFFFF, 0x5FD7, 0xFFFF, 0xFFFF, 0x4CEB, 0x45A1, 0x5FD6,
+    0x5FD4, 0xFFFF, 0x4F89, 0xFFFF, 0xFFFF, 0x49F9, 0xFFFF, 0xFFFF, 0x4DBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C71, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5553, 0xFFFF, 0xFFFF, 0x52D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FDA,
+    0x50E7, 0x4D75, 0xFFFF, 0xFFFF, 0x50AE, 0x4F87, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FDB, 0xFFFF, 0xFFFF, 0x5286, 0x4BA7, 0x458B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FDC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FDF, 0xFFFF, 0x5FDE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55AA, 0x4FD7, 0xFFFF, 0xFFFF, 0x5FE0, 0xFFFF, 0xFFFF, 0xFFFF, 0x54F5, 0xFFFF,
+    0x50FA, 0xFFFF, 0xFFFF, 0x5FE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x536A, 0x5FE2, 0xFFFF, 0xFFFF, 0x555D, 0x5463, 0x53D0,
+    0x45F1, 0x46C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FE3, 0xFFFF, 0x4658, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x48ED, 0x4DBA, 0xFFFF, 0xFFFF, 0x5FE4, 0xFFFF, 0xFFFF, 0x4C70, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D83,
+    0xFFFF, 0x54B5, 0xFFFF, 0x5FE7, 0x508F, 0xFFFF, 0x4C8A, 0x5FE5, 0xFFFF, 0x4D9F, 0xFFFF, 0xFFFF, 0x5FE6, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4BDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4975, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Axx */
+    0x5264, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FE8, 0xFFFF, 0xFFFF, 0x47F4, 0xFFFF, 0x5FE9, 0x47C4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47FA, 0xFFFF, 0xFFFF, 0x5087, 0x5FEA, 0x5FEB, 0x4DCF, 0xFFFF, 0x5296, 0xFFFF, 0xFFFF, 0x5FEC,
+    0x5366, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4692, 0xFFFF,
+    0xFFFF, 0x5FED, 0x476A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FEF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FF0, 0x4DBE, 0x4FC7, 0x5FEE, 0x4FD5,
+    0x4E94, 0xFFFF, 0x48D4, 0x5FF1, 0xFFFF, 0xFFFF, 0x52BE, 0xFFFF, 0xFFFF, 0x5FF3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4891, 0x5254, 0x50B8,
+    0x509B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FF2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5FF5, 0x5FF4, 0x4E98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FF6, 0xFFFF, 0x4F5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5FF8, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B86, 0xFFFF, 0x4986, 0xFFFF, 0xFFFF, 0x5FF9, 0x478D, 0xFFFF, 0xFFFF, 0x5FFA, 0xFFFF, 0x4E91,
+    0xFFFF, 0x4AFD, 0xFFFF, 0x5169, 0x5499, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4FB0, 0x4BE9, 0xFFFF, 0x5FFC, 0x5FFE, 0x6041, 0x5FFD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50A6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6042, 0x4A65, 0xFFFF, 0xFFFF, 0xFFFF, 0x50AA, 0x49A7,
+    0x6043, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6044, 0xFFFF, 0xFFFF, 0xFFFF, 0x559E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6047,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6046, 0x6049, 0x6048, 0xFFFF, 0x604A, 0x52F0, 0xFFFF, 0x604B, 0x45DD, 0xFFFF, 0x604C, 0xFFFF, 0x604D,
+    0xFFFF, 0x604F, 0x604E, 0x6051, 0xFFFF, 0x6050, 0xFFFF, 0xFFFF, 0xFFFF, 0x6052, 0x6053, 0xFFFF, 0x49E7, 0x6054, 0xFFFF, 0x66C1,
+    0x476E, 0x6055, 0x6056, 0x546B, 0xFFFF, 0x4D50, 0x6057, 0x6058, 0xFFFF, 0xFFFF, 0x51C8, 0x605A, 0xFFFF, 0x605B, 0xFFFF, 0x48EF,
+    0x605C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4971, 0xFFFF, 0x605D, 0x45F5, 0x545C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5287,
+  },
+  { /* U+7Bxx */
+    0xFFFF, 0xFFFF, 0x605E, 0xFFFF, 0x54D5, 0xFFFF, 0x6062, 0xFFFF, 0x51CF, 0xFFFF, 0x6061, 0x6060, 0xFFFF, 0xFFFF, 0xFFFF, 0x605F,
+    0xFFFF, 0x49B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53E7, 0x6065, 0xFFFF, 0x4F41, 0xFFFF, 0xFFFF, 0x6066, 0xFFFF,
+    0x47E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52F4, 0x4FD9, 0xFFFF, 0x6068, 0xFFFF, 0xFFFF, 0xFFFF, 0x467E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6063, 0xFFFF, 0x6067, 0x6064, 0xFFFF, 0xFFFF, 0x496E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x606C, 0x4AC7, 0xFFFF, 0x4D9B, 0x46A7, 0xFFFF, 0x4B8F, 0x606B, 0x606A, 0xFFFF, 0x52F5,
+    0x6069, 0x4B45, 0x4B7C, 0xFFFF, 0x49D0, 0xFFFF, 0x46C9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x606D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5484, 0xFFFF, 0x5048, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x534E, 0xFFFF, 0x6073, 0xFFFF,
+    0x6071, 0x6072, 0xFFFF, 0xFFFF, 0x6070, 0x606E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x606F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x559B, 0x4F51, 0xFFFF, 0xFFFF, 0xFFFF, 0x55A4, 0xFFFF, 0x6077, 0xFFFF, 0x607B,
+    0xFFFF, 0xFFFF, 0x607A, 0xFFFF, 0x4EE0, 0x4CCC, 0xFFFF, 0x4843, 0x6075, 0x607C, 0x6079, 0xFFFF, 0x6078, 0x6074, 0x6082, 0x6076,
+    0xFFFF, 0x46F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54CA, 0xFFFF, 0xFFFF, 0x518D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4AFB, 0xFFFF, 0xFFFF, 0x6080, 0xFFFF, 0xFFFF, 0xFFFF, 0x505C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x47A1, 0x51E8, 0xFFFF, 0xFFFF, 0x49E8, 0xFFFF, 0x6081, 0x4FB6, 0xFFFF, 0x49A8, 0xFFFF, 0x607E, 0x607F, 0xFFFF, 0xFFFF, 0x607D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6083, 0xFFFF, 0xFFFF,
+    0x4875, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD8, 0x6087, 0x6085, 0xFFFF, 0xFFFF, 0x6084, 0xFFFF, 0xFFFF, 0xFFFF, 0x5444, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x608C, 0xFFFF, 0xFFFF, 0x608E, 0x6086, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Cxx */
+    0x6089, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x608B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x608D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4F53, 0x578A, 0x608A, 0x6088, 0xFFFF, 0xFFFF, 0x517C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6092,
+    0xFFFF, 0x4BEC, 0xFFFF, 0x608F, 0xFFFF, 0xFFFF, 0xFFFF, 0x6090, 0xFFFF, 0xFFFF, 0x6091, 0x6094, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6093, 0x51AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6095, 0x5270, 0x4F4C,
+    0x6096, 0xFFFF, 0xFFFF, 0x6098, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6097, 0x4DFE, 0xFFFF, 0x51F2,
+    0x609A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F99, 0xFFFF, 0x6099, 0xFFFF, 0x609B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x609C,
+    0x4CEE, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0x609D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x609E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x466F, 0xFFFF, 0x609F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FF0, 0xFFFF,
+    0xFFFF, 0x55E7, 0x4E85, 0x60A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x489E, 0xFFFF, 0x4FCC, 0xFFFF, 0x53C9, 0xFFFF, 0xFFFF,
+    0x60A1, 0xFFFF, 0x4CA9, 0xFFFF, 0xFFFF, 0x4C4B, 0xFFFF, 0x4D59, 0x4BF7, 0xFFFF, 0xFFFF, 0x4FC8, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BFB,
+    0xFFFF, 0x60A5, 0x60A3, 0xFFFF, 0x60A2, 0x52AB, 0xFFFF, 0x4BD4, 0x60A7, 0xFFFF, 0xFFFF, 0x60A4, 0xFFFF, 0x60A6, 0x60AB, 0xFFFF,
+    0xFFFF, 0x60AA, 0x60A9, 0x60A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x60AE, 0x466C, 0xFFFF,
+    0x51BC, 0xFFFF, 0x60B0, 0xFFFF, 0xFFFF, 0x60AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5471, 0xFFFF, 0xFFFF, 0xFFFF, 0x5160, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x60B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x4884, 0xFFFF, 0x60B3, 0xFFFF, 0xFFFF, 0xFFFF, 0x60B4, 0xFFFF, 0x5492, 0x518C,
+    0x514B, 0xFFFF, 0x60B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EC5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60B5,
+    0xFFFF, 0xFFFF, 0x60B6, 0xFFFF, 0x60B7, 0xFFFF, 0x60B8, 0xFFFF, 0x46C7, 0xFFFF, 0x52C2, 0x48FA, 0xFFFF, 0xFFFF, 0x51FE, 0xFFFF,
+  },
+  { /* U+7Dxx */
+    0x46DB, 0xFFFF, 0x60BA, 0xFFFF, 0x47BD, 0x4B67, 0x60B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x60BD, 0x4CF9, 0xFFFF, 0x49E2, 0xFFFF, 0xFFFF,
+    0x4FB5, 0xFFFF, 0xFFFF, 0xFFFF, 0x47A6, 0x60BC, 0xFFFF, 0x4F47, 0x4C78, 0x4680, 0x49F3, 0x4FF3, 0x60BB, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x479F, 0x4877, 0x4CF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AF0, 0x5592, 0xFFFF, 0x60C0, 0x5148,
+    0x4768, 0xFFFF, 0x60C1, 0x4E59, 0xFFFF, 0x60C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CE4, 0x4CBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60C2,
+    0xFFFF, 0xFFFF, 0x49F4, 0x5563, 0x46B9, 0x60BE, 0x60C5, 0xFFFF, 0x60C4, 0xFFFF, 0xFFFF, 0x60BF, 0x4688, 0xFFFF, 0x60C9, 0x60CC,
+    0x46BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60D0, 0x60C6, 0xFFFF, 0x506D, 0xFFFF,
+    0xFFFF, 0x4CE7, 0x4EF7, 0x60CD, 0xFFFF, 0xFFFF, 0x4757, 0xFFFF, 0x60CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60CB, 0xFFFF,
+    0xFFFF, 0x4881, 0x5268, 0x60C7, 0xFFFF, 0x4AE4, 0x4AF3, 0xFFFF, 0xFFFF, 0x49F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x54ED, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5374,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x60CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A4A, 0x47CB, 0x54EB, 0x5070, 0xFFFF, 0xFFFF, 0x60DC,
+    0x60DA, 0xFFFF, 0x60D8, 0x60D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60D7, 0x51A3, 0x4880, 0x60D1, 0x60D9,
+    0x60DD, 0x48CB, 0x4A53, 0xFFFF, 0x4DC9, 0x60D3, 0xFFFF, 0x60D4, 0x60DB, 0xFFFF, 0x54D3, 0x54A6, 0xFFFF, 0x60D6, 0x49DC, 0x489D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60D5, 0xFFFF, 0xFFFF, 0x4B97, 0x537D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4793,
+    0xFFFF, 0x48A5, 0x4A9B, 0xFFFF, 0xFFFF, 0x60DE, 0x60E1, 0xFFFF, 0x60DF, 0xFFFF, 0x4687, 0xFFFF, 0x60E8, 0x60E0, 0x60E3, 0xFFFF,
+    0x4A80, 0x60E7, 0xFFFF, 0xFFFF, 0x60E2, 0xFFFF, 0xFFFF, 0xFFFF, 0x484E, 0x4CFC, 0xFFFF, 0xFFFF, 0x556B, 0xFFFF, 0xFFFF, 0x4E9A,
+    0xFFFF, 0xFFFF, 0x60E6, 0xFFFF, 0x4860, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Exx */
+    0xFFFF, 0x4BAA, 0xFFFF, 0xFFFF, 0x4859, 0x60E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x60EE, 0x60EA, 0x60E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x60EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52E6, 0xFFFF, 0xFFFF, 0x4F6B, 0x60ED,
+    0xFFFF, 0x60EB, 0x5BCC, 0x55A8, 0xFFFF, 0xFFFF, 0x4E93, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49E4, 0xFFFF, 0xFFFF, 0x49F7, 0xFFFF,
+    0xFFFF, 0x60F2, 0x60F9, 0xFFFF, 0xFFFF, 0x60F4, 0xFFFF, 0x60F8, 0xFFFF, 0x60F6, 0x60EF, 0x60F5, 0xFFFF, 0x60F3, 0x4866, 0xFFFF,
+    0xFFFF, 0x4759, 0xFFFF, 0x60F7, 0xFFFF, 0xFFFF, 0x60F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x4868, 0x5373, 0xFFFF, 0x52DA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x60FD, 0xFFFF, 0x489A, 0x51D4, 0x60FB, 0xFFFF, 0xFFFF, 0x60FE, 0x6141, 0xFFFF, 0xFFFF, 0x60FA, 0x60FC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60F1, 0x6142, 0xFFFF, 0x6145, 0x6144, 0xFFFF, 0xFFFF, 0x4D9A, 0xFFFF, 0xFFFF,
+    0x4B69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6143, 0xFFFF, 0x6147, 0x6146, 0x6148, 0xFFFF, 0x614A,
+    0xFFFF, 0xFFFF, 0x55EB, 0x614B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5278, 0x614C, 0x51BF, 0xFFFF, 0x614E, 0xFFFF, 0x614D, 0x55FA,
+    0x5273, 0xFFFF, 0x614F, 0x6150, 0x6151, 0xFFFF, 0x6152, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6153, 0x539C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5084, 0xFFFF, 0x6154, 0xFFFF, 0x6155, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6156, 0xFFFF, 0x6157, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6158, 0x54CB, 0x6159, 0xFFFF,
+    0x516E, 0x615A, 0xFFFF, 0xFFFF, 0x615C, 0x615B, 0xFFFF, 0xFFFF, 0x615D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x615E,
+    0x615F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6161, 0x6160, 0x6162, 0x4C4E, 0x55EF, 0xFFFF, 0xFFFF, 0x468C, 0xFFFF,
+    0x4F82, 0xFFFF, 0x4C99, 0xFFFF, 0xFFFF, 0x5579, 0xFFFF, 0x55A5, 0x6163, 0x5AA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6164, 0x6166, 0xFFFF, 0x4DFA, 0x6165, 0x6167, 0x6168, 0xFFFF, 0x4AD1, 0xFFFF, 0x6169, 0xFFFF, 0x457D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x616A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x616D, 0xFFFF, 0xFFFF, 0x616C, 0x616B, 0xFFFF,
+    0xFFFF, 0x616E, 0xFFFF, 0x616F, 0x47B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x5596, 0x4598, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6171, 0x6170,
+    0xFFFF, 0xFFFF, 0x6172, 0xFFFF, 0xFFFF, 0xFFFF, 0x6174, 0xFFFF, 0x6175, 0x6173, 0xFFFF, 0xFFFF, 0xFFFF, 0x478F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4FFB, 0xFFFF, 0xFFFF, 0xFFFF, 0x6178, 0x6179, 0xFFFF, 0xFFFF, 0xFFFF, 0x617A, 0xFFFF, 0x4D9C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4A69, 0xFFFF, 0x54F9, 0x617B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F69, 0x617C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x617D, 0xFFFF, 0xFFFF, 0x617E, 0xFFFF, 0x558B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x54B6, 0xFFFF, 0xFFFF, 0x617F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6180, 0xFFFF, 0x51F6, 0x4DB5, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+80xx */
+    0x52A0, 0x4985, 0xFFFF, 0x4760, 0x6181, 0x4670, 0x53DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6182, 0x51E6, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x498E, 0xFFFF, 0x6183, 0xFFFF, 0xFFFF, 0x499A, 0xFFFF, 0x4FEC, 0x54E4, 0x6184, 0xFFFF, 0xFFFF, 0x6185, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6187, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4CAB, 0xFFFF, 0xFFFF, 0x4E99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6189, 0xFFFF, 0x55B8, 0xFFFF, 0x6188,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x618B, 0xFFFF, 0xFFFF, 0xFFFF, 0x618A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x618C, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BB5, 0xFFFF, 0x618D, 0xFFFF, 0x5479, 0xFFFF, 0xFFFF, 0xFFFF, 0x48BB, 0x618E,
+    0xFFFF, 0x4B89, 0x618F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6190, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53CA,
+    0x6193, 0xFFFF, 0x6192, 0x6191, 0x4DA8, 0xFFFF, 0x6194, 0x48D7, 0xFFFF, 0x6195, 0xFFFF, 0xFFFF, 0xFFFF, 0x6196, 0x53E4, 0x6197,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6198, 0x6199, 0x53B6, 0x4B41, 0xFFFF, 0x4A42, 0xFFFF, 0x557F, 0x4E50, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x619A, 0xFFFF, 0xFFFF, 0x5267, 0xFFFF, 0x526A, 0xFFFF, 0x619B, 0x5292, 0xFFFF, 0x4C8C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4CC5, 0x5382, 0xFFFF, 0xFFFF, 0x497B, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B79, 0x4CFB, 0xFFFF, 0x619E, 0x619C, 0xFFFF, 0x50EB,
+    0xFFFF, 0x52D5, 0x48AC, 0xFFFF, 0x5451, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x504E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4DF6, 0x61A3, 0xFFFF, 0x4E9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AB2, 0xFFFF, 0x5263, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5288, 0xFFFF, 0xFFFF, 0x61A1, 0x61A4, 0x619F, 0xFFFF, 0x61A2, 0x50B6, 0xFFFF,
+    0xFFFF, 0x4D63, 0xFFFF, 0xFFFF, 0x4EE9, 0x61A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61A6,
+    0xFFFF, 0x61A7, 0xFFFF, 0xFFFF, 0x4EAB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BE3, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B0, 0x474F, 0xFFFF, 0xFFFF,
+  },
+  { /* U+81xx */
+    0xFFFF, 0xFFFF, 0x4874, 0xFFFF, 0xFFFF, 0x5051, 0x55EC, 0x47E3, 0x5079, 0x61A5, 0x535E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D5C, 0x61A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x61A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61AA,
+    0xFFFF, 0x4AB4, 0xFFFF, 0x4CB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61AD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61AB, 0xFFFF, 0xFFFF, 0x52C4, 0xFFFF,
+    0x4D62, 0x61AF, 0xFFFF, 0x61AE, 0x5247, 0x4CAF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B3, 0x61B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51CE, 0xFFFF, 0xFFFF, 0x61B2, 0xFFFF,
+    0x4BA4, 0x61B1, 0xFFFF, 0xFFFF, 0x61B6, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DB6, 0x4CA0, 0x526F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x529A,
+    0x61BA, 0xFFFF, 0x61BB, 0x61B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B8, 0xFFFF, 0x61B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x61BF, 0xFFFF, 0x61BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5191, 0xFFFF, 0x4D8A, 0x5060, 0xFFFF, 0xFFFF,
+    0x61BC, 0xFFFF, 0xFFFF, 0x61BE, 0x61C1, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EF6, 0x61C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x61C4, 0xFFFF, 0xFFFF, 0x5076, 0xFFFF, 0x61C0, 0xFFFF, 0xFFFF, 0x61C3, 0xFFFF, 0x61CA, 0xFFFF, 0xFFFF, 0x61C7, 0x61C6, 0x535F,
+    0x61C8, 0xFFFF, 0x61C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5474, 0xFFFF, 0x61C5, 0x61CB, 0xFFFF, 0xFFFF, 0xFFFF, 0x61CC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x61CD, 0xFFFF, 0x4DBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61CE, 0x61CF, 0x61D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61D1,
+    0x61D2, 0xFFFF, 0xFFFF, 0x4A47, 0xFFFF, 0x538A, 0xFFFF, 0x5173, 0x4CD0, 0xFFFF, 0x45C3, 0xFFFF, 0xFFFF, 0x4DB3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4A48, 0x4C6A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61D3, 0x61D4, 0x4A89, 0xFFFF, 0x61D5, 0xFFFF,
+  },
+  { /* U+82xx */
+    0xFFFF, 0x61D6, 0x61D7, 0xFFFF, 0xFFFF, 0x61D8, 0xFFFF, 0x5358, 0x466A, 0x5778, 0x62BA, 0xFFFF, 0x5094, 0x61D9, 0x4C58, 0xFFFF,
+    0x61DA, 0xFFFF, 0x61DB, 0xFFFF, 0xFFFF, 0xFFFF, 0x61DC, 0x4E5B, 0x4CAA, 0xFFFF, 0xFFFF, 0x4FC1, 0x4FB8, 0xFFFF, 0x4A63, 0x4BB8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61DD, 0x489F, 0x61DE, 0x4956, 0xFFFF, 0x61DF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x61E1, 0xFFFF, 0x54DB, 0x4B87, 0x53AC, 0x61E0, 0x467B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x61E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DFC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54AE, 0x61E3, 0x61E4, 0xFFFF, 0xFFFF, 0x61E5, 0xFFFF, 0x61E6,
+    0xFFFF, 0xFFFF, 0x61E8, 0xFFFF, 0x61E7, 0xFFFF, 0x4C4A, 0xFFFF, 0x61E9, 0xFFFF, 0x61EA, 0x61EB, 0xFFFF, 0xFFFF, 0x55B4, 0x45C4,
+    0xFFFF, 0x61EC, 0x47C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D54, 0x61ED, 0x53C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61EE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x519A, 0xFFFF, 0x61EF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x61F0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EBD, 0xFFFF, 0xFFFF, 0xFFFF, 0x4972, 0xFFFF, 0x61F2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F7B, 0x4ADD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61F1, 0x61F4, 0x5442, 0xFFFF, 0x4FE5,
+    0xFFFF, 0x46D9, 0xFFFF, 0x4683, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4953, 0x4DD0, 0xFFFF, 0x61F3, 0xFFFF, 0x4EBA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x504B, 0x61F9, 0x5559, 0x52D7, 0xFFFF, 0xFFFF, 0x4AB8, 0xFFFF, 0x6246, 0xFFFF, 0x5377, 0x6243, 0xFFFF, 0x6241, 0x61F7,
+    0xFFFF, 0x61F5, 0xFFFF, 0x61F6, 0xFFFF, 0x46D6, 0x4A5F, 0x54B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x45EE, 0xFFFF, 0x61FB, 0x61FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61FE, 0x6244, 0x61FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+83xx */
+    0xFFFF, 0x61F8, 0x4646, 0x61FC, 0x547A, 0x4BD3, 0x6242, 0xFFFF, 0xFFFF, 0x6245, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EC9, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x624A, 0x53F6, 0x6252, 0xFFFF, 0xFFFF, 0xFFFF, 0x50E2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6258, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x474C, 0xFFFF, 0xFFFF, 0x6251, 0xFFFF, 0xFFFF, 0xFFFF, 0x6250,
+    0xFFFF, 0x624B, 0x547B, 0xFFFF, 0x6249, 0x6247, 0x4977, 0xFFFF, 0x4DF7, 0x624D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x624C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x624F, 0xFFFF, 0xFFFF, 0xFFFF, 0x4842, 0x53B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x515F,
+    0x624E, 0xFFFF, 0x46DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B62, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6248, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x625F, 0xFFFF, 0x625A, 0xFFFF, 0x4BA1, 0xFFFF, 0xFFFF, 0xFFFF, 0x49E0, 0x625D, 0xFFFF, 0xFFFF, 0x625B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6262, 0xFFFF, 0x5486, 0xFFFF, 0x6263, 0x625C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6259, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6260, 0xFFFF, 0xFFFF, 0x6257, 0xFFFF, 0xFFFF, 0xFFFF, 0x6253, 0xFFFF, 0xFFFF, 0xFFFF, 0x51EE, 0x6255,
+    0x6261, 0xFFFF, 0x6256, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6264, 0xFFFF, 0x6254, 0x54B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x52C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x625E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6275, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x626E, 0xFFFF, 0xFFFF, 0xFFFF, 0x4753, 0xFFFF, 0x6267, 0xFFFF, 0xFFFF, 0x46D7, 0xFFFF, 0x4C73, 0xFFFF, 0x6268, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4C51, 0xFFFF, 0xFFFF, 0x5180, 0xFFFF, 0x626C, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BA8, 0xFFFF, 0xFFFF, 0x53D4,
+    0x6270, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x516A, 0xFFFF, 0x54E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B6C,
+    0x516D, 0x48CC, 0x6271, 0xFFFF, 0x6265, 0xFFFF, 0x6274, 0x6269, 0xFFFF, 0xFFFF, 0xFFFF, 0x6276, 0xFFFF, 0x626A, 0xFFFF, 0xFFFF,
+  },
+  { /* U+84xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x626B, 0x54F7, 0xFFFF, 0xFFFF, 0x626F, 0xFFFF, 0xFFFF, 0xFFFF, 0x626D, 0x50DB, 0x6272, 0x5482, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6266, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x6273, 0xFFFF, 0x54D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x494A, 0x6277, 0xFFFF, 0x4B75, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4F7C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6285, 0xFFFF, 0xFFFF, 0x6284, 0xFFFF, 0xFFFF, 0xFFFF, 0x6279, 0x47F2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6282, 0xFFFF, 0x627E, 0x45F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x559F, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A59, 0xFFFF, 0xFFFF, 0xFFFF, 0x48DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5547, 0x6278, 0x5071, 0xFFFF, 0xFFFF, 0x4E72, 0xFFFF, 0xFFFF, 0x6281, 0xFFFF, 0x627C, 0x4F79, 0x516C, 0x627F, 0x6283,
+    0xFFFF, 0x544E, 0xFFFF, 0xFFFF, 0xFFFF, 0x50D9, 0xFFFF, 0x627B, 0xFFFF, 0x627D, 0x50E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6280, 0xFFFF, 0x627A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F93, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FE3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5095, 0xFFFF, 0xFFFF, 0x5259, 0xFFFF, 0xFFFF, 0x6289,
+    0xFFFF, 0x6293, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6290, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x49B2, 0xFFFF, 0x628A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4ABA, 0x6287, 0xFFFF, 0x628C, 0x50B9, 0xFFFF, 0xFFFF, 0x6288,
+    0xFFFF, 0x628F, 0xFFFF, 0xFFFF, 0x4C94, 0xFFFF, 0x6291, 0xFFFF, 0xFFFF, 0x5083, 0x6286, 0x4F6D, 0xFFFF, 0x628B, 0xFFFF, 0xFFFF,
+    0x628E, 0x4F9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6292, 0xFFFF, 0xFFFF, 0x6294, 0x628D, 0xFFFF, 0x527B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5088, 0xFFFF, 0x4BF4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6296, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x518B, 0xFFFF, 0xFFFF, 0x6295,
+  },
+  { /* U+85xx */
+    0x52BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x629D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x556C, 0xFFFF, 0x557B, 0x629C, 0x629B, 0xFFFF, 0x6297, 0x6298, 0xFFFF, 0x549A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x629A,
+    0xFFFF, 0x54A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6299, 0x4E8B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x465E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54D1, 0xFFFF, 0xFFFF,
+    0x62A0, 0x62A5, 0xFFFF, 0x52F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62A4, 0x53A8, 0x62A6, 0x62A7, 0xFFFF, 0xFFFF, 0x5565, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x629E, 0xFFFF, 0x62A9, 0xFFFF, 0x5491, 0x62A3, 0x62A1, 0x629F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x62A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50DE, 0x54F0, 0x51D3, 0x62A8, 0xFFFF, 0x62B0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62B7, 0xFFFF,
+    0x62AA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A92, 0xFFFF, 0xFFFF, 0x62B4, 0x62AC, 0xFFFF, 0x62AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x62B8, 0x62AD, 0xFFFF, 0xFFFF, 0x62B1, 0xFFFF, 0xFFFF, 0x4CEC, 0xFFFF, 0x51AD, 0xFFFF, 0x62B2, 0x62B5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62AB, 0xFFFF, 0x4FBF, 0xFFFF, 0x62AF, 0x4CF1, 0x545A, 0x4998, 0x46E1, 0xFFFF, 0x62B3, 0x53F9,
+    0x62BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62BF, 0x62BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4FBB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62BC, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EED, 0xFFFF, 0x62BE,
+    0x62C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62C4, 0x62C2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4568, 0x62C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FF6, 0x4C95, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55E2, 0xFFFF, 0x62C5, 0x53ED, 0x505F, 0xFFFF, 0xFFFF, 0x62C9, 0xFFFF,
+  },
+  { /* U+86xx */
+    0xFFFF, 0xFFFF, 0x5496, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EDA, 0x4CBF, 0xFFFF, 0xFFFF, 0x62C6, 0x62C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x62C7, 0xFFFF, 0xFFFF, 0x5CBD, 0x5CBE, 0xFFFF, 0xFFFF, 0x62CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x62CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CA6, 0xFFFF, 0x5F82,
+    0x62CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62CD,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62CF, 0x4AAB, 0xFFFF,
+    0x5260, 0xFFFF, 0xFFFF, 0xFFFF, 0x52FB, 0x62D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F72, 0xFFFF, 0x5250, 0xFFFF, 0x5588, 0x62D2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62D3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BCB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x62D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51B6, 0xFFFF, 0x5144, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FAA, 0x62D8, 0x62DA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x62D5, 0xFFFF, 0x4F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x62D6, 0x55A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62D7, 0x62D9, 0x62E3, 0xFFFF, 0xFFFF, 0xFFFF, 0x62DC,
+    0x62DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62DD, 0xFFFF, 0x62DE, 0x4FEA, 0xFFFF, 0x62E0, 0xFFFF, 0x53D8, 0xFFFF, 0x4DF9, 0x62E1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55BB, 0xFFFF, 0x62E9, 0xFFFF, 0xFFFF, 0x62E5, 0x62E8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62E6, 0xFFFF, 0xFFFF, 0x62E7, 0x4E66, 0x53A5, 0x4F74,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x524E, 0x62F3, 0xFFFF, 0x62EF, 0xFFFF, 0xFFFF, 0x5599, 0xFFFF,
+  },
+  { /* U+87xx */
+    0x62ED, 0xFFFF, 0x4ECD, 0x62EE, 0xFFFF, 0xFFFF, 0x62EB, 0xFFFF, 0x62EC, 0x62F1, 0x62F4, 0xFFFF, 0xFFFF, 0x62F2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x62F0, 0x62EA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54DC, 0xFFFF, 0x62FA, 0xFFFF, 0x53A1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F8, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F5, 0xFFFF, 0xFFFF, 0x526D, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F7, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53E8, 0xFFFF, 0x52A1, 0x62FD, 0xFFFF, 0x62FE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6349, 0xFFFF, 0x5347, 0xFFFF, 0x6342, 0xFFFF, 0x6348, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62FB,
+    0x6346, 0xFFFF, 0xFFFF, 0x634A, 0xFFFF, 0xFFFF, 0x51C3, 0xFFFF, 0x6343, 0xFFFF, 0x6345, 0xFFFF, 0xFFFF, 0xFFFF, 0x6347, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6341, 0xFFFF, 0x4E6E, 0xFFFF, 0x62FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x634B,
+    0xFFFF, 0xFFFF, 0x6344, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48C2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x634E,
+    0xFFFF, 0xFFFF, 0x634C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6355, 0xFFFF, 0xFFFF, 0xFFFF, 0x634F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6357, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D6, 0x6359, 0xFFFF, 0x6351, 0xFFFF, 0xFFFF,
+    0x6352, 0xFFFF, 0xFFFF, 0xFFFF, 0x6356, 0xFFFF, 0x634D, 0x54F4, 0xFFFF, 0xFFFF, 0xFFFF, 0x6350, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x6353, 0xFFFF, 0x6358, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x635C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x635A,
+    0xFFFF, 0xFFFF, 0x635B, 0xFFFF, 0xFFFF, 0xFFFF, 0x6363, 0x6364, 0xFFFF, 0x5090, 0xFFFF, 0x51C6, 0xFFFF, 0xFFFF, 0x6362, 0xFFFF,
+  },
+  { /* U+88xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55BD, 0xFFFF, 0x635E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6361, 0x635D, 0x635F,
+    0xFFFF, 0x6365, 0xFFFF, 0xFFFF, 0xFFFF, 0x6366, 0x6360, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6368, 0x6367, 0x5351, 0xFFFF, 0xFFFF, 0xFFFF, 0x6369, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x636A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x636B, 0xFFFF, 0xFFFF, 0x636C, 0xFFFF, 0x636D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4B43, 0xFFFF, 0x636E, 0xFFFF, 0x636F, 0xFFFF, 0x4B88, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45A4, 0x6370, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6371, 0x486C, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BA5, 0xFFFF, 0x6372, 0xFFFF, 0x4780, 0xFFFF, 0x4DA5, 0x6373, 0xFFFF,
+    0xFFFF, 0x4BED, 0x6374, 0x4AEA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46C0, 0xFFFF, 0xFFFF, 0x6375, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F54, 0xFFFF, 0x637A, 0xFFFF, 0xFFFF, 0x6378, 0xFFFF, 0x52E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6379, 0x6377, 0x4AA7,
+    0xFFFF, 0x6376, 0x637B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F6A, 0xFFFF, 0xFFFF, 0x4A54, 0xFFFF, 0x6382, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x637E, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A57, 0x637D, 0xFFFF, 0x6380, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x637C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6381, 0xFFFF, 0x6383, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B8D, 0xFFFF, 0xFFFF, 0x637F, 0xFFFF,
+    0x54C5, 0x6386, 0xFFFF, 0xFFFF, 0x4F5A, 0x6385, 0xFFFF, 0x5448, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6384,
+    0xFFFF, 0x49BD, 0x4F60, 0x6387, 0x6388, 0x4898, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49A4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6389, 0x46F8, 0xFFFF, 0xFFFF, 0x638A, 0x638B, 0xFFFF, 0xFFFF, 0x496A, 0x638C, 0xFFFF, 0x4F8A,
+    0xFFFF, 0x544D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6391, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6392, 0x4FA8, 0x5349, 0x6390, 0xFFFF, 0xFFFF, 0x4F43, 0x638D, 0xFFFF, 0xFFFF, 0x638F, 0x457B, 0x4C8D, 0xFFFF,
+  },
+  { /* U+89xx */
+    0xFFFF, 0xFFFF, 0x638E, 0xFFFF, 0x6393, 0xFFFF, 0xFFFF, 0x4B51, 0xFFFF, 0xFFFF, 0x6397, 0xFFFF, 0x6394, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x545E, 0xFFFF, 0x51BA, 0x6398, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51DA, 0x6396, 0x6399, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x639A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6395, 0x639B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x639E, 0xFFFF, 0x63A0, 0xFFFF, 0xFFFF, 0x639D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x639C, 0xFFFF, 0x639F, 0x506B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63A2, 0x63A1, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x546C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63A4, 0x54AF,
+    0x63A3, 0xFFFF, 0xFFFF, 0xFFFF, 0x63A7, 0xFFFF, 0x63A5, 0xFFFF, 0xFFFF, 0xFFFF, 0x63A6, 0xFFFF, 0xFFFF, 0x63A8, 0xFFFF, 0x63A9,
+    0xFFFF, 0xFFFF, 0x4DDF, 0xFFFF, 0x63AA, 0xFFFF, 0xFFFF, 0x63AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63AC, 0x4558,
+    0xFFFF, 0x4655, 0xFFFF, 0x63AD, 0xFFFF, 0xFFFF, 0x4DF2, 0x4BFA, 0x63AE, 0xFFFF, 0x63AF, 0x45BB, 0xFFFF, 0xFFFF, 0xFFFF, 0x46FB,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x63B0, 0xFFFF, 0xFFFF, 0x4A50, 0x53EB, 0x63B1, 0xFFFF, 0x4A4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63B4, 0x4ED0, 0xFFFF, 0x63B3, 0x4885, 0xFFFF, 0x63B5, 0xFFFF, 0xFFFF, 0x63B6,
+    0xFFFF, 0xFFFF, 0x63B7, 0x487E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63B8, 0xFFFF, 0xFFFF, 0x63BA, 0xFFFF, 0x63B9,
+    0x63BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x477D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63BC, 0xFFFF, 0x5360, 0x63BD, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x47B7, 0xFFFF, 0xFFFF, 0x4CD1, 0x63BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+8Axx */
+    0x479A, 0xFFFF, 0x4FC4, 0x63C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45C9, 0xFFFF, 0x50F2, 0xFFFF, 0x63C4, 0xFFFF, 0x49D2, 0xFFFF,
+    0x63C3, 0xFFFF, 0x63C5, 0x4BC8, 0xFFFF, 0xFFFF, 0x63C2, 0x4AB6, 0x4794, 0xFFFF, 0xFFFF, 0x63C6, 0xFFFF, 0x63C7, 0xFFFF, 0x50EF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x54CC, 0xFFFF, 0x63C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A71, 0xFFFF, 0xFFFF, 0x45E2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4A9A, 0xFFFF, 0x4BAD, 0x4CDF, 0xFFFF, 0x63C9, 0x63CB, 0xFFFF, 0xFFFF, 0x4D68, 0x4F66, 0x49BA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63CE, 0xFFFF, 0x63CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5176, 0x55E3, 0x63CD, 0xFFFF, 0x4F88, 0x49FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63CC, 0xFFFF, 0xFFFF, 0x4E90, 0xFFFF,
+    0x51C1, 0xFFFF, 0x63D3, 0x54FB, 0xFFFF, 0xFFFF, 0x4948, 0xFFFF, 0xFFFF, 0x4CB0, 0xFFFF, 0x50D3, 0x63D2, 0x63D1, 0x518E, 0xFFFF,
+    0x4B5F, 0x4750, 0x4D8D, 0x4DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63D4, 0xFFFF, 0xFFFF, 0x63D0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x63D6, 0xFFFF, 0x63D7, 0x63D5, 0xFFFF, 0x4EB4, 0xFFFF, 0x4D8C, 0xFFFF, 0xFFFF, 0x4B76, 0x4A7E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63DA, 0xFFFF, 0x4FA0, 0xFFFF, 0x4FA2, 0xFFFF, 0xFFFF, 0x4ACB, 0xFFFF, 0x63DD, 0xFFFF, 0xFFFF, 0xFFFF, 0x48E7, 0xFFFF,
+    0x46FD, 0x63D9, 0xFFFF, 0x63DE, 0x4D91, 0x63DB, 0x63DC, 0x63DF, 0x63D8, 0xFFFF, 0xFFFF, 0xFFFF, 0x4952, 0x4A4F, 0xFFFF, 0xFFFF,
+    0x4B83, 0xFFFF, 0x49D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55F2, 0xFFFF, 0xFFFF, 0x5265, 0xFFFF, 0x63E1, 0x4689,
+    0xFFFF, 0xFFFF, 0x63E3, 0xFFFF, 0x50B2, 0xFFFF, 0xFFFF, 0x4963, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AE8, 0x63E0, 0x63E2, 0xFFFF, 0x4BC1,
+    0xFFFF, 0xFFFF, 0x5181, 0xFFFF, 0xFFFF, 0xFFFF, 0x48F3, 0xFFFF, 0xFFFF, 0xFFFF, 0x63E4, 0x63F2, 0x5570, 0xFFFF, 0x63F1, 0x63ED,
+    0x63EA, 0x63EC, 0x63EB, 0xFFFF, 0x63E7, 0xFFFF, 0x5246, 0x63E6, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E96, 0xFFFF, 0x4E9C, 0x4F9C, 0xFFFF,
+    0xFFFF, 0x63E8, 0xFFFF, 0x63E5, 0xFFFF, 0xFFFF, 0x63EF, 0x63F0, 0x47E2, 0xFFFF, 0x55AB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FE1, 0xFFFF,
+  },
+  { /* U+8Bxx */
+    0x4F4D, 0x54E5, 0x5573, 0xFFFF, 0x4FE2, 0xFFFF, 0xFFFF, 0x63F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63F3, 0xFFFF, 0x52F9, 0xFFFF,
+    0x63F7, 0xFFFF, 0xFFFF, 0xFFFF, 0x63E9, 0xFFFF, 0x63F6, 0x63F8, 0xFFFF, 0x497C, 0x63F5, 0x4A6E, 0xFFFF, 0x4DBB, 0xFFFF, 0xFFFF,
+    0x63F9, 0x4D7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63FD, 0xFFFF, 0x5381, 0xFFFF, 0xFFFF, 0x63FE, 0x55A1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x63FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D87, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6441, 0xFFFF,
+    0xFFFF, 0x63FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6446, 0xFFFF, 0xFFFF, 0x6442, 0xFFFF, 0x6444, 0x6443,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6445, 0xFFFF, 0xFFFF, 0x6447, 0xFFFF, 0x4A75, 0xFFFF, 0x6449, 0x6448, 0x4E4F, 0xFFFF, 0xFFFF, 0x644C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x644B, 0x644D, 0xFFFF, 0xFFFF, 0x644E,
+    0x4781, 0x6176, 0x4B7B, 0xFFFF, 0x644A, 0xFFFF, 0xFFFF, 0x49DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x644F, 0xFFFF, 0x6450,
+    0x6451, 0xFFFF, 0xFFFF, 0x516B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B88, 0xFFFF, 0x6452, 0xFFFF, 0x6453, 0xFFFF,
+    0x53FE, 0xFFFF, 0x6455, 0x6456, 0xFFFF, 0xFFFF, 0x6457, 0xFFFF, 0xFFFF, 0x6454, 0x6458, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+8Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4581, 0xFFFF, 0xFFFF, 0x6459, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x645B,
+    0xFFFF, 0x645A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A99, 0xFFFF, 0x645C, 0xFFFF, 0x4648, 0xFFFF, 0x645D, 0xFFFF, 0x645E, 0xFFFF,
+    0x645F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6460, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4994, 0x6461, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C68, 0x5355, 0x6462, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6463, 0x5593, 0x6464, 0xFFFF, 0x6465, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6466, 0xFFFF, 0xFFFF, 0x6468, 0xFFFF, 0xFFFF, 0xFFFF, 0x6467, 0x6469, 0xFFFF, 0x5064, 0x646A, 0x646B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x646D, 0xFFFF, 0xFFFF, 0xFFFF, 0x646C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49EA, 0x46B6, 0xFFFF,
+    0x49C8, 0x49AF, 0x4AF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DA3, 0x4AEB, 0x4A5D, 0x6470, 0x49A1, 0x4BD2, 0x646F, 0x6471, 0x4C62,
+    0x4DEF, 0xFFFF, 0x6473, 0x6474, 0x487F, 0xFFFF, 0x6476, 0x4974, 0x4AF4, 0xFFFF, 0xFFFF, 0x46D0, 0x507B, 0x6472, 0xFFFF, 0x4872,
+    0x4641, 0x6475, 0x55F8, 0x4B4D, 0x5067, 0xFFFF, 0xFFFF, 0x4650, 0x6477, 0xFFFF, 0x4FFD, 0xFFFF, 0xFFFF, 0x6479, 0x6478, 0xFFFF,
+    0xFFFF, 0x539E, 0xFFFF, 0x50D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x647B, 0x4DEE, 0x4F94, 0xFFFF, 0x4AAD, 0xFFFF,
+    0x4F4F, 0xFFFF, 0x47E5, 0x647A, 0x5566, 0xFFFF, 0x4FA7, 0xFFFF, 0xFFFF, 0xFFFF, 0x46EC, 0xFFFF, 0xFFFF, 0x52C1, 0xFFFF, 0xFFFF,
+    0x647C, 0xFFFF, 0xFFFF, 0xFFFF, 0x647D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x647F, 0x6480, 0x4E8F, 0x647E, 0xFFFF, 0xFFFF,
+  },
+  { /* U+8Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x535A, 0x5574, 0xFFFF, 0x6481, 0x4C7C, 0xFFFF, 0x6482, 0x5584, 0xFFFF, 0x6484, 0xFFFF, 0x6483,
+    0x6486, 0xFFFF, 0x6485, 0x6487, 0x6488, 0xFFFF, 0x6489, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46F9, 0xFFFF, 0x5151, 0x648A, 0xFFFF, 0xFFFF, 0xFFFF, 0x53CC, 0xFFFF, 0x648B, 0xFFFF, 0xFFFF,
+    0x4AAA, 0x648C, 0xFFFF, 0x51C9, 0x50EE, 0xFFFF, 0x648D, 0x48D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x648F, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4CED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5561, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x46FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6492, 0xFFFF, 0xFFFF, 0xFFFF, 0x6491, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6490, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6498, 0x6496, 0xFFFF, 0xFFFF, 0x6493,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6495, 0xFFFF, 0xFFFF, 0xFFFF, 0x6494, 0x6497, 0xFFFF, 0x4DC2, 0xFFFF, 0x649B,
+    0xFFFF, 0x4CCD, 0xFFFF, 0x649C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55CB, 0xFFFF, 0x6499, 0x649A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4784,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x50B4, 0xFFFF, 0x50D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x649D, 0xFFFF, 0xFFFF, 0x649F,
+  },
+  { /* U+8Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x649E, 0x64A0, 0x4CA8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D7C,
+    0x64A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64A1, 0x64A2, 0x64A4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x64A7, 0xFFFF, 0xFFFF, 0xFFFF, 0x64A8, 0x64A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x64A5, 0xFFFF, 0x55A7, 0xFFFF, 0xFFFF, 0x64AA, 0x64AE, 0x64AB, 0x64A9, 0xFFFF, 0x64AC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x64AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64B2, 0xFFFF, 0xFFFF, 0xFFFF, 0x64AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5368,
+    0x64B1, 0xFFFF, 0xFFFF, 0x64B3, 0x64B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x64B5, 0xFFFF, 0x52F6, 0xFFFF, 0x64B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64B7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x64B8, 0xFFFF, 0xFFFF, 0x64BA, 0x64B9, 0xFFFF, 0x64B6, 0xFFFF, 0xFFFF, 0x64BC, 0x64BB, 0xFFFF, 0x4CA1, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x64BE, 0xFFFF, 0x64BD, 0x64BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x64C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64C2, 0x479C, 0x5044, 0xFFFF, 0xFFFF, 0x5353,
+    0x537A, 0x64C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64C4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64C6, 0x64C5, 0xFFFF, 0x64C7, 0xFFFF, 0x4653, 0x64C8, 0x4DAA, 0x4897, 0xFFFF, 0x64C9,
+    0xFFFF, 0xFFFF, 0x4E55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64CA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CB1,
+    0xFFFF, 0xFFFF, 0x4752, 0x64CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BA6, 0xFFFF, 0xFFFF, 0x64CD, 0x64CC, 0x48A6, 0x64CF, 0xFFFF,
+  },
+  { /* U+8Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4A5A, 0xFFFF, 0x64D2, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D6E, 0x64D0, 0xFFFF, 0x64D1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x64D4, 0x64D5, 0x4A68, 0x64D3, 0xFFFF, 0xFFFF, 0xFFFF, 0x64D7, 0xFFFF, 0x515B, 0x64D6, 0x4787, 0xFFFF, 0x64D8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64D9, 0xFFFF, 0xFFFF, 0x4EF4, 0x48B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55A6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x64DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4693, 0x64DC, 0xFFFF, 0x64DB, 0xFFFF, 0xFFFF, 0x64DF, 0x506C,
+    0xFFFF, 0xFFFF, 0x64DE, 0xFFFF, 0x50FE, 0x64DD, 0x64E1, 0xFFFF, 0xFFFF, 0x64E0, 0xFFFF, 0xFFFF, 0x64E2, 0x54EE, 0x64E3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64E5, 0xFFFF, 0xFFFF, 0x50A9,
+    0xFFFF, 0x52E1, 0x64E6, 0x64E7, 0x64E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D5E, 0x64E9, 0xFFFF, 0x4D74, 0x64EA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x64EB, 0xFFFF, 0xFFFF, 0xFFFF, 0x64ED, 0x64EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64EE, 0x6149, 0x64EF,
+    0x47DF, 0x52E5, 0x4845, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64F0, 0xFFFF, 0xFFFF, 0x45D5, 0x47F5, 0x4841, 0xFFFF, 0xFFFF, 0x547E,
+    0xFFFF, 0xFFFF, 0x55DF, 0xFFFF, 0x49CD, 0x5068, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BA9, 0xFFFF,
+    0xFFFF, 0x4673, 0xFFFF, 0xFFFF, 0x48D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x64F4, 0xFFFF, 0xFFFF, 0x64F3, 0x535D, 0xFFFF, 0xFFFF, 0x64F6, 0x4E9E, 0x49EF, 0xFFFF, 0x53DF, 0xFFFF, 0x64F5,
+    0x4A9C, 0xFFFF, 0xFFFF, 0xFFFF, 0x64F7, 0xFFFF, 0xFFFF, 0x4E58, 0x64FA, 0x64F9, 0x54A9, 0xFFFF, 0xFFFF, 0x49D1, 0xFFFF, 0xFFFF,
+  },
+  { /* U+90xx */
+    0x4B49, 0x4744, 0xFFFF, 0x4C72, 0xFFFF, 0x64F8, 0x4BFC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6544, 0xFFFF, 0x6541, 0x64FD, 0x4BDA,
+    0x50BB, 0x64FB, 0xFFFF, 0x515E, 0x48F0, 0x64FC, 0x6543, 0x4FB3, 0xFFFF, 0x4FCA, 0x45E3, 0xFFFF, 0xFFFF, 0x53B1, 0x6542, 0x48CD,
+    0x45B8, 0x64FE, 0x4DCE, 0x4754, 0xFFFF, 0xFFFF, 0xFFFF, 0x6545, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F77, 0xFFFF,
+    0xFFFF, 0x4AD3, 0x4669, 0xFFFF, 0xFFFF, 0x5485, 0x6546, 0xFFFF, 0x4AD6, 0x6547, 0xFFFF, 0xFFFF, 0x55AC, 0xFFFF, 0x654E, 0xFFFF,
+    0xFFFF, 0x54F8, 0x4CF7, 0xFFFF, 0xFFFF, 0x4C6D, 0xFFFF, 0x49EC, 0xFFFF, 0x654D, 0x4A8B, 0x46AB, 0xFFFF, 0x505D, 0x488D, 0x6548,
+    0x654A, 0x654B, 0x654C, 0x4550, 0x46A4, 0x49BC, 0x654F, 0xFFFF, 0x6550, 0x52F3, 0xFFFF, 0xFFFF, 0x5455, 0xFFFF, 0x6551, 0xFFFF,
+    0x46E3, 0x544C, 0xFFFF, 0x4EC2, 0xFFFF, 0x6882, 0xFFFF, 0x6553, 0x6552, 0x49CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5143, 0x5458, 0x6554,
+    0xFFFF, 0xFFFF, 0x6557, 0xFFFF, 0xFFFF, 0x526E, 0x6555, 0x535B, 0x485D, 0xFFFF, 0x4CDA, 0xFFFF, 0x526B, 0x6559, 0xFFFF, 0x4CC4,
+    0x655B, 0x537B, 0x6558, 0x6045, 0x4DA9, 0xFFFF, 0xFFFF, 0x5186, 0xFFFF, 0x655A, 0x50EA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x655C,
+    0xFFFF, 0x4C92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4846, 0xFFFF, 0xFFFF, 0x46C5, 0xFFFF, 0x51A8, 0xFFFF, 0x4EB8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x655E,
+    0xFFFF, 0x655F, 0xFFFF, 0xFFFF, 0xFFFF, 0x6560, 0xFFFF, 0xFFFF, 0x4D81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x49B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5052, 0xFFFF, 0xFFFF, 0xFFFF, 0x456E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6563, 0xFFFF, 0xFFFF, 0x6564, 0xFFFF,
+    0xFFFF, 0x499E, 0x6561, 0xFFFF, 0x6562, 0xFFFF, 0xFFFF, 0xFFFF, 0x4595, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5162, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CB7, 0xFFFF, 0x4995, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x454F, 0xFFFF, 0xFFFF,
+  },
+  { /* U+91xx */
+    0xFFFF, 0xFFFF, 0x6565, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6568, 0xFFFF, 0xFFFF, 0x6567, 0xFFFF, 0xFFFF, 0xFFFF, 0x6569, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x656B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5154, 0xFFFF, 0xFFFF,
+    0x656C, 0xFFFF, 0x656A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F73, 0x656D, 0x5548, 0x52BB, 0x47F3, 0x5591, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4758, 0xFFFF, 0x4E7C, 0xFFFF, 0x656E, 0xFFFF, 0x656F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4BAE, 0x6570, 0xFFFF, 0x6571, 0xFFFF, 0xFFFF, 0xFFFF, 0x6572, 0x50BD, 0xFFFF, 0x5149, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6574, 0x6573, 0xFFFF, 0x4D86, 0xFFFF, 0x51EB, 0x4899, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6577, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51A9, 0xFFFF, 0x6576, 0xFFFF, 0x6575, 0xFFFF, 0x516F, 0xFFFF, 0xFFFF,
+    0x5170, 0xFFFF, 0x5378, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x536F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6578, 0xFFFF, 0x507F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x657B, 0x6579, 0xFFFF, 0xFFFF, 0xFFFF, 0x657A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x657D, 0x657C, 0xFFFF, 0xFFFF, 0x50C2, 0xFFFF, 0x657E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x657F, 0x6580, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5346, 0x53BF, 0x4D79, 0x5252, 0xFFFF, 0x6581, 0x476C, 0x45A3, 0x4569, 0x47B5,
+    0x6582, 0x4586, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6587, 0x6585, 0x4FF4, 0xFFFF, 0x6583, 0x6584, 0x4ACC, 0x4988, 0x6586, 0x6588,
+    0xFFFF, 0x6589, 0xFFFF, 0x4CE3, 0x658D, 0x658F, 0x534A, 0x4BF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x658A, 0x658C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x658B, 0x658E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D0, 0xFFFF, 0xFFFF, 0x6592,
+  },
+  { /* U+92xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6590, 0xFFFF, 0xFFFF, 0xFFFF, 0x6595, 0xFFFF, 0xFFFF, 0x4E63, 0x538F, 0xFFFF,
+    0x6593, 0x5269, 0xFFFF, 0xFFFF, 0x6594, 0x6597, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6591, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6598, 0xFFFF, 0xFFFF, 0x6596, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45AE, 0xFFFF, 0xFFFF, 0x55BF, 0xFFFF, 0x65A6, 0x659B, 0xFFFF, 0x659F, 0xFFFF, 0xFFFF, 0x65A4,
+    0x659E, 0xFFFF, 0xFFFF, 0xFFFF, 0x45D7, 0x659A, 0xFFFF, 0xFFFF, 0x65A0, 0x659C, 0xFFFF, 0x65A7, 0xFFFF, 0xFFFF, 0x65A1, 0xFFFF,
+    0x65A2, 0x65A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6599, 0xFFFF, 0x65A3, 0x65A9, 0x49D4, 0xFFFF, 0xFFFF, 0x5393, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4EA8, 0xFFFF, 0x659D, 0xFFFF, 0x4FB4, 0x65A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4863, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65AC, 0x65AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5183, 0xFFFF,
+    0x478C, 0xFFFF, 0xFFFF, 0x4CE2, 0xFFFF, 0x48C0, 0xFFFF, 0xFFFF, 0x524B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4CAD, 0xFFFF, 0x65AF, 0xFFFF, 0x65B1, 0x65AE, 0xFFFF, 0x4DDC, 0xFFFF, 0x4E80, 0x65B0, 0x65AA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D48, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65BB, 0xFFFF, 0x65BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65B3,
+    0x65B7, 0xFFFF, 0x5449, 0x65BD, 0xFFFF, 0x65B9, 0xFFFF, 0x65B5, 0xFFFF, 0x65B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x65BC, 0xFFFF, 0xFFFF, 0xFFFF, 0x52C0, 0xFFFF, 0xFFFF, 0x65B4, 0xFFFF, 0x65B2, 0x5363, 0xFFFF, 0xFFFF, 0x4D6F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x55BE, 0x48C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51E7, 0x5394, 0x65C2, 0x65C5, 0x46A1, 0xFFFF, 0xFFFF, 0x65C9,
+  },
+  { /* U+93xx */
+    0xFFFF, 0xFFFF, 0x65CE, 0xFFFF, 0xFFFF, 0xFFFF, 0x55D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65C0,
+    0x5390, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54EF, 0x65C7, 0x65CB, 0xFFFF, 0xFFFF, 0x65CC, 0x65C8, 0xFFFF,
+    0x4E57, 0x65C3, 0x65CA, 0x65CD, 0xFFFF, 0x65C1, 0x4B8E, 0xFFFF, 0x53F0, 0xFFFF, 0xFFFF, 0x5257, 0x4FE6, 0xFFFF, 0x5283, 0x50B1,
+    0xFFFF, 0xFFFF, 0x4886, 0xFFFF, 0xFFFF, 0x65BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65BE, 0x65CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65C4, 0xFFFF, 0xFFFF, 0xFFFF, 0x51F7, 0xFFFF, 0xFFFF, 0x4B48, 0xFFFF, 0x55D3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54AA, 0xFFFF, 0x65D4, 0x65D5, 0xFFFF, 0xFFFF, 0xFFFF, 0x48C7, 0x52AD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x65D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F70, 0xFFFF, 0x65D3, 0xFFFF,
+    0x65D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E45, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65D2, 0xFFFF, 0x53BD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4962, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65DA, 0xFFFF, 0x4D70, 0x5197, 0xFFFF, 0xFFFF, 0x54FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65D8, 0xFFFF, 0xFFFF, 0x546D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x536E, 0x65D9, 0x4C89, 0xFFFF,
+    0x65D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x65E2, 0xFFFF, 0xFFFF, 0x65DD, 0xFFFF, 0x65DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x65E5, 0x5041, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65DC, 0x65DE, 0x65E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65E3, 0x65E4, 0xFFFF,
+    0xFFFF, 0x4A8D, 0xFFFF, 0xFFFF, 0x65E6, 0x65E0, 0xFFFF, 0xFFFF, 0x65DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+94xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x65EC, 0xFFFF, 0xFFFF, 0xFFFF, 0x65ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x51CD, 0xFFFF, 0xFFFF, 0x65EA, 0x65E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CC8, 0x52CF, 0x65E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x65EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x65F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5156, 0x65EE, 0xFFFF, 0x5388, 0xFFFF, 0x65F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x65F2, 0xFFFF, 0xFFFF, 0x65F5, 0x65F4, 0xFFFF, 0xFFFF, 0x65F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4E4E, 0x65F3, 0x5241, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65F8, 0x65F7, 0xFFFF, 0xFFFF, 0x65FB, 0xFFFF,
+    0x65F9, 0xFFFF, 0x65FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x65FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65FD, 0xFFFF, 0x6641, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6644, 0x6643, 0x6645, 0x6642,
+    0xFFFF, 0x6646, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+95xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4583, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x46AA, 0xFFFF, 0x6647, 0x519C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6648, 0xFFFF, 0x4B7D, 0x6649, 0x46CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x545F,
+    0xFFFF, 0x4DD9, 0x664A, 0x45C1, 0x664B, 0xFFFF, 0x664C, 0xFFFF, 0x664D, 0x664E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x664F, 0xFFFF, 0x45C5, 0x4AE9, 0x549B, 0x5172, 0xFFFF, 0x6651, 0x6650, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6652, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5177, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6655, 0xFFFF, 0x6654, 0x6653, 0xFFFF, 0x6656, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6659, 0xFFFF, 0xFFFF, 0xFFFF, 0x5364, 0xFFFF, 0xFFFF, 0x6657, 0xFFFF, 0x665B, 0x665A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x665D, 0x665C, 0x665E, 0xFFFF, 0x4BCC, 0xFFFF, 0xFFFF, 0xFFFF, 0x665F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6660, 0x6662, 0xFFFF, 0xFFFF, 0x6661, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+96xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4786, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6663, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6664, 0xFFFF, 0x4591, 0xFFFF, 0xFFFF, 0xFFFF, 0x6665, 0x6666,
+    0xFFFF, 0xFFFF, 0x47BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FEF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46AE,
+    0x4FE8, 0xFFFF, 0x6667, 0xFFFF, 0x4B8C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x666A, 0x6669, 0x49E5, 0xFFFF, 0x6668,
+    0x48AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5157, 0x666B, 0x666C, 0x5272, 0x666D,
+    0xFFFF, 0xFFFF, 0x49D8, 0x4C84, 0x496D, 0x4FFE, 0x666E, 0xFFFF, 0xFFFF, 0xFFFF, 0x55C3, 0xFFFF, 0x6671, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4CD2, 0xFFFF, 0x6670, 0x4E61, 0xFFFF, 0x50C7, 0x4AB7, 0x666F, 0x4961, 0xFFFF, 0x4A6C, 0xFFFF, 0xFFFF, 0x47BF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BB9, 0x465D, 0xFFFF, 0x4CE5, 0xFFFF, 0x4A93, 0x6673, 0xFFFF, 0x6672, 0x49A9, 0x4E76,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x505A, 0x6676, 0xFFFF, 0x6677, 0x6675, 0x53C3, 0xFFFF, 0x4797, 0x4BF9, 0x6679, 0xFFFF, 0xFFFF,
+    0x4EAE, 0xFFFF, 0xFFFF, 0x4CE0, 0xFFFF, 0xFFFF, 0xFFFF, 0x667A, 0x6556, 0xFFFF, 0x667B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x667F,
+    0x667E, 0x667C, 0x667D, 0xFFFF, 0x6680, 0xFFFF, 0x6681, 0x5545, 0x6682, 0x6683, 0xFFFF, 0x4FDA, 0x4ED5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F64, 0x51A4, 0xFFFF, 0xFFFF, 0x4570, 0x4745, 0x47A0, 0x4C4D, 0xFFFF, 0x5477, 0xFFFF, 0x6685, 0x52B7, 0x525B, 0x6684, 0xFFFF,
+    0xFFFF, 0x4A8A, 0xFFFF, 0xFFFF, 0xFFFF, 0x6686, 0x6354, 0xFFFF, 0xFFFF, 0x6688, 0xFFFF, 0x51FB, 0x6687, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4997, 0x495A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49DD, 0xFFFF, 0x49BB, 0x52A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F90, 0xFFFF, 0x4ABC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5069, 0x4BD6, 0xFFFF, 0x6689, 0xFFFF, 0x4582, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+97xx */
+    0x47FB, 0xFFFF, 0xFFFF, 0xFFFF, 0x668A, 0xFFFF, 0x668B, 0x4DDE, 0x668C, 0xFFFF, 0x4F4B, 0xFFFF, 0xFFFF, 0x668E, 0x6690, 0x6692,
+    0xFFFF, 0x6691, 0xFFFF, 0x668F, 0xFFFF, 0xFFFF, 0x6693, 0xFFFF, 0xFFFF, 0x668D, 0xFFFF, 0xFFFF, 0x4DE8, 0xFFFF, 0x4EE4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6694, 0xFFFF, 0xFFFF, 0x4E48, 0xFFFF, 0xFFFF, 0x6695, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x6696, 0xFFFF, 0x4BC6, 0x6697, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BCF, 0x6698, 0xFFFF, 0x6699, 0xFFFF, 0x669A, 0x669B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x66A0, 0x669E, 0x669D, 0xFFFF, 0x669C, 0xFFFF, 0x669F, 0x66A1, 0xFFFF, 0xFFFF, 0xFFFF, 0x66A2, 0xFFFF, 0x66A3,
+    0xFFFF, 0x66A4, 0x464C, 0xFFFF, 0xFFFF, 0x66A5, 0x48C3, 0xFFFF, 0xFFFF, 0x4644, 0xFFFF, 0xFFFF, 0x66A6, 0xFFFF, 0x48E1, 0xFFFF,
+    0x66A7, 0x6852, 0x4691, 0xFFFF, 0x66A8, 0xFFFF, 0x66A9, 0xFFFF, 0x66AA, 0x4AA3, 0xFFFF, 0x53B5, 0xFFFF, 0x66AB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x52CE, 0xFFFF, 0xFFFF, 0x4DF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66AC, 0x66B0, 0xFFFF, 0x66AE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x66AF, 0xFFFF, 0xFFFF, 0x5445, 0x66AD, 0x5277, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66B1, 0xFFFF, 0x504C, 0xFFFF, 0x66B2,
+    0x66B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x66B4, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x51ED, 0xFFFF, 0xFFFF, 0x66B7, 0xFFFF, 0xFFFF, 0x66B6, 0xFFFF, 0x66B5, 0xFFFF, 0xFFFF, 0x63FC, 0xFFFF, 0x548B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x66B8, 0x66B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x66BA, 0xFFFF, 0xFFFF, 0x66BB, 0xFFFF, 0x66BC, 0xFFFF, 0xFFFF, 0x66BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4E75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66BE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66BF, 0x4FDF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x66C0, 0x484D, 0xFFFF, 0x66C2, 0x52FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5577, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A5C,
+  },
+  { /* U+98xx */
+    0xFFFF, 0x4CD9, 0x4D5B, 0x4946, 0xFFFF, 0x4A97, 0x47B2, 0xFFFF, 0x46B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5456, 0xFFFF, 0xFFFF, 0x66C3,
+    0x4D4A, 0x539D, 0x5557, 0x517A, 0xFFFF, 0xFFFF, 0xFFFF, 0x55E4, 0x4ACD, 0xFFFF, 0x66C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x66C6, 0xFFFF, 0xFFFF, 0x66C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EB3, 0x47EB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5576, 0xFFFF, 0xFFFF, 0x66C7, 0x50FB, 0xFFFF, 0xFFFF, 0x53AB, 0x4A7A, 0x66C8, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66CA, 0x47FE, 0x47F1, 0x548E, 0x66C9,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48B8, 0x4AE5, 0xFFFF, 0x66CB, 0x4C57, 0xFFFF, 0xFFFF, 0x55C1, 0xFFFF, 0xFFFF, 0x46BA, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66CC, 0xFFFF, 0x4EEE, 0xFFFF, 0xFFFF, 0xFFFF, 0x66CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x66CE,
+    0x66CF, 0x66D0, 0xFFFF, 0x66D2, 0x66D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47E7, 0xFFFF, 0x66D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66D4,
+    0xFFFF, 0x66D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x66D8, 0x66D7, 0xFFFF, 0x66D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x488A, 0x66DA, 0xFFFF, 0xFFFF, 0x46B8,
+    0xFFFF, 0xFFFF, 0x53CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66DC, 0xFFFF, 0x66DE, 0xFFFF, 0x66DB, 0x5CCA, 0x46B5,
+    0xFFFF, 0xFFFF, 0x4BA3, 0xFFFF, 0x5245, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A8F, 0x4D49, 0x4957, 0xFFFF,
+  },
+  { /* U+99xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x66E0, 0xFFFF, 0x50BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54BC, 0x4979, 0xFFFF, 0x50A7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x55B3, 0xFFFF, 0x66E2, 0x554B, 0x66E3, 0xFFFF, 0xFFFF, 0xFFFF, 0x66E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66E1, 0x66E8, 0xFFFF,
+    0x66EA, 0x66E7, 0xFFFF, 0xFFFF, 0x66E9, 0xFFFF, 0xFFFF, 0x66E5, 0x4862, 0xFFFF, 0xFFFF, 0xFFFF, 0x66EB, 0xFFFF, 0x66EC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66ED, 0x66EE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x66EF, 0xFFFF, 0xFFFF, 0x66F1, 0xFFFF, 0xFFFF, 0xFFFF, 0x66F0, 0xFFFF, 0x66F3, 0x66F5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x66F2, 0x66F4, 0x52E8, 0xFFFF, 0xFFFF, 0x66F6, 0xFFFF, 0x51D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49BE, 0x66F7, 0x66F8, 0x46BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66F9, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66FA, 0xFFFF, 0xFFFF, 0x4B85, 0xFFFF, 0xFFFF, 0xFFFF, 0x4664, 0x66FB, 0x66FC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x52DF, 0x50A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66FD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x55E5, 0xFFFF, 0xFFFF, 0x4DE5, 0x49AC, 0x4CFE, 0xFFFF, 0x4F85, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4DF5, 0x6744, 0x49FC, 0xFFFF, 0xFFFF, 0x53BE, 0xFFFF, 0xFFFF, 0x6743, 0xFFFF, 0xFFFF, 0x6741, 0xFFFF, 0x6742, 0xFFFF, 0x66FE,
+    0xFFFF, 0xFFFF, 0x6747, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6745, 0x6746, 0xFFFF,
+    0xFFFF, 0x6748, 0x6749, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x674B, 0xFFFF, 0xFFFF, 0x674A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CC0,
+  },
+  { /* U+9Axx */
+    0xFFFF, 0x674C, 0xFFFF, 0xFFFF, 0xFFFF, 0x674E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5058, 0x674D,
+    0xFFFF, 0xFFFF, 0x4DD2, 0x48B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x674F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53DA, 0xFFFF, 0xFFFF, 0x6750, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4E5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6751, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6756, 0xFFFF,
+    0x6752, 0xFFFF, 0x6754, 0x6755, 0xFFFF, 0x6753, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6758, 0x6759, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6757, 0xFFFF, 0x675B, 0xFFFF, 0xFFFF, 0x4CD5, 0x675A, 0xFFFF, 0xFFFF, 0xFFFF, 0x675C,
+    0xFFFF, 0xFFFF, 0x675D, 0xFFFF, 0x6760, 0x675F, 0xFFFF, 0xFFFF, 0xFFFF, 0x675E, 0x6761, 0x6762, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6763, 0xFFFF, 0xFFFF,
+    0x6764, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x559C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6765, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x6766, 0xFFFF, 0xFFFF, 0xFFFF, 0x52C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6767,
+    0xFFFF, 0x676A, 0xFFFF, 0x6768, 0x6769, 0xFFFF, 0xFFFF, 0xFFFF, 0x4571, 0x676B, 0xFFFF, 0xFFFF, 0x676C, 0xFFFF, 0x676D, 0x676E,
+    0xFFFF, 0xFFFF, 0x676F, 0x6770, 0xFFFF, 0xFFFF, 0x6771, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CF6, 0x6773, 0xFFFF, 0x509D, 0x6774, 0x6772,
+    0xFFFF, 0x6776, 0xFFFF, 0xFFFF, 0x6775, 0xFFFF, 0xFFFF, 0x6777, 0xFFFF, 0xFFFF, 0xFFFF, 0x6778, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6779, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x677A, 0xFFFF, 0x677B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x677C,
+    0xFFFF, 0xFFFF, 0x677D, 0x677E, 0xFFFF, 0x677F, 0xFFFF, 0x6780, 0x6781, 0x6782, 0x6783, 0xFFFF, 0xFFFF, 0xFFFF, 0x6784, 0x6785,
+    0xFFFF, 0x6786, 0x6787, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6788, 0x4AC8, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x52CB, 0x50A8, 0x678A, 0x6789, 0x4DB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x678B, 0x678C, 0x5389,
+    0xFFFF, 0x678D, 0xFFFF, 0xFFFF, 0x4DE2, 0xFFFF, 0xFFFF, 0xFFFF, 0x678E, 0xFFFF, 0x48EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51F4,
+    0xFFFF, 0xFFFF, 0x6791, 0xFFFF, 0x6790, 0x678F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6794, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F8E, 0x6793,
+    0xFFFF, 0x6795, 0x528D, 0x6792, 0xFFFF, 0xFFFF, 0x6796, 0x6797, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6798,
+    0x6799, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x679A, 0xFFFF, 0x55CE, 0x4EB7, 0xFFFF, 0x5391, 0x4CE9, 0xFFFF,
+    0xFFFF, 0x679B, 0xFFFF, 0xFFFF, 0x679C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67A0, 0xFFFF, 0x679F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x679D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67A1, 0xFFFF, 0xFFFF, 0x4FC6, 0x679E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67A2,
+    0xFFFF, 0x67A3, 0x67A4, 0xFFFF, 0x67A8, 0xFFFF, 0x4FE4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x67A9, 0x67A6, 0x67A5, 0x67A7, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5551, 0x67AB, 0x67AC, 0xFFFF, 0xFFFF, 0x67AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Cxx */
+    0x67B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x67AD, 0xFFFF, 0x67B5, 0xFFFF, 0x67B6, 0x67B2, 0x67B8, 0xFFFF, 0x67B4, 0x5571, 0xFFFF, 0xFFFF,
+    0x5293, 0xFFFF, 0x67B7, 0x67B3, 0x67B0, 0x67AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x67BC, 0xFFFF, 0xFFFF, 0x67BB, 0x67BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x546E, 0x67B9, 0x55C8,
+    0x67BD, 0xFFFF, 0x67BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53D5, 0x51F0, 0x54AB, 0xFFFF, 0xFFFF, 0x67C1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67C0, 0x67BE, 0x5560, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x53C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x554C, 0xFFFF, 0xFFFF, 0x67C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x67C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67C5, 0xFFFF, 0x67C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4779, 0xFFFF, 0x67C8, 0xFFFF, 0x4D95, 0xFFFF, 0x67C7, 0x67C9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x67CA, 0xFFFF, 0xFFFF, 0x4EA6, 0x4B70, 0xFFFF, 0x54C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x67CC, 0xFFFF, 0xFFFF, 0x67CD, 0x51A1, 0x54FC, 0x67CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5464, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x67D4, 0xFFFF, 0xFFFF, 0x67D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x67D2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x67D1, 0xFFFF, 0xFFFF, 0x67CF, 0xFFFF, 0x4C54, 0xFFFF, 0x67CE, 0x50BA, 0x67D0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DD6, 0xFFFF, 0xFFFF, 0x67D8, 0x67D6,
+    0xFFFF, 0x67D5, 0xFFFF, 0xFFFF, 0x67D7, 0xFFFF, 0x67D9, 0xFFFF, 0x67DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x67DF, 0x67DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67DD, 0xFFFF, 0xFFFF, 0x4BE7, 0x67DB, 0x67DC, 0xFFFF,
+    0x50FD, 0x557E, 0xFFFF, 0xFFFF, 0x67E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E4, 0x518A, 0xFFFF, 0xFFFF, 0x67E5,
+    0x67E2, 0xFFFF, 0x67E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E3, 0xFFFF, 0x5342, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D8E,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E9, 0xFFFF, 0x67EA, 0xFFFF, 0xFFFF, 0xFFFF, 0x50E5,
+    0xFFFF, 0xFFFF, 0x67EB, 0xFFFF, 0x477A, 0xFFFF, 0xFFFF, 0xFFFF, 0x67EF, 0xFFFF, 0x67F0, 0x67EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x67ED, 0x67F3, 0xFFFF, 0x67EC, 0xFFFF, 0x67F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x67F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F9, 0xFFFF, 0x67FA,
+    0xFFFF, 0xFFFF, 0x4BF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F7, 0x4B7A, 0x50AF, 0xFFFF, 0xFFFF, 0x67FB, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67FE, 0x67FC, 0x67FD, 0xFFFF, 0xFFFF, 0x6841, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6842, 0xFFFF, 0xFFFF, 0x4C7D, 0x6843, 0xFFFF, 0xFFFF, 0xFFFF, 0x6844, 0xFFFF, 0x4697,
+    0xFFFF, 0x6845, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6846, 0xFFFF, 0xFFFF, 0x6847, 0x6848, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x684A, 0x51F9, 0x519E, 0xFFFF, 0x6849, 0xFFFF, 0x4CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x684B, 0xFFFF, 0x519B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x684C, 0x4AE0, 0xFFFF, 0xFFFF, 0x53B4, 0x684E, 0xFFFF, 0xFFFF, 0x684F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x684D, 0x5261, 0x555F, 0x48A7, 0x6850, 0xFFFF, 0x6851, 0x4EEA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6853, 0x55AE, 0x51A7, 0x6854,
+    0x6855, 0x6856, 0x4679, 0xFFFF, 0x6857, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E90, 0x4DBC, 0xFFFF, 0x51DD, 0x6858, 0x685A, 0x6859, 0xFFFF,
+    0x685B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x685C, 0xFFFF, 0xFFFF, 0x685D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x685E,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x685F, 0xFFFF, 0x6860, 0x6861, 0xFFFF, 0x6862, 0xFFFF, 0x6863, 0x6864, 0x6865, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6866, 0x6867, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51AA, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4FAF, 0xFFFF, 0x6869, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x50CB, 0x686A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x686B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CFD, 0xFFFF, 0xFFFF, 0x686C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x686D, 0x51F5, 0xFFFF, 0xFFFF, 0x686E, 0x686F,
+    0xFFFF, 0xFFFF, 0x6870, 0xFFFF, 0x6871, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6873,
+    0x6874, 0x6875, 0x4C80, 0x6872, 0xFFFF, 0xFFFF, 0x6876, 0x6877, 0xFFFF, 0xFFFF, 0x6879, 0xFFFF, 0x6878, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x687B, 0xFFFF, 0xFFFF, 0xFFFF, 0x687C, 0x687A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48CA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x687D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x687E, 0x5FF7, 0xFFFF, 0xFFFF,
+    0x687F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+E0xx */
+    0x6941, 0x6942, 0x6943, 0x6944, 0x6945, 0x6946, 0x6947, 0x6948, 0x6949, 0x694A, 0x694B, 0x694C, 0x694D, 0x694E, 0x694F, 0x6950,
+    0x6951, 0x6952, 0x6953, 0x6954, 0x6955, 0x6956, 0x6957, 0x6958, 0x6959, 0x695A, 0x695B, 0x695C, 0x695D, 0x695E, 0x695F, 0x6960,
+    0x6961, 0x6962, 0x6963, 0x6964, 0x6965, 0x6966, 0x6967, 0x6968, 0x6969, 0x696A, 0x696B, 0x696C, 0x696D, 0x696E, 0x696F, 0x6970,
+    0x6971, 0x6972, 0x6973, 0x6974, 0x6975, 0x6976, 0x6977, 0x6978, 0x6979, 0x697A, 0x697B, 0x697C, 0x697D, 0x697E, 0x697F, 0x6980,
+    0x6981, 0x6982, 0x6983, 0x6984, 0x6985, 0x6986, 0x6987, 0x6988, 0x6989, 0x698A, 0x698B, 0x698C, 0x698D, 0x698E, 0x698F, 0x6990,
+    0x6991, 0x6992, 0x6993, 0x6994, 0x6995, 0x6996, 0x6997, 0x6998, 0x6999, 0x699A, 0x699B, 0x699C, 0x699D, 0x699E, 0x699F, 0x69A0,
+    0x69A1, 0x69A2, 0x69A3, 0x69A4, 0x69A5, 0x69A6, 0x69A7, 0x69A8, 0x69A9, 0x69AA, 0x69AB, 0x69AC, 0x69AD, 0x69AE, 0x69AF, 0x69B0,
+    0x69B1, 0x69B2, 0x69B3, 0x69B4, 0x69B5, 0x69B6, 0x69B7, 0x69B8, 0x69B9, 0x69BA, 0x69BB, 0x69BC, 0x69BD, 0x69BE, 0x69BF, 0x69C0,
+    0x69C1, 0x69C2, 0x69C3, 0x69C4, 0x69C5, 0x69C6, 0x69C7, 0x69C8, 0x69C9, 0x69CA, 0x69CB, 0x69CC, 0x69CD, 0x69CE, 0x69CF, 0x69D0,
+    0x69D1, 0x69D2, 0x69D3, 0x69D4, 0x69D5, 0x69D6, 0x69D7, 0x69D8, 0x69D9, 0x69DA, 0x69DB, 0x69DC, 0x69DD, 0x69DE, 0x69DF, 0x69E0,
+    0x69E1, 0x69E2, 0x69E3, 0x69E4, 0x69E5, 0x69E6, 0x69E7, 0x69E8, 0x69E9, 0x69EA, 0x69EB, 0x69EC, 0x69ED, 0x69EE, 0x69EF, 0x69F0,
+    0x69F1, 0x69F2, 0x69F3, 0x69F4, 0x69F5, 0x69F6, 0x69F7, 0x69F8, 0x69F9, 0x69FA, 0x69FB, 0x69FC, 0x69FD, 0x69FE, 0x6A41, 0x6A42,
+    0x6A43, 0x6A44, 0x6A45, 0x6A46, 0x6A47, 0x6A48, 0x6A49, 0x6A4A, 0x6A4B, 0x6A4C, 0x6A4D, 0x6A4E, 0x6A4F, 0x6A50, 0x6A51, 0x6A52,
+    0x6A53, 0x6A54, 0x6A55, 0x6A56, 0x6A57, 0x6A58, 0x6A59, 0x6A5A, 0x6A5B, 0x6A5C, 0x6A5D, 0x6A5E, 0x6A5F, 0x6A60, 0x6A61, 0x6A62,
+    0x6A63, 0x6A64, 0x6A65, 0x6A66, 0x6A67, 0x6A68, 0x6A69, 0x6A6A, 0x6A6B, 0x6A6C, 0x6A6D, 0x6A6E, 0x6A6F, 0x6A70, 0x6A71, 0x6A72,
+    0x6A73, 0x6A74, 0x6A75, 0x6A76, 0x6A77, 0x6A78, 0x6A79, 0x6A7A, 0x6A7B, 0x6A7C, 0x6A7D, 0x6A7E, 0x6A7F, 0x6A80, 0x6A81, 0x6A82,
+  },
+  { /* U+E1xx */
+    0x6A83, 0x6A84, 0x6A85, 0x6A86, 0x6A87, 0x6A88, 0x6A89, 0x6A8A, 0x6A8B, 0x6A8C, 0x6A8D, 0x6A8E, 0x6A8F, 0x6A90, 0x6A91, 0x6A92,
+    0x6A93, 0x6A94, 0x6A95, 0x6A96, 0x6A97, 0x6A98, 0x6A99, 0x6A9A, 0x6A9B, 0x6A9C, 0x6A9D, 0x6A9E, 0x6A9F, 0x6AA0, 0x6AA1, 0x6AA2,
+    0x6AA3, 0x6AA4, 0x6AA5, 0x6AA6, 0x6AA7, 0x6AA8, 0x6AA9, 0x6AAA, 0x6AAB, 0x6AAC, 0x6AAD, 0x6AAE, 0x6AAF, 0x6AB0, 0x6AB1, 0x6AB2,
+    0x6AB3, 0x6AB4, 0x6AB5, 0x6AB6, 0x6AB7, 0x6AB8, 0x6AB9, 0x6ABA, 0x6ABB, 0x6ABC, 0x6ABD, 0x6ABE, 0x6ABF, 0x6AC0, 0x6AC1, 0x6AC2,
+    0x6AC3, 0x6AC4, 0x6AC5, 0x6AC6, 0x6AC7, 0x6AC8, 0x6AC9, 0x6ACA, 0x6ACB, 0x6ACC, 0x6ACD, 0x6ACE, 0x6ACF, 0x6AD0, 0x6AD1, 0x6AD2,
+    0x6AD3, 0x6AD4, 0x6AD5, 0x6AD6, 0x6AD7, 0x6AD8, 0x6AD9, 0x6ADA, 0x6ADB, 0x6ADC, 0x6ADD, 0x6ADE, 0x6ADF, 0x6AE0, 0x6AE1, 0x6AE2,
+    0x6AE3, 0x6AE4, 0x6AE5, 0x6AE6, 0x6AE7, 0x6AE8, 0x6AE9, 0x6AEA, 0x6AEB, 0x6AEC, 0x6AED, 0x6AEE, 0x6AEF, 0x6AF0, 0x6AF1, 0x6AF2,
+    0x6AF3, 0x6AF4, 0x6AF5, 0x6AF6, 0x6AF7, 0x6AF8, 0x6AF9, 0x6AFA, 0x6AFB, 0x6AFC, 0x6AFD, 0x6AFE, 0x6B41, 0x6B42, 0x6B43, 0x6B44,
+    0x6B45, 0x6B46, 0x6B47, 0x6B48, 0x6B49, 0x6B4A, 0x6B4B, 0x6B4C, 0x6B4D, 0x6B4E, 0x6B4F, 0x6B50, 0x6B51, 0x6B52, 0x6B53, 0x6B54,
+    0x6B55, 0x6B56, 0x6B57, 0x6B58, 0x6B59, 0x6B5A, 0x6B5B, 0x6B5C, 0x6B5D, 0x6B5E, 0x6B5F, 0x6B60, 0x6B61, 0x6B62, 0x6B63, 0x6B64,
+    0x6B65, 0x6B66, 0x6B67, 0x6B68, 0x6B69, 0x6B6A, 0x6B6B, 0x6B6C, 0x6B6D, 0x6B6E, 0x6B6F, 0x6B70, 0x6B71, 0x6B72, 0x6B73, 0x6B74,
+    0x6B75, 0x6B76, 0x6B77, 0x6B78, 0x6B79, 0x6B7A, 0x6B7B, 0x6B7C, 0x6B7D, 0x6B7E, 0x6B7F, 0x6B80, 0x6B81, 0x6B82, 0x6B83, 0x6B84,
+    0x6B85, 0x6B86, 0x6B87, 0x6B88, 0x6B89, 0x6B8A, 0x6B8B, 0x6B8C, 0x6B8D, 0x6B8E, 0x6B8F, 0x6B90, 0x6B91, 0x6B92, 0x6B93, 0x6B94,
+    0x6B95, 0x6B96, 0x6B97, 0x6B98, 0x6B99, 0x6B9A, 0x6B9B, 0x6B9C, 0x6B9D, 0x6B9E, 0x6B9F, 0x6BA0, 0x6BA1, 0x6BA2, 0x6BA3, 0x6BA4,
+    0x6BA5, 0x6BA6, 0x6BA7, 0x6BA8, 0x6BA9, 0x6BAA, 0x6BAB, 0x6BAC, 0x6BAD, 0x6BAE, 0x6BAF, 0x6BB0, 0x6BB1, 0x6BB2, 0x6BB3, 0x6BB4,
+    0x6BB5, 0x6BB6, 0x6BB7, 0x6BB8, 0x6BB9, 0x6BBA, 0x6BBB, 0x6BBC, 0x6BBD, 0x6BBE, 0x6BBF, 0x6BC0, 0x6BC1, 0x6BC2, 0x6BC3, 0x6BC4,
+  },
+  { /* U+E2xx */
+    0x6BC5, 0x6BC6, 0x6BC7, 0x6BC8, 0x6BC9, 0x6BCA, 0x6BCB, 0x6BCC, 0x6BCD, 0x6BCE, 0x6BCF, 0x6BD0, 0x6BD1, 0x6BD2, 0x6BD3, 0x6BD4,
+    0x6BD5, 0x6BD6, 0x6BD7, 0x6BD8, 0x6BD9, 0x6BDA, 0x6BDB, 0x6BDC, 0x6BDD, 0x6BDE, 0x6BDF, 0x6BE0, 0x6BE1, 0x6BE2, 0x6BE3, 0x6BE4,
+    0x6BE5, 0x6BE6, 0x6BE7, 0x6BE8, 0x6BE9, 0x6BEA, 0x6BEB, 0x6BEC, 0x6BED, 0x6BEE, 0x6BEF, 0x6BF0, 0x6BF1, 0x6BF2, 0x6BF3, 0x6BF4,
+    0x6BF5, 0x6BF6, 0x6BF7, 0x6BF8, 0x6BF9, 0x6BFA, 0x6BFB, 0x6BFC, 0x6BFD, 0x6BFE, 0x6C41, 0x6C42, 0x6C43, 0x6C44, 0x6C45, 0x6C46,
+    0x6C47, 0x6C48, 0x6C49, 0x6C4A, 0x6C4B, 0x6C4C, 0x6C4D, 0x6C4E, 0x6C4F, 0x6C50, 0x6C51, 0x6C52, 0x6C53, 0x6C54, 0x6C55, 0x6C56,
+    0x6C57, 0x6C58, 0x6C59, 0x6C5A, 0x6C5B, 0x6C5C, 0x6C5D, 0x6C5E, 0x6C5F, 0x6C60, 0x6C61, 0x6C62, 0x6C63, 0x6C64, 0x6C65, 0x6C66,
+    0x6C67, 0x6C68, 0x6C69, 0x6C6A, 0x6C6B, 0x6C6C, 0x6C6D, 0x6C6E, 0x6C6F, 0x6C70, 0x6C71, 0x6C72, 0x6C73, 0x6C74, 0x6C75, 0x6C76,
+    0x6C77, 0x6C78, 0x6C79, 0x6C7A, 0x6C7B, 0x6C7C, 0x6C7D, 0x6C7E, 0x6C7F, 0x6C80, 0x6C81, 0x6C82, 0x6C83, 0x6C84, 0x6C85, 0x6C86,
+    0x6C87, 0x6C88, 0x6C89, 0x6C8A, 0x6C8B, 0x6C8C, 0x6C8D, 0x6C8E, 0x6C8F, 0x6C90, 0x6C91, 0x6C92, 0x6C93, 0x6C94, 0x6C95, 0x6C96,
+    0x6C97, 0x6C98, 0x6C99, 0x6C9A, 0x6C9B, 0x6C9C, 0x6C9D, 0x6C9E, 0x6C9F, 0x6CA0, 0x6CA1, 0x6CA2, 0x6CA3, 0x6CA4, 0x6CA5, 0x6CA6,
+    0x6CA7, 0x6CA8, 0x6CA9, 0x6CAA, 0x6CAB, 0x6CAC, 0x6CAD, 0x6CAE, 0x6CAF, 0x6CB0, 0x6CB1, 0x6CB2, 0x6CB3, 0x6CB4, 0x6CB5, 0x6CB6,
+    0x6CB7, 0x6CB8, 0x6CB9, 0x6CBA, 0x6CBB, 0x6CBC, 0x6CBD, 0x6CBE, 0x6CBF, 0x6CC0, 0x6CC1, 0x6CC2, 0x6CC3, 0x6CC4, 0x6CC5, 0x6CC6,
+    0x6CC7, 0x6CC8, 0x6CC9, 0x6CCA, 0x6CCB, 0x6CCC, 0x6CCD, 0x6CCE, 0x6CCF, 0x6CD0, 0x6CD1, 0x6CD2, 0x6CD3, 0x6CD4, 0x6CD5, 0x6CD6,
+    0x6CD7, 0x6CD8, 0x6CD9, 0x6CDA, 0x6CDB, 0x6CDC, 0x6CDD, 0x6CDE, 0x6CDF, 0x6CE0, 0x6CE1, 0x6CE2, 0x6CE3, 0x6CE4, 0x6CE5, 0x6CE6,
+    0x6CE7, 0x6CE8, 0x6CE9, 0x6CEA, 0x6CEB, 0x6CEC, 0x6CED, 0x6CEE, 0x6CEF, 0x6CF0, 0x6CF1, 0x6CF2, 0x6CF3, 0x6CF4, 0x6CF5, 0x6CF6,
+    0x6CF7, 0x6CF8, 0x6CF9, 0x6CFA, 0x6CFB, 0x6CFC, 0x6CFD, 0x6CFE, 0x6D41, 0x6D42, 0x6D43, 0x6D44, 0x6D45, 0x6D46, 0x6D47, 0x6D48,
+  },
+  { /* U+E3xx */
+    0x6D49, 0x6D4A, 0x6D4B, 0x6D4C, 0x6D4D, 0x6D4E, 0x6D4F, 0x6D50, 0x6D51, 0x6D52, 0x6D53, 0x6D54, 0x6D55, 0x6D56, 0x6D57, 0x6D58,
+    0x6D59, 0x6D5A, 0x6D5B, 0x6D5C, 0x6D5D, 0x6D5E, 0x6D5F, 0x6D60, 0x6D61, 0x6D62, 0x6D63, 0x6D64, 0x6D65, 0x6D66, 0x6D67, 0x6D68,
+    0x6D69, 0x6D6A, 0x6D6B, 0x6D6C, 0x6D6D, 0x6D6E, 0x6D6F, 0x6D70, 0x6D71, 0x6D72, 0x6D73, 0x6D74, 0x6D75, 0x6D76, 0x6D77, 0x6D78,
+    0x6D79, 0x6D7A, 0x6D7B, 0x6D7C, 0x6D7D, 0x6D7E, 0x6D7F, 0x6D80, 0x6D81, 0x6D82, 0x6D83, 0x6D84, 0x6D85, 0x6D86, 0x6D87, 0x6D88,
+    0x6D89, 0x6D8A, 0x6D8B, 0x6D8C, 0x6D8D, 0x6D8E, 0x6D8F, 0x6D90, 0x6D91, 0x6D92, 0x6D93, 0x6D94, 0x6D95, 0x6D96, 0x6D97, 0x6D98,
+    0x6D99, 0x6D9A, 0x6D9B, 0x6D9C, 0x6D9D, 0x6D9E, 0x6D9F, 0x6DA0, 0x6DA1, 0x6DA2, 0x6DA3, 0x6DA4, 0x6DA5, 0x6DA6, 0x6DA7, 0x6DA8,
+    0x6DA9, 0x6DAA, 0x6DAB, 0x6DAC, 0x6DAD, 0x6DAE, 0x6DAF, 0x6DB0, 0x6DB1, 0x6DB2, 0x6DB3, 0x6DB4, 0x6DB5, 0x6DB6, 0x6DB7, 0x6DB8,
+    0x6DB9, 0x6DBA, 0x6DBB, 0x6DBC, 0x6DBD, 0x6DBE, 0x6DBF, 0x6DC0, 0x6DC1, 0x6DC2, 0x6DC3, 0x6DC4, 0x6DC5, 0x6DC6, 0x6DC7, 0x6DC8,
+    0x6DC9, 0x6DCA, 0x6DCB, 0x6DCC, 0x6DCD, 0x6DCE, 0x6DCF, 0x6DD0, 0x6DD1, 0x6DD2, 0x6DD3, 0x6DD4, 0x6DD5, 0x6DD6, 0x6DD7, 0x6DD8,
+    0x6DD9, 0x6DDA, 0x6DDB, 0x6DDC, 0x6DDD, 0x6DDE, 0x6DDF, 0x6DE0, 0x6DE1, 0x6DE2, 0x6DE3, 0x6DE4, 0x6DE5, 0x6DE6, 0x6DE7, 0x6DE8,
+    0x6DE9, 0x6DEA, 0x6DEB, 0x6DEC, 0x6DED, 0x6DEE, 0x6DEF, 0x6DF0, 0x6DF1, 0x6DF2, 0x6DF3, 0x6DF4, 0x6DF5, 0x6DF6, 0x6DF7, 0x6DF8,
+    0x6DF9, 0x6DFA, 0x6DFB, 0x6DFC, 0x6DFD, 0x6DFE, 0x6E41, 0x6E42, 0x6E43, 0x6E44, 0x6E45, 0x6E46, 0x6E47, 0x6E48, 0x6E49, 0x6E4A,
+    0x6E4B, 0x6E4C, 0x6E4D, 0x6E4E, 0x6E4F, 0x6E50, 0x6E51, 0x6E52, 0x6E53, 0x6E54, 0x6E55, 0x6E56, 0x6E57, 0x6E58, 0x6E59, 0x6E5A,
+    0x6E5B, 0x6E5C, 0x6E5D, 0x6E5E, 0x6E5F, 0x6E60, 0x6E61, 0x6E62, 0x6E63, 0x6E64, 0x6E65, 0x6E66, 0x6E67, 0x6E68, 0x6E69, 0x6E6A,
+    0x6E6B, 0x6E6C, 0x6E6D, 0x6E6E, 0x6E6F, 0x6E70, 0x6E71, 0x6E72, 0x6E73, 0x6E74, 0x6E75, 0x6E76, 0x6E77, 0x6E78, 0x6E79, 0x6E7A,
+    0x6E7B, 0x6E7C, 0x6E7D, 0x6E7E, 0x6E7F, 0x6E80, 0x6E81, 0x6E82, 0x6E83, 0x6E84, 0x6E85, 0x6E86, 0x6E87, 0x6E88, 0x6E89, 0x6E8A,
+  },
+  { /* U+E4xx */
+    0x6E8B, 0x6E8C, 0x6E8D, 0x6E8E, 0x6E8F, 0x6E90, 0x6E91, 0x6E92, 0x6E93, 0x6E94, 0x6E95, 0x6E96, 0x6E97, 0x6E98, 0x6E99, 0x6E9A,
+    0x6E9B, 0x6E9C, 0x6E9D, 0x6E9E, 0x6E9F, 0x6EA0, 0x6EA1, 0x6EA2, 0x6EA3, 0x6EA4, 0x6EA5, 0x6EA6, 0x6EA7, 0x6EA8, 0x6EA9, 0x6EAA,
+    0x6EAB, 0x6EAC, 0x6EAD, 0x6EAE, 0x6EAF, 0x6EB0, 0x6EB1, 0x6EB2, 0x6EB3, 0x6EB4, 0x6EB5, 0x6EB6, 0x6EB7, 0x6EB8, 0x6EB9, 0x6EBA,
+    0x6EBB, 0x6EBC, 0x6EBD, 0x6EBE, 0x6EBF, 0x6EC0, 0x6EC1, 0x6EC2, 0x6EC3, 0x6EC4, 0x6EC5, 0x6EC6, 0x6EC7, 0x6EC8, 0x6EC9, 0x6ECA,
+    0x6ECB, 0x6ECC, 0x6ECD, 0x6ECE, 0x6ECF, 0x6ED0, 0x6ED1, 0x6ED2, 0x6ED3, 0x6ED4, 0x6ED5, 0x6ED6, 0x6ED7, 0x6ED8, 0x6ED9, 0x6EDA,
+    0x6EDB, 0x6EDC, 0x6EDD, 0x6EDE, 0x6EDF, 0x6EE0, 0x6EE1, 0x6EE2, 0x6EE3, 0x6EE4, 0x6EE5, 0x6EE6, 0x6EE7, 0x6EE8, 0x6EE9, 0x6EEA,
+    0x6EEB, 0x6EEC, 0x6EED, 0x6EEE, 0x6EEF, 0x6EF0, 0x6EF1, 0x6EF2, 0x6EF3, 0x6EF4, 0x6EF5, 0x6EF6, 0x6EF7, 0x6EF8, 0x6EF9, 0x6EFA,
+    0x6EFB, 0x6EFC, 0x6EFD, 0x6EFE, 0x6F41, 0x6F42, 0x6F43, 0x6F44, 0x6F45, 0x6F46, 0x6F47, 0x6F48, 0x6F49, 0x6F4A, 0x6F4B, 0x6F4C,
+    0x6F4D, 0x6F4E, 0x6F4F, 0x6F50, 0x6F51, 0x6F52, 0x6F53, 0x6F54, 0x6F55, 0x6F56, 0x6F57, 0x6F58, 0x6F59, 0x6F5A, 0x6F5B, 0x6F5C,
+    0x6F5D, 0x6F5E, 0x6F5F, 0x6F60, 0x6F61, 0x6F62, 0x6F63, 0x6F64, 0x6F65, 0x6F66, 0x6F67, 0x6F68, 0x6F69, 0x6F6A, 0x6F6B, 0x6F6C,
+    0x6F6D, 0x6F6E, 0x6F6F, 0x6F70, 0x6F71, 0x6F72, 0x6F73, 0x6F74, 0x6F75, 0x6F76, 0x6F77, 0x6F78, 0x6F79, 0x6F7A, 0x6F7B, 0x6F7C,
+    0x6F7D, 0x6F7E, 0x6F7F, 0x6F80, 0x6F81, 0x6F82, 0x6F83, 0x6F84, 0x6F85, 0x6F86, 0x6F87, 0x6F88, 0x6F89, 0x6F8A, 0x6F8B, 0x6F8C,
+    0x6F8D, 0x6F8E, 0x6F8F, 0x6F90, 0x6F91, 0x6F92, 0x6F93, 0x6F94, 0x6F95, 0x6F96, 0x6F97, 0x6F98, 0x6F99, 0x6F9A, 0x6F9B, 0x6F9C,
+    0x6F9D, 0x6F9E, 0x6F9F, 0x6FA0, 0x6FA1, 0x6FA2, 0x6FA3, 0x6FA4, 0x6FA5, 0x6FA6, 0x6FA7, 0x6FA8, 0x6FA9, 0x6FAA, 0x6FAB, 0x6FAC,
+    0x6FAD, 0x6FAE, 0x6FAF, 0x6FB0, 0x6FB1, 0x6FB2, 0x6FB3, 0x6FB4, 0x6FB5, 0x6FB6, 0x6FB7, 0x6FB8, 0x6FB9, 0x6FBA, 0x6FBB, 0x6FBC,
+    0x6FBD, 0x6FBE, 0x6FBF, 0x6FC0, 0x6FC1, 0x6FC2, 0x6FC3, 0x6FC4, 0x6FC5, 0x6FC6, 0x6FC7, 0x6FC8, 0x6FC9, 0x6FCA, 0x6FCB, 0x6FCC,
+  },
+  { /* U+E5xx */
+    0x6FCD, 0x6FCE, 0x6FCF, 0x6FD0, 0x6FD1, 0x6FD2, 0x6FD3, 0x6FD4, 0x6FD5, 0x6FD6, 0x6FD7, 0x6FD8, 0x6FD9, 0x6FDA, 0x6FDB, 0x6FDC,
+    0x6FDD, 0x6FDE, 0x6FDF, 0x6FE0, 0x6FE1, 0x6FE2, 0x6FE3, 0x6FE4, 0x6FE5, 0x6FE6, 0x6FE7, 0x6FE8, 0x6FE9, 0x6FEA, 0x6FEB, 0x6FEC,
+    0x6FED, 0x6FEE, 0x6FEF, 0x6FF0, 0x6FF1, 0x6FF2, 0x6FF3, 0x6FF4, 0x6FF5, 0x6FF6, 0x6FF7, 0x6FF8, 0x6FF9, 0x6FFA, 0x6FFB, 0x6FFC,
+    0x6FFD, 0x6FFE, 0x7041, 0x7042, 0x7043, 0x7044, 0x7045, 0x7046, 0x7047, 0x7048, 0x7049, 0x704A, 0x704B, 0x704C, 0x704D, 0x704E,
+    0x704F, 0x7050, 0x7051, 0x7052, 0x7053, 0x7054, 0x7055, 0x7056, 0x7057, 0x7058, 0x7059, 0x705A, 0x705B, 0x705C, 0x705D, 0x705E,
+    0x705F, 0x7060, 0x7061, 0x7062, 0x7063, 0x7064, 0x7065, 0x7066, 0x7067, 0x7068, 0x7069, 0x706A, 0x706B, 0x706C, 0x706D, 0x706E,
+    0x706F, 0x7070, 0x7071, 0x7072, 0x7073, 0x7074, 0x7075, 0x7076, 0x7077, 0x7078, 0x7079, 0x707A, 0x707B, 0x707C, 0x707D, 0x707E,
+    0x707F, 0x7080, 0x7081, 0x7082, 0x7083, 0x7084, 0x7085, 0x7086, 0x7087, 0x7088, 0x7089, 0x708A, 0x708B, 0x708C, 0x708D, 0x708E,
+    0x708F, 0x7090, 0x7091, 0x7092, 0x7093, 0x7094, 0x7095, 0x7096, 0x7097, 0x7098, 0x7099, 0x709A, 0x709B, 0x709C, 0x709D, 0x709E,
+    0x709F, 0x70A0, 0x70A1, 0x70A2, 0x70A3, 0x70A4, 0x70A5, 0x70A6, 0x70A7, 0x70A8, 0x70A9, 0x70AA, 0x70AB, 0x70AC, 0x70AD, 0x70AE,
+    0x70AF, 0x70B0, 0x70B1, 0x70B2, 0x70B3, 0x70B4, 0x70B5, 0x70B6, 0x70B7, 0x70B8, 0x70B9, 0x70BA, 0x70BB, 0x70BC, 0x70BD, 0x70BE,
+    0x70BF, 0x70C0, 0x70C1, 0x70C2, 0x70C3, 0x70C4, 0x70C5, 0x70C6, 0x70C7, 0x70C8, 0x70C9, 0x70CA, 0x70CB, 0x70CC, 0x70CD, 0x70CE,
+    0x70CF, 0x70D0, 0x70D1, 0x70D2, 0x70D3, 0x70D4, 0x70D5, 0x70D6, 0x70D7, 0x70D8, 0x70D9, 0x70DA, 0x70DB, 0x70DC, 0x70DD, 0x70DE,
+    0x70DF, 0x70E0, 0x70E1, 0x70E2, 0x70E3, 0x70E4, 0x70E5, 0x70E6, 0x70E7, 0x70E8, 0x70E9, 0x70EA, 0x70EB, 0x70EC, 0x70ED, 0x70EE,
+    0x70EF, 0x70F0, 0x70F1, 0x70F2, 0x70F3, 0x70F4, 0x70F5, 0x70F6, 0x70F7, 0x70F8, 0x70F9, 0x70FA, 0x70FB, 0x70FC, 0x70FD, 0x70FE,
+    0x7141, 0x7142, 0x7143, 0x7144, 0x7145, 0x7146, 0x7147, 0x7148, 0x7149, 0x714A, 0x714B, 0x714C, 0x714D, 0x714E, 0x714F, 0x7150,
+  },
+  { /* U+E6xx */
+    0x7151, 0x7152, 0x7153, 0x7154, 0x7155, 0x7156, 0x7157, 0x7158, 0x7159, 0x715A, 0x715B, 0x715C, 0x715D, 0x715E, 0x715F, 0x7160,
+    0x7161, 0x7162, 0x7163, 0x7164, 0x7165, 0x7166, 0x7167, 0x7168, 0x7169, 0x716A, 0x716B, 0x716C, 0x716D, 0x716E, 0x716F, 0x7170,
+    0x7171, 0x7172, 0x7173, 0x7174, 0x7175, 0x7176, 0x7177, 0x7178, 0x7179, 0x717A, 0x717B, 0x717C, 0x717D, 0x717E, 0x717F, 0x7180,
+    0x7181, 0x7182, 0x7183, 0x7184, 0x7185, 0x7186, 0x7187, 0x7188, 0x7189, 0x718A, 0x718B, 0x718C, 0x718D, 0x718E, 0x718F, 0x7190,
+    0x7191, 0x7192, 0x7193, 0x7194, 0x7195, 0x7196, 0x7197, 0x7198, 0x7199, 0x719A, 0x719B, 0x719C, 0x719D, 0x719E, 0x719F, 0x71A0,
+    0x71A1, 0x71A2, 0x71A3, 0x71A4, 0x71A5, 0x71A6, 0x71A7, 0x71A8, 0x71A9, 0x71AA, 0x71AB, 0x71AC, 0x71AD, 0x71AE, 0x71AF, 0x71B0,
+    0x71B1, 0x71B2, 0x71B3, 0x71B4, 0x71B5, 0x71B6, 0x71B7, 0x71B8, 0x71B9, 0x71BA, 0x71BB, 0x71BC, 0x71BD, 0x71BE, 0x71BF, 0x71C0,
+    0x71C1, 0x71C2, 0x71C3, 0x71C4, 0x71C5, 0x71C6, 0x71C7, 0x71C8, 0x71C9, 0x71CA, 0x71CB, 0x71CC, 0x71CD, 0x71CE, 0x71CF, 0x71D0,
+    0x71D1, 0x71D2, 0x71D3, 0x71D4, 0x71D5, 0x71D6, 0x71D7, 0x71D8, 0x71D9, 0x71DA, 0x71DB, 0x71DC, 0x71DD, 0x71DE, 0x71DF, 0x71E0,
+    0x71E1, 0x71E2, 0x71E3, 0x71E4, 0x71E5, 0x71E6, 0x71E7, 0x71E8, 0x71E9, 0x71EA, 0x71EB, 0x71EC, 0x71ED, 0x71EE, 0x71EF, 0x71F0,
+    0x71F1, 0x71F2, 0x71F3, 0x71F4, 0x71F5, 0x71F6, 0x71F7, 0x71F8, 0x71F9, 0x71FA, 0x71FB, 0x71FC, 0x71FD, 0x71FE, 0x7241, 0x7242,
+    0x7243, 0x7244, 0x7245, 0x7246, 0x7247, 0x7248, 0x7249, 0x724A, 0x724B, 0x724C, 0x724D, 0x724E, 0x724F, 0x7250, 0x7251, 0x7252,
+    0x7253, 0x7254, 0x7255, 0x7256, 0x7257, 0x7258, 0x7259, 0x725A, 0x725B, 0x725C, 0x725D, 0x725E, 0x725F, 0x7260, 0x7261, 0x7262,
+    0x7263, 0x7264, 0x7265, 0x7266, 0x7267, 0x7268, 0x7269, 0x726A, 0x726B, 0x726C, 0x726D, 0x726E, 0x726F, 0x7270, 0x7271, 0x7272,
+    0x7273, 0x7274, 0x7275, 0x7276, 0x7277, 0x7278, 0x7279, 0x727A, 0x727B, 0x727C, 0x727D, 0x727E, 0x727F, 0x7280, 0x7281, 0x7282,
+    0x7283, 0x7284, 0x7285, 0x7286, 0x7287, 0x7288, 0x7289, 0x728A, 0x728B, 0x728C, 0x728D, 0x728E, 0x728F, 0x7290, 0x7291, 0x7292,
+  },
+  { /* U+E7xx */
+    0x7293, 0x7294, 0x7295, 0x7296, 0x7297, 0x7298, 0x7299, 0x729A, 0x729B, 0x729C, 0x729D, 0x729E, 0x729F, 0x72A0, 0x72A1, 0x72A2,
+    0x72A3, 0x72A4, 0x72A5, 0x72A6, 0x72A7, 0x72A8, 0x72A9, 0x72AA, 0x72AB, 0x72AC, 0x72AD, 0x72AE, 0x72AF, 0x72B0, 0x72B1, 0x72B2,
+    0x72B3, 0x72B4, 0x72B5, 0x72B6, 0x72B7, 0x72B8, 0x72B9, 0x72BA, 0x72BB, 0x72BC, 0x72BD, 0x72BE, 0x72BF, 0x72C0, 0x72C1, 0x72C2,
+    0x72C3, 0x72C4, 0x72C5, 0x72C6, 0x72C7, 0x72C8, 0x72C9, 0x72CA, 0x72CB, 0x72CC, 0x72CD, 0x72CE, 0x72CF, 0x72D0, 0x72D1, 0x72D2,
+    0x72D3, 0x72D4, 0x72D5, 0x72D6, 0x72D7, 0x72D8, 0x72D9, 0x72DA, 0x72DB, 0x72DC, 0x72DD, 0x72DE, 0x72DF, 0x72E0, 0x72E1, 0x72E2,
+    0x72E3, 0x72E4, 0x72E5, 0x72E6, 0x72E7, 0x72E8, 0x72E9, 0x72EA, 0x72EB, 0x72EC, 0x72ED, 0x72EE, 0x72EF, 0x72F0, 0x72F1, 0x72F2,
+    0x72F3, 0x72F4, 0x72F5, 0x72F6, 0x72F7, 0x72F8, 0x72F9, 0x72FA, 0x72FB, 0x72FC, 0x72FD, 0x72FE, 0x7341, 0x7342, 0x7343, 0x7344,
+    0x7345, 0x7346, 0x7347, 0x7348, 0x7349, 0x734A, 0x734B, 0x734C, 0x734D, 0x734E, 0x734F, 0x7350, 0x7351, 0x7352, 0x7353, 0x7354,
+    0x7355, 0x7356, 0x7357, 0x7358, 0x7359, 0x735A, 0x735B, 0x735C, 0x735D, 0x735E, 0x735F, 0x7360, 0x7361, 0x7362, 0x7363, 0x7364,
+    0x7365, 0x7366, 0x7367, 0x7368, 0x7369, 0x736A, 0x736B, 0x736C, 0x736D, 0x736E, 0x736F, 0x7370, 0x7371, 0x7372, 0x7373, 0x7374,
+    0x7375, 0x7376, 0x7377, 0x7378, 0x7379, 0x737A, 0x737B, 0x737C, 0x737D, 0x737E, 0x737F, 0x7380, 0x7381, 0x7382, 0x7383, 0x7384,
+    0x7385, 0x7386, 0x7387, 0x7388, 0x7389, 0x738A, 0x738B, 0x738C, 0x738D, 0x738E, 0x738F, 0x7390, 0x7391, 0x7392, 0x7393, 0x7394,
+    0x7395, 0x7396, 0x7397, 0x7398, 0x7399, 0x739A, 0x739B, 0x739C, 0x739D, 0x739E, 0x739F, 0x73A0, 0x73A1, 0x73A2, 0x73A3, 0x73A4,
+    0x73A5, 0x73A6, 0x73A7, 0x73A8, 0x73A9, 0x73AA, 0x73AB, 0x73AC, 0x73AD, 0x73AE, 0x73AF, 0x73B0, 0x73B1, 0x73B2, 0x73B3, 0x73B4,
+    0x73B5, 0x73B6, 0x73B7, 0x73B8, 0x73B9, 0x73BA, 0x73BB, 0x73BC, 0x73BD, 0x73BE, 0x73BF, 0x73C0, 0x73C1, 0x73C2, 0x73C3, 0x73C4,
+    0x73C5, 0x73C6, 0x73C7, 0x73C8, 0x73C9, 0x73CA, 0x73CB, 0x73CC, 0x73CD, 0x73CE, 0x73CF, 0x73D0, 0x73D1, 0x73D2, 0x73D3, 0x73D4,
+  },
+  { /* U+E8xx */
+    0x73D5, 0x73D6, 0x73D7, 0x73D8, 0x73D9, 0x73DA, 0x73DB, 0x73DC, 0x73DD, 0x73DE, 0x73DF, 0x73E0, 0x73E1, 0x73E2, 0x73E3, 0x73E4,
+    0x73E5, 0x73E6, 0x73E7, 0x73E8, 0x73E9, 0x73EA, 0x73EB, 0x73EC, 0x73ED, 0x73EE, 0x73EF, 0x73F0, 0x73F1, 0x73F2, 0x73F3, 0x73F4,
+    0x73F5, 0x73F6, 0x73F7, 0x73F8, 0x73F9, 0x73FA, 0x73FB, 0x73FC, 0x73FD, 0x73FE, 0x7441, 0x7442, 0x7443, 0x7444, 0x7445, 0x7446,
+    0x7447, 0x7448, 0x7449, 0x744A, 0x744B, 0x744C, 0x744D, 0x744E, 0x744F, 0x7450, 0x7451, 0x7452, 0x7453, 0x7454, 0x7455, 0x7456,
+    0x7457, 0x7458, 0x7459, 0x745A, 0x745B, 0x745C, 0x745D, 0x745E, 0x745F, 0x7460, 0x7461, 0x7462, 0x7463, 0x7464, 0x7465, 0x7466,
+    0x7467, 0x7468, 0x7469, 0x746A, 0x746B, 0x746C, 0x746D, 0x746E, 0x746F, 0x7470, 0x7471, 0x7472, 0x7473, 0x7474, 0x7475, 0x7476,
+    0x7477, 0x7478, 0x7479, 0x747A, 0x747B, 0x747C, 0x747D, 0x747E, 0x747F, 0x7480, 0x7481, 0x7482, 0x7483, 0x7484, 0x7485, 0x7486,
+    0x7487, 0x7488, 0x7489, 0x748A, 0x748B, 0x748C, 0x748D, 0x748E, 0x748F, 0x7490, 0x7491, 0x7492, 0x7493, 0x7494, 0x7495, 0x7496,
+    0x7497, 0x7498, 0x7499, 0x749A, 0x749B, 0x749C, 0x749D, 0x749E, 0x749F, 0x74A0, 0x74A1, 0x74A2, 0x74A3, 0x74A4, 0x74A5, 0x74A6,
+    0x74A7, 0x74A8, 0x74A9, 0x74AA, 0x74AB, 0x74AC, 0x74AD, 0x74AE, 0x74AF, 0x74B0, 0x74B1, 0x74B2, 0x74B3, 0x74B4, 0x74B5, 0x74B6,
+    0x74B7, 0x74B8, 0x74B9, 0x74BA, 0x74BB, 0x74BC, 0x74BD, 0x74BE, 0x74BF, 0x74C0, 0x74C1, 0x74C2, 0x74C3, 0x74C4, 0x74C5, 0x74C6,
+    0x74C7, 0x74C8, 0x74C9, 0x74CA, 0x74CB, 0x74CC, 0x74CD, 0x74CE, 0x74CF, 0x74D0, 0x74D1, 0x74D2, 0x74D3, 0x74D4, 0x74D5, 0x74D6,
+    0x74D7, 0x74D8, 0x74D9, 0x74DA, 0x74DB, 0x74DC, 0x74DD, 0x74DE, 0x74DF, 0x74E0, 0x74E1, 0x74E2, 0x74E3, 0x74E4, 0x74E5, 0x74E6,
+    0x74E7, 0x74E8, 0x74E9, 0x74EA, 0x74EB, 0x74EC, 0x74ED, 0x74EE, 0x74EF, 0x74F0, 0x74F1, 0x74F2, 0x74F3, 0x74F4, 0x74F5, 0x74F6,
+    0x74F7, 0x74F8, 0x74F9, 0x74FA, 0x74FB, 0x74FC, 0x74FD, 0x74FE, 0x7541, 0x7542, 0x7543, 0x7544, 0x7545, 0x7546, 0x7547, 0x7548,
+    0x7549, 0x754A, 0x754B, 0x754C, 0x754D, 0x754E, 0x754F, 0x7550, 0x7551, 0x7552, 0x7553, 0x7554, 0x7555, 0x7556, 0x7557, 0x7558,
+  },
+  { /* U+E9xx */
+    0x7559, 0x755A, 0x755B, 0x755C, 0x755D, 0x755E, 0x755F, 0x7560, 0x7561, 0x7562, 0x7563, 0x7564, 0x7565, 0x7566, 0x7567, 0x7568,
+    0x7569, 0x756A, 0x756B, 0x756C, 0x756D, 0x756E, 0x756F, 0x7570, 0x7571, 0x7572, 0x7573, 0x7574, 0x7575, 0x7576, 0x7577, 0x7578,
+    0x7579, 0x757A, 0x757B, 0x757C, 0x757D, 0x757E, 0x757F, 0x7580, 0x7581, 0x7582, 0x7583, 0x7584, 0x7585, 0x7586, 0x7587, 0x7588,
+    0x7589, 0x758A, 0x758B, 0x758C, 0x758D, 0x758E, 0x758F, 0x7590, 0x7591, 0x7592, 0x7593, 0x7594, 0x7595, 0x7596, 0x7597, 0x7598,
+    0x7599, 0x759A, 0x759B, 0x759C, 0x759D, 0x759E, 0x759F, 0x75A0, 0x75A1, 0x75A2, 0x75A3, 0x75A4, 0x75A5, 0x75A6, 0x75A7, 0x75A8,
+    0x75A9, 0x75AA, 0x75AB, 0x75AC, 0x75AD, 0x75AE, 0x75AF, 0x75B0, 0x75B1, 0x75B2, 0x75B3, 0x75B4, 0x75B5, 0x75B6, 0x75B7, 0x75B8,
+    0x75B9, 0x75BA, 0x75BB, 0x75BC, 0x75BD, 0x75BE, 0x75BF, 0x75C0, 0x75C1, 0x75C2, 0x75C3, 0x75C4, 0x75C5, 0x75C6, 0x75C7, 0x75C8,
+    0x75C9, 0x75CA, 0x75CB, 0x75CC, 0x75CD, 0x75CE, 0x75CF, 0x75D0, 0x75D1, 0x75D2, 0x75D3, 0x75D4, 0x75D5, 0x75D6, 0x75D7, 0x75D8,
+    0x75D9, 0x75DA, 0x75DB, 0x75DC, 0x75DD, 0x75DE, 0x75DF, 0x75E0, 0x75E1, 0x75E2, 0x75E3, 0x75E4, 0x75E5, 0x75E6, 0x75E7, 0x75E8,
+    0x75E9, 0x75EA, 0x75EB, 0x75EC, 0x75ED, 0x75EE, 0x75EF, 0x75F0, 0x75F1, 0x75F2, 0x75F3, 0x75F4, 0x75F5, 0x75F6, 0x75F7, 0x75F8,
+    0x75F9, 0x75FA, 0x75FB, 0x75FC, 0x75FD, 0x75FE, 0x7641, 0x7642, 0x7643, 0x7644, 0x7645, 0x7646, 0x7647, 0x7648, 0x7649, 0x764A,
+    0x764B, 0x764C, 0x764D, 0x764E, 0x764F, 0x7650, 0x7651, 0x7652, 0x7653, 0x7654, 0x7655, 0x7656, 0x7657, 0x7658, 0x7659, 0x765A,
+    0x765B, 0x765C, 0x765D, 0x765E, 0x765F, 0x7660, 0x7661, 0x7662, 0x7663, 0x7664, 0x7665, 0x7666, 0x7667, 0x7668, 0x7669, 0x766A,
+    0x766B, 0x766C, 0x766D, 0x766E, 0x766F, 0x7670, 0x7671, 0x7672, 0x7673, 0x7674, 0x7675, 0x7676, 0x7677, 0x7678, 0x7679, 0x767A,
+    0x767B, 0x767C, 0x767D, 0x767E, 0x767F, 0x7680, 0x7681, 0x7682, 0x7683, 0x7684, 0x7685, 0x7686, 0x7687, 0x7688, 0x7689, 0x768A,
+    0x768B, 0x768C, 0x768D, 0x768E, 0x768F, 0x7690, 0x7691, 0x7692, 0x7693, 0x7694, 0x7695, 0x7696, 0x7697, 0x7698, 0x7699, 0x769A,
+  },
+  { /* U+EAxx */
+    0x769B, 0x769C, 0x769D, 0x769E, 0x769F, 0x76A0, 0x76A1, 0x76A2, 0x76A3, 0x76A4, 0x76A5, 0x76A6, 0x76A7, 0x76A8, 0x76A9, 0x76AA,
+    0x76AB, 0x76AC, 0x76AD, 0x76AE, 0x76AF, 0x76B0, 0x76B1, 0x76B2, 0x76B3, 0x76B4, 0x76B5, 0x76B6, 0x76B7, 0x76B8, 0x76B9, 0x76BA,
+    0x76BB, 0x76BC, 0x76BD, 0x76BE, 0x76BF, 0x76C0, 0x76C1, 0x76C2, 0x76C3, 0x76C4, 0x76C5, 0x76C6, 0x76C7, 0x76C8, 0x76C9, 0x76CA,
+    0x76CB, 0x76CC, 0x76CD, 0x76CE, 0x76CF, 0x76D0, 0x76D1, 0x76D2, 0x76D3, 0x76D4, 0x76D5, 0x76D6, 0x76D7, 0x76D8, 0x76D9, 0x76DA,
+    0x76DB, 0x76DC, 0x76DD, 0x76DE, 0x76DF, 0x76E0, 0x76E1, 0x76E2, 0x76E3, 0x76E4, 0x76E5, 0x76E6, 0x76E7, 0x76E8, 0x76E9, 0x76EA,
+    0x76EB, 0x76EC, 0x76ED, 0x76EE, 0x76EF, 0x76F0, 0x76F1, 0x76F2, 0x76F3, 0x76F4, 0x76F5, 0x76F6, 0x76F7, 0x76F8, 0x76F9, 0x76FA,
+    0x76FB, 0x76FC, 0x76FD, 0x76FE, 0x7741, 0x7742, 0x7743, 0x7744, 0x7745, 0x7746, 0x7747, 0x7748, 0x7749, 0x774A, 0x774B, 0x774C,
+    0x774D, 0x774E, 0x774F, 0x7750, 0x7751, 0x7752, 0x7753, 0x7754, 0x7755, 0x7756, 0x7757, 0x7758, 0x7759, 0x775A, 0x775B, 0x775C,
+    0x775D, 0x775E, 0x775F, 0x7760, 0x7761, 0x7762, 0x7763, 0x7764, 0x7765, 0x7766, 0x7767, 0x7768, 0x7769, 0x776A, 0x776B, 0x776C,
+    0x776D, 0x776E, 0x776F, 0x7770, 0x7771, 0x7772, 0x7773, 0x7774, 0x7775, 0x7776, 0x7777, 0x7778, 0x7779, 0x777A, 0x777B, 0x777C,
+    0x777D, 0x777E, 0x777F, 0x7780, 0x7781, 0x7782, 0x7783, 0x7784, 0x7785, 0x7786, 0x7787, 0x7788, 0x7789, 0x778A, 0x778B, 0x778C,
+    0x778D, 0x778E, 0x778F, 0x7790, 0x7791, 0x7792, 0x7793, 0x7794, 0x7795, 0x7796, 0x7797, 0x7798, 0x7799, 0x779A, 0x779B, 0x779C,
+    0x779D, 0x779E, 0x779F, 0x77A0, 0x77A1, 0x77A2, 0x77A3, 0x77A4, 0x77A5, 0x77A6, 0x77A7, 0x77A8, 0x77A9, 0x77AA, 0x77AB, 0x77AC,
+    0x77AD, 0x77AE, 0x77AF, 0x77B0, 0x77B1, 0x77B2, 0x77B3, 0x77B4, 0x77B5, 0x77B6, 0x77B7, 0x77B8, 0x77B9, 0x77BA, 0x77BB, 0x77BC,
+    0x77BD, 0x77BE, 0x77BF, 0x77C0, 0x77C1, 0x77C2, 0x77C3, 0x77C4, 0x77C5, 0x77C6, 0x77C7, 0x77C8, 0x77C9, 0x77CA, 0x77CB, 0x77CC,
+    0x77CD, 0x77CE, 0x77CF, 0x77D0, 0x77D1, 0x77D2, 0x77D3, 0x77D4, 0x77D5, 0x77D6, 0x77D7, 0x77D8, 0x77D9, 0x77DA, 0x77DB, 0x77DC,
+  },
+  { /* U+EBxx */
+    0x77DD, 0x77DE, 0x77DF, 0x77E0, 0x77E1, 0x77E2, 0x77E3, 0x77E4, 0x77E5, 0x77E6, 0x77E7, 0x77E8, 0x77E9, 0x77EA, 0x77EB, 0x77EC,
+    0x77ED, 0x77EE, 0x77EF, 0x77F0, 0x77F1, 0x77F2, 0x77F3, 0x77F4, 0x77F5, 0x77F6, 0x77F7, 0x77F8, 0x77F9, 0x77FA, 0x77FB, 0x77FC,
+    0x77FD, 0x77FE, 0x7841, 0x7842, 0x7843, 0x7844, 0x7845, 0x7846, 0x7847, 0x7848, 0x7849, 0x784A, 0x784B, 0x784C, 0x784D, 0x784E,
+    0x784F, 0x7850, 0x7851, 0x7852, 0x7853, 0x7854, 0x7855, 0x7856, 0x7857, 0x7858, 0x7859, 0x785A, 0x785B, 0x785C, 0x785D, 0x785E,
+    0x785F, 0x7860, 0x7861, 0x7862, 0x7863, 0x7864, 0x7865, 0x7866, 0x7867, 0x7868, 0x7869, 0x786A, 0x786B, 0x786C, 0x786D, 0x786E,
+    0x786F, 0x7870, 0x7871, 0x7872, 0x7873, 0x7874, 0x7875, 0x7876, 0x7877, 0x7878, 0x7879, 0x787A, 0x787B, 0x787C, 0x787D, 0x787E,
+    0x787F, 0x7880, 0x7881, 0x7882, 0x7883, 0x7884, 0x7885, 0x7886, 0x7887, 0x7888, 0x7889, 0x788A, 0x788B, 0x788C, 0x788D, 0x788E,
+    0x788F, 0x7890, 0x7891, 0x7892, 0x7893, 0x7894, 0x7895, 0x7896, 0x7897, 0x7898, 0x7899, 0x789A, 0x789B, 0x789C, 0x789D, 0x789E,
+    0x789F, 0x78A0, 0x78A1, 0x78A2, 0x78A3, 0x78A4, 0x78A5, 0x78A6, 0x78A7, 0x78A8, 0x78A9, 0x78AA, 0x78AB, 0x78AC, 0x78AD, 0x78AE,
+    0x78AF, 0x78B0, 0x78B1, 0x78B2, 0x78B3, 0x78B4, 0x78B5, 0x78B6, 0x78B7, 0x78B8, 0x78B9, 0x78BA, 0x78BB, 0x78BC, 0x78BD, 0x78BE,
+    0x78BF, 0x78C0, 0x78C1, 0x78C2, 0x78C3, 0x78C4, 0x78C5, 0x78C6, 0x78C7, 0x78C8, 0x78C9, 0x78CA, 0x78CB, 0x78CC, 0x78CD, 0x78CE,
+    0x78CF, 0x78D0, 0x78D1, 0x78D2, 0x78D3, 0x78D4, 0x78D5, 0x78D6, 0x78D7, 0x78D8, 0x78D9, 0x78DA, 0x78DB, 0x78DC, 0x78DD, 0x78DE,
+    0x78DF, 0x78E0, 0x78E1, 0x78E2, 0x78E3, 0x78E4, 0x78E5, 0x78E6, 0x78E7, 0x78E8, 0x78E9, 0x78EA, 0x78EB, 0x78EC, 0x78ED, 0x78EE,
+    0x78EF, 0x78F0, 0x78F1, 0x78F2, 0x78F3, 0x78F4, 0x78F5, 0x78F6, 0x78F7, 0x78F8, 0x78F9, 0x78FA, 0x78FB, 0x78FC, 0x78FD, 0x78FE,
+    0x7941, 0x7942, 0x7943, 0x7944, 0x7945, 0x7946, 0x7947, 0x7948, 0x7949, 0x794A, 0x794B, 0x794C, 0x794D, 0x794E, 0x794F, 0x7950,
+    0x7951, 0x7952, 0x7953, 0x7954, 0x7955, 0x7956, 0x7957, 0x7958, 0x7959, 0x795A, 0x795B, 0x795C, 0x795D, 0x795E, 0x795F, 0x7960,
+  },
+  { /* U+ECxx */
+    0x7961, 0x7962, 0x7963, 0x7964, 0x7965, 0x7966, 0x7967, 0x7968, 0x7969, 0x796A, 0x796B, 0x796C, 0x796D, 0x796E, 0x796F, 0x7970,
+    0x7971, 0x7972, 0x7973, 0x7974, 0x7975, 0x7976, 0x7977, 0x7978, 0x7979, 0x797A, 0x797B, 0x797C, 0x797D, 0x797E, 0x797F, 0x7980,
+    0x7981, 0x7982, 0x7983, 0x7984, 0x7985, 0x7986, 0x7987, 0x7988, 0x7989, 0x798A, 0x798B, 0x798C, 0x798D, 0x798E, 0x798F, 0x7990,
+    0x7991, 0x7992, 0x7993, 0x7994, 0x7995, 0x7996, 0x7997, 0x7998, 0x7999, 0x799A, 0x799B, 0x799C, 0x799D, 0x799E, 0x799F, 0x79A0,
+    0x79A1, 0x79A2, 0x79A3, 0x79A4, 0x79A5, 0x79A6, 0x79A7, 0x79A8, 0x79A9, 0x79AA, 0x79AB, 0x79AC, 0x79AD, 0x79AE, 0x79AF, 0x79B0,
+    0x79B1, 0x79B2, 0x79B3, 0x79B4, 0x79B5, 0x79B6, 0x79B7, 0x79B8, 0x79B9, 0x79BA, 0x79BB, 0x79BC, 0x79BD, 0x79BE, 0x79BF, 0x79C0,
+    0x79C1, 0x79C2, 0x79C3, 0x79C4, 0x79C5, 0x79C6, 0x79C7, 0x79C8, 0x79C9, 0x79CA, 0x79CB, 0x79CC, 0x79CD, 0x79CE, 0x79CF, 0x79D0,
+    0x79D1, 0x79D2, 0x79D3, 0x79D4, 0x79D5, 0x79D6, 0x79D7, 0x79D8, 0x79D9, 0x79DA, 0x79DB, 0x79DC, 0x79DD, 0x79DE, 0x79DF, 0x79E0,
+    0x79E1, 0x79E2, 0x79E3, 0x79E4, 0x79E5, 0x79E6, 0x79E7, 0x79E8, 0x79E9, 0x79EA, 0x79EB, 0x79EC, 0x79ED, 0x79EE, 0x79EF, 0x79F0,
+    0x79F1, 0x79F2, 0x79F3, 0x79F4, 0x79F5, 0x79F6, 0x79F7, 0x79F8, 0x79F9, 0x79FA, 0x79FB, 0x79FC, 0x79FD, 0x79FE, 0x7A41, 0x7A42,
+    0x7A43, 0x7A44, 0x7A45, 0x7A46, 0x7A47, 0x7A48, 0x7A49, 0x7A4A, 0x7A4B, 0x7A4C, 0x7A4D, 0x7A4E, 0x7A4F, 0x7A50, 0x7A51, 0x7A52,
+    0x7A53, 0x7A54, 0x7A55, 0x7A56, 0x7A57, 0x7A58, 0x7A59, 0x7A5A, 0x7A5B, 0x7A5C, 0x7A5D, 0x7A5E, 0x7A5F, 0x7A60, 0x7A61, 0x7A62,
+    0x7A63, 0x7A64, 0x7A65, 0x7A66, 0x7A67, 0x7A68, 0x7A69, 0x7A6A, 0x7A6B, 0x7A6C, 0x7A6D, 0x7A6E, 0x7A6F, 0x7A70, 0x7A71, 0x7A72,
+    0x7A73, 0x7A74, 0x7A75, 0x7A76, 0x7A77, 0x7A78, 0x7A79, 0x7A7A, 0x7A7B, 0x7A7C, 0x7A7D, 0x7A7E, 0x7A7F, 0x7A80, 0x7A81, 0x7A82,
+    0x7A83, 0x7A84, 0x7A85, 0x7A86, 0x7A87, 0x7A88, 0x7A89, 0x7A8A, 0x7A8B, 0x7A8C, 0x7A8D, 0x7A8E, 0x7A8F, 0x7A90, 0x7A91, 0x7A92,
+    0x7A93, 0x7A94, 0x7A95, 0x7A96, 0x7A97, 0x7A98, 0x7A99, 0x7A9A, 0x7A9B, 0x7A9C, 0x7A9D, 0x7A9E, 0x7A9F, 0x7AA0, 0x7AA1, 0x7AA2,
+  },
+  { /* U+EDxx */
+    0x7AA3, 0x7AA4, 0x7AA5, 0x7AA6, 0x7AA7, 0x7AA8, 0x7AA9, 0x7AAA, 0x7AAB, 0x7AAC, 0x7AAD, 0x7AAE, 0x7AAF, 0x7AB0, 0x7AB1, 0x7AB2,
+    0x7AB3, 0x7AB4, 0x7AB5, 0x7AB6, 0x7AB7, 0x7AB8, 0x7AB9, 0x7ABA, 0x7ABB, 0x7ABC, 0x7ABD, 0x7ABE, 0x7ABF, 0x7AC0, 0x7AC1, 0x7AC2,
+    0x7AC3, 0x7AC4, 0x7AC5, 0x7AC6, 0x7AC7, 0x7AC8, 0x7AC9, 0x7ACA, 0x7ACB, 0x7ACC, 0x7ACD, 0x7ACE, 0x7ACF, 0x7AD0, 0x7AD1, 0x7AD2,
+    0x7AD3, 0x7AD4, 0x7AD5, 0x7AD6, 0x7AD7, 0x7AD8, 0x7AD9, 0x7ADA, 0x7ADB, 0x7ADC, 0x7ADD, 0x7ADE, 0x7ADF, 0x7AE0, 0x7AE1, 0x7AE2,
+    0x7AE3, 0x7AE4, 0x7AE5, 0x7AE6, 0x7AE7, 0x7AE8, 0x7AE9, 0x7AEA, 0x7AEB, 0x7AEC, 0x7AED, 0x7AEE, 0x7AEF, 0x7AF0, 0x7AF1, 0x7AF2,
+    0x7AF3, 0x7AF4, 0x7AF5, 0x7AF6, 0x7AF7, 0x7AF8, 0x7AF9, 0x7AFA, 0x7AFB, 0x7AFC, 0x7AFD, 0x7AFE, 0x7B41, 0x7B42, 0x7B43, 0x7B44,
+    0x7B45, 0x7B46, 0x7B47, 0x7B48, 0x7B49, 0x7B4A, 0x7B4B, 0x7B4C, 0x7B4D, 0x7B4E, 0x7B4F, 0x7B50, 0x7B51, 0x7B52, 0x7B53, 0x7B54,
+    0x7B55, 0x7B56, 0x7B57, 0x7B58, 0x7B59, 0x7B5A, 0x7B5B, 0x7B5C, 0x7B5D, 0x7B5E, 0x7B5F, 0x7B60, 0x7B61, 0x7B62, 0x7B63, 0x7B64,
+    0x7B65, 0x7B66, 0x7B67, 0x7B68, 0x7B69, 0x7B6A, 0x7B6B, 0x7B6C, 0x7B6D, 0x7B6E, 0x7B6F, 0x7B70, 0x7B71, 0x7B72, 0x7B73, 0x7B74,
+    0x7B75, 0x7B76, 0x7B77, 0x7B78, 0x7B79, 0x7B7A, 0x7B7B, 0x7B7C, 0x7B7D, 0x7B7E, 0x7B7F, 0x7B80, 0x7B81, 0x7B82, 0x7B83, 0x7B84,
+    0x7B85, 0x7B86, 0x7B87, 0x7B88, 0x7B89, 0x7B8A, 0x7B8B, 0x7B8C, 0x7B8D, 0x7B8E, 0x7B8F, 0x7B90, 0x7B91, 0x7B92, 0x7B93, 0x7B94,
+    0x7B95, 0x7B96, 0x7B97, 0x7B98, 0x7B99, 0x7B9A, 0x7B9B, 0x7B9C, 0x7B9D, 0x7B9E, 0x7B9F, 0x7BA0, 0x7BA1, 0x7BA2, 0x7BA3, 0x7BA4,
+    0x7BA5, 0x7BA6, 0x7BA7, 0x7BA8, 0x7BA9, 0x7BAA, 0x7BAB, 0x7BAC, 0x7BAD, 0x7BAE, 0x7BAF, 0x7BB0, 0x7BB1, 0x7BB2, 0x7BB3, 0x7BB4,
+    0x7BB5, 0x7BB6, 0x7BB7, 0x7BB8, 0x7BB9, 0x7BBA, 0x7BBB, 0x7BBC, 0x7BBD, 0x7BBE, 0x7BBF, 0x7BC0, 0x7BC1, 0x7BC2, 0x7BC3, 0x7BC4,
+    0x7BC5, 0x7BC6, 0x7BC7, 0x7BC8, 0x7BC9, 0x7BCA, 0x7BCB, 0x7BCC, 0x7BCD, 0x7BCE, 0x7BCF, 0x7BD0, 0x7BD1, 0x7BD2, 0x7BD3, 0x7BD4,
+    0x7BD5, 0x7BD6, 0x7BD7, 0x7BD8, 0x7BD9, 0x7BDA, 0x7BDB, 0x7BDC, 0x7BDD, 0x7BDE, 0x7BDF, 0x7BE0, 0x7BE1, 0x7BE2, 0x7BE3, 0x7BE4,
+  },
+  { /* U+EExx */
+    0x7BE5, 0x7BE6, 0x7BE7, 0x7BE8, 0x7BE9, 0x7BEA, 0x7BEB, 0x7BEC, 0x7BED, 0x7BEE, 0x7BEF, 0x7BF0, 0x7BF1, 0x7BF2, 0x7BF3, 0x7BF4,
+    0x7BF5, 0x7BF6, 0x7BF7, 0x7BF8, 0x7BF9, 0x7BFA, 0x7BFB, 0x7BFC, 0x7BFD, 0x7BFE, 0x7C41, 0x7C42, 0x7C43, 0x7C44, 0x7C45, 0x7C46,
+    0x7C47, 0x7C48, 0x7C49, 0x7C4A, 0x7C4B, 0x7C4C, 0x7C4D, 0x7C4E, 0x7C4F, 0x7C50, 0x7C51, 0x7C52, 0x7C53, 0x7C54, 0x7C55, 0x7C56,
+    0x7C57, 0x7C58, 0x7C59, 0x7C5A, 0x7C5B, 0x7C5C, 0x7C5D, 0x7C5E, 0x7C5F, 0x7C60, 0x7C61, 0x7C62, 0x7C63, 0x7C64, 0x7C65, 0x7C66,
+    0x7C67, 0x7C68, 0x7C69, 0x7C6A, 0x7C6B, 0x7C6C, 0x7C6D, 0x7C6E, 0x7C6F, 0x7C70, 0x7C71, 0x7C72, 0x7C73, 0x7C74, 0x7C75, 0x7C76,
+    0x7C77, 0x7C78, 0x7C79, 0x7C7A, 0x7C7B, 0x7C7C, 0x7C7D, 0x7C7E, 0x7C7F, 0x7C80, 0x7C81, 0x7C82, 0x7C83, 0x7C84, 0x7C85, 0x7C86,
+    0x7C87, 0x7C88, 0x7C89, 0x7C8A, 0x7C8B, 0x7C8C, 0x7C8D, 0x7C8E, 0x7C8F, 0x7C90, 0x7C91, 0x7C92, 0x7C93, 0x7C94, 0x7C95, 0x7C96,
+    0x7C97, 0x7C98, 0x7C99, 0x7C9A, 0x7C9B, 0x7C9C, 0x7C9D, 0x7C9E, 0x7C9F, 0x7CA0, 0x7CA1, 0x7CA2, 0x7CA3, 0x7CA4, 0x7CA5, 0x7CA6,
+    0x7CA7, 0x7CA8, 0x7CA9, 0x7CAA, 0x7CAB, 0x7CAC, 0x7CAD, 0x7CAE, 0x7CAF, 0x7CB0, 0x7CB1, 0x7CB2, 0x7CB3, 0x7CB4, 0x7CB5, 0x7CB6,
+    0x7CB7, 0x7CB8, 0x7CB9, 0x7CBA, 0x7CBB, 0x7CBC, 0x7CBD, 0x7CBE, 0x7CBF, 0x7CC0, 0x7CC1, 0x7CC2, 0x7CC3, 0x7CC4, 0x7CC5, 0x7CC6,
+    0x7CC7, 0x7CC8, 0x7CC9, 0x7CCA, 0x7CCB, 0x7CCC, 0x7CCD, 0x7CCE, 0x7CCF, 0x7CD0, 0x7CD1, 0x7CD2, 0x7CD3, 0x7CD4, 0x7CD5, 0x7CD6,
+    0x7CD7, 0x7CD8, 0x7CD9, 0x7CDA, 0x7CDB, 0x7CDC, 0x7CDD, 0x7CDE, 0x7CDF, 0x7CE0, 0x7CE1, 0x7CE2, 0x7CE3, 0x7CE4, 0x7CE5, 0x7CE6,
+    0x7CE7, 0x7CE8, 0x7CE9, 0x7CEA, 0x7CEB, 0x7CEC, 0x7CED, 0x7CEE, 0x7CEF, 0x7CF0, 0x7CF1, 0x7CF2, 0x7CF3, 0x7CF4, 0x7CF5, 0x7CF6,
+    0x7CF7, 0x7CF8, 0x7CF9, 0x7CFA, 0x7CFB, 0x7CFC, 0x7CFD, 0x7CFE, 0x7D41, 0x7D42, 0x7D43, 0x7D44, 0x7D45, 0x7D46, 0x7D47, 0x7D48,
+    0x7D49, 0x7D4A, 0x7D4B, 0x7D4C, 0x7D4D, 0x7D4E, 0x7D4F, 0x7D50, 0x7D51, 0x7D52, 0x7D53, 0x7D54, 0x7D55, 0x7D56, 0x7D57, 0x7D58,
+    0x7D59, 0x7D5A, 0x7D5B, 0x7D5C, 0x7D5D, 0x7D5E, 0x7D5F, 0x7D60, 0x7D61, 0x7D62, 0x7D63, 0x7D64, 0x7D65, 0x7D66, 0x7D67, 0x7D68,
+  },
+  { /* U+EFxx */
+    0x7D69, 0x7D6A, 0x7D6B, 0x7D6C, 0x7D6D, 0x7D6E, 0x7D6F, 0x7D70, 0x7D71, 0x7D72, 0x7D73, 0x7D74, 0x7D75, 0x7D76, 0x7D77, 0x7D78,
+    0x7D79, 0x7D7A, 0x7D7B, 0x7D7C, 0x7D7D, 0x7D7E, 0x7D7F, 0x7D80, 0x7D81, 0x7D82, 0x7D83, 0x7D84, 0x7D85, 0x7D86, 0x7D87, 0x7D88,
+    0x7D89, 0x7D8A, 0x7D8B, 0x7D8C, 0x7D8D, 0x7D8E, 0x7D8F, 0x7D90, 0x7D91, 0x7D92, 0x7D93, 0x7D94, 0x7D95, 0x7D96, 0x7D97, 0x7D98,
+    0x7D99, 0x7D9A, 0x7D9B, 0x7D9C, 0x7D9D, 0x7D9E, 0x7D9F, 0x7DA0, 0x7DA1, 0x7DA2, 0x7DA3, 0x7DA4, 0x7DA5, 0x7DA6, 0x7DA7, 0x7DA8,
+    0x7DA9, 0x7DAA, 0x7DAB, 0x7DAC, 0x7DAD, 0x7DAE, 0x7DAF, 0x7DB0, 0x7DB1, 0x7DB2, 0x7DB3, 0x7DB4, 0x7DB5, 0x7DB6, 0x7DB7, 0x7DB8,
+    0x7DB9, 0x7DBA, 0x7DBB, 0x7DBC, 0x7DBD, 0x7DBE, 0x7DBF, 0x7DC0, 0x7DC1, 0x7DC2, 0x7DC3, 0x7DC4, 0x7DC5, 0x7DC6, 0x7DC7, 0x7DC8,
+    0x7DC9, 0x7DCA, 0x7DCB, 0x7DCC, 0x7DCD, 0x7DCE, 0x7DCF, 0x7DD0, 0x7DD1, 0x7DD2, 0x7DD3, 0x7DD4, 0x7DD5, 0x7DD6, 0x7DD7, 0x7DD8,
+    0x7DD9, 0x7DDA, 0x7DDB, 0x7DDC, 0x7DDD, 0x7DDE, 0x7DDF, 0x7DE0, 0x7DE1, 0x7DE2, 0x7DE3, 0x7DE4, 0x7DE5, 0x7DE6, 0x7DE7, 0x7DE8,
+    0x7DE9, 0x7DEA, 0x7DEB, 0x7DEC, 0x7DED, 0x7DEE, 0x7DEF, 0x7DF0, 0x7DF1, 0x7DF2, 0x7DF3, 0x7DF4, 0x7DF5, 0x7DF6, 0x7DF7, 0x7DF8,
+    0x7DF9, 0x7DFA, 0x7DFB, 0x7DFC, 0x7DFD, 0x7DFE, 0x7E41, 0x7E42, 0x7E43, 0x7E44, 0x7E45, 0x7E46, 0x7E47, 0x7E48, 0x7E49, 0x7E4A,
+    0x7E4B, 0x7E4C, 0x7E4D, 0x7E4E, 0x7E4F, 0x7E50, 0x7E51, 0x7E52, 0x7E53, 0x7E54, 0x7E55, 0x7E56, 0x7E57, 0x7E58, 0x7E59, 0x7E5A,
+    0x7E5B, 0x7E5C, 0x7E5D, 0x7E5E, 0x7E5F, 0x7E60, 0x7E61, 0x7E62, 0x7E63, 0x7E64, 0x7E65, 0x7E66, 0x7E67, 0x7E68, 0x7E69, 0x7E6A,
+    0x7E6B, 0x7E6C, 0x7E6D, 0x7E6E, 0x7E6F, 0x7E70, 0x7E71, 0x7E72, 0x7E73, 0x7E74, 0x7E75, 0x7E76, 0x7E77, 0x7E78, 0x7E79, 0x7E7A,
+    0x7E7B, 0x7E7C, 0x7E7D, 0x7E7E, 0x7E7F, 0x7E80, 0x7E81, 0x7E82, 0x7E83, 0x7E84, 0x7E85, 0x7E86, 0x7E87, 0x7E88, 0x7E89, 0x7E8A,
+    0x7E8B, 0x7E8C, 0x7E8D, 0x7E8E, 0x7E8F, 0x7E90, 0x7E91, 0x7E92, 0x7E93, 0x7E94, 0x7E95, 0x7E96, 0x7E97, 0x7E98, 0x7E99, 0x7E9A,
+    0x7E9B, 0x7E9C, 0x7E9D, 0x7E9E, 0x7E9F, 0x7EA0, 0x7EA1, 0x7EA2, 0x7EA3, 0x7EA4, 0x7EA5, 0x7EA6, 0x7EA7, 0x7EA8, 0x7EA9, 0x7EAA,
+  },
+  { /* U+F0xx */
+    0x7EAB, 0x7EAC, 0x7EAD, 0x7EAE, 0x7EAF, 0x7EB0, 0x7EB1, 0x7EB2, 0x7EB3, 0x7EB4, 0x7EB5, 0x7EB6, 0x7EB7, 0x7EB8, 0x7EB9, 0x7EBA,
+    0x7EBB, 0x7EBC, 0x7EBD, 0x7EBE, 0x7EBF, 0x7EC0, 0x7EC1, 0x7EC2, 0x7EC3, 0x7EC4, 0x7EC5, 0x7EC6, 0x7EC7, 0x7EC8, 0x7EC9, 0x7ECA,
+    0x7ECB, 0x7ECC, 0x7ECD, 0x7ECE, 0x7ECF, 0x7ED0, 0x7ED1, 0x7ED2, 0x7ED3, 0x7ED4, 0x7ED5, 0x7ED6, 0x7ED7, 0x7ED8, 0x7ED9, 0x7EDA,
+    0x7EDB, 0x7EDC, 0x7EDD, 0x7EDE, 0x7EDF, 0x7EE0, 0x7EE1, 0x7EE2, 0x7EE3, 0x7EE4, 0x7EE5, 0x7EE6, 0x7EE7, 0x7EE8, 0x7EE9, 0x7EEA,
+    0x7EEB, 0x7EEC, 0x7EED, 0x7EEE, 0x7EEF, 0x7EF0, 0x7EF1, 0x7EF2, 0x7EF3, 0x7EF4, 0x7EF5, 0x7EF6, 0x7EF7, 0x7EF8, 0x7EF9, 0x7EFA,
+    0x7EFB, 0x7EFC, 0x7EFD, 0x7EFE, 0x7F41, 0x7F42, 0x7F43, 0x7F44, 0x7F45, 0x7F46, 0x7F47, 0x7F48, 0x7F49, 0x7F4A, 0x7F4B, 0x7F4C,
+    0x7F4D, 0x7F4E, 0x7F4F, 0x7F50, 0x7F51, 0x7F52, 0x7F53, 0x7F54, 0x7F55, 0x7F56, 0x7F57, 0x7F58, 0x7F59, 0x7F5A, 0x7F5B, 0x7F5C,
+    0x7F5D, 0x7F5E, 0x7F5F, 0x7F60, 0x7F61, 0x7F62, 0x7F63, 0x7F64, 0x7F65, 0x7F66, 0x7F67, 0x7F68, 0x7F69, 0x7F6A, 0x7F6B, 0x7F6C,
+    0x7F6D, 0x7F6E, 0x7F6F, 0x7F70, 0x7F71, 0x7F72, 0x7F73, 0x7F74, 0x7F75, 0x7F76, 0x7F77, 0x7F78, 0x7F79, 0x7F7A, 0x7F7B, 0x7F7C,
+    0x7F7D, 0x7F7E, 0x7F7F, 0x7F80, 0x7F81, 0x7F82, 0x7F83, 0x7F84, 0x7F85, 0x7F86, 0x7F87, 0x7F88, 0x7F89, 0x7F8A, 0x7F8B, 0x7F8C,
+    0x7F8D, 0x7F8E, 0x7F8F, 0x7F90, 0x7F91, 0x7F92, 0x7F93, 0x7F94, 0x7F95, 0x7F96, 0x7F97, 0x7F98, 0x7F99, 0x7F9A, 0x7F9B, 0x7F9C,
+    0x7F9D, 0x7F9E, 0x7F9F, 0x7FA0, 0x7FA1, 0x7FA2, 0x7FA3, 0x7FA4, 0x7FA5, 0x7FA6, 0x7FA7, 0x7FA8, 0x7FA9, 0x7FAA, 0x7FAB, 0x7FAC,
+    0x7FAD, 0x7FAE, 0x7FAF, 0x7FB0, 0x7FB1, 0x7FB2, 0x7FB3, 0x7FB4, 0x7FB5, 0x7FB6, 0x7FB7, 0x7FB8, 0x7FB9, 0x7FBA, 0x7FBB, 0x7FBC,
+    0x7FBD, 0x7FBE, 0x7FBF, 0x7FC0, 0x7FC1, 0x7FC2, 0x7FC3, 0x7FC4, 0x7FC5, 0x7FC6, 0x7FC7, 0x7FC8, 0x7FC9, 0x7FCA, 0x7FCB, 0x7FCC,
+    0x7FCD, 0x7FCE, 0x7FCF, 0x7FD0, 0x7FD1, 0x7FD2, 0x7FD3, 0x7FD4, 0x7FD5, 0x7FD6, 0x7FD7, 0x7FD8, 0x7FD9, 0x7FDA, 0x7FDB, 0x7FDC,
+    0x7FDD, 0x7FDE, 0x7FDF, 0x7FE0, 0x7FE1, 0x7FE2, 0x7FE3, 0x7FE4, 0x7FE5, 0x7FE6, 0x7FE7, 0x7FE8, 0x7FE9, 0x7FEA, 0x7FEB, 0x7FEC,
+  },
+  { /* U+F1xx */
+    0x7FED, 0x7FEE, 0x7FEF, 0x7FF0, 0x7FF1, 0x7FF2, 0x7FF3, 0x7FF4, 0x7FF5, 0x7FF6, 0x7FF7, 0x7FF8, 0x7FF9, 0x7FFA, 0x7FFB, 0x7FFC,
+    0x7FFD, 0x7FFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+F9xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6674, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+FAxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x578E, 0x5877,
+    0x5882, 0x5980, 0x5BAE, 0x5C66, 0x5C78, 0x5E49, 0x5E8A, 0x5F7A, 0x5FD2, 0x5FD5, 0x5FD9, 0x5FDD, 0x6059, 0x60AD, 0x6177, 0x62B9,
+    0x62CE, 0x62E2, 0x63EE, 0x648E, 0x64F1, 0x6549, 0x6566, 0x65B8, 0x65C6, 0x6678, 0x66DD, 0x66DF, 0x66E6, 0x67F4, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+FFxx */
+    0xFFFF, 0x425A, 0x427F, 0x427B, 0x42E0, 0x426C, 0x4250, 0x427D, 0x424D, 0x425D, 0x425C, 0x424E, 0x426B, 0xFFFF, 0x424B, 0x4261,
+    0x42F0, 0x42F1, 0x42F2, 0x42F3, 0x42F4, 0x42F5, 0x42F6, 0x42F7, 0x42F8, 0x42F9, 0x427A, 0x425E, 0x424C, 0x427E, 0x426E, 0x426F,
+    0x427C, 0x42C1, 0x42C2, 0x42C3, 0x42C4, 0x42C5, 0x42C6, 0x42C7, 0x42C8, 0x42C9, 0x42D1, 0x42D2, 0x42D3, 0x42D4, 0x42D5, 0x42D6,
+    0x42D7, 0x42D8, 0x42D9, 0x42E2, 0x42E3, 0x42E4, 0x42E5, 0x42E6, 0x42E7, 0x42E8, 0x42E9, 0x4444, 0x43E0, 0x4445, 0x4470, 0x426D,
+    0x4279, 0x4281, 0x4282, 0x4283, 0x4284, 0x4285, 0x4286, 0x4287, 0x4288, 0x4289, 0x4291, 0x4292, 0x4293, 0x4294, 0x4295, 0x4296,
+    0x4297, 0x4298, 0x4299, 0x42A2, 0x42A3, 0x42A4, 0x42A5, 0x42A6, 0x42A7, 0x42A8, 0x42A9, 0x42C0, 0x424F, 0x42D0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056,
+    0x0058, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x008A, 0x008C, 0x008D, 0x008E, 0x008F, 0x0090,
+    0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096, 0x0097, 0x0098, 0x0099, 0x009A, 0x009D, 0x009E, 0x009F, 0x00A2, 0x00A3, 0x00A4,
+    0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AC, 0x00AD, 0x00AE, 0x00AF, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x434A, 0x424A, 0x425F, 0x42A1, 0xFFFF, 0x425B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+};
+
+CP_TABLE_CONST cp_table_t IBM930_TABLE = {
+    IBM930_SB2U, IBM930_LEAD2ROW, IBM930_DB2U, IBM930_U2CP_PAGE, IBM930_U2CP
+};
+
+/*----------------------------------------------------------------------
+ *  IBM939
+ *--------------------------------------------------------------------*/
+CP_TABLE_CONST uint16_t IBM939_SB2U[256] = {
+  0x0000, 0x0001, 0x0002, 0x0003, 0x009C, 0x0009, 0x0086, 0x007F, 0x0097, 0x008D, 0x008E, 0x000B, 0x000C, 0x000D, 0xFFFF, 0xFFFF,
+  0x0010, 0x0011, 0x0012, 0x0013, 0x009D, 0x0085, 0x0008, 0x0087, 0x0018, 0x0019, 0x0092, 0x008F, 0x001C, 0x001D, 0x001E, 0x001F,
+  0x0080, 0x0081, 0x0082, 0x0083, 0x0084, 0x000A, 0x0017, 0x001B, 0x0088, 0x0089, 0x008A, 0x008B, 0x008C, 0x0005, 0x0006, 0x0007,
+  0x0090, 0x0091, 0x0016, 0x0093, 0x0094, 0x0095, 0x0096, 0x0004, 0x0098, 0x0099, 0x009A, 0x009B, 0x0014, 0x0015, 0x009E, 0x001A,
+  0x0020, 0xFFFF, 0xFF61, 0xFF62, 0xFF63, 0xFF64, 0xFF65, 0xFF66, 0xFF67, 0xFF68, 0x00A2, 0x002E, 0x003C, 0x0028, 0x002B, 0x007C,
+  0x0026, 0xFF69, 0xFF6A, 0xFF6B, 0xFF6C, 0xFF6D, 0xFF6E, 0xFF6F, 0xFF70, 0xFF71, 0x0021, 0x0024, 0x002A, 0x0029, 0x003B, 0x00AC,
+  0x002D, 0x002F, 0xFF72, 0xFF73, 0xFF74, 0xFF75, 0xFF76, 0xFF77, 0xFF78, 0xFF79, 0xFFFF, 0x002C, 0x0025, 0x005F, 0x003E, 0x003F,
+  0xFF7A, 0xFF7B, 0xFF7C, 0xFF7D, 0xFF7E, 0xFF7F, 0xFF80, 0xFF81, 0xFF82, 0x0060, 0x003A, 0x0023, 0x0040, 0x0027, 0x003D, 0x0022,
+  0xFFFF, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0xFF83, 0xFF84, 0xFF85, 0xFF86, 0xFF87, 0xFF88,
+  0xFFFF, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F, 0x0070, 0x0071, 0x0072, 0xFF89, 0xFF8A, 0xFF8B, 0xFF8C, 0xFF8D, 0xFF8E,
+  0x203E, 0x007E, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0xFF8F, 0xFF90, 0xFF91, 0x005B, 0xFF92, 0xFF93,
+  0x005E, 0x00A3, 0x00A5, 0xFF94, 0xFF95, 0xFF96, 0xFF97, 0xFF98, 0xFF99, 0xFF9A, 0xFF9B, 0xFF9C, 0xFF9D, 0x005D, 0xFF9E, 0xFF9F,
+  0x007B, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x007D, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F, 0x0050, 0x0051, 0x0052, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x005C, 0xFFFF, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x009F,
+};
+
+CP_TABLE_CONST uint8_t IBM939_LEAD2ROW[256] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,  16,
+   17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,
+   33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,
+   49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+CP_TABLE_CONST uint16_t IBM939_DB2U[65][256] = {
+  { /* not a lead byte */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x40 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x3000, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x41 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x03B1, 0x03B2, 0x03B3, 0x03B4, 0x03B5, 0x03B6, 0x03B7, 0x03B8, 0x03B9, 0x03BA, 0x03BB, 0x03BC, 0x03BD, 0x03BE, 0x03BF,
+    0x03C0, 0x03C1, 0x03C3, 0x03C4, 0x03C5, 0x03C6, 0x03C7, 0x03C8, 0x03C9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0391, 0x0392, 0x0393, 0x0394, 0x0395, 0x0396, 0x0397, 0x0398, 0x0399, 0x039A, 0x039B, 0x039C, 0x039D, 0x039E, 0x039F,
+    0x03A0, 0x03A1, 0x03A3, 0x03A4, 0x03A5, 0x03A6, 0x03A7, 0x03A8, 0x03A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0430, 0x0431, 0x0432, 0x0433, 0x0434, 0x0435, 0x0451, 0x0436, 0x0437, 0x0438, 0x0439, 0x043A, 0x043B, 0x043C, 0x043D, 0x043E,
+    0x043F, 0x0440, 0x0441, 0x0442, 0x0443, 0x0444, 0x0445, 0x0446, 0x0447, 0x0448, 0x0449, 0x044A, 0x044B, 0x044C, 0x044D, 0x044E,
+    0x044F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x2170, 0x2171, 0x2172, 0x2173, 0x2174, 0x2175, 0x2176, 0x2177, 0x2178, 0x2179, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x0410, 0x0411, 0x0412, 0x0413, 0x0414, 0x0415, 0x0401, 0x0416, 0x0417, 0x0418, 0x0419, 0x041A, 0x041B, 0x041C, 0x041D, 0x041E,
+    0x041F, 0x0420, 0x0421, 0x0422, 0x0423, 0x0424, 0x0425, 0x0426, 0x0427, 0x0428, 0x0429, 0x042A, 0x042B, 0x042C, 0x042D, 0x042E,
+    0x042F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x2160, 0x2161, 0x2162, 0x2163, 0x2164, 0x2165, 0x2166, 0x2167, 0x2168, 0x2169, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x42 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFE1, 0xFF0E, 0xFF1C, 0xFF08, 0xFF0B, 0xFF5C,
+    0xFF06, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF01, 0xFFE5, 0xFF0A, 0xFF09, 0xFF1B, 0xFFE2,
+    0x2212, 0xFF0F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x00A6, 0xFF0C, 0xFF05, 0xFF3F, 0xFF1E, 0xFF1F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFF40, 0xFF1A, 0xFF03, 0xFF20, 0xFF07, 0xFF1D, 0xFF02,
+    0xFFFF, 0xFF41, 0xFF42, 0xFF43, 0xFF44, 0xFF45, 0xFF46, 0xFF47, 0xFF48, 0xFF49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFF4A, 0xFF4B, 0xFF4C, 0xFF4D, 0xFF4E, 0xFF4F, 0xFF50, 0xFF51, 0xFF52, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFE3, 0xFF53, 0xFF54, 0xFF55, 0xFF56, 0xFF57, 0xFF58, 0xFF59, 0xFF5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFF5B, 0xFF21, 0xFF22, 0xFF23, 0xFF24, 0xFF25, 0xFF26, 0xFF27, 0xFF28, 0xFF29, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFF5D, 0xFF2A, 0xFF2B, 0xFF2C, 0xFF2D, 0xFF2E, 0xFF2F, 0xFF30, 0xFF31, 0xFF32, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFF04, 0xFFFF, 0xFF33, 0xFF34, 0xFF35, 0xFF36, 0xFF37, 0xFF38, 0xFF39, 0xFF3A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFF10, 0xFF11, 0xFF12, 0xFF13, 0xFF14, 0xFF15, 0xFF16, 0xFF17, 0xFF18, 0xFF19, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x43 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x3002, 0x300C, 0x300D, 0x3001, 0x30FB, 0x30F2, 0x30A1, 0x30A3, 0x30A5, 0xFFE0, 0x2220, 0x22A5, 0x2312, 0x2202, 0x2207,
+    0xFFFF, 0x30A7, 0x30A9, 0x30E3, 0x30E5, 0x30E7, 0x30C3, 0x30EE, 0x30FC, 0x30F5, 0x30F6, 0x2261, 0x2252, 0x226A, 0x226B, 0x221A,
+    0x223D, 0x221D, 0x222B, 0x222C, 0x2208, 0x220B, 0x2286, 0x2287, 0x2282, 0x2283, 0x222A, 0x2229, 0x2227, 0x2228, 0x21D2, 0x21D4,
+    0x2200, 0x2203, 0x212B, 0x2030, 0x266F, 0x266D, 0x266A, 0x2020, 0x2021, 0x00B6, 0x25EF, 0xFFFF, 0x2500, 0x2502, 0x250C, 0x2510,
+    0xFFFF, 0x30A2, 0x30A4, 0x30A6, 0x30A8, 0x30AA, 0x30AB, 0x30AD, 0x30AF, 0x30B1, 0x30B3, 0xFFFF, 0x30B5, 0x30B7, 0x30B9, 0x30BB,
+    0x30BD, 0x30BF, 0x30C1, 0x30C4, 0x30C6, 0x30C8, 0x30CA, 0x30CB, 0x30CC, 0x30CD, 0x30CE, 0xFFFF, 0xFFFF, 0x30CF, 0x30D2, 0x30D5,
+    0xFFFF, 0x301C, 0x30D8, 0x30DB, 0x30DE, 0x30DF, 0x30E0, 0x30E1, 0x30E2, 0x30E4, 0x30E6, 0xFFFF, 0x30E8, 0x30E9, 0x30EA, 0x30EB,
+    0x2518, 0x2514, 0x251C, 0x252C, 0x2524, 0x2534, 0x253C, 0x2501, 0x2503, 0x250F, 0x30EC, 0x30ED, 0x30EF, 0x30F3, 0x309B, 0x309C,
+    0x30AC, 0x30AE, 0x30B0, 0x30B2, 0x30B4, 0x30B6, 0x30B8, 0x30BA, 0x30BC, 0x30BE, 0x30C0, 0x30C2, 0x30C5, 0x30C7, 0x30C9, 0x30D0,
+    0x30D3, 0x30D6, 0x30D9, 0x30DC, 0x30F4, 0x30D1, 0x30D4, 0x30D7, 0x30DA, 0x30DD, 0x30F0, 0x30F1, 0x30FD, 0x30FE, 0xFFFF, 0xFFFF,
+    0xFF3C, 0x2513, 0x251B, 0x2517, 0x2523, 0x2533, 0x252B, 0x253B, 0x254B, 0x2520, 0x252F, 0x2528, 0x2537, 0x253F, 0x251D, 0x2530,
+    0x2525, 0x2538, 0x2542, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x44 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x300E, 0x300F, 0xFF3B, 0xFF3D, 0x3092, 0x3041, 0x3043, 0x3045, 0x2014, 0x00B1, 0x2260, 0x221E, 0x2103, 0xFFFF,
+    0x00B4, 0x3047, 0x3049, 0x3083, 0x3085, 0x3087, 0x3063, 0x308E, 0xFFFF, 0xFFFF, 0x2010, 0x3003, 0x4EDD, 0x3005, 0x3006, 0x3007,
+    0x00A8, 0x2018, 0x201C, 0x3014, 0x3008, 0x300A, 0x3010, 0x2266, 0x2234, 0x2642, 0x00A7, 0x203B, 0x3012, 0x3231, 0x2116, 0x2121,
+    0xFF3E, 0x2019, 0x201D, 0x3015, 0x3009, 0x300B, 0x3011, 0x2267, 0x2235, 0x2640, 0x00D7, 0x00F7, 0x2016, 0x3013, 0x2025, 0x2026,
+    0xFFFF, 0x3042, 0x3044, 0x3046, 0x3048, 0x304A, 0x304B, 0x304D, 0x304F, 0x3051, 0x3053, 0xFFFF, 0x3055, 0x3057, 0x3059, 0x305B,
+    0x305D, 0x305F, 0x3061, 0x3064, 0x3066, 0x3068, 0x306A, 0x306B, 0x306C, 0x306D, 0x306E, 0xFFFF, 0xFFFF, 0x306F, 0x3072, 0x3075,
+    0xFFFF, 0xFFFF, 0x3078, 0x307B, 0x307E, 0x307F, 0x3080, 0x3081, 0x3082, 0x3084, 0x3086, 0xFFFF, 0x3088, 0x3089, 0x308A, 0x308B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x308C, 0x308D, 0x308F, 0x3093, 0xFFFF, 0xFFFF,
+    0x304C, 0x304E, 0x3050, 0x3052, 0x3054, 0x3056, 0x3058, 0x305A, 0x305C, 0x305E, 0x3060, 0x3062, 0x3065, 0x3067, 0x3069, 0x3070,
+    0x3073, 0x3076, 0x3079, 0x307C, 0xFFFF, 0x3071, 0x3074, 0x3077, 0x307A, 0x307D, 0x3090, 0x3091, 0x309D, 0x309E, 0xFFFF, 0xFFFF,
+    0x25CB, 0x25CF, 0x25B3, 0x25B2, 0x25CE, 0x2606, 0x2605, 0x25C7, 0x25C6, 0x25A1, 0x25A0, 0x25BD, 0x25BC, 0x00B0, 0x2032, 0x2033,
+    0x2192, 0x2190, 0x2191, 0x2193, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x45 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4E00, 0x4E8C, 0x4E09, 0x56DB, 0x4E94, 0x516D, 0x4E03, 0x516B, 0x4E5D, 0x5341, 0x767E, 0x5343, 0x4E07, 0x5104, 0x90FD,
+    0x9053, 0x5E9C, 0x770C, 0x5E02, 0x533A, 0x753A, 0x6751, 0x6771, 0x897F, 0x5357, 0x5317, 0x5927, 0x4E2D, 0x5C0F, 0x4E0A, 0x4E0B,
+    0x5E74, 0x6708, 0x65E5, 0x7530, 0x5B50, 0x5C71, 0x672C, 0x5DDD, 0x85E4, 0x91CE, 0x5DE5, 0x696D, 0x6728, 0x4E95, 0x90CE, 0x5CF6,
+    0x96C4, 0x9AD8, 0x5CA1, 0x592B, 0x539F, 0x4EAC, 0x4F50, 0x6B63, 0x677E, 0x6A5F, 0x548C, 0x88FD, 0x7537, 0x7F8E, 0x5409, 0x5D0E,
+    0x77F3, 0x8C37, 0x96FB, 0x9577, 0x6CBB, 0x6CA2, 0x91D1, 0x65B0, 0x53E3, 0x6A4B, 0x4E45, 0x798F, 0x6240, 0x5E73, 0x5185, 0x56FD,
+    0x5316, 0x962A, 0x5BAE, 0x4EBA, 0x4F5C, 0x90E8, 0x6E05, 0x6B21, 0x7FA9, 0x751F, 0x4EE3, 0x51FA, 0x6C34, 0x68EE, 0x5149, 0x52A0,
+    0x5408, 0x795E, 0x6797, 0x91CD, 0x884C, 0x4FE1, 0x660E, 0x6D77, 0x5B89, 0x5E78, 0x4FDD, 0x592A, 0x5BCC, 0x6C5F, 0x9234, 0x524D,
+    0x77E5, 0x6B66, 0x4F0A, 0x662D, 0x5206, 0x52DD, 0x7528, 0x5E83, 0x9020, 0x6C17, 0x6210, 0x898B, 0x5229, 0x4F1A, 0x5B66, 0x5CA9,
+    0x7523, 0x9593, 0x5730, 0x81EA, 0x826F, 0x95A2, 0x611B, 0x653F, 0x5C3E, 0x8A08, 0x6587, 0x624B, 0x7236, 0x65B9, 0x4E8B, 0x6238,
+    0x54C1, 0x559C, 0x6E21, 0x5F18, 0x53E4, 0x8FBA, 0x5009, 0x9244, 0x4E4B, 0x5834, 0x6D0B, 0x57CE, 0x6D25, 0x7ACB, 0x5EA6, 0x5348,
+    0x4ECA, 0x5F66, 0x8A2D, 0x901A, 0x52D5, 0x5F8C, 0x5948, 0x5B9A, 0x6C60, 0x5C4B, 0x6D5C, 0x7406, 0x5742, 0x5B9F, 0x82F1, 0x7684,
+    0x53F8, 0x79C0, 0x6A2A, 0x540D, 0x5B5D, 0x7AF9, 0x535A, 0x529B, 0x5EAB, 0x8449, 0x6804, 0x6C38, 0x5668, 0x7389, 0x591A, 0xFFFF,
+  },
+  { /* lead 0x46 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8CC0, 0x771F, 0x6075, 0x9759, 0x5186, 0x8302, 0x654F, 0x8C4A, 0x5175, 0x6CD5, 0x767A, 0x9752, 0x5897, 0x6599, 0x5FE0,
+    0x8CC7, 0x6642, 0x7269, 0x8ECA, 0x5FB3, 0x8981, 0x5BFE, 0x585A, 0x79CB, 0x767D, 0x6CB3, 0x702C, 0x6CB9, 0x9686, 0x8535, 0x5F53,
+    0x4FCA, 0x5FD7, 0x6625, 0x793E, 0x99AC, 0x5165, 0x5EFA, 0x6839, 0x6749, 0x9032, 0x8208, 0x6D66, 0x7CBE, 0x540C, 0x6027, 0x7C73,
+    0x8005, 0x52A9, 0x679D, 0x8FD1, 0x76F4, 0x76EE, 0x6765, 0x753B, 0x76F8, 0x9ED2, 0x4E38, 0x8239, 0x7531, 0x58EB, 0x7B2C, 0x718A,
+    0x7D19, 0x5065, 0x68B0, 0x82B3, 0x571F, 0x6709, 0x5BB6, 0x7DDA, 0x7D4C, 0x8ABF, 0x5929, 0x671F, 0x7F6E, 0x6D45, 0x6589, 0x5F0F,
+    0x5F62, 0x9762, 0x7A2E, 0x8F38, 0x5916, 0x5143, 0x4F53, 0x9E7F, 0x5FA1, 0x5973, 0x5EB7, 0x4E16, 0x52C7, 0x5800, 0x597D, 0x5150,
+    0x5BFA, 0x92FC, 0x7279, 0x57FC, 0x9054, 0x5411, 0x53D6, 0x7B49, 0x667A, 0x56DE, 0x9580, 0x904B, 0x5099, 0x601D, 0x963F, 0x4E0D,
+    0x9808, 0x5168, 0x5BFF, 0x5584, 0x677F, 0x98EF, 0x8C9E, 0x73FE, 0x98DF, 0x7D44, 0x985E, 0x516C, 0x6750, 0x9999, 0x5546, 0x7D50,
+    0x8868, 0x77E2, 0x6F5F, 0x79C1, 0x5236, 0x90A6, 0x6CBC, 0x7CF8, 0x5B8F, 0x7B56, 0x6CE2, 0x54E1, 0x6570, 0x958B, 0x6E96, 0x6A39,
+    0x8CBB, 0x660C, 0x5F37, 0x7814, 0x53CB, 0x5B87, 0x82E5, 0x83CA, 0x6301, 0x82B1, 0x5F15, 0x7D00, 0x8352, 0x5225, 0x4FEE, 0x8D8A,
+    0x4F4F, 0x85AC, 0x6BDB, 0x9060, 0x554F, 0x5965, 0x578B, 0x5FC3, 0x767B, 0x65E9, 0x67F3, 0x6D69, 0x8CEA, 0x52D9, 0x6CC9, 0x5E38,
+    0x5B88, 0x57FA, 0x7BA1, 0x6CF0, 0x4F38, 0x6700, 0x4EE5, 0x6B4C, 0x88D5, 0x8D64, 0x8DB3, 0x898F, 0x6D41, 0x8AA0, 0x6607, 0xFFFF,
+  },
+  { /* lead 0x47 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DDE, 0x7167, 0x5869, 0x9001, 0x96C5, 0x672B, 0x54F2, 0x5CB8, 0x4E5F, 0x5C90, 0x521D, 0x8328, 0x5247, 0x6BD4, 0x80FD,
+    0x8A71, 0x6295, 0x8EE2, 0x83C5, 0x9023, 0x4ED6, 0x6C11, 0x7D66, 0x9152, 0x7E41, 0x4FA1, 0x6E80, 0x671D, 0x4ED8, 0x6761, 0x7121,
+    0x8003, 0x697D, 0x4E3B, 0x610F, 0x6226, 0x5207, 0x5264, 0x7247, 0x7D30, 0x6E08, 0x7A32, 0x5E03, 0x91CC, 0x5C5E, 0x7AE0, 0x5909,
+    0x4F55, 0x685C, 0x5F7C, 0x67FB, 0x76CA, 0x58F2, 0x4EC1, 0x6DF1, 0x53F0, 0x9CE5, 0x9DB4, 0x652F, 0x6574, 0x89D2, 0x5609, 0x5473,
+    0x885B, 0x8B70, 0x5727, 0x7387, 0x8DEF, 0x706B, 0x961C, 0x8F1D, 0x70B9, 0x4E0E, 0x6E1B, 0x7551, 0x9280, 0x7A7A, 0x4EA4, 0x7FBD,
+    0x534A, 0x53CE, 0x592E, 0x7DCF, 0x8A18, 0x6674, 0x69CB, 0x969B, 0x6885, 0x5370, 0x8A00, 0x6817, 0x8EAB, 0x66F8, 0x514B, 0x7D20,
+    0x96C6, 0x7BC0, 0x5148, 0x6EDD, 0x6C7A, 0x6559, 0x7D14, 0x67F4, 0x63A5, 0x661F, 0x7740, 0x7559, 0x6620, 0x5DF1, 0x754C, 0x5177,
+    0x656C, 0x7FA4, 0x9806, 0x5171, 0x6D3B, 0x91CF, 0x6307, 0x89E3, 0x5BA4, 0x679C, 0x5404, 0x671B, 0x9632, 0x7D04, 0x61B2, 0x967D,
+    0x4E80, 0x56F3, 0x4E88, 0x8272, 0x7A0E, 0x690D, 0x53EF, 0x6052, 0x4F4D, 0x5178, 0x5FC5, 0x7D9A, 0x6025, 0x5728, 0x57A3, 0x541B,
+    0x5EF6, 0x5D8B, 0x4F01, 0x6803, 0x670D, 0x71B1, 0x5272, 0x5354, 0x6B69, 0x53F2, 0x512A, 0x658E, 0x623F, 0x5B97, 0x683C, 0x8FB0,
+    0x7B20, 0x5712, 0x8AF8, 0x8107, 0x5553, 0x8CE2, 0x5F25, 0x98A8, 0x5F97, 0x6613, 0x6253, 0x982D, 0x65ED, 0x6BB5, 0x52E2, 0x7136,
+    0x56E3, 0x984D, 0x843D, 0x914D, 0x7A0B, 0x8FBB, 0x543E, 0x611F, 0x5BDB, 0x53CD, 0x7A14, 0x9700, 0x6E90, 0x6C96, 0x984C, 0xFFFF,
+  },
+  { /* lead 0x48 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8FBC, 0x8349, 0x7B97, 0x76DB, 0x8FB2, 0x90A3, 0x7701, 0x69D8, 0x6BBF, 0x5C11, 0x4ECB, 0x53D7, 0x97F3, 0x7DE8, 0x59D4,
+    0x5E84, 0x4FC2, 0x72B6, 0x793A, 0x5E97, 0x5A9B, 0x682A, 0x6ECB, 0x68A8, 0x7E04, 0x53F3, 0x5DE6, 0x53CA, 0x9078, 0x5C45, 0x60C5,
+    0x7DF4, 0x70AD, 0x9928, 0x9271, 0x6A21, 0x6B8A, 0x7E3E, 0x4E9C, 0x7E4A, 0x4EF2, 0x5857, 0x6D88, 0x8853, 0x691C, 0x6717, 0x5B85,
+    0x529F, 0x5C1A, 0x8CBF, 0x60A6, 0x8102, 0x7BE0, 0x4F73, 0x7D21, 0x51A8, 0x6851, 0x78BA, 0x7267, 0x4E26, 0x5024, 0x89B3, 0x8CB4,
+    0x7DAD, 0x7D71, 0x5BBF, 0x4E21, 0x7CD6, 0x89AA, 0x9332, 0x6F84, 0x65BD, 0x5BB9, 0x98DB, 0x5C40, 0x7950, 0x904E, 0x6C0F, 0x6539,
+    0x76E4, 0x7A4D, 0x6E0B, 0x5DFB, 0x6DF3, 0x5FDC, 0x4E89, 0x8ECD, 0x88C5, 0x9178, 0x7E54, 0x67D3, 0x5E1D, 0x7DBF, 0x7C89, 0x822A,
+    0x7532, 0x5468, 0x4ED9, 0x5F85, 0x4F4E, 0x7DD1, 0x8EFD, 0x9EBB, 0x6176, 0x52B4, 0x78EF, 0x4E39, 0x80B2, 0x9650, 0x5C0E, 0x653E,
+    0x6643, 0x5EA7, 0x4EF6, 0x60F3, 0x9A13, 0x4ED5, 0x4F7F, 0x8F2A, 0x9854, 0x756A, 0x5F35, 0x805E, 0x4F9B, 0x6E6F, 0x6EB6, 0x6821,
+    0x9285, 0x92F3, 0x878D, 0x9756, 0x5199, 0x5B8C, 0x6E2F, 0x935B, 0x591C, 0x5145, 0x9F8D, 0x7DB1, 0x83F1, 0x901F, 0x52C9, 0x5237,
+    0x8D77, 0x6469, 0x53C2, 0x55B6, 0x7A42, 0x63A8, 0x8FD4, 0x8077, 0x6B62, 0x4F1D, 0x5E79, 0x7403, 0x6A29, 0x5C55, 0x5E61, 0x845B,
+    0x5EAD, 0x975E, 0x53F7, 0x5358, 0x6B73, 0x62E1, 0x51E6, 0x8A9E, 0x6628, 0x57DF, 0x6DF5, 0x518D, 0x50CD, 0x79D1, 0x9B5A, 0x7AEF,
+    0x9014, 0x6848, 0x5B57, 0x8AD6, 0x517C, 0x53C8, 0x632F, 0x6280, 0x5FB9, 0x672D, 0x7CFB, 0x5F93, 0x51B7, 0x614B, 0x5CF0, 0xFFFF,
+  },
+  { /* lead 0x49 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5931, 0x539A, 0x5074, 0x6CE8, 0x6E2C, 0x9803, 0x4E57, 0x8A66, 0x576A, 0x8429, 0x515A, 0x6C7D, 0x5B9D, 0x606D, 0x6A0B,
+    0x6E29, 0x6577, 0x8AAC, 0x82B8, 0x544A, 0x6B74, 0x822C, 0x98FE, 0x793C, 0x5C06, 0x96E3, 0x7802, 0x5224, 0x5F79, 0x5F71, 0x66FD,
+    0x5E2F, 0x9678, 0x938C, 0x8AC7, 0x5F70, 0x60AA, 0x6A19, 0x7533, 0x5BB3, 0x6BCD, 0x88DC, 0x5E4C, 0x58F0, 0x9664, 0x7B39, 0x5A66,
+    0x4E7E, 0x7AF6, 0x829D, 0x725B, 0x8CB7, 0x79FB, 0x785D, 0x8336, 0x52B9, 0x990A, 0x52F2, 0x80A5, 0x8B19, 0x7089, 0x590F, 0x5802,
+    0x67CF, 0x6255, 0x5E30, 0x713C, 0x786B, 0x8001, 0x7A76, 0x5BE9, 0x91DD, 0x65AD, 0x5C04, 0x5DEE, 0x5D50, 0x6298, 0x8010, 0x5BA3,
+    0x59CB, 0x5F8B, 0x6B8B, 0x666F, 0x8C61, 0x90F7, 0x5353, 0x96E2, 0x85AB, 0x6B7B, 0x8015, 0x64CD, 0x4EAE, 0x4E91, 0x90E1, 0x52E4,
+    0x6C42, 0x8CAB, 0x5B98, 0x59BB, 0x88CF, 0x773C, 0x4F2F, 0x7AAF, 0x7BC9, 0x968E, 0x63DB, 0x6842, 0x99C5, 0x68B6, 0x5747, 0x8CA1,
+    0x547D, 0x738B, 0x84B2, 0x90C1, 0x78E8, 0x7B11, 0x66F2, 0x6975, 0x5831, 0x63D0, 0x8A3C, 0x96EA, 0x9055, 0x88C1, 0x9996, 0x75C5,
+    0x6850, 0x4F59, 0x74E6, 0x4EE4, 0x5439, 0x732A, 0x672A, 0x525B, 0x8CA0, 0x4F34, 0x5100, 0x542B, 0x9069, 0x8FC4, 0x5C3B, 0x5DCC,
+    0x7B54, 0x8FFD, 0x8A0E, 0x4E08, 0x925B, 0x71C3, 0x8AB2, 0x70BA, 0x9662, 0x679A, 0x76AE, 0x8B77, 0x7DBE, 0x96E8, 0x6211, 0x5BC4,
+    0x837B, 0x62BC, 0x7D0D, 0x76E3, 0x7E2B, 0x964D, 0x572D, 0x7ADC, 0x7BC4, 0x6BBA, 0x8C9D, 0x698E, 0x9047, 0x6F14, 0x5360, 0x8FEB,
+    0x5287, 0x624D, 0x6566, 0x7D1A, 0x7D42, 0x6BCE, 0x7D79, 0x7E2E, 0x666E, 0x7965, 0x500B, 0x5C02, 0x99D2, 0x8A55, 0x7560, 0xFFFF,
+  },
+  { /* lead 0x4A */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5B58, 0x8089, 0x50BE, 0x5E2B, 0x6DB2, 0x4F8B, 0x81E3, 0x81F3, 0x56E0, 0x7D99, 0x5DF2, 0x899A, 0x6E9D, 0x6D17, 0x8AAD,
+    0x8996, 0x731B, 0x5DE8, 0x7DB2, 0x888B, 0x4EFB, 0x5BC6, 0x8896, 0x6CC1, 0x8457, 0x8F03, 0x6BC5, 0x97FF, 0x8CA9, 0x5E45, 0x82E6,
+    0x63AA, 0x5F81, 0x78C1, 0x821E, 0x52AA, 0x7AAA, 0x5999, 0x6297, 0x8F14, 0x7FD2, 0x4FC3, 0x54C9, 0x967A, 0x66F4, 0x8B1B, 0x5E72,
+    0x5FA9, 0x8A2A, 0x6D3E, 0x7763, 0x6483, 0x8B58, 0x614E, 0x5A5A, 0x8D85, 0x71D0, 0x983C, 0x72E9, 0x583A, 0x5DFE, 0x8A8D, 0x67C4,
+    0x7DE0, 0x4F11, 0x77ED, 0x4F0F, 0x5BC5, 0x629C, 0x5C3C, 0x533B, 0x6DC0, 0x81FC, 0x96D1, 0x904A, 0x6D6E, 0x93E1, 0x5C64, 0x98FC,
+    0x524A, 0x6DFB, 0x8584, 0x968A, 0x56FA, 0x5883, 0x7766, 0x9805, 0x4E73, 0x8C46, 0x8A31, 0x7DD2, 0x8FF0, 0x6D6A, 0x4F9D, 0x6B6F,
+    0x6B27, 0x62C5, 0x511F, 0x9769, 0x5374, 0x9AA8, 0x6775, 0x887F, 0x5305, 0x7570, 0x8D70, 0x864E, 0x5CEF, 0x8CDE, 0x5FF5, 0x725F,
+    0x7686, 0x609F, 0x80CC, 0x59EB, 0x8131, 0x5E0C, 0x8A17, 0x9676, 0x82D7, 0x74B0, 0x84B8, 0x50D5, 0x96F2, 0x7248, 0x7834, 0x6DD1,
+    0x6E09, 0x67FF, 0x6F54, 0x5915, 0x500D, 0x72AC, 0x9EC4, 0x7B46, 0x9B3C, 0x6563, 0x53BB, 0x8A98, 0x91DC, 0x9818, 0x6FC3, 0x65C5,
+    0x501F, 0x7F8A, 0x6F64, 0x9031, 0x5F3E, 0x63F4, 0x9038, 0x8B66, 0x7BE4, 0x7206, 0x6843, 0x72EC, 0x65CF, 0x82A6, 0x5BA2, 0x6960,
+    0x9EA6, 0x52DF, 0x6790, 0x639B, 0x7D75, 0x9855, 0x5DF3, 0x5805, 0x8ACB, 0x95A3, 0x8863, 0x8CA8, 0x5B63, 0x5E8A, 0x5449, 0x786C,
+    0x7D2B, 0x8CA2, 0x5352, 0x7D76, 0x8CB8, 0x7070, 0x547C, 0x6545, 0x6676, 0x73B2, 0x56F2, 0x7BB1, 0x58A8, 0x7A81, 0x66AE, 0xFFFF,
+  },
+  { /* lead 0x4B */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8087, 0x59FF, 0x8840, 0x56F0, 0x7B51, 0x6DF7, 0x5F01, 0x934B, 0x9000, 0x4FE3, 0x675F, 0x4FBF, 0x8CC3, 0x526F, 0x63A1,
+    0x5442, 0x8907, 0x698A, 0x5E2D, 0x5A18, 0x7518, 0x514D, 0x5E7E, 0x50B5, 0x5BDD, 0x68D2, 0x745E, 0x69FB, 0x5FAE, 0x55E3, 0x8A70,
+    0x5BF8, 0x5824, 0x8358, 0x5F13, 0x5E95, 0x706F, 0x751A, 0x7D05, 0x60E3, 0x7E70, 0x5012, 0x5238, 0x83EF, 0x5373, 0x5F31, 0x6A2B,
+    0x9CF4, 0x53CC, 0x6D32, 0x4EAB, 0x4E92, 0x842C, 0x8A8C, 0x65E2, 0x6F01, 0x80A9, 0x9DF9, 0x8B72, 0x7B52, 0x9589, 0x6D74, 0x63A2,
+    0x6590, 0x5BD2, 0x6319, 0x8AB0, 0x76DF, 0x99A8, 0x7A74, 0x8236, 0x8846, 0x8061, 0x6557, 0x5922, 0x9644, 0x88AB, 0x9326, 0x7B4B,
+    0x62B5, 0x5371, 0x5E81, 0x5BDF, 0x4F75, 0x58C1, 0x7058, 0x7DCA, 0x5438, 0x73E0, 0x52D8, 0x5208, 0x78D0, 0x6B23, 0x6838, 0x4E43,
+    0x690E, 0x8377, 0x6ED1, 0x98F2, 0x8170, 0x8857, 0x8EF8, 0x798E, 0x83DC, 0x8FCE, 0x7E01, 0x5510, 0x4EA8, 0x8A33, 0x9162, 0x5EFB,
+    0x606F, 0x4E86, 0x664B, 0x6368, 0x5217, 0x8056, 0x51FD, 0x7642, 0x821F, 0x9685, 0x50CF, 0x662F, 0x4F3C, 0x4E59, 0x6A3D, 0x4E71,
+    0x523A, 0x8ACF, 0x6A58, 0x66FF, 0x670B, 0x653B, 0x9732, 0x5EC3, 0x8A13, 0x5782, 0x604B, 0x866B, 0x95D8, 0x60A9, 0x4E01, 0x63CF,
+    0x6FC0, 0x659C, 0x8CAC, 0x8305, 0x7CA7, 0x6050, 0x96F7, 0x5FCD, 0x640D, 0x5B54, 0x900F, 0x62D3, 0x59B9, 0x7159, 0x51AC, 0x79F0,
+    0x552F, 0x5275, 0x6697, 0x80F8, 0x4E98, 0x4ECF, 0x51CD, 0x9D5C, 0x5144, 0x7A93, 0x67F1, 0x5841, 0x7C21, 0x8861, 0x5C31, 0x68DA,
+    0x91E7, 0x9DF2, 0x63EE, 0x6575, 0x84EE, 0x523B, 0x6B32, 0x7C98, 0x5982, 0x969C, 0x8987, 0x7C9F, 0x9006, 0x62DB, 0x66DC, 0xFFFF,
+  },
+  { /* lead 0x4C */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6355, 0x6982, 0x50AC, 0x623B, 0x5FD8, 0x63DA, 0x75DB, 0x627F, 0x616E, 0x8266, 0x7C95, 0x716E, 0x96C7, 0x7F6A, 0x5426,
+    0x5200, 0x83D3, 0x5211, 0x594F, 0x9D28, 0x574A, 0x66C7, 0x9858, 0x820E, 0x6614, 0x733F, 0x50B7, 0x6551, 0x5EB8, 0x5B6B, 0x55AC,
+    0x5FEB, 0x6388, 0x8CAF, 0x676F, 0x5951, 0x5A01, 0x71E5, 0x5DE3, 0x8C6A, 0x6271, 0x81F4, 0x5C3A, 0x5F92, 0x9045, 0x7384, 0x7149,
+    0x79D8, 0x796D, 0x9003, 0x83CC, 0x5FB4, 0x5B8D, 0x6279, 0x64AE, 0x7D18, 0x723E, 0x5BEE, 0x65E7, 0x8D08, 0x9E78, 0x52E7, 0x5D07,
+    0x9F62, 0x6069, 0x536F, 0x6681, 0x9663, 0x5E3D, 0x62B1, 0x722A, 0x6E4A, 0x93AE, 0x79E6, 0x53E5, 0x809D, 0x88FE, 0x53B3, 0x6C88,
+    0x6E7F, 0x5141, 0x9091, 0x6F6E, 0x84C4, 0x85EA, 0x8129, 0x6BD2, 0x663C, 0x7F72, 0x73C2, 0x5F1F, 0x790E, 0x60B2, 0x72ED, 0x58EE,
+    0x8179, 0x8E8D, 0x5C65, 0x5DE7, 0x6C37, 0x6DE1, 0x862D, 0x72AF, 0x8E0A, 0x7C92, 0x8218, 0x8033, 0x63A7, 0x9291, 0x5019, 0x8155,
+    0x8A69, 0x8EDF, 0x66B4, 0x8133, 0x7591, 0x6B20, 0x6669, 0x90F5, 0x4E32, 0x73EA, 0x693F, 0x7687, 0x707D, 0x7D3A, 0x6148, 0x8607,
+    0x99FF, 0x59C9, 0x7832, 0x7815, 0x907F, 0x80A1, 0x5C3F, 0x66A2, 0x9418, 0x6D44, 0x5E55, 0x5854, 0x7B95, 0x8DE1, 0x4EA1, 0x8C5A,
+    0x81E8, 0x89E6, 0x9670, 0x5263, 0x74F6, 0x9A5A, 0x6012, 0x520A, 0x7434, 0x9801, 0x907A, 0x5504, 0x7956, 0x5230, 0x54B2, 0x8A34,
+    0x96A3, 0x4FF3, 0x9283, 0x91E3, 0x7D39, 0x9688, 0x4F51, 0x7D61, 0x5DBA, 0x9BAE, 0x5F80, 0x795D, 0x8597, 0x8DA3, 0x7C60, 0x5C0A,
+    0x7565, 0x85A9, 0x63D6, 0x9E97, 0x7D22, 0x5375, 0x9AEA, 0x9042, 0x6B3D, 0x7D0B, 0x6392, 0x80AA, 0x7DE9, 0x9F3B, 0x99C6, 0xFFFF,
+  },
+  { /* lead 0x4D */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6D78, 0x6731, 0x5531, 0x6398, 0x7825, 0x5CB3, 0x5DE1, 0x92AD, 0x98FD, 0x9810, 0x6CE3, 0x6B64, 0x5321, 0x6B53, 0x5E8F,
+    0x7AE5, 0x502B, 0x6E56, 0x62BD, 0x8276, 0x6A9C, 0x4E18, 0x57F7, 0x752B, 0x7C97, 0x82EB, 0x9802, 0x811A, 0x73CD, 0x8F9B, 0x5C0B,
+    0x63E1, 0x7372, 0x8150, 0x80E1, 0x5B99, 0x76D7, 0x6291, 0x65EC, 0x8A3A, 0x5947, 0x65E8, 0x6E7E, 0x6696, 0x55AB, 0x8F09, 0x92ED,
+    0x9396, 0x4EEE, 0x755C, 0x6F38, 0x8F9E, 0x7981, 0x5C01, 0x62E0, 0x9BE8, 0x91C8, 0x6276, 0x65CB, 0x8E0F, 0x8B21, 0x699B, 0x6216,
+    0x5A92, 0x90B8, 0x50DA, 0x79DF, 0x6C41, 0x5270, 0x9175, 0x8B39, 0x685D, 0x5875, 0x819C, 0x5B9C, 0x8A89, 0x8A72, 0x9D8F, 0x6377,
+    0x5974, 0x8AA4, 0x52B1, 0x6962, 0x5C48, 0x9CE9, 0x673A, 0x75B2, 0x6D1E, 0x4F0D, 0x7E6D, 0x7B48, 0x7FCC, 0x65E6, 0x59A5, 0x79E9,
+    0x6212, 0x6EDE, 0x770B, 0x8CA7, 0x65BC, 0x885D, 0x6ADB, 0x5C4A, 0x8074, 0x9084, 0x8ECC, 0x65D7, 0x57F9, 0x708E, 0x6F06, 0x5E7C,
+    0x77AC, 0x4FF5, 0x5949, 0x81ED, 0x9B45, 0x7FFC, 0x8178, 0x69FD, 0x6CCA, 0x69C7, 0x79D2, 0x8B1D, 0x9ED9, 0x81D3, 0x7A3C, 0x7968,
+    0x6F5C, 0x63B2, 0x8DDD, 0x6383, 0x6E9C, 0x5E33, 0x61F8, 0x76BF, 0x642C, 0x7DB4, 0x6247, 0x6458, 0x6816, 0x5F69, 0x9022, 0x7A1A,
+    0x82B9, 0x70C8, 0x9A12, 0x6163, 0x6FEF, 0x53EB, 0x9D3B, 0x62FE, 0x60A0, 0x9591, 0x6D99, 0x6162, 0x9298, 0x635C, 0x9707, 0x8972,
+    0x683D, 0x51E1, 0x9B54, 0x608C, 0x5B22, 0x99C4, 0x7126, 0x8A73, 0x971C, 0x7396, 0x67D4, 0x60A3, 0x4E11, 0x4EF0, 0x8CDB, 0x8CB0,
+    0x7912, 0x9774, 0x8986, 0x5146, 0x57DC, 0x99D0, 0x80C3, 0x8338, 0x78A7, 0x86CD, 0x7F85, 0x5049, 0x8247, 0x690B, 0x7C4D, 0xFFFF,
+  },
+  { /* lead 0x4E */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x53EA, 0x5F26, 0x6E25, 0x6881, 0x9375, 0x5DFD, 0x5347, 0x9727, 0x643A, 0x75C7, 0x6FA4, 0x73A9, 0x77E9, 0x9451, 0x8B5C,
+    0x808C, 0x674E, 0x4EAD, 0x582F, 0x7573, 0x8ED2, 0x6CE5, 0x9320, 0x8FF7, 0x7D33, 0x72C2, 0x8217, 0x7422, 0x82C5, 0x9A30, 0x773A,
+    0x5F84, 0x9673, 0x64AD, 0x920D, 0x74DC, 0x60C7, 0x86ED, 0x4FFA, 0x52A3, 0x6A3A, 0x7720, 0x5320, 0x61B6, 0x5674, 0x8776, 0x6CBF,
+    0x505C, 0x602A, 0x8466, 0x6B96, 0x6DBC, 0x97D3, 0x968F, 0x6876, 0x60D1, 0x5378, 0x64A4, 0x51A0, 0x9154, 0x5DF4, 0x629E, 0x5E63,
+    0x929A, 0x7693, 0x6C5A, 0x6597, 0x50E7, 0x7C82, 0x5F6B, 0x6CE1, 0x5F6C, 0x5AC1, 0x6F2C, 0x852D, 0x6442, 0x5750, 0x58C7, 0x8CFC,
+    0x8A5E, 0x7A7F, 0x689D, 0x7E26, 0x7A40, 0x7344, 0x8AEB, 0x4FD7, 0x7A63, 0x8036, 0x7DEF, 0x80C6, 0x8AED, 0x731F, 0x8FEA, 0x4F0E,
+    0x758B, 0x518A, 0x6734, 0x5FD9, 0x61C7, 0x65AF, 0x9CF3, 0x5ECA, 0x9262, 0x68DF, 0x6CB8, 0x80F4, 0x57CB, 0x6C99, 0x96A0, 0x5B64,
+    0x58F1, 0x68C4, 0x5410, 0x982C, 0x8A87, 0x4E5E, 0x6167, 0x9BAB, 0x90AA, 0x55B0, 0x82BD, 0x596A, 0x66F3, 0x8299, 0x5893, 0x719F,
+    0x6284, 0x67D1, 0x9063, 0x5ACC, 0x6C57, 0x7CE7, 0x5851, 0x64B2, 0x58CA, 0x830E, 0x5968, 0x5302, 0x5A46, 0x8702, 0x6065, 0x72D9,
+    0x89A7, 0x6689, 0x66F9, 0x5D6F, 0x5BB0, 0x96BC, 0x636E, 0x60DC, 0x7948, 0x51DD, 0x8606, 0x5EC9, 0x7554, 0x596E, 0x6B04, 0x4F43,
+    0x7B94, 0x67DA, 0x62DD, 0x628A, 0x971E, 0x62ED, 0x6EC5, 0x508D, 0x67B6, 0x80E4, 0x9EBF, 0x5EB5, 0x638C, 0x85CD, 0x9867, 0x52C5,
+    0x6016, 0x68CB, 0x61D0, 0x5751, 0x8F29, 0x5FAA, 0x81A8, 0x7D62, 0x71C8, 0x54C0, 0x69CC, 0x6B3E, 0x65AC, 0x63C3, 0x4F46, 0xFFFF,
+  },
+  { /* lead 0x4F */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x7B1B, 0x6B86, 0x88F8, 0x5203, 0x732E, 0x6687, 0x7D17, 0x57F4, 0x570F, 0x618E, 0x970A, 0x7C3F, 0x8B00, 0x7881, 0x8CE0,
+    0x548B, 0x7B87, 0x745B, 0x7C11, 0x8870, 0x5398, 0x5448, 0x6CF3, 0x6F22, 0x53F6, 0x88B4, 0x5301, 0x7A6B, 0x8695, 0x586B, 0x5D29,
+    0x88C2, 0x62D2, 0x4E1E, 0x5036, 0x96C0, 0x7363, 0x8A3B, 0x5176, 0x7199, 0x7FE0, 0x8888, 0x7E1E, 0x4E4F, 0x84CB, 0x6F2B, 0x5859,
+    0x936C, 0x53E9, 0x865A, 0x9149, 0x86EF, 0x5E06, 0x5507, 0x902E, 0x6795, 0x846C, 0x5BA5, 0x82A5, 0x8431, 0x6D8C, 0x63FA, 0x4EA5,
+    0x51C6, 0x6328, 0x7F70, 0x5B5F, 0x5DBD, 0x99C8, 0x53EC, 0x7985, 0x8A54, 0x7962, 0x88DF, 0x5B09, 0x4FB5, 0x4F91, 0x9B8E, 0x5192,
+    0x96F0, 0x6DAF, 0x622F, 0x8490, 0x8CDC, 0x5075, 0x5CE0, 0x4E14, 0x4F83, 0x7C54, 0x84D1, 0x77B3, 0x8AEE, 0x5CE8, 0x62F6, 0x663B,
+    0x8A93, 0x8526, 0x8A95, 0x65FA, 0x6714, 0x53D4, 0x62AB, 0x8CE6, 0x88F3, 0x5BE7, 0x868A, 0x668E, 0x582A, 0x6170, 0x696F, 0x9F13,
+    0x7A92, 0x7893, 0x6A7F, 0x9017, 0x9266, 0x7D10, 0x7BC7, 0x6EF4, 0x821C, 0x5C3D, 0x62CD, 0x85C1, 0x6F02, 0x6E67, 0x6691, 0x85A6,
+    0x637A, 0x821B, 0x4F8D, 0x5091, 0x8A02, 0x62EC, 0x9BC9, 0x7A3D, 0x7C9B, 0x50C5, 0x9019, 0x708A, 0x7C8B, 0x64EC, 0x665F, 0x6562,
+    0x732B, 0x5339, 0x67A0, 0x55A7, 0x6D2A, 0x7A3F, 0x64E6, 0x79A7, 0x67D8, 0x7B26, 0x96BB, 0x6311, 0x72A0, 0x5C6F, 0x7026, 0x97EE,
+    0x60DF, 0x8AFE, 0x8B04, 0x8494, 0x9BD6, 0x82AF, 0x932C, 0x6606, 0x9640, 0x5BC2, 0x86C7, 0x7949, 0x8017, 0x6919, 0x7092, 0x963B,
+    0x7C7E, 0x59D3, 0x5B5C, 0x7D1B, 0x91D8, 0x6A80, 0x85E9, 0x6905, 0x6C93, 0x502D, 0x4EA6, 0x7FC1, 0x61A4, 0x8CCA, 0x9665, 0xFFFF,
+  },
+  { /* lead 0x50 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x93D1, 0x53F1, 0x598A, 0x8EAC, 0x62D8, 0x6867, 0x71D5, 0x7B67, 0x504F, 0x67D0, 0x82D1, 0x978D, 0x748B, 0x80BA, 0x7336,
+    0x514E, 0x8105, 0x90CA, 0x584A, 0x67FE, 0x6FF1, 0x5FFD, 0x76C6, 0x9A0E, 0x507D, 0x9694, 0x5EF7, 0x7BB8, 0x904D, 0x6C4E, 0x85FB,
+    0x819D, 0x67AF, 0x564C, 0x5606, 0x8C8C, 0x56DA, 0x73ED, 0x8CC4, 0x8FC5, 0x96F6, 0x6C50, 0x8944, 0x8F3F, 0x7D5E, 0x60E8, 0x72FC,
+    0x7D9C, 0x8463, 0x5CFB, 0x5446, 0x5D16, 0x6CA1, 0x81B3, 0x58FA, 0x5BB4, 0x8108, 0x541F, 0x8CBC, 0x6182, 0x78A9, 0x6FE1, 0x91A4,
+    0x76F2, 0x6020, 0x76FE, 0x84C9, 0x7F36, 0x4EC7, 0x755D, 0x7A17, 0x84EC, 0x75F4, 0x4F3A, 0x676D, 0x7460, 0x62F3, 0x6F20, 0x79E4,
+    0x87F9, 0x6094, 0x6234, 0x66AB, 0x820C, 0x8499, 0x723A, 0x5FCC, 0x6109, 0x70CF, 0x7261, 0x7A50, 0x5098, 0x9AED, 0x5D69, 0x601C,
+    0x6667, 0x99B4, 0x5E7B, 0x643E, 0x5830, 0x53C9, 0x7A9F, 0x990C, 0x9B42, 0x8F5F, 0x7AAE, 0x5B9B, 0x68A2, 0x6249, 0x7984, 0x9DFA,
+    0x5451, 0x932F, 0x8AC4, 0x5F90, 0x8DF3, 0x5A2F, 0x80DE, 0x6D29, 0x7A4F, 0x84BC, 0x9D2B, 0x9010, 0x6D38, 0x916A, 0x6FC1, 0x9905,
+    0x6BBB, 0x5EB6, 0x91B8, 0x5076, 0x6F0F, 0x4E19, 0x540F, 0x9675, 0x6C72, 0x51B4, 0x5631, 0x9F20, 0x66A6, 0x5F0A, 0x75AB, 0x51F8,
+    0x674F, 0x8DF5, 0x6C70, 0x8A6B, 0x757F, 0x5CAC, 0x6841, 0x8CD3, 0x9BDB, 0x8475, 0x6893, 0x840C, 0x72DB, 0x7577, 0x8568, 0x783A,
+    0x847A, 0x5F10, 0x831C, 0x6813, 0x6E1A, 0x9DAF, 0x51F9, 0x7980, 0x4E99, 0x5EE3, 0x908A, 0x80AF, 0x59A8, 0x77DB, 0x8D74, 0x8A1F,
+    0x673D, 0x533F, 0x8A0A, 0x5618, 0x6756, 0x53D9, 0x4F10, 0x7409, 0x5A41, 0x4FF8, 0x79B0, 0x9838, 0x8E2A, 0x9D60, 0x8F44, 0xFFFF,
+  },
+  { /* lead 0x51 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x65A5, 0x75BE, 0x906D, 0x867B, 0x60BC, 0x51B6, 0x5937, 0x7D2F, 0x916C, 0x69AE, 0x7CE0, 0x792A, 0x5D14, 0x64C1, 0x58EC,
+    0x589C, 0x8D66, 0x66D9, 0x61F2, 0x912D, 0x6E58, 0x9435, 0x965B, 0x7272, 0x5F6A, 0x5E9A, 0x8F1B, 0x5B95, 0x5C39, 0x9013, 0x834F,
+    0x7CCE, 0x620A, 0x90ED, 0x691B, 0x6E15, 0x65DB, 0x66FE, 0x4E9F, 0x55AA, 0x7A83, 0x83E9, 0x8B83, 0x846D, 0x83F0, 0x7F50, 0x918D,
+    0x9190, 0x758E, 0x95A5, 0x81E7, 0x75E2, 0x61A9, 0x8A50, 0x95B2, 0x53A8, 0x59F6, 0x9813, 0x7891, 0x7C17, 0x6B3A, 0x57E0, 0x620E,
+    0x83D6, 0x8AD2, 0x75D4, 0x927E, 0x59DC, 0x5289, 0x9087, 0x6FFE, 0x7473, 0x5C09, 0x9D6C, 0x84FC, 0x7CDF, 0x7BAD, 0x8A6E, 0x594E,
+    0x56A2, 0x819A, 0x7947, 0x6636, 0x53E1, 0x7887, 0x58CC, 0x9397, 0x6E13, 0x5256, 0x828B, 0x9E9F, 0x9583, 0x658C, 0x9E93, 0x7345,
+    0x6E26, 0x9D07, 0x5983, 0x7DAC, 0x96C1, 0x61BE, 0x6762, 0x9ECE, 0x90A8, 0x9187, 0x9F0E, 0x7C38, 0x51F1, 0x8599, 0x524C, 0x540E,
+    0x7901, 0x655E, 0x6668, 0x5CE1, 0x7566, 0x76C8, 0x8679, 0x531D, 0x5506, 0x7926, 0x8912, 0x77EF, 0x7CC0, 0x570B, 0x515C, 0x7E8A,
+    0x535C, 0x8A60, 0x65A7, 0x8766, 0x5766, 0x6AE8, 0x87FB, 0x5E16, 0x7AEA, 0x8D73, 0x771E, 0x737A, 0x66E0, 0x9410, 0x816B, 0x7B08,
+    0x91FC, 0x5737, 0x6FE4, 0x856A, 0x7E55, 0x9957, 0x87BA, 0x694A, 0x818F, 0x5EFF, 0x891C, 0x72D0, 0x9846, 0x9EDB, 0x8D99, 0x5DD6,
+    0x62B9, 0x64AB, 0x4F76, 0x613F, 0x68AF, 0x5F14, 0x800C, 0x92F8, 0x7BC1, 0x52FE, 0x664F, 0x9177, 0x51F6, 0x97A0, 0x839E, 0x647A,
+    0x9C3A, 0x67F5, 0x7C4F, 0x685F, 0x9B6F, 0x9F4B, 0x7FFB, 0x9348, 0x4FF6, 0x9E92, 0x9197, 0x96DB, 0x5BE6, 0x6CCC, 0x7CFE, 0xFFFF,
+  },
+  { /* lead 0x52 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9453, 0x6822, 0x66B9, 0x5BD4, 0x98F4, 0x8AE6, 0x8154, 0x7827, 0x74BD, 0x6ED3, 0x9288, 0x5A20, 0x5B8B, 0x86F8, 0x760D,
+    0x865C, 0x6641, 0x91C9, 0x5589, 0x7A4E, 0x59E5, 0x6042, 0x932B, 0x5B5A, 0x849C, 0x5C91, 0x96CD, 0x62D9, 0x675C, 0x6787, 0x5E7D,
+    0x8650, 0x9EB9, 0x5CB1, 0x80CE, 0x7A00, 0x8ABC, 0x5700, 0x8096, 0x7D72, 0x9211, 0x8098, 0x907C, 0x7761, 0x8737, 0x9075, 0x817A,
+    0x7C3E, 0x6EA2, 0x965E, 0x7E90, 0x72D7, 0x58FD, 0x60B3, 0x9786, 0x7E88, 0x587E, 0x6E20, 0x84DC, 0x6961, 0x77AD, 0x5197, 0x652A,
+    0x6777, 0x5DCD, 0x6101, 0x932E, 0x5954, 0x6367, 0x798D, 0x7AFF, 0x80D6, 0x58B3, 0x6168, 0x6AC3, 0x7483, 0x9B92, 0x660A, 0x642D,
+    0x5118, 0x6763, 0x809B, 0x9C10, 0x4FC9, 0x6953, 0x7A1C, 0x52FF, 0x6055, 0x768E, 0x817F, 0x5642, 0x5F6D, 0x7194, 0x70BB, 0x7436,
+    0x8000, 0x874B, 0x55DA, 0x7435, 0x7690, 0x96EB, 0x66DD, 0x751C, 0x633D, 0x6EC9, 0x7C64, 0x7CA5, 0x6D35, 0x935C, 0x7027, 0x5E25,
+    0x701D, 0x54BD, 0x611A, 0x6973, 0x6C6A, 0x559A, 0x6D19, 0x96CC, 0x5BE1, 0x59FB, 0x697C, 0x914C, 0x7709, 0x8500, 0x7A46, 0x7872,
+    0x92E4, 0x8CED, 0x7CFA, 0x9D1B, 0x814E, 0x9AC4, 0x68A0, 0x6DCB, 0x5918, 0x83B1, 0x5629, 0x9B41, 0x6897, 0x70B3, 0x9771, 0x9419,
+    0x67A2, 0x6802, 0x7895, 0x68A7, 0x50D6, 0x80B1, 0x5EF8, 0x82D4, 0x797A, 0x67CA, 0x7E4D, 0x69CD, 0x51C4, 0x723D, 0x6829, 0x99B3,
+    0x5F3C, 0x8F61, 0x682B, 0x6155, 0x6591, 0x8FB1, 0x7E1B, 0x9798, 0x9952, 0x8877, 0x5B2C, 0x6631, 0x4FA0, 0x6939, 0x6AFB, 0x5BB5,
+    0x7AC8, 0x5026, 0x5944, 0x9059, 0x7B25, 0x7B4F, 0x8E74, 0x8543, 0x5858, 0x8B0E, 0x5039, 0x8654, 0x97F6, 0x7569, 0x72F8, 0xFFFF,
+  },
+  { /* lead 0x53 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4EF7, 0x9D89, 0x5016, 0x51CC, 0x62CC, 0x91C6, 0x8755, 0x649A, 0x88F4, 0x91E6, 0x6854, 0x695A, 0x6C40, 0x7B6C, 0x6741,
+    0x77D7, 0x8823, 0x5384, 0x8EAF, 0x7280, 0x8C6B, 0x788D, 0x7165, 0x8207, 0x68B1, 0x8D04, 0x9077, 0x701E, 0x8FE6, 0x810A, 0x81BF,
+    0x89DC, 0x68B3, 0x6ADF, 0x92EA, 0x95C7, 0x7957, 0x7A20, 0x53A9, 0x8E5F, 0x786F, 0x79B9, 0x5F27, 0x5ED6, 0x6853, 0x93AC, 0x919C,
+    0x691A, 0x5806, 0x64B0, 0x7E4B, 0x7D8F, 0x68F2, 0x6EA5, 0x82DB, 0x9192, 0x5243, 0x8EB0, 0x9081, 0x721B, 0x7DCB, 0x7656, 0x59AC,
+    0x6FE0, 0x8B28, 0x80A2, 0x5544, 0x6070, 0x5F4A, 0x68C8, 0x633A, 0x9438, 0x9B4F, 0x81E5, 0x6A17, 0x70DD, 0x69A7, 0x614C, 0x920E,
+    0x9310, 0x9BAD, 0x52D7, 0x925E, 0x92F9, 0x5993, 0x7696, 0x66FB, 0x5769, 0x73CA, 0x7678, 0x6A1F, 0x7E9C, 0x9811, 0x8CD1, 0x5840,
+    0x6349, 0x871C, 0x62D0, 0x60B4, 0x6B89, 0x86EE, 0x5764, 0x581D, 0x8549, 0x7235, 0x7652, 0x983B, 0x8237, 0x5351, 0x5C24, 0x59BE,
+    0x5815, 0x901D, 0x69B4, 0x834A, 0x9EA9, 0x976B, 0x8086, 0x53AD, 0x6068, 0x4FAE, 0x76C3, 0x6A05, 0x689B, 0x937E, 0x99D5, 0x91C7,
+    0x5C16, 0x585E, 0x61A7, 0x9699, 0x4FDF, 0x8278, 0x9C52, 0x5F45, 0x6108, 0x7C8D, 0x806F, 0x5DF7, 0x8D6B, 0x57B0, 0x98E2, 0x5703,
+    0x79BF, 0x5996, 0x7941, 0x540A, 0x83DF, 0x9C39, 0x52D2, 0x6BD8, 0x86CB, 0x4EC0, 0x9A28, 0x5366, 0x8006, 0x7337, 0x6492, 0x8FED,
+    0x5AC9, 0x5420, 0x537F, 0x4FAF, 0x807E, 0x543B, 0x7515, 0x7B18, 0x8749, 0x54B3, 0x704C, 0x8997, 0x6CAB, 0x85FA, 0x7114, 0x696E,
+    0x9328, 0x745A, 0x59D1, 0x6E5B, 0x617E, 0x53E2, 0x8317, 0x76E7, 0x848B, 0x85AF, 0x6925, 0x5C60, 0x7259, 0x75D5, 0x8B90, 0xFFFF,
+  },
+  { /* lead 0x54 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6E07, 0x82AD, 0x5C4F, 0x7BED, 0x9784, 0x6F70, 0x764C, 0x88B7, 0x92D2, 0x4F36, 0x5EFE, 0x9061, 0x88E1, 0x8471, 0x711A,
+    0x6D1B, 0x80B4, 0x74E2, 0x7433, 0x5A7F, 0x905C, 0x980C, 0x5319, 0x906E, 0x6BB4, 0x85AA, 0x7897, 0x7AFA, 0x6AAE, 0x8910, 0x958F,
+    0x620C, 0x4F3D, 0x4F7C, 0x79BE, 0x9D0E, 0x4ED4, 0x57A2, 0x51A5, 0x6900, 0x6089, 0x707C, 0x7AE3, 0x8956, 0x93A7, 0x9C2D, 0x5112,
+    0x52FA, 0x7CCA, 0x60F9, 0x7078, 0x81C6, 0x559D, 0x6991, 0x96C9, 0x553E, 0x805A, 0x8304, 0x8332, 0x54FA, 0x565B, 0x8FBF, 0x5634,
+    0x6760, 0x5265, 0x840E, 0x5E5F, 0x7B65, 0x9035, 0x8387, 0x6B4E, 0x58BE, 0x6309, 0x727D, 0x97AD, 0x69D0, 0x546A, 0x984E, 0x632B,
+    0x714E, 0x8557, 0x7CDE, 0x6372, 0x68F9, 0x7511, 0x8602, 0x6EBA, 0x5A3C, 0x7A84, 0x851A, 0x95A4, 0x59D0, 0x60DA, 0x51EA, 0x5A29,
+    0x7169, 0x6F15, 0x696B, 0x63BB, 0x75E9, 0x4E4E, 0x7DBB, 0x6934, 0x8521, 0x8FFA, 0x9354, 0x9C3B, 0x5F17, 0x5ED3, 0x8258, 0x895F,
+    0x82E7, 0x52C3, 0x5C51, 0x83AB, 0x7826, 0x79E1, 0x7FF0, 0x626E, 0x60F0, 0x5CA8, 0x6F97, 0x71A8, 0x9909, 0x5132, 0x5E37, 0x5F04,
+    0x637B, 0x6753, 0x68D7, 0x6652, 0x9CF6, 0x88B0, 0x52AB, 0x4FC4, 0x4E3C, 0x67B3, 0x7BAA, 0x7F4D, 0x8A23, 0x63B4, 0x71E6, 0x65A4,
+    0x6F09, 0x853D, 0x5072, 0x7DBA, 0x5516, 0x7B04, 0x72FD, 0x6CD3, 0x8422, 0x621F, 0x50AD, 0x8235, 0x8718, 0x5919, 0x6028, 0x677C,
+    0x6F23, 0x75B9, 0x695C, 0x520E, 0x8018, 0x8B01, 0x71ED, 0x5713, 0x660F, 0x83EB, 0x7164, 0x7D9B, 0x5617, 0x7D7D, 0x8F4D, 0x9318,
+    0x8569, 0x5D17, 0x678C, 0x67DE, 0x87C7, 0x79AE, 0x5835, 0x8404, 0x9041, 0x7FD4, 0x6E8C, 0x8A63, 0x9D08, 0x670F, 0x939A, 0xFFFF,
+  },
+  { /* lead 0x55 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63AC, 0x602F, 0x64E2, 0x608D, 0x96B7, 0x6357, 0x8461, 0x914B, 0x75D8, 0x60E7, 0x9913, 0x9C57, 0x5984, 0x6DEB, 0x5E96,
+    0x6D9C, 0x9BF0, 0x58BB, 0x7977, 0x60B6, 0x633F, 0x5BF5, 0x9812, 0x558B, 0x82D3, 0x5147, 0x6190, 0x7953, 0x79BD, 0x6C5D, 0x9EBA,
+    0x9C48, 0x8DA8, 0x5EE0, 0x7D43, 0x5EFC, 0x854E, 0x8CE4, 0x5AE1, 0x54E8, 0x5023, 0x52BE, 0x7DEC, 0x8511, 0x6666, 0x6C3E, 0x724C,
+    0x8ADC, 0x9C0D, 0x77A5, 0x8B02, 0x8D05, 0x6F11, 0x9834, 0x97FB, 0x50FB, 0x7F75, 0x5A03, 0x8513, 0x4FB6, 0x634C, 0x9D61, 0x808B,
+    0x5294, 0x65A1, 0x567A, 0x5957, 0x8D0B, 0x6A35, 0x6AD3, 0x70F9, 0x865E, 0x6FB1, 0x51E7, 0x7FEB, 0x59EA, 0x5E87, 0x6B6A, 0x754F,
+    0x717D, 0x914E, 0x7D2C, 0x8C79, 0x6062, 0x621A, 0x7FA8, 0x5F1B, 0x6C8C, 0x86FE, 0x7562, 0x7B86, 0x9AB8, 0x6627, 0x7ABA, 0x844E,
+    0x6F81, 0x8B2C, 0x86A4, 0x6FEB, 0x7B8B, 0x7F77, 0x8F2F, 0x8E44, 0x7E23, 0x4E4D, 0x79A6, 0x8AFA, 0x903C, 0x50D1, 0x9ECD, 0x5EDF,
+    0x758F, 0x631F, 0x53DB, 0x9910, 0x826E, 0x62F7, 0x68FA, 0x725D, 0x803D, 0x58D5, 0x5C4D, 0x86D9, 0x540B, 0x8805, 0x92F2, 0x9237,
+    0x5C61, 0x985B, 0x86E4, 0x966A, 0x7262, 0x6955, 0x6CD7, 0x6994, 0x9C2F, 0x77E7, 0x68C9, 0x8DE8, 0x6D6C, 0x67C1, 0x9BAA, 0x619A,
+    0x63A9, 0x7015, 0x9306, 0x934D, 0x6A61, 0x6258, 0x5283, 0x7525, 0x5687, 0x6C83, 0x6834, 0x649E, 0x4E9B, 0x7252, 0x59E6, 0x8FC2,
+    0x5FBD, 0x6DD8, 0x85F7, 0x8A51, 0x9817, 0x99C1, 0x63A0, 0x7C81, 0x5B30, 0x8139, 0x5403, 0x7E82, 0x8106, 0x532A, 0x6A8E, 0x7F6B,
+    0x54E9, 0x5678, 0x8AB9, 0x6715, 0x5BD3, 0x6478, 0x64FE, 0x6B1D, 0x8CC2, 0x51CB, 0x7E8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x56 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5F0C, 0x4E10, 0x4E15, 0x4E28, 0x4E2A, 0x4E31, 0x4E36, 0x4E3F, 0x4E42, 0x4E56, 0x4E58, 0x4E62, 0x4E82, 0x4E85, 0x4E8A,
+    0x4E8E, 0x5F0D, 0x4E9E, 0x4EA0, 0x4EA2, 0x4EB0, 0x4EB3, 0x4EB6, 0x4ECE, 0x4ECD, 0x4EC4, 0x4EC6, 0x4EC2, 0x4EE1, 0x4ED7, 0x4EDE,
+    0x4EED, 0x4EDF, 0x4EFC, 0x4F09, 0x4F1C, 0x4F00, 0x4F03, 0x4F5A, 0x4F30, 0x4F5D, 0x4F39, 0x4F57, 0x4F47, 0x4F5E, 0x4F56, 0x4F5B,
+    0x4F92, 0x4F8A, 0x4F88, 0x4F8F, 0x4F9A, 0x4FAD, 0x4F98, 0x4F7B, 0x4FAB, 0x4F69, 0x4F70, 0x4F94, 0x4F6F, 0x4F86, 0x4F96, 0x4FD4,
+    0x4FCE, 0x4FD8, 0x4FDB, 0x4FD1, 0x4FDA, 0x4FD0, 0x4FCD, 0x4FE4, 0x4FE5, 0x501A, 0x5040, 0x5028, 0x5014, 0x502A, 0x5025, 0x5005,
+    0x5021, 0x5022, 0x5029, 0x502C, 0x4FFF, 0x4FFE, 0x4FEF, 0x5011, 0x501E, 0x5006, 0x5043, 0x5047, 0x5055, 0x5050, 0x5048, 0x505A,
+    0x5056, 0x500F, 0x5046, 0x5070, 0x5042, 0x506C, 0x5078, 0x5080, 0x5094, 0x509A, 0x5085, 0x50B4, 0x6703, 0x50B2, 0x50C9, 0x50CA,
+    0x50B3, 0x50C2, 0x50F4, 0x50DE, 0x50E5, 0x50D8, 0x50ED, 0x50E3, 0x50EE, 0x50F9, 0x50F5, 0x5109, 0x5101, 0x5102, 0x511A, 0x5115,
+    0x5114, 0x5116, 0x5121, 0x513A, 0x5137, 0x513C, 0x513B, 0x513F, 0x5140, 0x514A, 0x514C, 0x5152, 0x5154, 0x5162, 0x5164, 0x5169,
+    0x516A, 0x516E, 0x5180, 0x5182, 0x56D8, 0x518C, 0x5189, 0x518F, 0x5191, 0x5193, 0x5195, 0x5196, 0x519D, 0x51A4, 0x51A6, 0x51A2,
+    0x51A9, 0x51AA, 0x51AB, 0x51B3, 0x51B1, 0x51B2, 0x51B0, 0x51B5, 0x51BE, 0x51BD, 0x51C5, 0x51C9, 0x51DB, 0x51E0, 0x51E9, 0x51EC,
+    0x51ED, 0x51F0, 0x51F5, 0x51FE, 0x5204, 0x520B, 0x5214, 0x5215, 0x5227, 0x522A, 0x522E, 0x5233, 0x5239, 0x5244, 0x524B, 0xFFFF,
+  },
+  { /* lead 0x57 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x524F, 0x525E, 0x5254, 0x5271, 0x526A, 0x5273, 0x5274, 0x5269, 0x527F, 0x527D, 0x528D, 0x5288, 0x5292, 0x5291, 0x529C,
+    0x52A6, 0x52AC, 0x52AD, 0x52BC, 0x52B5, 0x52C1, 0x52C0, 0x52CD, 0x52DB, 0x52DE, 0x52E3, 0x52E6, 0x52E0, 0x52F3, 0x52F5, 0x52F8,
+    0x52F9, 0x5300, 0x5306, 0x5307, 0x5308, 0x7538, 0x530D, 0x5310, 0x530F, 0x5315, 0x531A, 0x5324, 0x5323, 0x532F, 0x5331, 0x5333,
+    0x5338, 0x5340, 0x5345, 0x5346, 0x5349, 0x4E17, 0x534D, 0x51D6, 0x8209, 0x535E, 0x5369, 0x536E, 0x5372, 0x5377, 0x537B, 0x5382,
+    0x5393, 0x5396, 0x53A0, 0x53A6, 0x53A5, 0x53AE, 0x53B0, 0x53B2, 0x53B6, 0x53C3, 0x7C12, 0x53DD, 0x53DF, 0x66FC, 0xFA0E, 0x71EE,
+    0x53EE, 0x53E8, 0x53ED, 0x53FA, 0x5401, 0x543D, 0x5440, 0x542C, 0x542D, 0x543C, 0x542E, 0x5436, 0x5429, 0x541D, 0x544E, 0x548F,
+    0x5475, 0x548E, 0x545F, 0x5471, 0x5477, 0x5470, 0x5492, 0x547B, 0x5480, 0x549C, 0x5476, 0x5484, 0x5490, 0x5486, 0x548A, 0x54C7,
+    0x54BC, 0x54AF, 0x54A2, 0x54B8, 0x54A5, 0x54AC, 0x54C4, 0x54D8, 0x54C8, 0x54A8, 0x54AB, 0x54C2, 0x54A4, 0x54A9, 0x54BE, 0x54E5,
+    0x54FF, 0x54E6, 0x550F, 0x5514, 0x54FD, 0x54EE, 0x54ED, 0x54E2, 0x5539, 0x5540, 0x5563, 0x554C, 0x552E, 0x555C, 0x5545, 0x5556,
+    0x5557, 0x5538, 0x5533, 0x555D, 0x5599, 0x5580, 0x558A, 0x559F, 0x557B, 0x557E, 0x5598, 0x559E, 0x55AE, 0x557C, 0x5586, 0x5583,
+    0x55A9, 0x5587, 0x55A8, 0x55C5, 0x55DF, 0x55C4, 0x55DC, 0x55E4, 0x55D4, 0x55F9, 0x5614, 0x55F7, 0x5616, 0x55FE, 0x55FD, 0x561B,
+    0x564E, 0x5650, 0x5636, 0x5632, 0x5638, 0x566B, 0x5664, 0x5686, 0x562F, 0x566C, 0x566A, 0x71DF, 0x5694, 0x568F, 0x5680, 0xFFFF,
+  },
+  { /* lead 0x58 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x568A, 0x56A0, 0x56A5, 0x56AE, 0x56B6, 0x56B4, 0x56C8, 0x56C2, 0x56BC, 0x56C1, 0x56C3, 0x56C0, 0x56CE, 0x56D3, 0x56D1,
+    0x56D7, 0x56EE, 0x56F9, 0x56FF, 0x5704, 0x5709, 0x5708, 0x570D, 0x55C7, 0x5718, 0x5716, 0x571C, 0x5726, 0x5738, 0x574E, 0x573B,
+    0x5759, 0x5740, 0x574F, 0x5765, 0x5788, 0x5761, 0x577F, 0x5789, 0x5793, 0x57A0, 0x57A4, 0x57B3, 0x57AC, 0x57AA, 0x57C3, 0x57C6,
+    0x57C8, 0x57C0, 0x57D4, 0x57C7, 0x57D2, 0x57D3, 0x57D6, 0xFA0F, 0x580A, 0x57E3, 0x580B, 0x5819, 0x5821, 0x584B, 0x5862, 0x6BC0,
+    0x583D, 0x5852, 0xFA10, 0x5870, 0x5879, 0x5885, 0x5872, 0x589F, 0x58AB, 0x58B8, 0x589E, 0x58AE, 0x58B2, 0x58B9, 0x58BA, 0x58C5,
+    0x58D3, 0x58D1, 0x58D7, 0x58D9, 0x58D8, 0x58DE, 0x58DC, 0x58DF, 0x58E4, 0x58E5, 0x58EF, 0x58F7, 0x58F9, 0x58FB, 0x58FC, 0x5902,
+    0x590A, 0x590B, 0x5910, 0x591B, 0x68A6, 0x5925, 0x592C, 0x592D, 0x5932, 0x5938, 0x593E, 0x5955, 0x5950, 0x5953, 0x595A, 0x5958,
+    0x595B, 0x595D, 0x5963, 0x5962, 0x5960, 0x5967, 0x596C, 0x5969, 0x5978, 0x5981, 0x598D, 0x599B, 0x599D, 0x59A3, 0x59A4, 0x59B2,
+    0x59BA, 0x59C6, 0x59E8, 0x59D9, 0x59DA, 0x5A25, 0x5A1F, 0x5A11, 0x5A1C, 0x5A1A, 0x5A09, 0x5A40, 0x5A6C, 0x5A49, 0x5A35, 0x5A36,
+    0x5A62, 0x5A6A, 0x5A9A, 0x5ABC, 0x5ABE, 0x5AD0, 0x5ACB, 0x5AC2, 0x5ABD, 0x5AE3, 0x5AD7, 0x5AE6, 0x5AE9, 0x5AD6, 0x5AFA, 0x5AFB,
+    0x5B0C, 0x5B0B, 0x5B16, 0x5B32, 0x5B2A, 0x5B36, 0x5B3E, 0x5B43, 0x5B45, 0x5B40, 0x5B51, 0x5B55, 0x5B56, 0x6588, 0x5B5B, 0x5B65,
+    0x5B69, 0x5B70, 0x5B73, 0x5B75, 0x5B78, 0x5B7A, 0x5B80, 0x5B83, 0x5BA6, 0x5BB8, 0x5BC3, 0x5BC7, 0x5BC0, 0x5BC9, 0x752F, 0xFFFF,
+  },
+  { /* lead 0x59 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5BD0, 0x5BD8, 0x5BDE, 0x5BEC, 0x5BE4, 0x5BE2, 0x5BE5, 0x5BEB, 0x5BF0, 0x5BF3, 0x5BF6, 0x5C05, 0x5C07, 0x5C08, 0x5C0D,
+    0x5C13, 0x5C1E, 0x5C20, 0x5C22, 0x5C28, 0x5C38, 0x5C41, 0x5C46, 0x5C4E, 0x5C53, 0x5C50, 0x5B71, 0x5C6C, 0x5C6E, 0x5C76, 0x5C79,
+    0x5C8C, 0x5C94, 0x5CBE, 0x5CAB, 0x5CBB, 0x5CB6, 0x5CB7, 0x5CA6, 0x5CBA, 0x5CC5, 0x5CBC, 0x5CC7, 0x5CD9, 0x5CE9, 0x5CFD, 0x5CFA,
+    0x5CF5, 0x5CED, 0x5CEA, 0x5D0B, 0x5D15, 0x5D1F, 0x5D1B, 0x5D11, 0x5D27, 0x5D22, 0x5D1A, 0x5D19, 0x5D18, 0x5D4C, 0x5D52, 0x5D53,
+    0xFA11, 0x5D5C, 0x5D4E, 0x5D4B, 0x5D42, 0x5D6C, 0x5D73, 0x5D6D, 0x5D76, 0x5D87, 0x5D84, 0x5D82, 0x5D8C, 0x5DA2, 0x5D9D, 0x5D90,
+    0x5DAC, 0x5DAE, 0x5DB7, 0x5DB8, 0x5DBC, 0x5DB9, 0x5DC9, 0x5DD0, 0x5DD3, 0x5DD2, 0x5DDB, 0x5DEB, 0x5DF5, 0x5E0B, 0x5E1A, 0x5E19,
+    0x5E11, 0x5E1B, 0x5E36, 0x5E44, 0x5E43, 0x5E40, 0x5E47, 0x5E4E, 0x5E57, 0x5E54, 0x5E62, 0x5E64, 0x5E75, 0x5E76, 0x5E7A, 0x5E7F,
+    0x5EA0, 0x5EC1, 0x5EC2, 0x5EC8, 0x5ED0, 0x5ECF, 0x5EDD, 0x5EDA, 0x5EDB, 0x5EE2, 0x5EE1, 0x5EE8, 0x5EE9, 0x5EEC, 0x5EF0, 0x5EF1,
+    0x5EF3, 0x5EF4, 0x5F03, 0x5F09, 0x5F0B, 0x5F11, 0x5F16, 0x5F21, 0x5F29, 0x5F2D, 0x5F2F, 0x5F34, 0x5F38, 0x5F41, 0x5F48, 0x5F4C,
+    0x5F4E, 0x5F51, 0x5F56, 0x5F57, 0x5F59, 0x5F5C, 0x5F5D, 0x5F61, 0x5F67, 0x5F73, 0x5F77, 0x5F83, 0x5F82, 0x5F7F, 0x5F8A, 0x5F88,
+    0x5F87, 0x5F91, 0x5F99, 0x5F9E, 0x5F98, 0x5FA0, 0x5FA8, 0x5FAD, 0x5FB7, 0x5FBC, 0x5FD6, 0x5FFB, 0x5FE4, 0x5FF8, 0x5FF1, 0x5FF0,
+    0x5FDD, 0x5FDE, 0x5FFF, 0x6021, 0x6019, 0x6010, 0x6029, 0x600E, 0x6031, 0x601B, 0x6015, 0x602B, 0x6026, 0x600F, 0x603A, 0xFFFF,
+  },
+  { /* lead 0x5A */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x605A, 0x6041, 0x6060, 0x605D, 0x606A, 0x6077, 0x605F, 0x604A, 0x6046, 0x604D, 0x6063, 0x6043, 0x6064, 0x606C, 0x606B,
+    0x6059, 0x6085, 0x6081, 0x6083, 0x609A, 0x6084, 0x609B, 0x608A, 0x6096, 0x6097, 0x6092, 0x60A7, 0x608B, 0x60E1, 0x60B8, 0x60DE,
+    0x60E0, 0x60D3, 0x60BD, 0x60C6, 0x60B5, 0x60D5, 0x60D8, 0x6120, 0x60F2, 0x6115, 0x6106, 0x60F6, 0x60F7, 0x6100, 0x60F4, 0x60FA,
+    0x6103, 0x6121, 0x60FB, 0x60F1, 0x610D, 0x610E, 0x6111, 0x6147, 0x614D, 0x6137, 0x6128, 0x6127, 0x613E, 0x614A, 0x6130, 0x613C,
+    0x612C, 0x6134, 0x6165, 0x615D, 0x613D, 0x6142, 0x6144, 0x6173, 0x6187, 0x6177, 0x6158, 0x6159, 0x615A, 0x616B, 0x6174, 0x616F,
+    0x6171, 0x615F, 0x6153, 0x6175, 0x6198, 0x6199, 0x6196, 0x61AC, 0x6194, 0x618A, 0x6191, 0x61AB, 0x61AE, 0x61CC, 0x61CA, 0x61C9,
+    0x61C8, 0x61C3, 0x61C6, 0x61BA, 0x61CB, 0x7F79, 0x61CD, 0x61E6, 0x61E3, 0x61F4, 0x61F7, 0x61F6, 0x61FD, 0x61FA, 0x61FF, 0x61FC,
+    0x61FE, 0x6200, 0x6208, 0x6209, 0x620D, 0x6213, 0x6214, 0x621B, 0x621E, 0x6221, 0x622A, 0x622E, 0x6230, 0x6232, 0x6233, 0x6241,
+    0x624E, 0x625E, 0x6263, 0x625B, 0x6260, 0x6268, 0x627C, 0x6282, 0x6289, 0x6292, 0x627E, 0x6293, 0x6296, 0x6283, 0x6294, 0x62D7,
+    0x62D1, 0x62BB, 0x62CF, 0x62AC, 0x62C6, 0x62C8, 0x62DC, 0x62D4, 0x62CA, 0x62C2, 0x62A6, 0x62C7, 0x629B, 0x62C9, 0x630C, 0x62EE,
+    0x62F1, 0x6327, 0x6302, 0x6308, 0x62EF, 0x62F5, 0x62FF, 0x6350, 0x634D, 0x633E, 0x634F, 0x6396, 0x638E, 0x6380, 0x63AB, 0x6376,
+    0x63A3, 0x638F, 0x6389, 0x639F, 0x636B, 0x6369, 0x63B5, 0x63BE, 0x63E9, 0x63C0, 0x63C6, 0x63F5, 0x63E3, 0x63C9, 0x63D2, 0xFFFF,
+  },
+  { /* lead 0x5B */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63F6, 0x63C4, 0x6434, 0x6406, 0x6413, 0x6426, 0x6436, 0x641C, 0x6417, 0x6428, 0x640F, 0x6416, 0x644E, 0x6467, 0x646F,
+    0x6460, 0x6476, 0x64B9, 0x649D, 0x64CE, 0x6495, 0x64BB, 0x6493, 0x64A5, 0x64A9, 0x6488, 0x64BC, 0x64DA, 0x64D2, 0x64C5, 0x64C7,
+    0x64D4, 0x64D8, 0x64C2, 0x64F1, 0x64E7, 0x64E0, 0x64E1, 0x64E3, 0x64EF, 0x64F4, 0x64F6, 0x64F2, 0x64FA, 0x6500, 0x64FD, 0x6518,
+    0x651C, 0x651D, 0x6505, 0x6524, 0x6523, 0x652B, 0x652C, 0x6534, 0x6535, 0x6537, 0x6536, 0x6538, 0x754B, 0x6548, 0x654E, 0x6556,
+    0x654D, 0x6558, 0x6555, 0x655D, 0x6572, 0x6578, 0x6582, 0x6583, 0x8B8A, 0x659B, 0x659F, 0x65AB, 0x65B7, 0x65C3, 0x65C6, 0x65C1,
+    0x65C4, 0x65CC, 0x65D2, 0x65D9, 0x65E1, 0x65E0, 0x65F1, 0x6600, 0x6615, 0x6602, 0x6772, 0x6603, 0x65FB, 0x6609, 0x663F, 0x6635,
+    0x662E, 0x661E, 0x6634, 0x661C, 0x6624, 0x6644, 0x6649, 0x6665, 0x6657, 0x665E, 0x6664, 0x6659, 0x6662, 0x665D, 0xFA12, 0x6673,
+    0x6670, 0x6683, 0x6688, 0x6684, 0x6699, 0x6698, 0x66A0, 0x669D, 0x66B2, 0x66C4, 0x66C1, 0x66BF, 0x66C9, 0x66BE, 0x66BC, 0x66B8,
+    0x66D6, 0x66DA, 0x66E6, 0x66E9, 0x66F0, 0x66F5, 0x66F7, 0x66FA, 0x670E, 0xF929, 0x6716, 0x671E, 0x7E22, 0x6726, 0x6727, 0x9738,
+    0x672E, 0x673F, 0x6736, 0x6737, 0x6738, 0x6746, 0x675E, 0x6759, 0x6766, 0x6764, 0x6789, 0x6785, 0x6770, 0x67A9, 0x676A, 0x678B,
+    0x6773, 0x67A6, 0x67A1, 0x67BB, 0x67B7, 0x67EF, 0x67B4, 0x67EC, 0x67E9, 0x67B8, 0x67E7, 0x67E4, 0x6852, 0x67DD, 0x67E2, 0x67EE,
+    0x67C0, 0x67CE, 0x67B9, 0x6801, 0x67C6, 0x681E, 0x6846, 0x684D, 0x6840, 0x6844, 0x6832, 0x684E, 0x6863, 0x6859, 0x688D, 0xFFFF,
+  },
+  { /* lead 0x5C */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6877, 0x687F, 0x689F, 0x687E, 0x688F, 0x68AD, 0x6894, 0x6883, 0x68BC, 0x68B9, 0x6874, 0x68B5, 0x68BA, 0x690F, 0x6901,
+    0x68CA, 0x6908, 0x68D8, 0x6926, 0x68E1, 0x690C, 0x68CD, 0x68D4, 0x68E7, 0x68D5, 0x6912, 0x68EF, 0x6904, 0x68E3, 0x68E0, 0x68CF,
+    0x68C6, 0x6922, 0x692A, 0x6921, 0x6923, 0x6928, 0xFA13, 0x6979, 0x6977, 0x6936, 0x6978, 0x6954, 0x696A, 0x6974, 0x6968, 0x693D,
+    0x6959, 0x6930, 0x695E, 0x695D, 0x697E, 0x6981, 0x69B2, 0x69BF, 0xFA14, 0x6998, 0x69C1, 0x69D3, 0x69BE, 0x69CE, 0x5BE8, 0x69CA,
+    0x69B1, 0x69DD, 0x69BB, 0x69C3, 0x69A0, 0x699C, 0x6995, 0x69DE, 0x6A2E, 0x69E8, 0x6A02, 0x6A1B, 0x69FF, 0x69F9, 0x69F2, 0x69E7,
+    0x69E2, 0x6A1E, 0x69ED, 0x6A14, 0x69EB, 0x6A0A, 0x6A22, 0x6A12, 0x6A23, 0x6A13, 0x6A30, 0x6A6B, 0x6A44, 0x6A0C, 0x6AA0, 0x6A36,
+    0x6A78, 0x6A47, 0x6A62, 0x6A59, 0x6A66, 0x6A48, 0x6A46, 0x6A38, 0x6A72, 0x6A73, 0x6A90, 0x6A8D, 0x6A84, 0x6AA2, 0x6AA3, 0x6A7E,
+    0x6A97, 0x6AAC, 0x6AAA, 0x6ABB, 0x6AC2, 0x6AB8, 0x6AB3, 0x6AC1, 0x6ADE, 0x6AE2, 0x6AD1, 0x6ADA, 0x6AE4, 0x8616, 0x8617, 0x6AEA,
+    0x6B05, 0x6B0A, 0x6AFA, 0x6B12, 0x6B16, 0x6B1F, 0x6B38, 0x6B37, 0x6B39, 0x76DC, 0x98EE, 0x6B47, 0x6B43, 0x6B49, 0x6B50, 0x6B59,
+    0x6B54, 0x6B5B, 0x6B5F, 0x6B61, 0x6B78, 0x6B79, 0x6B7F, 0x6B80, 0x6B84, 0x6B83, 0x6B8D, 0x6B98, 0x6B95, 0x6B9E, 0x6BA4, 0x6BAA,
+    0x6BAB, 0x6BAF, 0x6BB1, 0x6BB2, 0x6BB3, 0x6BB7, 0x6BBC, 0x6BC6, 0x6BCB, 0x6BD3, 0x6BD6, 0x6BDF, 0x6BEC, 0x6BEB, 0x6BF3, 0x6BEF,
+    0x6C08, 0x6C13, 0x6C14, 0x6C1B, 0x6C24, 0x6C23, 0x6C3F, 0x6C5E, 0x6C55, 0x6C5C, 0x6C62, 0x6C82, 0x6C8D, 0x6C86, 0x6C6F, 0xFFFF,
+  },
+  { /* lead 0x5D */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6C9A, 0x6C81, 0x6C9B, 0x6C7E, 0x6C68, 0x6C73, 0x6C92, 0x6C90, 0x6CC4, 0x6CF1, 0x6CBD, 0x6CC5, 0x6CAE, 0x6CDA, 0x6CDD,
+    0x6CB1, 0x6CBE, 0x6CBA, 0x6CDB, 0x6CEF, 0x6CD9, 0x6CEA, 0x6D1F, 0x6D04, 0x6D36, 0x6D2B, 0x6D3D, 0x6D33, 0x6D12, 0x6D0C, 0x6D63,
+    0x6D87, 0x6D93, 0x6D6F, 0x6D64, 0x6D5A, 0x6D79, 0x6D59, 0x6D8E, 0x6D95, 0x6D9B, 0x6D85, 0x6D96, 0x6DF9, 0x6E0A, 0x6E2E, 0x6DB5,
+    0x6DE6, 0x6DC7, 0x6DAC, 0x6DB8, 0x6DCF, 0x6DC6, 0x6DEC, 0x6DDE, 0x6DCC, 0x6DE8, 0x6DF8, 0x6DD2, 0x6DC5, 0x6DFA, 0x6DD9, 0x6DF2,
+    0x6DFC, 0x6DE4, 0x6DD5, 0x6DEA, 0x6DEE, 0x6E2D, 0x6E6E, 0x6E19, 0x6E72, 0x6E5F, 0x6E39, 0x6E3E, 0x6E23, 0x6E6B, 0x6E5C, 0x6E2B,
+    0x6E76, 0x6E4D, 0x6E1F, 0x6E27, 0x6E43, 0x6E3C, 0x6E3A, 0x6E4E, 0x6E24, 0x6E1D, 0x6E38, 0x6E82, 0x6EAA, 0x6E98, 0x6EB7, 0x6EBD,
+    0x6EAF, 0x6EC4, 0x6EB2, 0x6ED4, 0x6ED5, 0x6E8F, 0x6EBF, 0x6EC2, 0x6E9F, 0x6F41, 0x6F45, 0x6EEC, 0x6EF8, 0x6EFE, 0x6F3F, 0x6EF2,
+    0x6F31, 0x6EEF, 0x6F32, 0x6ECC, 0x6EFF, 0x6F3E, 0x6F13, 0x6EF7, 0x6F86, 0x6F7A, 0x6F78, 0x6F80, 0x6F6F, 0x6F5B, 0x6F6D, 0x6F74,
+    0x6F82, 0x6F88, 0x6F7C, 0x6F58, 0x6FC6, 0x6F8E, 0x6F91, 0x6F66, 0x6FB3, 0x6FA3, 0x6FB5, 0x6FA1, 0x6FB9, 0x6FDB, 0x6FAA, 0x6FC2,
+    0x6FDF, 0x6FD5, 0x6FEC, 0x6FD8, 0x6FD4, 0x6FF5, 0x6FEE, 0x7005, 0x7007, 0x7009, 0x700B, 0x6FFA, 0x7011, 0x7001, 0x700F, 0x701B,
+    0x701A, 0x701F, 0x6FF3, 0x7028, 0x7018, 0x7030, 0x703E, 0x7032, 0x7051, 0x7063, 0x7085, 0x7099, 0x70AF, 0x70AB, 0x70AC, 0x70B8,
+    0x70AE, 0x70DF, 0x70CB, 0x70D9, 0x7109, 0x710F, 0x7104, 0x70F1, 0x70FD, 0x711C, 0x7119, 0x715C, 0x7146, 0x7147, 0x7166, 0xFFFF,
+  },
+  { /* lead 0x5E */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x7162, 0x714C, 0x7156, 0x716C, 0x7188, 0x718F, 0x7184, 0x7195, 0xFA15, 0x71AC, 0x71C1, 0x71B9, 0x71BE, 0x71D2, 0x71E7,
+    0x71C9, 0x71D4, 0x71D7, 0x71CE, 0x71F5, 0x71E0, 0x71EC, 0x71FB, 0x71FC, 0x71F9, 0x71FE, 0x71FF, 0x720D, 0x7210, 0x7228, 0x722D,
+    0x722C, 0x7230, 0x7232, 0x723B, 0x723C, 0x723F, 0x7240, 0x7246, 0x724B, 0x7258, 0x7274, 0x727E, 0x7281, 0x7287, 0x7282, 0x7292,
+    0x7296, 0x72A2, 0x72A7, 0x72B1, 0x72B2, 0x72BE, 0x72C3, 0x72C6, 0x72C4, 0x72B9, 0x72CE, 0x72D2, 0x72E2, 0x72E0, 0x72E1, 0x72F9,
+    0x72F7, 0x7317, 0x730A, 0x731C, 0x7316, 0x731D, 0x7324, 0x7334, 0x7329, 0x732F, 0xFA16, 0x7325, 0x733E, 0x734F, 0x734E, 0x7357,
+    0x9ED8, 0x736A, 0x7368, 0x7370, 0x7377, 0x7378, 0x7375, 0x737B, 0x73C8, 0x73BD, 0x73B3, 0x73CE, 0x73BB, 0x73C0, 0x73C9, 0x73D6,
+    0x73E5, 0x73E3, 0x73D2, 0x73EE, 0x73F1, 0x73DE, 0x73F8, 0x7407, 0x73F5, 0x7405, 0x7426, 0x742A, 0x7425, 0x7429, 0x742E, 0x7432,
+    0x743A, 0x7455, 0x743F, 0x745F, 0x7459, 0x7441, 0x745C, 0x7469, 0x7470, 0x7463, 0x746A, 0x7464, 0x7462, 0x7489, 0x746F, 0x747E,
+    0x749F, 0x749E, 0x74A2, 0x74A7, 0x74CA, 0x74CF, 0x74D4, 0x74E0, 0x74E3, 0x74E7, 0x74E9, 0x74EE, 0x74F0, 0x74F2, 0x74F1, 0x74F7,
+    0x74F8, 0x7501, 0x7504, 0x7503, 0x7505, 0x750D, 0x750C, 0x750E, 0x7513, 0x751E, 0x7526, 0x752C, 0x753C, 0x7544, 0x754D, 0x754A,
+    0x7549, 0x7546, 0x755B, 0x755A, 0x7564, 0x7567, 0x756B, 0x756F, 0x7574, 0x756D, 0x7578, 0x7576, 0x7582, 0x7586, 0x7587, 0x758A,
+    0x7589, 0x7594, 0x759A, 0x759D, 0x75A5, 0x75A3, 0x75C2, 0x75B3, 0x75C3, 0x75B5, 0x75BD, 0x75B8, 0x75BC, 0x75B1, 0x75CD, 0xFFFF,
+  },
+  { /* lead 0x5F */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x75CA, 0x75D2, 0x75D9, 0x75E3, 0x75DE, 0x75FE, 0x75FF, 0x75FC, 0x7601, 0x75F0, 0x75FA, 0x75F2, 0x75F3, 0x760B, 0x7609,
+    0x761F, 0x7627, 0x7620, 0x7621, 0x7622, 0x7624, 0x7634, 0x7630, 0x763B, 0x7647, 0x7648, 0x7658, 0x7646, 0x765C, 0x7661, 0x7662,
+    0x7668, 0x7669, 0x7667, 0x766A, 0x766C, 0x7670, 0x7672, 0x7676, 0x767C, 0x7682, 0x7680, 0x7683, 0x7688, 0x768B, 0x7699, 0x769A,
+    0x769C, 0x769E, 0x769B, 0x76A6, 0x76B0, 0x76B4, 0x76B8, 0x76B9, 0x76BA, 0x76C2, 0xFA17, 0x76CD, 0x76D6, 0x76D2, 0x76DE, 0x76E1,
+    0x76E5, 0x76EA, 0x862F, 0x76FB, 0x7708, 0x7707, 0x7704, 0x7724, 0x7729, 0x7725, 0x7726, 0x771B, 0x7737, 0x7738, 0x7746, 0x7747,
+    0x775A, 0x7768, 0x776B, 0x775B, 0x7765, 0x777F, 0x777E, 0x7779, 0x778E, 0x778B, 0x7791, 0x77A0, 0x779E, 0x77B0, 0x77B6, 0x77B9,
+    0x77BF, 0x77BC, 0x77BD, 0x77BB, 0x77C7, 0x77CD, 0x77DA, 0x77DC, 0x77E3, 0x77EE, 0x52AF, 0x77FC, 0x780C, 0x7812, 0x7821, 0x783F,
+    0x7820, 0x7845, 0x784E, 0x7864, 0x7874, 0x788E, 0x787A, 0x7886, 0x789A, 0x787C, 0x788C, 0x78A3, 0x78B5, 0x78AA, 0x78AF, 0x78D1,
+    0x78C6, 0x78CB, 0x78D4, 0x78BE, 0x78BC, 0x78C5, 0x78CA, 0x78EC, 0x78E7, 0x78DA, 0x78FD, 0x78F4, 0x7907, 0x7911, 0x7919, 0x792C,
+    0x792B, 0x7930, 0xFA18, 0x7940, 0x7960, 0xFA19, 0x795F, 0x795A, 0x7955, 0xFA1A, 0x797F, 0x798A, 0x7994, 0xFA1B, 0x799D, 0x799B,
+    0x79AA, 0x79B3, 0x79BA, 0x79C9, 0x79D5, 0x79E7, 0x79EC, 0x79E3, 0x7A08, 0x7A0D, 0x7A18, 0x7A19, 0x7A1F, 0x7A31, 0x7A3E, 0x7A37,
+    0x7A3B, 0x7A43, 0x7A57, 0x7A49, 0x7A62, 0x7A61, 0x7A69, 0x9F9D, 0x7A70, 0x7A79, 0x7A7D, 0x7A88, 0x7A95, 0x7A98, 0x7A96, 0xFFFF,
+  },
+  { /* lead 0x60 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x7A97, 0x7AA9, 0x7AB0, 0x7AB6, 0x9083, 0x7AC3, 0x7ABF, 0x7AC5, 0x7AC4, 0x7AC7, 0x7ACA, 0x7ACD, 0x7ACF, 0x7AD2, 0x7AD1,
+    0x7AD5, 0x7AD3, 0x7AD9, 0x7ADA, 0x7ADD, 0x7AE1, 0x7AE2, 0x7AE6, 0x7AE7, 0xFA1C, 0x7AEB, 0x7AED, 0x7AF0, 0x7AF8, 0x7B02, 0x7B0F,
+    0x7B0B, 0x7B0A, 0x7B06, 0x7B33, 0x7B36, 0x7B19, 0x7B1E, 0x7B35, 0x7B28, 0x7B50, 0x7B4D, 0x7B4C, 0x7B45, 0x7B5D, 0x7B75, 0x7B7A,
+    0x7B74, 0x7B70, 0x7B71, 0x7B6E, 0x7B9D, 0x7B98, 0x7B9F, 0x7B8D, 0x7B9C, 0x7B9A, 0x7B92, 0x7B8F, 0x7B99, 0x7BCF, 0x7BCB, 0x7BCC,
+    0x7BB4, 0x7BC6, 0x7B9E, 0x7BDD, 0x7BE9, 0x7BE6, 0x7BF7, 0x7BE5, 0x7C14, 0x7C00, 0x7C13, 0x7C07, 0x7BF3, 0x7C0D, 0x7BF6, 0x7C23,
+    0x7C27, 0x7C2A, 0x7C1F, 0x7C37, 0x7C2B, 0x7C3D, 0x7C40, 0x7C4C, 0x7C43, 0x7C56, 0x7C50, 0x7C58, 0x7C5F, 0x7C65, 0x7C6C, 0x7C75,
+    0x7C83, 0x7C90, 0x7CA4, 0x7CA2, 0x7CAB, 0x7CA1, 0x7CAD, 0x7CA8, 0x7CB3, 0x7CB2, 0x7CB1, 0x7CAE, 0x7CB9, 0xFA1D, 0x7CBD, 0x7CC5,
+    0x7CC2, 0x7CD2, 0x7CE2, 0x7CD8, 0x7CDC, 0x7CEF, 0x7CF2, 0x7CF4, 0x7CF6, 0x7D06, 0x7D02, 0x7D1C, 0x7D15, 0x7D0A, 0x7D45, 0x7D4B,
+    0x7D2E, 0x7D32, 0x7D3F, 0x7D35, 0x7D48, 0x7D46, 0x7D5C, 0x7D73, 0x7D56, 0x7D4E, 0x7D68, 0x7D6E, 0x7D4F, 0x7D63, 0x7D93, 0x7D89,
+    0x7D5B, 0x7DAE, 0x7DA3, 0x7DB5, 0x7DB7, 0x7DC7, 0x7DBD, 0x7DAB, 0x7DA2, 0x7DAF, 0x7DA0, 0x7DB8, 0x7D9F, 0x7DB0, 0x7DD5, 0x7DD8,
+    0x7DDD, 0x7DD6, 0x7DE4, 0x7DDE, 0x7DFB, 0x7E0B, 0x7DF2, 0x7DE1, 0x7DDC, 0x7E05, 0x7E0A, 0x7E21, 0x7E12, 0x7E1F, 0x7E09, 0x7E3A,
+    0x7E46, 0x7E66, 0x7E31, 0x7E3D, 0x7E35, 0x7E3B, 0x7E39, 0x7E43, 0x7E37, 0x7E32, 0x7E5D, 0x7E56, 0x7E5E, 0x7E52, 0x7E59, 0xFFFF,
+  },
+  { /* lead 0x61 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x7E5A, 0x7E67, 0x7E79, 0x7E6A, 0x7E69, 0x7E7C, 0x7E7B, 0x7E7D, 0x8FAE, 0x7E7F, 0x7E83, 0x7E89, 0x7E8E, 0x7E8C, 0x7E92,
+    0x7E93, 0x7E94, 0x7E96, 0x7E9B, 0x7F38, 0x7F3A, 0x7F45, 0x7F47, 0x7F4C, 0x7F4E, 0x7F51, 0x7F55, 0x7F54, 0x7F58, 0x7F5F, 0x7F60,
+    0x7F68, 0x7F67, 0x7F69, 0x7F78, 0x7F82, 0x7F86, 0x7F83, 0x7F87, 0x7F88, 0x7F8C, 0x7F94, 0x7F9E, 0x7F9D, 0x7F9A, 0x7FA1, 0x7FA3,
+    0x7FAF, 0x7FAE, 0x7FB2, 0x7FB9, 0x7FB6, 0x7FB8, 0x8B71, 0xFA1E, 0x7FC5, 0x7FC6, 0x7FCA, 0x7FD5, 0x7FE1, 0x7FE6, 0x7FE9, 0x7FF3,
+    0x7FF9, 0x8004, 0x800B, 0x8012, 0x8019, 0x801C, 0x8021, 0x8028, 0x803F, 0x803B, 0x804A, 0x8046, 0x8052, 0x8058, 0x805F, 0x8062,
+    0x8068, 0x8073, 0x8072, 0x8070, 0x8076, 0x8079, 0x807D, 0x807F, 0x8084, 0x8085, 0x8093, 0x809A, 0x80AD, 0x5190, 0x80AC, 0x80DB,
+    0x80E5, 0x80D9, 0x80DD, 0x80C4, 0x80DA, 0x8109, 0x80EF, 0x80F1, 0x811B, 0x8123, 0x812F, 0x814B, 0x8146, 0x813E, 0x8153, 0x8151,
+    0x80FC, 0x8171, 0x816E, 0x8165, 0x815F, 0x8166, 0x8174, 0x8183, 0x8188, 0x818A, 0x8180, 0x8182, 0x81A0, 0x8195, 0x81A3, 0x8193,
+    0x81B5, 0x81A4, 0x81A9, 0x81B8, 0x81B0, 0x81C8, 0x81BE, 0x81BD, 0x81C0, 0x81C2, 0x81BA, 0x81C9, 0x81CD, 0x81D1, 0x81D8, 0x81D9,
+    0x81DA, 0x81DF, 0x81E0, 0x81FA, 0x81FB, 0x81FE, 0x8201, 0x8202, 0x8205, 0x820D, 0x8210, 0x8212, 0x8216, 0x8229, 0x822B, 0x822E,
+    0x8238, 0x8233, 0x8240, 0x8259, 0x825A, 0x825D, 0x825F, 0x8264, 0x8262, 0x8268, 0x826A, 0x826B, 0x8271, 0x8277, 0x827E, 0x828D,
+    0x8292, 0x82AB, 0x829F, 0x82BB, 0x82AC, 0x82E1, 0x82E3, 0x82DF, 0x8301, 0x82D2, 0x82F4, 0x82F3, 0x8303, 0x82FB, 0x82F9, 0xFFFF,
+  },
+  { /* lead 0x62 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x82DE, 0x8306, 0x82DC, 0x82FA, 0x8309, 0x82D9, 0x8335, 0x8362, 0x8334, 0x8316, 0x8331, 0x8340, 0x8339, 0x8350, 0x8345,
+    0x832F, 0x832B, 0x8318, 0x839A, 0x83AA, 0x839F, 0x83A2, 0x8396, 0x8323, 0x838E, 0x8375, 0x837F, 0x838A, 0x837C, 0x83B5, 0x8373,
+    0x8393, 0x83A0, 0x8385, 0x8389, 0x83A8, 0x83F4, 0x8413, 0x83C7, 0x83CE, 0x83F7, 0x83FD, 0x8403, 0x83D8, 0x840B, 0x83C1, 0x8407,
+    0x83E0, 0x83F2, 0x840D, 0x8420, 0x83F6, 0x83BD, 0x83FB, 0x842A, 0x8462, 0x843C, 0x8484, 0x8477, 0x846B, 0x8479, 0x8448, 0x846E,
+    0x8482, 0x8469, 0x8446, 0x846F, 0x8438, 0x8435, 0x84CA, 0x84B9, 0x84BF, 0x849F, 0x84B4, 0x84CD, 0x84BB, 0x84DA, 0x84D0, 0x84C1,
+    0x84AD, 0x84C6, 0x84D6, 0x84A1, 0x84D9, 0x84FF, 0x84F4, 0x8517, 0x8518, 0x852C, 0x851F, 0x8515, 0x8514, 0x8506, 0x8553, 0x855A,
+    0x8540, 0x8559, 0x8563, 0x8558, 0x8548, 0x8541, 0x854A, 0x854B, 0x856B, 0x8555, 0x8580, 0x85A4, 0x8588, 0x8591, 0x858A, 0x85A8,
+    0x856D, 0x8594, 0x859B, 0x85AE, 0x8587, 0x859C, 0x8577, 0x857E, 0x8590, 0xFA1F, 0x820A, 0x85B0, 0x85C9, 0x85BA, 0x85CF, 0x85B9,
+    0x85D0, 0x85D5, 0x85DD, 0x85E5, 0x85DC, 0x85F9, 0x860A, 0x8613, 0x860B, 0x85FE, 0x8622, 0x861A, 0x8630, 0x863F, 0xFA20, 0x864D,
+    0x4E55, 0x8655, 0x865F, 0x8667, 0x8671, 0x8693, 0x86A3, 0x86A9, 0x868B, 0x86AA, 0x868C, 0x86B6, 0x86AF, 0x86C4, 0x86C6, 0x86B0,
+    0x86C9, 0x86CE, 0xFA21, 0x86AB, 0x86D4, 0x86DE, 0x86E9, 0x86EC, 0x86DF, 0x86DB, 0x8712, 0x8706, 0x8708, 0x8700, 0x8703, 0x86FB,
+    0x8711, 0x8709, 0x870D, 0x86F9, 0x870A, 0x8734, 0x873F, 0x873B, 0x8725, 0x8729, 0x871A, 0x875F, 0x8778, 0x874C, 0x874E, 0xFFFF,
+  },
+  { /* lead 0x63 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8774, 0x8757, 0x8768, 0x8782, 0x876A, 0x8760, 0x876E, 0x8759, 0x8753, 0x8763, 0x877F, 0x87A2, 0x87C6, 0x879F, 0x87AF,
+    0x87CB, 0x87BD, 0x87C0, 0x87D0, 0x96D6, 0x87AB, 0x87C4, 0x87B3, 0x87D2, 0x87BB, 0x87EF, 0x87F2, 0x87E0, 0x880E, 0x8807, 0x880F,
+    0x8816, 0x880D, 0x87FE, 0x87F6, 0x87F7, 0x8811, 0x8815, 0x8822, 0x8821, 0x8827, 0x8831, 0x8836, 0x8839, 0x883B, 0x8842, 0x8844,
+    0x884D, 0x8852, 0x8859, 0x885E, 0x8862, 0x886B, 0x8881, 0x887E, 0x8875, 0x887D, 0x8872, 0x8882, 0x889E, 0x8897, 0x8892, 0x88AE,
+    0x8899, 0x88A2, 0x888D, 0x88A4, 0x88BF, 0x88B5, 0x88B1, 0x88C3, 0x88C4, 0x88D4, 0x88D8, 0x88D9, 0x88DD, 0x88F9, 0x8902, 0x88FC,
+    0x88F5, 0x88E8, 0x88F2, 0x8904, 0x890C, 0x892A, 0x891D, 0x890A, 0x8913, 0x891E, 0x8925, 0x892B, 0x8941, 0x893B, 0x8936, 0x8943,
+    0x8938, 0x894D, 0x894C, 0x8960, 0x895E, 0x8966, 0x896A, 0x8964, 0x896D, 0x896F, 0x8974, 0x8977, 0x897E, 0x8983, 0x8988, 0x898A,
+    0x8993, 0x8998, 0x89A1, 0x89A9, 0x89A6, 0x89AC, 0x89AF, 0x89B2, 0x89BA, 0x89BF, 0x89BD, 0x89C0, 0x89DA, 0x89DD, 0x89E7, 0x89F4,
+    0x89F8, 0x8A03, 0x8A16, 0x8A10, 0x8A0C, 0x8A12, 0x8A1B, 0x8A1D, 0x8A25, 0x8A36, 0x8A41, 0x8A37, 0x8A5B, 0x8A52, 0x8A46, 0x8A48,
+    0x8A7C, 0x8A6D, 0x8A6C, 0x8A62, 0x8A79, 0x8A85, 0x8A82, 0x8A84, 0x8AA8, 0x8AA1, 0x8A91, 0x8AA5, 0x8AA6, 0x8A9A, 0x8AA3, 0x8AA7,
+    0x8ACC, 0x8ABE, 0x8ACD, 0x8AC2, 0x8ADA, 0x8AF3, 0x8AE7, 0x8AE4, 0x8AF1, 0x8B14, 0x8AE0, 0x8AE2, 0x8AE1, 0x8ADF, 0xFA22, 0x8AF6,
+    0x8AF7, 0x8ADE, 0x8ADB, 0x8B0C, 0x8B07, 0x8B1A, 0x8B16, 0x8B10, 0x8B17, 0x8B20, 0x8B33, 0x8B41, 0x97AB, 0x8B26, 0x8B2B, 0xFFFF,
+  },
+  { /* lead 0x64 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8B3E, 0x8B4C, 0x8B4F, 0x8B4E, 0x8B53, 0x8B49, 0x8B56, 0x8B5B, 0x8B5A, 0x8B74, 0x8B6B, 0x8B5F, 0x8B6C, 0x8B6F, 0x8B7D,
+    0x8B7F, 0x8B80, 0x8B8C, 0x8B8E, 0x8B99, 0x8B92, 0x8B93, 0x8B96, 0x8B9A, 0x8C3A, 0x8C41, 0x8C3F, 0x8C48, 0x8C4C, 0x8C4E, 0x8C50,
+    0x8C55, 0x8C62, 0x8C6C, 0x8C78, 0x8C7A, 0x8C7C, 0x8C82, 0x8C89, 0x8C85, 0x8C8A, 0x8C8D, 0x8C8E, 0x8C98, 0x8C94, 0x621D, 0x8CAD,
+    0x8CAA, 0x8CAE, 0x8CBD, 0x8CB2, 0x8CB3, 0x8CC1, 0x8CB6, 0x8CC8, 0x8CCE, 0x8CCD, 0x8CE3, 0x8CDA, 0x8CF0, 0x8CF4, 0x8CFD, 0x8CFA,
+    0x8CFB, 0x8D07, 0x8D0A, 0x8D0F, 0x8D0D, 0x8D12, 0x8D10, 0x8D13, 0x8D14, 0x8D16, 0x8D67, 0x8D6D, 0x8D71, 0x8D76, 0xFA23, 0x8D81,
+    0x8DC2, 0x8DBE, 0x8DBA, 0x8DCF, 0x8DDA, 0x8DD6, 0x8DCC, 0x8DDB, 0x8DCB, 0x8DEA, 0x8DEB, 0x8DDF, 0x8DE3, 0x8DFC, 0x8E08, 0x8DFF,
+    0x8E09, 0x8E1D, 0x8E1E, 0x8E10, 0x8E1F, 0x8E42, 0x8E35, 0x8E30, 0x8E34, 0x8E4A, 0x8E47, 0x8E49, 0x8E4C, 0x8E50, 0x8E48, 0x8E59,
+    0x8E64, 0x8E60, 0x8E55, 0x8E63, 0x8E76, 0x8E72, 0x8E87, 0x8E7C, 0x8E81, 0x8E85, 0x8E84, 0x8E8B, 0x8E8A, 0x8E93, 0x8E91, 0x8E94,
+    0x8E99, 0x8EA1, 0x8EAA, 0x8EB1, 0x8EBE, 0x8EC6, 0x8EC5, 0x8EC8, 0x8ECB, 0x8ECF, 0x8EDB, 0x8EE3, 0x8EFC, 0x8EFB, 0x8EEB, 0x8EFE,
+    0x8F0A, 0x8F0C, 0x8F05, 0x8F15, 0x8F12, 0x8F13, 0x8F1C, 0x8F19, 0x8F1F, 0x8F26, 0x8F33, 0x8F3B, 0x8F39, 0x8F45, 0x8F42, 0x8F3E,
+    0x8F49, 0x8F46, 0x8F4C, 0x8F4E, 0x8F57, 0x8F5C, 0x8F62, 0x8F63, 0x8F64, 0x8F9C, 0x8F9F, 0x8FA3, 0x8FA8, 0x8FA7, 0x8FAD, 0x8FAF,
+    0x8FB7, 0xFA24, 0x8FDA, 0x8FE5, 0x8FE2, 0x8FEF, 0x8FE9, 0x8FF4, 0x9005, 0x8FF9, 0x8FF8, 0x9011, 0x9015, 0x900E, 0x9021, 0xFFFF,
+  },
+  { /* lead 0x65 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x900D, 0x901E, 0x9016, 0x900B, 0x9027, 0x9036, 0x9039, 0x904F, 0xFA25, 0x9050, 0x9051, 0x9052, 0x9049, 0x903E, 0x9056,
+    0x9058, 0x905E, 0x9068, 0x9067, 0x906F, 0x9076, 0x96A8, 0x9072, 0x9082, 0x907D, 0x9089, 0x9080, 0x908F, 0x6248, 0x90AF, 0x90B1,
+    0x90B5, 0x90E2, 0x90E4, 0x90DB, 0x90DE, 0x9102, 0xFA26, 0x9115, 0x9112, 0x9119, 0x9132, 0x9127, 0x9130, 0x914A, 0x9156, 0x9158,
+    0x9163, 0x9165, 0x9169, 0x9173, 0x9172, 0x918B, 0x9189, 0x9182, 0x91A2, 0x91AB, 0x91AF, 0x91AA, 0x91B5, 0x91B4, 0x91BA, 0x91C0,
+    0x91C1, 0x91CB, 0x91D0, 0x91DA, 0x91DB, 0x91D7, 0x91DE, 0x91D6, 0x91DF, 0x91E1, 0x91ED, 0x91F5, 0x91EE, 0x91E4, 0x91F6, 0x91E5,
+    0x9206, 0x921E, 0x91FF, 0x9210, 0x9214, 0x920A, 0x922C, 0x9215, 0x9229, 0x9257, 0x9245, 0x923A, 0x9249, 0x9264, 0x9240, 0x923C,
+    0x9248, 0x924E, 0x9250, 0x9259, 0x923F, 0x9251, 0x9239, 0x924B, 0x9267, 0x925A, 0x929C, 0x92A7, 0x9277, 0x9278, 0x9296, 0x9293,
+    0x929B, 0x9295, 0x92E9, 0x92CF, 0x92E7, 0x92D7, 0x92D9, 0x92D0, 0xFA27, 0x92D5, 0x92B9, 0x92B7, 0x92E0, 0x92D3, 0x933A, 0x9335,
+    0x930F, 0x9325, 0x92FA, 0x9321, 0x9344, 0x92FB, 0xFA28, 0x9319, 0x931E, 0x92FF, 0x9322, 0x931A, 0x931D, 0x9323, 0x9302, 0x933B,
+    0x9370, 0x9360, 0x937C, 0x936E, 0x9356, 0x9357, 0x93B9, 0x93B0, 0x93A4, 0x93AD, 0x9394, 0x93C8, 0x93D6, 0x93C6, 0x93D7, 0x93E8,
+    0x93E5, 0x93D8, 0x93C3, 0x93DD, 0x93DE, 0x93D0, 0x93E4, 0x941A, 0x93F8, 0x9414, 0x9413, 0x9421, 0x9403, 0x9407, 0x9436, 0x942B,
+    0x9431, 0x943A, 0x9441, 0x9452, 0x9445, 0x9444, 0x9448, 0x945B, 0x945A, 0x9460, 0x9462, 0x945E, 0x946A, 0x9475, 0x9470, 0xFFFF,
+  },
+  { /* lead 0x66 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9477, 0x947F, 0x947D, 0x947C, 0x947E, 0x9481, 0x9582, 0x9587, 0x958A, 0x9592, 0x9594, 0x9596, 0x9598, 0x9599, 0x95A0,
+    0x95A8, 0x95A7, 0x95AD, 0x95BC, 0x95BB, 0x95B9, 0x95BE, 0x95CA, 0x6FF6, 0x95C3, 0x95CD, 0x95CC, 0x95D5, 0x95D4, 0x95D6, 0x95DC,
+    0x95E1, 0x95E5, 0x95E2, 0x9621, 0x9628, 0x962E, 0x962F, 0x9642, 0x964F, 0x964C, 0x964B, 0x965C, 0x965D, 0x965F, 0x9666, 0x9677,
+    0x9672, 0x966C, 0x968D, 0x968B, 0xF9DC, 0x9698, 0x9695, 0x9697, 0xFA29, 0x969D, 0x96A7, 0x96AA, 0x96B1, 0x96B2, 0x96B0, 0x96AF,
+    0x96B4, 0x96B6, 0x96B8, 0x96B9, 0x96CE, 0x96CB, 0x96D5, 0x96DC, 0x96D9, 0x96F9, 0x9704, 0x9706, 0x9708, 0x9719, 0x970D, 0x9713,
+    0x970E, 0x9711, 0x970F, 0x9716, 0x9724, 0x972A, 0x9730, 0x9733, 0x9739, 0x973B, 0x973D, 0x973E, 0x9746, 0x9744, 0x9743, 0x9748,
+    0x9742, 0x9749, 0x974D, 0x974F, 0x9751, 0x9755, 0x975C, 0x9760, 0x9764, 0x9766, 0x9768, 0x976D, 0x9779, 0x9785, 0x977C, 0x9781,
+    0x977A, 0x978B, 0x978F, 0x9790, 0x979C, 0x97A8, 0x97A6, 0x97A3, 0x97B3, 0x97B4, 0x97C3, 0x97C6, 0x97C8, 0x97CB, 0x97DC, 0x97ED,
+    0x97F2, 0x7ADF, 0x97F5, 0x980F, 0x981A, 0x9824, 0x9821, 0x9837, 0x983D, 0x984F, 0x984B, 0x9857, 0x9865, 0x986B, 0x986F, 0x9870,
+    0x9871, 0x9874, 0x9873, 0x98AA, 0x98AF, 0x98B1, 0x98B6, 0x98C4, 0x98C3, 0x98C6, 0x98DC, 0x98ED, 0x98E9, 0xFA2A, 0x98EB, 0xFA2B,
+    0x9903, 0x991D, 0x9912, 0x9914, 0x9918, 0x9927, 0xFA2C, 0x9921, 0x991E, 0x9924, 0x9920, 0x992C, 0x992E, 0x993D, 0x993E, 0x9942,
+    0x9949, 0x9945, 0x9950, 0x994B, 0x9951, 0x994C, 0x9955, 0x9997, 0x9998, 0x999E, 0x99A5, 0x99AD, 0x99AE, 0x99BC, 0x99DF, 0xFFFF,
+  },
+  { /* lead 0x67 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x99DB, 0x99DD, 0x99D8, 0x99D1, 0x99ED, 0x99EE, 0x99E2, 0x99F1, 0x99F2, 0x99FB, 0x99F8, 0x9A01, 0x9A0F, 0x9A05, 0x9A19,
+    0x9A2B, 0x9A37, 0x9A40, 0x9A45, 0x9A42, 0x9A43, 0x9A3E, 0x9A55, 0x9A4D, 0x9A4E, 0x9A5B, 0x9A57, 0x9A5F, 0x9A62, 0x9A69, 0x9A65,
+    0x9A64, 0x9A6A, 0x9A6B, 0x9AAD, 0x9AB0, 0x9ABC, 0x9AC0, 0x9ACF, 0x9AD3, 0x9AD4, 0x9AD1, 0x9AD9, 0x9ADC, 0x9ADE, 0x9ADF, 0x9AE2,
+    0x9AE3, 0x9AE6, 0x9AEF, 0x9AEB, 0x9AEE, 0x9AF4, 0x9AF1, 0x9AF7, 0x9AFB, 0x9B06, 0x9B18, 0x9B1A, 0x9B1F, 0x9B22, 0x9B23, 0x9B25,
+    0x9B27, 0x9B28, 0x9B29, 0x9B2A, 0x9B2E, 0x9B2F, 0x9B31, 0x9B32, 0x9B3B, 0x9B44, 0x9B43, 0x9B4D, 0x9B4E, 0x9B51, 0x9B58, 0x9B75,
+    0x9B74, 0x9B72, 0x9B93, 0x9B8F, 0x9B83, 0x9B91, 0x9B96, 0x9B97, 0x9B9F, 0x9BA0, 0x9BA8, 0x9BB1, 0x9BB4, 0x9BC0, 0x9BCA, 0x9BBB,
+    0x9BB9, 0x9BC6, 0x9BCF, 0x9BD1, 0x9BD2, 0x9BE3, 0x9BE2, 0x9BE4, 0x9BD4, 0x9BE1, 0x9BF5, 0x9BF1, 0x9BF2, 0x9C04, 0x9C1B, 0x9C15,
+    0x9C14, 0x9C00, 0x9C09, 0x9C13, 0x9C0C, 0x9C06, 0x9C08, 0x9C12, 0x9C0A, 0x9C2E, 0x9C25, 0x9C24, 0x9C21, 0x9C30, 0x9C47, 0x9C32,
+    0x9C46, 0x9C3E, 0x9C5A, 0x9C60, 0x9C67, 0x9C76, 0x9C78, 0x9CEB, 0x9CE7, 0x9CEC, 0x9CF0, 0x9D09, 0x9D03, 0x9D06, 0x9D2A, 0x9D26,
+    0x9D2C, 0x9D23, 0x9D1F, 0x9D15, 0x9D12, 0x9D41, 0x9D3F, 0x9D44, 0x9D3E, 0x9D46, 0x9D48, 0x9D5D, 0x9D5E, 0x9D59, 0x9D51, 0x9D50,
+    0x9D64, 0x9D72, 0x9D70, 0x9D87, 0x9D6B, 0x9D6F, 0x9D7A, 0x9D9A, 0x9DA4, 0x9DA9, 0x9DAB, 0x9DB2, 0x9DC4, 0x9DC1, 0x9DBB, 0x9DB8,
+    0x9DBA, 0x9DC6, 0x9DCF, 0x9DC2, 0xFA2D, 0x9DD9, 0x9DD3, 0x9DF8, 0x9DE6, 0x9DED, 0x9DEF, 0x9DFD, 0x9E1A, 0x9E1B, 0x9E19, 0xFFFF,
+  },
+  { /* lead 0x68 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9E1E, 0x9E75, 0x9E79, 0x9E7D, 0x9E81, 0x9E88, 0x9E8B, 0x9E8C, 0x9E95, 0x9E91, 0x9E9D, 0x9EA5, 0x9EB8, 0x9EAA, 0x9EAD,
+    0x9EBC, 0x9EBE, 0x9761, 0x9ECC, 0x9ECF, 0x9ED0, 0x9ED1, 0x9ED4, 0x9EDC, 0x9EDE, 0x9EDD, 0x9EE0, 0x9EE5, 0x9EE8, 0x9EEF, 0x9EF4,
+    0x9EF6, 0x9EF7, 0x9EF9, 0x9EFB, 0x9EFC, 0x9EFD, 0x9F07, 0x9F08, 0x76B7, 0x9F15, 0x9F21, 0x9F2C, 0x9F3E, 0x9F4A, 0x9F4E, 0x9F4F,
+    0x9F52, 0x9F54, 0x9F63, 0x9F5F, 0x9F60, 0x9F61, 0x9F66, 0x9F67, 0x9F6C, 0x9F6A, 0x9F77, 0x9F72, 0x9F76, 0x9F95, 0x9F9C, 0x9FA0,
+    0x5C2D, 0x69D9, 0x9065, 0x7476, 0x51DC, 0x7155, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* lead 0x69 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE000, 0xE001, 0xE002, 0xE003, 0xE004, 0xE005, 0xE006, 0xE007, 0xE008, 0xE009, 0xE00A, 0xE00B, 0xE00C, 0xE00D, 0xE00E,
+    0xE00F, 0xE010, 0xE011, 0xE012, 0xE013, 0xE014, 0xE015, 0xE016, 0xE017, 0xE018, 0xE019, 0xE01A, 0xE01B, 0xE01C, 0xE01D, 0xE01E,
+    0xE01F, 0xE020, 0xE021, 0xE022, 0xE023, 0xE024, 0xE025, 0xE026, 0xE027, 0xE028, 0xE029, 0xE02A, 0xE02B, 0xE02C, 0xE02D, 0xE02E,
+    0xE02F, 0xE030, 0xE031, 0xE032, 0xE033, 0xE034, 0xE035, 0xE036, 0xE037, 0xE038, 0xE039, 0xE03A, 0xE03B, 0xE03C, 0xE03D, 0xE03E,
+    0xE03F, 0xE040, 0xE041, 0xE042, 0xE043, 0xE044, 0xE045, 0xE046, 0xE047, 0xE048, 0xE049, 0xE04A, 0xE04B, 0xE04C, 0xE04D, 0xE04E,
+    0xE04F, 0xE050, 0xE051, 0xE052, 0xE053, 0xE054, 0xE055, 0xE056, 0xE057, 0xE058, 0xE059, 0xE05A, 0xE05B, 0xE05C, 0xE05D, 0xE05E,
+    0xE05F, 0xE060, 0xE061, 0xE062, 0xE063, 0xE064, 0xE065, 0xE066, 0xE067, 0xE068, 0xE069, 0xE06A, 0xE06B, 0xE06C, 0xE06D, 0xE06E,
+    0xE06F, 0xE070, 0xE071, 0xE072, 0xE073, 0xE074, 0xE075, 0xE076, 0xE077, 0xE078, 0xE079, 0xE07A, 0xE07B, 0xE07C, 0xE07D, 0xE07E,
+    0xE07F, 0xE080, 0xE081, 0xE082, 0xE083, 0xE084, 0xE085, 0xE086, 0xE087, 0xE088, 0xE089, 0xE08A, 0xE08B, 0xE08C, 0xE08D, 0xE08E,
+    0xE08F, 0xE090, 0xE091, 0xE092, 0xE093, 0xE094, 0xE095, 0xE096, 0xE097, 0xE098, 0xE099, 0xE09A, 0xE09B, 0xE09C, 0xE09D, 0xE09E,
+    0xE09F, 0xE0A0, 0xE0A1, 0xE0A2, 0xE0A3, 0xE0A4, 0xE0A5, 0xE0A6, 0xE0A7, 0xE0A8, 0xE0A9, 0xE0AA, 0xE0AB, 0xE0AC, 0xE0AD, 0xE0AE,
+    0xE0AF, 0xE0B0, 0xE0B1, 0xE0B2, 0xE0B3, 0xE0B4, 0xE0B5, 0xE0B6, 0xE0B7, 0xE0B8, 0xE0B9, 0xE0BA, 0xE0BB, 0xE0BC, 0xE0BD, 0xFFFF,
+  },
+  { /* lead 0x6A */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE0BE, 0xE0BF, 0xE0C0, 0xE0C1, 0xE0C2, 0xE0C3, 0xE0C4, 0xE0C5, 0xE0C6, 0xE0C7, 0xE0C8, 0xE0C9, 0xE0CA, 0xE0CB, 0xE0CC,
+    0xE0CD, 0xE0CE, 0xE0CF, 0xE0D0, 0xE0D1, 0xE0D2, 0xE0D3, 0xE0D4, 0xE0D5, 0xE0D6, 0xE0D7, 0xE0D8, 0xE0D9, 0xE0DA, 0xE0DB, 0xE0DC,
+    0xE0DD, 0xE0DE, 0xE0DF, 0xE0E0, 0xE0E1, 0xE0E2, 0xE0E3, 0xE0E4, 0xE0E5, 0xE0E6, 0xE0E7, 0xE0E8, 0xE0E9, 0xE0EA, 0xE0EB, 0xE0EC,
+    0xE0ED, 0xE0EE, 0xE0EF, 0xE0F0, 0xE0F1, 0xE0F2, 0xE0F3, 0xE0F4, 0xE0F5, 0xE0F6, 0xE0F7, 0xE0F8, 0xE0F9, 0xE0FA, 0xE0FB, 0xE0FC,
+    0xE0FD, 0xE0FE, 0xE0FF, 0xE100, 0xE101, 0xE102, 0xE103, 0xE104, 0xE105, 0xE106, 0xE107, 0xE108, 0xE109, 0xE10A, 0xE10B, 0xE10C,
+    0xE10D, 0xE10E, 0xE10F, 0xE110, 0xE111, 0xE112, 0xE113, 0xE114, 0xE115, 0xE116, 0xE117, 0xE118, 0xE119, 0xE11A, 0xE11B, 0xE11C,
+    0xE11D, 0xE11E, 0xE11F, 0xE120, 0xE121, 0xE122, 0xE123, 0xE124, 0xE125, 0xE126, 0xE127, 0xE128, 0xE129, 0xE12A, 0xE12B, 0xE12C,
+    0xE12D, 0xE12E, 0xE12F, 0xE130, 0xE131, 0xE132, 0xE133, 0xE134, 0xE135, 0xE136, 0xE137, 0xE138, 0xE139, 0xE13A, 0xE13B, 0xE13C,
+    0xE13D, 0xE13E, 0xE13F, 0xE140, 0xE141, 0xE142, 0xE143, 0xE144, 0xE145, 0xE146, 0xE147, 0xE148, 0xE149, 0xE14A, 0xE14B, 0xE14C,
+    0xE14D, 0xE14E, 0xE14F, 0xE150, 0xE151, 0xE152, 0xE153, 0xE154, 0xE155, 0xE156, 0xE157, 0xE158, 0xE159, 0xE15A, 0xE15B, 0xE15C,
+    0xE15D, 0xE15E, 0xE15F, 0xE160, 0xE161, 0xE162, 0xE163, 0xE164, 0xE165, 0xE166, 0xE167, 0xE168, 0xE169, 0xE16A, 0xE16B, 0xE16C,
+    0xE16D, 0xE16E, 0xE16F, 0xE170, 0xE171, 0xE172, 0xE173, 0xE174, 0xE175, 0xE176, 0xE177, 0xE178, 0xE179, 0xE17A, 0xE17B, 0xFFFF,
+  },
+  { /* lead 0x6B */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE17C, 0xE17D, 0xE17E, 0xE17F, 0xE180, 0xE181, 0xE182, 0xE183, 0xE184, 0xE185, 0xE186, 0xE187, 0xE188, 0xE189, 0xE18A,
+    0xE18B, 0xE18C, 0xE18D, 0xE18E, 0xE18F, 0xE190, 0xE191, 0xE192, 0xE193, 0xE194, 0xE195, 0xE196, 0xE197, 0xE198, 0xE199, 0xE19A,
+    0xE19B, 0xE19C, 0xE19D, 0xE19E, 0xE19F, 0xE1A0, 0xE1A1, 0xE1A2, 0xE1A3, 0xE1A4, 0xE1A5, 0xE1A6, 0xE1A7, 0xE1A8, 0xE1A9, 0xE1AA,
+    0xE1AB, 0xE1AC, 0xE1AD, 0xE1AE, 0xE1AF, 0xE1B0, 0xE1B1, 0xE1B2, 0xE1B3, 0xE1B4, 0xE1B5, 0xE1B6, 0xE1B7, 0xE1B8, 0xE1B9, 0xE1BA,
+    0xE1BB, 0xE1BC, 0xE1BD, 0xE1BE, 0xE1BF, 0xE1C0, 0xE1C1, 0xE1C2, 0xE1C3, 0xE1C4, 0xE1C5, 0xE1C6, 0xE1C7, 0xE1C8, 0xE1C9, 0xE1CA,
+    0xE1CB, 0xE1CC, 0xE1CD, 0xE1CE, 0xE1CF, 0xE1D0, 0xE1D1, 0xE1D2, 0xE1D3, 0xE1D4, 0xE1D5, 0xE1D6, 0xE1D7, 0xE1D8, 0xE1D9, 0xE1DA,
+    0xE1DB, 0xE1DC, 0xE1DD, 0xE1DE, 0xE1DF, 0xE1E0, 0xE1E1, 0xE1E2, 0xE1E3, 0xE1E4, 0xE1E5, 0xE1E6, 0xE1E7, 0xE1E8, 0xE1E9, 0xE1EA,
+    0xE1EB, 0xE1EC, 0xE1ED, 0xE1EE, 0xE1EF, 0xE1F0, 0xE1F1, 0xE1F2, 0xE1F3, 0xE1F4, 0xE1F5, 0xE1F6, 0xE1F7, 0xE1F8, 0xE1F9, 0xE1FA,
+    0xE1FB, 0xE1FC, 0xE1FD, 0xE1FE, 0xE1FF, 0xE200, 0xE201, 0xE202, 0xE203, 0xE204, 0xE205, 0xE206, 0xE207, 0xE208, 0xE209, 0xE20A,
+    0xE20B, 0xE20C, 0xE20D, 0xE20E, 0xE20F, 0xE210, 0xE211, 0xE212, 0xE213, 0xE214, 0xE215, 0xE216, 0xE217, 0xE218, 0xE219, 0xE21A,
+    0xE21B, 0xE21C, 0xE21D, 0xE21E, 0xE21F, 0xE220, 0xE221, 0xE222, 0xE223, 0xE224, 0xE225, 0xE226, 0xE227, 0xE228, 0xE229, 0xE22A,
+    0xE22B, 0xE22C, 0xE22D, 0xE22E, 0xE22F, 0xE230, 0xE231, 0xE232, 0xE233, 0xE234, 0xE235, 0xE236, 0xE237, 0xE238, 0xE239, 0xFFFF,
+  },
+  { /* lead 0x6C */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE23A, 0xE23B, 0xE23C, 0xE23D, 0xE23E, 0xE23F, 0xE240, 0xE241, 0xE242, 0xE243, 0xE244, 0xE245, 0xE246, 0xE247, 0xE248,
+    0xE249, 0xE24A, 0xE24B, 0xE24C, 0xE24D, 0xE24E, 0xE24F, 0xE250, 0xE251, 0xE252, 0xE253, 0xE254, 0xE255, 0xE256, 0xE257, 0xE258,
+    0xE259, 0xE25A, 0xE25B, 0xE25C, 0xE25D, 0xE25E, 0xE25F, 0xE260, 0xE261, 0xE262, 0xE263, 0xE264, 0xE265, 0xE266, 0xE267, 0xE268,
+    0xE269, 0xE26A, 0xE26B, 0xE26C, 0xE26D, 0xE26E, 0xE26F, 0xE270, 0xE271, 0xE272, 0xE273, 0xE274, 0xE275, 0xE276, 0xE277, 0xE278,
+    0xE279, 0xE27A, 0xE27B, 0xE27C, 0xE27D, 0xE27E, 0xE27F, 0xE280, 0xE281, 0xE282, 0xE283, 0xE284, 0xE285, 0xE286, 0xE287, 0xE288,
+    0xE289, 0xE28A, 0xE28B, 0xE28C, 0xE28D, 0xE28E, 0xE28F, 0xE290, 0xE291, 0xE292, 0xE293, 0xE294, 0xE295, 0xE296, 0xE297, 0xE298,
+    0xE299, 0xE29A, 0xE29B, 0xE29C, 0xE29D, 0xE29E, 0xE29F, 0xE2A0, 0xE2A1, 0xE2A2, 0xE2A3, 0xE2A4, 0xE2A5, 0xE2A6, 0xE2A7, 0xE2A8,
+    0xE2A9, 0xE2AA, 0xE2AB, 0xE2AC, 0xE2AD, 0xE2AE, 0xE2AF, 0xE2B0, 0xE2B1, 0xE2B2, 0xE2B3, 0xE2B4, 0xE2B5, 0xE2B6, 0xE2B7, 0xE2B8,
+    0xE2B9, 0xE2BA, 0xE2BB, 0xE2BC, 0xE2BD, 0xE2BE, 0xE2BF, 0xE2C0, 0xE2C1, 0xE2C2, 0xE2C3, 0xE2C4, 0xE2C5, 0xE2C6, 0xE2C7, 0xE2C8,
+    0xE2C9, 0xE2CA, 0xE2CB, 0xE2CC, 0xE2CD, 0xE2CE, 0xE2CF, 0xE2D0, 0xE2D1, 0xE2D2, 0xE2D3, 0xE2D4, 0xE2D5, 0xE2D6, 0xE2D7, 0xE2D8,
+    0xE2D9, 0xE2DA, 0xE2DB, 0xE2DC, 0xE2DD, 0xE2DE, 0xE2DF, 0xE2E0, 0xE2E1, 0xE2E2, 0xE2E3, 0xE2E4, 0xE2E5, 0xE2E6, 0xE2E7, 0xE2E8,
+    0xE2E9, 0xE2EA, 0xE2EB, 0xE2EC, 0xE2ED, 0xE2EE, 0xE2EF, 0xE2F0, 0xE2F1, 0xE2F2, 0xE2F3, 0xE2F4, 0xE2F5, 0xE2F6, 0xE2F7, 0xFFFF,
+  },
+  { /* lead 0x6D */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE2F8, 0xE2F9, 0xE2FA, 0xE2FB, 0xE2FC, 0xE2FD, 0xE2FE, 0xE2FF, 0xE300, 0xE301, 0xE302, 0xE303, 0xE304, 0xE305, 0xE306,
+    0xE307, 0xE308, 0xE309, 0xE30A, 0xE30B, 0xE30C, 0xE30D, 0xE30E, 0xE30F, 0xE310, 0xE311, 0xE312, 0xE313, 0xE314, 0xE315, 0xE316,
+    0xE317, 0xE318, 0xE319, 0xE31A, 0xE31B, 0xE31C, 0xE31D, 0xE31E, 0xE31F, 0xE320, 0xE321, 0xE322, 0xE323, 0xE324, 0xE325, 0xE326,
+    0xE327, 0xE328, 0xE329, 0xE32A, 0xE32B, 0xE32C, 0xE32D, 0xE32E, 0xE32F, 0xE330, 0xE331, 0xE332, 0xE333, 0xE334, 0xE335, 0xE336,
+    0xE337, 0xE338, 0xE339, 0xE33A, 0xE33B, 0xE33C, 0xE33D, 0xE33E, 0xE33F, 0xE340, 0xE341, 0xE342, 0xE343, 0xE344, 0xE345, 0xE346,
+    0xE347, 0xE348, 0xE349, 0xE34A, 0xE34B, 0xE34C, 0xE34D, 0xE34E, 0xE34F, 0xE350, 0xE351, 0xE352, 0xE353, 0xE354, 0xE355, 0xE356,
+    0xE357, 0xE358, 0xE359, 0xE35A, 0xE35B, 0xE35C, 0xE35D, 0xE35E, 0xE35F, 0xE360, 0xE361, 0xE362, 0xE363, 0xE364, 0xE365, 0xE366,
+    0xE367, 0xE368, 0xE369, 0xE36A, 0xE36B, 0xE36C, 0xE36D, 0xE36E, 0xE36F, 0xE370, 0xE371, 0xE372, 0xE373, 0xE374, 0xE375, 0xE376,
+    0xE377, 0xE378, 0xE379, 0xE37A, 0xE37B, 0xE37C, 0xE37D, 0xE37E, 0xE37F, 0xE380, 0xE381, 0xE382, 0xE383, 0xE384, 0xE385, 0xE386,
+    0xE387, 0xE388, 0xE389, 0xE38A, 0xE38B, 0xE38C, 0xE38D, 0xE38E, 0xE38F, 0xE390, 0xE391, 0xE392, 0xE393, 0xE394, 0xE395, 0xE396,
+    0xE397, 0xE398, 0xE399, 0xE39A, 0xE39B, 0xE39C, 0xE39D, 0xE39E, 0xE39F, 0xE3A0, 0xE3A1, 0xE3A2, 0xE3A3, 0xE3A4, 0xE3A5, 0xE3A6,
+    0xE3A7, 0xE3A8, 0xE3A9, 0xE3AA, 0xE3AB, 0xE3AC, 0xE3AD, 0xE3AE, 0xE3AF, 0xE3B0, 0xE3B1, 0xE3B2, 0xE3B3, 0xE3B4, 0xE3B5, 0xFFFF,
+  },
+  { /* lead 0x6E */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE3B6, 0xE3B7, 0xE3B8, 0xE3B9, 0xE3BA, 0xE3BB, 0xE3BC, 0xE3BD, 0xE3BE, 0xE3BF, 0xE3C0, 0xE3C1, 0xE3C2, 0xE3C3, 0xE3C4,
+    0xE3C5, 0xE3C6, 0xE3C7, 0xE3C8, 0xE3C9, 0xE3CA, 0xE3CB, 0xE3CC, 0xE3CD, 0xE3CE, 0xE3CF, 0xE3D0, 0xE3D1, 0xE3D2, 0xE3D3, 0xE3D4,
+    0xE3D5, 0xE3D6, 0xE3D7, 0xE3D8, 0xE3D9, 0xE3DA, 0xE3DB, 0xE3DC, 0xE3DD, 0xE3DE, 0xE3DF, 0xE3E0, 0xE3E1, 0xE3E2, 0xE3E3, 0xE3E4,
+    0xE3E5, 0xE3E6, 0xE3E7, 0xE3E8, 0xE3E9, 0xE3EA, 0xE3EB, 0xE3EC, 0xE3ED, 0xE3EE, 0xE3EF, 0xE3F0, 0xE3F1, 0xE3F2, 0xE3F3, 0xE3F4,
+    0xE3F5, 0xE3F6, 0xE3F7, 0xE3F8, 0xE3F9, 0xE3FA, 0xE3FB, 0xE3FC, 0xE3FD, 0xE3FE, 0xE3FF, 0xE400, 0xE401, 0xE402, 0xE403, 0xE404,
+    0xE405, 0xE406, 0xE407, 0xE408, 0xE409, 0xE40A, 0xE40B, 0xE40C, 0xE40D, 0xE40E, 0xE40F, 0xE410, 0xE411, 0xE412, 0xE413, 0xE414,
+    0xE415, 0xE416, 0xE417, 0xE418, 0xE419, 0xE41A, 0xE41B, 0xE41C, 0xE41D, 0xE41E, 0xE41F, 0xE420, 0xE421, 0xE422, 0xE423, 0xE424,
+    0xE425, 0xE426, 0xE427, 0xE428, 0xE429, 0xE42A, 0xE42B, 0xE42C, 0xE42D, 0xE42E, 0xE42F, 0xE430, 0xE431, 0xE432, 0xE433, 0xE434,
+    0xE435, 0xE436, 0xE437, 0xE438, 0xE439, 0xE43A, 0xE43B, 0xE43C, 0xE43D, 0xE43E, 0xE43F, 0xE440, 0xE441, 0xE442, 0xE443, 0xE444,
+    0xE445, 0xE446, 0xE447, 0xE448, 0xE449, 0xE44A, 0xE44B, 0xE44C, 0xE44D, 0xE44E, 0xE44F, 0xE450, 0xE451, 0xE452, 0xE453, 0xE454,
+    0xE455, 0xE456, 0xE457, 0xE458, 0xE459, 0xE45A, 0xE45B, 0xE45C, 0xE45D, 0xE45E, 0xE45F, 0xE460, 0xE461, 0xE462, 0xE463, 0xE464,
+    0xE465, 0xE466, 0xE467, 0xE468, 0xE469, 0xE46A, 0xE46B, 0xE46C, 0xE46D, 0xE46E, 0xE46F, 0xE470, 0xE471, 0xE472, 0xE473, 0xFFFF,
+  },
+  { /* lead 0x6F */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE474, 0xE475, 0xE476, 0xE477, 0xE478, 0xE479, 0xE47A, 0xE47B, 0xE47C, 0xE47D, 0xE47E, 0xE47F, 0xE480, 0xE481, 0xE482,
+    0xE483, 0xE484, 0xE485, 0xE486, 0xE487, 0xE488, 0xE489, 0xE48A, 0xE48B, 0xE48C, 0xE48D, 0xE48E, 0xE48F, 0xE490, 0xE491, 0xE492,
+    0xE493, 0xE494, 0xE495, 0xE496, 0xE497, 0xE498, 0xE499, 0xE49A, 0xE49B, 0xE49C, 0xE49D, 0xE49E, 0xE49F, 0xE4A0, 0xE4A1, 0xE4A2,
+    0xE4A3, 0xE4A4, 0xE4A5, 0xE4A6, 0xE4A7, 0xE4A8, 0xE4A9, 0xE4AA, 0xE4AB, 0xE4AC, 0xE4AD, 0xE4AE, 0xE4AF, 0xE4B0, 0xE4B1, 0xE4B2,
+    0xE4B3, 0xE4B4, 0xE4B5, 0xE4B6, 0xE4B7, 0xE4B8, 0xE4B9, 0xE4BA, 0xE4BB, 0xE4BC, 0xE4BD, 0xE4BE, 0xE4BF, 0xE4C0, 0xE4C1, 0xE4C2,
+    0xE4C3, 0xE4C4, 0xE4C5, 0xE4C6, 0xE4C7, 0xE4C8, 0xE4C9, 0xE4CA, 0xE4CB, 0xE4CC, 0xE4CD, 0xE4CE, 0xE4CF, 0xE4D0, 0xE4D1, 0xE4D2,
+    0xE4D3, 0xE4D4, 0xE4D5, 0xE4D6, 0xE4D7, 0xE4D8, 0xE4D9, 0xE4DA, 0xE4DB, 0xE4DC, 0xE4DD, 0xE4DE, 0xE4DF, 0xE4E0, 0xE4E1, 0xE4E2,
+    0xE4E3, 0xE4E4, 0xE4E5, 0xE4E6, 0xE4E7, 0xE4E8, 0xE4E9, 0xE4EA, 0xE4EB, 0xE4EC, 0xE4ED, 0xE4EE, 0xE4EF, 0xE4F0, 0xE4F1, 0xE4F2,
+    0xE4F3, 0xE4F4, 0xE4F5, 0xE4F6, 0xE4F7, 0xE4F8, 0xE4F9, 0xE4FA, 0xE4FB, 0xE4FC, 0xE4FD, 0xE4FE, 0xE4FF, 0xE500, 0xE501, 0xE502,
+    0xE503, 0xE504, 0xE505, 0xE506, 0xE507, 0xE508, 0xE509, 0xE50A, 0xE50B, 0xE50C, 0xE50D, 0xE50E, 0xE50F, 0xE510, 0xE511, 0xE512,
+    0xE513, 0xE514, 0xE515, 0xE516, 0xE517, 0xE518, 0xE519, 0xE51A, 0xE51B, 0xE51C, 0xE51D, 0xE51E, 0xE51F, 0xE520, 0xE521, 0xE522,
+    0xE523, 0xE524, 0xE525, 0xE526, 0xE527, 0xE528, 0xE529, 0xE52A, 0xE52B, 0xE52C, 0xE52D, 0xE52E, 0xE52F, 0xE530, 0xE531, 0xFFFF,
+  },
+  { /* lead 0x70 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE532, 0xE533, 0xE534, 0xE535, 0xE536, 0xE537, 0xE538, 0xE539, 0xE53A, 0xE53B, 0xE53C, 0xE53D, 0xE53E, 0xE53F, 0xE540,
+    0xE541, 0xE542, 0xE543, 0xE544, 0xE545, 0xE546, 0xE547, 0xE548, 0xE549, 0xE54A, 0xE54B, 0xE54C, 0xE54D, 0xE54E, 0xE54F, 0xE550,
+    0xE551, 0xE552, 0xE553, 0xE554, 0xE555, 0xE556, 0xE557, 0xE558, 0xE559, 0xE55A, 0xE55B, 0xE55C, 0xE55D, 0xE55E, 0xE55F, 0xE560,
+    0xE561, 0xE562, 0xE563, 0xE564, 0xE565, 0xE566, 0xE567, 0xE568, 0xE569, 0xE56A, 0xE56B, 0xE56C, 0xE56D, 0xE56E, 0xE56F, 0xE570,
+    0xE571, 0xE572, 0xE573, 0xE574, 0xE575, 0xE576, 0xE577, 0xE578, 0xE579, 0xE57A, 0xE57B, 0xE57C, 0xE57D, 0xE57E, 0xE57F, 0xE580,
+    0xE581, 0xE582, 0xE583, 0xE584, 0xE585, 0xE586, 0xE587, 0xE588, 0xE589, 0xE58A, 0xE58B, 0xE58C, 0xE58D, 0xE58E, 0xE58F, 0xE590,
+    0xE591, 0xE592, 0xE593, 0xE594, 0xE595, 0xE596, 0xE597, 0xE598, 0xE599, 0xE59A, 0xE59B, 0xE59C, 0xE59D, 0xE59E, 0xE59F, 0xE5A0,
+    0xE5A1, 0xE5A2, 0xE5A3, 0xE5A4, 0xE5A5, 0xE5A6, 0xE5A7, 0xE5A8, 0xE5A9, 0xE5AA, 0xE5AB, 0xE5AC, 0xE5AD, 0xE5AE, 0xE5AF, 0xE5B0,
+    0xE5B1, 0xE5B2, 0xE5B3, 0xE5B4, 0xE5B5, 0xE5B6, 0xE5B7, 0xE5B8, 0xE5B9, 0xE5BA, 0xE5BB, 0xE5BC, 0xE5BD, 0xE5BE, 0xE5BF, 0xE5C0,
+    0xE5C1, 0xE5C2, 0xE5C3, 0xE5C4, 0xE5C5, 0xE5C6, 0xE5C7, 0xE5C8, 0xE5C9, 0xE5CA, 0xE5CB, 0xE5CC, 0xE5CD, 0xE5CE, 0xE5CF, 0xE5D0,
+    0xE5D1, 0xE5D2, 0xE5D3, 0xE5D4, 0xE5D5, 0xE5D6, 0xE5D7, 0xE5D8, 0xE5D9, 0xE5DA, 0xE5DB, 0xE5DC, 0xE5DD, 0xE5DE, 0xE5DF, 0xE5E0,
+    0xE5E1, 0xE5E2, 0xE5E3, 0xE5E4, 0xE5E5, 0xE5E6, 0xE5E7, 0xE5E8, 0xE5E9, 0xE5EA, 0xE5EB, 0xE5EC, 0xE5ED, 0xE5EE, 0xE5EF, 0xFFFF,
+  },
+  { /* lead 0x71 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE5F0, 0xE5F1, 0xE5F2, 0xE5F3, 0xE5F4, 0xE5F5, 0xE5F6, 0xE5F7, 0xE5F8, 0xE5F9, 0xE5FA, 0xE5FB, 0xE5FC, 0xE5FD, 0xE5FE,
+    0xE5FF, 0xE600, 0xE601, 0xE602, 0xE603, 0xE604, 0xE605, 0xE606, 0xE607, 0xE608, 0xE609, 0xE60A, 0xE60B, 0xE60C, 0xE60D, 0xE60E,
+    0xE60F, 0xE610, 0xE611, 0xE612, 0xE613, 0xE614, 0xE615, 0xE616, 0xE617, 0xE618, 0xE619, 0xE61A, 0xE61B, 0xE61C, 0xE61D, 0xE61E,
+    0xE61F, 0xE620, 0xE621, 0xE622, 0xE623, 0xE624, 0xE625, 0xE626, 0xE627, 0xE628, 0xE629, 0xE62A, 0xE62B, 0xE62C, 0xE62D, 0xE62E,
+    0xE62F, 0xE630, 0xE631, 0xE632, 0xE633, 0xE634, 0xE635, 0xE636, 0xE637, 0xE638, 0xE639, 0xE63A, 0xE63B, 0xE63C, 0xE63D, 0xE63E,
+    0xE63F, 0xE640, 0xE641, 0xE642, 0xE643, 0xE644, 0xE645, 0xE646, 0xE647, 0xE648, 0xE649, 0xE64A, 0xE64B, 0xE64C, 0xE64D, 0xE64E,
+    0xE64F, 0xE650, 0xE651, 0xE652, 0xE653, 0xE654, 0xE655, 0xE656, 0xE657, 0xE658, 0xE659, 0xE65A, 0xE65B, 0xE65C, 0xE65D, 0xE65E,
+    0xE65F, 0xE660, 0xE661, 0xE662, 0xE663, 0xE664, 0xE665, 0xE666, 0xE667, 0xE668, 0xE669, 0xE66A, 0xE66B, 0xE66C, 0xE66D, 0xE66E,
+    0xE66F, 0xE670, 0xE671, 0xE672, 0xE673, 0xE674, 0xE675, 0xE676, 0xE677, 0xE678, 0xE679, 0xE67A, 0xE67B, 0xE67C, 0xE67D, 0xE67E,
+    0xE67F, 0xE680, 0xE681, 0xE682, 0xE683, 0xE684, 0xE685, 0xE686, 0xE687, 0xE688, 0xE689, 0xE68A, 0xE68B, 0xE68C, 0xE68D, 0xE68E,
+    0xE68F, 0xE690, 0xE691, 0xE692, 0xE693, 0xE694, 0xE695, 0xE696, 0xE697, 0xE698, 0xE699, 0xE69A, 0xE69B, 0xE69C, 0xE69D, 0xE69E,
+    0xE69F, 0xE6A0, 0xE6A1, 0xE6A2, 0xE6A3, 0xE6A4, 0xE6A5, 0xE6A6, 0xE6A7, 0xE6A8, 0xE6A9, 0xE6AA, 0xE6AB, 0xE6AC, 0xE6AD, 0xFFFF,
+  },
+  { /* lead 0x72 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE6AE, 0xE6AF, 0xE6B0, 0xE6B1, 0xE6B2, 0xE6B3, 0xE6B4, 0xE6B5, 0xE6B6, 0xE6B7, 0xE6B8, 0xE6B9, 0xE6BA, 0xE6BB, 0xE6BC,
+    0xE6BD, 0xE6BE, 0xE6BF, 0xE6C0, 0xE6C1, 0xE6C2, 0xE6C3, 0xE6C4, 0xE6C5, 0xE6C6, 0xE6C7, 0xE6C8, 0xE6C9, 0xE6CA, 0xE6CB, 0xE6CC,
+    0xE6CD, 0xE6CE, 0xE6CF, 0xE6D0, 0xE6D1, 0xE6D2, 0xE6D3, 0xE6D4, 0xE6D5, 0xE6D6, 0xE6D7, 0xE6D8, 0xE6D9, 0xE6DA, 0xE6DB, 0xE6DC,
+    0xE6DD, 0xE6DE, 0xE6DF, 0xE6E0, 0xE6E1, 0xE6E2, 0xE6E3, 0xE6E4, 0xE6E5, 0xE6E6, 0xE6E7, 0xE6E8, 0xE6E9, 0xE6EA, 0xE6EB, 0xE6EC,
+    0xE6ED, 0xE6EE, 0xE6EF, 0xE6F0, 0xE6F1, 0xE6F2, 0xE6F3, 0xE6F4, 0xE6F5, 0xE6F6, 0xE6F7, 0xE6F8, 0xE6F9, 0xE6FA, 0xE6FB, 0xE6FC,
+    0xE6FD, 0xE6FE, 0xE6FF, 0xE700, 0xE701, 0xE702, 0xE703, 0xE704, 0xE705, 0xE706, 0xE707, 0xE708, 0xE709, 0xE70A, 0xE70B, 0xE70C,
+    0xE70D, 0xE70E, 0xE70F, 0xE710, 0xE711, 0xE712, 0xE713, 0xE714, 0xE715, 0xE716, 0xE717, 0xE718, 0xE719, 0xE71A, 0xE71B, 0xE71C,
+    0xE71D, 0xE71E, 0xE71F, 0xE720, 0xE721, 0xE722, 0xE723, 0xE724, 0xE725, 0xE726, 0xE727, 0xE728, 0xE729, 0xE72A, 0xE72B, 0xE72C,
+    0xE72D, 0xE72E, 0xE72F, 0xE730, 0xE731, 0xE732, 0xE733, 0xE734, 0xE735, 0xE736, 0xE737, 0xE738, 0xE739, 0xE73A, 0xE73B, 0xE73C,
+    0xE73D, 0xE73E, 0xE73F, 0xE740, 0xE741, 0xE742, 0xE743, 0xE744, 0xE745, 0xE746, 0xE747, 0xE748, 0xE749, 0xE74A, 0xE74B, 0xE74C,
+    0xE74D, 0xE74E, 0xE74F, 0xE750, 0xE751, 0xE752, 0xE753, 0xE754, 0xE755, 0xE756, 0xE757, 0xE758, 0xE759, 0xE75A, 0xE75B, 0xE75C,
+    0xE75D, 0xE75E, 0xE75F, 0xE760, 0xE761, 0xE762, 0xE763, 0xE764, 0xE765, 0xE766, 0xE767, 0xE768, 0xE769, 0xE76A, 0xE76B, 0xFFFF,
+  },
+  { /* lead 0x73 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE76C, 0xE76D, 0xE76E, 0xE76F, 0xE770, 0xE771, 0xE772, 0xE773, 0xE774, 0xE775, 0xE776, 0xE777, 0xE778, 0xE779, 0xE77A,
+    0xE77B, 0xE77C, 0xE77D, 0xE77E, 0xE77F, 0xE780, 0xE781, 0xE782, 0xE783, 0xE784, 0xE785, 0xE786, 0xE787, 0xE788, 0xE789, 0xE78A,
+    0xE78B, 0xE78C, 0xE78D, 0xE78E, 0xE78F, 0xE790, 0xE791, 0xE792, 0xE793, 0xE794, 0xE795, 0xE796, 0xE797, 0xE798, 0xE799, 0xE79A,
+    0xE79B, 0xE79C, 0xE79D, 0xE79E, 0xE79F, 0xE7A0, 0xE7A1, 0xE7A2, 0xE7A3, 0xE7A4, 0xE7A5, 0xE7A6, 0xE7A7, 0xE7A8, 0xE7A9, 0xE7AA,
+    0xE7AB, 0xE7AC, 0xE7AD, 0xE7AE, 0xE7AF, 0xE7B0, 0xE7B1, 0xE7B2, 0xE7B3, 0xE7B4, 0xE7B5, 0xE7B6, 0xE7B7, 0xE7B8, 0xE7B9, 0xE7BA,
+    0xE7BB, 0xE7BC, 0xE7BD, 0xE7BE, 0xE7BF, 0xE7C0, 0xE7C1, 0xE7C2, 0xE7C3, 0xE7C4, 0xE7C5, 0xE7C6, 0xE7C7, 0xE7C8, 0xE7C9, 0xE7CA,
+    0xE7CB, 0xE7CC, 0xE7CD, 0xE7CE, 0xE7CF, 0xE7D0, 0xE7D1, 0xE7D2, 0xE7D3, 0xE7D4, 0xE7D5, 0xE7D6, 0xE7D7, 0xE7D8, 0xE7D9, 0xE7DA,
+    0xE7DB, 0xE7DC, 0xE7DD, 0xE7DE, 0xE7DF, 0xE7E0, 0xE7E1, 0xE7E2, 0xE7E3, 0xE7E4, 0xE7E5, 0xE7E6, 0xE7E7, 0xE7E8, 0xE7E9, 0xE7EA,
+    0xE7EB, 0xE7EC, 0xE7ED, 0xE7EE, 0xE7EF, 0xE7F0, 0xE7F1, 0xE7F2, 0xE7F3, 0xE7F4, 0xE7F5, 0xE7F6, 0xE7F7, 0xE7F8, 0xE7F9, 0xE7FA,
+    0xE7FB, 0xE7FC, 0xE7FD, 0xE7FE, 0xE7FF, 0xE800, 0xE801, 0xE802, 0xE803, 0xE804, 0xE805, 0xE806, 0xE807, 0xE808, 0xE809, 0xE80A,
+    0xE80B, 0xE80C, 0xE80D, 0xE80E, 0xE80F, 0xE810, 0xE811, 0xE812, 0xE813, 0xE814, 0xE815, 0xE816, 0xE817, 0xE818, 0xE819, 0xE81A,
+    0xE81B, 0xE81C, 0xE81D, 0xE81E, 0xE81F, 0xE820, 0xE821, 0xE822, 0xE823, 0xE824, 0xE825, 0xE826, 0xE827, 0xE828, 0xE829, 0xFFFF,
+  },
+  { /* lead 0x74 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE82A, 0xE82B, 0xE82C, 0xE82D, 0xE82E, 0xE82F, 0xE830, 0xE831, 0xE832, 0xE833, 0xE834, 0xE835, 0xE836, 0xE837, 0xE838,
+    0xE839, 0xE83A, 0xE83B, 0xE83C, 0xE83D, 0xE83E, 0xE83F, 0xE840, 0xE841, 0xE842, 0xE843, 0xE844, 0xE845, 0xE846, 0xE847, 0xE848,
+    0xE849, 0xE84A, 0xE84B, 0xE84C, 0xE84D, 0xE84E, 0xE84F, 0xE850, 0xE851, 0xE852, 0xE853, 0xE854, 0xE855, 0xE856, 0xE857, 0xE858,
+    0xE859, 0xE85A, 0xE85B, 0xE85C, 0xE85D, 0xE85E, 0xE85F, 0xE860, 0xE861, 0xE862, 0xE863, 0xE864, 0xE865, 0xE866, 0xE867, 0xE868,
+    0xE869, 0xE86A, 0xE86B, 0xE86C, 0xE86D, 0xE86E, 0xE86F, 0xE870, 0xE871, 0xE872, 0xE873, 0xE874, 0xE875, 0xE876, 0xE877, 0xE878,
+    0xE879, 0xE87A, 0xE87B, 0xE87C, 0xE87D, 0xE87E, 0xE87F, 0xE880, 0xE881, 0xE882, 0xE883, 0xE884, 0xE885, 0xE886, 0xE887, 0xE888,
+    0xE889, 0xE88A, 0xE88B, 0xE88C, 0xE88D, 0xE88E, 0xE88F, 0xE890, 0xE891, 0xE892, 0xE893, 0xE894, 0xE895, 0xE896, 0xE897, 0xE898,
+    0xE899, 0xE89A, 0xE89B, 0xE89C, 0xE89D, 0xE89E, 0xE89F, 0xE8A0, 0xE8A1, 0xE8A2, 0xE8A3, 0xE8A4, 0xE8A5, 0xE8A6, 0xE8A7, 0xE8A8,
+    0xE8A9, 0xE8AA, 0xE8AB, 0xE8AC, 0xE8AD, 0xE8AE, 0xE8AF, 0xE8B0, 0xE8B1, 0xE8B2, 0xE8B3, 0xE8B4, 0xE8B5, 0xE8B6, 0xE8B7, 0xE8B8,
+    0xE8B9, 0xE8BA, 0xE8BB, 0xE8BC, 0xE8BD, 0xE8BE, 0xE8BF, 0xE8C0, 0xE8C1, 0xE8C2, 0xE8C3, 0xE8C4, 0xE8C5, 0xE8C6, 0xE8C7, 0xE8C8,
+    0xE8C9, 0xE8CA, 0xE8CB, 0xE8CC, 0xE8CD, 0xE8CE, 0xE8CF, 0xE8D0, 0xE8D1, 0xE8D2, 0xE8D3, 0xE8D4, 0xE8D5, 0xE8D6, 0xE8D7, 0xE8D8,
+    0xE8D9, 0xE8DA, 0xE8DB, 0xE8DC, 0xE8DD, 0xE8DE, 0xE8DF, 0xE8E0, 0xE8E1, 0xE8E2, 0xE8E3, 0xE8E4, 0xE8E5, 0xE8E6, 0xE8E7, 0xFFFF,
+  },
+  { /* lead 0x75 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE8E8, 0xE8E9, 0xE8EA, 0xE8EB, 0xE8EC, 0xE8ED, 0xE8EE, 0xE8EF, 0xE8F0, 0xE8F1, 0xE8F2, 0xE8F3, 0xE8F4, 0xE8F5, 0xE8F6,
+    0xE8F7, 0xE8F8, 0xE8F9, 0xE8FA, 0xE8FB, 0xE8FC, 0xE8FD, 0xE8FE, 0xE8FF, 0xE900, 0xE901, 0xE902, 0xE903, 0xE904, 0xE905, 0xE906,
+    0xE907, 0xE908, 0xE909, 0xE90A, 0xE90B, 0xE90C, 0xE90D, 0xE90E, 0xE90F, 0xE910, 0xE911, 0xE912, 0xE913, 0xE914, 0xE915, 0xE916,
+    0xE917, 0xE918, 0xE919, 0xE91A, 0xE91B, 0xE91C, 0xE91D, 0xE91E, 0xE91F, 0xE920, 0xE921, 0xE922, 0xE923, 0xE924, 0xE925, 0xE926,
+    0xE927, 0xE928, 0xE929, 0xE92A, 0xE92B, 0xE92C, 0xE92D, 0xE92E, 0xE92F, 0xE930, 0xE931, 0xE932, 0xE933, 0xE934, 0xE935, 0xE936,
+    0xE937, 0xE938, 0xE939, 0xE93A, 0xE93B, 0xE93C, 0xE93D, 0xE93E, 0xE93F, 0xE940, 0xE941, 0xE942, 0xE943, 0xE944, 0xE945, 0xE946,
+    0xE947, 0xE948, 0xE949, 0xE94A, 0xE94B, 0xE94C, 0xE94D, 0xE94E, 0xE94F, 0xE950, 0xE951, 0xE952, 0xE953, 0xE954, 0xE955, 0xE956,
+    0xE957, 0xE958, 0xE959, 0xE95A, 0xE95B, 0xE95C, 0xE95D, 0xE95E, 0xE95F, 0xE960, 0xE961, 0xE962, 0xE963, 0xE964, 0xE965, 0xE966,
+    0xE967, 0xE968, 0xE969, 0xE96A, 0xE96B, 0xE96C, 0xE96D, 0xE96E, 0xE96F, 0xE970, 0xE971, 0xE972, 0xE973, 0xE974, 0xE975, 0xE976,
+    0xE977, 0xE978, 0xE979, 0xE97A, 0xE97B, 0xE97C, 0xE97D, 0xE97E, 0xE97F, 0xE980, 0xE981, 0xE982, 0xE983, 0xE984, 0xE985, 0xE986,
+    0xE987, 0xE988, 0xE989, 0xE98A, 0xE98B, 0xE98C, 0xE98D, 0xE98E, 0xE98F, 0xE990, 0xE991, 0xE992, 0xE993, 0xE994, 0xE995, 0xE996,
+    0xE997, 0xE998, 0xE999, 0xE99A, 0xE99B, 0xE99C, 0xE99D, 0xE99E, 0xE99F, 0xE9A0, 0xE9A1, 0xE9A2, 0xE9A3, 0xE9A4, 0xE9A5, 0xFFFF,
+  },
+  { /* lead 0x76 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE9A6, 0xE9A7, 0xE9A8, 0xE9A9, 0xE9AA, 0xE9AB, 0xE9AC, 0xE9AD, 0xE9AE, 0xE9AF, 0xE9B0, 0xE9B1, 0xE9B2, 0xE9B3, 0xE9B4,
+    0xE9B5, 0xE9B6, 0xE9B7, 0xE9B8, 0xE9B9, 0xE9BA, 0xE9BB, 0xE9BC, 0xE9BD, 0xE9BE, 0xE9BF, 0xE9C0, 0xE9C1, 0xE9C2, 0xE9C3, 0xE9C4,
+    0xE9C5, 0xE9C6, 0xE9C7, 0xE9C8, 0xE9C9, 0xE9CA, 0xE9CB, 0xE9CC, 0xE9CD, 0xE9CE, 0xE9CF, 0xE9D0, 0xE9D1, 0xE9D2, 0xE9D3, 0xE9D4,
+    0xE9D5, 0xE9D6, 0xE9D7, 0xE9D8, 0xE9D9, 0xE9DA, 0xE9DB, 0xE9DC, 0xE9DD, 0xE9DE, 0xE9DF, 0xE9E0, 0xE9E1, 0xE9E2, 0xE9E3, 0xE9E4,
+    0xE9E5, 0xE9E6, 0xE9E7, 0xE9E8, 0xE9E9, 0xE9EA, 0xE9EB, 0xE9EC, 0xE9ED, 0xE9EE, 0xE9EF, 0xE9F0, 0xE9F1, 0xE9F2, 0xE9F3, 0xE9F4,
+    0xE9F5, 0xE9F6, 0xE9F7, 0xE9F8, 0xE9F9, 0xE9FA, 0xE9FB, 0xE9FC, 0xE9FD, 0xE9FE, 0xE9FF, 0xEA00, 0xEA01, 0xEA02, 0xEA03, 0xEA04,
+    0xEA05, 0xEA06, 0xEA07, 0xEA08, 0xEA09, 0xEA0A, 0xEA0B, 0xEA0C, 0xEA0D, 0xEA0E, 0xEA0F, 0xEA10, 0xEA11, 0xEA12, 0xEA13, 0xEA14,
+    0xEA15, 0xEA16, 0xEA17, 0xEA18, 0xEA19, 0xEA1A, 0xEA1B, 0xEA1C, 0xEA1D, 0xEA1E, 0xEA1F, 0xEA20, 0xEA21, 0xEA22, 0xEA23, 0xEA24,
+    0xEA25, 0xEA26, 0xEA27, 0xEA28, 0xEA29, 0xEA2A, 0xEA2B, 0xEA2C, 0xEA2D, 0xEA2E, 0xEA2F, 0xEA30, 0xEA31, 0xEA32, 0xEA33, 0xEA34,
+    0xEA35, 0xEA36, 0xEA37, 0xEA38, 0xEA39, 0xEA3A, 0xEA3B, 0xEA3C, 0xEA3D, 0xEA3E, 0xEA3F, 0xEA40, 0xEA41, 0xEA42, 0xEA43, 0xEA44,
+    0xEA45, 0xEA46, 0xEA47, 0xEA48, 0xEA49, 0xEA4A, 0xEA4B, 0xEA4C, 0xEA4D, 0xEA4E, 0xEA4F, 0xEA50, 0xEA51, 0xEA52, 0xEA53, 0xEA54,
+    0xEA55, 0xEA56, 0xEA57, 0xEA58, 0xEA59, 0xEA5A, 0xEA5B, 0xEA5C, 0xEA5D, 0xEA5E, 0xEA5F, 0xEA60, 0xEA61, 0xEA62, 0xEA63, 0xFFFF,
+  },
+  { /* lead 0x77 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEA64, 0xEA65, 0xEA66, 0xEA67, 0xEA68, 0xEA69, 0xEA6A, 0xEA6B, 0xEA6C, 0xEA6D, 0xEA6E, 0xEA6F, 0xEA70, 0xEA71, 0xEA72,
+    0xEA73, 0xEA74, 0xEA75, 0xEA76, 0xEA77, 0xEA78, 0xEA79, 0xEA7A, 0xEA7B, 0xEA7C, 0xEA7D, 0xEA7E, 0xEA7F, 0xEA80, 0xEA81, 0xEA82,
+    0xEA83, 0xEA84, 0xEA85, 0xEA86, 0xEA87, 0xEA88, 0xEA89, 0xEA8A, 0xEA8B, 0xEA8C, 0xEA8D, 0xEA8E, 0xEA8F, 0xEA90, 0xEA91, 0xEA92,
+    0xEA93, 0xEA94, 0xEA95, 0xEA96, 0xEA97, 0xEA98, 0xEA99, 0xEA9A, 0xEA9B, 0xEA9C, 0xEA9D, 0xEA9E, 0xEA9F, 0xEAA0, 0xEAA1, 0xEAA2,
+    0xEAA3, 0xEAA4, 0xEAA5, 0xEAA6, 0xEAA7, 0xEAA8, 0xEAA9, 0xEAAA, 0xEAAB, 0xEAAC, 0xEAAD, 0xEAAE, 0xEAAF, 0xEAB0, 0xEAB1, 0xEAB2,
+    0xEAB3, 0xEAB4, 0xEAB5, 0xEAB6, 0xEAB7, 0xEAB8, 0xEAB9, 0xEABA, 0xEABB, 0xEABC, 0xEABD, 0xEABE, 0xEABF, 0xEAC0, 0xEAC1, 0xEAC2,
+    0xEAC3, 0xEAC4, 0xEAC5, 0xEAC6, 0xEAC7, 0xEAC8, 0xEAC9, 0xEACA, 0xEACB, 0xEACC, 0xEACD, 0xEACE, 0xEACF, 0xEAD0, 0xEAD1, 0xEAD2,
+    0xEAD3, 0xEAD4, 0xEAD5, 0xEAD6, 0xEAD7, 0xEAD8, 0xEAD9, 0xEADA, 0xEADB, 0xEADC, 0xEADD, 0xEADE, 0xEADF, 0xEAE0, 0xEAE1, 0xEAE2,
+    0xEAE3, 0xEAE4, 0xEAE5, 0xEAE6, 0xEAE7, 0xEAE8, 0xEAE9, 0xEAEA, 0xEAEB, 0xEAEC, 0xEAED, 0xEAEE, 0xEAEF, 0xEAF0, 0xEAF1, 0xEAF2,
+    0xEAF3, 0xEAF4, 0xEAF5, 0xEAF6, 0xEAF7, 0xEAF8, 0xEAF9, 0xEAFA, 0xEAFB, 0xEAFC, 0xEAFD, 0xEAFE, 0xEAFF, 0xEB00, 0xEB01, 0xEB02,
+    0xEB03, 0xEB04, 0xEB05, 0xEB06, 0xEB07, 0xEB08, 0xEB09, 0xEB0A, 0xEB0B, 0xEB0C, 0xEB0D, 0xEB0E, 0xEB0F, 0xEB10, 0xEB11, 0xEB12,
+    0xEB13, 0xEB14, 0xEB15, 0xEB16, 0xEB17, 0xEB18, 0xEB19, 0xEB1A, 0xEB1B, 0xEB1C, 0xEB1D, 0xEB1E, 0xEB1F, 0xEB20, 0xEB21, 0xFFFF,
+  },
+  { /* lead 0x78 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEB22, 0xEB23, 0xEB24, 0xEB25, 0xEB26, 0xEB27, 0xEB28, 0xEB29, 0xEB2A, 0xEB2B, 0xEB2C, 0xEB2D, 0xEB2E, 0xEB2F, 0xEB30,
+    0xEB31, 0xEB32, 0xEB33, 0xEB34, 0xEB35, 0xEB36, 0xEB37, 0xEB38, 0xEB39, 0xEB3A, 0xEB3B, 0xEB3C, 0xEB3D, 0xEB3E, 0xEB3F, 0xEB40,
+    0xEB41, 0xEB42, 0xEB43, 0xEB44, 0xEB45, 0xEB46, 0xEB47, 0xEB48, 0xEB49, 0xEB4A, 0xEB4B, 0xEB4C, 0xEB4D, 0xEB4E, 0xEB4F, 0xEB50,
+    0xEB51, 0xEB52, 0xEB53, 0xEB54, 0xEB55, 0xEB56, 0xEB57, 0xEB58, 0xEB59, 0xEB5A, 0xEB5B, 0xEB5C, 0xEB5D, 0xEB5E, 0xEB5F, 0xEB60,
+    0xEB61, 0xEB62, 0xEB63, 0xEB64, 0xEB65, 0xEB66, 0xEB67, 0xEB68, 0xEB69, 0xEB6A, 0xEB6B, 0xEB6C, 0xEB6D, 0xEB6E, 0xEB6F, 0xEB70,
+    0xEB71, 0xEB72, 0xEB73, 0xEB74, 0xEB75, 0xEB76, 0xEB77, 0xEB78, 0xEB79, 0xEB7A, 0xEB7B, 0xEB7C, 0xEB7D, 0xEB7E, 0xEB7F, 0xEB80,
+    0xEB81, 0xEB82, 0xEB83, 0xEB84, 0xEB85, 0xEB86, 0xEB87, 0xEB88, 0xEB89, 0xEB8A, 0xEB8B, 0xEB8C, 0xEB8D, 0xEB8E, 0xEB8F, 0xEB90,
+    0xEB91, 0xEB92, 0xEB93, 0xEB94, 0xEB95, 0xEB96, 0xEB97, 0xEB98, 0xEB99, 0xEB9A, 0xEB9B, 0xEB9C, 0xEB9D, 0xEB9E, 0xEB9F, 0xEBA0,
+    0xEBA1, 0xEBA2, 0xEBA3, 0xEBA4, 0xEBA5, 0xEBA6, 0xEBA7, 0xEBA8, 0xEBA9, 0xEBAA, 0xEBAB, 0xEBAC, 0xEBAD, 0xEBAE, 0xEBAF, 0xEBB0,
+    0xEBB1, 0xEBB2, 0xEBB3, 0xEBB4, 0xEBB5, 0xEBB6, 0xEBB7, 0xEBB8, 0xEBB9, 0xEBBA, 0xEBBB, 0xEBBC, 0xEBBD, 0xEBBE, 0xEBBF, 0xEBC0,
+    0xEBC1, 0xEBC2, 0xEBC3, 0xEBC4, 0xEBC5, 0xEBC6, 0xEBC7, 0xEBC8, 0xEBC9, 0xEBCA, 0xEBCB, 0xEBCC, 0xEBCD, 0xEBCE, 0xEBCF, 0xEBD0,
+    0xEBD1, 0xEBD2, 0xEBD3, 0xEBD4, 0xEBD5, 0xEBD6, 0xEBD7, 0xEBD8, 0xEBD9, 0xEBDA, 0xEBDB, 0xEBDC, 0xEBDD, 0xEBDE, 0xEBDF, 0xFFFF,
+  },
+  { /* lead 0x79 */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEBE0, 0xEBE1, 0xEBE2, 0xEBE3, 0xEBE4, 0xEBE5, 0xEBE6, 0xEBE7, 0xEBE8, 0xEBE9, 0xEBEA, 0xEBEB, 0xEBEC, 0xEBED, 0xEBEE,
+    0xEBEF, 0xEBF0, 0xEBF1, 0xEBF2, 0xEBF3, 0xEBF4, 0xEBF5, 0xEBF6, 0xEBF7, 0xEBF8, 0xEBF9, 0xEBFA, 0xEBFB, 0xEBFC, 0xEBFD, 0xEBFE,
+    0xEBFF, 0xEC00, 0xEC01, 0xEC02, 0xEC03, 0xEC04, 0xEC05, 0xEC06, 0xEC07, 0xEC08, 0xEC09, 0xEC0A, 0xEC0B, 0xEC0C, 0xEC0D, 0xEC0E,
+    0xEC0F, 0xEC10, 0xEC11, 0xEC12, 0xEC13, 0xEC14, 0xEC15, 0xEC16, 0xEC17, 0xEC18, 0xEC19, 0xEC1A, 0xEC1B, 0xEC1C, 0xEC1D, 0xEC1E,
+    0xEC1F, 0xEC20, 0xEC21, 0xEC22, 0xEC23, 0xEC24, 0xEC25, 0xEC26, 0xEC27, 0xEC28, 0xEC29, 0xEC2A, 0xEC2B, 0xEC2C, 0xEC2D, 0xEC2E,
+    0xEC2F, 0xEC30, 0xEC31, 0xEC32, 0xEC33, 0xEC34, 0xEC35, 0xEC36, 0xEC37, 0xEC38, 0xEC39, 0xEC3A, 0xEC3B, 0xEC3C, 0xEC3D, 0xEC3E,
+    0xEC3F, 0xEC40, 0xEC41, 0xEC42, 0xEC43, 0xEC44, 0xEC45, 0xEC46, 0xEC47, 0xEC48, 0xEC49, 0xEC4A, 0xEC4B, 0xEC4C, 0xEC4D, 0xEC4E,
+    0xEC4F, 0xEC50, 0xEC51, 0xEC52, 0xEC53, 0xEC54, 0xEC55, 0xEC56, 0xEC57, 0xEC58, 0xEC59, 0xEC5A, 0xEC5B, 0xEC5C, 0xEC5D, 0xEC5E,
+    0xEC5F, 0xEC60, 0xEC61, 0xEC62, 0xEC63, 0xEC64, 0xEC65, 0xEC66, 0xEC67, 0xEC68, 0xEC69, 0xEC6A, 0xEC6B, 0xEC6C, 0xEC6D, 0xEC6E,
+    0xEC6F, 0xEC70, 0xEC71, 0xEC72, 0xEC73, 0xEC74, 0xEC75, 0xEC76, 0xEC77, 0xEC78, 0xEC79, 0xEC7A, 0xEC7B, 0xEC7C, 0xEC7D, 0xEC7E,
+    0xEC7F, 0xEC80, 0xEC81, 0xEC82, 0xEC83, 0xEC84, 0xEC85, 0xEC86, 0xEC87, 0xEC88, 0xEC89, 0xEC8A, 0xEC8B, 0xEC8C, 0xEC8D, 0xEC8E,
+    0xEC8F, 0xEC90, 0xEC91, 0xEC92, 0xEC93, 0xEC94, 0xEC95, 0xEC96, 0xEC97, 0xEC98, 0xEC99, 0xEC9A, 0xEC9B, 0xEC9C, 0xEC9D, 0xFFFF,
+  },
+  { /* lead 0x7A */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEC9E, 0xEC9F, 0xECA0, 0xECA1, 0xECA2, 0xECA3, 0xECA4, 0xECA5, 0xECA6, 0xECA7, 0xECA8, 0xECA9, 0xECAA, 0xECAB, 0xECAC,
+    0xECAD, 0xECAE, 0xECAF, 0xECB0, 0xECB1, 0xECB2, 0xECB3, 0xECB4, 0xECB5, 0xECB6, 0xECB7, 0xECB8, 0xECB9, 0xECBA, 0xECBB, 0xECBC,
+    0xECBD, 0xECBE, 0xECBF, 0xECC0, 0xECC1, 0xECC2, 0xECC3, 0xECC4, 0xECC5, 0xECC6, 0xECC7, 0xECC8, 0xECC9, 0xECCA, 0xECCB, 0xECCC,
+    0xECCD, 0xECCE, 0xECCF, 0xECD0, 0xECD1, 0xECD2, 0xECD3, 0xECD4, 0xECD5, 0xECD6, 0xECD7, 0xECD8, 0xECD9, 0xECDA, 0xECDB, 0xECDC,
+    0xECDD, 0xECDE, 0xECDF, 0xECE0, 0xECE1, 0xECE2, 0xECE3, 0xECE4, 0xECE5, 0xECE6, 0xECE7, 0xECE8, 0xECE9, 0xECEA, 0xECEB, 0xECEC,
+    0xECED, 0xECEE, 0xECEF, 0xECF0, 0xECF1, 0xECF2, 0xECF3, 0xECF4, 0xECF5, 0xECF6, 0xECF7, 0xECF8, 0xECF9, 0xECFA, 0xECFB, 0xECFC,
+    0xECFD, 0xECFE, 0xECFF, 0xED00, 0xED01, 0xED02, 0xED03, 0xED04, 0xED05, 0xED06, 0xED07, 0xED08, 0xED09, 0xED0A, 0xED0B, 0xED0C,
+    0xED0D, 0xED0E, 0xED0F, 0xED10, 0xED11, 0xED12, 0xED13, 0xED14, 0xED15, 0xED16, 0xED17, 0xED18, 0xED19, 0xED1A, 0xED1B, 0xED1C,
+    0xED1D, 0xED1E, 0xED1F, 0xED20, 0xED21, 0xED22, 0xED23, 0xED24, 0xED25, 0xED26, 0xED27, 0xED28, 0xED29, 0xED2A, 0xED2B, 0xED2C,
+    0xED2D, 0xED2E, 0xED2F, 0xED30, 0xED31, 0xED32, 0xED33, 0xED34, 0xED35, 0xED36, 0xED37, 0xED38, 0xED39, 0xED3A, 0xED3B, 0xED3C,
+    0xED3D, 0xED3E, 0xED3F, 0xED40, 0xED41, 0xED42, 0xED43, 0xED44, 0xED45, 0xED46, 0xED47, 0xED48, 0xED49, 0xED4A, 0xED4B, 0xED4C,
+    0xED4D, 0xED4E, 0xED4F, 0xED50, 0xED51, 0xED52, 0xED53, 0xED54, 0xED55, 0xED56, 0xED57, 0xED58, 0xED59, 0xED5A, 0xED5B, 0xFFFF,
+  },
+  { /* lead 0x7B */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xED5C, 0xED5D, 0xED5E, 0xED5F, 0xED60, 0xED61, 0xED62, 0xED63, 0xED64, 0xED65, 0xED66, 0xED67, 0xED68, 0xED69, 0xED6A,
+    0xED6B, 0xED6C, 0xED6D, 0xED6E, 0xED6F, 0xED70, 0xED71, 0xED72, 0xED73, 0xED74, 0xED75, 0xED76, 0xED77, 0xED78, 0xED79, 0xED7A,
+    0xED7B, 0xED7C, 0xED7D, 0xED7E, 0xED7F, 0xED80, 0xED81, 0xED82, 0xED83, 0xED84, 0xED85, 0xED86, 0xED87, 0xED88, 0xED89, 0xED8A,
+    0xED8B, 0xED8C, 0xED8D, 0xED8E, 0xED8F, 0xED90, 0xED91, 0xED92, 0xED93, 0xED94, 0xED95, 0xED96, 0xED97, 0xED98, 0xED99, 0xED9A,
+    0xED9B, 0xED9C, 0xED9D, 0xED9E, 0xED9F, 0xEDA0, 0xEDA1, 0xEDA2, 0xEDA3, 0xEDA4, 0xEDA5, 0xEDA6, 0xEDA7, 0xEDA8, 0xEDA9, 0xEDAA,
+    0xEDAB, 0xEDAC, 0xEDAD, 0xEDAE, 0xEDAF, 0xEDB0, 0xEDB1, 0xEDB2, 0xEDB3, 0xEDB4, 0xEDB5, 0xEDB6, 0xEDB7, 0xEDB8, 0xEDB9, 0xEDBA,
+    0xEDBB, 0xEDBC, 0xEDBD, 0xEDBE, 0xEDBF, 0xEDC0, 0xEDC1, 0xEDC2, 0xEDC3, 0xEDC4, 0xEDC5, 0xEDC6, 0xEDC7, 0xEDC8, 0xEDC9, 0xEDCA,
+    0xEDCB, 0xEDCC, 0xEDCD, 0xEDCE, 0xEDCF, 0xEDD0, 0xEDD1, 0xEDD2, 0xEDD3, 0xEDD4, 0xEDD5, 0xEDD6, 0xEDD7, 0xEDD8, 0xEDD9, 0xEDDA,
+    0xEDDB, 0xEDDC, 0xEDDD, 0xEDDE, 0xEDDF, 0xEDE0, 0xEDE1, 0xEDE2, 0xEDE3, 0xEDE4, 0xEDE5, 0xEDE6, 0xEDE7, 0xEDE8, 0xEDE9, 0xEDEA,
+    0xEDEB, 0xEDEC, 0xEDED, 0xEDEE, 0xEDEF, 0xEDF0, 0xEDF1, 0xEDF2, 0xEDF3, 0xEDF4, 0xEDF5, 0xEDF6, 0xEDF7, 0xEDF8, 0xEDF9, 0xEDFA,
+    0xEDFB, 0xEDFC, 0xEDFD, 0xEDFE, 0xEDFF, 0xEE00, 0xEE01, 0xEE02, 0xEE03, 0xEE04, 0xEE05, 0xEE06, 0xEE07, 0xEE08, 0xEE09, 0xEE0A,
+    0xEE0B, 0xEE0C, 0xEE0D, 0xEE0E, 0xEE0F, 0xEE10, 0xEE11, 0xEE12, 0xEE13, 0xEE14, 0xEE15, 0xEE16, 0xEE17, 0xEE18, 0xEE19, 0xFFFF,
+  },
+  { /* lead 0x7C */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEE1A, 0xEE1B, 0xEE1C, 0xEE1D, 0xEE1E, 0xEE1F, 0xEE20, 0xEE21, 0xEE22, 0xEE23, 0xEE24, 0xEE25, 0xEE26, 0xEE27, 0xEE28,
+    0xEE29, 0xEE2A, 0xEE2B, 0xEE2C, 0xEE2D, 0xEE2E, 0xEE2F, 0xEE30, 0xEE31, 0xEE32, 0xEE33, 0xEE34, 0xEE35, 0xEE36, 0xEE37, 0xEE38,
+    0xEE39, 0xEE3A, 0xEE3B, 0xEE3C, 0xEE3D, 0xEE3E, 0xEE3F, 0xEE40, 0xEE41, 0xEE42, 0xEE43, 0xEE44, 0xEE45, 0xEE46, 0xEE47, 0xEE48,
+    0xEE49, 0xEE4A, 0xEE4B, 0xEE4C, 0xEE4D, 0xEE4E, 0xEE4F, 0xEE50, 0xEE51, 0xEE52, 0xEE53, 0xEE54, 0xEE55, 0xEE56, 0xEE57, 0xEE58,
+    0xEE59, 0xEE5A, 0xEE5B, 0xEE5C, 0xEE5D, 0xEE5E, 0xEE5F, 0xEE60, 0xEE61, 0xEE62, 0xEE63, 0xEE64, 0xEE65, 0xEE66, 0xEE67, 0xEE68,
+    0xEE69, 0xEE6A, 0xEE6B, 0xEE6C, 0xEE6D, 0xEE6E, 0xEE6F, 0xEE70, 0xEE71, 0xEE72, 0xEE73, 0xEE74, 0xEE75, 0xEE76, 0xEE77, 0xEE78,
+    0xEE79, 0xEE7A, 0xEE7B, 0xEE7C, 0xEE7D, 0xEE7E, 0xEE7F, 0xEE80, 0xEE81, 0xEE82, 0xEE83, 0xEE84, 0xEE85, 0xEE86, 0xEE87, 0xEE88,
+    0xEE89, 0xEE8A, 0xEE8B, 0xEE8C, 0xEE8D, 0xEE8E, 0xEE8F, 0xEE90, 0xEE91, 0xEE92, 0xEE93, 0xEE94, 0xEE95, 0xEE96, 0xEE97, 0xEE98,
+    0xEE99, 0xEE9A, 0xEE9B, 0xEE9C, 0xEE9D, 0xEE9E, 0xEE9F, 0xEEA0, 0xEEA1, 0xEEA2, 0xEEA3, 0xEEA4, 0xEEA5, 0xEEA6, 0xEEA7, 0xEEA8,
+    0xEEA9, 0xEEAA, 0xEEAB, 0xEEAC, 0xEEAD, 0xEEAE, 0xEEAF, 0xEEB0, 0xEEB1, 0xEEB2, 0xEEB3, 0xEEB4, 0xEEB5, 0xEEB6, 0xEEB7, 0xEEB8,
+    0xEEB9, 0xEEBA, 0xEEBB, 0xEEBC, 0xEEBD, 0xEEBE, 0xEEBF, 0xEEC0, 0xEEC1, 0xEEC2, 0xEEC3, 0xEEC4, 0xEEC5, 0xEEC6, 0xEEC7, 0xEEC8,
+    0xEEC9, 0xEECA, 0xEECB, 0xEECC, 0xEECD, 0xEECE, 0xEECF, 0xEED0, 0xEED1, 0xEED2, 0xEED3, 0xEED4, 0xEED5, 0xEED6, 0xEED7, 0xFFFF,
+  },
+  { /* lead 0x7D */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEED8, 0xEED9, 0xEEDA, 0xEEDB, 0xEEDC, 0xEEDD, 0xEEDE, 0xEEDF, 0xEEE0, 0xEEE1, 0xEEE2, 0xEEE3, 0xEEE4, 0xEEE5, 0xEEE6,
+    0xEEE7, 0xEEE8, 0xEEE9, 0xEEEA, 0xEEEB, 0xEEEC, 0xEEED, 0xEEEE, 0xEEEF, 0xEEF0, 0xEEF1, 0xEEF2, 0xEEF3, 0xEEF4, 0xEEF5, 0xEEF6,
+    0xEEF7, 0xEEF8, 0xEEF9, 0xEEFA, 0xEEFB, 0xEEFC, 0xEEFD, 0xEEFE, 0xEEFF, 0xEF00, 0xEF01, 0xEF02, 0xEF03, 0xEF04, 0xEF05, 0xEF06,
+    0xEF07, 0xEF08, 0xEF09, 0xEF0A, 0xEF0B, 0xEF0C, 0xEF0D, 0xEF0E, 0xEF0F, 0xEF10, 0xEF11, 0xEF12, 0xEF13, 0xEF14, 0xEF15, 0xEF16,
+    0xEF17, 0xEF18, 0xEF19, 0xEF1A, 0xEF1B, 0xEF1C, 0xEF1D, 0xEF1E, 0xEF1F, 0xEF20, 0xEF21, 0xEF22, 0xEF23, 0xEF24, 0xEF25, 0xEF26,
+    0xEF27, 0xEF28, 0xEF29, 0xEF2A, 0xEF2B, 0xEF2C, 0xEF2D, 0xEF2E, 0xEF2F, 0xEF30, 0xEF31, 0xEF32, 0xEF33, 0xEF34, 0xEF35, 0xEF36,
+    0xEF37, 0xEF38, 0xEF39, 0xEF3A, 0xEF3B, 0xEF3C, 0xEF3D, 0xEF3E, 0xEF3F, 0xEF40, 0xEF41, 0xEF42, 0xEF43, 0xEF44, 0xEF45, 0xEF46,
+    0xEF47, 0xEF48, 0xEF49, 0xEF4A, 0xEF4B, 0xEF4C, 0xEF4D, 0xEF4E, 0xEF4F, 0xEF50, 0xEF51, 0xEF52, 0xEF53, 0xEF54, 0xEF55, 0xEF56,
+    0xEF57, 0xEF58, 0xEF59, 0xEF5A, 0xEF5B, 0xEF5C, 0xEF5D, 0xEF5E, 0xEF5F, 0xEF60, 0xEF61, 0xEF62, 0xEF63, 0xEF64, 0xEF65, 0xEF66,
+    0xEF67, 0xEF68, 0xEF69, 0xEF6A, 0xEF6B, 0xEF6C, 0xEF6D, 0xEF6E, 0xEF6F, 0xEF70, 0xEF71, 0xEF72, 0xEF73, 0xEF74, 0xEF75, 0xEF76,
+    0xEF77, 0xEF78, 0xEF79, 0xEF7A, 0xEF7B, 0xEF7C, 0xEF7D, 0xEF7E, 0xEF7F, 0xEF80, 0xEF81, 0xEF82, 0xEF83, 0xEF84, 0xEF85, 0xEF86,
+    0xEF87, 0xEF88, 0xEF89, 0xEF8A, 0xEF8B, 0xEF8C, 0xEF8D, 0xEF8E, 0xEF8F, 0xEF90, 0xEF91, 0xEF92, 0xEF93, 0xEF94, 0xEF95, 0xFFFF,
+  },
+  { /* lead 0x7E */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEF96, 0xEF97, 0xEF98, 0xEF99, 0xEF9A, 0xEF9B, 0xEF9C, 0xEF9D, 0xEF9E, 0xEF9F, 0xEFA0, 0xEFA1, 0xEFA2, 0xEFA3, 0xEFA4,
+    0xEFA5, 0xEFA6, 0xEFA7, 0xEFA8, 0xEFA9, 0xEFAA, 0xEFAB, 0xEFAC, 0xEFAD, 0xEFAE, 0xEFAF, 0xEFB0, 0xEFB1, 0xEFB2, 0xEFB3, 0xEFB4,
+    0xEFB5, 0xEFB6, 0xEFB7, 0xEFB8, 0xEFB9, 0xEFBA, 0xEFBB, 0xEFBC, 0xEFBD, 0xEFBE, 0xEFBF, 0xEFC0, 0xEFC1, 0xEFC2, 0xEFC3, 0xEFC4,
+    0xEFC5, 0xEFC6, 0xEFC7, 0xEFC8, 0xEFC9, 0xEFCA, 0xEFCB, 0xEFCC, 0xEFCD, 0xEFCE, 0xEFCF, 0xEFD0, 0xEFD1, 0xEFD2, 0xEFD3, 0xEFD4,
+    0xEFD5, 0xEFD6, 0xEFD7, 0xEFD8, 0xEFD9, 0xEFDA, 0xEFDB, 0xEFDC, 0xEFDD, 0xEFDE, 0xEFDF, 0xEFE0, 0xEFE1, 0xEFE2, 0xEFE3, 0xEFE4,
+    0xEFE5, 0xEFE6, 0xEFE7, 0xEFE8, 0xEFE9, 0xEFEA, 0xEFEB, 0xEFEC, 0xEFED, 0xEFEE, 0xEFEF, 0xEFF0, 0xEFF1, 0xEFF2, 0xEFF3, 0xEFF4,
+    0xEFF5, 0xEFF6, 0xEFF7, 0xEFF8, 0xEFF9, 0xEFFA, 0xEFFB, 0xEFFC, 0xEFFD, 0xEFFE, 0xEFFF, 0xF000, 0xF001, 0xF002, 0xF003, 0xF004,
+    0xF005, 0xF006, 0xF007, 0xF008, 0xF009, 0xF00A, 0xF00B, 0xF00C, 0xF00D, 0xF00E, 0xF00F, 0xF010, 0xF011, 0xF012, 0xF013, 0xF014,
+    0xF015, 0xF016, 0xF017, 0xF018, 0xF019, 0xF01A, 0xF01B, 0xF01C, 0xF01D, 0xF01E, 0xF01F, 0xF020, 0xF021, 0xF022, 0xF023, 0xF024,
+    0xF025, 0xF026, 0xF027, 0xF028, 0xF029, 0xF02A, 0xF02B, 0xF02C, 0xF02D, 0xF02E, 0xF02F, 0xF030, 0xF031, 0xF032, 0xF033, 0xF034,
+    0xF035, 0xF036, 0xF037, 0xF038, 0xF039, 0xF03A, 0xF03B, 0xF03C, 0xF03D, 0xF03E, 0xF03F, 0xF040, 0xF041, 0xF042, 0xF043, 0xF044,
+    0xF045, 0xF046, 0xF047, 0xF048, 0xF049, 0xF04A, 0xF04B, 0xF04C, 0xF04D, 0xF04E, 0xF04F, 0xF050, 0xF051, 0xF052, 0xF053, 0xFFFF,
+  },
+  { /* lead 0x7F */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF054, 0xF055, 0xF056, 0xF057, 0xF058, 0xF059, 0xF05A, 0xF05B, 0xF05C, 0xF05D, 0xF05E, 0xF05F, 0xF060, 0xF061, 0xF062,
+    0xF063, 0xF064, 0xF065, 0xF066, 0xF067, 0xF068, 0xF069, 0xF06A, 0xF06B, 0xF06C, 0xF06D, 0xF06E, 0xF06F, 0xF070, 0xF071, 0xF072,
+    0xF073, 0xF074, 0xF075, 0xF076, 0xF077, 0xF078, 0xF079, 0xF07A, 0xF07B, 0xF07C, 0xF07D, 0xF07E, 0xF07F, 0xF080, 0xF081, 0xF082,
+    0xF083, 0xF084, 0xF085, 0xF086, 0xF087, 0xF088, 0xF089, 0xF08A, 0xF08B, 0xF08C, 0xF08D, 0xF08E, 0xF08F, 0xF090, 0xF091, 0xF092,
+    0xF093, 0xF094, 0xF095, 0xF096, 0xF097, 0xF098, 0xF099, 0xF09A, 0xF09B, 0xF09C, 0xF09D, 0xF09E, 0xF09F, 0xF0A0, 0xF0A1, 0xF0A2,
+    0xF0A3, 0xF0A4, 0xF0A5, 0xF0A6, 0xF0A7, 0xF0A8, 0xF0A9, 0xF0AA, 0xF0AB, 0xF0AC, 0xF0AD, 0xF0AE, 0xF0AF, 0xF0B0, 0xF0B1, 0xF0B2,
+    0xF0B3, 0xF0B4, 0xF0B5, 0xF0B6, 0xF0B7, 0xF0B8, 0xF0B9, 0xF0BA, 0xF0BB, 0xF0BC, 0xF0BD, 0xF0BE, 0xF0BF, 0xF0C0, 0xF0C1, 0xF0C2,
+    0xF0C3, 0xF0C4, 0xF0C5, 0xF0C6, 0xF0C7, 0xF0C8, 0xF0C9, 0xF0CA, 0xF0CB, 0xF0CC, 0xF0CD, 0xF0CE, 0xF0CF, 0xF0D0, 0xF0D1, 0xF0D2,
+    0xF0D3, 0xF0D4, 0xF0D5, 0xF0D6, 0xF0D7, 0xF0D8, 0xF0D9, 0xF0DA, 0xF0DB, 0xF0DC, 0xF0DD, 0xF0DE, 0xF0DF, 0xF0E0, 0xF0E1, 0xF0E2,
+    0xF0E3, 0xF0E4, 0xF0E5, 0xF0E6, 0xF0E7, 0xF0E8, 0xF0E9, 0xF0EA, 0xF0EB, 0xF0EC, 0xF0ED, 0xF0EE, 0xF0EF, 0xF0F0, 0xF0F1, 0xF0F2,
+    0xF0F3, 0xF0F4, 0xF0F5, 0xF0F6, 0xF0F7, 0xF0F8, 0xF0F9, 0xF0FA, 0xF0FB, 0xF0FC, 0xF0FD, 0xF0FE, 0xF0FF, 0xF100, 0xF101, 0xF102,
+    0xF103, 0xF104, 0xF105, 0xF106, 0xF107, 0xF108, 0xF109, 0xF10A, 0xF10B, 0xF10C, 0xF10D, 0xF10E, 0xF10F, 0xF110, 0xF111, 0xFFFF,
+  },
+};
+
+CP_TABLE_CONST uint8_t IBM939_U2CP_PAGE[256] = {
+    1,   0,   0,   2,   3,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    4,   5,   6,   7,   0,   8,   9,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+   10,   0,  11,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,  12,  13,
+   14,  15,  16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,
+   30,  31,  32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,
+   46,  47,  48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,
+   62,  63,  64,  65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,
+   78,  79,  80,  81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+   94,  95,  96,  97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109,
+  110, 111,   0,   0,   0,   0,   0,   0,   0, 112, 113,   0,   0,   0,   0, 114,
+};
+
+CP_TABLE_CONST uint16_t IBM939_U2CP[115][256] = {
+  { /* unmapped */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+00xx */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0037, 0x002D, 0x002E, 0x002F, 0x0016, 0x0005, 0x0025, 0x000B, 0x000C, 0x000D, 0xFFFF, 0xFFFF,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x003C, 0x003D, 0x0032, 0x0026, 0x0018, 0x0019, 0x003F, 0x0027, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0040, 0x005A, 0x007F, 0x007B, 0x005B, 0x006C, 0x0050, 0x007D, 0x004D, 0x005D, 0x005C, 0x004E, 0x006B, 0x0060, 0x004B, 0x0061,
+    0x00F0, 0x00F1, 0x00F2, 0x00F3, 0x00F4, 0x00F5, 0x00F6, 0x00F7, 0x00F8, 0x00F9, 0x007A, 0x005E, 0x004C, 0x007E, 0x006E, 0x006F,
+    0x007C, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6,
+    0x00D7, 0x00D8, 0x00D9, 0x00E2, 0x00E3, 0x00E4, 0x00E5, 0x00E6, 0x00E7, 0x00E8, 0x00E9, 0x00AD, 0x00E0, 0x00BD, 0x00B0, 0x006D,
+    0x0079, 0x0081, 0x0082, 0x0083, 0x0084, 0x0085, 0x0086, 0x0087, 0x0088, 0x0089, 0x0091, 0x0092, 0x0093, 0x0094, 0x0095, 0x0096,
+    0x0097, 0x0098, 0x0099, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00C0, 0x004F, 0x00D0, 0x00A1, 0x0007,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0015, 0x0006, 0x0017, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x0009, 0x000A, 0x001B,
+    0x0030, 0x0031, 0x001A, 0x0033, 0x0034, 0x0035, 0x0036, 0x0008, 0x0038, 0x0039, 0x003A, 0x003B, 0x0004, 0x0014, 0x003E, 0x00FF,
+    0xFFFF, 0xFFFF, 0x004A, 0x00B1, 0xFFFF, 0x00B2, 0x426A, 0x446A, 0x4460, 0xFFFF, 0xFFFF, 0xFFFF, 0x005F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x44ED, 0x444B, 0xFFFF, 0xFFFF, 0x4450, 0xFFFF, 0x4379, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x447A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x447B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+03xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4161, 0x4162, 0x4163, 0x4164, 0x4165, 0x4166, 0x4167, 0x4168, 0x4169, 0x416A, 0x416B, 0x416C, 0x416D, 0x416E, 0x416F,
+    0x4170, 0x4171, 0xFFFF, 0x4172, 0x4173, 0x4174, 0x4175, 0x4176, 0x4177, 0x4178, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4141, 0x4142, 0x4143, 0x4144, 0x4145, 0x4146, 0x4147, 0x4148, 0x4149, 0x414A, 0x414B, 0x414C, 0x414D, 0x414E, 0x414F,
+    0x4150, 0x4151, 0xFFFF, 0x4152, 0x4153, 0x4154, 0x4155, 0x4156, 0x4157, 0x4158, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+04xx */
+    0xFFFF, 0x41C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x41C0, 0x41C1, 0x41C2, 0x41C3, 0x41C4, 0x41C5, 0x41C7, 0x41C8, 0x41C9, 0x41CA, 0x41CB, 0x41CC, 0x41CD, 0x41CE, 0x41CF, 0x41D0,
+    0x41D1, 0x41D2, 0x41D3, 0x41D4, 0x41D5, 0x41D6, 0x41D7, 0x41D8, 0x41D9, 0x41DA, 0x41DB, 0x41DC, 0x41DD, 0x41DE, 0x41DF, 0x41E0,
+    0x4180, 0x4181, 0x4182, 0x4183, 0x4184, 0x4185, 0x4187, 0x4188, 0x4189, 0x418A, 0x418B, 0x418C, 0x418D, 0x418E, 0x418F, 0x4190,
+    0x4191, 0x4192, 0x4193, 0x4194, 0x4195, 0x4196, 0x4197, 0x4198, 0x4199, 0x419A, 0x419B, 0x419C, 0x419D, 0x419E, 0x419F, 0x41A0,
+    0xFFFF, 0x4186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+20xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x445A, 0xFFFF, 0xFFFF, 0xFFFF, 0x444A, 0xFFFF, 0x447C, 0xFFFF, 0x4461, 0x4471, 0xFFFF, 0xFFFF, 0x4462, 0x4472, 0xFFFF, 0xFFFF,
+    0x4377, 0x4378, 0xFFFF, 0xFFFF, 0xFFFF, 0x447E, 0x447F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4373, 0xFFFF, 0x44EE, 0x44EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x446B, 0xFFFF, 0xFFFF, 0x00A0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+21xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x444E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x446E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x446F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4372, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x41F1, 0x41F2, 0x41F3, 0x41F4, 0x41F5, 0x41F6, 0x41F7, 0x41F8, 0x41F9, 0x41FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x41B1, 0x41B2, 0x41B3, 0x41B4, 0x41B5, 0x41B6, 0x41B7, 0x41B8, 0x41B9, 0x41BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x44F1, 0x44F2, 0x44F0, 0x44F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x436E, 0xFFFF, 0x436F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+22xx */
+    0x4370, 0xFFFF, 0x434E, 0x4371, 0xFFFF, 0xFFFF, 0xFFFF, 0x434F, 0x4364, 0xFFFF, 0xFFFF, 0x4365, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4260, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x435F, 0xFFFF, 0xFFFF, 0x4361, 0x444D, 0xFFFF,
+    0x434B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x436C, 0x436D, 0x436B, 0x436A, 0x4362, 0x4363, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4468, 0x4478, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4360, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x435C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x444C, 0x435B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4467, 0x4477, 0xFFFF, 0xFFFF, 0x435D, 0x435E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4368, 0x4369, 0xFFFF, 0xFFFF, 0x4366, 0x4367, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x434C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+23xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x434D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+25xx */
+    0x437C, 0x43B7, 0x437D, 0x43B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x437E, 0xFFFF, 0xFFFF, 0x43B9,
+    0x437F, 0xFFFF, 0xFFFF, 0x43E1, 0x43B1, 0xFFFF, 0xFFFF, 0x43E3, 0x43B0, 0xFFFF, 0xFFFF, 0x43E2, 0x43B2, 0x43EE, 0xFFFF, 0xFFFF,
+    0x43E9, 0xFFFF, 0xFFFF, 0x43E4, 0x43B4, 0x43F0, 0xFFFF, 0xFFFF, 0x43EB, 0xFFFF, 0xFFFF, 0x43E6, 0x43B3, 0xFFFF, 0xFFFF, 0x43EA,
+    0x43EF, 0xFFFF, 0xFFFF, 0x43E5, 0x43B5, 0xFFFF, 0xFFFF, 0x43EC, 0x43F1, 0xFFFF, 0xFFFF, 0x43E7, 0x43B6, 0xFFFF, 0xFFFF, 0x43ED,
+    0xFFFF, 0xFFFF, 0x43F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x43E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x44EA, 0x44E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x44E3, 0x44E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x44EC, 0x44EB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x44E8, 0x44E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x44E0, 0xFFFF, 0xFFFF, 0x44E4, 0x44E1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x437A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+26xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x44E6, 0x44E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4479, 0xFFFF, 0x4469, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4376, 0xFFFF, 0xFFFF, 0x4375, 0xFFFF, 0x4374,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+30xx */
+    0x4040, 0x4344, 0x4341, 0x445B, 0xFFFF, 0x445D, 0x445E, 0x445F, 0x4464, 0x4474, 0x4465, 0x4475, 0x4342, 0x4343, 0x4442, 0x4443,
+    0x4466, 0x4476, 0x446C, 0x447D, 0x4463, 0x4473, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x43A1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4447, 0x4481, 0x4448, 0x4482, 0x4449, 0x4483, 0x4451, 0x4484, 0x4452, 0x4485, 0x4486, 0x44C0, 0x4487, 0x44C1, 0x4488,
+    0x44C2, 0x4489, 0x44C3, 0x448A, 0x44C4, 0x448C, 0x44C5, 0x448D, 0x44C6, 0x448E, 0x44C7, 0x448F, 0x44C8, 0x4490, 0x44C9, 0x4491,
+    0x44CA, 0x4492, 0x44CB, 0x4456, 0x4493, 0x44CC, 0x4494, 0x44CD, 0x4495, 0x44CE, 0x4496, 0x4497, 0x4498, 0x4499, 0x449A, 0x449D,
+    0x44CF, 0x44D5, 0x449E, 0x44D0, 0x44D6, 0x449F, 0x44D1, 0x44D7, 0x44A2, 0x44D2, 0x44D8, 0x44A3, 0x44D3, 0x44D9, 0x44A4, 0x44A5,
+    0x44A6, 0x44A7, 0x44A8, 0x4453, 0x44A9, 0x4454, 0x44AA, 0x4455, 0x44AC, 0x44AD, 0x44AE, 0x44AF, 0x44BA, 0x44BB, 0x4457, 0x44BC,
+    0x44DA, 0x44DB, 0x4446, 0x44BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x43BE, 0x43BF, 0x44DC, 0x44DD, 0xFFFF,
+    0xFFFF, 0x4347, 0x4381, 0x4348, 0x4382, 0x4349, 0x4383, 0x4351, 0x4384, 0x4352, 0x4385, 0x4386, 0x43C0, 0x4387, 0x43C1, 0x4388,
+    0x43C2, 0x4389, 0x43C3, 0x438A, 0x43C4, 0x438C, 0x43C5, 0x438D, 0x43C6, 0x438E, 0x43C7, 0x438F, 0x43C8, 0x4390, 0x43C9, 0x4391,
+    0x43CA, 0x4392, 0x43CB, 0x4356, 0x4393, 0x43CC, 0x4394, 0x43CD, 0x4395, 0x43CE, 0x4396, 0x4397, 0x4398, 0x4399, 0x439A, 0x439D,
+    0x43CF, 0x43D5, 0x439E, 0x43D0, 0x43D6, 0x439F, 0x43D1, 0x43D7, 0x43A2, 0x43D2, 0x43D8, 0x43A3, 0x43D3, 0x43D9, 0x43A4, 0x43A5,
+    0x43A6, 0x43A7, 0x43A8, 0x4353, 0x43A9, 0x4354, 0x43AA, 0x4355, 0x43AC, 0x43AD, 0x43AE, 0x43AF, 0x43BA, 0x43BB, 0x4357, 0x43BC,
+    0x43DA, 0x43DB, 0x4346, 0x43BD, 0x43D4, 0x4359, 0x435A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4345, 0x4358, 0x43DC, 0x43DD, 0xFFFF,
+  },
+  { /* U+32xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x446D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Exx */
+    0x4541, 0x4BCE, 0xFFFF, 0x4547, 0xFFFF, 0xFFFF, 0xFFFF, 0x454D, 0x49D3, 0x4543, 0x455E, 0x455F, 0xFFFF, 0x46AF, 0x4789, 0xFFFF,
+    0x5642, 0x4DEC, 0xFFFF, 0xFFFF, 0x4F97, 0x5643, 0x469B, 0x5775, 0x4D56, 0x50C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F62, 0xFFFF,
+    0xFFFF, 0x4883, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x487C, 0xFFFF, 0x5644, 0xFFFF, 0x5645, 0xFFFF, 0xFFFF, 0x455C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5646, 0x4CB8, 0xFFFF, 0xFFFF, 0xFFFF, 0x5647, 0xFFFF, 0x467A, 0x48AB, 0xFFFF, 0x4762, 0x54C8, 0xFFFF, 0xFFFF, 0x5648,
+    0xFFFF, 0xFFFF, 0x5649, 0x4B9F, 0xFFFF, 0x458A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45D8, 0xFFFF, 0x55A9, 0x54A5, 0x4F6C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62D0, 0x564A, 0x4947, 0x564B, 0x4BBD, 0xFFFF, 0xFFFF, 0xFFFF, 0x4549, 0x4EB5, 0x4749,
+    0xFFFF, 0xFFFF, 0x564C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4BBF, 0xFFFF, 0x4A98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4970, 0xFFFF,
+    0x47C0, 0xFFFF, 0x564D, 0xFFFF, 0xFFFF, 0x564E, 0x4BB1, 0xFFFF, 0x47C2, 0x4896, 0x564F, 0x45CE, 0x4542, 0xFFFF, 0x5650, 0xFFFF,
+    0xFFFF, 0x499D, 0x4B74, 0xFFFF, 0x4545, 0x456D, 0xFFFF, 0xFFFF, 0x4BE4, 0x50E8, 0xFFFF, 0x55DC, 0x4867, 0xFFFF, 0x5652, 0x5167,
+    0x5653, 0x4CCE, 0x5654, 0xFFFF, 0x478E, 0x4F7F, 0x4FFA, 0xFFFF, 0x4BAC, 0xFFFF, 0xFFFF, 0x4B73, 0x4575, 0x4E52, 0x499C, 0xFFFF,
+    0x5655, 0xFFFF, 0xFFFF, 0x5656, 0xFFFF, 0xFFFF, 0x5657, 0xFFFF, 0xFFFF, 0xFFFF, 0x4593, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x53D9, 0x4776, 0x565C, 0xFFFF, 0x565A, 0xFFFF, 0x565B, 0x5085, 0xFFFF, 0xFFFF, 0x45E0, 0x484B, 0xFFFF, 0x5659, 0x5658, 0x4BE5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5465, 0x48B5, 0x4755, 0x565E, 0x475D, 0x48A2, 0xFFFF, 0xFFFF, 0xFFFF, 0x445C, 0x565F, 0x5661,
+    0xFFFF, 0x565D, 0xFFFF, 0x459A, 0x49C3, 0x46F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5660, 0x4D71, 0xFFFF,
+    0x4DED, 0xFFFF, 0x4869, 0xFFFF, 0xFFFF, 0xFFFF, 0x48B2, 0x5341, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A55, 0x5662, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Fxx */
+    0x5665, 0x47D2, 0xFFFF, 0x5666, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5663, 0x45B2, 0xFFFF, 0xFFFF, 0x4D99, 0x4E9F, 0x4A83,
+    0x50F6, 0x4A81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45BD, 0xFFFF, 0x5664, 0x48D9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49A6,
+    0x5668, 0xFFFF, 0xFFFF, 0xFFFF, 0x49C9, 0xFFFF, 0x544A, 0xFFFF, 0x46F4, 0x566A, 0x508A, 0xFFFF, 0x4BBC, 0x5461, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4EDF, 0xFFFF, 0xFFFF, 0x4EFE, 0x566C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47C8, 0x48A4, 0x46E0,
+    0x4576, 0x4CE6, 0xFFFF, 0x4696, 0xFFFF, 0x4770, 0x566E, 0x566B, 0xFFFF, 0x49C1, 0x5667, 0x566F, 0x4594, 0x5669, 0x566D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5679, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x567C,
+    0x567A, 0xFFFF, 0xFFFF, 0x4876, 0xFFFF, 0x4B94, 0x51E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5677, 0x5462, 0xFFFF, 0xFFFF, 0x48B6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4F98, 0xFFFF, 0xFFFF, 0x567D, 0xFFFF, 0x5672, 0xFFFF, 0x5671, 0x4A46, 0xFFFF, 0x4FC2, 0xFFFF, 0x5673,
+    0xFFFF, 0x4F8D, 0x5670, 0xFFFF, 0x567B, 0xFFFF, 0x567E, 0xFFFF, 0x5676, 0xFFFF, 0x5674, 0x48BC, 0xFFFF, 0x4A9E, 0xFFFF, 0xFFFF,
+    0x52EC, 0x475A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5678, 0xFFFF, 0x5675, 0x53B9, 0x53E3,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F8C, 0x557C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B4C,
+    0xFFFF, 0xFFFF, 0x4851, 0x4A6A, 0x54C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5294, 0x4660, 0xFFFF, 0xFFFF, 0x5686, 0x5680, 0xFFFF,
+    0x5685, 0x5683, 0xFFFF, 0xFFFF, 0x567F, 0xFFFF, 0xFFFF, 0x4E97, 0x5681, 0xFFFF, 0x5684, 0x5682, 0xFFFF, 0x45AA, 0xFFFF, 0x53C4,
+    0xFFFF, 0x45A5, 0xFFFF, 0x4B4A, 0x5687, 0x5688, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46DE, 0x5696,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4CE1, 0xFFFF, 0x4DB1, 0x51F8, 0xFFFF, 0x50F9, 0xFFFF, 0x4E67, 0xFFFF, 0xFFFF, 0xFFFF, 0x5695, 0x5694,
+  },
+  { /* U+50xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x568F, 0x5699, 0xFFFF, 0xFFFF, 0x45D6, 0xFFFF, 0x49FA, 0xFFFF, 0x4AC4, 0xFFFF, 0x56A1,
+    0xFFFF, 0x5697, 0x4B6A, 0xFFFF, 0x568C, 0xFFFF, 0x5343, 0xFFFF, 0xFFFF, 0x4CAE, 0x5689, 0xFFFF, 0xFFFF, 0xFFFF, 0x5698, 0x4AD0,
+    0xFFFF, 0x5690, 0x5691, 0x5569, 0x487D, 0x568E, 0x52F1, 0xFFFF, 0x568B, 0x5692, 0x568D, 0x4D51, 0x5693, 0x4FF9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F63, 0xFFFF, 0xFFFF, 0x52FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x568A, 0xFFFF, 0x56A4, 0x569A, 0xFFFF, 0xFFFF, 0x56A2, 0x569B, 0x569E, 0x4DFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5049,
+    0x569D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x569C, 0x56A0, 0xFFFF, 0xFFFF, 0xFFFF, 0x569F, 0xFFFF, 0x4E70, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4681, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56A5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x56A3, 0xFFFF, 0x54D2, 0xFFFF, 0x4943, 0x4F95, 0x50C3, 0xFFFF, 0x56A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5059, 0xFFFF, 0xFFFF,
+    0x56A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EE7, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4FC3, 0xFFFF, 0xFFFF, 0x56A8, 0xFFFF, 0xFFFF, 0xFFFF, 0x509C, 0x46AC, 0x56A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C43, 0x54DA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x56AD, 0x56B0, 0x56AB, 0x4B58, 0xFFFF, 0x4C5B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A43, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x56B1, 0xFFFF, 0xFFFF, 0x4FC9, 0xFFFF, 0xFFFF, 0xFFFF, 0x56AE, 0x56AF, 0xFFFF, 0xFFFF, 0x48EC, 0xFFFF, 0x4BBA,
+    0xFFFF, 0x55AD, 0xFFFF, 0xFFFF, 0xFFFF, 0x4ABB, 0x52D4, 0xFFFF, 0x56B5, 0xFFFF, 0x4D82, 0xFFFF, 0xFFFF, 0xFFFF, 0x56B3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x56B7, 0xFFFF, 0x56B4, 0xFFFF, 0x4E84, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56B6, 0x56B8, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56B2, 0x56BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x56B9, 0xFFFF, 0x5578, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+51xx */
+    0x49CA, 0x56BC, 0x56BD, 0xFFFF, 0x454E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x546F, 0xFFFF, 0x56C0, 0x56BF, 0x56C1, 0xFFFF, 0x5290, 0xFFFF, 0x56BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AA2,
+    0xFFFF, 0x56C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x54BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56C4, 0xFFFF, 0xFFFF, 0x56C3, 0x56C6, 0x56C5, 0xFFFF, 0xFFFF, 0x56C7,
+    0x56C8, 0x4C91, 0xFFFF, 0x4695, 0x4BE8, 0x48C9, 0x4DF3, 0x555A, 0x47A2, 0x459E, 0x56C9, 0x479E, 0x56CA, 0x4B56, 0x5050, 0xFFFF,
+    0x469F, 0xFFFF, 0x56CB, 0xFFFF, 0x56CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x494B, 0xFFFF, 0x51BE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x56CD, 0xFFFF, 0x56CE, 0x4665, 0xFFFF, 0xFFFF, 0x46B1, 0x56CF, 0x56D0, 0x4548, 0x46BB, 0x4546, 0x56D1, 0xFFFF,
+    0xFFFF, 0x47B3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4649, 0x4F67, 0x47AF, 0x47C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x48F4, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x56D2, 0xFFFF, 0x56D3, 0xFFFF, 0xFFFF, 0x458E, 0x4645, 0xFFFF, 0xFFFF, 0x56D6, 0x4EA1, 0xFFFF, 0x56D5, 0x48EB, 0xFFFF, 0x56D7,
+    0x619D, 0x56D8, 0x4F8F, 0x56D9, 0xFFFF, 0x56DA, 0x56DB, 0x527E, 0xFFFF, 0x48C4, 0xFFFF, 0xFFFF, 0xFFFF, 0x56DC, 0xFFFF, 0xFFFF,
+    0x4E7B, 0xFFFF, 0x56DF, 0xFFFF, 0x56DD, 0x5467, 0x56DE, 0xFFFF, 0x4878, 0x56E0, 0x56E1, 0x56E2, 0x4BDE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x56E6, 0x56E4, 0x56E5, 0x56E3, 0x50C9, 0x56E7, 0x5146, 0x48FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56E9, 0x56E8, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52DC, 0x56EA, 0x4F80, 0xFFFF, 0xFFFF, 0x56EB, 0xFFFF, 0x55F9, 0x5344, 0x4BE6, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5777, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x56EC, 0x6884, 0x4ED9, 0xFFFF, 0xFFFF,
+    0x56ED, 0x4DE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48E6, 0x558A, 0xFFFF, 0x56EE, 0x549E, 0xFFFF, 0x56EF, 0x56F0, 0xFFFF, 0xFFFF,
+    0x56F1, 0x51AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x56F2, 0x51EC, 0xFFFF, 0x50CF, 0x50E6, 0x459B, 0xFFFF, 0xFFFF, 0x4BB6, 0x56F3, 0xFFFF,
+  },
+  { /* U+52xx */
+    0x4C50, 0xFFFF, 0xFFFF, 0x4F44, 0x56F4, 0xFFFF, 0x45B4, 0x4765, 0x4B9B, 0xFFFF, 0x4CD7, 0x56F5, 0xFFFF, 0xFFFF, 0x54E3, 0xFFFF,
+    0xFFFF, 0x4C52, 0xFFFF, 0xFFFF, 0x56F6, 0x56F7, 0xFFFF, 0x4BB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x474B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x495C, 0x46DD, 0xFFFF, 0x56F8, 0xFFFF, 0x45BC, 0x56F9, 0xFFFF, 0xFFFF, 0xFFFF, 0x56FA, 0xFFFF,
+    0x4CDD, 0xFFFF, 0xFFFF, 0x56FB, 0xFFFF, 0xFFFF, 0x46C4, 0x48CF, 0x4B6B, 0x56FC, 0x4BC0, 0x4BF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5379, 0x56FD, 0xFFFF, 0xFFFF, 0x474D, 0xFFFF, 0xFFFF, 0x4A90, 0x56FE, 0x51AE, 0x45AF, 0xFFFF, 0x5741,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5743, 0xFFFF, 0x5199, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49C7, 0xFFFF, 0xFFFF, 0x5742, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4CD3, 0x4766, 0x5481, 0xFFFF, 0xFFFF, 0xFFFF, 0x5748, 0x5745, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B4E,
+    0x4D85, 0x5744, 0x47D6, 0x5746, 0x5747, 0x4BE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x574A, 0xFFFF, 0x5749,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x55D6, 0xFFFF, 0xFFFF, 0xFFFF, 0x49F0, 0x574C, 0x5185, 0xFFFF, 0xFFFF, 0xFFFF, 0x574B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x574E, 0x574D, 0xFFFF, 0x5580, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45F7, 0x574F, 0xFFFF, 0xFFFF, 0x4870,
+    0x459F, 0xFFFF, 0xFFFF, 0x4E68, 0xFFFF, 0xFFFF, 0x5750, 0xFFFF, 0xFFFF, 0x4671, 0x4A64, 0x54C6, 0x5751, 0x5752, 0xFFFF, 0x5FAA,
+    0xFFFF, 0x4D92, 0xFFFF, 0xFFFF, 0x48A9, 0x5754, 0xFFFF, 0xFFFF, 0xFFFF, 0x4978, 0xFFFF, 0xFFFF, 0x5753, 0xFFFF, 0x556A, 0xFFFF,
+    0x5756, 0x5755, 0xFFFF, 0x54B1, 0xFFFF, 0x4EEF, 0xFFFF, 0x469C, 0xFFFF, 0x48CE, 0xFFFF, 0xFFFF, 0xFFFF, 0x5757, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x53D6, 0xFFFF, 0xFFFF, 0x45E4, 0xFFFF, 0x5392, 0x4B9A, 0x46ED, 0xFFFF, 0x5758, 0xFFFF, 0x45B5, 0x5759, 0x4AE1,
+    0x575C, 0xFFFF, 0x47EE, 0x575A, 0x499F, 0xFFFF, 0x575B, 0x4C7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x497A, 0x575D, 0xFFFF, 0x575E, 0xFFFF, 0xFFFF, 0x575F, 0x5760, 0x5470, 0xFFFF, 0xFFFF, 0xFFFF, 0x51E9, 0x5297,
+  },
+  { /* U+53xx */
+    0x5761, 0x4F5B, 0x4ECB, 0xFFFF, 0xFFFF, 0x4AA8, 0x5762, 0x5763, 0x5764, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5766, 0xFFFF, 0x5768,
+    0x5767, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5769, 0x4590, 0x455A, 0xFFFF, 0x5457, 0x576A, 0xFFFF, 0xFFFF, 0x51B7, 0xFFFF, 0xFFFF,
+    0x4E6B, 0x4D4D, 0xFFFF, 0x576C, 0x576B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x576D,
+    0xFFFF, 0x576E, 0xFFFF, 0x576F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5770, 0x4FD1, 0x4554, 0x4A87, 0xFFFF, 0xFFFF, 0xFFFF, 0x50F1,
+    0x5771, 0x454A, 0xFFFF, 0x454C, 0xFFFF, 0x5772, 0x5773, 0x4E47, 0x45DF, 0x5774, 0x4790, 0xFFFF, 0xFFFF, 0x5776, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x53AD, 0x4AF2, 0x4996, 0x47D7, 0xFFFF, 0xFFFF, 0x4559, 0x48E3, 0xFFFF, 0x45F6, 0xFFFF, 0x51C0, 0xFFFF, 0x5779, 0xFFFF,
+    0x49EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53DB, 0xFFFF, 0xFFFF, 0x577A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x577B, 0x4C82,
+    0x4799, 0x4B91, 0x577C, 0x4B6D, 0x4AA4, 0x4CF5, 0xFFFF, 0x577D, 0x4E79, 0xFFFF, 0xFFFF, 0x577E, 0xFFFF, 0xFFFF, 0xFFFF, 0x53E2,
+    0xFFFF, 0xFFFF, 0x577F, 0xFFFF, 0x5352, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5780, 0xFFFF, 0xFFFF, 0x5781, 0xFFFF, 0x4F55, 0xFFFF, 0x4942, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4574,
+    0x5782, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5784, 0x5783, 0xFFFF, 0x5178, 0x5367, 0xFFFF, 0xFFFF, 0xFFFF, 0x53B7, 0x5785, 0xFFFF,
+    0x5786, 0xFFFF, 0x5787, 0x4C8E, 0xFFFF, 0xFFFF, 0x5788, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4ACA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x48D2, 0x5789, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48F5, 0x50A5, 0x485C, 0x46D4, 0x4B71, 0x47F9, 0x4791, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA5, 0xFFFF, 0x46A6, 0x484C, 0xFFFF, 0x50F5, 0xFFFF, 0x55B2, 0xFFFF, 0x578B, 0xFFFF, 0x578C,
+    0xFFFF, 0x5194, 0x53F5, 0x4588, 0x45D4, 0x4C8B, 0xFFFF, 0xFFFF, 0x5791, 0x4F71, 0x4E41, 0x4DD5, 0x4F86, 0x5792, 0x5790, 0x47C6,
+    0x4778, 0x5042, 0x47D9, 0x485A, 0xFFFF, 0xFFFF, 0x4F59, 0x48E2, 0x45F0, 0xFFFF, 0x5793, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+54xx */
+    0xFFFF, 0x5794, 0xFFFF, 0x55EA, 0x47BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x45A0, 0x457E, 0x53D3, 0x55BC, 0x466D, 0x45F3, 0x51AF, 0x50C6,
+    0x4EB2, 0x46A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47CF, 0xFFFF, 0x579D, 0xFFFF, 0x507A,
+    0x53E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C4F, 0xFFFF, 0xFFFF, 0x579C, 0xFFFF, 0x49CB, 0x5797, 0x5798, 0x579A, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x579B, 0xFFFF, 0x4B98, 0x49C4, 0xFFFF, 0x53E5, 0x5799, 0x5795, 0x47F6, 0xFFFF,
+    0x5796, 0xFFFF, 0x4B50, 0xFFFF, 0xFFFF, 0xFFFF, 0x5073, 0xFFFF, 0x4F56, 0x4AEE, 0x4954, 0xFFFF, 0xFFFF, 0xFFFF, 0x579E, 0xFFFF,
+    0xFFFF, 0x50B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57A2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48A1, 0xFFFF, 0x548D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x57A5, 0x57A3, 0xFFFF, 0x477F, 0xFFFF, 0x57A0, 0x57AA, 0x57A4, 0xFFFF, 0xFFFF, 0xFFFF, 0x57A7, 0x4AF6, 0x49B0, 0xFFFF, 0xFFFF,
+    0x57A8, 0xFFFF, 0xFFFF, 0xFFFF, 0x57AB, 0xFFFF, 0x57AD, 0xFFFF, 0xFFFF, 0xFFFF, 0x57AE, 0x4F50, 0x457A, 0xFFFF, 0x57A1, 0x579F,
+    0x57AC, 0xFFFF, 0x57A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57A9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x57B2, 0xFFFF, 0x57BC, 0x57B4, 0xFFFF, 0xFFFF, 0x57B9, 0x57BD, 0xFFFF, 0x57BA, 0x57B5, 0xFFFF, 0xFFFF, 0x57B1,
+    0xFFFF, 0xFFFF, 0x4CDE, 0x53E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57B3, 0xFFFF, 0xFFFF, 0xFFFF, 0x57B0, 0x52B1, 0x57BE, 0xFFFF,
+    0x4EF9, 0x45D0, 0x57BB, 0xFFFF, 0x57B6, 0xFFFF, 0xFFFF, 0x57AF, 0x57B8, 0x4A6B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x46CB, 0x57C7, 0xFFFF, 0xFFFF, 0x57BF, 0x57C1, 0xFFFF, 0x5568, 0x55F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x57C6, 0x57C5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4747, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x547C, 0xFFFF, 0xFFFF, 0x57C4, 0xFFFF, 0x57C0,
+  },
+  { /* U+55xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CDB, 0xFFFF, 0x51B8, 0x4F76, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57C2,
+    0x4BAB, 0xFFFF, 0xFFFF, 0xFFFF, 0x57C3, 0xFFFF, 0x54D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57CC, 0x4BE0,
+    0xFFFF, 0x4D43, 0xFFFF, 0x57D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57D1, 0x57C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5478, 0xFFFF,
+    0x57C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5383, 0x57CE, 0x46BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57CB, 0xFFFF, 0xFFFF, 0x46E4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x47E4, 0xFFFF, 0xFFFF, 0x57CF, 0x57D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57CD, 0x57D3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x57CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57D8, 0x57DD, 0xFFFF, 0x57D9, 0xFFFF,
+    0x57D5, 0xFFFF, 0xFFFF, 0x57DF, 0x46B3, 0xFFFF, 0x57DE, 0x57E1, 0xFFFF, 0x5253, 0x57D6, 0x5558, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57DA, 0x57D4, 0x52B5, 0xFFFF, 0x45D1, 0x5475, 0x57DB, 0x57D7,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FD3, 0x57E2, 0x57E0, 0x5168, 0x4D6D, 0x4C5F, 0xFFFF, 0x57DC, 0xFFFF,
+    0x4EB9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57E5, 0x57E3, 0xFFFF, 0x5858, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52A2, 0xFFFF, 0x57E6, 0xFFFF, 0xFFFF, 0x57E4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4B5E, 0x57E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57EB, 0xFFFF, 0x57E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x57EE, 0x57ED, 0xFFFF,
+  },
+  { /* U+56xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5063, 0xFFFF, 0xFFFF, 0x477E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57EA, 0xFFFF, 0x57EC, 0x54EC, 0x50F3, 0xFFFF, 0xFFFF, 0x57EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57F8,
+    0xFFFF, 0x50CA, 0x57F3, 0xFFFF, 0x547F, 0xFFFF, 0x57F2, 0xFFFF, 0x57F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x529B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5062, 0xFFFF, 0x57F0, 0xFFFF,
+    0x57F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x547D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x45FC, 0xFFFF, 0x57FA, 0x57F5, 0x57F9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E6D, 0xFFFF, 0xFFFF, 0xFFFF, 0x55F1, 0xFFFF, 0x5582, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x57FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57F7, 0x55D8, 0xFFFF, 0xFFFF, 0x5841, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57FD,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5842, 0xFFFF, 0x5190, 0xFFFF, 0xFFFF, 0x5843, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5844, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5846, 0xFFFF, 0x5845, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5849, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x584C, 0x584A, 0x5848, 0x584B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5847, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x584D, 0xFFFF,
+    0xFFFF, 0x584F, 0xFFFF, 0x584E, 0xFFFF, 0xFFFF, 0xFFFF, 0x5850, 0x56D4, 0xFFFF, 0x5065, 0x4544, 0xFFFF, 0xFFFF, 0x46A9, 0xFFFF,
+    0x4A49, 0xFFFF, 0xFFFF, 0x47F0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5851, 0xFFFF,
+    0x4B44, 0xFFFF, 0x4AFA, 0x47C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5852, 0x4A94, 0xFFFF, 0xFFFF, 0x458F, 0xFFFF, 0x5853,
+  },
+  { /* U+57xx */
+    0x5266, 0xFFFF, 0xFFFF, 0x53CF, 0x5854, 0xFFFF, 0xFFFF, 0xFFFF, 0x5856, 0x5855, 0xFFFF, 0x51BD, 0xFFFF, 0x5857, 0xFFFF, 0x4F49,
+    0xFFFF, 0xFFFF, 0x47E1, 0x54E7, 0xFFFF, 0xFFFF, 0x585A, 0xFFFF, 0x5859, 0xFFFF, 0xFFFF, 0xFFFF, 0x585B, 0xFFFF, 0xFFFF, 0x4684,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x585C, 0x4782, 0x47CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49E6, 0xFFFF, 0xFFFF,
+    0x45C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D1, 0x585D, 0xFFFF, 0xFFFF, 0x585F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5861, 0xFFFF, 0x45EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49AE, 0xFFFF, 0xFFFF, 0x4C55, 0xFFFF, 0xFFFF, 0xFFFF, 0x585E, 0x5862,
+    0x4E8D, 0x4EF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5860, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5865, 0xFFFF, 0xFFFF, 0x53A6, 0x5863, 0x51C4, 0xFFFF, 0xFFFF, 0x5398, 0x4949, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5866,
+    0xFFFF, 0xFFFF, 0x4BC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5864, 0x5867, 0xFFFF, 0x46E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5868, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5869, 0xFFFF, 0x5466, 0x47CE, 0x586A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x586D, 0xFFFF, 0x586C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x53CD, 0xFFFF, 0xFFFF, 0x586B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5871, 0xFFFF, 0xFFFF, 0x586E, 0xFFFF, 0xFFFF, 0x586F, 0x5873, 0x5870, 0xFFFF, 0xFFFF, 0x4EAC, 0xFFFF, 0xFFFF, 0x45DB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5874, 0x5875, 0x5872, 0xFFFF, 0x5876, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DF4, 0xFFFF, 0xFFFF, 0x48E9,
+    0x517E, 0xFFFF, 0xFFFF, 0x5879, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F48, 0xFFFF, 0xFFFF, 0x4D57, 0xFFFF, 0x4DAC, 0x46F1, 0xFFFF, 0x46A3, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+58xx */
+    0x469D, 0xFFFF, 0x497F, 0xFFFF, 0xFFFF, 0x4AE7, 0x5371, 0xFFFF, 0xFFFF, 0xFFFF, 0x5878, 0x587A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x587B, 0xFFFF, 0xFFFF, 0xFFFF, 0x53A7, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x587C, 0xFFFF, 0xFFFF, 0x4B61, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E53,
+    0x50A4, 0x49B8, 0xFFFF, 0xFFFF, 0x45D9, 0x54F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A7C, 0xFFFF, 0xFFFF, 0x5880, 0xFFFF, 0xFFFF,
+    0x539F, 0x4BEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5053, 0x587D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4EC6, 0x5881, 0xFFFF, 0x4CCB, 0xFFFF, 0xFFFF, 0x486A, 0x52F8, 0x4F6F, 0x4657, 0xFFFF, 0xFFFF, 0xFFFF, 0x53C1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x587E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4743, 0xFFFF, 0x4F5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5883, 0xFFFF, 0x5886, 0xFFFF, 0xFFFF, 0x4D89, 0xFFFF, 0xFFFF, 0xFFFF, 0x5884, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5279, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4A95, 0xFFFF, 0x5885, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4EBE, 0xFFFF, 0xFFFF, 0xFFFF, 0x464D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5150, 0xFFFF, 0x588A, 0x5887,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AFC, 0xFFFF, 0xFFFF, 0x5888, 0xFFFF, 0xFFFF, 0x588B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x588C, 0x5289, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5889, 0x588D, 0x588E, 0x5552, 0xFFFF, 0xFFFF, 0x5488, 0xFFFF,
+    0xFFFF, 0x4B95, 0xFFFF, 0xFFFF, 0xFFFF, 0x588F, 0xFFFF, 0x4E8E, 0xFFFF, 0xFFFF, 0x4EC8, 0xFFFF, 0x5196, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5891, 0xFFFF, 0x5890, 0xFFFF, 0x55B9, 0xFFFF, 0x5892, 0x5894, 0x5893, 0xFFFF, 0xFFFF, 0x5896, 0xFFFF, 0x5895, 0x5897,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5898, 0x5899, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x467D, 0x514F, 0xFFFF, 0x4C9F, 0x589A,
+    0x496C, 0x4EB0, 0x4775, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x589B, 0xFFFF, 0x589C, 0x5077, 0x589D, 0x589E, 0x5275, 0xFFFF, 0xFFFF,
+  },
+  { /* U+59xx */
+    0xFFFF, 0xFFFF, 0x589F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x476F, 0x58A0, 0x58A1, 0xFFFF, 0xFFFF, 0xFFFF, 0x497E,
+    0x58A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AC3, 0x4694, 0xFFFF, 0x52C8, 0x54DD, 0x45FE, 0x58A3, 0x48C8, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4B8B, 0xFFFF, 0xFFFF, 0x58A5, 0xFFFF, 0x455B, 0xFFFF, 0x468A, 0x45AB, 0x4573, 0x58A6, 0x58A7, 0x4792, 0xFFFF,
+    0xFFFF, 0x4941, 0x58A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5147, 0x58A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58AA, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52F2, 0xFFFF, 0xFFFF, 0x4D69, 0x45E6, 0x4DB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x518F, 0x4C53,
+    0x58AC, 0x4C64, 0xFFFF, 0x58AD, 0x5284, 0x58AB, 0xFFFF, 0x5583, 0x58AF, 0xFFFF, 0x58AE, 0x58B0, 0xFFFF, 0x58B1, 0xFFFF, 0xFFFF,
+    0x58B4, 0xFFFF, 0x58B3, 0x58B2, 0xFFFF, 0x46E5, 0xFFFF, 0x58B5, 0x4ECA, 0x58B7, 0x4EBB, 0xFFFF, 0x58B6, 0xFFFF, 0x4EDD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4699, 0x4D90, 0xFFFF, 0xFFFF, 0xFFFF, 0x58B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x469E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x58B9, 0x4BF8, 0x51A2, 0x554D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5043, 0xFFFF, 0xFFFF, 0x58BA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5395, 0xFFFF, 0xFFFF, 0x53D1, 0xFFFF, 0xFFFF, 0x4A66, 0xFFFF, 0x58BB, 0xFFFF, 0x58BC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x58BD, 0x58BE, 0x4D9E, 0xFFFF, 0xFFFF, 0x50EC, 0xFFFF, 0xFFFF, 0xFFFF, 0x537F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x58BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BDC, 0x58C0, 0x49A3, 0xFFFF, 0xFFFF, 0x53AF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58C1, 0xFFFF, 0xFFFF, 0x4CC1, 0xFFFF, 0x4990, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x549C, 0x53F2, 0xFFFF, 0x4FF1, 0x484F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58C3, 0x58C4, 0xFFFF, 0x5184, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5255, 0x55DE, 0xFFFF, 0x58C2, 0xFFFF, 0x558C, 0x4AB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5179, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B42,
+  },
+  { /* U+5Axx */
+    0xFFFF, 0x4C65, 0xFFFF, 0x557A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x58C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B54, 0xFFFF, 0x58C9, 0xFFFF, 0x58C8, 0xFFFF, 0xFFFF, 0x58C6,
+    0x524C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58C5, 0xFFFF, 0xFFFF, 0xFFFF, 0x549F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50B5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58CE, 0x58CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5498, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x58CB, 0x50F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4ECC, 0xFFFF, 0xFFFF, 0x58CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x58D0, 0xFFFF, 0xFFFF, 0xFFFF, 0x496F, 0xFFFF, 0xFFFF, 0xFFFF, 0x58D1, 0xFFFF, 0x58CC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5454,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4D80, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58D2, 0x4855, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58D3, 0x58D8, 0x58D4, 0xFFFF,
+    0xFFFF, 0x4E89, 0x58D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53E0, 0xFFFF, 0x58D6, 0x4EC3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x58D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58DD, 0x58DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5567, 0xFFFF, 0x58D9, 0xFFFF, 0xFFFF, 0x58DB, 0xFFFF, 0xFFFF, 0x58DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58DE, 0x58DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+5Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F8B, 0xFFFF, 0x58E1, 0x58E0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4DE4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58E4, 0xFFFF, 0x52EA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x55E8, 0xFFFF, 0x58E3, 0xFFFF, 0xFFFF, 0xFFFF, 0x58E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x58E6, 0xFFFF,
+    0x58E9, 0xFFFF, 0xFFFF, 0x58E7, 0xFFFF, 0x58E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4564, 0x58EA, 0xFFFF, 0xFFFF, 0x4BD9, 0x58EB, 0x58EC, 0x48F2, 0x4A41, 0xFFFF, 0x5258, 0x58EE, 0x4FF2, 0x45F4, 0xFFFF, 0x4F83,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4AEC, 0x4EAF, 0x58EF, 0x45BE, 0xFFFF, 0xFFFF, 0x58F0, 0xFFFF, 0x4C5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x58F1, 0x595B, 0xFFFF, 0x58F2, 0xFFFF, 0x58F3, 0xFFFF, 0xFFFF, 0x58F4, 0xFFFF, 0x58F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x58F6, 0xFFFF, 0xFFFF, 0x58F7, 0xFFFF, 0x486F, 0xFFFF, 0x46D5, 0x46F0, 0x45A8, 0xFFFF, 0x524D, 0x48C5, 0x4C75, 0xFFFF, 0x46C8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x515C, 0xFFFF, 0x47DD, 0x49A2, 0x4D64, 0x45E7, 0x50AB, 0x4D8B, 0x494D, 0xFFFF, 0x45ED,
+    0xFFFF, 0xFFFF, 0x4ADE, 0x498F, 0x47B8, 0x4F7A, 0x58F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4592, 0xFFFF,
+    0x4ED4, 0xFFFF, 0xFFFF, 0x4968, 0x5078, 0x52EF, 0x4686, 0xFFFF, 0x58F9, 0x4889, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4882,
+    0x58FC, 0xFFFF, 0x4FE9, 0x58FA, 0x49DF, 0x4A84, 0x4A56, 0x58FB, 0xFFFF, 0x58FD, 0xFFFF, 0xFFFF, 0x45AC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5941, 0xFFFF, 0x4B81, 0x55F4, 0x5244, 0xFFFF, 0xFFFF, 0xFFFF, 0x5942, 0xFFFF, 0xFFFF, 0x47F8, 0xFFFF, 0x4B59, 0x5943, 0x4B93,
+    0xFFFF, 0x52B8, 0x5946, 0xFFFF, 0x5945, 0x5947, 0x51FC, 0x4FA9, 0x5C7E, 0x4987, 0xFFFF, 0x5948, 0x5944, 0xFFFF, 0x4C7A, 0xFFFF,
+    0x5949, 0xFFFF, 0xFFFF, 0x594A, 0xFFFF, 0x5556, 0x594B, 0xFFFF, 0x4B60, 0xFFFF, 0x46A0, 0xFFFF, 0xFFFF, 0xFFFF, 0x4656, 0x46B2,
+  },
+  { /* U+5Cxx */
+    0xFFFF, 0x4D76, 0x49FB, 0xFFFF, 0x498A, 0x594C, 0x4959, 0x594D, 0x594E, 0x5189, 0x4CEF, 0x4D5F, 0xFFFF, 0x594F, 0x48AE, 0x455D,
+    0xFFFF, 0x484A, 0xFFFF, 0x5950, 0xFFFF, 0xFFFF, 0x53C0, 0xFFFF, 0xFFFF, 0xFFFF, 0x4871, 0xFFFF, 0xFFFF, 0xFFFF, 0x5951, 0xFFFF,
+    0x5952, 0xFFFF, 0x5953, 0xFFFF, 0x53AE, 0xFFFF, 0xFFFF, 0xFFFF, 0x5954, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6880, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4BEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5955, 0x515D, 0x4C6B, 0x49CE, 0x4A86, 0x4FB9, 0x45C8, 0x4CC6,
+    0x488B, 0x5956, 0xFFFF, 0xFFFF, 0xFFFF, 0x485E, 0x5957, 0xFFFF, 0x4D94, 0xFFFF, 0x4DA7, 0x45E9, 0xFFFF, 0x55BA, 0x5958, 0x5443,
+    0x595A, 0x54B2, 0xFFFF, 0x5959, 0xFFFF, 0x48DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x476D, 0xFFFF,
+    0x53FB, 0x55C0, 0xFFFF, 0xFFFF, 0x4A8E, 0x4CA2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x595C, 0xFFFF, 0x595D, 0x4FDD,
+    0xFFFF, 0x4565, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x595E, 0xFFFF, 0xFFFF, 0x595F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5960, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x474A, 0x525A, 0xFFFF, 0xFFFF, 0x5961, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4572, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5967, 0xFFFF, 0x54B9, 0x45BF, 0xFFFF, 0x5963, 0x50D5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5262, 0xFFFF, 0x4D46, 0xFFFF, 0xFFFF, 0x5965, 0x5966, 0x4748, 0xFFFF, 0x5968, 0x5964, 0x596A, 0xFFFF, 0x5962, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5969, 0xFFFF, 0x596B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x596C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F96, 0x51B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F9D, 0x596D, 0x5972, 0xFFFF, 0xFFFF, 0x5971, 0xFFFF, 0x4AAC,
+    0x48FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5970, 0x456F, 0xFFFF, 0xFFFF, 0xFFFF, 0x596F, 0x5072, 0xFFFF, 0x596E, 0xFFFF, 0xFFFF,
+  },
+  { /* U+5Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C7F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5973, 0xFFFF, 0xFFFF, 0x457F, 0xFFFF,
+    0xFFFF, 0x5977, 0xFFFF, 0xFFFF, 0x514D, 0x5974, 0x5074, 0x54F1, 0x597C, 0x597B, 0x597A, 0x5976, 0xFFFF, 0xFFFF, 0xFFFF, 0x5975,
+    0xFFFF, 0xFFFF, 0x5979, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5978, 0xFFFF, 0x4F5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5984, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5983, 0x597D, 0xFFFF, 0x5982, 0xFFFF,
+    0x498C, 0xFFFF, 0x597E, 0x597F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5981, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x509E, 0xFFFF, 0xFFFF, 0x5985, 0x5987, 0xFFFF, 0x4ED3,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5986, 0xFFFF, 0xFFFF, 0x5988, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x598B, 0xFFFF, 0x598A, 0xFFFF, 0xFFFF, 0x5989, 0xFFFF, 0xFFFF, 0xFFFF, 0x47D1, 0x598C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x598F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x598E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x598D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5990, 0xFFFF, 0x5991, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5992, 0x5993, 0x5995, 0x4CE8, 0xFFFF, 0x5994, 0x4F84, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5996, 0xFFFF, 0xFFFF, 0x49CF, 0x5281, 0xFFFF, 0xFFFF,
+    0x5997, 0xFFFF, 0x5999, 0x5998, 0xFFFF, 0xFFFF, 0x51DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x599A, 0xFFFF, 0x4567, 0x4741, 0xFFFF,
+    0xFFFF, 0x4D47, 0xFFFF, 0x4C67, 0xFFFF, 0x456A, 0x485B, 0x4CA3, 0x4A52, 0xFFFF, 0xFFFF, 0x599B, 0xFFFF, 0xFFFF, 0x498B, 0xFFFF,
+    0xFFFF, 0x47AD, 0x4A4B, 0x4AE6, 0x4E7D, 0x599C, 0xFFFF, 0x53CB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4893, 0xFFFF, 0x4E46, 0x4A7D, 0xFFFF,
+  },
+  { /* U+5Exx */
+    0xFFFF, 0xFFFF, 0x4553, 0x476B, 0xFFFF, 0xFFFF, 0x4F75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x599D, 0x4AB5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x59A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51C7, 0xFFFF, 0xFFFF, 0x599F, 0x599E, 0x59A1, 0xFFFF, 0x489C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A44, 0xFFFF, 0x4B53, 0xFFFF, 0x4960,
+    0x4982, 0xFFFF, 0xFFFF, 0x4DC5, 0xFFFF, 0xFFFF, 0x59A2, 0x54BE, 0x46EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C85, 0xFFFF, 0xFFFF,
+    0x59A5, 0xFFFF, 0xFFFF, 0x59A4, 0x59A3, 0x4A5E, 0xFFFF, 0x59A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x496B, 0xFFFF, 0x59A7, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59A9, 0x4CCA, 0xFFFF, 0x59A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5483,
+    0xFFFF, 0x48DE, 0x59AA, 0x4E7F, 0x59AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4A6F, 0x458D, 0x4560, 0x59AC, 0x59AD, 0xFFFF, 0x45A9, 0x48DA, 0x59AE, 0x50A2, 0x4DAF, 0x525F, 0x4B57, 0x59AF,
+    0xFFFF, 0x4B92, 0xFFFF, 0x45B7, 0x4850, 0xFFFF, 0xFFFF, 0x558D, 0xFFFF, 0xFFFF, 0x4AED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D4F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B64, 0x554F, 0x4854, 0xFFFF, 0xFFFF, 0x515A, 0xFFFF, 0x4551, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x59B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45DE, 0x48B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x45F8, 0xFFFF, 0x48E0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EEB, 0x50C1, 0x469A, 0x4C5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x59B1, 0x59B2, 0x4BC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59B3, 0x4EDB, 0x4EA7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59B5,
+    0x59B4, 0xFFFF, 0xFFFF, 0x54AD, 0xFFFF, 0xFFFF, 0x536C, 0xFFFF, 0xFFFF, 0xFFFF, 0x59B7, 0x59B8, 0xFFFF, 0x59B6, 0xFFFF, 0x55AF,
+    0x5562, 0x59BA, 0x59B9, 0x50E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59BB, 0x59BC, 0xFFFF, 0xFFFF, 0x59BD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x59BE, 0x59BF, 0xFFFF, 0x59C0, 0x59C1, 0xFFFF, 0x47D0, 0x505B, 0x52D6, 0xFFFF, 0x4666, 0x4BAF, 0x5564, 0xFFFF, 0x544B, 0x51D9,
+  },
+  { /* U+5Fxx */
+    0xFFFF, 0x4B47, 0xFFFF, 0x59C2, 0x54BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59C3, 0x50CD, 0x59C4, 0x5641, 0x5651, 0xFFFF, 0x468F,
+    0x50E1, 0x59C5, 0xFFFF, 0x4B63, 0x51E5, 0x46DA, 0x59C6, 0x54AC, 0x45D3, 0xFFFF, 0xFFFF, 0x5597, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C9B,
+    0xFFFF, 0x59C7, 0xFFFF, 0xFFFF, 0xFFFF, 0x47E6, 0x4E42, 0x536B, 0xFFFF, 0x59C8, 0xFFFF, 0xFFFF, 0xFFFF, 0x59C9, 0xFFFF, 0x59CA,
+    0xFFFF, 0x4B6E, 0xFFFF, 0xFFFF, 0x59CB, 0x48BA, 0xFFFF, 0x46D2, 0x59CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x52E0, 0xFFFF, 0x4AD4, 0xFFFF,
+    0xFFFF, 0x59CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x53C7, 0xFFFF, 0xFFFF, 0x59CE, 0xFFFF, 0x5385, 0xFFFF, 0x59CF, 0xFFFF, 0x59D0, 0xFFFF,
+    0xFFFF, 0x59D1, 0xFFFF, 0x465F, 0xFFFF, 0xFFFF, 0x59D2, 0x59D3, 0xFFFF, 0x59D4, 0xFFFF, 0xFFFF, 0x59D5, 0x59D6, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x59D7, 0x4690, 0xFFFF, 0xFFFF, 0xFFFF, 0x45E1, 0x59D8, 0xFFFF, 0x4DCD, 0x5159, 0x4E86, 0x4E88, 0x529C, 0xFFFF, 0xFFFF,
+    0x4964, 0x495E, 0xFFFF, 0x59D9, 0xFFFF, 0xFFFF, 0xFFFF, 0x59DA, 0xFFFF, 0x495D, 0xFFFF, 0xFFFF, 0x4772, 0xFFFF, 0xFFFF, 0x59DD,
+    0x4CEA, 0x4A61, 0x59DC, 0x59DB, 0x4E60, 0x48A3, 0xFFFF, 0x59E0, 0x59DF, 0xFFFF, 0x59DE, 0x4991, 0x45E5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x50B3, 0x59E1, 0x4C6C, 0x48FB, 0xFFFF, 0xFFFF, 0xFFFF, 0x47E8, 0x59E4, 0x59E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59E3, 0xFFFF,
+    0x59E5, 0x4698, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59E6, 0x4A70, 0x4EF5, 0xFFFF, 0xFFFF, 0x59E7, 0x4B5D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4654, 0x4C74, 0xFFFF, 0xFFFF, 0x59E8, 0xFFFF, 0x48F8, 0xFFFF, 0xFFFF, 0x59E9, 0x55E0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x46E7, 0xFFFF, 0x47CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5097, 0x4BD7, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59EA, 0x4661, 0x4C45, 0x4EA3, 0xFFFF, 0xFFFF, 0x4895, 0x59F0, 0x59F1, 0xFFFF,
+    0x464F, 0xFFFF, 0xFFFF, 0xFFFF, 0x59EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C60, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x59EF, 0x59EE, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AAE, 0xFFFF, 0xFFFF, 0x59ED, 0xFFFF, 0xFFFF, 0x59EB, 0xFFFF, 0x5056, 0xFFFF, 0x59F2,
+  },
+  { /* U+60xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59F7, 0x59FD,
+    0x59F5, 0xFFFF, 0x4CD6, 0xFFFF, 0xFFFF, 0x59FA, 0x4EF0, 0xFFFF, 0xFFFF, 0x59F4, 0xFFFF, 0x59F9, 0x509F, 0x46AD, 0xFFFF, 0xFFFF,
+    0x5081, 0x59F3, 0xFFFF, 0xFFFF, 0xFFFF, 0x47CC, 0x59FC, 0x466E, 0x54DE, 0x59F6, 0x4E71, 0x59FB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5542,
+    0xFFFF, 0x59F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x59FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5A42, 0x5256, 0x5A4C, 0xFFFF, 0xFFFF, 0x5A49, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A48, 0x4BCA, 0xFFFF, 0x5A4A, 0xFFFF, 0xFFFF,
+    0x4BD5, 0xFFFF, 0x47C7, 0xFFFF, 0xFFFF, 0x5298, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A50, 0x5A41, 0xFFFF, 0xFFFF, 0x5A44, 0xFFFF, 0x5A47,
+    0x5A43, 0xFFFF, 0x5594, 0x5A4B, 0x5A4D, 0x4ECE, 0xFFFF, 0xFFFF, 0x53B8, 0x4C81, 0x5A45, 0x5A4F, 0x5A4E, 0x494E, 0xFFFF, 0x4BB0,
+    0x5384, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4643, 0xFFFF, 0x5A46, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5A52, 0xFFFF, 0x5A53, 0x5A55, 0x5A51, 0xFFFF, 0xFFFF, 0xFFFF, 0x5469, 0x5A57, 0x5A5C, 0x4DE3, 0x5544, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5A5A, 0xFFFF, 0x5091, 0xFFFF, 0x5A58, 0x5A59, 0xFFFF, 0xFFFF, 0x5A54, 0x5A56, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AB1,
+    0x4DD8, 0xFFFF, 0xFFFF, 0x4DEB, 0xFFFF, 0xFFFF, 0x4873, 0x5A5B, 0xFFFF, 0x4BCD, 0x4965, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4C9D, 0x5276, 0x53A3, 0x5A64, 0x5554, 0xFFFF, 0x5A5E, 0xFFFF, 0xFFFF, 0xFFFF, 0x5145, 0x5A62, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x485F, 0x5A63, 0x4E65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4E78, 0xFFFF, 0x5A61, 0xFFFF, 0x5A65, 0xFFFF, 0xFFFF, 0x5A66, 0xFFFF, 0x549D, 0xFFFF, 0x4ED7, 0xFFFF, 0x5A5F, 0x4FE0,
+    0x5A60, 0x5A5D, 0xFFFF, 0x4B68, 0xFFFF, 0xFFFF, 0xFFFF, 0x554A, 0x506E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x54B8, 0x5A73, 0x5A68, 0x48B3, 0x5A6E, 0xFFFF, 0x5A6B, 0x5A6C, 0xFFFF, 0x5472, 0x5A6F, 0x5A72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+61xx */
+    0x5A6D, 0x5282, 0xFFFF, 0x5A70, 0xFFFF, 0xFFFF, 0x5A6A, 0xFFFF, 0x53C8, 0x5098, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A74, 0x5A75, 0x4763,
+    0xFFFF, 0x5A76, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52B2, 0x45C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x47F7,
+    0x5A67, 0x5A71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A7B, 0x5A7A, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A80, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5A7E, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A81, 0xFFFF, 0xFFFF, 0x5A79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A7F, 0x5A84, 0x5A7C, 0x51E3,
+    0xFFFF, 0xFFFF, 0x5A85, 0xFFFF, 0x5A86, 0xFFFF, 0xFFFF, 0x5A77, 0x4CBE, 0xFFFF, 0x5A7D, 0x48FD, 0x538E, 0x5A78, 0x4A76, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5A92, 0xFFFF, 0x52E3, 0xFFFF, 0xFFFF, 0x5A8A, 0x5A8B, 0x5A8C, 0xFFFF, 0xFFFF, 0x5A83, 0xFFFF, 0x5A91,
+    0xFFFF, 0xFFFF, 0x4DDB, 0x4DD3, 0xFFFF, 0x5A82, 0xFFFF, 0x4EB6, 0x528A, 0xFFFF, 0xFFFF, 0x5A8D, 0xFFFF, 0xFFFF, 0x4C49, 0x5A8F,
+    0x4FAD, 0x5A90, 0xFFFF, 0x5A87, 0x5A8E, 0x5A93, 0x48A8, 0x5A89, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53F4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x507C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5A88, 0xFFFF, 0xFFFF, 0x5A99, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F4A, 0xFFFF,
+    0x555B, 0x5A9A, 0xFFFF, 0xFFFF, 0x5A98, 0xFFFF, 0x5A96, 0xFFFF, 0x5A94, 0x5A95, 0x55CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FFC, 0xFFFF, 0xFFFF, 0x53C2, 0xFFFF, 0x5175, 0xFFFF, 0x5A9B, 0x5A97, 0xFFFF, 0x5A9C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x47BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E6C, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AA3, 0xFFFF, 0xFFFF, 0xFFFF, 0x51A5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5AA1, 0xFFFF, 0xFFFF, 0x5AA2, 0x4EA4, 0x5AA0, 0x5A9F, 0x5A9E, 0x5AA4, 0x5A9D, 0x5AA6, 0xFFFF, 0xFFFF,
+    0x4EF2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5AA8, 0xFFFF, 0xFFFF, 0x5AA7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5153, 0xFFFF, 0x5AA9, 0xFFFF, 0x5AAB, 0x5AAA, 0x4DC6, 0xFFFF, 0x5AAD, 0xFFFF, 0x5AAF, 0x5AAC, 0x5AB0, 0x5AAE,
+  },
+  { /* U+62xx */
+    0x5AB1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AB2, 0x5AB3, 0x5161, 0xFFFF, 0x5460, 0x5AB4, 0x517F, 0xFFFF,
+    0x45BA, 0x49DE, 0x4DA0, 0x5AB5, 0x5AB6, 0xFFFF, 0x4D7F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5595, 0x5AB7, 0xFFFF, 0x646E, 0x5AB8, 0x54D9,
+    0xFFFF, 0x5AB9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4764, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ABA, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ABB, 0x4F92,
+    0x5ABC, 0xFFFF, 0x5ABD, 0x5ABE, 0x5092, 0xFFFF, 0xFFFF, 0xFFFF, 0x45CF, 0xFFFF, 0xFFFF, 0x4C44, 0xFFFF, 0xFFFF, 0xFFFF, 0x47DC,
+    0x458C, 0x5ABF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DCA, 0x655D, 0x50AD, 0xFFFF, 0x45CB, 0xFFFF, 0x49F1, 0x5AC0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x47EA, 0xFFFF, 0x4981, 0xFFFF, 0xFFFF, 0x55D5, 0xFFFF, 0xFFFF, 0x5AC3, 0xFFFF, 0xFFFF, 0x5AC1, 0xFFFF,
+    0x5AC4, 0xFFFF, 0xFFFF, 0x5AC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AC5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54B7, 0xFFFF,
+    0xFFFF, 0x4C69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D7A, 0xFFFF, 0xFFFF, 0x4C76, 0xFFFF, 0xFFFF, 0x5AC6, 0xFFFF, 0x5ACA, 0x4C48,
+    0x48F7, 0xFFFF, 0x5AC7, 0x5ACD, 0x4EC0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AC8, 0x4EE3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4D66, 0x5AC9, 0x5ACB, 0x5ACE, 0x4751, 0x5ACC, 0x4A67, 0x498D, 0xFFFF, 0xFFFF, 0x5ADC, 0x4A85, 0xFFFF, 0x4E7E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ADA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA6, 0x5AD3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4C86, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B90, 0xFFFF, 0xFFFF, 0xFFFF, 0x51E0, 0xFFFF, 0x5AD1, 0x49E1, 0x4D53, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5AD9, 0xFFFF, 0xFFFF, 0x4AA1, 0x5AD4, 0x5ADB, 0x5AD5, 0x5ADD, 0x5AD8, 0xFFFF, 0x5345, 0x4FBA, 0xFFFF, 0x5AD2,
+    0x53A2, 0x5AD0, 0x4F61, 0x4BDB, 0x5AD7, 0xFFFF, 0xFFFF, 0x5ACF, 0x5045, 0x525C, 0xFFFF, 0x4BFD, 0x5AD6, 0x4EE2, 0xFFFF, 0xFFFF,
+    0x4D77, 0x48E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FC5, 0x4EE5, 0x5ADF, 0x5AE4,
+    0xFFFF, 0x5AE0, 0xFFFF, 0x508D, 0xFFFF, 0x5AE5, 0x4F9E, 0x55B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DD7, 0x5AE6,
+  },
+  { /* U+63xx */
+    0xFFFF, 0x46D8, 0x5AE2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47B6, 0x5AE3, 0x5489, 0xFFFF, 0xFFFF, 0x5ADE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4FDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B82, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55B1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AE1, 0x4F81, 0xFFFF, 0xFFFF, 0x548F, 0xFFFF, 0xFFFF, 0xFFFF, 0x48F6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5387, 0xFFFF, 0xFFFF, 0x52A8, 0x5AE9, 0x5555,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53A0, 0xFFFF, 0xFFFF, 0x557D, 0x5AE8, 0xFFFF, 0x5AEA,
+    0x5AE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C41, 0xFFFF, 0x5546, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DDD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5285, 0x4BB3, 0x5AF5, 0xFFFF, 0x5AF4, 0xFFFF, 0xFFFF, 0x4ED6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5493, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AEF, 0x4D8F, 0xFFFF, 0xFFFF, 0x4FC0, 0x54C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5AED, 0xFFFF, 0xFFFF, 0x4DC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C61, 0x5AF2, 0xFFFF, 0xFFFF, 0x4EEC, 0xFFFF, 0x5AEC, 0x5AF1,
+    0xFFFF, 0xFFFF, 0x4CFA, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AEB, 0xFFFF, 0x4D44, 0xFFFF, 0xFFFF, 0x4AE3, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AF3,
+    0x55E6, 0x4B4F, 0x4B7F, 0x5AF0, 0xFFFF, 0x47A8, 0xFFFF, 0x4CAC, 0x48D5, 0x55D0, 0x4A60, 0x5AEE, 0x5541, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4DC1, 0xFFFF, 0x54CD, 0x5AF6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54A3, 0xFFFF, 0xFFFF, 0x5AF7, 0xFFFF,
+    0x5AF9, 0xFFFF, 0xFFFF, 0x4EFD, 0x5B42, 0xFFFF, 0x5AFA, 0xFFFF, 0xFFFF, 0x5AFD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BCF,
+    0x49B9, 0xFFFF, 0x5AFE, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CF2, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C46, 0x49AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4D60, 0xFFFF, 0x5AFC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5AF8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BF2, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD5, 0x5AFB, 0x5B41, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+64xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B44, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BD8, 0xFFFF, 0x5B4B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5B45, 0xFFFF, 0xFFFF, 0x5B4C, 0x5B49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B48, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B46, 0xFFFF, 0x5B4A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DC8, 0x528F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B43, 0xFFFF, 0x5B47, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E49, 0xFFFF, 0xFFFF, 0xFFFF, 0x50A3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4E8C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B4D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DCB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5B50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B4E, 0xFFFF, 0x48D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B4F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B51, 0xFFFF, 0x55F5, 0xFFFF, 0x51EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4A74, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x53DE, 0x5B57, 0xFFFF, 0x5B55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5348, 0xFFFF, 0xFFFF, 0x5B53, 0x55DB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E7A, 0x5B58, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B59, 0xFFFF, 0x51E1, 0xFFFF, 0x4E62, 0x4C77, 0xFFFF,
+    0x5372, 0xFFFF, 0x4EC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B52, 0xFFFF, 0x5B56, 0x5B5B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x514E, 0x5B62, 0xFFFF, 0xFFFF, 0x5B5E, 0xFFFF, 0x5B5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x499B, 0x5B54, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5B5D, 0xFFFF, 0x5B60, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B61, 0xFFFF, 0x5B5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5B65, 0x5B66, 0x5543, 0x5B67, 0xFFFF, 0xFFFF, 0x4FD6, 0x5B64, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FCD, 0xFFFF, 0xFFFF, 0x5B68,
+    0xFFFF, 0x5B63, 0x5B6B, 0xFFFF, 0x5B69, 0xFFFF, 0x5B6A, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B6C, 0xFFFF, 0xFFFF, 0x5B6E, 0x55F6, 0xFFFF,
+  },
+  { /* U+65xx */
+    0x5B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B6F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B70, 0x5B71, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5B74, 0x5B73, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x527F, 0x5B75, 0x5B76, 0xFFFF, 0xFFFF, 0x477B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B77, 0x5B78, 0x5B7A, 0x5B79, 0x5B7B, 0x488F, 0xFFFF, 0x4BC5, 0xFFFF, 0xFFFF, 0x48AF, 0x45C7,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AF7, 0xFFFF, 0xFFFF, 0x5B7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B80, 0x5B7E, 0x4647,
+    0xFFFF, 0x4C5C, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B82, 0x5B7F, 0x4B8A, 0x5B81, 0x47A5, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B83, 0x51B1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4FCF, 0x4AC9, 0xFFFF, 0xFFFF, 0x49F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47B0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x46CC, 0xFFFF, 0x5B84, 0xFFFF, 0x477C, 0x4BF3, 0xFFFF, 0x4951, 0x5B85, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5B86, 0x5B87, 0xFFFF, 0xFFFF, 0xFFFF, 0x45CA, 0x58ED, 0x468E, 0xFFFF, 0xFFFF, 0x519D, 0xFFFF, 0x47DB, 0xFFFF,
+    0x4B80, 0x52E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E83, 0xFFFF, 0x464E, 0xFFFF, 0x5B89, 0x4BD1, 0xFFFF, 0xFFFF, 0x5B8A,
+    0xFFFF, 0x5581, 0xFFFF, 0xFFFF, 0x54CF, 0x5141, 0xFFFF, 0x51C2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B8B, 0x4EFC, 0x4989, 0xFFFF, 0x4EA5,
+    0x4587, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B8C, 0xFFFF, 0x45CD, 0xFFFF, 0xFFFF, 0x4DA4, 0x4888, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5B8F, 0xFFFF, 0x5B8D, 0x5B90, 0x4ACF, 0x5B8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D7B, 0x5B91, 0xFFFF, 0xFFFF, 0x4ADC,
+    0xFFFF, 0xFFFF, 0x5B92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DAB, 0xFFFF, 0x5B93, 0xFFFF, 0x5165, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5B95, 0x5B94, 0x4B77, 0xFFFF, 0xFFFF, 0x4562, 0x4D9D, 0x4C7B, 0x4D6A, 0x46E9, 0xFFFF, 0xFFFF, 0x4D67, 0x47EC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5B96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA3, 0x5B9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+66xx */
+    0x5B97, 0xFFFF, 0x5B99, 0x5B9B, 0xFFFF, 0xFFFF, 0x4FE7, 0x46FE, 0xFFFF, 0x5B9D, 0x528E, 0xFFFF, 0x46D1, 0xFFFF, 0x45A6, 0x54E8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x47E9, 0x4C59, 0x5B98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BA3, 0xFFFF, 0x5BA1, 0x47A9,
+    0x47AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BA4, 0x4662, 0xFFFF, 0x559D, 0x48E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45B3, 0x5BA0, 0x4BBB,
+    0xFFFF, 0x52EB, 0xFFFF, 0xFFFF, 0x5BA2, 0x5B9F, 0x5193, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F9F, 0x4C98, 0xFFFF, 0xFFFF, 0x5B9E,
+    0xFFFF, 0x5251, 0x4651, 0x48B0, 0x5BA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BA6, 0xFFFF, 0x4BB2, 0xFFFF, 0xFFFF, 0xFFFF, 0x51EA,
+    0xFFFF, 0xFFFF, 0x54C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BA8, 0xFFFF, 0x5BAB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BAD, 0x5BA9, 0x4FCE,
+    0xFFFF, 0xFFFF, 0x5BAC, 0xFFFF, 0x5BAA, 0x5BA7, 0x556D, 0x50A0, 0x51B2, 0x4CB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49F8, 0x4993,
+    0x5BB0, 0xFFFF, 0xFFFF, 0x5BAF, 0x4795, 0xFFFF, 0x4AF8, 0xFFFF, 0xFFFF, 0xFFFF, 0x46A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4C83, 0xFFFF, 0x5BB1, 0x5BB3, 0xFFFF, 0xFFFF, 0x4F46, 0x5BB2, 0x4ED1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FAB, 0xFFFF,
+    0xFFFF, 0x4FBE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D6C, 0x4BE2, 0x5BB5, 0x5BB4, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BB7, 0xFFFF, 0xFFFF,
+    0x5BB6, 0xFFFF, 0x4CC7, 0xFFFF, 0xFFFF, 0xFFFF, 0x50CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5093, 0xFFFF, 0xFFFF, 0x4AFE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5BB8, 0xFFFF, 0x4CB2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BBF, 0x5243, 0xFFFF, 0xFFFF, 0x5BBE, 0xFFFF, 0x5BBD, 0x5BBB,
+    0xFFFF, 0x5BBA, 0xFFFF, 0xFFFF, 0x5BB9, 0xFFFF, 0xFFFF, 0x4C56, 0xFFFF, 0x5BBC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BC0, 0xFFFF, 0xFFFF, 0x5152, 0x5BC1, 0xFFFF, 0x4BFE, 0x52A6, 0xFFFF, 0xFFFF,
+    0x51CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BC2, 0xFFFF, 0xFFFF, 0x5BC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5BC4, 0xFFFF, 0x49B6, 0x4EBC, 0x4A6D, 0x5BC5, 0xFFFF, 0x5BC6, 0x479D, 0x4ED2, 0x5BC7, 0x5397, 0x578D, 0x495F, 0x5166, 0x4BC3,
+  },
+  { /* U+67xx */
+    0x46F5, 0xFFFF, 0xFFFF, 0x56AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4561, 0x4685, 0xFFFF, 0x4BC4, 0xFFFF, 0x47D4, 0x5BC8, 0x54FD,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA4, 0x55F3, 0x5BCA, 0x486E, 0xFFFF, 0xFFFF, 0xFFFF, 0x47BB, 0xFFFF, 0x475C, 0x5BCB, 0x468B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BCD, 0x5BCE, 0x456C, 0xFFFF, 0x49C6, 0x4746, 0x4566, 0x48F9, 0x5BD0, 0xFFFF,
+    0xFFFF, 0x4D42, 0xFFFF, 0xFFFF, 0x4EA2, 0xFFFF, 0x5BD2, 0x5BD3, 0x5BD4, 0xFFFF, 0x4D96, 0xFFFF, 0xFFFF, 0x50F0, 0xFFFF, 0x5BD1,
+    0xFFFF, 0x534F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BD5, 0xFFFF, 0xFFFF, 0x4668, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E51, 0x50D0,
+    0x46BC, 0x4556, 0xFFFF, 0x54C1, 0xFFFF, 0xFFFF, 0x50F4, 0xFFFF, 0xFFFF, 0x5BD7, 0xFFFF, 0xFFFF, 0x525D, 0xFFFF, 0x5BD6, 0x4B4B,
+    0x5480, 0x475E, 0x51A6, 0x5291, 0x5BD9, 0x4676, 0x5BD8, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BDE, 0xFFFF, 0xFFFF, 0x508B, 0xFFFF, 0x4C63,
+    0x5BDC, 0x4557, 0x5B9A, 0x5BE0, 0xFFFF, 0x4AA6, 0xFFFF, 0x5280, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54DF, 0xFFFF, 0x4578, 0x46B4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BDB, 0xFFFF, 0x525E, 0xFFFF, 0x5BDA, 0xFFFF, 0x5BDF, 0x54F2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4AE2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F78, 0xFFFF, 0x45A2, 0xFFFF, 0xFFFF, 0x49D9, 0xFFFF, 0x47B9, 0x4672, 0xFFFF, 0xFFFF,
+    0x4FD2, 0x5BE2, 0x52D0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BE1, 0xFFFF, 0xFFFF, 0x5BDD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5061,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x54C9, 0x5BE6, 0xFFFF, 0x4EE8, 0x5BE4, 0x5BE9, 0x5BF2, 0xFFFF, 0x5BE3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5BF0, 0x55CD, 0xFFFF, 0xFFFF, 0x4A7F, 0xFFFF, 0x5BF4, 0xFFFF, 0xFFFF, 0xFFFF, 0x52D9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BF1, 0x4980,
+    0x504A, 0x4EC1, 0xFFFF, 0x489B, 0x4DEA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FD8, 0xFFFF, 0x4EE1, 0xFFFF, 0xFFFF, 0x5BED, 0x54F3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5BEE, 0xFFFF, 0x5BEB, 0xFFFF, 0xFFFF, 0x5BEA, 0xFFFF, 0x5BE8, 0xFFFF, 0xFFFF, 0x5BE7, 0xFFFF, 0x5BEF, 0x5BE5,
+    0xFFFF, 0x4BEA, 0xFFFF, 0x46EA, 0x47A7, 0x51F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4773, 0xFFFF, 0xFFFF, 0x5054, 0x4AC1,
+  },
+  { /* U+68xx */
+    0xFFFF, 0x5BF3, 0x52D1, 0x47D3, 0x45FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x50E3, 0xFFFF, 0xFFFF, 0x4DCC, 0x479B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BF5, 0xFFFF,
+    0xFFFF, 0x48BF, 0x5242, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52DE, 0x4856, 0x52E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5BFA, 0xFFFF, 0x55DA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B9E, 0x4667, 0xFFFF, 0xFFFF, 0x47DE, 0x4DE0, 0xFFFF, 0xFFFF,
+    0x5BF8, 0x50D6, 0x49AB, 0x4ADA, 0x5BF9, 0xFFFF, 0x5BF6, 0xFFFF, 0x48F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BF7, 0x5BFB, 0xFFFF,
+    0x49C0, 0x4879, 0x5BEC, 0x536D, 0x534B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BFD, 0xFFFF, 0xFFFF, 0x4771, 0x4D88, 0xFFFF, 0x51F3,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5BFC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5046, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C4B, 0xFFFF, 0x4E77, 0x5C41, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C44, 0x5C42,
+    0xFFFF, 0x4E44, 0xFFFF, 0x5C48, 0xFFFF, 0x4798, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BFE, 0xFFFF, 0x5C45,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x50DA, 0x5C47, 0xFFFF, 0xFFFF, 0x52CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x53BC, 0xFFFF, 0x4E92, 0xFFFF, 0x5C43,
+    0x52C6, 0xFFFF, 0x50AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x58A4, 0x52D3, 0x4858, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C46, 0xFFFF, 0x51E4,
+    0x4682, 0x5359, 0xFFFF, 0x5361, 0xFFFF, 0x5C4C, 0x49AD, 0xFFFF, 0xFFFF, 0x5C4A, 0x5C4D, 0xFFFF, 0x5C49, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EB1, 0xFFFF, 0x5C60, 0xFFFF, 0x5386, 0x55CA, 0x5C50, 0x4EF1, 0xFFFF, 0x5C56, 0xFFFF, 0x5C5F,
+    0xFFFF, 0xFFFF, 0x4B5A, 0xFFFF, 0x5C57, 0x5C59, 0xFFFF, 0x54C2, 0x5C52, 0xFFFF, 0x4BEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EA9,
+    0x5C5E, 0x5C54, 0xFFFF, 0x5C5D, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C58, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x459D, 0x5C5B,
+    0xFFFF, 0xFFFF, 0x5375, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5494, 0x55B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+69xx */
+    0x5468, 0x5C4F, 0xFFFF, 0xFFFF, 0x5C5C, 0x4FF7, 0xFFFF, 0xFFFF, 0x5C51, 0xFFFF, 0xFFFF, 0x4DFD, 0x5C55, 0x47C5, 0x4BA0, 0x5C4E,
+    0xFFFF, 0xFFFF, 0x5C5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FED, 0x5370, 0x5163, 0x486D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5C63, 0x5C61, 0x5C64, 0xFFFF, 0x53FA, 0x5C53, 0xFFFF, 0x5C65, 0xFFFF, 0x5C62, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5C71, 0xFFFF, 0xFFFF, 0xFFFF, 0x54A7, 0xFFFF, 0x5C69, 0xFFFF, 0xFFFF, 0x52ED, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C6F, 0xFFFF, 0x4CBA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5295, 0x5C6B, 0x55C5, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C70, 0x534C, 0xFFFF, 0x54E2, 0x5C73, 0x5C72, 0xFFFF,
+    0x4ADF, 0x527C, 0x4D93, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C6E, 0xFFFF, 0x5C6C, 0x54A2, 0xFFFF, 0x456B, 0x53EF, 0x4FAE,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x52B3, 0x5C6D, 0x49B7, 0xFFFF, 0x5C68, 0x5C6A, 0x5C67, 0xFFFF, 0xFFFF, 0x52BA, 0x4761, 0x5C74, 0xFFFF,
+    0xFFFF, 0x5C75, 0x4C42, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B52, 0xFFFF, 0xFFFF, 0xFFFF, 0x49EB, 0xFFFF,
+    0xFFFF, 0x5476, 0xFFFF, 0xFFFF, 0x55C7, 0x5C86, 0xFFFF, 0xFFFF, 0x5C79, 0xFFFF, 0xFFFF, 0x4D7E, 0x5C85, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5C84, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x538D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x514A, 0xFFFF,
+    0xFFFF, 0x5C80, 0x5C76, 0xFFFF, 0x53B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C82, 0xFFFF, 0xFFFF, 0x5C7C, 0x5C77,
+    0xFFFF, 0x5C7A, 0xFFFF, 0x5C83, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DB9, 0xFFFF, 0xFFFF, 0x5C7F, 0x4796, 0x4EFA, 0x52DB, 0x5C7D, 0xFFFF,
+    0x548C, 0xFFFF, 0xFFFF, 0x5C7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4848, 0x6881, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C81, 0x5C87, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5C90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C8F, 0x5C89, 0xFFFF, 0xFFFF, 0x5C94, 0xFFFF, 0x5C92, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5C8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C8D, 0xFFFF, 0x4B5C, 0xFFFF, 0x4DB7, 0xFFFF, 0x5C8C,
+  },
+  { /* U+6Axx */
+    0xFFFF, 0xFFFF, 0x5C8A, 0xFFFF, 0xFFFF, 0x53BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C95, 0x494F, 0x5C9D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5C97, 0x5C99, 0x5C93, 0xFFFF, 0xFFFF, 0x538B, 0xFFFF, 0x4966, 0xFFFF, 0x5C8B, 0xFFFF, 0xFFFF, 0x5C91, 0x539B,
+    0xFFFF, 0x4864, 0x5C96, 0x5C98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48DC, 0x45F2, 0x4B6F, 0xFFFF, 0xFFFF, 0x5C88, 0xFFFF,
+    0x5C9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5585, 0x5C9F, 0xFFFF, 0x5CA7, 0x46CF, 0x4E69, 0xFFFF, 0xFFFF, 0x4BBE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C9C, 0xFFFF, 0x5CA6, 0x5CA1, 0x5CA5, 0xFFFF, 0xFFFF, 0x4589, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BC2, 0x5CA3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4579,
+    0xFFFF, 0x55D4, 0x5CA2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CA4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5C9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5CA8, 0x5CA9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CAF, 0x4FB2,
+    0x4FF5, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CAB, 0x55EE, 0xFFFF,
+    0x5CAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CB0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D55, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5C9E, 0xFFFF, 0x5CAD, 0x5CAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CB2, 0xFFFF, 0x5CB1, 0xFFFF, 0x545D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5CB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CB5, 0xFFFF, 0xFFFF, 0x5CB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5CB7, 0x5CB4, 0x528B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5CBA, 0xFFFF, 0x5586, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CBB, 0x4DA6, 0xFFFF, 0xFFFF, 0x5CB8, 0x5362,
+    0xFFFF, 0xFFFF, 0x5CB9, 0xFFFF, 0x5CBC, 0xFFFF, 0xFFFF, 0xFFFF, 0x51C5, 0xFFFF, 0x5CBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CC2, 0x52EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EDE, 0x5CC0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5CC3, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CC4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55F7, 0xFFFF, 0x5CC5,
+    0x4CB5, 0x4597, 0xFFFF, 0x4B9D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4BF6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CC7, 0x5CC6, 0x5CC8, 0x517D, 0xFFFF, 0xFFFF, 0x4CF8, 0x4EFB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5CCC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CCB, 0xFFFF, 0x5CCD, 0xFFFF, 0xFFFF, 0x46F7, 0xFFFF, 0x5487, 0xFFFF,
+    0x5CCE, 0xFFFF, 0xFFFF, 0x4D4E, 0x5CD0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CCF, 0xFFFF, 0x5CD1, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CD2,
+    0xFFFF, 0x5CD3, 0x48D8, 0x4577, 0x4D4C, 0xFFFF, 0x45B1, 0xFFFF, 0xFFFF, 0x47D8, 0x558E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A9F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x48E4, 0x4955, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CD4, 0x5CD5, 0xFFFF, 0x4999, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CD6,
+    0x5CD7, 0xFFFF, 0xFFFF, 0x5CD9, 0x5CD8, 0xFFFF, 0x4F42, 0xFFFF, 0xFFFF, 0x53A4, 0x4865, 0x4992, 0xFFFF, 0x5CDA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CDC, 0x4E73, 0xFFFF, 0x5CDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CDD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CDF, 0x5CE0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CE1,
+    0xFFFF, 0x5CE2, 0x5CE3, 0x5CE4, 0x5459, 0x47ED, 0xFFFF, 0x5CE5, 0xFFFF, 0xFFFF, 0x49E9, 0x50C0, 0x5CE6, 0xFFFF, 0xFFFF, 0x4849,
+    0x587F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A5B, 0x5CE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CE8, 0xFFFF, 0x4969, 0x49F5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4C97, 0x5CE9, 0x474E, 0xFFFF, 0x5CEA, 0xFFFF, 0x53D7, 0xFFFF, 0xFFFF, 0x46E2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CEB,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CED, 0x5CEC, 0xFFFF, 0xFFFF, 0x5CEF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5CEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x488E,
+    0xFFFF, 0x4756, 0xFFFF, 0x5CF1, 0x5CF2, 0xFFFF, 0xFFFF, 0x45B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5CF5, 0x5CF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x459C, 0xFFFF, 0xFFFF, 0x4CA4, 0x45FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x556E, 0x5CF6,
+    0x534D, 0x4D84, 0x49A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x505E, 0xFFFF,
+    0x506A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CF8, 0xFFFF, 0x4EC4, 0xFFFF, 0xFFFF, 0x4E82, 0xFFFF, 0x5CF9, 0x555E, 0x5CF7, 0x45AD,
+    0x45E8, 0xFFFF, 0x5CFA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D45, 0xFFFF, 0x52B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5CFE,
+    0x50D2, 0xFFFF, 0x50C8, 0x5D46, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47A4, 0xFFFF, 0xFFFF, 0x494C, 0x5D44, 0xFFFF,
+    0xFFFF, 0x5D42, 0x5CFB, 0x55D9, 0xFFFF, 0xFFFF, 0x5CFD, 0xFFFF, 0x4C8F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5598, 0x5CFC, 0xFFFF, 0xFFFF,
+    0x5D48, 0xFFFF, 0x5D47, 0x4FF8, 0xFFFF, 0xFFFF, 0x47FD, 0xFFFF, 0xFFFF, 0x4EAD, 0x5D41, 0x5D43, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5075, 0x4585, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53EC, 0xFFFF, 0xFFFF, 0x5D4D, 0xFFFF,
+    0xFFFF, 0x5D50, 0xFFFF, 0x465A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EAA, 0x465C, 0x5D52, 0x4584, 0x46C6, 0x5D4B, 0x5D51, 0x4E6F,
+    0xFFFF, 0x4A58, 0xFFFF, 0xFFFF, 0x5D49, 0x5D4C, 0xFFFF, 0xFFFF, 0xFFFF, 0x46EE, 0x4DB8, 0xFFFF, 0x51FD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x54D7, 0xFFFF, 0x464A, 0xFFFF, 0x55C6, 0xFFFF, 0x5D55, 0x5D4E, 0x5D53, 0xFFFF, 0x5D4F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4E87, 0x46CA, 0x4D4B, 0xFFFF, 0x4E56, 0xFFFF, 0xFFFF, 0x4944, 0xFFFF, 0x5D56, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D54,
+    0x46F3, 0x5D4A, 0xFFFF, 0x4F57, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D58, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45DA, 0x5D5E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5D5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A4E, 0xFFFF, 0x52B6, 0xFFFF, 0x5450, 0xFFFF, 0xFFFF, 0x4D98, 0x5D57,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45DC, 0xFFFF, 0xFFFF, 0xFFFF, 0x50B7, 0x4FD4, 0x5D5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4B72, 0x5D5C, 0xFFFF, 0x52AC, 0x5D59, 0xFFFF, 0x50BC, 0xFFFF, 0xFFFF, 0x47B4, 0xFFFF, 0x5D5B, 0x4A72, 0xFFFF,
+    0xFFFF, 0x46FC, 0xFFFF, 0xFFFF, 0x4CC9, 0x468D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D66, 0x5D64, 0xFFFF, 0x45EA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5D5F, 0x5D63, 0xFFFF, 0x466B, 0xFFFF, 0xFFFF, 0x46EB, 0x4A9D, 0xFFFF, 0x55CC, 0xFFFF, 0x4A8C, 0x5D62,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B7E, 0xFFFF, 0xFFFF, 0x45A7, 0x4D41, 0x5D65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D6A, 0xFFFF, 0x5D60, 0x486B, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F7D, 0xFFFF, 0x5D67, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5D61, 0xFFFF, 0x5D68, 0x5D6B, 0xFFFF, 0xFFFF, 0x4DDA, 0xFFFF, 0x5D69, 0x5550, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D72, 0xFFFF, 0xFFFF, 0x4F91,
+    0xFFFF, 0xFFFF, 0x4A45, 0xFFFF, 0xFFFF, 0x5D6F, 0xFFFF, 0xFFFF, 0x5D73, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E74, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4A88, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D7C, 0x5D75, 0x5D71, 0xFFFF, 0xFFFF, 0xFFFF, 0x52C7, 0x5D78, 0xFFFF, 0xFFFF, 0x5D74,
+    0xFFFF, 0x4ABF, 0x5D7B, 0xFFFF, 0xFFFF, 0x5D82, 0xFFFF, 0xFFFF, 0x55E1, 0x5D7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D77, 0xFFFF,
+    0xFFFF, 0x4CA5, 0xFFFF, 0xFFFF, 0x5D81, 0xFFFF, 0x5D70, 0xFFFF, 0x5D79, 0xFFFF, 0x5D83, 0x554E, 0x5D76, 0xFFFF, 0x5D84, 0xFFFF,
+    0xFFFF, 0x4777, 0x5D7F, 0x4894, 0xFFFF, 0x48EA, 0xFFFF, 0x4B46, 0x5D7A, 0x5D6C, 0x5D7D, 0x4A91, 0x5D80, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4596, 0xFFFF, 0x5441, 0x4769, 0x4AC0, 0x5D6D, 0x4892, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5198, 0xFFFF, 0x5164, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D87, 0x50E4, 0x478A, 0xFFFF, 0x5D99, 0xFFFF, 0x5D92,
+    0x527A, 0x45D2, 0xFFFF, 0x5D8C, 0x5D98, 0x4E43, 0x51A0, 0x5D93, 0xFFFF, 0x4950, 0xFFFF, 0x5D8F, 0x4945, 0x5D85, 0x5D6E, 0x48C6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D9A, 0x5D8A, 0x5D96, 0xFFFF, 0x5D95, 0xFFFF, 0x5D8B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5D94, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C88, 0xFFFF, 0xFFFF, 0x5D91, 0x5D97, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D52, 0xFFFF, 0x5155, 0xFFFF, 0xFFFF, 0x53F3, 0x5D8E, 0xFFFF, 0xFFFF, 0x5D89,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FBD, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D8D, 0xFFFF, 0xFFFF, 0x5D86, 0x48BD,
+    0xFFFF, 0xFFFF, 0x5D88, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D6B, 0x4C90,
+    0x475B, 0xFFFF, 0x5D9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54FA, 0xFFFF, 0xFFFF, 0x5DA5,
+    0x47FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46CE, 0xFFFF, 0x5D9D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DC4, 0x4A4D, 0xFFFF, 0x5DA8,
+    0xFFFF, 0xFFFF, 0x5271, 0xFFFF, 0xFFFF, 0x5376, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5D9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DA0,
+    0xFFFF, 0xFFFF, 0x5DA2, 0xFFFF, 0xFFFF, 0xFFFF, 0x48BE, 0x5D9E, 0xFFFF, 0xFFFF, 0x5497, 0xFFFF, 0xFFFF, 0x5D9F, 0xFFFF, 0x5DA6,
+    0xFFFF, 0xFFFF, 0x5DA7, 0xFFFF, 0x5DA1, 0x4EE6, 0xFFFF, 0xFFFF, 0xFFFF, 0x52A9, 0xFFFF, 0x4857, 0x5DB3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4BA2, 0xFFFF, 0x524A, 0x5DA3, 0x5DA4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47A3, 0x4DA1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DAB, 0xFFFF, 0xFFFF, 0x5DB1,
+    0xFFFF, 0xFFFF, 0x5DAF, 0xFFFF, 0x4FB7, 0xFFFF, 0xFFFF, 0x5DB7, 0x5DAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DAD, 0x5DB4,
+  },
+  { /* U+6Fxx */
+    0xFFFF, 0x4B78, 0x4FBC, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DAE, 0xFFFF, 0xFFFF, 0x54D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50C4,
+    0xFFFF, 0x5575, 0xFFFF, 0x5DB6, 0x49ED, 0x54A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x508E, 0xFFFF, 0x4F58, 0x54E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F6E, 0x4E8A, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DB0, 0x5DB2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D73, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DB5, 0x5DAE,
+    0xFFFF, 0x5DA9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AC2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DC3, 0xFFFF, 0xFFFF, 0x5DBD, 0x4DC0, 0xFFFF, 0xFFFF, 0x46C2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD2, 0xFFFF, 0x5DC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DBE, 0x4C93, 0x5DBC,
+    0x5446, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DBF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DBA, 0xFFFF, 0x5DB9, 0xFFFF, 0x5DC2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5DBB, 0x55A0, 0x5DC0, 0xFFFF, 0x4887, 0xFFFF, 0x5DB8, 0xFFFF, 0x5DC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DC5, 0xFFFF,
+    0xFFFF, 0x5DC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DCB, 0xFFFF, 0x5DC9, 0x4E4B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DCE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5589, 0xFFFF, 0x5DC8, 0xFFFF, 0x5DCA, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DCC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4BD0, 0x50BE, 0x5DCF, 0x4ACE, 0xFFFF, 0xFFFF, 0x5DC4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DD4, 0x5DD1, 0xFFFF, 0xFFFF, 0x5DD3, 0xFFFF, 0xFFFF, 0x5DCD, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DD0,
+    0x5380, 0x507E, 0xFFFF, 0xFFFF, 0x51D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55A3, 0x5DD2, 0xFFFF, 0x5DD6, 0x4DD4,
+    0xFFFF, 0x5055, 0xFFFF, 0x5DE2, 0xFFFF, 0x5DD5, 0x6658, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DDB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5187, 0xFFFF,
+  },
+  { /* U+70xx */
+    0xFFFF, 0x5DDD, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DD7, 0xFFFF, 0x5DD8, 0xFFFF, 0x5DD9, 0xFFFF, 0x5DDA, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DDE,
+    0xFFFF, 0x5DDC, 0xFFFF, 0xFFFF, 0xFFFF, 0x55D1, 0xFFFF, 0xFFFF, 0x5DE4, 0xFFFF, 0x5DE0, 0x5DDF, 0xFFFF, 0x52B0, 0x535C, 0x5DE1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FDE, 0x52AE, 0x5DE3, 0xFFFF, 0xFFFF, 0xFFFF, 0x465B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5DE5, 0xFFFF, 0x5DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DE6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53EA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DE8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5DE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4785, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B65,
+    0x4AF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5473, 0xFFFF, 0xFFFF, 0xFFFF, 0x546A, 0x4CBC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEA, 0xFFFF, 0xFFFF, 0xFFFF, 0x497D, 0x4FCB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DAD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4FEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DED, 0x5DEE, 0x4861, 0x5DF0, 0x5DEC,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x52CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DEF, 0x4788, 0x49D7, 0x529E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DD1, 0xFFFF, 0xFFFF, 0x5DF2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5099,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF3, 0xFFFF, 0xFFFF, 0xFFFF, 0x538C, 0xFFFF, 0x5DF1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5DF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5587, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF8, 0xFFFF, 0xFFFF,
+  },
+  { /* U+71xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DF5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DFA, 0x544F, 0xFFFF, 0x5DF9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x475F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DE6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4983, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5DFC, 0x5DFD, 0xFFFF, 0x4C6F, 0xFFFF, 0xFFFF, 0x5E42, 0xFFFF, 0x5490, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6885, 0x5E43, 0xFFFF, 0xFFFF, 0x4BDD, 0xFFFF, 0xFFFF, 0x5DFB, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5E41, 0xFFFF, 0x54EA, 0x5357, 0x5DFE, 0x4742, 0xFFFF, 0x54A0, 0xFFFF, 0xFFFF, 0x5E44, 0xFFFF, 0x4C4C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5590, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E47, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E45, 0xFFFF, 0x467F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E46,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x529D, 0x5E48, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F68, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EBF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54BB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E4A, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x47D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E4D, 0xFFFF,
+    0xFFFF, 0x5E4B, 0xFFFF, 0x49D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EF8, 0x5E50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E53, 0xFFFF,
+    0x4A79, 0xFFFF, 0x5E4E, 0xFFFF, 0x5E51, 0x5047, 0xFFFF, 0x5E52, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x57FB,
+    0x5E55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C66, 0x54CE, 0x5E4F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E56, 0x54E6, 0x578F, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E54, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E59, 0xFFFF, 0x5E57, 0x5E58, 0xFFFF, 0x5E5A, 0x5E5B,
+  },
+  { /* U+72xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E5C, 0xFFFF, 0xFFFF,
+    0x5E5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x537C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E5E, 0xFFFF, 0x4C87, 0xFFFF, 0x5E60, 0x5E5F, 0xFFFF, 0xFFFF,
+    0x5E61, 0xFFFF, 0x5E62, 0xFFFF, 0xFFFF, 0x53A9, 0x45CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5096, 0x5E63, 0x5E64, 0x52DD, 0x4C79, 0x5E65,
+    0x5E66, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E67, 0x4767, 0x4ABD, 0xFFFF, 0xFFFF, 0x5E68, 0x556F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x55DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E69, 0x53FC, 0xFFFF, 0x4973, 0xFFFF, 0x55B7, 0xFFFF, 0x4AAF,
+    0xFFFF, 0x509A, 0x55C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x487B, 0xFFFF, 0x4652, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5158, 0xFFFF, 0x5E6A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46A2, 0xFFFF, 0xFFFF, 0xFFFF, 0x548A, 0x5E6B, 0xFFFF,
+    0x5354, 0x5E6C, 0x5E6E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5E6F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E70, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4FDC, 0xFFFF, 0x5E71, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AC5, 0xFFFF, 0xFFFF, 0x4CA7,
+    0xFFFF, 0x5E73, 0x5E74, 0xFFFF, 0xFFFF, 0xFFFF, 0x4852, 0xFFFF, 0xFFFF, 0x5E79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E75, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4E5A, 0x5E76, 0x5E78, 0xFFFF, 0x5E77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E7A, 0xFFFF,
+    0x51DB, 0xFFFF, 0x5E7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5274, 0xFFFF, 0x4ECF, 0xFFFF, 0x50DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5E7D, 0x5E7E, 0x5E7C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A7B, 0xFFFF, 0xFFFF, 0x4ADB, 0x4C9E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E80, 0x52FE, 0x5E7F, 0xFFFF, 0xFFFF, 0x506F, 0x54D6, 0xFFFF, 0xFFFF,
+  },
+  { /* U+73xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E82, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E84, 0x5E81, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A51, 0x5E83, 0x5E85, 0xFFFF, 0x4E9D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E86, 0x5E8B, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E88, 0x49C5, 0x4FD0, 0xFFFF, 0xFFFF, 0x4F45, 0x5E89,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E87, 0xFFFF, 0x504F, 0x53DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E8C, 0x4C5A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E95, 0x519F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E8E, 0x5E8D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4F65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E92, 0xFFFF, 0x5E91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5E93, 0xFFFF, 0x4D61, 0xFFFF, 0xFFFF, 0x5E96, 0xFFFF, 0x5E94, 0x5E95, 0xFFFF, 0x51CB, 0x5E97, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C6E, 0xFFFF, 0xFFFF, 0x4783, 0xFFFF, 0x45FD, 0xFFFF, 0x49B1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4AF9, 0x5E9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E9C, 0xFFFF, 0x5E99, 0xFFFF, 0xFFFF,
+    0x5E9D, 0xFFFF, 0x4C9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E98, 0x5E9E, 0x5399, 0xFFFF, 0xFFFF, 0x4D5D, 0x5E9B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5EA2, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EA5, 0xFFFF,
+    0x4B99, 0xFFFF, 0xFFFF, 0x5EA1, 0xFFFF, 0x5EA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CB9, 0xFFFF, 0xFFFF, 0x5066, 0x5EA3, 0xFFFF,
+    0xFFFF, 0x5EA4, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EA8, 0xFFFF, 0xFFFF, 0x5EA6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46B7, 0xFFFF,
+  },
+  { /* U+74xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x48DB, 0xFFFF, 0x5EA9, 0x45EB, 0x5EA7, 0xFFFF, 0x50F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4E5C, 0xFFFF, 0xFFFF, 0x5EAC, 0x5EAA, 0xFFFF, 0xFFFF, 0x5EAD, 0x5EAB, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EAE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5EAF, 0x5453, 0x4CD8, 0x52A3, 0x529F, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB2,
+    0xFFFF, 0x5EB5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB1, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB4, 0x53F1, 0x4F52, 0x5EB6, 0xFFFF, 0x4B5B, 0x5EB3,
+    0x508C, 0xFFFF, 0x5EBC, 0x5EB9, 0x5EBB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EB7, 0x5EBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EBE,
+    0x5EB8, 0xFFFF, 0xFFFF, 0x5188, 0xFFFF, 0xFFFF, 0x6883, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EBF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x528C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EBD, 0xFFFF, 0x504D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC1, 0x5EC0,
+    0xFFFF, 0xFFFF, 0x5EC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4AB9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5249, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E64, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5EC7, 0xFFFF, 0x5452, 0x5EC8, 0xFFFF, 0xFFFF, 0x49C2, 0x5EC9, 0xFFFF, 0x5ECA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ECB, 0xFFFF,
+    0x5ECC, 0x5ECE, 0x5ECD, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CD4, 0x5ECF, 0x5ED0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+75xx */
+    0xFFFF, 0x5ED1, 0xFFFF, 0x5ED3, 0x5ED2, 0x5ED4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5ED6, 0x5ED5, 0x5ED7, 0xFFFF,
+    0xFFFF, 0x5495, 0xFFFF, 0x5ED8, 0xFFFF, 0x53E6, 0xFFFF, 0xFFFF, 0x4B55, 0xFFFF, 0x4B66, 0xFFFF, 0x52A7, 0xFFFF, 0x5ED9, 0x4599,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x45C0, 0xFFFF, 0x55D7, 0x5EDA, 0xFFFF, 0x45B6, 0xFFFF, 0xFFFF, 0x4D58, 0x5EDB, 0xFFFF, 0xFFFF, 0x58FE,
+    0x4563, 0x467C, 0x48A0, 0x4967, 0xFFFF, 0xFFFF, 0xFFFF, 0x457C, 0x5765, 0xFFFF, 0x4555, 0x4677, 0x5EDC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EDD, 0xFFFF, 0x5EE1, 0xFFFF, 0xFFFF, 0x5EE0, 0x5EDF, 0x5B7C, 0x47AE, 0x5EDE, 0xFFFF, 0x558F,
+    0xFFFF, 0x478B, 0xFFFF, 0xFFFF, 0x4EDC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47AB, 0x5EE3, 0x5EE2, 0x4D72, 0x5086, 0xFFFF, 0xFFFF,
+    0x49FE, 0xFFFF, 0x559A, 0xFFFF, 0x5EE4, 0x4CF0, 0x51B4, 0x5EE5, 0xFFFF, 0x52FD, 0x48B9, 0x5EE6, 0xFFFF, 0x5EE9, 0xFFFF, 0x5EE7,
+    0x4AA9, 0xFFFF, 0xFFFF, 0x4E54, 0x5EE8, 0xFFFF, 0x5EEB, 0x50DD, 0x5EEA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50D4,
+    0xFFFF, 0xFFFF, 0x5EEC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EED, 0x5EEE, 0xFFFF, 0x5EF0, 0x5EEF, 0x4EA0, 0xFFFF, 0xFFFF, 0x5171, 0x55B0,
+    0xFFFF, 0x4CB4, 0xFFFF, 0xFFFF, 0x5EF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5EF2, 0xFFFF, 0xFFFF, 0x5EF3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5EF5, 0xFFFF, 0x5EF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5EFD, 0x4D97, 0x5EF7, 0xFFFF, 0x5EF9, 0xFFFF, 0xFFFF, 0x5EFB, 0x54E1, 0xFFFF, 0xFFFF, 0x5EFC, 0x5EFA, 0x5142, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5EF6, 0x5EF8, 0xFFFF, 0x49BF, 0xFFFF, 0x4E4A, 0xFFFF, 0xFFFF, 0x5F41, 0xFFFF, 0xFFFF, 0x5EFE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5F42, 0xFFFF, 0x5182, 0x53FD, 0xFFFF, 0xFFFF, 0x5549, 0x5F43, 0xFFFF, 0x4C47, 0xFFFF, 0xFFFF, 0x5F45, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5174, 0x5F44, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54A4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5F4A, 0xFFFF, 0x5F4C, 0x5F4D, 0x5089, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F4B, 0xFFFF, 0x5F48, 0xFFFF, 0x5F46, 0x5F47,
+  },
+  { /* U+76xx */
+    0xFFFF, 0x5F49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F4F, 0xFFFF, 0x5F4E, 0xFFFF, 0x524F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F50,
+    0x5F52, 0x5F53, 0x5F54, 0xFFFF, 0x5F55, 0xFFFF, 0xFFFF, 0x5F51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5F57, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F56, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F58, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4BB7, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F5C, 0x5F59, 0x5F5A, 0xFFFF, 0xFFFF, 0xFFFF, 0x5447, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x53AA, 0xFFFF, 0xFFFF, 0xFFFF, 0x537E, 0xFFFF, 0x5F5B, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F5D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5F5E, 0x5F5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F62, 0x5F60, 0x5F61, 0x5F63, 0xFFFF, 0x5F64, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5F65, 0xFFFF, 0x5F66, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F67, 0xFFFF, 0x539A, 0xFFFF, 0x464B, 0x46E8, 0x5F68, 0x4659, 0x454B, 0xFFFF,
+    0x5F6A, 0xFFFF, 0x5F69, 0x5F6B, 0x45EF, 0xFFFF, 0x4AB0, 0x4CBB, 0x5F6C, 0xFFFF, 0xFFFF, 0x5F6D, 0xFFFF, 0xFFFF, 0x5299, 0xFFFF,
+    0x52A4, 0xFFFF, 0xFFFF, 0x4E81, 0xFFFF, 0xFFFF, 0x5396, 0xFFFF, 0xFFFF, 0x5F6E, 0x5F6F, 0x5F72, 0x5F70, 0xFFFF, 0x5F71, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F73, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49DA, 0xFFFF,
+    0x5F74, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F75, 0xFFFF, 0xFFFF, 0x6868, 0x5F76, 0x5F77, 0x5F78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DC7,
+    0xFFFF, 0xFFFF, 0x5F79, 0x53BA, 0xFFFF, 0xFFFF, 0x5057, 0xFFFF, 0x51B5, 0xFFFF, 0x4774, 0xFFFF, 0xFFFF, 0x5F7B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5F7D, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F7C, 0x4D65, 0xFFFF, 0xFFFF, 0xFFFF, 0x4844, 0x5CC9, 0xFFFF, 0x5F7E, 0x4B84,
+    0xFFFF, 0x5F7F, 0xFFFF, 0x49E3, 0x4890, 0x5F80, 0xFFFF, 0x53F7, 0xFFFF, 0xFFFF, 0x5F81, 0xFFFF, 0xFFFF, 0xFFFF, 0x4675, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5080, 0xFFFF, 0x4674, 0xFFFF, 0xFFFF, 0xFFFF, 0x4678, 0xFFFF, 0xFFFF, 0x5F83, 0xFFFF, 0xFFFF, 0x5082, 0xFFFF,
+  },
+  { /* U+77xx */
+    0xFFFF, 0x4847, 0xFFFF, 0xFFFF, 0x5F86, 0xFFFF, 0xFFFF, 0x5F85, 0x5F84, 0x52BC, 0xFFFF, 0x4DA2, 0x4552, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F8B, 0xFFFF, 0xFFFF, 0x51CA, 0x4642,
+    0x4E6A, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F87, 0x5F89, 0x5F8A, 0xFFFF, 0xFFFF, 0x5F88, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F8C, 0x5F8D, 0xFFFF, 0x4E5F, 0xFFFF, 0x49A5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x47AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F8E, 0x5F8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F90, 0x5F93, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x526C, 0xFFFF, 0x4A73, 0xFFFF, 0x5F94, 0x4A96, 0xFFFF, 0x5F91, 0xFFFF, 0xFFFF, 0x5F92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F97, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F96, 0x5F95,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F99, 0xFFFF, 0xFFFF, 0x5F98, 0xFFFF,
+    0xFFFF, 0x5F9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5F9C, 0xFFFF,
+    0x5F9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5572, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DB0, 0x527D, 0xFFFF, 0xFFFF,
+    0x5F9D, 0xFFFF, 0xFFFF, 0x4F9B, 0xFFFF, 0xFFFF, 0x5F9E, 0xFFFF, 0xFFFF, 0x5F9F, 0xFFFF, 0x5FA3, 0x5FA1, 0x5FA2, 0xFFFF, 0x5FA0,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FA4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FA5, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5350, 0xFFFF, 0xFFFF, 0x5FA6, 0x50ED, 0x5FA7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x46C1, 0x5FA8, 0xFFFF, 0x45B0, 0xFFFF, 0x55C9, 0xFFFF, 0x4E4D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A82, 0x5FA9, 0x51BB,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4580, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FAB, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+78xx */
+    0xFFFF, 0xFFFF, 0x495B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FAC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5FAD, 0xFFFF, 0x46D3, 0x4CC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5FB0, 0x5FAE, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D45, 0x54B4, 0x5248, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4CC2, 0xFFFF, 0x4ABE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FAF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB2, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4976, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4984, 0x4AEF, 0xFFFF, 0xFFFF, 0x5369,
+    0xFFFF, 0xFFFF, 0x52BF, 0xFFFF, 0x5FB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB6, 0xFFFF, 0x5FB9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4F4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FB7, 0x5195, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FBA, 0x5356, 0x5FB5, 0xFFFF,
+    0xFFFF, 0x517B, 0xFFFF, 0x4FB1, 0xFFFF, 0x52D2, 0xFFFF, 0x545B, 0xFFFF, 0xFFFF, 0x5FB8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x5FBB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DF8, 0xFFFF, 0x507D, 0x5FBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FBE,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FBC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x487A, 0xFFFF, 0x5FC4, 0xFFFF, 0x5FC3, 0xFFFF,
+    0xFFFF, 0x4A62, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC5, 0x5FC0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC6, 0x5FC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4B9C, 0x5FBF, 0xFFFF, 0xFFFF, 0x5FC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC8, 0x49B4, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FC7, 0xFFFF, 0xFFFF, 0x48AA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FCB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FCA, 0xFFFF, 0xFFFF,
+  },
+  { /* U+79xx */
+    0xFFFF, 0x51B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FCC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C9C, 0xFFFF,
+    0xFFFF, 0x5FCD, 0x4DF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FCE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x514C, 0x5FD0, 0x5FCF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5FD1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4853, 0xFFFF, 0x4958, 0xFFFF, 0x4663, 0xFFFF,
+    0x5FD3, 0x53D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5192, 0x4ED8, 0x4FEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x488C, 0xFFFF, 0xFFFF, 0x555C, 0xFFFF, 0x5FD8, 0x4CDC, 0x5365, 0xFFFF, 0xFFFF, 0x5FD7, 0xFFFF, 0xFFFF, 0x4CEB, 0x45A1, 0x5FD6,
+    0x5FD4, 0xFFFF, 0x4F89, 0xFFFF, 0xFFFF, 0x49F9, 0xFFFF, 0xFFFF, 0x4DBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C71, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5553, 0xFFFF, 0xFFFF, 0x52D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FDA,
+    0x50E7, 0x4D75, 0xFFFF, 0xFFFF, 0x50AE, 0x4F87, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FDB, 0xFFFF, 0xFFFF, 0x5286, 0x4BA7, 0x458B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FDC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FDF, 0xFFFF, 0x5FDE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55AA, 0x4FD7, 0xFFFF, 0xFFFF, 0x5FE0, 0xFFFF, 0xFFFF, 0xFFFF, 0x54F5, 0xFFFF,
+    0x50FA, 0xFFFF, 0xFFFF, 0x5FE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x536A, 0x5FE2, 0xFFFF, 0xFFFF, 0x555D, 0x5463, 0x53D0,
+    0x45F1, 0x46C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FE3, 0xFFFF, 0x4658, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x48ED, 0x4DBA, 0xFFFF, 0xFFFF, 0x5FE4, 0xFFFF, 0xFFFF, 0x4C70, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D83,
+    0xFFFF, 0x54B5, 0xFFFF, 0x5FE7, 0x508F, 0xFFFF, 0x4C8A, 0x5FE5, 0xFFFF, 0x4D9F, 0xFFFF, 0xFFFF, 0x5FE6, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4BDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4975, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Axx */
+    0x5264, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FE8, 0xFFFF, 0xFFFF, 0x47F4, 0xFFFF, 0x5FE9, 0x47C4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47FA, 0xFFFF, 0xFFFF, 0x5087, 0x5FEA, 0x5FEB, 0x4DCF, 0xFFFF, 0x5296, 0xFFFF, 0xFFFF, 0x5FEC,
+    0x5366, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4692, 0xFFFF,
+    0xFFFF, 0x5FED, 0x476A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FEF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FF0, 0x4DBE, 0x4FC7, 0x5FEE, 0x4FD5,
+    0x4E94, 0xFFFF, 0x48D4, 0x5FF1, 0xFFFF, 0xFFFF, 0x52BE, 0xFFFF, 0xFFFF, 0x5FF3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4891, 0x5254, 0x50B8,
+    0x509B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FF2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5FF5, 0x5FF4, 0x4E98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FF6, 0xFFFF, 0x4F5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5FF8, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B86, 0xFFFF, 0x4986, 0xFFFF, 0xFFFF, 0x5FF9, 0x478D, 0xFFFF, 0xFFFF, 0x5FFA, 0xFFFF, 0x4E91,
+    0xFFFF, 0x4AFD, 0xFFFF, 0x5169, 0x5499, 0xFFFF, 0xFFFF, 0xFFFF, 0x5FFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4FB0, 0x4BE9, 0xFFFF, 0x5FFC, 0x5FFE, 0x6041, 0x5FFD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50A6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6042, 0x4A65, 0xFFFF, 0xFFFF, 0xFFFF, 0x50AA, 0x49A7,
+    0x6043, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6044, 0xFFFF, 0xFFFF, 0xFFFF, 0x559E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6047,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6046, 0x6049, 0x6048, 0xFFFF, 0x604A, 0x52F0, 0xFFFF, 0x604B, 0x45DD, 0xFFFF, 0x604C, 0xFFFF, 0x604D,
+    0xFFFF, 0x604F, 0x604E, 0x6051, 0xFFFF, 0x6050, 0xFFFF, 0xFFFF, 0xFFFF, 0x6052, 0x6053, 0xFFFF, 0x49E7, 0x6054, 0xFFFF, 0x66C1,
+    0x476E, 0x6055, 0x6056, 0x546B, 0xFFFF, 0x4D50, 0x6057, 0x6058, 0xFFFF, 0xFFFF, 0x51C8, 0x605A, 0xFFFF, 0x605B, 0xFFFF, 0x48EF,
+    0x605C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4971, 0xFFFF, 0x605D, 0x45F5, 0x545C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5287,
+  },
+  { /* U+7Bxx */
+    0xFFFF, 0xFFFF, 0x605E, 0xFFFF, 0x54D5, 0xFFFF, 0x6062, 0xFFFF, 0x51CF, 0xFFFF, 0x6061, 0x6060, 0xFFFF, 0xFFFF, 0xFFFF, 0x605F,
+    0xFFFF, 0x49B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53E7, 0x6065, 0xFFFF, 0x4F41, 0xFFFF, 0xFFFF, 0x6066, 0xFFFF,
+    0x47E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52F4, 0x4FD9, 0xFFFF, 0x6068, 0xFFFF, 0xFFFF, 0xFFFF, 0x467E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6063, 0xFFFF, 0x6067, 0x6064, 0xFFFF, 0xFFFF, 0x496E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x606C, 0x4AC7, 0xFFFF, 0x4D9B, 0x46A7, 0xFFFF, 0x4B8F, 0x606B, 0x606A, 0xFFFF, 0x52F5,
+    0x6069, 0x4B45, 0x4B7C, 0xFFFF, 0x49D0, 0xFFFF, 0x46C9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x606D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5484, 0xFFFF, 0x5048, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x534E, 0xFFFF, 0x6073, 0xFFFF,
+    0x6071, 0x6072, 0xFFFF, 0xFFFF, 0x6070, 0x606E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x606F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x559B, 0x4F51, 0xFFFF, 0xFFFF, 0xFFFF, 0x55A4, 0xFFFF, 0x6077, 0xFFFF, 0x607B,
+    0xFFFF, 0xFFFF, 0x607A, 0xFFFF, 0x4EE0, 0x4CCC, 0xFFFF, 0x4843, 0x6075, 0x607C, 0x6079, 0xFFFF, 0x6078, 0x6074, 0x6082, 0x6076,
+    0xFFFF, 0x46F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54CA, 0xFFFF, 0xFFFF, 0x518D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4AFB, 0xFFFF, 0xFFFF, 0x6080, 0xFFFF, 0xFFFF, 0xFFFF, 0x505C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x47A1, 0x51E8, 0xFFFF, 0xFFFF, 0x49E8, 0xFFFF, 0x6081, 0x4FB6, 0xFFFF, 0x49A8, 0xFFFF, 0x607E, 0x607F, 0xFFFF, 0xFFFF, 0x607D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6083, 0xFFFF, 0xFFFF,
+    0x4875, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD8, 0x6087, 0x6085, 0xFFFF, 0xFFFF, 0x6084, 0xFFFF, 0xFFFF, 0xFFFF, 0x5444, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x608C, 0xFFFF, 0xFFFF, 0x608E, 0x6086, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Cxx */
+    0x6089, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x608B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x608D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4F53, 0x578A, 0x608A, 0x6088, 0xFFFF, 0xFFFF, 0x517C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6092,
+    0xFFFF, 0x4BEC, 0xFFFF, 0x608F, 0xFFFF, 0xFFFF, 0xFFFF, 0x6090, 0xFFFF, 0xFFFF, 0x6091, 0x6094, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6093, 0x51AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6095, 0x5270, 0x4F4C,
+    0x6096, 0xFFFF, 0xFFFF, 0x6098, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6097, 0x4DFE, 0xFFFF, 0x51F2,
+    0x609A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F99, 0xFFFF, 0x6099, 0xFFFF, 0x609B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x609C,
+    0x4CEE, 0xFFFF, 0xFFFF, 0xFFFF, 0x52AA, 0x609D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x609E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x466F, 0xFFFF, 0x609F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FF0, 0xFFFF,
+    0xFFFF, 0x55E7, 0x4E85, 0x60A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x489E, 0xFFFF, 0x4FCC, 0xFFFF, 0x53C9, 0xFFFF, 0xFFFF,
+    0x60A1, 0xFFFF, 0x4CA9, 0xFFFF, 0xFFFF, 0x4C4B, 0xFFFF, 0x4D59, 0x4BF7, 0xFFFF, 0xFFFF, 0x4FC8, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BFB,
+    0xFFFF, 0x60A5, 0x60A3, 0xFFFF, 0x60A2, 0x52AB, 0xFFFF, 0x4BD4, 0x60A7, 0xFFFF, 0xFFFF, 0x60A4, 0xFFFF, 0x60A6, 0x60AB, 0xFFFF,
+    0xFFFF, 0x60AA, 0x60A9, 0x60A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60AC, 0xFFFF, 0xFFFF, 0xFFFF, 0x60AE, 0x466C, 0xFFFF,
+    0x51BC, 0xFFFF, 0x60B0, 0xFFFF, 0xFFFF, 0x60AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5471, 0xFFFF, 0xFFFF, 0xFFFF, 0x5160, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x60B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x4884, 0xFFFF, 0x60B3, 0xFFFF, 0xFFFF, 0xFFFF, 0x60B4, 0xFFFF, 0x5492, 0x518C,
+    0x514B, 0xFFFF, 0x60B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EC5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60B5,
+    0xFFFF, 0xFFFF, 0x60B6, 0xFFFF, 0x60B7, 0xFFFF, 0x60B8, 0xFFFF, 0x46C7, 0xFFFF, 0x52C2, 0x48FA, 0xFFFF, 0xFFFF, 0x51FE, 0xFFFF,
+  },
+  { /* U+7Dxx */
+    0x46DB, 0xFFFF, 0x60BA, 0xFFFF, 0x47BD, 0x4B67, 0x60B9, 0xFFFF, 0xFFFF, 0xFFFF, 0x60BD, 0x4CF9, 0xFFFF, 0x49E2, 0xFFFF, 0xFFFF,
+    0x4FB5, 0xFFFF, 0xFFFF, 0xFFFF, 0x47A6, 0x60BC, 0xFFFF, 0x4F47, 0x4C78, 0x4680, 0x49F3, 0x4FF3, 0x60BB, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x479F, 0x4877, 0x4CF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AF0, 0x5592, 0xFFFF, 0x60C0, 0x5148,
+    0x4768, 0xFFFF, 0x60C1, 0x4E59, 0xFFFF, 0x60C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CE4, 0x4CBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60C2,
+    0xFFFF, 0xFFFF, 0x49F4, 0x5563, 0x46B9, 0x60BE, 0x60C5, 0xFFFF, 0x60C4, 0xFFFF, 0xFFFF, 0x60BF, 0x4688, 0xFFFF, 0x60C9, 0x60CC,
+    0x46BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60D0, 0x60C6, 0xFFFF, 0x506D, 0xFFFF,
+    0xFFFF, 0x4CE7, 0x4EF7, 0x60CD, 0xFFFF, 0xFFFF, 0x4757, 0xFFFF, 0x60CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60CB, 0xFFFF,
+    0xFFFF, 0x4881, 0x5268, 0x60C7, 0xFFFF, 0x4AE4, 0x4AF3, 0xFFFF, 0xFFFF, 0x49F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x54ED, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5374,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x60CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A4A, 0x47CB, 0x54EB, 0x5070, 0xFFFF, 0xFFFF, 0x60DC,
+    0x60DA, 0xFFFF, 0x60D8, 0x60D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60D7, 0x51A3, 0x4880, 0x60D1, 0x60D9,
+    0x60DD, 0x48CB, 0x4A53, 0xFFFF, 0x4DC9, 0x60D3, 0xFFFF, 0x60D4, 0x60DB, 0xFFFF, 0x54D3, 0x54A6, 0xFFFF, 0x60D6, 0x49DC, 0x489D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60D5, 0xFFFF, 0xFFFF, 0x4B97, 0x537D, 0xFFFF, 0xFFFF, 0xFFFF, 0x4793,
+    0xFFFF, 0x48A5, 0x4A9B, 0xFFFF, 0xFFFF, 0x60DE, 0x60E1, 0xFFFF, 0x60DF, 0xFFFF, 0x4687, 0xFFFF, 0x60E8, 0x60E0, 0x60E3, 0xFFFF,
+    0x4A80, 0x60E7, 0xFFFF, 0xFFFF, 0x60E2, 0xFFFF, 0xFFFF, 0xFFFF, 0x484E, 0x4CFC, 0xFFFF, 0xFFFF, 0x556B, 0xFFFF, 0xFFFF, 0x4E9A,
+    0xFFFF, 0xFFFF, 0x60E6, 0xFFFF, 0x4860, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Exx */
+    0xFFFF, 0x4BAA, 0xFFFF, 0xFFFF, 0x4859, 0x60E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x60EE, 0x60EA, 0x60E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x60EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52E6, 0xFFFF, 0xFFFF, 0x4F6B, 0x60ED,
+    0xFFFF, 0x60EB, 0x5BCC, 0x55A8, 0xFFFF, 0xFFFF, 0x4E93, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49E4, 0xFFFF, 0xFFFF, 0x49F7, 0xFFFF,
+    0xFFFF, 0x60F2, 0x60F9, 0xFFFF, 0xFFFF, 0x60F4, 0xFFFF, 0x60F8, 0xFFFF, 0x60F6, 0x60EF, 0x60F5, 0xFFFF, 0x60F3, 0x4866, 0xFFFF,
+    0xFFFF, 0x4759, 0xFFFF, 0x60F7, 0xFFFF, 0xFFFF, 0x60F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x4868, 0x5373, 0xFFFF, 0x52DA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x60FD, 0xFFFF, 0x489A, 0x51D4, 0x60FB, 0xFFFF, 0xFFFF, 0x60FE, 0x6141, 0xFFFF, 0xFFFF, 0x60FA, 0x60FC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x60F1, 0x6142, 0xFFFF, 0x6145, 0x6144, 0xFFFF, 0xFFFF, 0x4D9A, 0xFFFF, 0xFFFF,
+    0x4B69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6143, 0xFFFF, 0x6147, 0x6146, 0x6148, 0xFFFF, 0x614A,
+    0xFFFF, 0xFFFF, 0x55EB, 0x614B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5278, 0x614C, 0x51BF, 0xFFFF, 0x614E, 0xFFFF, 0x614D, 0x55FA,
+    0x5273, 0xFFFF, 0x614F, 0x6150, 0x6151, 0xFFFF, 0x6152, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6153, 0x539C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5084, 0xFFFF, 0x6154, 0xFFFF, 0x6155, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6156, 0xFFFF, 0x6157, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6158, 0x54CB, 0x6159, 0xFFFF,
+    0x516E, 0x615A, 0xFFFF, 0xFFFF, 0x615C, 0x615B, 0xFFFF, 0xFFFF, 0x615D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x615E,
+    0x615F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6161, 0x6160, 0x6162, 0x4C4E, 0x55EF, 0xFFFF, 0xFFFF, 0x468C, 0xFFFF,
+    0x4F82, 0xFFFF, 0x4C99, 0xFFFF, 0xFFFF, 0x5579, 0xFFFF, 0x55A5, 0x6163, 0x5AA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6164, 0x6166, 0xFFFF, 0x4DFA, 0x6165, 0x6167, 0x6168, 0xFFFF, 0x4AD1, 0xFFFF, 0x6169, 0xFFFF, 0x457D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x616A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x616D, 0xFFFF, 0xFFFF, 0x616C, 0x616B, 0xFFFF,
+    0xFFFF, 0x616E, 0xFFFF, 0x616F, 0x47B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x5596, 0x4598, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6171, 0x6170,
+    0xFFFF, 0xFFFF, 0x6172, 0xFFFF, 0xFFFF, 0xFFFF, 0x6174, 0xFFFF, 0x6175, 0x6173, 0xFFFF, 0xFFFF, 0xFFFF, 0x478F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4FFB, 0xFFFF, 0xFFFF, 0xFFFF, 0x6178, 0x6179, 0xFFFF, 0xFFFF, 0xFFFF, 0x617A, 0xFFFF, 0x4D9C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4A69, 0xFFFF, 0x54F9, 0x617B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F69, 0x617C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x617D, 0xFFFF, 0xFFFF, 0x617E, 0xFFFF, 0x558B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x54B6, 0xFFFF, 0xFFFF, 0x617F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6180, 0xFFFF, 0x51F6, 0x4DB5, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+80xx */
+    0x52A0, 0x4985, 0xFFFF, 0x4760, 0x6181, 0x4670, 0x53DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6182, 0x51E6, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x498E, 0xFFFF, 0x6183, 0xFFFF, 0xFFFF, 0x499A, 0xFFFF, 0x4FEC, 0x54E4, 0x6184, 0xFFFF, 0xFFFF, 0x6185, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6186, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6187, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4CAB, 0xFFFF, 0xFFFF, 0x4E99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6189, 0xFFFF, 0x55B8, 0xFFFF, 0x6188,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x618B, 0xFFFF, 0xFFFF, 0xFFFF, 0x618A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x618C, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BB5, 0xFFFF, 0x618D, 0xFFFF, 0x5479, 0xFFFF, 0xFFFF, 0xFFFF, 0x48BB, 0x618E,
+    0xFFFF, 0x4B89, 0x618F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6190, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53CA,
+    0x6193, 0xFFFF, 0x6192, 0x6191, 0x4DA8, 0xFFFF, 0x6194, 0x48D7, 0xFFFF, 0x6195, 0xFFFF, 0xFFFF, 0xFFFF, 0x6196, 0x53E4, 0x6197,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6198, 0x6199, 0x53B6, 0x4B41, 0xFFFF, 0x4A42, 0xFFFF, 0x557F, 0x4E50, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x619A, 0xFFFF, 0xFFFF, 0x5267, 0xFFFF, 0x526A, 0xFFFF, 0x619B, 0x5292, 0xFFFF, 0x4C8C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4CC5, 0x5382, 0xFFFF, 0xFFFF, 0x497B, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B79, 0x4CFB, 0xFFFF, 0x619E, 0x619C, 0xFFFF, 0x50EB,
+    0xFFFF, 0x52D5, 0x48AC, 0xFFFF, 0x5451, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x504E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4DF6, 0x61A3, 0xFFFF, 0x4E9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AB2, 0xFFFF, 0x5263, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5288, 0xFFFF, 0xFFFF, 0x61A1, 0x61A4, 0x619F, 0xFFFF, 0x61A2, 0x50B6, 0xFFFF,
+    0xFFFF, 0x4D63, 0xFFFF, 0xFFFF, 0x4EE9, 0x61A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61A6,
+    0xFFFF, 0x61A7, 0xFFFF, 0xFFFF, 0x4EAB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BE3, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B0, 0x474F, 0xFFFF, 0xFFFF,
+  },
+  { /* U+81xx */
+    0xFFFF, 0xFFFF, 0x4874, 0xFFFF, 0xFFFF, 0x5051, 0x55EC, 0x47E3, 0x5079, 0x61A5, 0x535E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D5C, 0x61A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x61A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C96, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61AA,
+    0xFFFF, 0x4AB4, 0xFFFF, 0x4CB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61AD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61AB, 0xFFFF, 0xFFFF, 0x52C4, 0xFFFF,
+    0x4D62, 0x61AF, 0xFFFF, 0x61AE, 0x5247, 0x4CAF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B3, 0x61B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51CE, 0xFFFF, 0xFFFF, 0x61B2, 0xFFFF,
+    0x4BA4, 0x61B1, 0xFFFF, 0xFFFF, 0x61B6, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DB6, 0x4CA0, 0x526F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x529A,
+    0x61BA, 0xFFFF, 0x61BB, 0x61B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61B8, 0xFFFF, 0x61B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x61BF, 0xFFFF, 0x61BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5191, 0xFFFF, 0x4D8A, 0x5060, 0xFFFF, 0xFFFF,
+    0x61BC, 0xFFFF, 0xFFFF, 0x61BE, 0x61C1, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EF6, 0x61C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x61C4, 0xFFFF, 0xFFFF, 0x5076, 0xFFFF, 0x61C0, 0xFFFF, 0xFFFF, 0x61C3, 0xFFFF, 0x61CA, 0xFFFF, 0xFFFF, 0x61C7, 0x61C6, 0x535F,
+    0x61C8, 0xFFFF, 0x61C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x5474, 0xFFFF, 0x61C5, 0x61CB, 0xFFFF, 0xFFFF, 0xFFFF, 0x61CC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x61CD, 0xFFFF, 0x4DBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61CE, 0x61CF, 0x61D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61D1,
+    0x61D2, 0xFFFF, 0xFFFF, 0x4A47, 0xFFFF, 0x538A, 0xFFFF, 0x5173, 0x4CD0, 0xFFFF, 0x45C3, 0xFFFF, 0xFFFF, 0x4DB3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4A48, 0x4C6A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61D3, 0x61D4, 0x4A89, 0xFFFF, 0x61D5, 0xFFFF,
+  },
+  { /* U+82xx */
+    0xFFFF, 0x61D6, 0x61D7, 0xFFFF, 0xFFFF, 0x61D8, 0xFFFF, 0x5358, 0x466A, 0x5778, 0x62BA, 0xFFFF, 0x5094, 0x61D9, 0x4C58, 0xFFFF,
+    0x61DA, 0xFFFF, 0x61DB, 0xFFFF, 0xFFFF, 0xFFFF, 0x61DC, 0x4E5B, 0x4CAA, 0xFFFF, 0xFFFF, 0x4FC1, 0x4FB8, 0xFFFF, 0x4A63, 0x4BB8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61DD, 0x489F, 0x61DE, 0x4956, 0xFFFF, 0x61DF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x61E1, 0xFFFF, 0x54DB, 0x4B87, 0x53AC, 0x61E0, 0x467B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x61E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DFC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54AE, 0x61E3, 0x61E4, 0xFFFF, 0xFFFF, 0x61E5, 0xFFFF, 0x61E6,
+    0xFFFF, 0xFFFF, 0x61E8, 0xFFFF, 0x61E7, 0xFFFF, 0x4C4A, 0xFFFF, 0x61E9, 0xFFFF, 0x61EA, 0x61EB, 0xFFFF, 0xFFFF, 0x55B4, 0x45C4,
+    0xFFFF, 0x61EC, 0x47C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D54, 0x61ED, 0x53C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61EE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x519A, 0xFFFF, 0x61EF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x61F0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EBD, 0xFFFF, 0xFFFF, 0xFFFF, 0x4972, 0xFFFF, 0x61F2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F7B, 0x4ADD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61F1, 0x61F4, 0x5442, 0xFFFF, 0x4FE5,
+    0xFFFF, 0x46D9, 0xFFFF, 0x4683, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4953, 0x4DD0, 0xFFFF, 0x61F3, 0xFFFF, 0x4EBA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x504B, 0x61F9, 0x5559, 0x52D7, 0xFFFF, 0xFFFF, 0x4AB8, 0xFFFF, 0x6246, 0xFFFF, 0x5377, 0x6243, 0xFFFF, 0x6241, 0x61F7,
+    0xFFFF, 0x61F5, 0xFFFF, 0x61F6, 0xFFFF, 0x46D6, 0x4A5F, 0x54B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x45EE, 0xFFFF, 0x61FB, 0x61FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x61FE, 0x6244, 0x61FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+83xx */
+    0xFFFF, 0x61F8, 0x4646, 0x61FC, 0x547A, 0x4BD3, 0x6242, 0xFFFF, 0xFFFF, 0x6245, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EC9, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x624A, 0x53F6, 0x6252, 0xFFFF, 0xFFFF, 0xFFFF, 0x50E2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6258, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x474C, 0xFFFF, 0xFFFF, 0x6251, 0xFFFF, 0xFFFF, 0xFFFF, 0x6250,
+    0xFFFF, 0x624B, 0x547B, 0xFFFF, 0x6249, 0x6247, 0x4977, 0xFFFF, 0x4DF7, 0x624D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x624C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x624F, 0xFFFF, 0xFFFF, 0xFFFF, 0x4842, 0x53B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x515F,
+    0x624E, 0xFFFF, 0x46DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B62, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6248, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x625F, 0xFFFF, 0x625A, 0xFFFF, 0x4BA1, 0xFFFF, 0xFFFF, 0xFFFF, 0x49E0, 0x625D, 0xFFFF, 0xFFFF, 0x625B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6262, 0xFFFF, 0x5486, 0xFFFF, 0x6263, 0x625C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6259, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6260, 0xFFFF, 0xFFFF, 0x6257, 0xFFFF, 0xFFFF, 0xFFFF, 0x6253, 0xFFFF, 0xFFFF, 0xFFFF, 0x51EE, 0x6255,
+    0x6261, 0xFFFF, 0x6256, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6264, 0xFFFF, 0x6254, 0x54B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x52C9, 0xFFFF, 0xFFFF, 0xFFFF, 0x625E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6275, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x626E, 0xFFFF, 0xFFFF, 0xFFFF, 0x4753, 0xFFFF, 0x6267, 0xFFFF, 0xFFFF, 0x46D7, 0xFFFF, 0x4C73, 0xFFFF, 0x6268, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4C51, 0xFFFF, 0xFFFF, 0x5180, 0xFFFF, 0x626C, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BA8, 0xFFFF, 0xFFFF, 0x53D4,
+    0x6270, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x516A, 0xFFFF, 0x54E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B6C,
+    0x516D, 0x48CC, 0x6271, 0xFFFF, 0x6265, 0xFFFF, 0x6274, 0x6269, 0xFFFF, 0xFFFF, 0xFFFF, 0x6276, 0xFFFF, 0x626A, 0xFFFF, 0xFFFF,
+  },
+  { /* U+84xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x626B, 0x54F7, 0xFFFF, 0xFFFF, 0x626F, 0xFFFF, 0xFFFF, 0xFFFF, 0x626D, 0x50DB, 0x6272, 0x5482, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6266, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x6273, 0xFFFF, 0x54D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x494A, 0x6277, 0xFFFF, 0x4B75, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4F7C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6285, 0xFFFF, 0xFFFF, 0x6284, 0xFFFF, 0xFFFF, 0xFFFF, 0x6279, 0x47F2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6282, 0xFFFF, 0x627E, 0x45F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x559F, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A59, 0xFFFF, 0xFFFF, 0xFFFF, 0x48DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x5547, 0x6278, 0x5071, 0xFFFF, 0xFFFF, 0x4E72, 0xFFFF, 0xFFFF, 0x6281, 0xFFFF, 0x627C, 0x4F79, 0x516C, 0x627F, 0x6283,
+    0xFFFF, 0x544E, 0xFFFF, 0xFFFF, 0xFFFF, 0x50D9, 0xFFFF, 0x627B, 0xFFFF, 0x627D, 0x50E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6280, 0xFFFF, 0x627A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F93, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FE3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5095, 0xFFFF, 0xFFFF, 0x5259, 0xFFFF, 0xFFFF, 0x6289,
+    0xFFFF, 0x6293, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6290, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x49B2, 0xFFFF, 0x628A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4ABA, 0x6287, 0xFFFF, 0x628C, 0x50B9, 0xFFFF, 0xFFFF, 0x6288,
+    0xFFFF, 0x628F, 0xFFFF, 0xFFFF, 0x4C94, 0xFFFF, 0x6291, 0xFFFF, 0xFFFF, 0x5083, 0x6286, 0x4F6D, 0xFFFF, 0x628B, 0xFFFF, 0xFFFF,
+    0x628E, 0x4F9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6292, 0xFFFF, 0xFFFF, 0x6294, 0x628D, 0xFFFF, 0x527B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5088, 0xFFFF, 0x4BF4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6296, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x518B, 0xFFFF, 0xFFFF, 0x6295,
+  },
+  { /* U+85xx */
+    0x52BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x629D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x556C, 0xFFFF, 0x557B, 0x629C, 0x629B, 0xFFFF, 0x6297, 0x6298, 0xFFFF, 0x549A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x629A,
+    0xFFFF, 0x54A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FA1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6299, 0x4E8B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x465E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54D1, 0xFFFF, 0xFFFF,
+    0x62A0, 0x62A5, 0xFFFF, 0x52F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62A4, 0x53A8, 0x62A6, 0x62A7, 0xFFFF, 0xFFFF, 0x5565, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x629E, 0xFFFF, 0x62A9, 0xFFFF, 0x5491, 0x62A3, 0x62A1, 0x629F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x62A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50DE, 0x54F0, 0x51D3, 0x62A8, 0xFFFF, 0x62B0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62B7, 0xFFFF,
+    0x62AA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A92, 0xFFFF, 0xFFFF, 0x62B4, 0x62AC, 0xFFFF, 0x62AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x62B8, 0x62AD, 0xFFFF, 0xFFFF, 0x62B1, 0xFFFF, 0xFFFF, 0x4CEC, 0xFFFF, 0x51AD, 0xFFFF, 0x62B2, 0x62B5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62AB, 0xFFFF, 0x4FBF, 0xFFFF, 0x62AF, 0x4CF1, 0x545A, 0x4998, 0x46E1, 0xFFFF, 0x62B3, 0x53F9,
+    0x62BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62BF, 0x62BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4FBB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62BC, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EED, 0xFFFF, 0x62BE,
+    0x62C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62C4, 0x62C2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4568, 0x62C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FF6, 0x4C95, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55E2, 0xFFFF, 0x62C5, 0x53ED, 0x505F, 0xFFFF, 0xFFFF, 0x62C9, 0xFFFF,
+  },
+  { /* U+86xx */
+    0xFFFF, 0xFFFF, 0x5496, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EDA, 0x4CBF, 0xFFFF, 0xFFFF, 0x62C6, 0x62C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x62C7, 0xFFFF, 0xFFFF, 0x5CBD, 0x5CBE, 0xFFFF, 0xFFFF, 0x62CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x62CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CA6, 0xFFFF, 0x5F82,
+    0x62CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62CD,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62CF, 0x4AAB, 0xFFFF,
+    0x5260, 0xFFFF, 0xFFFF, 0xFFFF, 0x52FB, 0x62D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F72, 0xFFFF, 0x5250, 0xFFFF, 0x5588, 0x62D2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62D3, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BCB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x62D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51B6, 0xFFFF, 0x5144, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FAA, 0x62D8, 0x62DA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x62D5, 0xFFFF, 0x4F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x62D6, 0x55A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62D7, 0x62D9, 0x62E3, 0xFFFF, 0xFFFF, 0xFFFF, 0x62DC,
+    0x62DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62DD, 0xFFFF, 0x62DE, 0x4FEA, 0xFFFF, 0x62E0, 0xFFFF, 0x53D8, 0xFFFF, 0x4DF9, 0x62E1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55BB, 0xFFFF, 0x62E9, 0xFFFF, 0xFFFF, 0x62E5, 0x62E8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62E6, 0xFFFF, 0xFFFF, 0x62E7, 0x4E66, 0x53A5, 0x4F74,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x524E, 0x62F3, 0xFFFF, 0x62EF, 0xFFFF, 0xFFFF, 0x5599, 0xFFFF,
+  },
+  { /* U+87xx */
+    0x62ED, 0xFFFF, 0x4ECD, 0x62EE, 0xFFFF, 0xFFFF, 0x62EB, 0xFFFF, 0x62EC, 0x62F1, 0x62F4, 0xFFFF, 0xFFFF, 0x62F2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x62F0, 0x62EA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54DC, 0xFFFF, 0x62FA, 0xFFFF, 0x53A1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F8, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F5, 0xFFFF, 0xFFFF, 0x526D, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F7, 0xFFFF, 0xFFFF, 0xFFFF, 0x62F6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53E8, 0xFFFF, 0x52A1, 0x62FD, 0xFFFF, 0x62FE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6349, 0xFFFF, 0x5347, 0xFFFF, 0x6342, 0xFFFF, 0x6348, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x62FB,
+    0x6346, 0xFFFF, 0xFFFF, 0x634A, 0xFFFF, 0xFFFF, 0x51C3, 0xFFFF, 0x6343, 0xFFFF, 0x6345, 0xFFFF, 0xFFFF, 0xFFFF, 0x6347, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6341, 0xFFFF, 0x4E6E, 0xFFFF, 0x62FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x634B,
+    0xFFFF, 0xFFFF, 0x6344, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48C2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x634E,
+    0xFFFF, 0xFFFF, 0x634C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6355, 0xFFFF, 0xFFFF, 0xFFFF, 0x634F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6357, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D6, 0x6359, 0xFFFF, 0x6351, 0xFFFF, 0xFFFF,
+    0x6352, 0xFFFF, 0xFFFF, 0xFFFF, 0x6356, 0xFFFF, 0x634D, 0x54F4, 0xFFFF, 0xFFFF, 0xFFFF, 0x6350, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x6353, 0xFFFF, 0x6358, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x635C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x635A,
+    0xFFFF, 0xFFFF, 0x635B, 0xFFFF, 0xFFFF, 0xFFFF, 0x6363, 0x6364, 0xFFFF, 0x5090, 0xFFFF, 0x51C6, 0xFFFF, 0xFFFF, 0x6362, 0xFFFF,
+  },
+  { /* U+88xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55BD, 0xFFFF, 0x635E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6361, 0x635D, 0x635F,
+    0xFFFF, 0x6365, 0xFFFF, 0xFFFF, 0xFFFF, 0x6366, 0x6360, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6368, 0x6367, 0x5351, 0xFFFF, 0xFFFF, 0xFFFF, 0x6369, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x636A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x636B, 0xFFFF, 0xFFFF, 0x636C, 0xFFFF, 0x636D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4B43, 0xFFFF, 0x636E, 0xFFFF, 0x636F, 0xFFFF, 0x4B88, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45A4, 0x6370, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6371, 0x486C, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BA5, 0xFFFF, 0x6372, 0xFFFF, 0x4780, 0xFFFF, 0x4DA5, 0x6373, 0xFFFF,
+    0xFFFF, 0x4BED, 0x6374, 0x4AEA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46C0, 0xFFFF, 0xFFFF, 0x6375, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F54, 0xFFFF, 0x637A, 0xFFFF, 0xFFFF, 0x6378, 0xFFFF, 0x52E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6379, 0x6377, 0x4AA7,
+    0xFFFF, 0x6376, 0x637B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F6A, 0xFFFF, 0xFFFF, 0x4A54, 0xFFFF, 0x6382, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x637E, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A57, 0x637D, 0xFFFF, 0x6380, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x637C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6381, 0xFFFF, 0x6383, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4B8D, 0xFFFF, 0xFFFF, 0x637F, 0xFFFF,
+    0x54C5, 0x6386, 0xFFFF, 0xFFFF, 0x4F5A, 0x6385, 0xFFFF, 0x5448, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6384,
+    0xFFFF, 0x49BD, 0x4F60, 0x6387, 0x6388, 0x4898, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49A4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6389, 0x46F8, 0xFFFF, 0xFFFF, 0x638A, 0x638B, 0xFFFF, 0xFFFF, 0x496A, 0x638C, 0xFFFF, 0x4F8A,
+    0xFFFF, 0x544D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6391, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6392, 0x4FA8, 0x5349, 0x6390, 0xFFFF, 0xFFFF, 0x4F43, 0x638D, 0xFFFF, 0xFFFF, 0x638F, 0x457B, 0x4C8D, 0xFFFF,
+  },
+  { /* U+89xx */
+    0xFFFF, 0xFFFF, 0x638E, 0xFFFF, 0x6393, 0xFFFF, 0xFFFF, 0x4B51, 0xFFFF, 0xFFFF, 0x6397, 0xFFFF, 0x6394, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x545E, 0xFFFF, 0x51BA, 0x6398, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51DA, 0x6396, 0x6399, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x639A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6395, 0x639B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x639E, 0xFFFF, 0x63A0, 0xFFFF, 0xFFFF, 0x639D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x639C, 0xFFFF, 0x639F, 0x506B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63A2, 0x63A1, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x546C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63A4, 0x54AF,
+    0x63A3, 0xFFFF, 0xFFFF, 0xFFFF, 0x63A7, 0xFFFF, 0x63A5, 0xFFFF, 0xFFFF, 0xFFFF, 0x63A6, 0xFFFF, 0xFFFF, 0x63A8, 0xFFFF, 0x63A9,
+    0xFFFF, 0xFFFF, 0x4DDF, 0xFFFF, 0x63AA, 0xFFFF, 0xFFFF, 0x63AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63AC, 0x4558,
+    0xFFFF, 0x4655, 0xFFFF, 0x63AD, 0xFFFF, 0xFFFF, 0x4DF2, 0x4BFA, 0x63AE, 0xFFFF, 0x63AF, 0x45BB, 0xFFFF, 0xFFFF, 0xFFFF, 0x46FB,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x63B0, 0xFFFF, 0xFFFF, 0x4A50, 0x53EB, 0x63B1, 0xFFFF, 0x4A4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63B4, 0x4ED0, 0xFFFF, 0x63B3, 0x4885, 0xFFFF, 0x63B5, 0xFFFF, 0xFFFF, 0x63B6,
+    0xFFFF, 0xFFFF, 0x63B7, 0x487E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63B8, 0xFFFF, 0xFFFF, 0x63BA, 0xFFFF, 0x63B9,
+    0x63BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x477D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63BC, 0xFFFF, 0x5360, 0x63BD, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x47B7, 0xFFFF, 0xFFFF, 0x4CD1, 0x63BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+8Axx */
+    0x479A, 0xFFFF, 0x4FC4, 0x63C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45C9, 0xFFFF, 0x50F2, 0xFFFF, 0x63C4, 0xFFFF, 0x49D2, 0xFFFF,
+    0x63C3, 0xFFFF, 0x63C5, 0x4BC8, 0xFFFF, 0xFFFF, 0x63C2, 0x4AB6, 0x4794, 0xFFFF, 0xFFFF, 0x63C6, 0xFFFF, 0x63C7, 0xFFFF, 0x50EF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x54CC, 0xFFFF, 0x63C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A71, 0xFFFF, 0xFFFF, 0x45E2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4A9A, 0xFFFF, 0x4BAD, 0x4CDF, 0xFFFF, 0x63C9, 0x63CB, 0xFFFF, 0xFFFF, 0x4D68, 0x4F66, 0x49BA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63CE, 0xFFFF, 0x63CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5176, 0x55E3, 0x63CD, 0xFFFF, 0x4F88, 0x49FD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63CC, 0xFFFF, 0xFFFF, 0x4E90, 0xFFFF,
+    0x51C1, 0xFFFF, 0x63D3, 0x54FB, 0xFFFF, 0xFFFF, 0x4948, 0xFFFF, 0xFFFF, 0x4CB0, 0xFFFF, 0x50D3, 0x63D2, 0x63D1, 0x518E, 0xFFFF,
+    0x4B5F, 0x4750, 0x4D8D, 0x4DE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63D4, 0xFFFF, 0xFFFF, 0x63D0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x63D6, 0xFFFF, 0x63D7, 0x63D5, 0xFFFF, 0x4EB4, 0xFFFF, 0x4D8C, 0xFFFF, 0xFFFF, 0x4B76, 0x4A7E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x63DA, 0xFFFF, 0x4FA0, 0xFFFF, 0x4FA2, 0xFFFF, 0xFFFF, 0x4ACB, 0xFFFF, 0x63DD, 0xFFFF, 0xFFFF, 0xFFFF, 0x48E7, 0xFFFF,
+    0x46FD, 0x63D9, 0xFFFF, 0x63DE, 0x4D91, 0x63DB, 0x63DC, 0x63DF, 0x63D8, 0xFFFF, 0xFFFF, 0xFFFF, 0x4952, 0x4A4F, 0xFFFF, 0xFFFF,
+    0x4B83, 0xFFFF, 0x49D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55F2, 0xFFFF, 0xFFFF, 0x5265, 0xFFFF, 0x63E1, 0x4689,
+    0xFFFF, 0xFFFF, 0x63E3, 0xFFFF, 0x50B2, 0xFFFF, 0xFFFF, 0x4963, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AE8, 0x63E0, 0x63E2, 0xFFFF, 0x4BC1,
+    0xFFFF, 0xFFFF, 0x5181, 0xFFFF, 0xFFFF, 0xFFFF, 0x48F3, 0xFFFF, 0xFFFF, 0xFFFF, 0x63E4, 0x63F2, 0x5570, 0xFFFF, 0x63F1, 0x63ED,
+    0x63EA, 0x63EC, 0x63EB, 0xFFFF, 0x63E7, 0xFFFF, 0x5246, 0x63E6, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E96, 0xFFFF, 0x4E9C, 0x4F9C, 0xFFFF,
+    0xFFFF, 0x63E8, 0xFFFF, 0x63E5, 0xFFFF, 0xFFFF, 0x63EF, 0x63F0, 0x47E2, 0xFFFF, 0x55AB, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FE1, 0xFFFF,
+  },
+  { /* U+8Bxx */
+    0x4F4D, 0x54E5, 0x5573, 0xFFFF, 0x4FE2, 0xFFFF, 0xFFFF, 0x63F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63F3, 0xFFFF, 0x52F9, 0xFFFF,
+    0x63F7, 0xFFFF, 0xFFFF, 0xFFFF, 0x63E9, 0xFFFF, 0x63F6, 0x63F8, 0xFFFF, 0x497C, 0x63F5, 0x4A6E, 0xFFFF, 0x4DBB, 0xFFFF, 0xFFFF,
+    0x63F9, 0x4D7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x63FD, 0xFFFF, 0x5381, 0xFFFF, 0xFFFF, 0x63FE, 0x55A1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x63FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D87, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6441, 0xFFFF,
+    0xFFFF, 0x63FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6446, 0xFFFF, 0xFFFF, 0x6442, 0xFFFF, 0x6444, 0x6443,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6445, 0xFFFF, 0xFFFF, 0x6447, 0xFFFF, 0x4A75, 0xFFFF, 0x6449, 0x6448, 0x4E4F, 0xFFFF, 0xFFFF, 0x644C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x644B, 0x644D, 0xFFFF, 0xFFFF, 0x644E,
+    0x4781, 0x6176, 0x4B7B, 0xFFFF, 0x644A, 0xFFFF, 0xFFFF, 0x49DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x644F, 0xFFFF, 0x6450,
+    0x6451, 0xFFFF, 0xFFFF, 0x516B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5B88, 0xFFFF, 0x6452, 0xFFFF, 0x6453, 0xFFFF,
+    0x53FE, 0xFFFF, 0x6455, 0x6456, 0xFFFF, 0xFFFF, 0x6457, 0xFFFF, 0xFFFF, 0x6454, 0x6458, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+8Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4581, 0xFFFF, 0xFFFF, 0x6459, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x645B,
+    0xFFFF, 0x645A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A99, 0xFFFF, 0x645C, 0xFFFF, 0x4648, 0xFFFF, 0x645D, 0xFFFF, 0x645E, 0xFFFF,
+    0x645F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6460, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4994, 0x6461, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4C68, 0x5355, 0x6462, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6463, 0x5593, 0x6464, 0xFFFF, 0x6465, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6466, 0xFFFF, 0xFFFF, 0x6468, 0xFFFF, 0xFFFF, 0xFFFF, 0x6467, 0x6469, 0xFFFF, 0x5064, 0x646A, 0x646B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x646D, 0xFFFF, 0xFFFF, 0xFFFF, 0x646C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49EA, 0x46B6, 0xFFFF,
+    0x49C8, 0x49AF, 0x4AF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DA3, 0x4AEB, 0x4A5D, 0x6470, 0x49A1, 0x4BD2, 0x646F, 0x6471, 0x4C62,
+    0x4DEF, 0xFFFF, 0x6473, 0x6474, 0x487F, 0xFFFF, 0x6476, 0x4974, 0x4AF4, 0xFFFF, 0xFFFF, 0x46D0, 0x507B, 0x6472, 0xFFFF, 0x4872,
+    0x4641, 0x6475, 0x55F8, 0x4B4D, 0x5067, 0xFFFF, 0xFFFF, 0x4650, 0x6477, 0xFFFF, 0x4FFD, 0xFFFF, 0xFFFF, 0x6479, 0x6478, 0xFFFF,
+    0xFFFF, 0x539E, 0xFFFF, 0x50D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x647B, 0x4DEE, 0x4F94, 0xFFFF, 0x4AAD, 0xFFFF,
+    0x4F4F, 0xFFFF, 0x47E5, 0x647A, 0x5566, 0xFFFF, 0x4FA7, 0xFFFF, 0xFFFF, 0xFFFF, 0x46EC, 0xFFFF, 0xFFFF, 0x52C1, 0xFFFF, 0xFFFF,
+    0x647C, 0xFFFF, 0xFFFF, 0xFFFF, 0x647D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x647F, 0x6480, 0x4E8F, 0x647E, 0xFFFF, 0xFFFF,
+  },
+  { /* U+8Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x535A, 0x5574, 0xFFFF, 0x6481, 0x4C7C, 0xFFFF, 0x6482, 0x5584, 0xFFFF, 0x6484, 0xFFFF, 0x6483,
+    0x6486, 0xFFFF, 0x6485, 0x6487, 0x6488, 0xFFFF, 0x6489, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46F9, 0xFFFF, 0x5151, 0x648A, 0xFFFF, 0xFFFF, 0xFFFF, 0x53CC, 0xFFFF, 0x648B, 0xFFFF, 0xFFFF,
+    0x4AAA, 0x648C, 0xFFFF, 0x51C9, 0x50EE, 0xFFFF, 0x648D, 0x48D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x648F, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4CED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5561, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x46FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6492, 0xFFFF, 0xFFFF, 0xFFFF, 0x6491, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6490, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6498, 0x6496, 0xFFFF, 0xFFFF, 0x6493,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6495, 0xFFFF, 0xFFFF, 0xFFFF, 0x6494, 0x6497, 0xFFFF, 0x4DC2, 0xFFFF, 0x649B,
+    0xFFFF, 0x4CCD, 0xFFFF, 0x649C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55CB, 0xFFFF, 0x6499, 0x649A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4784,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x50B4, 0xFFFF, 0x50D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x649D, 0xFFFF, 0xFFFF, 0x649F,
+  },
+  { /* U+8Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x649E, 0x64A0, 0x4CA8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D7C,
+    0x64A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64A1, 0x64A2, 0x64A4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x64A7, 0xFFFF, 0xFFFF, 0xFFFF, 0x64A8, 0x64A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x64A5, 0xFFFF, 0x55A7, 0xFFFF, 0xFFFF, 0x64AA, 0x64AE, 0x64AB, 0x64A9, 0xFFFF, 0x64AC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x64AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64B2, 0xFFFF, 0xFFFF, 0xFFFF, 0x64AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5368,
+    0x64B1, 0xFFFF, 0xFFFF, 0x64B3, 0x64B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x64B5, 0xFFFF, 0x52F6, 0xFFFF, 0x64B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64B7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x64B8, 0xFFFF, 0xFFFF, 0x64BA, 0x64B9, 0xFFFF, 0x64B6, 0xFFFF, 0xFFFF, 0x64BC, 0x64BB, 0xFFFF, 0x4CA1, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x64BE, 0xFFFF, 0x64BD, 0x64BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x64C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64C2, 0x479C, 0x5044, 0xFFFF, 0xFFFF, 0x5353,
+    0x537A, 0x64C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64C4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64C6, 0x64C5, 0xFFFF, 0x64C7, 0xFFFF, 0x4653, 0x64C8, 0x4DAA, 0x4897, 0xFFFF, 0x64C9,
+    0xFFFF, 0xFFFF, 0x4E55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64CA, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CB1,
+    0xFFFF, 0xFFFF, 0x4752, 0x64CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BA6, 0xFFFF, 0xFFFF, 0x64CD, 0x64CC, 0x48A6, 0x64CF, 0xFFFF,
+  },
+  { /* U+8Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4A5A, 0xFFFF, 0x64D2, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D6E, 0x64D0, 0xFFFF, 0x64D1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x64D4, 0x64D5, 0x4A68, 0x64D3, 0xFFFF, 0xFFFF, 0xFFFF, 0x64D7, 0xFFFF, 0x515B, 0x64D6, 0x4787, 0xFFFF, 0x64D8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64D9, 0xFFFF, 0xFFFF, 0x4EF4, 0x48B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x55A6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x64DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4693, 0x64DC, 0xFFFF, 0x64DB, 0xFFFF, 0xFFFF, 0x64DF, 0x506C,
+    0xFFFF, 0xFFFF, 0x64DE, 0xFFFF, 0x50FE, 0x64DD, 0x64E1, 0xFFFF, 0xFFFF, 0x64E0, 0xFFFF, 0xFFFF, 0x64E2, 0x54EE, 0x64E3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64E5, 0xFFFF, 0xFFFF, 0x50A9,
+    0xFFFF, 0x52E1, 0x64E6, 0x64E7, 0x64E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D5E, 0x64E9, 0xFFFF, 0x4D74, 0x64EA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x64EB, 0xFFFF, 0xFFFF, 0xFFFF, 0x64ED, 0x64EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64EE, 0x6149, 0x64EF,
+    0x47DF, 0x52E5, 0x4845, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64F0, 0xFFFF, 0xFFFF, 0x45D5, 0x47F5, 0x4841, 0xFFFF, 0xFFFF, 0x547E,
+    0xFFFF, 0xFFFF, 0x55DF, 0xFFFF, 0x49CD, 0x5068, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BA9, 0xFFFF,
+    0xFFFF, 0x4673, 0xFFFF, 0xFFFF, 0x48D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x64F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x64F4, 0xFFFF, 0xFFFF, 0x64F3, 0x535D, 0xFFFF, 0xFFFF, 0x64F6, 0x4E9E, 0x49EF, 0xFFFF, 0x53DF, 0xFFFF, 0x64F5,
+    0x4A9C, 0xFFFF, 0xFFFF, 0xFFFF, 0x64F7, 0xFFFF, 0xFFFF, 0x4E58, 0x64FA, 0x64F9, 0x54A9, 0xFFFF, 0xFFFF, 0x49D1, 0xFFFF, 0xFFFF,
+  },
+  { /* U+90xx */
+    0x4B49, 0x4744, 0xFFFF, 0x4C72, 0xFFFF, 0x64F8, 0x4BFC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6544, 0xFFFF, 0x6541, 0x64FD, 0x4BDA,
+    0x50BB, 0x64FB, 0xFFFF, 0x515E, 0x48F0, 0x64FC, 0x6543, 0x4FB3, 0xFFFF, 0x4FCA, 0x45E3, 0xFFFF, 0xFFFF, 0x53B1, 0x6542, 0x48CD,
+    0x45B8, 0x64FE, 0x4DCE, 0x4754, 0xFFFF, 0xFFFF, 0xFFFF, 0x6545, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F77, 0xFFFF,
+    0xFFFF, 0x4AD3, 0x4669, 0xFFFF, 0xFFFF, 0x5485, 0x6546, 0xFFFF, 0x4AD6, 0x6547, 0xFFFF, 0xFFFF, 0x55AC, 0xFFFF, 0x654E, 0xFFFF,
+    0xFFFF, 0x54F8, 0x4CF7, 0xFFFF, 0xFFFF, 0x4C6D, 0xFFFF, 0x49EC, 0xFFFF, 0x654D, 0x4A8B, 0x46AB, 0xFFFF, 0x505D, 0x488D, 0x6548,
+    0x654A, 0x654B, 0x654C, 0x4550, 0x46A4, 0x49BC, 0x654F, 0xFFFF, 0x6550, 0x52F3, 0xFFFF, 0xFFFF, 0x5455, 0xFFFF, 0x6551, 0xFFFF,
+    0x46E3, 0x544C, 0xFFFF, 0x4EC2, 0xFFFF, 0x6882, 0xFFFF, 0x6553, 0x6552, 0x49CC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5143, 0x5458, 0x6554,
+    0xFFFF, 0xFFFF, 0x6557, 0xFFFF, 0xFFFF, 0x526E, 0x6555, 0x535B, 0x485D, 0xFFFF, 0x4CDA, 0xFFFF, 0x526B, 0x6559, 0xFFFF, 0x4CC4,
+    0x655B, 0x537B, 0x6558, 0x6045, 0x4DA9, 0xFFFF, 0xFFFF, 0x5186, 0xFFFF, 0x655A, 0x50EA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x655C,
+    0xFFFF, 0x4C92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4846, 0xFFFF, 0xFFFF, 0x46C5, 0xFFFF, 0x51A8, 0xFFFF, 0x4EB8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x655E,
+    0xFFFF, 0x655F, 0xFFFF, 0xFFFF, 0xFFFF, 0x6560, 0xFFFF, 0xFFFF, 0x4D81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x49B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5052, 0xFFFF, 0xFFFF, 0xFFFF, 0x456E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6563, 0xFFFF, 0xFFFF, 0x6564, 0xFFFF,
+    0xFFFF, 0x499E, 0x6561, 0xFFFF, 0x6562, 0xFFFF, 0xFFFF, 0xFFFF, 0x4595, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5162, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CB7, 0xFFFF, 0x4995, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x454F, 0xFFFF, 0xFFFF,
+  },
+  { /* U+91xx */
+    0xFFFF, 0xFFFF, 0x6565, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6568, 0xFFFF, 0xFFFF, 0x6567, 0xFFFF, 0xFFFF, 0xFFFF, 0x6569, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x656B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5154, 0xFFFF, 0xFFFF,
+    0x656C, 0xFFFF, 0x656A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F73, 0x656D, 0x5548, 0x52BB, 0x47F3, 0x5591, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4758, 0xFFFF, 0x4E7C, 0xFFFF, 0x656E, 0xFFFF, 0x656F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4BAE, 0x6570, 0xFFFF, 0x6571, 0xFFFF, 0xFFFF, 0xFFFF, 0x6572, 0x50BD, 0xFFFF, 0x5149, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6574, 0x6573, 0xFFFF, 0x4D86, 0xFFFF, 0x51EB, 0x4899, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6577, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51A9, 0xFFFF, 0x6576, 0xFFFF, 0x6575, 0xFFFF, 0x516F, 0xFFFF, 0xFFFF,
+    0x5170, 0xFFFF, 0x5378, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x536F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x6578, 0xFFFF, 0x507F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x657B, 0x6579, 0xFFFF, 0xFFFF, 0xFFFF, 0x657A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x657D, 0x657C, 0xFFFF, 0xFFFF, 0x50C2, 0xFFFF, 0x657E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x657F, 0x6580, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5346, 0x53BF, 0x4D79, 0x5252, 0xFFFF, 0x6581, 0x476C, 0x45A3, 0x4569, 0x47B5,
+    0x6582, 0x4586, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6587, 0x6585, 0x4FF4, 0xFFFF, 0x6583, 0x6584, 0x4ACC, 0x4988, 0x6586, 0x6588,
+    0xFFFF, 0x6589, 0xFFFF, 0x4CE3, 0x658D, 0x658F, 0x534A, 0x4BF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x658A, 0x658C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x658B, 0x658E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51D0, 0xFFFF, 0xFFFF, 0x6592,
+  },
+  { /* U+92xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6590, 0xFFFF, 0xFFFF, 0xFFFF, 0x6595, 0xFFFF, 0xFFFF, 0x4E63, 0x538F, 0xFFFF,
+    0x6593, 0x5269, 0xFFFF, 0xFFFF, 0x6594, 0x6597, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6591, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6598, 0xFFFF, 0xFFFF, 0x6596, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x45AE, 0xFFFF, 0xFFFF, 0x55BF, 0xFFFF, 0x65A6, 0x659B, 0xFFFF, 0x659F, 0xFFFF, 0xFFFF, 0x65A4,
+    0x659E, 0xFFFF, 0xFFFF, 0xFFFF, 0x45D7, 0x659A, 0xFFFF, 0xFFFF, 0x65A0, 0x659C, 0xFFFF, 0x65A7, 0xFFFF, 0xFFFF, 0x65A1, 0xFFFF,
+    0x65A2, 0x65A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6599, 0xFFFF, 0x65A3, 0x65A9, 0x49D4, 0xFFFF, 0xFFFF, 0x5393, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4EA8, 0xFFFF, 0x659D, 0xFFFF, 0x4FB4, 0x65A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4863, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65AC, 0x65AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5183, 0xFFFF,
+    0x478C, 0xFFFF, 0xFFFF, 0x4CE2, 0xFFFF, 0x48C0, 0xFFFF, 0xFFFF, 0x524B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4CAD, 0xFFFF, 0x65AF, 0xFFFF, 0x65B1, 0x65AE, 0xFFFF, 0x4DDC, 0xFFFF, 0x4E80, 0x65B0, 0x65AA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D48, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65BB, 0xFFFF, 0x65BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65B3,
+    0x65B7, 0xFFFF, 0x5449, 0x65BD, 0xFFFF, 0x65B9, 0xFFFF, 0x65B5, 0xFFFF, 0x65B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x65BC, 0xFFFF, 0xFFFF, 0xFFFF, 0x52C0, 0xFFFF, 0xFFFF, 0x65B4, 0xFFFF, 0x65B2, 0x5363, 0xFFFF, 0xFFFF, 0x4D6F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x55BE, 0x48C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51E7, 0x5394, 0x65C2, 0x65C5, 0x46A1, 0xFFFF, 0xFFFF, 0x65C9,
+  },
+  { /* U+93xx */
+    0xFFFF, 0xFFFF, 0x65CE, 0xFFFF, 0xFFFF, 0xFFFF, 0x55D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65C0,
+    0x5390, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54EF, 0x65C7, 0x65CB, 0xFFFF, 0xFFFF, 0x65CC, 0x65C8, 0xFFFF,
+    0x4E57, 0x65C3, 0x65CA, 0x65CD, 0xFFFF, 0x65C1, 0x4B8E, 0xFFFF, 0x53F0, 0xFFFF, 0xFFFF, 0x5257, 0x4FE6, 0xFFFF, 0x5283, 0x50B1,
+    0xFFFF, 0xFFFF, 0x4886, 0xFFFF, 0xFFFF, 0x65BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65BE, 0x65CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65C4, 0xFFFF, 0xFFFF, 0xFFFF, 0x51F7, 0xFFFF, 0xFFFF, 0x4B48, 0xFFFF, 0x55D3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54AA, 0xFFFF, 0x65D4, 0x65D5, 0xFFFF, 0xFFFF, 0xFFFF, 0x48C7, 0x52AD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x65D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F70, 0xFFFF, 0x65D3, 0xFFFF,
+    0x65D0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4E45, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65D2, 0xFFFF, 0x53BD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4962, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65DA, 0xFFFF, 0x4D70, 0x5197, 0xFFFF, 0xFFFF, 0x54FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65D8, 0xFFFF, 0xFFFF, 0x546D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x536E, 0x65D9, 0x4C89, 0xFFFF,
+    0x65D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x65E2, 0xFFFF, 0xFFFF, 0x65DD, 0xFFFF, 0x65DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x65E5, 0x5041, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65DC, 0x65DE, 0x65E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65E3, 0x65E4, 0xFFFF,
+    0xFFFF, 0x4A8D, 0xFFFF, 0xFFFF, 0x65E6, 0x65E0, 0xFFFF, 0xFFFF, 0x65DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+94xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x65EC, 0xFFFF, 0xFFFF, 0xFFFF, 0x65ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x51CD, 0xFFFF, 0xFFFF, 0x65EA, 0x65E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CC8, 0x52CF, 0x65E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x65EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x65F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5156, 0x65EE, 0xFFFF, 0x5388, 0xFFFF, 0x65F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x65F2, 0xFFFF, 0xFFFF, 0x65F5, 0x65F4, 0xFFFF, 0xFFFF, 0x65F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x4E4E, 0x65F3, 0x5241, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65F8, 0x65F7, 0xFFFF, 0xFFFF, 0x65FB, 0xFFFF,
+    0x65F9, 0xFFFF, 0x65FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x65FE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x65FD, 0xFFFF, 0x6641, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6644, 0x6643, 0x6645, 0x6642,
+    0xFFFF, 0x6646, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+95xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4583, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x46AA, 0xFFFF, 0x6647, 0x519C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6648, 0xFFFF, 0x4B7D, 0x6649, 0x46CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x545F,
+    0xFFFF, 0x4DD9, 0x664A, 0x45C1, 0x664B, 0xFFFF, 0x664C, 0xFFFF, 0x664D, 0x664E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x664F, 0xFFFF, 0x45C5, 0x4AE9, 0x549B, 0x5172, 0xFFFF, 0x6651, 0x6650, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6652, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x5177, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6655, 0xFFFF, 0x6654, 0x6653, 0xFFFF, 0x6656, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6659, 0xFFFF, 0xFFFF, 0xFFFF, 0x5364, 0xFFFF, 0xFFFF, 0x6657, 0xFFFF, 0x665B, 0x665A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x665D, 0x665C, 0x665E, 0xFFFF, 0x4BCC, 0xFFFF, 0xFFFF, 0xFFFF, 0x665F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6660, 0x6662, 0xFFFF, 0xFFFF, 0x6661, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+96xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4786, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x6663, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6664, 0xFFFF, 0x4591, 0xFFFF, 0xFFFF, 0xFFFF, 0x6665, 0x6666,
+    0xFFFF, 0xFFFF, 0x47BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4FEF, 0xFFFF, 0xFFFF, 0xFFFF, 0x46AE,
+    0x4FE8, 0xFFFF, 0x6667, 0xFFFF, 0x4B8C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x666A, 0x6669, 0x49E5, 0xFFFF, 0x6668,
+    0x48AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5157, 0x666B, 0x666C, 0x5272, 0x666D,
+    0xFFFF, 0xFFFF, 0x49D8, 0x4C84, 0x496D, 0x4FFE, 0x666E, 0xFFFF, 0xFFFF, 0xFFFF, 0x55C3, 0xFFFF, 0x6671, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4CD2, 0xFFFF, 0x6670, 0x4E61, 0xFFFF, 0x50C7, 0x4AB7, 0x666F, 0x4961, 0xFFFF, 0x4A6C, 0xFFFF, 0xFFFF, 0x47BF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4BB9, 0x465D, 0xFFFF, 0x4CE5, 0xFFFF, 0x4A93, 0x6673, 0xFFFF, 0x6672, 0x49A9, 0x4E76,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x505A, 0x6676, 0xFFFF, 0x6677, 0x6675, 0x53C3, 0xFFFF, 0x4797, 0x4BF9, 0x6679, 0xFFFF, 0xFFFF,
+    0x4EAE, 0xFFFF, 0xFFFF, 0x4CE0, 0xFFFF, 0xFFFF, 0xFFFF, 0x667A, 0x6556, 0xFFFF, 0x667B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x667F,
+    0x667E, 0x667C, 0x667D, 0xFFFF, 0x6680, 0xFFFF, 0x6681, 0x5545, 0x6682, 0x6683, 0xFFFF, 0x4FDA, 0x4ED5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F64, 0x51A4, 0xFFFF, 0xFFFF, 0x4570, 0x4745, 0x47A0, 0x4C4D, 0xFFFF, 0x5477, 0xFFFF, 0x6685, 0x52B7, 0x525B, 0x6684, 0xFFFF,
+    0xFFFF, 0x4A8A, 0xFFFF, 0xFFFF, 0xFFFF, 0x6686, 0x6354, 0xFFFF, 0xFFFF, 0x6688, 0xFFFF, 0x51FB, 0x6687, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x4997, 0x495A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49DD, 0xFFFF, 0x49BB, 0x52A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4F90, 0xFFFF, 0x4ABC, 0xFFFF, 0xFFFF, 0xFFFF, 0x5069, 0x4BD6, 0xFFFF, 0x6689, 0xFFFF, 0x4582, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+97xx */
+    0x47FB, 0xFFFF, 0xFFFF, 0xFFFF, 0x668A, 0xFFFF, 0x668B, 0x4DDE, 0x668C, 0xFFFF, 0x4F4B, 0xFFFF, 0xFFFF, 0x668E, 0x6690, 0x6692,
+    0xFFFF, 0x6691, 0xFFFF, 0x668F, 0xFFFF, 0xFFFF, 0x6693, 0xFFFF, 0xFFFF, 0x668D, 0xFFFF, 0xFFFF, 0x4DE8, 0xFFFF, 0x4EE4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6694, 0xFFFF, 0xFFFF, 0x4E48, 0xFFFF, 0xFFFF, 0x6695, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x6696, 0xFFFF, 0x4BC6, 0x6697, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BCF, 0x6698, 0xFFFF, 0x6699, 0xFFFF, 0x669A, 0x669B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x66A0, 0x669E, 0x669D, 0xFFFF, 0x669C, 0xFFFF, 0x669F, 0x66A1, 0xFFFF, 0xFFFF, 0xFFFF, 0x66A2, 0xFFFF, 0x66A3,
+    0xFFFF, 0x66A4, 0x464C, 0xFFFF, 0xFFFF, 0x66A5, 0x48C3, 0xFFFF, 0xFFFF, 0x4644, 0xFFFF, 0xFFFF, 0x66A6, 0xFFFF, 0x48E1, 0xFFFF,
+    0x66A7, 0x6852, 0x4691, 0xFFFF, 0x66A8, 0xFFFF, 0x66A9, 0xFFFF, 0x66AA, 0x4AA3, 0xFFFF, 0x53B5, 0xFFFF, 0x66AB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x52CE, 0xFFFF, 0xFFFF, 0x4DF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66AC, 0x66B0, 0xFFFF, 0x66AE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x66AF, 0xFFFF, 0xFFFF, 0x5445, 0x66AD, 0x5277, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66B1, 0xFFFF, 0x504C, 0xFFFF, 0x66B2,
+    0x66B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52E7, 0xFFFF, 0xFFFF, 0xFFFF, 0x66B4, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x51ED, 0xFFFF, 0xFFFF, 0x66B7, 0xFFFF, 0xFFFF, 0x66B6, 0xFFFF, 0x66B5, 0xFFFF, 0xFFFF, 0x63FC, 0xFFFF, 0x548B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x66B8, 0x66B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x66BA, 0xFFFF, 0xFFFF, 0x66BB, 0xFFFF, 0x66BC, 0xFFFF, 0xFFFF, 0x66BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4E75, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66BE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66BF, 0x4FDF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x66C0, 0x484D, 0xFFFF, 0x66C2, 0x52FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5577, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A5C,
+  },
+  { /* U+98xx */
+    0xFFFF, 0x4CD9, 0x4D5B, 0x4946, 0xFFFF, 0x4A97, 0x47B2, 0xFFFF, 0x46B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x5456, 0xFFFF, 0xFFFF, 0x66C3,
+    0x4D4A, 0x539D, 0x5557, 0x517A, 0xFFFF, 0xFFFF, 0xFFFF, 0x55E4, 0x4ACD, 0xFFFF, 0x66C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x66C6, 0xFFFF, 0xFFFF, 0x66C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4EB3, 0x47EB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5576, 0xFFFF, 0xFFFF, 0x66C7, 0x50FB, 0xFFFF, 0xFFFF, 0x53AB, 0x4A7A, 0x66C8, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66CA, 0x47FE, 0x47F1, 0x548E, 0x66C9,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48B8, 0x4AE5, 0xFFFF, 0x66CB, 0x4C57, 0xFFFF, 0xFFFF, 0x55C1, 0xFFFF, 0xFFFF, 0x46BA, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66CC, 0xFFFF, 0x4EEE, 0xFFFF, 0xFFFF, 0xFFFF, 0x66CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x66CE,
+    0x66CF, 0x66D0, 0xFFFF, 0x66D2, 0x66D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x47E7, 0xFFFF, 0x66D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66D4,
+    0xFFFF, 0x66D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x66D8, 0x66D7, 0xFFFF, 0x66D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x488A, 0x66DA, 0xFFFF, 0xFFFF, 0x46B8,
+    0xFFFF, 0xFFFF, 0x53CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66DC, 0xFFFF, 0x66DE, 0xFFFF, 0x66DB, 0x5CCA, 0x46B5,
+    0xFFFF, 0xFFFF, 0x4BA3, 0xFFFF, 0x5245, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4A8F, 0x4D49, 0x4957, 0xFFFF,
+  },
+  { /* U+99xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x66E0, 0xFFFF, 0x50BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x54BC, 0x4979, 0xFFFF, 0x50A7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x55B3, 0xFFFF, 0x66E2, 0x554B, 0x66E3, 0xFFFF, 0xFFFF, 0xFFFF, 0x66E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66E1, 0x66E8, 0xFFFF,
+    0x66EA, 0x66E7, 0xFFFF, 0xFFFF, 0x66E9, 0xFFFF, 0xFFFF, 0x66E5, 0x4862, 0xFFFF, 0xFFFF, 0xFFFF, 0x66EB, 0xFFFF, 0x66EC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66ED, 0x66EE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x66EF, 0xFFFF, 0xFFFF, 0x66F1, 0xFFFF, 0xFFFF, 0xFFFF, 0x66F0, 0xFFFF, 0x66F3, 0x66F5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x66F2, 0x66F4, 0x52E8, 0xFFFF, 0xFFFF, 0x66F6, 0xFFFF, 0x51D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x49BE, 0x66F7, 0x66F8, 0x46BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66F9, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66FA, 0xFFFF, 0xFFFF, 0x4B85, 0xFFFF, 0xFFFF, 0xFFFF, 0x4664, 0x66FB, 0x66FC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x52DF, 0x50A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x66FD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x55E5, 0xFFFF, 0xFFFF, 0x4DE5, 0x49AC, 0x4CFE, 0xFFFF, 0x4F85, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4DF5, 0x6744, 0x49FC, 0xFFFF, 0xFFFF, 0x53BE, 0xFFFF, 0xFFFF, 0x6743, 0xFFFF, 0xFFFF, 0x6741, 0xFFFF, 0x6742, 0xFFFF, 0x66FE,
+    0xFFFF, 0xFFFF, 0x6747, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6745, 0x6746, 0xFFFF,
+    0xFFFF, 0x6748, 0x6749, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x674B, 0xFFFF, 0xFFFF, 0x674A, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CC0,
+  },
+  { /* U+9Axx */
+    0xFFFF, 0x674C, 0xFFFF, 0xFFFF, 0xFFFF, 0x674E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5058, 0x674D,
+    0xFFFF, 0xFFFF, 0x4DD2, 0x48B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x674F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53DA, 0xFFFF, 0xFFFF, 0x6750, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x4E5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6751, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6756, 0xFFFF,
+    0x6752, 0xFFFF, 0x6754, 0x6755, 0xFFFF, 0x6753, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6758, 0x6759, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6757, 0xFFFF, 0x675B, 0xFFFF, 0xFFFF, 0x4CD5, 0x675A, 0xFFFF, 0xFFFF, 0xFFFF, 0x675C,
+    0xFFFF, 0xFFFF, 0x675D, 0xFFFF, 0x6760, 0x675F, 0xFFFF, 0xFFFF, 0xFFFF, 0x675E, 0x6761, 0x6762, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6763, 0xFFFF, 0xFFFF,
+    0x6764, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x559C, 0xFFFF, 0xFFFF, 0xFFFF, 0x6765, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x6766, 0xFFFF, 0xFFFF, 0xFFFF, 0x52C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6767,
+    0xFFFF, 0x676A, 0xFFFF, 0x6768, 0x6769, 0xFFFF, 0xFFFF, 0xFFFF, 0x4571, 0x676B, 0xFFFF, 0xFFFF, 0x676C, 0xFFFF, 0x676D, 0x676E,
+    0xFFFF, 0xFFFF, 0x676F, 0x6770, 0xFFFF, 0xFFFF, 0x6771, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CF6, 0x6773, 0xFFFF, 0x509D, 0x6774, 0x6772,
+    0xFFFF, 0x6776, 0xFFFF, 0xFFFF, 0x6775, 0xFFFF, 0xFFFF, 0x6777, 0xFFFF, 0xFFFF, 0xFFFF, 0x6778, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6779, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x677A, 0xFFFF, 0x677B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x677C,
+    0xFFFF, 0xFFFF, 0x677D, 0x677E, 0xFFFF, 0x677F, 0xFFFF, 0x6780, 0x6781, 0x6782, 0x6783, 0xFFFF, 0xFFFF, 0xFFFF, 0x6784, 0x6785,
+    0xFFFF, 0x6786, 0x6787, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6788, 0x4AC8, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x52CB, 0x50A8, 0x678A, 0x6789, 0x4DB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x678B, 0x678C, 0x5389,
+    0xFFFF, 0x678D, 0xFFFF, 0xFFFF, 0x4DE2, 0xFFFF, 0xFFFF, 0xFFFF, 0x678E, 0xFFFF, 0x48EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51F4,
+    0xFFFF, 0xFFFF, 0x6791, 0xFFFF, 0x6790, 0x678F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x6794, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4F8E, 0x6793,
+    0xFFFF, 0x6795, 0x528D, 0x6792, 0xFFFF, 0xFFFF, 0x6796, 0x6797, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6798,
+    0x6799, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x679A, 0xFFFF, 0x55CE, 0x4EB7, 0xFFFF, 0x5391, 0x4CE9, 0xFFFF,
+    0xFFFF, 0x679B, 0xFFFF, 0xFFFF, 0x679C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67A0, 0xFFFF, 0x679F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x679D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67A1, 0xFFFF, 0xFFFF, 0x4FC6, 0x679E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67A2,
+    0xFFFF, 0x67A3, 0x67A4, 0xFFFF, 0x67A8, 0xFFFF, 0x4FE4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x50D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x67A9, 0x67A6, 0x67A5, 0x67A7, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x5551, 0x67AB, 0x67AC, 0xFFFF, 0xFFFF, 0x67AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Cxx */
+    0x67B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x67AD, 0xFFFF, 0x67B5, 0xFFFF, 0x67B6, 0x67B2, 0x67B8, 0xFFFF, 0x67B4, 0x5571, 0xFFFF, 0xFFFF,
+    0x5293, 0xFFFF, 0x67B7, 0x67B3, 0x67B0, 0x67AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x67BC, 0xFFFF, 0xFFFF, 0x67BB, 0x67BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x546E, 0x67B9, 0x55C8,
+    0x67BD, 0xFFFF, 0x67BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x53D5, 0x51F0, 0x54AB, 0xFFFF, 0xFFFF, 0x67C1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67C0, 0x67BE, 0x5560, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x53C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x554C, 0xFFFF, 0xFFFF, 0x67C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x67C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67C5, 0xFFFF, 0x67C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4779, 0xFFFF, 0x67C8, 0xFFFF, 0x4D95, 0xFFFF, 0x67C7, 0x67C9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x67CA, 0xFFFF, 0xFFFF, 0x4EA6, 0x4B70, 0xFFFF, 0x54C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x67CC, 0xFFFF, 0xFFFF, 0x67CD, 0x51A1, 0x54FC, 0x67CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5464, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x67D4, 0xFFFF, 0xFFFF, 0x67D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x52C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x67D2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x67D1, 0xFFFF, 0xFFFF, 0x67CF, 0xFFFF, 0x4C54, 0xFFFF, 0x67CE, 0x50BA, 0x67D0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4DD6, 0xFFFF, 0xFFFF, 0x67D8, 0x67D6,
+    0xFFFF, 0x67D5, 0xFFFF, 0xFFFF, 0x67D7, 0xFFFF, 0x67D9, 0xFFFF, 0x67DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x67DF, 0x67DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67DD, 0xFFFF, 0xFFFF, 0x4BE7, 0x67DB, 0x67DC, 0xFFFF,
+    0x50FD, 0x557E, 0xFFFF, 0xFFFF, 0x67E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E4, 0x518A, 0xFFFF, 0xFFFF, 0x67E5,
+    0x67E2, 0xFFFF, 0x67E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E3, 0xFFFF, 0x5342, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4D8E,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67E9, 0xFFFF, 0x67EA, 0xFFFF, 0xFFFF, 0xFFFF, 0x50E5,
+    0xFFFF, 0xFFFF, 0x67EB, 0xFFFF, 0x477A, 0xFFFF, 0xFFFF, 0xFFFF, 0x67EF, 0xFFFF, 0x67F0, 0x67EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x67ED, 0x67F3, 0xFFFF, 0x67EC, 0xFFFF, 0x67F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x67F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F9, 0xFFFF, 0x67FA,
+    0xFFFF, 0xFFFF, 0x4BF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67F7, 0x4B7A, 0x50AF, 0xFFFF, 0xFFFF, 0x67FB, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x67FE, 0x67FC, 0x67FD, 0xFFFF, 0xFFFF, 0x6841, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6842, 0xFFFF, 0xFFFF, 0x4C7D, 0x6843, 0xFFFF, 0xFFFF, 0xFFFF, 0x6844, 0xFFFF, 0x4697,
+    0xFFFF, 0x6845, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6846, 0xFFFF, 0xFFFF, 0x6847, 0x6848, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x684A, 0x51F9, 0x519E, 0xFFFF, 0x6849, 0xFFFF, 0x4CF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x684B, 0xFFFF, 0x519B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x684C, 0x4AE0, 0xFFFF, 0xFFFF, 0x53B4, 0x684E, 0xFFFF, 0xFFFF, 0x684F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x684D, 0x5261, 0x555F, 0x48A7, 0x6850, 0xFFFF, 0x6851, 0x4EEA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4AC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6853, 0x55AE, 0x51A7, 0x6854,
+    0x6855, 0x6856, 0x4679, 0xFFFF, 0x6857, 0xFFFF, 0xFFFF, 0xFFFF, 0x5E90, 0x4DBC, 0xFFFF, 0x51DD, 0x6858, 0x685A, 0x6859, 0xFFFF,
+    0x685B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x685C, 0xFFFF, 0xFFFF, 0x685D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x685E,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x685F, 0xFFFF, 0x6860, 0x6861, 0xFFFF, 0x6862, 0xFFFF, 0x6863, 0x6864, 0x6865, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6866, 0x6867, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x51AA, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x4FAF, 0xFFFF, 0x6869, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x50CB, 0x686A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x686B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x4CFD, 0xFFFF, 0xFFFF, 0x686C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x686D, 0x51F5, 0xFFFF, 0xFFFF, 0x686E, 0x686F,
+    0xFFFF, 0xFFFF, 0x6870, 0xFFFF, 0x6871, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6873,
+    0x6874, 0x6875, 0x4C80, 0x6872, 0xFFFF, 0xFFFF, 0x6876, 0x6877, 0xFFFF, 0xFFFF, 0x6879, 0xFFFF, 0x6878, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x687B, 0xFFFF, 0xFFFF, 0xFFFF, 0x687C, 0x687A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x48CA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x687D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x687E, 0x5FF7, 0xFFFF, 0xFFFF,
+    0x687F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+E0xx */
+    0x6941, 0x6942, 0x6943, 0x6944, 0x6945, 0x6946, 0x6947, 0x6948, 0x6949, 0x694A, 0x694B, 0x694C, 0x694D, 0x694E, 0x694F, 0x6950,
+    0x6951, 0x6952, 0x6953, 0x6954, 0x6955, 0x6956, 0x6957, 0x6958, 0x6959, 0x695A, 0x695B, 0x695C, 0x695D, 0x695E, 0x695F, 0x6960,
+    0x6961, 0x6962, 0x6963, 0x6964, 0x6965, 0x6966, 0x6967, 0x6968, 0x6969, 0x696A, 0x696B, 0x696C, 0x696D, 0x696E, 0x696F, 0x6970,
+    0x6971, 0x6972, 0x6973, 0x6974, 0x6975, 0x6976, 0x6977, 0x6978, 0x6979, 0x697A, 0x697B, 0x697C, 0x697D, 0x697E, 0x697F, 0x6980,
+    0x6981, 0x6982, 0x6983, 0x6984, 0x6985, 0x6986, 0x6987, 0x6988, 0x6989, 0x698A, 0x698B, 0x698C, 0x698D, 0x698E, 0x698F, 0x6990,
+    0x6991, 0x6992, 0x6993, 0x6994, 0x6995, 0x6996, 0x6997, 0x6998, 0x6999, 0x699A, 0x699B, 0x699C, 0x699D, 0x699E, 0x699F, 0x69A0,
+    0x69A1, 0x69A2, 0x69A3, 0x69A4, 0x69A5, 0x69A6, 0x69A7, 0x69A8, 0x69A9, 0x69AA, 0x69AB, 0x69AC, 0x69AD, 0x69AE, 0x69AF, 0x69B0,
+    0x69B1, 0x69B2, 0x69B3, 0x69B4, 0x69B5, 0x69B6, 0x69B7, 0x69B8, 0x69B9, 0x69BA, 0x69BB, 0x69BC, 0x69BD, 0x69BE, 0x69BF, 0x69C0,
+    0x69C1, 0x69C2, 0x69C3, 0x69C4, 0x69C5, 0x69C6, 0x69C7, 0x69C8, 0x69C9, 0x69CA, 0x69CB, 0x69CC, 0x69CD, 0x69CE, 0x69CF, 0x69D0,
+    0x69D1, 0x69D2, 0x69D3, 0x69D4, 0x69D5, 0x69D6, 0x69D7, 0x69D8, 0x69D9, 0x69DA, 0x69DB, 0x69DC, 0x69DD, 0x69DE, 0x69DF, 0x69E0,
+    0x69E1, 0x69E2, 0x69E3, 0x69E4, 0x69E5, 0x69E6, 0x69E7, 0x69E8, 0x69E9, 0x69EA, 0x69EB, 0x69EC, 0x69ED, 0x69EE, 0x69EF, 0x69F0,
+    0x69F1, 0x69F2, 0x69F3, 0x69F4, 0x69F5, 0x69F6, 0x69F7, 0x69F8, 0x69F9, 0x69FA, 0x69FB, 0x69FC, 0x69FD, 0x69FE, 0x6A41, 0x6A42,
+    0x6A43, 0x6A44, 0x6A45, 0x6A46, 0x6A47, 0x6A48, 0x6A49, 0x6A4A, 0x6A4B, 0x6A4C, 0x6A4D, 0x6A4E, 0x6A4F, 0x6A50, 0x6A51, 0x6A52,
+    0x6A53, 0x6A54, 0x6A55, 0x6A56, 0x6A57, 0x6A58, 0x6A59, 0x6A5A, 0x6A5B, 0x6A5C, 0x6A5D, 0x6A5E, 0x6A5F, 0x6A60, 0x6A61, 0x6A62,
+    0x6A63, 0x6A64, 0x6A65, 0x6A66, 0x6A67, 0x6A68, 0x6A69, 0x6A6A, 0x6A6B, 0x6A6C, 0x6A6D, 0x6A6E, 0x6A6F, 0x6A70, 0x6A71, 0x6A72,
+    0x6A73, 0x6A74, 0x6A75, 0x6A76, 0x6A77, 0x6A78, 0x6A79, 0x6A7A, 0x6A7B, 0x6A7C, 0x6A7D, 0x6A7E, 0x6A7F, 0x6A80, 0x6A81, 0x6A82,
+  },
+  { /* U+E1xx */
+    0x6A83, 0x6A84, 0x6A85, 0x6A86, 0x6A87, 0x6A88, 0x6A89, 0x6A8A, 0x6A8B, 0x6A8C, 0x6A8D, 0x6A8E, 0x6A8F, 0x6A90, 0x6A91, 0x6A92,
+    0x6A93, 0x6A94, 0x6A95, 0x6A96, 0x6A97, 0x6A98, 0x6A99, 0x6A9A, 0x6A9B, 0x6A9C, 0x6A9D, 0x6A9E, 0x6A9F, 0x6AA0, 0x6AA1, 0x6AA2,
+    0x6AA3, 0x6AA4, 0x6AA5, 0x6AA6, 0x6AA7, 0x6AA8, 0x6AA9, 0x6AAA, 0x6AAB, 0x6AAC, 0x6AAD, 0x6AAE, 0x6AAF, 0x6AB0, 0x6AB1, 0x6AB2,
+    0x6AB3, 0x6AB4, 0x6AB5, 0x6AB6, 0x6AB7, 0x6AB8, 0x6AB9, 0x6ABA, 0x6ABB, 0x6ABC, 0x6ABD, 0x6ABE, 0x6ABF, 0x6AC0, 0x6AC1, 0x6AC2,
+    0x6AC3, 0x6AC4, 0x6AC5, 0x6AC6, 0x6AC7, 0x6AC8, 0x6AC9, 0x6ACA, 0x6ACB, 0x6ACC, 0x6ACD, 0x6ACE, 0x6ACF, 0x6AD0, 0x6AD1, 0x6AD2,
+    0x6AD3, 0x6AD4, 0x6AD5, 0x6AD6, 0x6AD7, 0x6AD8, 0x6AD9, 0x6ADA, 0x6ADB, 0x6ADC, 0x6ADD, 0x6ADE, 0x6ADF, 0x6AE0, 0x6AE1, 0x6AE2,
+    0x6AE3, 0x6AE4, 0x6AE5, 0x6AE6, 0x6AE7, 0x6AE8, 0x6AE9, 0x6AEA, 0x6AEB, 0x6AEC, 0x6AED, 0x6AEE, 0x6AEF, 0x6AF0, 0x6AF1, 0x6AF2,
+    0x6AF3, 0x6AF4, 0x6AF5, 0x6AF6, 0x6AF7, 0x6AF8, 0x6AF9, 0x6AFA, 0x6AFB, 0x6AFC, 0x6AFD, 0x6AFE, 0x6B41, 0x6B42, 0x6B43, 0x6B44,
+    0x6B45, 0x6B46, 0x6B47, 0x6B48, 0x6B49, 0x6B4A, 0x6B4B, 0x6B4C, 0x6B4D, 0x6B4E, 0x6B4F, 0x6B50, 0x6B51, 0x6B52, 0x6B53, 0x6B54,
+    0x6B55, 0x6B56, 0x6B57, 0x6B58, 0x6B59, 0x6B5A, 0x6B5B, 0x6B5C, 0x6B5D, 0x6B5E, 0x6B5F, 0x6B60, 0x6B61, 0x6B62, 0x6B63, 0x6B64,
+    0x6B65, 0x6B66, 0x6B67, 0x6B68, 0x6B69, 0x6B6A, 0x6B6B, 0x6B6C, 0x6B6D, 0x6B6E, 0x6B6F, 0x6B70, 0x6B71, 0x6B72, 0x6B73, 0x6B74,
+    0x6B75, 0x6B76, 0x6B77, 0x6B78, 0x6B79, 0x6B7A, 0x6B7B, 0x6B7C, 0x6B7D, 0x6B7E, 0x6B7F, 0x6B80, 0x6B81, 0x6B82, 0x6B83, 0x6B84,
+    0x6B85, 0x6B86, 0x6B87, 0x6B88, 0x6B89, 0x6B8A, 0x6B8B, 0x6B8C, 0x6B8D, 0x6B8E, 0x6B8F, 0x6B90, 0x6B91, 0x6B92, 0x6B93, 0x6B94,
+    0x6B95, 0x6B96, 0x6B97, 0x6B98, 0x6B99, 0x6B9A, 0x6B9B, 0x6B9C, 0x6B9D, 0x6B9E, 0x6B9F, 0x6BA0, 0x6BA1, 0x6BA2, 0x6BA3, 0x6BA4,
+    0x6BA5, 0x6BA6, 0x6BA7, 0x6BA8, 0x6BA9, 0x6BAA, 0x6BAB, 0x6BAC, 0x6BAD, 0x6BAE, 0x6BAF, 0x6BB0, 0x6BB1, 0x6BB2, 0x6BB3, 0x6BB4,
+    0x6BB5, 0x6BB6, 0x6BB7, 0x6BB8, 0x6BB9, 0x6BBA, 0x6BBB, 0x6BBC, 0x6BBD, 0x6BBE, 0x6BBF, 0x6BC0, 0x6BC1, 0x6BC2, 0x6BC3, 0x6BC4,
+  },
+  { /* U+E2xx */
+    0x6BC5, 0x6BC6, 0x6BC7, 0x6BC8, 0x6BC9, 0x6BCA, 0x6BCB, 0x6BCC, 0x6BCD, 0x6BCE, 0x6BCF, 0x6BD0, 0x6BD1, 0x6BD2, 0x6BD3, 0x6BD4,
+    0x6BD5, 0x6BD6, 0x6BD7, 0x6BD8, 0x6BD9, 0x6BDA, 0x6BDB, 0x6BDC, 0x6BDD, 0x6BDE, 0x6BDF, 0x6BE0, 0x6BE1, 0x6BE2, 0x6BE3, 0x6BE4,
+    0x6BE5, 0x6BE6, 0x6BE7, 0x6BE8, 0x6BE9, 0x6BEA, 0x6BEB, 0x6BEC, 0x6BED, 0x6BEE, 0x6BEF, 0x6BF0, 0x6BF1, 0x6BF2, 0x6BF3, 0x6BF4,
+    0x6BF5, 0x6BF6, 0x6BF7, 0x6BF8, 0x6BF9, 0x6BFA, 0x6BFB, 0x6BFC, 0x6BFD, 0x6BFE, 0x6C41, 0x6C42, 0x6C43, 0x6C44, 0x6C45, 0x6C46,
+    0x6C47, 0x6C48, 0x6C49, 0x6C4A, 0x6C4B, 0x6C4C, 0x6C4D, 0x6C4E, 0x6C4F, 0x6C50, 0x6C51, 0x6C52, 0x6C53, 0x6C54, 0x6C55, 0x6C56,
+    0x6C57, 0x6C58, 0x6C59, 0x6C5A, 0x6C5B, 0x6C5C, 0x6C5D, 0x6C5E, 0x6C5F, 0x6C60, 0x6C61, 0x6C62, 0x6C63, 0x6C64, 0x6C65, 0x6C66,
+    0x6C67, 0x6C68, 0x6C69, 0x6C6A, 0x6C6B, 0x6C6C, 0x6C6D, 0x6C6E, 0x6C6F, 0x6C70, 0x6C71, 0x6C72, 0x6C73, 0x6C74, 0x6C75, 0x6C76,
+    0x6C77, 0x6C78, 0x6C79, 0x6C7A, 0x6C7B, 0x6C7C, 0x6C7D, 0x6C7E, 0x6C7F, 0x6C80, 0x6C81, 0x6C82, 0x6C83, 0x6C84, 0x6C85, 0x6C86,
+    0x6C87, 0x6C88, 0x6C89, 0x6C8A, 0x6C8B, 0x6C8C, 0x6C8D, 0x6C8E, 0x6C8F, 0x6C90, 0x6C91, 0x6C92, 0x6C93, 0x6C94, 0x6C95, 0x6C96,
+    0x6C97, 0x6C98, 0x6C99, 0x6C9A, 0x6C9B, 0x6C9C, 0x6C9D, 0x6C9E, 0x6C9F, 0x6CA0, 0x6CA1, 0x6CA2, 0x6CA3, 0x6CA4, 0x6CA5, 0x6CA6,
+    0x6CA7, 0x6CA8, 0x6CA9, 0x6CAA, 0x6CAB, 0x6CAC, 0x6CAD, 0x6CAE, 0x6CAF, 0x6CB0, 0x6CB1, 0x6CB2, 0x6CB3, 0x6CB4, 0x6CB5, 0x6CB6,
+    0x6CB7, 0x6CB8, 0x6CB9, 0x6CBA, 0x6CBB, 0x6CBC, 0x6CBD, 0x6CBE, 0x6CBF, 0x6CC0, 0x6CC1, 0x6CC2, 0x6CC3, 0x6CC4, 0x6CC5, 0x6CC6,
+    0x6CC7, 0x6CC8, 0x6CC9, 0x6CCA, 0x6CCB, 0x6CCC, 0x6CCD, 0x6CCE, 0x6CCF, 0x6CD0, 0x6CD1, 0x6CD2, 0x6CD3, 0x6CD4, 0x6CD5, 0x6CD6,
+    0x6CD7, 0x6CD8, 0x6CD9, 0x6CDA, 0x6CDB, 0x6CDC, 0x6CDD, 0x6CDE, 0x6CDF, 0x6CE0, 0x6CE1, 0x6CE2, 0x6CE3, 0x6CE4, 0x6CE5, 0x6CE6,
+    0x6CE7, 0x6CE8, 0x6CE9, 0x6CEA, 0x6CEB, 0x6CEC, 0x6CED, 0x6CEE, 0x6CEF, 0x6CF0, 0x6CF1, 0x6CF2, 0x6CF3, 0x6CF4, 0x6CF5, 0x6CF6,
+    0x6CF7, 0x6CF8, 0x6CF9, 0x6CFA, 0x6CFB, 0x6CFC, 0x6CFD, 0x6CFE, 0x6D41, 0x6D42, 0x6D43, 0x6D44, 0x6D45, 0x6D46, 0x6D47, 0x6D48,
+  },
+  { /* U+E3xx */
+    0x6D49, 0x6D4A, 0x6D4B, 0x6D4C, 0x6D4D, 0x6D4E, 0x6D4F, 0x6D50, 0x6D51, 0x6D52, 0x6D53, 0x6D54, 0x6D55, 0x6D56, 0x6D57, 0x6D58,
+    0x6D59, 0x6D5A, 0x6D5B, 0x6D5C, 0x6D5D, 0x6D5E, 0x6D5F, 0x6D60, 0x6D61, 0x6D62, 0x6D63, 0x6D64, 0x6D65, 0x6D66, 0x6D67, 0x6D68,
+    0x6D69, 0x6D6A, 0x6D6B, 0x6D6C, 0x6D6D, 0x6D6E, 0x6D6F, 0x6D70, 0x6D71, 0x6D72, 0x6D73, 0x6D74, 0x6D75, 0x6D76, 0x6D77, 0x6D78,
+    0x6D79, 0x6D7A, 0x6D7B, 0x6D7C, 0x6D7D, 0x6D7E, 0x6D7F, 0x6D80, 0x6D81, 0x6D82, 0x6D83, 0x6D84, 0x6D85, 0x6D86, 0x6D87, 0x6D88,
+    0x6D89, 0x6D8A, 0x6D8B, 0x6D8C, 0x6D8D, 0x6D8E, 0x6D8F, 0x6D90, 0x6D91, 0x6D92, 0x6D93, 0x6D94, 0x6D95, 0x6D96, 0x6D97, 0x6D98,
+    0x6D99, 0x6D9A, 0x6D9B, 0x6D9C, 0x6D9D, 0x6D9E, 0x6D9F, 0x6DA0, 0x6DA1, 0x6DA2, 0x6DA3, 0x6DA4, 0x6DA5, 0x6DA6, 0x6DA7, 0x6DA8,
+    0x6DA9, 0x6DAA, 0x6DAB, 0x6DAC, 0x6DAD, 0x6DAE, 0x6DAF, 0x6DB0, 0x6DB1, 0x6DB2, 0x6DB3, 0x6DB4, 0x6DB5, 0x6DB6, 0x6DB7, 0x6DB8,
+    0x6DB9, 0x6DBA, 0x6DBB, 0x6DBC, 0x6DBD, 0x6DBE, 0x6DBF, 0x6DC0, 0x6DC1, 0x6DC2, 0x6DC3, 0x6DC4, 0x6DC5, 0x6DC6, 0x6DC7, 0x6DC8,
+    0x6DC9, 0x6DCA, 0x6DCB, 0x6DCC, 0x6DCD, 0x6DCE, 0x6DCF, 0x6DD0, 0x6DD1, 0x6DD2, 0x6DD3, 0x6DD4, 0x6DD5, 0x6DD6, 0x6DD7, 0x6DD8,
+    0x6DD9, 0x6DDA, 0x6DDB, 0x6DDC, 0x6DDD, 0x6DDE, 0x6DDF, 0x6DE0, 0x6DE1, 0x6DE2, 0x6DE3, 0x6DE4, 0x6DE5, 0x6DE6, 0x6DE7, 0x6DE8,
+    0x6DE9, 0x6DEA, 0x6DEB, 0x6DEC, 0x6DED, 0x6DEE, 0x6DEF, 0x6DF0, 0x6DF1, 0x6DF2, 0x6DF3, 0x6DF4, 0x6DF5, 0x6DF6, 0x6DF7, 0x6DF8,
+    0x6DF9, 0x6DFA, 0x6DFB, 0x6DFC, 0x6DFD, 0x6DFE, 0x6E41, 0x6E42, 0x6E43, 0x6E44, 0x6E45, 0x6E46, 0x6E47, 0x6E48, 0x6E49, 0x6E4A,
+    0x6E4B, 0x6E4C, 0x6E4D, 0x6E4E, 0x6E4F, 0x6E50, 0x6E51, 0x6E52, 0x6E53, 0x6E54, 0x6E55, 0x6E56, 0x6E57, 0x6E58, 0x6E59, 0x6E5A,
+    0x6E5B, 0x6E5C, 0x6E5D, 0x6E5E, 0x6E5F, 0x6E60, 0x6E61, 0x6E62, 0x6E63, 0x6E64, 0x6E65, 0x6E66, 0x6E67, 0x6E68, 0x6E69, 0x6E6A,
+    0x6E6B, 0x6E6C, 0x6E6D, 0x6E6E, 0x6E6F, 0x6E70, 0x6E71, 0x6E72, 0x6E73, 0x6E74, 0x6E75, 0x6E76, 0x6E77, 0x6E78, 0x6E79, 0x6E7A,
+    0x6E7B, 0x6E7C, 0x6E7D, 0x6E7E, 0x6E7F, 0x6E80, 0x6E81, 0x6E82, 0x6E83, 0x6E84, 0x6E85, 0x6E86, 0x6E87, 0x6E88, 0x6E89, 0x6E8A,
+  },
+  { /* U+E4xx */
+    0x6E8B, 0x6E8C, 0x6E8D, 0x6E8E, 0x6E8F, 0x6E90, 0x6E91, 0x6E92, 0x6E93, 0x6E94, 0x6E95, 0x6E96, 0x6E97, 0x6E98, 0x6E99, 0x6E9A,
+    0x6E9B, 0x6E9C, 0x6E9D, 0x6E9E, 0x6E9F, 0x6EA0, 0x6EA1, 0x6EA2, 0x6EA3, 0x6EA4, 0x6EA5, 0x6EA6, 0x6EA7, 0x6EA8, 0x6EA9, 0x6EAA,
+    0x6EAB, 0x6EAC, 0x6EAD, 0x6EAE, 0x6EAF, 0x6EB0, 0x6EB1, 0x6EB2, 0x6EB3, 0x6EB4, 0x6EB5, 0x6EB6, 0x6EB7, 0x6EB8, 0x6EB9, 0x6EBA,
+    0x6EBB, 0x6EBC, 0x6EBD, 0x6EBE, 0x6EBF, 0x6EC0, 0x6EC1, 0x6EC2, 0x6EC3, 0x6EC4, 0x6EC5, 0x6EC6, 0x6EC7, 0x6EC8, 0x6EC9, 0x6ECA,
+    0x6ECB, 0x6ECC, 0x6ECD, 0x6ECE, 0x6ECF, 0x6ED0, 0x6ED1, 0x6ED2, 0x6ED3, 0x6ED4, 0x6ED5, 0x6ED6, 0x6ED7, 0x6ED8, 0x6ED9, 0x6EDA,
+    0x6EDB, 0x6EDC, 0x6EDD, 0x6EDE, 0x6EDF, 0x6EE0, 0x6EE1, 0x6EE2, 0x6EE3, 0x6EE4, 0x6EE5, 0x6EE6, 0x6EE7, 0x6EE8, 0x6EE9, 0x6EEA,
+    0x6EEB, 0x6EEC, 0x6EED, 0x6EEE, 0x6EEF, 0x6EF0, 0x6EF1, 0x6EF2, 0x6EF3, 0x6EF4, 0x6EF5, 0x6EF6, 0x6EF7, 0x6EF8, 0x6EF9, 0x6EFA,
+    0x6EFB, 0x6EFC, 0x6EFD, 0x6EFE, 0x6F41, 0x6F42, 0x6F43, 0x6F44, 0x6F45, 0x6F46, 0x6F47, 0x6F48, 0x6F49, 0x6F4A, 0x6F4B, 0x6F4C,
+    0x6F4D, 0x6F4E, 0x6F4F, 0x6F50, 0x6F51, 0x6F52, 0x6F53, 0x6F54, 0x6F55, 0x6F56, 0x6F57, 0x6F58, 0x6F59, 0x6F5A, 0x6F5B, 0x6F5C,
+    0x6F5D, 0x6F5E, 0x6F5F, 0x6F60, 0x6F61, 0x6F62, 0x6F63, 0x6F64, 0x6F65, 0x6F66, 0x6F67, 0x6F68, 0x6F69, 0x6F6A, 0x6F6B, 0x6F6C,
+    0x6F6D, 0x6F6E, 0x6F6F, 0x6F70, 0x6F71, 0x6F72, 0x6F73, 0x6F74, 0x6F75, 0x6F76, 0x6F77, 0x6F78, 0x6F79, 0x6F7A, 0x6F7B, 0x6F7C,
+    0x6F7D, 0x6F7E, 0x6F7F, 0x6F80, 0x6F81, 0x6F82, 0x6F83, 0x6F84, 0x6F85, 0x6F86, 0x6F87, 0x6F88, 0x6F89, 0x6F8A, 0x6F8B, 0x6F8C,
+    0x6F8D, 0x6F8E, 0x6F8F, 0x6F90, 0x6F91, 0x6F92, 0x6F93, 0x6F94, 0x6F95, 0x6F96, 0x6F97, 0x6F98, 0x6F99, 0x6F9A, 0x6F9B, 0x6F9C,
+    0x6F9D, 0x6F9E, 0x6F9F, 0x6FA0, 0x6FA1, 0x6FA2, 0x6FA3, 0x6FA4, 0x6FA5, 0x6FA6, 0x6FA7, 0x6FA8, 0x6FA9, 0x6FAA, 0x6FAB, 0x6FAC,
+    0x6FAD, 0x6FAE, 0x6FAF, 0x6FB0, 0x6FB1, 0x6FB2, 0x6FB3, 0x6FB4, 0x6FB5, 0x6FB6, 0x6FB7, 0x6FB8, 0x6FB9, 0x6FBA, 0x6FBB, 0x6FBC,
+    0x6FBD, 0x6FBE, 0x6FBF, 0x6FC0, 0x6FC1, 0x6FC2, 0x6FC3, 0x6FC4, 0x6FC5, 0x6FC6, 0x6FC7, 0x6FC8, 0x6FC9, 0x6FCA, 0x6FCB, 0x6FCC,
+  },
+  { /* U+E5xx */
+    0x6FCD, 0x6FCE, 0x6FCF, 0x6FD0, 0x6FD1, 0x6FD2, 0x6FD3, 0x6FD4, 0x6FD5, 0x6FD6, 0x6FD7, 0x6FD8, 0x6FD9, 0x6FDA, 0x6FDB, 0x6FDC,
+    0x6FDD, 0x6FDE, 0x6FDF, 0x6FE0, 0x6FE1, 0x6FE2, 0x6FE3, 0x6FE4, 0x6FE5, 0x6FE6, 0x6FE7, 0x6FE8, 0x6FE9, 0x6FEA, 0x6FEB, 0x6FEC,
+    0x6FED, 0x6FEE, 0x6FEF, 0x6FF0, 0x6FF1, 0x6FF2, 0x6FF3, 0x6FF4, 0x6FF5, 0x6FF6, 0x6FF7, 0x6FF8, 0x6FF9, 0x6FFA, 0x6FFB, 0x6FFC,
+    0x6FFD, 0x6FFE, 0x7041, 0x7042, 0x7043, 0x7044, 0x7045, 0x7046, 0x7047, 0x7048, 0x7049, 0x704A, 0x704B, 0x704C, 0x704D, 0x704E,
+    0x704F, 0x7050, 0x7051, 0x7052, 0x7053, 0x7054, 0x7055, 0x7056, 0x7057, 0x7058, 0x7059, 0x705A, 0x705B, 0x705C, 0x705D, 0x705E,
+    0x705F, 0x7060, 0x7061, 0x7062, 0x7063, 0x7064, 0x7065, 0x7066, 0x7067, 0x7068, 0x7069, 0x706A, 0x706B, 0x706C, 0x706D, 0x706E,
+    0x706F, 0x7070, 0x7071, 0x7072, 0x7073, 0x7074, 0x7075, 0x7076, 0x7077, 0x7078, 0x7079, 0x707A, 0x707B, 0x707C, 0x707D, 0x707E,
+    0x707F, 0x7080, 0x7081, 0x7082, 0x7083, 0x7084, 0x7085, 0x7086, 0x7087, 0x7088, 0x7089, 0x708A, 0x708B, 0x708C, 0x708D, 0x708E,
+    0x708F, 0x7090, 0x7091, 0x7092, 0x7093, 0x7094, 0x7095, 0x7096, 0x7097, 0x7098, 0x7099, 0x709A, 0x709B, 0x709C, 0x709D, 0x709E,
+    0x709F, 0x70A0, 0x70A1, 0x70A2, 0x70A3, 0x70A4, 0x70A5, 0x70A6, 0x70A7, 0x70A8, 0x70A9, 0x70AA, 0x70AB, 0x70AC, 0x70AD, 0x70AE,
+    0x70AF, 0x70B0, 0x70B1, 0x70B2, 0x70B3, 0x70B4, 0x70B5, 0x70B6, 0x70B7, 0x70B8, 0x70B9, 0x70BA, 0x70BB, 0x70BC, 0x70BD, 0x70BE,
+    0x70BF, 0x70C0, 0x70C1, 0x70C2, 0x70C3, 0x70C4, 0x70C5, 0x70C6, 0x70C7, 0x70C8, 0x70C9, 0x70CA, 0x70CB, 0x70CC, 0x70CD, 0x70CE,
+    0x70CF, 0x70D0, 0x70D1, 0x70D2, 0x70D3, 0x70D4, 0x70D5, 0x70D6, 0x70D7, 0x70D8, 0x70D9, 0x70DA, 0x70DB, 0x70DC, 0x70DD, 0x70DE,
+    0x70DF, 0x70E0, 0x70E1, 0x70E2, 0x70E3, 0x70E4, 0x70E5, 0x70E6, 0x70E7, 0x70E8, 0x70E9, 0x70EA, 0x70EB, 0x70EC, 0x70ED, 0x70EE,
+    0x70EF, 0x70F0, 0x70F1, 0x70F2, 0x70F3, 0x70F4, 0x70F5, 0x70F6, 0x70F7, 0x70F8, 0x70F9, 0x70FA, 0x70FB, 0x70FC, 0x70FD, 0x70FE,
+    0x7141, 0x7142, 0x7143, 0x7144, 0x7145, 0x7146, 0x7147, 0x7148, 0x7149, 0x714A, 0x714B, 0x714C, 0x714D, 0x714E, 0x714F, 0x7150,
+  },
+  { /* U+E6xx */
+    0x7151, 0x7152, 0x7153, 0x7154, 0x7155, 0x7156, 0x7157, 0x7158, 0x7159, 0x715A, 0x715B, 0x715C, 0x715D, 0x715E, 0x715F, 0x7160,
+    0x7161, 0x7162, 0x7163, 0x7164, 0x7165, 0x7166, 0x7167, 0x7168, 0x7169, 0x716A, 0x716B, 0x716C, 0x716D, 0x716E, 0x716F, 0x7170,
+    0x7171, 0x7172, 0x7173, 0x7174, 0x7175, 0x7176, 0x7177, 0x7178, 0x7179, 0x717A, 0x717B, 0x717C, 0x717D, 0x717E, 0x717F, 0x7180,
+    0x7181, 0x7182, 0x7183, 0x7184, 0x7185, 0x7186, 0x7187, 0x7188, 0x7189, 0x718A, 0x718B, 0x718C, 0x718D, 0x718E, 0x718F, 0x7190,
+    0x7191, 0x7192, 0x7193, 0x7194, 0x7195, 0x7196, 0x7197, 0x7198, 0x7199, 0x719A, 0x719B, 0x719C, 0x719D, 0x719E, 0x719F, 0x71A0,
+    0x71A1, 0x71A2, 0x71A3, 0x71A4, 0x71A5, 0x71A6, 0x71A7, 0x71A8, 0x71A9, 0x71AA, 0x71AB, 0x71AC, 0x71AD, 0x71AE, 0x71AF, 0x71B0,
+    0x71B1, 0x71B2, 0x71B3, 0x71B4, 0x71B5, 0x71B6, 0x71B7, 0x71B8, 0x71B9, 0x71BA, 0x71BB, 0x71BC, 0x71BD, 0x71BE, 0x71BF, 0x71C0,
+    0x71C1, 0x71C2, 0x71C3, 0x71C4, 0x71C5, 0x71C6, 0x71C7, 0x71C8, 0x71C9, 0x71CA, 0x71CB, 0x71CC, 0x71CD, 0x71CE, 0x71CF, 0x71D0,
+    0x71D1, 0x71D2, 0x71D3, 0x71D4, 0x71D5, 0x71D6, 0x71D7, 0x71D8, 0x71D9, 0x71DA, 0x71DB, 0x71DC, 0x71DD, 0x71DE, 0x71DF, 0x71E0,
+    0x71E1, 0x71E2, 0x71E3, 0x71E4, 0x71E5, 0x71E6, 0x71E7, 0x71E8, 0x71E9, 0x71EA, 0x71EB, 0x71EC, 0x71ED, 0x71EE, 0x71EF, 0x71F0,
+    0x71F1, 0x71F2, 0x71F3, 0x71F4, 0x71F5, 0x71F6, 0x71F7, 0x71F8, 0x71F9, 0x71FA, 0x71FB, 0x71FC, 0x71FD, 0x71FE, 0x7241, 0x7242,
+    0x7243, 0x7244, 0x7245, 0x7246, 0x7247, 0x7248, 0x7249, 0x724A, 0x724B, 0x724C, 0x724D, 0x724E, 0x724F, 0x7250, 0x7251, 0x7252,
+    0x7253, 0x7254, 0x7255, 0x7256, 0x7257, 0x7258, 0x7259, 0x725A, 0x725B, 0x725C, 0x725D, 0x725E, 0x725F, 0x7260, 0x7261, 0x7262,
+    0x7263, 0x7264, 0x7265, 0x7266, 0x7267, 0x7268, 0x7269, 0x726A, 0x726B, 0x726C, 0x726D, 0x726E, 0x726F, 0x7270, 0x7271, 0x7272,
+    0x7273, 0x7274, 0x7275, 0x7276, 0x7277, 0x7278, 0x7279, 0x727A, 0x727B, 0x727C, 0x727D, 0x727E, 0x727F, 0x7280, 0x7281, 0x7282,
+    0x7283, 0x7284, 0x7285, 0x7286, 0x7287, 0x7288, 0x7289, 0x728A, 0x728B, 0x728C, 0x728D, 0x728E, 0x728F, 0x7290, 0x7291, 0x7292,
+  },
+  { /* U+E7xx */
+    0x7293, 0x7294, 0x7295, 0x7296, 0x7297, 0x7298, 0x7299, 0x729A, 0x729B, 0x729C, 0x729D, 0x729E, 0x729F, 0x72A0, 0x72A1, 0x72A2,
+    0x72A3, 0x72A4, 0x72A5, 0x72A6, 0x72A7, 0x72A8, 0x72A9, 0x72AA, 0x72AB, 0x72AC, 0x72AD, 0x72AE, 0x72AF, 0x72B0, 0x72B1, 0x72B2,
+    0x72B3, 0x72B4, 0x72B5, 0x72B6, 0x72B7, 0x72B8, 0x72B9, 0x72BA, 0x72BB, 0x72BC, 0x72BD, 0x72BE, 0x72BF, 0x72C0, 0x72C1, 0x72C2,
+    0x72C3, 0x72C4, 0x72C5, 0x72C6, 0x72C7, 0x72C8, 0x72C9, 0x72CA, 0x72CB, 0x72CC, 0x72CD, 0x72CE, 0x72CF, 0x72D0, 0x72D1, 0x72D2,
+    0x72D3, 0x72D4, 0x72D5, 0x72D6, 0x72D7, 0x72D8, 0x72D9, 0x72DA, 0x72DB, 0x72DC, 0x72DD, 0x72DE, 0x72DF, 0x72E0, 0x72E1, 0x72E2,
+    0x72E3, 0x72E4, 0x72E5, 0x72E6, 0x72E7, 0x72E8, 0x72E9, 0x72EA, 0x72EB, 0x72EC, 0x72ED, 0x72EE, 0x72EF, 0x72F0, 0x72F1, 0x72F2,
+    0x72F3, 0x72F4, 0x72F5, 0x72F6, 0x72F7, 0x72F8, 0x72F9, 0x72FA, 0x72FB, 0x72FC, 0x72FD, 0x72FE, 0x7341, 0x7342, 0x7343, 0x7344,
+    0x7345, 0x7346, 0x7347, 0x7348, 0x7349, 0x734A, 0x734B, 0x734C, 0x734D, 0x734E, 0x734F, 0x7350, 0x7351, 0x7352, 0x7353, 0x7354,
+    0x7355, 0x7356, 0x7357, 0x7358, 0x7359, 0x735A, 0x735B, 0x735C, 0x735D, 0x735E, 0x735F, 0x7360, 0x7361, 0x7362, 0x7363, 0x7364,
+    0x7365, 0x7366, 0x7367, 0x7368, 0x7369, 0x736A, 0x736B, 0x736C, 0x736D, 0x736E, 0x736F, 0x7370, 0x7371, 0x7372, 0x7373, 0x7374,
+    0x7375, 0x7376, 0x7377, 0x7378, 0x7379, 0x737A, 0x737B, 0x737C, 0x737D, 0x737E, 0x737F, 0x7380, 0x7381, 0x7382, 0x7383, 0x7384,
+    0x7385, 0x7386, 0x7387, 0x7388, 0x7389, 0x738A, 0x738B, 0x738C, 0x738D, 0x738E, 0x738F, 0x7390, 0x7391, 0x7392, 0x7393, 0x7394,
+    0x7395, 0x7396, 0x7397, 0x7398, 0x7399, 0x739A, 0x739B, 0x739C, 0x739D, 0x739E, 0x739F, 0x73A0, 0x73A1, 0x73A2, 0x73A3, 0x73A4,
+    0x73A5, 0x73A6, 0x73A7, 0x73A8, 0x73A9, 0x73AA, 0x73AB, 0x73AC, 0x73AD, 0x73AE, 0x73AF, 0x73B0, 0x73B1, 0x73B2, 0x73B3, 0x73B4,
+    0x73B5, 0x73B6, 0x73B7, 0x73B8, 0x73B9, 0x73BA, 0x73BB, 0x73BC, 0x73BD, 0x73BE, 0x73BF, 0x73C0, 0x73C1, 0x73C2, 0x73C3, 0x73C4,
+    0x73C5, 0x73C6, 0x73C7, 0x73C8, 0x73C9, 0x73CA, 0x73CB, 0x73CC, 0x73CD, 0x73CE, 0x73CF, 0x73D0, 0x73D1, 0x73D2, 0x73D3, 0x73D4,
+  },
+  { /* U+E8xx */
+    0x73D5, 0x73D6, 0x73D7, 0x73D8, 0x73D9, 0x73DA, 0x73DB, 0x73DC, 0x73DD, 0x73DE, 0x73DF, 0x73E0, 0x73E1, 0x73E2, 0x73E3, 0x73E4,
+    0x73E5, 0x73E6, 0x73E7, 0x73E8, 0x73E9, 0x73EA, 0x73EB, 0x73EC, 0x73ED, 0x73EE, 0x73EF, 0x73F0, 0x73F1, 0x73F2, 0x73F3, 0x73F4,
+    0x73F5, 0x73F6, 0x73F7, 0x73F8, 0x73F9, 0x73FA, 0x73FB, 0x73FC, 0x73FD, 0x73FE, 0x7441, 0x7442, 0x7443, 0x7444, 0x7445, 0x7446,
+    0x7447, 0x7448, 0x7449, 0x744A, 0x744B, 0x744C, 0x744D, 0x744E, 0x744F, 0x7450, 0x7451, 0x7452, 0x7453, 0x7454, 0x7455, 0x7456,
+    0x7457, 0x7458, 0x7459, 0x745A, 0x745B, 0x745C, 0x745D, 0x745E, 0x745F, 0x7460, 0x7461, 0x7462, 0x7463, 0x7464, 0x7465, 0x7466,
+    0x7467, 0x7468, 0x7469, 0x746A, 0x746B, 0x746C, 0x746D, 0x746E, 0x746F, 0x7470, 0x7471, 0x7472, 0x7473, 0x7474, 0x7475, 0x7476,
+    0x7477, 0x7478, 0x7479, 0x747A, 0x747B, 0x747C, 0x747D, 0x747E, 0x747F, 0x7480, 0x7481, 0x7482, 0x7483, 0x7484, 0x7485, 0x7486,
+    0x7487, 0x7488, 0x7489, 0x748A, 0x748B, 0x748C, 0x748D, 0x748E, 0x748F, 0x7490, 0x7491, 0x7492, 0x7493, 0x7494, 0x7495, 0x7496,
+    0x7497, 0x7498, 0x7499, 0x749A, 0x749B, 0x749C, 0x749D, 0x749E, 0x749F, 0x74A0, 0x74A1, 0x74A2, 0x74A3, 0x74A4, 0x74A5, 0x74A6,
+    0x74A7, 0x74A8, 0x74A9, 0x74AA, 0x74AB, 0x74AC, 0x74AD, 0x74AE, 0x74AF, 0x74B0, 0x74B1, 0x74B2, 0x74B3, 0x74B4, 0x74B5, 0x74B6,
+    0x74B7, 0x74B8, 0x74B9, 0x74BA, 0x74BB, 0x74BC, 0x74BD, 0x74BE, 0x74BF, 0x74C0, 0x74C1, 0x74C2, 0x74C3, 0x74C4, 0x74C5, 0x74C6,
+    0x74C7, 0x74C8, 0x74C9, 0x74CA, 0x74CB, 0x74CC, 0x74CD, 0x74CE, 0x74CF, 0x74D0, 0x74D1, 0x74D2, 0x74D3, 0x74D4, 0x74D5, 0x74D6,
+    0x74D7, 0x74D8, 0x74D9, 0x74DA, 0x74DB, 0x74DC, 0x74DD, 0x74DE, 0x74DF, 0x74E0, 0x74E1, 0x74E2, 0x74E3, 0x74E4, 0x74E5, 0x74E6,
+    0x74E7, 0x74E8, 0x74E9, 0x74EA, 0x74EB, 0x74EC, 0x74ED, 0x74EE, 0x74EF, 0x74F0, 0x74F1, 0x74F2, 0x74F3, 0x74F4, 0x74F5, 0x74F6,
+    0x74F7, 0x74F8, 0x74F9, 0x74FA, 0x74FB, 0x74FC, 0x74FD, 0x74FE, 0x7541, 0x7542, 0x7543, 0x7544, 0x7545, 0x7546, 0x7547, 0x7548,
+    0x7549, 0x754A, 0x754B, 0x754C, 0x754D, 0x754E, 0x754F, 0x7550, 0x7551, 0x7552, 0x7553, 0x7554, 0x7555, 0x7556, 0x7557, 0x7558,
+  },
+  { /* U+E9xx */
+    0x7559, 0x755A, 0x755B, 0x755C, 0x755D, 0x755E, 0x755F, 0x7560, 0x7561, 0x7562, 0x7563, 0x7564, 0x7565, 0x7566, 0x7567, 0x7568,
+    0x7569, 0x756A, 0x756B, 0x756C, 0x756D, 0x756E, 0x756F, 0x7570, 0x7571, 0x7572, 0x7573, 0x7574, 0x7575, 0x7576, 0x7577, 0x7578,
+    0x7579, 0x757A, 0x757B, 0x757C, 0x757D, 0x757E, 0x757F, 0x7580, 0x7581, 0x7582, 0x7583, 0x7584, 0x7585, 0x7586, 0x7587, 0x7588,
+    0x7589, 0x758A, 0x758B, 0x758C, 0x758D, 0x758E, 0x758F, 0x7590, 0x7591, 0x7592, 0x7593, 0x7594, 0x7595, 0x7596, 0x7597, 0x7598,
+    0x7599, 0x759A, 0x759B, 0x759C, 0x759D, 0x759E, 0x759F, 0x75A0, 0x75A1, 0x75A2, 0x75A3, 0x75A4, 0x75A5, 0x75A6, 0x75A7, 0x75A8,
+    0x75A9, 0x75AA, 0x75AB, 0x75AC, 0x75AD, 0x75AE, 0x75AF, 0x75B0, 0x75B1, 0x75B2, 0x75B3, 0x75B4, 0x75B5, 0x75B6, 0x75B7, 0x75B8,
+    0x75B9, 0x75BA, 0x75BB, 0x75BC, 0x75BD, 0x75BE, 0x75BF, 0x75C0, 0x75C1, 0x75C2, 0x75C3, 0x75C4, 0x75C5, 0x75C6, 0x75C7, 0x75C8,
+    0x75C9, 0x75CA, 0x75CB, 0x75CC, 0x75CD, 0x75CE, 0x75CF, 0x75D0, 0x75D1, 0x75D2, 0x75D3, 0x75D4, 0x75D5, 0x75D6, 0x75D7, 0x75D8,
+    0x75D9, 0x75DA, 0x75DB, 0x75DC, 0x75DD, 0x75DE, 0x75DF, 0x75E0, 0x75E1, 0x75E2, 0x75E3, 0x75E4, 0x75E5, 0x75E6, 0x75E7, 0x75E8,
+    0x75E9, 0x75EA, 0x75EB, 0x75EC, 0x75ED, 0x75EE, 0x75EF, 0x75F0, 0x75F1, 0x75F2, 0x75F3, 0x75F4, 0x75F5, 0x75F6, 0x75F7, 0x75F8,
+    0x75F9, 0x75FA, 0x75FB, 0x75FC, 0x75FD, 0x75FE, 0x7641, 0x7642, 0x7643, 0x7644, 0x7645, 0x7646, 0x7647, 0x7648, 0x7649, 0x764A,
+    0x764B, 0x764C, 0x764D, 0x764E, 0x764F, 0x7650, 0x7651, 0x7652, 0x7653, 0x7654, 0x7655, 0x7656, 0x7657, 0x7658, 0x7659, 0x765A,
+    0x765B, 0x765C, 0x765D, 0x765E, 0x765F, 0x7660, 0x7661, 0x7662, 0x7663, 0x7664, 0x7665, 0x7666, 0x7667, 0x7668, 0x7669, 0x766A,
+    0x766B, 0x766C, 0x766D, 0x766E, 0x766F, 0x7670, 0x7671, 0x7672, 0x7673, 0x7674, 0x7675, 0x7676, 0x7677, 0x7678, 0x7679, 0x767A,
+    0x767B, 0x767C, 0x767D, 0x767E, 0x767F, 0x7680, 0x7681, 0x7682, 0x7683, 0x7684, 0x7685, 0x7686, 0x7687, 0x7688, 0x7689, 0x768A,
+    0x768B, 0x768C, 0x768D, 0x768E, 0x768F, 0x7690, 0x7691, 0x7692, 0x7693, 0x7694, 0x7695, 0x7696, 0x7697, 0x7698, 0x7699, 0x769A,
+  },
+  { /* U+EAxx */
+    0x769B, 0x769C, 0x769D, 0x769E, 0x769F, 0x76A0, 0x76A1, 0x76A2, 0x76A3, 0x76A4, 0x76A5, 0x76A6, 0x76A7, 0x76A8, 0x76A9, 0x76AA,
+    0x76AB, 0x76AC, 0x76AD, 0x76AE, 0x76AF, 0x76B0, 0x76B1, 0x76B2, 0x76B3, 0x76B4, 0x76B5, 0x76B6, 0x76B7, 0x76B8, 0x76B9, 0x76BA,
+    0x76BB, 0x76BC, 0x76BD, 0x76BE, 0x76BF, 0x76C0, 0x76C1, 0x76C2, 0x76C3, 0x76C4, 0x76C5, 0x76C6, 0x76C7, 0x76C8, 0x76C9, 0x76CA,
+    0x76CB, 0x76CC, 0x76CD, 0x76CE, 0x76CF, 0x76D0, 0x76D1, 0x76D2, 0x76D3, 0x76D4, 0x76D5, 0x76D6, 0x76D7, 0x76D8, 0x76D9, 0x76DA,
+    0x76DB, 0x76DC, 0x76DD, 0x76DE, 0x76DF, 0x76E0, 0x76E1, 0x76E2, 0x76E3, 0x76E4, 0x76E5, 0x76E6, 0x76E7, 0x76E8, 0x76E9, 0x76EA,
+    0x76EB, 0x76EC, 0x76ED, 0x76EE, 0x76EF, 0x76F0, 0x76F1, 0x76F2, 0x76F3, 0x76F4, 0x76F5, 0x76F6, 0x76F7, 0x76F8, 0x76F9, 0x76FA,
+    0x76FB, 0x76FC, 0x76FD, 0x76FE, 0x7741, 0x7742, 0x7743, 0x7744, 0x7745, 0x7746, 0x7747, 0x7748, 0x7749, 0x774A, 0x774B, 0x774C,
+    0x774D, 0x774E, 0x774F, 0x7750, 0x7751, 0x7752, 0x7753, 0x7754, 0x7755, 0x7756, 0x7757, 0x7758, 0x7759, 0x775A, 0x775B, 0x775C,
+    0x775D, 0x775E, 0x775F, 0x7760, 0x7761, 0x7762, 0x7763, 0x7764, 0x7765, 0x7766, 0x7767, 0x7768, 0x7769, 0x776A, 0x776B, 0x776C,
+    0x776D, 0x776E, 0x776F, 0x7770, 0x7771, 0x7772, 0x7773, 0x7774, 0x7775, 0x7776, 0x7777, 0x7778, 0x7779, 0x777A, 0x777B, 0x777C,
+    0x777D, 0x777E, 0x777F, 0x7780, 0x7781, 0x7782, 0x7783, 0x7784, 0x7785, 0x7786, 0x7787, 0x7788, 0x7789, 0x778A, 0x778B, 0x778C,
+    0x778D, 0x778E, 0x778F, 0x7790, 0x7791, 0x7792, 0x7793, 0x7794, 0x7795, 0x7796, 0x7797, 0x7798, 0x7799, 0x779A, 0x779B, 0x779C,
+    0x779D, 0x779E, 0x779F, 0x77A0, 0x77A1, 0x77A2, 0x77A3, 0x77A4, 0x77A5, 0x77A6, 0x77A7, 0x77A8, 0x77A9, 0x77AA, 0x77AB, 0x77AC,
+    0x77AD, 0x77AE, 0x77AF, 0x77B0, 0x77B1, 0x77B2, 0x77B3, 0x77B4, 0x77B5, 0x77B6, 0x77B7, 0x77B8, 0x77B9, 0x77BA, 0x77BB, 0x77BC,
+    0x77BD, 0x77BE, 0x77BF, 0x77C0, 0x77C1, 0x77C2, 0x77C3, 0x77C4, 0x77C5, 0x77C6, 0x77C7, 0x77C8, 0x77C9, 0x77CA, 0x77CB, 0x77CC,
+    0x77CD, 0x77CE, 0x77CF, 0x77D0, 0x77D1, 0x77D2, 0x77D3, 0x77D4, 0x77D5, 0x77D6, 0x77D7, 0x77D8, 0x77D9, 0x77DA, 0x77DB, 0x77DC,
+  },
+  { /* U+EBxx */
+    0x77DD, 0x77DE, 0x77DF, 0x77E0, 0x77E1, 0x77E2, 0x77E3, 0x77E4, 0x77E5, 0x77E6, 0x77E7, 0x77E8, 0x77E9, 0x77EA, 0x77EB, 0x77EC,
+    0x77ED, 0x77EE, 0x77EF, 0x77F0, 0x77F1, 0x77F2, 0x77F3, 0x77F4, 0x77F5, 0x77F6, 0x77F7, 0x77F8, 0x77F9, 0x77FA, 0x77FB, 0x77FC,
+    0x77FD, 0x77FE, 0x7841, 0x7842, 0x7843, 0x7844, 0x7845, 0x7846, 0x7847, 0x7848, 0x7849, 0x784A, 0x784B, 0x784C, 0x784D, 0x784E,
+    0x784F, 0x7850, 0x7851, 0x7852, 0x7853, 0x7854, 0x7855, 0x7856, 0x7857, 0x7858, 0x7859, 0x785A, 0x785B, 0x785C, 0x785D, 0x785E,
+    0x785F, 0x7860, 0x7861, 0x7862, 0x7863, 0x7864, 0x7865, 0x7866, 0x7867, 0x7868, 0x7869, 0x786A, 0x786B, 0x786C, 0x786D, 0x786E,
+    0x786F, 0x7870, 0x7871, 0x7872, 0x7873, 0x7874, 0x7875, 0x7876, 0x7877, 0x7878, 0x7879, 0x787A, 0x787B, 0x787C, 0x787D, 0x787E,
+    0x787F, 0x7880, 0x7881, 0x7882, 0x7883, 0x7884, 0x7885, 0x7886, 0x7887, 0x7888, 0x7889, 0x788A, 0x788B, 0x788C, 0x788D, 0x788E,
+    0x788F, 0x7890, 0x7891, 0x7892, 0x7893, 0x7894, 0x7895, 0x7896, 0x7897, 0x7898, 0x7899, 0x789A, 0x789B, 0x789C, 0x789D, 0x789E,
+    0x789F, 0x78A0, 0x78A1, 0x78A2, 0x78A3, 0x78A4, 0x78A5, 0x78A6, 0x78A7, 0x78A8, 0x78A9, 0x78AA, 0x78AB, 0x78AC, 0x78AD, 0x78AE,
+    0x78AF, 0x78B0, 0x78B1, 0x78B2, 0x78B3, 0x78B4, 0x78B5, 0x78B6, 0x78B7, 0x78B8, 0x78B9, 0x78BA, 0x78BB, 0x78BC, 0x78BD, 0x78BE,
+    0x78BF, 0x78C0, 0x78C1, 0x78C2, 0x78C3, 0x78C4, 0x78C5, 0x78C6, 0x78C7, 0x78C8, 0x78C9, 0x78CA, 0x78CB, 0x78CC, 0x78CD, 0x78CE,
+    0x78CF, 0x78D0, 0x78D1, 0x78D2, 0x78D3, 0x78D4, 0x78D5, 0x78D6, 0x78D7, 0x78D8, 0x78D9, 0x78DA, 0x78DB, 0x78DC, 0x78DD, 0x78DE,
+    0x78DF, 0x78E0, 0x78E1, 0x78E2, 0x78E3, 0x78E4, 0x78E5, 0x78E6, 0x78E7, 0x78E8, 0x78E9, 0x78EA, 0x78EB, 0x78EC, 0x78ED, 0x78EE,
+    0x78EF, 0x78F0, 0x78F1, 0x78F2, 0x78F3, 0x78F4, 0x78F5, 0x78F6, 0x78F7, 0x78F8, 0x78F9, 0x78FA, 0x78FB, 0x78FC, 0x78FD, 0x78FE,
+    0x7941, 0x7942, 0x7943, 0x7944, 0x7945, 0x7946, 0x7947, 0x7948, 0x7949, 0x794A, 0x794B, 0x794C, 0x794D, 0x794E, 0x794F, 0x7950,
+    0x7951, 0x7952, 0x7953, 0x7954, 0x7955, 0x7956, 0x7957, 0x7958, 0x7959, 0x795A, 0x795B, 0x795C, 0x795D, 0x795E, 0x795F, 0x7960,
+  },
+  { /* U+ECxx */
+    0x7961, 0x7962, 0x7963, 0x7964, 0x7965, 0x7966, 0x7967, 0x7968, 0x7969, 0x796A, 0x796B, 0x796C, 0x796D, 0x796E, 0x796F, 0x7970,
+    0x7971, 0x7972, 0x7973, 0x7974, 0x7975, 0x7976, 0x7977, 0x7978, 0x7979, 0x797A, 0x797B, 0x797C, 0x797D, 0x797E, 0x797F, 0x7980,
+    0x7981, 0x7982, 0x7983, 0x7984, 0x7985, 0x7986, 0x7987, 0x7988, 0x7989, 0x798A, 0x798B, 0x798C, 0x798D, 0x798E, 0x798F, 0x7990,
+    0x7991, 0x7992, 0x7993, 0x7994, 0x7995, 0x7996, 0x7997, 0x7998, 0x7999, 0x799A, 0x799B, 0x799C, 0x799D, 0x799E, 0x799F, 0x79A0,
+    0x79A1, 0x79A2, 0x79A3, 0x79A4, 0x79A5, 0x79A6, 0x79A7, 0x79A8, 0x79A9, 0x79AA, 0x79AB, 0x79AC, 0x79AD, 0x79AE, 0x79AF, 0x79B0,
+    0x79B1, 0x79B2, 0x79B3, 0x79B4, 0x79B5, 0x79B6, 0x79B7, 0x79B8, 0x79B9, 0x79BA, 0x79BB, 0x79BC, 0x79BD, 0x79BE, 0x79BF, 0x79C0,
+    0x79C1, 0x79C2, 0x79C3, 0x79C4, 0x79C5, 0x79C6, 0x79C7, 0x79C8, 0x79C9, 0x79CA, 0x79CB, 0x79CC, 0x79CD, 0x79CE, 0x79CF, 0x79D0,
+    0x79D1, 0x79D2, 0x79D3, 0x79D4, 0x79D5, 0x79D6, 0x79D7, 0x79D8, 0x79D9, 0x79DA, 0x79DB, 0x79DC, 0x79DD, 0x79DE, 0x79DF, 0x79E0,
+    0x79E1, 0x79E2, 0x79E3, 0x79E4, 0x79E5, 0x79E6, 0x79E7, 0x79E8, 0x79E9, 0x79EA, 0x79EB, 0x79EC, 0x79ED, 0x79EE, 0x79EF, 0x79F0,
+    0x79F1, 0x79F2, 0x79F3, 0x79F4, 0x79F5, 0x79F6, 0x79F7, 0x79F8, 0x79F9, 0x79FA, 0x79FB, 0x79FC, 0x79FD, 0x79FE, 0x7A41, 0x7A42,
+    0x7A43, 0x7A44, 0x7A45, 0x7A46, 0x7A47, 0x7A48, 0x7A49, 0x7A4A, 0x7A4B, 0x7A4C, 0x7A4D, 0x7A4E, 0x7A4F, 0x7A50, 0x7A51, 0x7A52,
+    0x7A53, 0x7A54, 0x7A55, 0x7A56, 0x7A57, 0x7A58, 0x7A59, 0x7A5A, 0x7A5B, 0x7A5C, 0x7A5D, 0x7A5E, 0x7A5F, 0x7A60, 0x7A61, 0x7A62,
+    0x7A63, 0x7A64, 0x7A65, 0x7A66, 0x7A67, 0x7A68, 0x7A69, 0x7A6A, 0x7A6B, 0x7A6C, 0x7A6D, 0x7A6E, 0x7A6F, 0x7A70, 0x7A71, 0x7A72,
+    0x7A73, 0x7A74, 0x7A75, 0x7A76, 0x7A77, 0x7A78, 0x7A79, 0x7A7A, 0x7A7B, 0x7A7C, 0x7A7D, 0x7A7E, 0x7A7F, 0x7A80, 0x7A81, 0x7A82,
+    0x7A83, 0x7A84, 0x7A85, 0x7A86, 0x7A87, 0x7A88, 0x7A89, 0x7A8A, 0x7A8B, 0x7A8C, 0x7A8D, 0x7A8E, 0x7A8F, 0x7A90, 0x7A91, 0x7A92,
+    0x7A93, 0x7A94, 0x7A95, 0x7A96, 0x7A97, 0x7A98, 0x7A99, 0x7A9A, 0x7A9B, 0x7A9C, 0x7A9D, 0x7A9E, 0x7A9F, 0x7AA0, 0x7AA1, 0x7AA2,
+  },
+  { /* U+EDxx */
+    0x7AA3, 0x7AA4, 0x7AA5, 0x7AA6, 0x7AA7, 0x7AA8, 0x7AA9, 0x7AAA, 0x7AAB, 0x7AAC, 0x7AAD, 0x7AAE, 0x7AAF, 0x7AB0, 0x7AB1, 0x7AB2,
+    0x7AB3, 0x7AB4, 0x7AB5, 0x7AB6, 0x7AB7, 0x7AB8, 0x7AB9, 0x7ABA, 0x7ABB, 0x7ABC, 0x7ABD, 0x7ABE, 0x7ABF, 0x7AC0, 0x7AC1, 0x7AC2,
+    0x7AC3, 0x7AC4, 0x7AC5, 0x7AC6, 0x7AC7, 0x7AC8, 0x7AC9, 0x7ACA, 0x7ACB, 0x7ACC, 0x7ACD, 0x7ACE, 0x7ACF, 0x7AD0, 0x7AD1, 0x7AD2,
+    0x7AD3, 0x7AD4, 0x7AD5, 0x7AD6, 0x7AD7, 0x7AD8, 0x7AD9, 0x7ADA, 0x7ADB, 0x7ADC, 0x7ADD, 0x7ADE, 0x7ADF, 0x7AE0, 0x7AE1, 0x7AE2,
+    0x7AE3, 0x7AE4, 0x7AE5, 0x7AE6, 0x7AE7, 0x7AE8, 0x7AE9, 0x7AEA, 0x7AEB, 0x7AEC, 0x7AED, 0x7AEE, 0x7AEF, 0x7AF0, 0x7AF1, 0x7AF2,
+    0x7AF3, 0x7AF4, 0x7AF5, 0x7AF6, 0x7AF7, 0x7AF8, 0x7AF9, 0x7AFA, 0x7AFB, 0x7AFC, 0x7AFD, 0x7AFE, 0x7B41, 0x7B42, 0x7B43, 0x7B44,
+    0x7B45, 0x7B46, 0x7B47, 0x7B48, 0x7B49, 0x7B4A, 0x7B4B, 0x7B4C, 0x7B4D, 0x7B4E, 0x7B4F, 0x7B50, 0x7B51, 0x7B52, 0x7B53, 0x7B54,
+    0x7B55, 0x7B56, 0x7B57, 0x7B58, 0x7B59, 0x7B5A, 0x7B5B, 0x7B5C, 0x7B5D, 0x7B5E, 0x7B5F, 0x7B60, 0x7B61, 0x7B62, 0x7B63, 0x7B64,
+    0x7B65, 0x7B66, 0x7B67, 0x7B68, 0x7B69, 0x7B6A, 0x7B6B, 0x7B6C, 0x7B6D, 0x7B6E, 0x7B6F, 0x7B70, 0x7B71, 0x7B72, 0x7B73, 0x7B74,
+    0x7B75, 0x7B76, 0x7B77, 0x7B78, 0x7B79, 0x7B7A, 0x7B7B, 0x7B7C, 0x7B7D, 0x7B7E, 0x7B7F, 0x7B80, 0x7B81, 0x7B82, 0x7B83, 0x7B84,
+    0x7B85, 0x7B86, 0x7B87, 0x7B88, 0x7B89, 0x7B8A, 0x7B8B, 0x7B8C, 0x7B8D, 0x7B8E, 0x7B8F, 0x7B90, 0x7B91, 0x7B92, 0x7B93, 0x7B94,
+    0x7B95, 0x7B96, 0x7B97, 0x7B98, 0x7B99, 0x7B9A, 0x7B9B, 0x7B9C, 0x7B9D, 0x7B9E, 0x7B9F, 0x7BA0, 0x7BA1, 0x7BA2, 0x7BA3, 0x7BA4,
+    0x7BA5, 0x7BA6, 0x7BA7, 0x7BA8, 0x7BA9, 0x7BAA, 0x7BAB, 0x7BAC, 0x7BAD, 0x7BAE, 0x7BAF, 0x7BB0, 0x7BB1, 0x7BB2, 0x7BB3, 0x7BB4,
+    0x7BB5, 0x7BB6, 0x7BB7, 0x7BB8, 0x7BB9, 0x7BBA, 0x7BBB, 0x7BBC, 0x7BBD, 0x7BBE, 0x7BBF, 0x7BC0, 0x7BC1, 0x7BC2, 0x7BC3, 0x7BC4,
+    0x7BC5, 0x7BC6, 0x7BC7, 0x7BC8, 0x7BC9, 0x7BCA, 0x7BCB, 0x7BCC, 0x7BCD, 0x7BCE, 0x7BCF, 0x7BD0, 0x7BD1, 0x7BD2, 0x7BD3, 0x7BD4,
+    0x7BD5, 0x7BD6, 0x7BD7, 0x7BD8, 0x7BD9, 0x7BDA, 0x7BDB, 0x7BDC, 0x7BDD, 0x7BDE, 0x7BDF, 0x7BE0, 0x7BE1, 0x7BE2, 0x7BE3, 0x7BE4,
+  },
+  { /* U+EExx */
+    0x7BE5, 0x7BE6, 0x7BE7, 0x7BE8, 0x7BE9, 0x7BEA, 0x7BEB, 0x7BEC, 0x7BED, 0x7BEE, 0x7BEF, 0x7BF0, 0x7BF1, 0x7BF2, 0x7BF3, 0x7BF4,
+    0x7BF5, 0x7BF6, 0x7BF7, 0x7BF8, 0x7BF9, 0x7BFA, 0x7BFB, 0x7BFC, 0x7BFD, 0x7BFE, 0x7C41, 0x7C42, 0x7C43, 0x7C44, 0x7C45, 0x7C46,
+    0x7C47, 0x7C48, 0x7C49, 0x7C4A, 0x7C4B, 0x7C4C, 0x7C4D, 0x7C4E, 0x7C4F, 0x7C50, 0x7C51, 0x7C52, 0x7C53, 0x7C54, 0x7C55, 0x7C56,
+    0x7C57, 0x7C58, 0x7C59, 0x7C5A, 0x7C5B, 0x7C5C, 0x7C5D, 0x7C5E, 0x7C5F, 0x7C60, 0x7C61, 0x7C62, 0x7C63, 0x7C64, 0x7C65, 0x7C66,
+    0x7C67, 0x7C68, 0x7C69, 0x7C6A, 0x7C6B, 0x7C6C, 0x7C6D, 0x7C6E, 0x7C6F, 0x7C70, 0x7C71, 0x7C72, 0x7C73, 0x7C74, 0x7C75, 0x7C76,
+    0x7C77, 0x7C78, 0x7C79, 0x7C7A, 0x7C7B, 0x7C7C, 0x7C7D, 0x7C7E, 0x7C7F, 0x7C80, 0x7C81, 0x7C82, 0x7C83, 0x7C84, 0x7C85, 0x7C86,
+    0x7C87, 0x7C88, 0x7C89, 0x7C8A, 0x7C8B, 0x7C8C, 0x7C8D, 0x7C8E, 0x7C8F, 0x7C90, 0x7C91, 0x7C92, 0x7C93, 0x7C94, 0x7C95, 0x7C96,
+    0x7C97, 0x7C98, 0x7C99, 0x7C9A, 0x7C9B, 0x7C9C, 0x7C9D, 0x7C9E, 0x7C9F, 0x7CA0, 0x7CA1, 0x7CA2, 0x7CA3, 0x7CA4, 0x7CA5, 0x7CA6,
+    0x7CA7, 0x7CA8, 0x7CA9, 0x7CAA, 0x7CAB, 0x7CAC, 0x7CAD, 0x7CAE, 0x7CAF, 0x7CB0, 0x7CB1, 0x7CB2, 0x7CB3, 0x7CB4, 0x7CB5, 0x7CB6,
+    0x7CB7, 0x7CB8, 0x7CB9, 0x7CBA, 0x7CBB, 0x7CBC, 0x7CBD, 0x7CBE, 0x7CBF, 0x7CC0, 0x7CC1, 0x7CC2, 0x7CC3, 0x7CC4, 0x7CC5, 0x7CC6,
+    0x7CC7, 0x7CC8, 0x7CC9, 0x7CCA, 0x7CCB, 0x7CCC, 0x7CCD, 0x7CCE, 0x7CCF, 0x7CD0, 0x7CD1, 0x7CD2, 0x7CD3, 0x7CD4, 0x7CD5, 0x7CD6,
+    0x7CD7, 0x7CD8, 0x7CD9, 0x7CDA, 0x7CDB, 0x7CDC, 0x7CDD, 0x7CDE, 0x7CDF, 0x7CE0, 0x7CE1, 0x7CE2, 0x7CE3, 0x7CE4, 0x7CE5, 0x7CE6,
+    0x7CE7, 0x7CE8, 0x7CE9, 0x7CEA, 0x7CEB, 0x7CEC, 0x7CED, 0x7CEE, 0x7CEF, 0x7CF0, 0x7CF1, 0x7CF2, 0x7CF3, 0x7CF4, 0x7CF5, 0x7CF6,
+    0x7CF7, 0x7CF8, 0x7CF9, 0x7CFA, 0x7CFB, 0x7CFC, 0x7CFD, 0x7CFE, 0x7D41, 0x7D42, 0x7D43, 0x7D44, 0x7D45, 0x7D46, 0x7D47, 0x7D48,
+    0x7D49, 0x7D4A, 0x7D4B, 0x7D4C, 0x7D4D, 0x7D4E, 0x7D4F, 0x7D50, 0x7D51, 0x7D52, 0x7D53, 0x7D54, 0x7D55, 0x7D56, 0x7D57, 0x7D58,
+    0x7D59, 0x7D5A, 0x7D5B, 0x7D5C, 0x7D5D, 0x7D5E, 0x7D5F, 0x7D60, 0x7D61, 0x7D62, 0x7D63, 0x7D64, 0x7D65, 0x7D66, 0x7D67, 0x7D68,
+  },
+  { /* U+EFxx */
+    0x7D69, 0x7D6A, 0x7D6B, 0x7D6C, 0x7D6D, 0x7D6E, 0x7D6F, 0x7D70, 0x7D71, 0x7D72, 0x7D73, 0x7D74, 0x7D75, 0x7D76, 0x7D77, 0x7D78,
+    0x7D79, 0x7D7A, 0x7D7B, 0x7D7C, 0x7D7D, 0x7D7E, 0x7D7F, 0x7D80, 0x7D81, 0x7D82, 0x7D83, 0x7D84, 0x7D85, 0x7D86, 0x7D87, 0x7D88,
+    0x7D89, 0x7D8A, 0x7D8B, 0x7D8C, 0x7D8D, 0x7D8E, 0x7D8F, 0x7D90, 0x7D91, 0x7D92, 0x7D93, 0x7D94, 0x7D95, 0x7D96, 0x7D97, 0x7D98,
+    0x7D99, 0x7D9A, 0x7D9B, 0x7D9C, 0x7D9D, 0x7D9E, 0x7D9F, 0x7DA0, 0x7DA1, 0x7DA2, 0x7DA3, 0x7DA4, 0x7DA5, 0x7DA6, 0x7DA7, 0x7DA8,
+    0x7DA9, 0x7DAA, 0x7DAB, 0x7DAC, 0x7DAD, 0x7DAE, 0x7DAF, 0x7DB0, 0x7DB1, 0x7DB2, 0x7DB3, 0x7DB4, 0x7DB5, 0x7DB6, 0x7DB7, 0x7DB8,
+    0x7DB9, 0x7DBA, 0x7DBB, 0x7DBC, 0x7DBD, 0x7DBE, 0x7DBF, 0x7DC0, 0x7DC1, 0x7DC2, 0x7DC3, 0x7DC4, 0x7DC5, 0x7DC6, 0x7DC7, 0x7DC8,
+    0x7DC9, 0x7DCA, 0x7DCB, 0x7DCC, 0x7DCD, 0x7DCE, 0x7DCF, 0x7DD0, 0x7DD1, 0x7DD2, 0x7DD3, 0x7DD4, 0x7DD5, 0x7DD6, 0x7DD7, 0x7DD8,
+    0x7DD9, 0x7DDA, 0x7DDB, 0x7DDC, 0x7DDD, 0x7DDE, 0x7DDF, 0x7DE0, 0x7DE1, 0x7DE2, 0x7DE3, 0x7DE4, 0x7DE5, 0x7DE6, 0x7DE7, 0x7DE8,
+    0x7DE9, 0x7DEA, 0x7DEB, 0x7DEC, 0x7DED, 0x7DEE, 0x7DEF, 0x7DF0, 0x7DF1, 0x7DF2, 0x7DF3, 0x7DF4, 0x7DF5, 0x7DF6, 0x7DF7, 0x7DF8,
+    0x7DF9, 0x7DFA, 0x7DFB, 0x7DFC, 0x7DFD, 0x7DFE, 0x7E41, 0x7E42, 0x7E43, 0x7E44, 0x7E45, 0x7E46, 0x7E47, 0x7E48, 0x7E49, 0x7E4A,
+    0x7E4B, 0x7E4C, 0x7E4D, 0x7E4E, 0x7E4F, 0x7E50, 0x7E51, 0x7E52, 0x7E53, 0x7E54, 0x7E55, 0x7E56, 0x7E57, 0x7E58, 0x7E59, 0x7E5A,
+    0x7E5B, 0x7E5C, 0x7E5D, 0x7E5E, 0x7E5F, 0x7E60, 0x7E61, 0x7E62, 0x7E63, 0x7E64, 0x7E65, 0x7E66, 0x7E67, 0x7E68, 0x7E69, 0x7E6A,
+    0x7E6B, 0x7E6C, 0x7E6D, 0x7E6E, 0x7E6F, 0x7E70, 0x7E71, 0x7E72, 0x7E73, 0x7E74, 0x7E75, 0x7E76, 0x7E77, 0x7E78, 0x7E79, 0x7E7A,
+    0x7E7B, 0x7E7C, 0x7E7D, 0x7E7E, 0x7E7F, 0x7E80, 0x7E81, 0x7E82, 0x7E83, 0x7E84, 0x7E85, 0x7E86, 0x7E87, 0x7E88, 0x7E89, 0x7E8A,
+    0x7E8B, 0x7E8C, 0x7E8D, 0x7E8E, 0x7E8F, 0x7E90, 0x7E91, 0x7E92, 0x7E93, 0x7E94, 0x7E95, 0x7E96, 0x7E97, 0x7E98, 0x7E99, 0x7E9A,
+    0x7E9B, 0x7E9C, 0x7E9D, 0x7E9E, 0x7E9F, 0x7EA0, 0x7EA1, 0x7EA2, 0x7EA3, 0x7EA4, 0x7EA5, 0x7EA6, 0x7EA7, 0x7EA8, 0x7EA9, 0x7EAA,
+  },
+  { /* U+F0xx */
+    0x7EAB, 0x7EAC, 0x7EAD, 0x7EAE, 0x7EAF, 0x7EB0, 0x7EB1, 0x7EB2, 0x7EB3, 0x7EB4, 0x7EB5, 0x7EB6, 0x7EB7, 0x7EB8, 0x7EB9, 0x7EBA,
+    0x7EBB, 0x7EBC, 0x7EBD, 0x7EBE, 0x7EBF, 0x7EC0, 0x7EC1, 0x7EC2, 0x7EC3, 0x7EC4, 0x7EC5, 0x7EC6, 0x7EC7, 0x7EC8, 0x7EC9, 0x7ECA,
+    0x7ECB, 0x7ECC, 0x7ECD, 0x7ECE, 0x7ECF, 0x7ED0, 0x7ED1, 0x7ED2, 0x7ED3, 0x7ED4, 0x7ED5, 0x7ED6, 0x7ED7, 0x7ED8, 0x7ED9, 0x7EDA,
+    0x7EDB, 0x7EDC, 0x7EDD, 0x7EDE, 0x7EDF, 0x7EE0, 0x7EE1, 0x7EE2, 0x7EE3, 0x7EE4, 0x7EE5, 0x7EE6, 0x7EE7, 0x7EE8, 0x7EE9, 0x7EEA,
+    0x7EEB, 0x7EEC, 0x7EED, 0x7EEE, 0x7EEF, 0x7EF0, 0x7EF1, 0x7EF2, 0x7EF3, 0x7EF4, 0x7EF5, 0x7EF6, 0x7EF7, 0x7EF8, 0x7EF9, 0x7EFA,
+    0x7EFB, 0x7EFC, 0x7EFD, 0x7EFE, 0x7F41, 0x7F42, 0x7F43, 0x7F44, 0x7F45, 0x7F46, 0x7F47, 0x7F48, 0x7F49, 0x7F4A, 0x7F4B, 0x7F4C,
+    0x7F4D, 0x7F4E, 0x7F4F, 0x7F50, 0x7F51, 0x7F52, 0x7F53, 0x7F54, 0x7F55, 0x7F56, 0x7F57, 0x7F58, 0x7F59, 0x7F5A, 0x7F5B, 0x7F5C,
+    0x7F5D, 0x7F5E, 0x7F5F, 0x7F60, 0x7F61, 0x7F62, 0x7F63, 0x7F64, 0x7F65, 0x7F66, 0x7F67, 0x7F68, 0x7F69, 0x7F6A, 0x7F6B, 0x7F6C,
+    0x7F6D, 0x7F6E, 0x7F6F, 0x7F70, 0x7F71, 0x7F72, 0x7F73, 0x7F74, 0x7F75, 0x7F76, 0x7F77, 0x7F78, 0x7F79, 0x7F7A, 0x7F7B, 0x7F7C,
+    0x7F7D, 0x7F7E, 0x7F7F, 0x7F80, 0x7F81, 0x7F82, 0x7F83, 0x7F84, 0x7F85, 0x7F86, 0x7F87, 0x7F88, 0x7F89, 0x7F8A, 0x7F8B, 0x7F8C,
+    0x7F8D, 0x7F8E, 0x7F8F, 0x7F90, 0x7F91, 0x7F92, 0x7F93, 0x7F94, 0x7F95, 0x7F96, 0x7F97, 0x7F98, 0x7F99, 0x7F9A, 0x7F9B, 0x7F9C,
+    0x7F9D, 0x7F9E, 0x7F9F, 0x7FA0, 0x7FA1, 0x7FA2, 0x7FA3, 0x7FA4, 0x7FA5, 0x7FA6, 0x7FA7, 0x7FA8, 0x7FA9, 0x7FAA, 0x7FAB, 0x7FAC,
+    0x7FAD, 0x7FAE, 0x7FAF, 0x7FB0, 0x7FB1, 0x7FB2, 0x7FB3, 0x7FB4, 0x7FB5, 0x7FB6, 0x7FB7, 0x7FB8, 0x7FB9, 0x7FBA, 0x7FBB, 0x7FBC,
+    0x7FBD, 0x7FBE, 0x7FBF, 0x7FC0, 0x7FC1, 0x7FC2, 0x7FC3, 0x7FC4, 0x7FC5, 0x7FC6, 0x7FC7, 0x7FC8, 0x7FC9, 0x7FCA, 0x7FCB, 0x7FCC,
+    0x7FCD, 0x7FCE, 0x7FCF, 0x7FD0, 0x7FD1, 0x7FD2, 0x7FD3, 0x7FD4, 0x7FD5, 0x7FD6, 0x7FD7, 0x7FD8, 0x7FD9, 0x7FDA, 0x7FDB, 0x7FDC,
+    0x7FDD, 0x7FDE, 0x7FDF, 0x7FE0, 0x7FE1, 0x7FE2, 0x7FE3, 0x7FE4, 0x7FE5, 0x7FE6, 0x7FE7, 0x7FE8, 0x7FE9, 0x7FEA, 0x7FEB, 0x7FEC,
+  },
+  { /* U+F1xx */
+    0x7FED, 0x7FEE, 0x7FEF, 0x7FF0, 0x7FF1, 0x7FF2, 0x7FF3, 0x7FF4, 0x7FF5, 0x7FF6, 0x7FF7, 0x7FF8, 0x7FF9, 0x7FFA, 0x7FFB, 0x7FFC,
+    0x7FFD, 0x7FFE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+F9xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x5BC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x6674, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+FAxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x578E, 0x5877,
+    0x5882, 0x5980, 0x5BAE, 0x5C66, 0x5C78, 0x5E49, 0x5E8A, 0x5F7A, 0x5FD2, 0x5FD5, 0x5FD9, 0x5FDD, 0x6059, 0x60AD, 0x6177, 0x62B9,
+    0x62CE, 0x62E2, 0x63EE, 0x648E, 0x64F1, 0x6549, 0x6566, 0x65B8, 0x65C6, 0x6678, 0x66DD, 0x66DF, 0x66E6, 0x67F4, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+FFxx */
+    0xFFFF, 0x425A, 0x427F, 0x427B, 0x42E0, 0x426C, 0x4250, 0x427D, 0x424D, 0x425D, 0x425C, 0x424E, 0x426B, 0xFFFF, 0x424B, 0x4261,
+    0x42F0, 0x42F1, 0x42F2, 0x42F3, 0x42F4, 0x42F5, 0x42F6, 0x42F7, 0x42F8, 0x42F9, 0x427A, 0x425E, 0x424C, 0x427E, 0x426E, 0x426F,
+    0x427C, 0x42C1, 0x42C2, 0x42C3, 0x42C4, 0x42C5, 0x42C6, 0x42C7, 0x42C8, 0x42C9, 0x42D1, 0x42D2, 0x42D3, 0x42D4, 0x42D5, 0x42D6,
+    0x42D7, 0x42D8, 0x42D9, 0x42E2, 0x42E3, 0x42E4, 0x42E5, 0x42E6, 0x42E7, 0x42E8, 0x42E9, 0x4444, 0x43E0, 0x4445, 0x4470, 0x426D,
+    0x4279, 0x4281, 0x4282, 0x4283, 0x4284, 0x4285, 0x4286, 0x4287, 0x4288, 0x4289, 0x4291, 0x4292, 0x4293, 0x4294, 0x4295, 0x4296,
+    0x4297, 0x4298, 0x4299, 0x42A2, 0x42A3, 0x42A4, 0x42A5, 0x42A6, 0x42A7, 0x42A8, 0x42A9, 0x42C0, 0x424F, 0x42D0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057,
+    0x0058, 0x0059, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075,
+    0x0076, 0x0077, 0x0078, 0x008A, 0x008B, 0x008C, 0x008D, 0x008E, 0x008F, 0x009A, 0x009B, 0x009C, 0x009D, 0x009E, 0x009F, 0x00AA,
+    0x00AB, 0x00AC, 0x00AE, 0x00AF, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BE, 0x00BF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x434A, 0x424A, 0x425F, 0x42A1, 0xFFFF, 0x425B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+};
+
+CP_TABLE_CONST cp_table_t IBM939_TABLE = {
+    IBM939_SB2U, IBM939_LEAD2ROW, IBM939_DB2U, IBM939_U2CP_PAGE, IBM939_U2CP
+};
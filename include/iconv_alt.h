@@ -0,0 +1,403 @@
+#ifndef ICONV_ALT_ICONV_ALT_H
+#define ICONV_ALT_ICONV_ALT_H
+
+#include "iconv.h"
+#include <stddef.h>
+
+/* struct iovec: POSIX は <sys/uio.h>、Windows には無いので同じ形で定義する
+   (既に定義済みの環境では ICONV_ALT_HAVE_IOVEC を定義しておくこと) */
+#if !defined(_WIN32)
+#  include <sys/uio.h>
+#elif !defined(ICONV_ALT_HAVE_IOVEC)
+#  define ICONV_ALT_HAVE_IOVEC
+struct iovec { void* iov_base; size_t iov_len; };
+#endif
+
+/* iconv-alt 拡張 API (POSIX iconv には無い独自機能) */
+#ifdef __cplusplus
+extern "C" {
+#endif
+
+    /*------------------------------------------------------------------
+     *  借用 or 変換 (iconv_alt_view)
+     *
+     *  入力が純 ASCII なら変換せず入力ポインタをそのまま返す (owned = 0)。
+     *  それ以外は malloc した領域に変換結果を返す (owned = 1)。
+     *  入力は完結した文字列として扱い、cd のストリーム状態は変更しない。
+     *----------------------------------------------------------------*/
+    typedef struct {
+        const char* data;     /* 結果 (入力そのもの or 新規確保)         */
+        size_t      len;      /* 結果バイト数 / 失敗時は停止した入力位置 */
+        int         owned;    /* 1: iconv_alt_result_free() で解放する   */
+    } iconv_alt_result;
+
+    int     iconv_alt_view(iconv_t cd, const char* in, size_t inlen,
+        iconv_alt_result* result);
+    void    iconv_alt_result_free(iconv_alt_result* result);
+
+    /*------------------------------------------------------------------
+     *  単発変換 / 出力サイズの計測
+     *
+     *  in を完結した文字列として out へ変換する。cd の持ち越し状態は
+     *  読みも書きもしないので、同じ cd を複数スレッドで共有してよい。
+     *  iconv_alt_measure() は出力を捨てて必要なバイト数だけを返す
+     *  (呼び出し側はちょうどの領域を確保してから変換できる)。
+     *  Return: 出力バイト数 / (size_t)-1 + errno (EILSEQ / EINVAL / E2BIG)
+     *          失敗時、stop (NULL 可) には停止した文字の入力オフセット。
+     *----------------------------------------------------------------*/
+    size_t  iconv_alt_convert(iconv_t cd, const char* in, size_t inlen,
+        char* out, size_t outlen, size_t* stop);
+    size_t  iconv_alt_measure(iconv_t cd, const char* in, size_t inlen,
+        size_t* stop);
+
+    /*------------------------------------------------------------------
+     *  チャンク連結 (rope) 出力
+     *
+     *  出力を固定長ブロックの連結リストに書き込む。ブロックはプールの
+     *  フリーリストから取り出し、chain の reset / destroy で戻す。
+     *  出力サイズ不明でも realloc + 全体コピーが発生せず、結果は
+     *  iconv_alt_chain_iov() で平坦化せずに writev / sendmsg へ渡せる。
+     *  プールはスレッド安全、chain は 1 スレッドから使うこと。
+     *----------------------------------------------------------------*/
+#define ICONV_ALT_BLOCK_SIZE_DEFAULT  (64 * 1024)
+
+    typedef struct iconv_alt_block_pool iconv_alt_block_pool;
+    typedef struct iconv_alt_chain      iconv_alt_chain;
+
+    /* block_size = 0 → 64 KB / max_free = 0 → フリーリスト無制限 */
+    iconv_alt_block_pool* iconv_alt_block_pool_create(size_t block_size, size_t max_free);
+    void    iconv_alt_block_pool_destroy(iconv_alt_block_pool* pool);
+
+    iconv_alt_chain* iconv_alt_chain_create(iconv_alt_block_pool* pool);
+    void    iconv_alt_chain_destroy(iconv_alt_chain* chain);
+    void    iconv_alt_chain_reset(iconv_alt_chain* chain);
+
+    /* iconv() と同じ契約 (errno / 入力の進め方)。E2BIG は発生しない */
+    size_t  iconv_alt_chain_convert(iconv_t cd, iconv_alt_chain* chain,
+        char** inbuf, size_t* inbytesleft);
+
+    size_t  iconv_alt_chain_size(const iconv_alt_chain* chain);
+    int     iconv_alt_chain_iovcnt(const iconv_alt_chain* chain);  /* iov に必要な個数の上限 */
+    /* 先頭から最大 iovcnt 個を埋め、書いた個数を返す */
+    int     iconv_alt_chain_iov(const iconv_alt_chain* chain,
+        struct iovec* iov, int iovcnt);
+
+    /*------------------------------------------------------------------
+     *  scatter / gather 変換 (iconv_alt_convv)
+     *
+     *  入力・出力とも iovec 列を 1 本のバイト列とみなして変換する。
+     *  フラグメント境界で分断された文字は cd の持ち越し状態で繋ぎ、
+     *  出力フラグメント末尾に入りきらない文字は次のフラグメントへ
+     *  跨って書く (出力も隙間なく連続する)。
+     *  progress は入出力兼用: ゼロ初期化で先頭から開始し、戻ったときは
+     *  停止位置を指す。E2BIG の後は out と out_index/out_offset を
+     *  差し替えて再度呼べば続きから変換できる。
+     *----------------------------------------------------------------*/
+    typedef struct {
+        int     in_index;     /* 次に読む入力フラグメント               */
+        size_t  in_offset;    /* そのフラグメント内のバイト位置          */
+        int     out_index;    /* 次に書く出力フラグメント               */
+        size_t  out_offset;   /* そのフラグメント内のバイト位置          */
+        size_t  in_total;     /* 今回の呼び出しで消費した入力バイト数    */
+        size_t  out_total;    /* 今回の呼び出しで書いた出力バイト数      */
+    } iconv_alt_progress;
+
+    /* iconv() と同じ契約: 0 = 全入力を消費 / (size_t)-1 + errno */
+    size_t  iconv_alt_convv(iconv_t cd,
+        const struct iovec* in, int inn,
+        struct iovec* out, int outn,
+        iconv_alt_progress* progress);
+
+    /*------------------------------------------------------------------
+     *  変換結果キャッシュ (iconv_alt_cache)
+     *
+     *  品番・都道府県名・列見出しのような短い文字列を何度も変換する用途向け。
+     *  (変換方向, 入力バイト列) をキーに変換結果を保持し、ヒット時は
+     *  iconv() を通らずコピーだけで返す。容量は固定で、追い出しは CLOCK。
+     *  読み取りはロックなし、複数スレッドから同じ cache / cd を共有してよい
+     *  (cd の持ち越し状態は使わず、入力は完結した文字列として扱う)。
+     *  ICONV_ALT_CACHE_MAX_INPUT を超える入力はキャッシュせず直接変換する。
+     *----------------------------------------------------------------*/
+#define ICONV_ALT_CACHE_MAX_INPUT  64
+
+    typedef struct iconv_alt_cache iconv_alt_cache;
+
+    typedef struct {
+        unsigned long long hits;       /* キャッシュから返した回数   */
+        unsigned long long misses;     /* 変換した回数               */
+        unsigned long long inserts;    /* 登録した回数               */
+        unsigned long long evictions;  /* CLOCK で追い出した回数     */
+        unsigned long long bypassed;   /* 長すぎてキャッシュ対象外   */
+    } iconv_alt_cache_stats;
+
+    /* capacity: 保持するエントリ数の目安 (8 の倍数・2 の冪に切り上げ) */
+    iconv_alt_cache* iconv_alt_cache_create(size_t capacity);
+    void    iconv_alt_cache_destroy(iconv_alt_cache* cache);
+
+    /* Return: 出力バイト数 / (size_t)-1 + errno (EILSEQ / EINVAL / E2BIG) */
+    size_t  iconv_alt_cache_convert(iconv_alt_cache* cache, iconv_t cd,
+        const char* in, size_t inlen, char* out, size_t outlen);
+    void    iconv_alt_cache_get_stats(iconv_alt_cache* cache,
+        iconv_alt_cache_stats* stats);
+
+    /*------------------------------------------------------------------
+     *  ファイルディスクリプタ間のストリーミング変換 (iconv_alt_convert_fd)
+     *
+     *  in_fd を EOF まで読み、変換して out_fd へ書く。入力 2 枚・出力 2 枚の
+     *  固定長バッファを回し、先読みスレッドが次のブロックを読む間に現在の
+     *  ブロックを変換し、書き出しスレッドが前のブロックを書く。
+     *  ブロック境界で分断された文字は cd の持ち越し状態で繋ぐ。
+     *  ブロック全体が ASCII なら変換もコピーもせず入力バッファをそのまま書く。
+     *  メモリ使用量は入力サイズによらず block_size の数倍で一定。
+     *----------------------------------------------------------------*/
+#define ICONV_ALT_FD_BLOCK_DEFAULT  (1024 * 1024)
+#define ICONV_ALT_FD_NO_THREADS     0x1u   /* 呼び出しスレッドだけで処理する */
+
+    typedef struct {
+        size_t              block_size;    /* in : 1 回の read の大きさ (0 → 1 MB)     */
+        unsigned            flags;         /* in : ICONV_ALT_FD_*                      */
+        unsigned long long  in_total;      /* out: 消費した入力 (EILSEQ では停止位置)  */
+        unsigned long long  out_total;     /* out: 書き出した出力                      */
+        unsigned long long  ascii_blocks;  /* out: 変換せず素通しで書いたブロック数    */
+    } iconv_alt_fd_options;
+
+    /* Return: 0 / -1 + errno
+       (EILSEQ / EINVAL = 入力末尾が文字の途中 / read・write の errno)
+       options は NULL 可。エラーでも変換済みの分は書き出してから戻る */
+    int     iconv_alt_convert_fd(iconv_t cd, int in_fd, int out_fd,
+        iconv_alt_fd_options* options);
+
+    /*------------------------------------------------------------------
+     *  大きなバッファ / ファイルの並列変換
+     *
+     *  入力を threads 個 (0 → 論理 CPU 数) のチャンクに文字境界で分け、
+     *  (1) 各チャンクの出力サイズを並列に計測し、(2) その累積和で出力位置を
+     *  決め、(3) 各チャンクを最終位置へ直接並列に変換する (結合のコピーなし)。
+     *  分割点は UTF-8 なら継続バイト以外、SJIS なら trail になり得ない
+     *  0x40 未満のバイト (改行など) の直後、無ければ後方への再同期で決める。
+     *  ICONV_ALT_PARALLEL_MIN_CHUNK に満たない入力はスレッドを使わない。
+     *
+     *  意味は iconv_alt_convert() と同じ (完結した文字列、cd の状態は不変)。
+     *  失敗時の stop は逐次変換と同じ停止位置、out の内容は不定。
+     *----------------------------------------------------------------*/
+#define ICONV_ALT_PARALLEL_MIN_CHUNK  (256 * 1024)
+
+    size_t  iconv_alt_convert_parallel(iconv_t cd, const char* in, size_t inlen,
+        char* out, size_t outlen, unsigned threads, size_t* stop);
+
+    /* in_path を読み out_path (作成 / 置き換え) へ書く。POSIX では入力を mmap し、
+       計測後に out_path と同じディレクトリの一時ファイルを ftruncate で確定サイズに
+       して mmap し、そこへ直接変換してから rename で置き換える (out_path が in_path
+       と同じファイルでもよい)。変換エラーは計測段階で分かるので、そのとき
+       out_path は作られも変えられもしない。
+       Return: 0 / -1 + errno (変換エラーなら stop に入力オフセット) */
+    int     iconv_alt_convert_file(iconv_t cd, const char* in_path,
+        const char* out_path, unsigned threads, size_t* stop);
+
+    /*------------------------------------------------------------------
+     *  work-stealing thread pool (非同期の一括変換)
+     *
+     *  ワーカーごとに Chase-Lev deque を持ち、暇なワーカーは他の deque の
+     *  反対側から盗む。大きなジョブは ICONV_ALT_PARALLEL_MIN_CHUNK 程度の
+     *  チャンクに分けて積まれるので、大小が混ざっても全コアが埋まる。
+     *  大きなジョブの処理は iconv_alt_convert_parallel() と同じく
+     *  計測 → 累積和 → 最終位置へ変換 (チャンクごとに別タスク)。
+     *
+     *  submit はすぐ戻る。完了は callback (ワーカースレッド上で呼ばれる)、
+     *  または callback = NULL なら iconv_alt_thread_pool_poll() の完了キューで
+     *  受け取る。iconv_alt_job_wait() で個別に待ってもよい。
+     *  どの場合もジョブは完了後に iconv_alt_job_release() で 1 回解放する
+     *  (callback 内で解放してよい)。
+     *----------------------------------------------------------------*/
+    typedef struct iconv_alt_thread_pool iconv_alt_thread_pool;
+    typedef struct iconv_alt_job         iconv_alt_job;
+    typedef void (*iconv_alt_job_callback)(iconv_alt_job* job, void* user);
+
+    typedef enum {
+        ICONV_ALT_JOB_BUFFER = 0,   /* in / inlen → out / outlen                     */
+        ICONV_ALT_JOB_FILE   = 1,   /* in_path → out_path (iconv_alt_convert_file)   */
+        ICONV_ALT_JOB_COLUMN = 2    /* 文字列の列: in + in_offsets[rows + 1] →
+                                       out + out_offsets[rows + 1] (Arrow 形式)      */
+    } iconv_alt_job_kind;
+
+    typedef struct {
+        iconv_alt_job_kind      kind;
+        iconv_t                 cd;           /* 状態は使わない (共有可)           */
+        const char*             in;           /* BUFFER / COLUMN                   */
+        size_t                  inlen;        /* BUFFER (COLUMN は in_offsets から) */
+        const size_t*           in_offsets;   /* COLUMN: 行 i は [o[i], o[i+1])    */
+        size_t                  rows;         /* COLUMN                            */
+        char*                   out;          /* BUFFER / COLUMN                   */
+        size_t                  outlen;
+        size_t*                 out_offsets;  /* COLUMN: 書き込まれる (rows + 1 個) */
+        const char*             in_path;      /* FILE                              */
+        const char*             out_path;
+        iconv_alt_job_callback  callback;     /* NULL → 完了キューへ               */
+        void*                   user;
+    } iconv_alt_job_desc;
+
+    /* threads: ワーカー数 (0 → 論理 CPU 数) */
+    iconv_alt_thread_pool* iconv_alt_thread_pool_create(unsigned threads);
+    /* 実行中・未着手のジョブを全て終えてから止める。完了キューに残った
+       (poll されていない) ジョブもここで解放する */
+    void    iconv_alt_thread_pool_destroy(iconv_alt_thread_pool* pool);
+
+    /* desc はコピーされる (参照先のバッファは完了まで有効にしておくこと)
+       Return: ジョブ / NULL + errno (EINVAL / ENOMEM) */
+    iconv_alt_job* iconv_alt_thread_pool_submit(iconv_alt_thread_pool* pool,
+        const iconv_alt_job_desc* desc);
+    /* 完了キューから 1 個取り出す。無ければ wait = 0 なら NULL、wait != 0 なら
+       完了を待つ (callback 無しの未完了ジョブが無ければ NULL) */
+    iconv_alt_job* iconv_alt_thread_pool_poll(iconv_alt_thread_pool* pool, int wait);
+
+    int     iconv_alt_job_done(const iconv_alt_job* job);   /* 1 = 完了 */
+    void    iconv_alt_job_wait(iconv_alt_job* job);
+    /* 完了したジョブの結果。Return: 0 / errno 値 (EILSEQ / EINVAL / E2BIG ...)
+       written: 出力バイト数 / stop: 失敗時の入力オフセット (COLUMN は in 基準)
+       user: desc.user (どれも NULL 可) */
+    int     iconv_alt_job_result(const iconv_alt_job* job, size_t* written,
+        size_t* stop, void** user);
+    void    iconv_alt_job_release(iconv_alt_job* job);
+
+    /*------------------------------------------------------------------
+     *  SJIS の文字境界 (安全な分割位置 / 疎な境界インデックス)
+     *
+     *  SJIS の trail byte (0x40–0xFC) は ASCII 英字や lead byte と重なるので、
+     *  1 バイトだけ見ても文字境界は分からない。
+     *  iconv_alt_sjis_resync() は lead になり得ないバイト (0x40 未満や
+     *  ASCII 英字・半角カナ) まで後ろへ戻り、そこからの lead 候補の
+     *  連続数の偶奇で境界を決める。戻り値の位置で切れば文字は割れない。
+     *
+     *  iconv_alt_sjis_index は interval バイトごとに (文字境界のオフセット,
+     *  そこまでの文字数) を記録した疎なインデックス。文字番号 ⇔ バイト位置
+     *  の変換は最寄りのチェックポイントから歩くだけなので O(interval)。
+     *  lead byte (0x81–0x9F / 0xE0–0xFC) は次のバイトと合わせて 1 文字と
+     *  数える (不正な trail でも同じ。末尾で途切れた lead は 1 文字)。
+     *  インデックスは buf を借用する (破棄するまで有効にしておくこと)。
+     *----------------------------------------------------------------*/
+#define ICONV_ALT_SJIS_INDEX_INTERVAL  (64 * 1024)
+
+    typedef struct iconv_alt_sjis_index iconv_alt_sjis_index;
+
+    /* buf[pos] を含む文字の先頭 (buf の先頭は文字境界とする) */
+    size_t  iconv_alt_sjis_resync(const char* buf, size_t pos);
+
+    /* interval = 0 → ICONV_ALT_SJIS_INDEX_INTERVAL。Return: NULL + errno (ENOMEM) */
+    iconv_alt_sjis_index* iconv_alt_sjis_index_build(const char* buf, size_t len,
+        size_t interval);
+    void    iconv_alt_sjis_index_free(iconv_alt_sjis_index* index);
+
+    size_t  iconv_alt_sjis_index_count(const iconv_alt_sjis_index* index);   /* 総文字数 */
+    /* 文字番号 → その文字の先頭バイト位置 (index == 総文字数なら len)
+       Return: (size_t)-1 + ERANGE */
+    size_t  iconv_alt_sjis_index_offset(const iconv_alt_sjis_index* index,
+        size_t char_index);
+    /* バイト位置 → それを含む文字の番号。start: その文字の先頭 (NULL 可)
+       Return: (size_t)-1 + ERANGE (offset > len) */
+    size_t  iconv_alt_sjis_index_char(const iconv_alt_sjis_index* index,
+        size_t offset, size_t* start);
+
+    /*------------------------------------------------------------------
+     *  対応する符号化方式の一覧 (GNU libiconv の iconvlist() と同じ形)
+     *
+     *  1 つの符号化方式につき 1 回、別名をまとめて do_one に渡す
+     *  (names[0] が代表名)。do_one が非 0 を返すとそこで打ち切る。
+     *----------------------------------------------------------------*/
+    void    iconv_alt_list(int (*do_one)(unsigned int namescount,
+        const char* const* names, void* data), void* data);
+
+    /* in の先頭にある 1 文字 (cd の入力側の符号化方式) のバイト数。
+       表せない文字で iconv() が EILSEQ を返したとき、その文字を丸ごと
+       飛ばすのに使う。cd の状態で読むが cd は変えない。
+       Return: バイト数 / 0 = 文字の途中で入力が終わる / -1 + EILSEQ (不正な並び) */
+    int     iconv_alt_char_length(iconv_t cd, const char* in, size_t inlen);
+
+    /*------------------------------------------------------------------
+     *  ディレクトリ木の一括変換 (iconv_alt_convert_tree)
+     *
+     *  in_dir 以下の通常ファイルを全て変換し、同じ相対パスで out_dir に
+     *  書く (ディレクトリは作る。in_dir == out_dir なら置き換え)。
+     *  各ファイルは "<出力>.iconv-alt.tmp" に書いてから rename するので、
+     *  途中で止まっても出力先に書きかけは残らない。シンボリックリンクは辿らない。
+     *  Linux では io_uring で open / read / write / close / rename をまとめて
+     *  投げ、変換はスレッドプールで重ねる。io_uring が使えなければ
+     *  スレッドごとに同期 I/O で回す。cd は全ファイルで共有する
+     *  (状態は使わず、各ファイルを完結した文字列として変換する)。
+     *  Windows では未対応 (ENOSYS)。
+     *----------------------------------------------------------------*/
+#define ICONV_ALT_TREE_NO_URING  0x1u   /* io_uring を使わない */
+
+    typedef struct {
+        unsigned  threads;        /* 変換スレッド数 (0 → 論理 CPU 数)          */
+        unsigned  queue_depth;    /* 同時に扱うファイル数 (0 → 64)             */
+        unsigned  flags;          /* ICONV_ALT_TREE_*                          */
+        /* ファイルごとの失敗 (直列に呼ばれる)。offset は EILSEQ 等の入力位置 */
+        void    (*on_error)(const char* path, int err, size_t offset, void* user);
+        void*     user;
+        /* 結果 */
+        size_t    files;          /* 見つけた通常ファイル数                    */
+        size_t    failed;         /* うち失敗した数 (出力は作られない)          */
+        unsigned long long in_total, out_total;
+        int       used_uring;     /* 1 = io_uring 経路で処理した               */
+    } iconv_alt_tree_options;
+
+    /* Return: 0 = 全て成功 / -1 + errno (最初に失敗したファイルの errno、
+       または in_dir を読めない・out_dir を作れないなど) */
+    int     iconv_alt_convert_tree(iconv_t cd, const char* in_dir, const char* out_dir,
+        iconv_alt_tree_options* options);
+
+    /*------------------------------------------------------------------
+     *  符号化方式の推定 (iconv_alt_detect)
+     *
+     *  先頭から最大 ICONV_ALT_DETECT_MAX_SCAN バイトを 1 回だけ走査し、
+     *  UTF-8 / SJIS (CP932) / EUC-JP / ISO-2022-JP のそれぞれについて
+     *  「最後まで不正な列が無いか (valid)」と「日本語らしさ (score)」を出す。
+     *  ASCII の連続は SIMD で読み飛ばし、非 ASCII の文字だけを 4 方式の
+     *  状態機械に通す。SJIS は変換表に載っている文字だけを有効とする。
+     *  有効な候補が 1 つに絞れ、その非 ASCII 文字が
+     *  ICONV_ALT_DETECT_CONFIDENT 個を超えた時点で打ち切る。
+     *----------------------------------------------------------------*/
+#define ICONV_ALT_DETECT_MAX_SCAN   (1024 * 1024)
+#define ICONV_ALT_DETECT_CONFIDENT  64
+
+    typedef enum {
+        ICONV_ALT_DETECT_UNKNOWN = -1,  /* どれとしても不正 */
+        ICONV_ALT_DETECT_ASCII = 0,     /* 7 bit のみ (ESC 無し) */
+        ICONV_ALT_DETECT_UTF8,
+        ICONV_ALT_DETECT_SJIS,          /* CP932 */
+        ICONV_ALT_DETECT_EUCJP,
+        ICONV_ALT_DETECT_ISO2022JP,
+        ICONV_ALT_DETECT_COUNT
+    } iconv_alt_encoding;
+
+    typedef struct {
+        iconv_alt_encoding best;
+        const char*   name;         /* iconv_open() 用の名前 (ASCII は "UTF-8") */
+        unsigned      confidence;   /* 0–100: best の score / 有効な候補の score 合計 */
+        size_t        scanned;      /* 実際に読んだバイト数 */
+        /* 以下は ICONV_ALT_DETECT_* で引く (ASCII は valid のみ意味を持つ) */
+        unsigned char valid[ICONV_ALT_DETECT_COUNT];
+        size_t        chars[ICONV_ALT_DETECT_COUNT];   /* 非 ASCII 文字数 */
+        unsigned long score[ICONV_ALT_DETECT_COUNT];   /* かな 4 / 第 1 水準漢字 3 / ... */
+    } iconv_alt_detect_result;
+
+    /* Return: 0 = best を決めた / -1 + EILSEQ (どの方式でも不正; best = UNKNOWN)
+       / -1 + EINVAL (result が NULL) */
+    int     iconv_alt_detect(const void* buf, size_t len, iconv_alt_detect_result* result);
+
+    /*------------------------------------------------------------------
+     *  変換できるかの検証 (iconv_alt_validate)
+     *
+     *  出力を作らずに、buf を cd で変換できるかだけを調べる。
+     *  SJIS → UTF-8 は CP932 の表にある文字か、UTF-8 → SJIS は CP932 で
+     *  表せる文字か (8 KB の bitset で判定)。ASCII の連続は SIMD で読み飛ばす。
+     *  結果と bad_offset は iconv_alt_convert() の失敗と stop に一致する。
+     *  Return: 0 = 全て変換できる / -1 + errno (EILSEQ = 変換できない文字、
+     *          EINVAL = 末尾の文字が途中)。bad_offset (NULL 可) にその文字の先頭。
+     *----------------------------------------------------------------*/
+    int     iconv_alt_validate(iconv_t cd, const char* buf, size_t len, size_t* bad_offset);
+
+#ifdef __cplusplus
+}
+#endif
+#endif /* ICONV_ALT_ICONV_ALT_H */
@@ -0,0 +1,204 @@
+/*----------------------------------------------------------------------
+ *  include/iconv_alt.hpp  —  C++ 向けファサード (ヘッダオンリー, C++17 以上)
+ *
+ *  iconv_alt::converter   : iconv_t を所有する move-only ラッパ
+ *  iconv_alt::result<T>   : std::expected 風の戻り値 (失敗時は errc + 入力オフセット)
+ *
+ *  変換はすべて「完結した文字列」単位で、cd の持ち越し状態を使わない。
+ *  そのため converter の変換メソッドは const で、複数スレッドから共有できる。
+ *--------------------------------------------------------------------*/
+#ifndef ICONV_ALT_ICONV_ALT_HPP
+#define ICONV_ALT_ICONV_ALT_HPP
+
+#include "iconv_alt.h"
+
+#include <cerrno>
+#include <cstddef>
+#include <cstdint>
+#include <memory_resource>
+#include <string>
+#include <string_view>
+#include <system_error>
+#include <utility>
+#if defined(__has_include)
+#  if __has_include(<version>)
+#    include <version>
+#  endif
+#endif
+#if defined(__cpp_lib_span)
+#  include <span>
+#endif
+
+namespace iconv_alt {
+
+/*======================================================================
+ *  1.  エラーと result<T>
+ *====================================================================*/
+struct conversion_error {
+    std::errc   code;      // illegal_byte_sequence / invalid_argument / ...
+    std::size_t offset;    // 停止した文字の入力オフセット (open 失敗時は 0)
+
+    std::error_code error_code() const noexcept { return std::make_error_code(code); }
+};
+
+/* std::expected<T, conversion_error> と同じ名前のメンバを持つ最小実装
+   (C++23 以前でも使えるように自前で持つ) */
+template <class T>
+class result {
+public:
+    result(T value) : value_(std::move(value)), ok_(true) {}
+    result(conversion_error err) : err_(err), ok_(false) {}
+
+    bool has_value() const noexcept { return ok_; }
+    explicit operator bool() const noexcept { return ok_; }
+
+    T& value() & { check(); return value_; }
+    const T& value() const& { check(); return value_; }
+    T&& value() && { check(); return std::move(value_); }
+
+    template <class U>
+    T value_or(U&& fallback) const& { return ok_ ? value_ : static_cast<T>(std::forward<U>(fallback)); }
+
+    const conversion_error& error() const noexcept { return err_; }
+
+    T& operator*() & noexcept { return value_; }
+    const T& operator*() const& noexcept { return value_; }
+    T* operator->() noexcept { return &value_; }
+    const T* operator->() const noexcept { return &value_; }
+
+private:
+    void check() const {
+        if (!ok_)
+            throw std::system_error(err_.error_code(),
+                "iconv_alt: conversion stopped at offset " + std::to_string(err_.offset));
+    }
+
+    T                value_{};
+    conversion_error err_{};
+    bool             ok_;
+};
+
+namespace detail {
+inline conversion_error last_error(std::size_t offset, int err = errno) noexcept {
+    return conversion_error{ static_cast<std::errc>(err), offset };
+}
+}  // namespace detail
+
+/*======================================================================
+ *  2.  converter
+ *====================================================================*/
+class converter {
+public:
+    /* この長さ以下の入力はスタック上で変換してから string を作る
+       (出力が SSO に収まればヒープ確保は起きない) */
+    static constexpr std::size_t small_input = 64;
+
+    converter() noexcept = default;
+
+    /* 失敗すると std::system_error (例外を使わない場合は open()) */
+    converter(const char* tocode, const char* fromcode)
+        : cd_(::iconv_open(tocode, fromcode)) {
+        if (cd_ == invalid())
+            throw std::system_error(std::make_error_code(std::errc::invalid_argument),
+                "iconv_alt: unsupported conversion");
+    }
+
+    static result<converter> open(const char* tocode, const char* fromcode) noexcept {
+        converter c;
+        c.cd_ = ::iconv_open(tocode, fromcode);
+        if (c.cd_ == invalid()) return detail::last_error(0);
+        return result<converter>(std::move(c));
+    }
+
+    converter(const converter&) = delete;
+    converter& operator=(const converter&) = delete;
+
+    converter(converter&& o) noexcept : cd_(std::exchange(o.cd_, invalid())) {}
+    converter& operator=(converter&& o) noexcept {
+        if (this != &o) { close(); cd_ = std::exchange(o.cd_, invalid()); }
+        return *this;
+    }
+    ~converter() { close(); }
+
+    bool valid() const noexcept { return cd_ != invalid(); }
+    explicit operator bool() const noexcept { return valid(); }
+    iconv_t native_handle() const noexcept { return cd_; }
+
+    /* 出力に必要なバイト数 (出力は作らない) */
+    result<std::size_t> measure(std::string_view in) const noexcept {
+        std::size_t stop = 0;
+        std::size_t n = ::iconv_alt_measure(cd_, in.data(), in.size(), &stop);
+        if (n == static_cast<std::size_t>(-1)) return detail::last_error(stop);
+        return n;
+    }
+
+    /* 新しい std::string に変換する。大きな入力は計測してちょうどの容量を確保 */
+    result<std::string> convert(std::string_view in) const {
+        if (in.size() <= small_input) {
+            char buf[small_input * 3];                 // CP932 ⇆ UTF-8 は入力の 3 倍以内
+            std::size_t stop = 0;
+            std::size_t n = ::iconv_alt_convert(cd_, in.data(), in.size(), buf, sizeof(buf), &stop);
+            if (n != static_cast<std::size_t>(-1)) return std::string(buf, n);
+            if (errno != E2BIG) return detail::last_error(stop);
+            /* UTF-16 (BOM 付き) など 3 倍を超え得る組は計測して確保し直す */
+        }
+        std::string out;
+        auto r = convert_into(in, out);
+        if (!r) return r.error();
+        return out;
+    }
+
+    /* out の末尾に追記する (pmr::string ならアリーナから確保)。
+       Return: 追記したバイト数。失敗時 out は呼び出し前の長さに戻る */
+    template <class Alloc>
+    result<std::size_t> convert_into(std::string_view in,
+        std::basic_string<char, std::char_traits<char>, Alloc>& out) const {
+        auto need = measure(in);
+        if (!need) return need.error();
+
+        const std::size_t base = out.size();
+        std::size_t n = 0, stop = 0;
+        int err = 0;
+        auto fill = [&](char* p, std::size_t size) {
+            n = ::iconv_alt_convert(cd_, in.data(), in.size(), p + base, size - base, &stop);
+            if (n == static_cast<std::size_t>(-1)) { err = errno; return base; }
+            return base + n;
+        };
+#if defined(__cpp_lib_string_resize_and_overwrite)
+        out.resize_and_overwrite(base + *need, fill);  // 出力領域のゼロ埋めを省く
+#else
+        out.resize(base + *need);
+        out.resize(fill(&out[0], out.size()));
+#endif
+        if (n == static_cast<std::size_t>(-1)) return detail::last_error(stop, err);
+        return n;
+    }
+
+    /* mr から確保する std::pmr::string に変換する */
+    result<std::pmr::string> convert(std::string_view in, std::pmr::memory_resource* mr) const {
+        std::pmr::string out(mr);
+        auto r = convert_into(in, out);
+        if (!r) return r.error();
+        return out;
+    }
+
+#if defined(__cpp_lib_span)
+    template <class Alloc>
+    result<std::size_t> convert_into(std::span<const std::byte> in,
+        std::basic_string<char, std::char_traits<char>, Alloc>& out) const {
+        return convert_into(std::string_view(reinterpret_cast<const char*>(in.data()), in.size()), out);
+    }
+#endif
+
+private:
+    static iconv_t invalid() noexcept { return reinterpret_cast<iconv_t>(static_cast<std::intptr_t>(-1)); }
+    void close() noexcept {
+        if (cd_ != invalid()) { ::iconv_close(cd_); cd_ = invalid(); }
+    }
+
+    iconv_t cd_ = invalid();
+};
+
+}  // namespace iconv_alt
+
+#endif /* ICONV_ALT_ICONV_ALT_HPP */
@@ -0,0 +1,236 @@
+/*----------------------------------------------------------------------
+ *  include/iconv_alt_codec.hpp  —  ポリシーベースのヘッダオンリー codec (C++17 以上)
+ *
+ *  iconv_alt::codec<From, To, ErrorPolicy, BoundsPolicy>
+ *
+ *  変換方向・エラー処理・出力境界チェックをテンプレート引数で固定し、
+ *  組み合わせごとに専用のループを生成する。iconv() の関数呼び出し境界も
+ *  conv_mode の実行時分岐も無く、sjis_table.h の表引きは呼び出し側の
+ *  ループへインライン展開される (ライブラリ本体と同じ表を共有)。
+ *
+ *      using fast = iconv_alt::codec<iconv_alt::encoding::sjis,
+ *                                    iconv_alt::encoding::utf8,
+ *                                    iconv_alt::policy::replace,
+ *                                    iconv_alt::policy::unchecked>;
+ *      std::string out(fast::max_output(in.size()), '\0');
+ *      out.resize(fast::convert(in.data(), in.size(), &out[0], out.size()).written);
+ *
+ *  入力は完結した文字列として扱う (持ち越し状態は持たない)。
+ *--------------------------------------------------------------------*/
+#ifndef ICONV_ALT_ICONV_ALT_CODEC_HPP
+#define ICONV_ALT_ICONV_ALT_CODEC_HPP
+
+#include "sjis_table.h"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <system_error>
+#include <type_traits>
+
+namespace iconv_alt {
+
+/*======================================================================
+ *  1.  ポリシー
+ *====================================================================*/
+namespace policy {
+struct stop    {};   // 最初のエラーで止まる (ec と read に位置)
+struct skip    {};   // 不正・変換不能な文字を捨てて続ける
+struct replace {};   // 置換文字 (UTF-8: U+FFFD / SJIS: '?') を出して続ける
+
+struct checked   {}; // 1 文字ごとに出力の空きを確認 (足りなければ E2BIG)
+struct unchecked {}; // 確認しない。outlen >= max_output(inlen) は呼び出し側の責任
+}  // namespace policy
+
+/* std::from_chars と同じ形: ec == std::errc{} なら成功
+   illegal_byte_sequence (EILSEQ) / invalid_argument (EINVAL) /
+   argument_list_too_long (E2BIG) のときは read が停止した文字の先頭 */
+struct codec_result {
+    std::size_t read;
+    std::size_t written;
+    std::errc   ec;
+};
+
+/*======================================================================
+ *  2.  エンコーディング (1 文字の decode / encode)
+ *====================================================================*/
+namespace encoding {
+
+enum class status { ok, illegal, incomplete };
+
+struct sjis {
+    static constexpr std::size_t max_bytes = 2;
+    static constexpr std::size_t expansion = 1;    // 出力 / 入力 バイト比の上限
+    static constexpr char replacement[] = "?";
+
+    /* 0x80 未満と 0xA1–0xDF は 1 byte、0x81–0x9F / 0xE0–0xFC は lead。
+       lead になり得ない 0x80 / 0xA0 / 0xFD–0xFF と、trail (0x40–0x7E / 0x80–0xFC)
+       が続かない lead は 1 byte の不正として扱う
+       (次のバイトを巻き込まない。Windows の MultiByteToWideChar と同じ) */
+    static status decode(const unsigned char* p, const unsigned char* end,
+                         char32_t& cp, std::size_t& len) noexcept {
+        unsigned b = p[0];
+        std::uint16_t u;
+        if (b < 0x80 || (b >= 0xA1 && b <= 0xDF)) {
+            u = SJIS_SB2U[b]; len = 1;
+        } else if (b == 0x80 || b == 0xA0 || b >= 0xFD) {
+            len = 1; return status::illegal;
+        } else {
+            if (end - p < 2) { len = 1; return status::incomplete; }
+            unsigned t = p[1];
+            if (t < 0x40 || t == 0x7F || t > 0xFC) { len = 1; return status::illegal; }
+            u = SJIS_DB2U[SJIS_LEAD2ROW[b]][t]; len = 2;
+        }
+        if (u == SJIS_NOMAP) return status::illegal;
+        cp = u;
+        return status::ok;
+    }
+
+    /* Return: 書いたバイト数 / 0 = 変換不能 */
+    static std::size_t encode(char32_t cp, char* q) noexcept {
+        if (cp > 0xFFFF) return 0;
+        std::uint16_t s = U2SJIS[U2SJIS_PAGE[cp >> 8]][cp & 0xFF];
+        if (s == SJIS_NOMAP) return 0;
+        if (s < 0x100) { q[0] = static_cast<char>(s); return 1; }
+        q[0] = static_cast<char>(s >> 8);
+        q[1] = static_cast<char>(s & 0xFF);
+        return 2;
+    }
+};
+
+struct utf8 {
+    static constexpr std::size_t max_bytes = 4;
+    static constexpr std::size_t expansion = 3;    // 半角カナ / 置換文字 1 byte → 3 byte
+    static constexpr char replacement[] = "\xEF\xBF\xBD";
+
+    /* 厳密に検査する (冗長表現・サロゲート・U+10FFFF 超は不正) */
+    static status decode(const unsigned char* p, const unsigned char* end,
+                         char32_t& cp, std::size_t& len) noexcept {
+        unsigned b = p[0];
+        char32_t c, min;
+        if (b < 0x80)                { cp = b; len = 1; return status::ok; }
+        else if ((b & 0xE0) == 0xC0) { len = 2; c = b & 0x1F; min = 0x80; }
+        else if ((b & 0xF0) == 0xE0) { len = 3; c = b & 0x0F; min = 0x800; }
+        else if ((b & 0xF8) == 0xF0) { len = 4; c = b & 0x07; min = 0x10000; }
+        else                         { len = 1; return status::illegal; }
+
+        std::size_t have = static_cast<std::size_t>(end - p);
+        for (std::size_t i = 1; i < len; ++i) {
+            if (i >= have) { len = 1; return status::incomplete; }
+            if ((p[i] & 0xC0) != 0x80) { len = 1; return status::illegal; }
+            c = (c << 6) | (p[i] & 0x3F);
+        }
+        if (c < min || c > 0x10FFFF || (c >= 0xD800 && c <= 0xDFFF)) {
+            len = 1; return status::illegal;
+        }
+        cp = c;
+        return status::ok;
+    }
+
+    static std::size_t encode(char32_t cp, char* q) noexcept {
+        if (cp < 0x80)    { q[0] = static_cast<char>(cp); return 1; }
+        if (cp < 0x800)   { q[0] = static_cast<char>(0xC0 | (cp >> 6));
+                            q[1] = static_cast<char>(0x80 | (cp & 0x3F)); return 2; }
+        if (cp < 0x10000) { q[0] = static_cast<char>(0xE0 | (cp >> 12));
+                            q[1] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+                            q[2] = static_cast<char>(0x80 | (cp & 0x3F)); return 3; }
+        q[0] = static_cast<char>(0xF0 | (cp >> 18));
+        q[1] = static_cast<char>(0x80 | ((cp >> 12) & 0x3F));
+        q[2] = static_cast<char>(0x80 | ((cp >> 6) & 0x3F));
+        q[3] = static_cast<char>(0x80 | (cp & 0x3F));
+        return 4;
+    }
+};
+
+}  // namespace encoding
+
+/*======================================================================
+ *  3.  codec
+ *====================================================================*/
+template <class From, class To,
+          class ErrorPolicy = policy::stop,
+          class BoundsPolicy = policy::checked>
+class codec {
+    static_assert(std::is_same<ErrorPolicy, policy::stop>::value ||
+                  std::is_same<ErrorPolicy, policy::skip>::value ||
+                  std::is_same<ErrorPolicy, policy::replace>::value,
+                  "ErrorPolicy must be policy::stop, policy::skip or policy::replace");
+    static_assert(std::is_same<BoundsPolicy, policy::checked>::value ||
+                  std::is_same<BoundsPolicy, policy::unchecked>::value,
+                  "BoundsPolicy must be policy::checked or policy::unchecked");
+
+    static constexpr bool check = std::is_same<BoundsPolicy, policy::checked>::value;
+
+public:
+    /* unchecked で必要な出力領域 (どの入力でもこれを超えない) */
+    static constexpr std::size_t max_output(std::size_t inlen) noexcept {
+        return inlen * To::expansion;
+    }
+
+    static codec_result convert(const char* in, std::size_t inlen,
+                                char* out, std::size_t outlen) noexcept {
+        const unsigned char* p = reinterpret_cast<const unsigned char*>(in);
+        const unsigned char* const end = p + inlen;
+        char* q = out;
+        char* const qend = out + outlen;
+
+        auto done = [&](std::errc ec) {
+            return codec_result{ static_cast<std::size_t>(p - reinterpret_cast<const unsigned char*>(in)),
+                                 static_cast<std::size_t>(q - out), ec };
+        };
+
+        while (p < end) {
+            /* --- ASCII: 両エンコーディングで同一。8 byte ずつ素通し --- */
+            while (end - p >= 8 && (!check || qend - q >= 8)) {
+                std::uint64_t w;
+                std::memcpy(&w, p, 8);
+                if (w & 0x8080808080808080ull) break;
+                std::memcpy(q, p, 8);
+                p += 8; q += 8;
+            }
+            if (*p < 0x80) {
+                if (check && q == qend) return done(std::errc::argument_list_too_long);
+                *q++ = static_cast<char>(*p++);
+                continue;
+            }
+
+            /* --- 1 文字: decode → encode --- */
+            char32_t cp = 0;
+            std::size_t len = 0;
+            encoding::status st = From::decode(p, end, cp, len);
+            if (st == encoding::status::ok) {
+                char tmp[To::max_bytes];
+                bool direct = !check || static_cast<std::size_t>(qend - q) >= To::max_bytes;
+                std::size_t n = To::encode(cp, direct ? q : tmp);
+                if (n != 0) {
+                    if (!direct) {
+                        if (static_cast<std::size_t>(qend - q) < n)
+                            return done(std::errc::argument_list_too_long);
+                        std::memcpy(q, tmp, n);
+                    }
+                    q += n; p += len;
+                    continue;
+                }
+                st = encoding::status::illegal;       // 出力側で変換不能
+            }
+
+            /* --- エラー: ポリシーに従う --- */
+            if constexpr (std::is_same<ErrorPolicy, policy::stop>::value)
+                return done(st == encoding::status::incomplete ? std::errc::invalid_argument
+                                                               : std::errc::illegal_byte_sequence);
+            if constexpr (std::is_same<ErrorPolicy, policy::replace>::value) {
+                constexpr std::size_t rn = sizeof(To::replacement) - 1;
+                if (check && static_cast<std::size_t>(qend - q) < rn)
+                    return done(std::errc::argument_list_too_long);
+                std::memcpy(q, To::replacement, rn);
+                q += rn;
+            }
+            p = (st == encoding::status::incomplete) ? end : p + len;
+        }
+        return done(std::errc{});
+    }
+};
+
+}  // namespace iconv_alt
+
+#endif /* ICONV_ALT_ICONV_ALT_CODEC_HPP */
@@ -0,0 +1,112 @@
+/*----------------------------------------------------------------------
+ *  include/iconv_alt_literal.hpp  —  文字列リテラルのコンパイル時 CP932 変換 (C++20)
+ *
+ *      using namespace iconv_alt::literals;
+ *      constexpr auto title = u8"請求書"_sjis;               // std::array<char, 6>
+ *      constexpr auto same  = iconv_alt::sjis_literal<u8"請求書">();
+ *
+ *  変換は consteval で行い、実行時コストも起動時の iconv() も無い。
+ *  結果は CP932 バイト列ちょうどの長さで、終端 NUL は含まない。
+ *  CP932 で表せない文字・不正な UTF-8 はコンパイルエラーになる
+ *  (エラーメッセージに character_not_representable_in_cp932 が出る)。
+ *  表は sjis_table.h の constexpr 版をそのまま使う。
+ *--------------------------------------------------------------------*/
+#ifndef ICONV_ALT_ICONV_ALT_LITERAL_HPP
+#define ICONV_ALT_ICONV_ALT_LITERAL_HPP
+
+#include "sjis_table.h"
+
+#include <array>
+#include <cstddef>
+#include <cstdint>
+
+namespace iconv_alt {
+
+namespace detail {
+
+/* テンプレート引数に渡せる文字列 (char / char8_t どちらも UTF-8 として読む) */
+template <class CharT, std::size_t N>
+struct fixed_string {
+    CharT s[N]{};
+    consteval fixed_string(const CharT (&str)[N]) {
+        for (std::size_t i = 0; i < N; ++i) s[i] = str[i];
+    }
+    static constexpr std::size_t length = N - 1;   // 終端 NUL を除く
+};
+
+/* 定数評価中に呼ばれるとコンパイルエラーになる (constexpr ではない) */
+inline void character_not_representable_in_cp932() {}
+
+/* s[i..] の 1 文字を CP932 コードにする。失敗は SJIS_NOMAP */
+template <class CharT>
+constexpr std::uint16_t next_sjis(const CharT* s, std::size_t len, std::size_t& i) {
+    auto byte = [&](std::size_t k) { return static_cast<unsigned char>(s[k]); };
+    unsigned b = byte(i);
+    char32_t cp;
+    std::size_t n;
+    if (b < 0x80)                { cp = b;        n = 1; }
+    else if ((b & 0xE0) == 0xC0) { cp = b & 0x1F; n = 2; }
+    else if ((b & 0xF0) == 0xE0) { cp = b & 0x0F; n = 3; }
+    else return SJIS_NOMAP;                         // 4 byte 以上は BMP 外 (CP932 に無い)
+    if (i + n > len) return SJIS_NOMAP;
+    for (std::size_t k = 1; k < n; ++k) {
+        if ((byte(i + k) & 0xC0) != 0x80) return SJIS_NOMAP;
+        cp = (cp << 6) | (byte(i + k) & 0x3F);
+    }
+    if ((n == 2 && cp < 0x80) || (n == 3 && cp < 0x800)) return SJIS_NOMAP;
+    i += n;
+    return U2SJIS[U2SJIS_PAGE[cp >> 8]][cp & 0xFF];
+}
+
+/* CP932 でのバイト数 / 表せなければ (size_t)-1 */
+template <class CharT>
+constexpr std::size_t sjis_length(const CharT* s, std::size_t len) {
+    std::size_t i = 0, out = 0;
+    while (i < len) {
+        std::uint16_t c = next_sjis(s, len, i);
+        if (c == SJIS_NOMAP) return static_cast<std::size_t>(-1);
+        out += (c < 0x100) ? 1 : 2;
+    }
+    return out;
+}
+
+template <class CharT>
+consteval std::size_t checked_sjis_length(const CharT* s, std::size_t len) {
+    std::size_t n = sjis_length(s, len);
+    if (n == static_cast<std::size_t>(-1)) character_not_representable_in_cp932();
+    return n;
+}
+
+}  // namespace detail
+
+/*======================================================================
+ *  公開 API
+ *====================================================================*/
+
+/* static_assert 用: 文字列全体が CP932 で表せるか */
+template <class CharT, std::size_t N>
+constexpr bool sjis_representable(const CharT (&str)[N]) {
+    return detail::sjis_length(str, N - 1) != static_cast<std::size_t>(-1);
+}
+
+template <detail::fixed_string S>
+consteval auto sjis_literal() {
+    constexpr std::size_t M = detail::checked_sjis_length(S.s, S.length);
+    std::array<char, M> out{};
+    std::size_t i = 0, o = 0;
+    while (i < S.length) {
+        std::uint16_t c = detail::next_sjis(S.s, S.length, i);
+        if (c >= 0x100) out[o++] = static_cast<char>(c >> 8);
+        out[o++] = static_cast<char>(c & 0xFF);
+    }
+    return out;
+}
+
+namespace literals {
+template <detail::fixed_string S>
+consteval auto operator""_sjis() { return sjis_literal<S>(); }
+}  // namespace literals
+
+}  // namespace iconv_alt
+
+#endif /* ICONV_ALT_ICONV_ALT_LITERAL_HPP */
@@ -0,0 +1,167 @@
+/*----------------------------------------------------------------------
+ *  include/iconv_alt_ranges.hpp  —  SJIS / UTF-8 バイト列のコード点ビュー (C++20)
+ *
+ *      for (char32_t c : bytes | iconv_alt::views::sjis_codepoints) ...
+ *      auto n = std::ranges::distance(iconv_alt::views::utf8_codepoints(sv));
+ *
+ *  変換後のバイト列を作らず、コード点 (char32_t) を遅延して返す。
+ *  イテレータは内部に 64 コード点分のバッファを持ち、ブロック単位で
+ *  まとめて decode する (ASCII は 8 byte ずつ展開)。++ / * は配列添字だけ。
+ *  表引きは iconv_alt_codec.hpp と同じ (sjis_table.h を共有)。
+ *
+ *  不正な並び・未定義コードは U+FFFD (replacement_character) を 1 個返して
+ *  次へ進む (末尾で途切れた文字も 1 個)。
+ *  要素の入力バイト位置は iterator::offset() で取れる。
+ *--------------------------------------------------------------------*/
+#ifndef ICONV_ALT_ICONV_ALT_RANGES_HPP
+#define ICONV_ALT_ICONV_ALT_RANGES_HPP
+
+#include "iconv_alt_codec.hpp"
+
+#include <cstddef>
+#include <cstdint>
+#include <cstring>
+#include <iterator>
+#include <ranges>
+#include <type_traits>
+
+namespace iconv_alt {
+
+inline constexpr char32_t replacement_character = U'\uFFFD';
+
+/*======================================================================
+ *  1.  codepoint_view<Encoding>
+ *====================================================================*/
+template <class Encoding>
+class codepoint_view : public std::ranges::view_interface<codepoint_view<Encoding>> {
+public:
+    class iterator {
+    public:
+        using iterator_concept = std::forward_iterator_tag;
+        using iterator_category = std::forward_iterator_tag;
+        using value_type = char32_t;
+        using difference_type = std::ptrdiff_t;
+
+        iterator() = default;
+        iterator(const unsigned char* begin, const unsigned char* end)
+            : base_(begin), next_(begin), end_(end) { fill(); }
+
+        char32_t operator*() const noexcept { return cps_[idx_]; }
+
+        iterator& operator++() noexcept {
+            if (++idx_ == count_) fill();
+            return *this;
+        }
+        iterator operator++(int) noexcept { iterator t = *this; ++*this; return t; }
+
+        /* 現在のコード点の入力先頭からのバイト位置 (終端では入力長) */
+        std::size_t offset() const noexcept {
+            const unsigned char* p = (idx_ < count_) ? block_ + offs_[idx_] : end_;
+            return static_cast<std::size_t>(p - base_);
+        }
+
+        friend bool operator==(const iterator& a, const iterator& b) noexcept {
+            return a.offset() == b.offset();
+        }
+        friend bool operator==(const iterator& a, std::default_sentinel_t) noexcept {
+            return a.idx_ >= a.count_;
+        }
+
+    private:
+        static constexpr unsigned block = 64;
+
+        /* next_ から最大 block 個を decode してバッファを詰め直す */
+        void fill() noexcept {
+            idx_ = 0;
+            count_ = 0;
+            block_ = next_;
+            const unsigned char* p = next_;
+            while (count_ < block && p < end_) {
+                /* ASCII: 8 byte ずつそのまま展開 */
+                if (count_ + 8 <= block && end_ - p >= 8) {
+                    std::uint64_t w;
+                    std::memcpy(&w, p, 8);
+                    if (!(w & 0x8080808080808080ull)) {
+                        for (unsigned k = 0; k < 8; ++k) {
+                            cps_[count_] = p[k];
+                            offs_[count_++] = static_cast<std::uint16_t>(p + k - block_);
+                        }
+                        p += 8;
+                        continue;
+                    }
+                }
+                char32_t cp = 0;
+                std::size_t len = 1;
+                encoding::status st = Encoding::decode(p, end_, cp, len);
+                if (st != encoding::status::ok) {
+                    cp = replacement_character;
+                    if (st == encoding::status::incomplete)   // 末尾の途切れは 1 個にまとめる
+                        len = static_cast<std::size_t>(end_ - p);
+                }
+                cps_[count_] = cp;
+                offs_[count_++] = static_cast<std::uint16_t>(p - block_);
+                p += len;
+            }
+            next_ = p;
+        }
+
+        const unsigned char* base_ = nullptr;   // 入力の先頭 (offset の基準)
+        const unsigned char* block_ = nullptr;  // 現在のブロックの先頭
+        const unsigned char* next_ = nullptr;   // 次のブロックの先頭
+        const unsigned char* end_ = nullptr;
+        unsigned             idx_ = 0, count_ = 0;
+        char32_t             cps_[block];
+        std::uint16_t        offs_[block];      // block_ からのバイト位置
+    };
+
+    codepoint_view() = default;
+    codepoint_view(const void* data, std::size_t size) noexcept
+        : begin_(static_cast<const unsigned char*>(data)), end_(begin_ + size) {}
+
+    iterator begin() const { return iterator(begin_, end_); }
+    std::default_sentinel_t end() const noexcept { return std::default_sentinel; }
+
+    /* 入力バイト数 (コード点数ではない) */
+    std::size_t size_bytes() const noexcept { return static_cast<std::size_t>(end_ - begin_); }
+
+private:
+    const unsigned char* begin_ = nullptr;
+    const unsigned char* end_ = nullptr;
+};
+
+/*======================================================================
+ *  2.  views::sjis_codepoints / views::utf8_codepoints
+ *====================================================================*/
+namespace detail {
+
+template <class R>
+concept byte_range = std::ranges::contiguous_range<R> && std::ranges::sized_range<R>
+    && sizeof(std::ranges::range_value_t<R>) == 1
+    && std::is_trivially_copyable_v<std::ranges::range_value_t<R>>;
+
+template <class Encoding>
+struct codepoints_fn {
+    template <byte_range R>
+    codepoint_view<Encoding> operator()(R&& r) const noexcept {
+        return codepoint_view<Encoding>(std::ranges::data(r), std::ranges::size(r));
+    }
+    template <byte_range R>
+    friend codepoint_view<Encoding> operator|(R&& r, const codepoints_fn& f) noexcept {
+        return f(std::forward<R>(r));
+    }
+};
+
+}  // namespace detail
+
+namespace views {
+inline constexpr detail::codepoints_fn<encoding::sjis> sjis_codepoints{};
+inline constexpr detail::codepoints_fn<encoding::utf8> utf8_codepoints{};
+}  // namespace views
+
+}  // namespace iconv_alt
+
+/* ポインタしか持たないので、元のバッファより長生きしても安全 */
+template <class Encoding>
+inline constexpr bool std::ranges::enable_borrowed_range<iconv_alt::codepoint_view<Encoding>> = true;
+
+#endif /* ICONV_ALT_ICONV_ALT_RANGES_HPP */
@@ -0,0 +1,250 @@
+/*----------------------------------------------------------------------
+ *  include/iconv_alt_stream.hpp  —  iostream 用の変換 streambuf (C++17 以上)
+ *
+ *      std::ifstream raw("in.txt", std::ios::binary);
+ *      iconv_alt::transcoding_istream in(raw, "UTF-8", "CP932");   // ← 1 行差し替え
+ *      std::getline(in, line);                                      // UTF-8 で読める
+ *
+ *  下位の streambuf を包み、ブロック単位 (既定 64 KB) で iconv() に通す。
+ *  codecvt ファセットのように 1 文字ずつ変換しない。ブロック境界で分断された
+ *  文字は cd の持ち越し状態が繋ぐ。
+ *
+ *  変換エラー (EILSEQ / 入力末尾の不完全な文字) は std::system_error を投げる。
+ *  iostream はこれを捕まえて badbit を立てる (exceptions() 次第で再送出)。
+ *  エラー手前までの変換結果は先に読み出せる。出力側で最後の文字が途中で
+ *  終わったかは transcoding_ostreambuf::incomplete() で確認する。
+ *--------------------------------------------------------------------*/
+#ifndef ICONV_ALT_ICONV_ALT_STREAM_HPP
+#define ICONV_ALT_ICONV_ALT_STREAM_HPP
+
+#include "iconv_alt.hpp"
+
+#include <cerrno>
+#include <cstddef>
+#include <istream>
+#include <ostream>
+#include <streambuf>
+#include <string>
+#include <system_error>
+#include <vector>
+
+namespace iconv_alt {
+
+namespace detail {
+[[noreturn]] inline void throw_stream_error(int err, std::size_t offset) {
+    throw std::system_error(std::make_error_code(static_cast<std::errc>(err)),
+        "iconv_alt: stream conversion stopped at input offset " + std::to_string(offset));
+}
+}  // namespace detail
+
+/*======================================================================
+ *  1.  入力: 下位 streambuf から読んで変換した結果を返す
+ *====================================================================*/
+class transcoding_istreambuf : public std::streambuf {
+public:
+    transcoding_istreambuf(std::streambuf* source, const char* tocode, const char* fromcode,
+                           std::size_t block_size = ICONV_ALT_BLOCK_SIZE_DEFAULT)
+        : src_(source), conv_(tocode, fromcode),
+          in_(block_size < min_block ? min_block : block_size),
+          out_(block_size < min_block ? min_block : block_size) {}
+
+    transcoding_istreambuf(const transcoding_istreambuf&) = delete;
+    transcoding_istreambuf& operator=(const transcoding_istreambuf&) = delete;
+
+protected:
+    int_type underflow() override {
+        if (gptr() < egptr()) return traits_type::to_int_type(*gptr());
+        if (error_) detail::throw_stream_error(error_, consumed_);   // 変換済みを返し終えた
+
+        for (;;) {
+            /* --- 手持ちの入力を変換 --- */
+            if (in_pos_ < in_end_) {
+                char* ip = in_.data() + in_pos_;
+                std::size_t il = in_end_ - in_pos_;
+                char* op = out_.data();
+                std::size_t ol = out_.size();
+                std::size_t r = ::iconv(conv_.native_handle(), &ip, &il, &op, &ol);
+                int err = errno;
+                std::size_t used = (in_end_ - in_pos_) - il;
+                in_pos_ += used;
+                consumed_ += used;
+                std::size_t produced = out_.size() - ol;
+
+                if (r == static_cast<std::size_t>(-1)) {
+                    if (err == EINVAL) pending_ = true;            // 分断文字: 状態で持ち越し
+                    else if (err == EILSEQ) {                      // 手前までは先に返す
+                        if (produced == 0) detail::throw_stream_error(err, consumed_);
+                        error_ = err;
+                    }
+                    /* E2BIG: 残りは次回 */
+                } else if (used > 0) {
+                    pending_ = false;
+                }
+                if (produced > 0) {
+                    setg(out_.data(), out_.data(), out_.data() + produced);
+                    return traits_type::to_int_type(*gptr());
+                }
+                if (in_pos_ < in_end_) continue;
+            }
+
+            /* --- 次のブロックを読む --- */
+            std::streamsize n = src_->sgetn(in_.data(), static_cast<std::streamsize>(in_.size()));
+            if (n <= 0) {
+                if (pending_) detail::throw_stream_error(EINVAL, consumed_);
+                if (!finished_) {                 // 状態付きの出力を戻す列 (ESC ( B など)
+                    finished_ = true;
+                    char* op = out_.data();
+                    std::size_t ol = out_.size();
+                    ::iconv(conv_.native_handle(), nullptr, nullptr, &op, &ol);
+                    if (ol < out_.size()) {
+                        setg(out_.data(), out_.data(), op);
+                        return traits_type::to_int_type(*gptr());
+                    }
+                }
+                return traits_type::eof();
+            }
+            in_pos_ = 0;
+            in_end_ = static_cast<std::size_t>(n);
+        }
+    }
+
+private:
+    static constexpr std::size_t min_block = 16;   // 1 文字 (最大 4 byte) が必ず入る
+
+    std::streambuf*   src_;
+    converter         conv_;
+    std::vector<char> in_, out_;
+    std::size_t       in_pos_ = 0, in_end_ = 0;
+    std::size_t       consumed_ = 0;     // エラー位置の報告用
+    bool              pending_ = false;  // cd に文字の前半が残っている
+    bool              finished_ = false; // 入力の終わりで出力の状態を戻した
+    int               error_ = 0;        // 変換済みを返した後に投げる errno
+};
+
+/*======================================================================
+ *  2.  出力: 書かれた内容を変換して下位 streambuf へ送る
+ *====================================================================*/
+class transcoding_ostreambuf : public std::streambuf {
+public:
+    transcoding_ostreambuf(std::streambuf* sink, const char* tocode, const char* fromcode,
+                           std::size_t block_size = ICONV_ALT_BLOCK_SIZE_DEFAULT)
+        : dst_(sink), conv_(tocode, fromcode),
+          in_(block_size < min_block ? min_block : block_size),
+          out_(block_size < min_block ? min_block : block_size) {
+        setp(in_.data(), in_.data() + in_.size());
+    }
+
+    transcoding_ostreambuf(const transcoding_ostreambuf&) = delete;
+    transcoding_ostreambuf& operator=(const transcoding_ostreambuf&) = delete;
+
+    /* デストラクタでは例外を投げられないので、エラーを知りたければ先に
+       pubsync() (ostream::flush) を呼ぶこと */
+    ~transcoding_ostreambuf() override {
+        try { finish(); } catch (...) {}
+    }
+
+    /* 書き込み済みを変換し、状態付きの出力 (ISO-2022-JP) を初期状態へ戻す列を
+       書いて締める。続けて書けば初期状態から始まる */
+    bool finish() {
+        if (!drain()) return false;
+        char* op = out_.data();
+        std::size_t ol = out_.size();
+        ::iconv(conv_.native_handle(), nullptr, nullptr, &op, &ol);
+        std::size_t produced = out_.size() - ol;
+        pending_ = false;
+        return produced == 0 ||
+            dst_->sputn(out_.data(), static_cast<std::streamsize>(produced))
+                == static_cast<std::streamsize>(produced);
+    }
+
+    /* 書き込み済みの末尾が文字の途中で止まっている (flush 後に確認する) */
+    bool incomplete() const noexcept { return pending_; }
+
+protected:
+    int_type overflow(int_type ch) override {
+        if (!drain()) return traits_type::eof();
+        if (!traits_type::eq_int_type(ch, traits_type::eof())) {
+            *pptr() = traits_type::to_char_type(ch);
+            pbump(1);
+        }
+        return traits_type::not_eof(ch);
+    }
+
+    /* 大きな書き込みはバッファを経由せず直接変換する */
+    std::streamsize xsputn(const char* s, std::streamsize n) override {
+        if (static_cast<std::size_t>(n) < in_.size())
+            return std::streambuf::xsputn(s, n);
+        if (!drain() || !convert(s, static_cast<std::size_t>(n))) return 0;
+        return n;
+    }
+
+    int sync() override {
+        if (!drain()) return -1;
+        return dst_->pubsync();
+    }
+
+private:
+    /* put 領域の内容を変換して空にする */
+    bool drain() {
+        std::size_t n = static_cast<std::size_t>(pptr() - pbase());
+        setp(in_.data(), in_.data() + in_.size());
+        return convert(in_.data(), n);
+    }
+
+    bool convert(const char* s, std::size_t n) {
+        char* ip = const_cast<char*>(s);
+        std::size_t il = n;
+        while (il > 0) {
+            char* op = out_.data();
+            std::size_t ol = out_.size();
+            std::size_t before = il;
+            std::size_t r = ::iconv(conv_.native_handle(), &ip, &il, &op, &ol);
+            int err = errno;
+            consumed_ += before - il;
+            std::size_t produced = out_.size() - ol;
+            if (produced > 0 &&
+                dst_->sputn(out_.data(), static_cast<std::streamsize>(produced))
+                    != static_cast<std::streamsize>(produced))
+                return false;
+
+            if (r != static_cast<std::size_t>(-1)) { if (before > il) pending_ = false; continue; }
+            if (err == EINVAL) { pending_ = true; break; }   // 続きは次の書き込みで
+            if (err != E2BIG) detail::throw_stream_error(err, consumed_);
+        }
+        return true;
+    }
+
+    static constexpr std::size_t min_block = 16;
+
+    std::streambuf*   dst_;
+    converter         conv_;
+    std::vector<char> in_, out_;
+    std::size_t       consumed_ = 0;
+    bool              pending_ = false;
+};
+
+/*======================================================================
+ *  3.  1 行で差し替えるためのストリーム
+ *====================================================================*/
+class transcoding_istream : public std::istream {
+public:
+    transcoding_istream(std::istream& source, const char* tocode, const char* fromcode)
+        : std::istream(nullptr), buf_(source.rdbuf(), tocode, fromcode) { rdbuf(&buf_); }
+private:
+    transcoding_istreambuf buf_;
+};
+
+class transcoding_ostream : public std::ostream {
+public:
+    transcoding_ostream(std::ostream& sink, const char* tocode, const char* fromcode)
+        : std::ostream(nullptr), buf_(sink.rdbuf(), tocode, fromcode) { rdbuf(&buf_); }
+    ~transcoding_ostream() override {
+        try { buf_.pubsync(); } catch (...) {}
+    }
+private:
+    transcoding_ostreambuf buf_;
+};
+
+}  // namespace iconv_alt
+
+#endif /* ICONV_ALT_ICONV_ALT_STREAM_HPP */
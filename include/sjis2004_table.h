@@ -0,0 +1,6867 @@
+/* Auto‑generated by gen_sjis2004_table.py — DO NOT EDIT */
+#pragma once
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#  define SJ2004_TABLE_CONST inline constexpr
+#else
+#  define SJ2004_TABLE_CONST static const
+#endif
+
+#define SJ2004_NOMAP    0xFFFFFFFFu   /* 順引きの未定義                               */
+#define SJ2004_PAIR     0x00200000u   /* 順引き: これ以上は SJ2004_PAIRS[v - SJ2004_PAIR] */
+#define SJ2004_U_NOMAP  0xFFFF        /* 逆引きの未定義                               */
+#define SJ2004_BASE     0x0100        /* 逆引き: これ以上 0x8100 未満は合成の基底      */
+
+/* lead byte → SJ2004_DB2U の行 (0 = lead ではない) */
+SJ2004_TABLE_CONST uint8_t SJ2004_LEAD2ROW[256] = {
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   1,   2,   3,   4,   5,   6,   7,   8,   9,  10,  11,  12,  13,  14,  15,
+   16,  17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+   32,  33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,
+   48,  49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,   0,   0,   0,
+};
+
+/* 2 byte → Unicode: SJ2004_DB2U[SJ2004_LEAD2ROW[lead]][trail] */
+SJ2004_TABLE_CONST uint32_t SJ2004_DB2U[61][256] = {
+  { /* not a lead byte */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x81 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00003000, 0x00003001, 0x00003002, 0x0000FF0C, 0x0000FF0E, 0x000030FB, 0x0000FF1A, 0x0000FF1B,
+    0x0000FF1F, 0x0000FF01, 0x0000309B, 0x0000309C, 0x000000B4, 0x0000FF40, 0x000000A8, 0x0000FF3E,
+    0x0000FFE3, 0x0000FF3F, 0x000030FD, 0x000030FE, 0x0000309D, 0x0000309E, 0x00003003, 0x00004EDD,
+    0x00003005, 0x00003006, 0x00003007, 0x000030FC, 0x00002015, 0x00002010, 0x0000FF0F, 0x0000005C,
+    0x0000301C, 0x00002016, 0x0000FF5C, 0x00002026, 0x00002025, 0x00002018, 0x00002019, 0x0000201C,
+    0x0000201D, 0x0000FF08, 0x0000FF09, 0x00003014, 0x00003015, 0x0000FF3B, 0x0000FF3D, 0x0000FF5B,
+    0x0000FF5D, 0x00003008, 0x00003009, 0x0000300A, 0x0000300B, 0x0000300C, 0x0000300D, 0x0000300E,
+    0x0000300F, 0x00003010, 0x00003011, 0x0000FF0B, 0x00002212, 0x000000B1, 0x000000D7, 0xFFFFFFFF,
+    0x000000F7, 0x0000FF1D, 0x00002260, 0x0000FF1C, 0x0000FF1E, 0x00002266, 0x00002267, 0x0000221E,
+    0x00002234, 0x00002642, 0x00002640, 0x000000B0, 0x00002032, 0x00002033, 0x00002103, 0x0000FFE5,
+    0x0000FF04, 0x000000A2, 0x000000A3, 0x0000FF05, 0x0000FF03, 0x0000FF06, 0x0000FF0A, 0x0000FF20,
+    0x000000A7, 0x00002606, 0x00002605, 0x000025CB, 0x000025CF, 0x000025CE, 0x000025C7, 0x000025C6,
+    0x000025A1, 0x000025A0, 0x000025B3, 0x000025B2, 0x000025BD, 0x000025BC, 0x0000203B, 0x00003012,
+    0x00002192, 0x00002190, 0x00002191, 0x00002193, 0x00003013, 0x0000FF07, 0x0000FF02, 0x0000FF0D,
+    0x0000007E, 0x00003033, 0x00003034, 0x00003035, 0x0000303B, 0x0000303C, 0x000030FF, 0x0000309F,
+    0x00002208, 0x0000220B, 0x00002286, 0x00002287, 0x00002282, 0x00002283, 0x0000222A, 0x00002229,
+    0x00002284, 0x00002285, 0x0000228A, 0x0000228B, 0x00002209, 0x00002205, 0x00002305, 0x00002306,
+    0x00002227, 0x00002228, 0x000000AC, 0x000021D2, 0x000021D4, 0x00002200, 0x00002203, 0x00002295,
+    0x00002296, 0x00002297, 0x00002225, 0x00002226, 0x00002985, 0x00002986, 0x00003018, 0x00003019,
+    0x00003016, 0x00003017, 0x00002220, 0x000022A5, 0x00002312, 0x00002202, 0x00002207, 0x00002261,
+    0x00002252, 0x0000226A, 0x0000226B, 0x0000221A, 0x0000223D, 0x0000221D, 0x00002235, 0x0000222B,
+    0x0000222C, 0x00002262, 0x00002243, 0x00002245, 0x00002248, 0x00002276, 0x00002277, 0x00002194,
+    0x0000212B, 0x00002030, 0x0000266F, 0x0000266D, 0x0000266A, 0x00002020, 0x00002021, 0x000000B6,
+    0x0000266E, 0x0000266B, 0x0000266C, 0x00002669, 0x000025EF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x82 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000025B7, 0x000025B6, 0x000025C1, 0x000025C0, 0x00002197, 0x00002198, 0x00002196, 0x00002199,
+    0x000021C4, 0x000021E8, 0x000021E6, 0x000021E7, 0x000021E9, 0x00002934, 0x00002935, 0x0000FF10,
+    0x0000FF11, 0x0000FF12, 0x0000FF13, 0x0000FF14, 0x0000FF15, 0x0000FF16, 0x0000FF17, 0x0000FF18,
+    0x0000FF19, 0x000029BF, 0x000025C9, 0x0000303D, 0x0000FE46, 0x0000FE45, 0x000025E6, 0x00002022,
+    0x0000FF21, 0x0000FF22, 0x0000FF23, 0x0000FF24, 0x0000FF25, 0x0000FF26, 0x0000FF27, 0x0000FF28,
+    0x0000FF29, 0x0000FF2A, 0x0000FF2B, 0x0000FF2C, 0x0000FF2D, 0x0000FF2E, 0x0000FF2F, 0x0000FF30,
+    0x0000FF31, 0x0000FF32, 0x0000FF33, 0x0000FF34, 0x0000FF35, 0x0000FF36, 0x0000FF37, 0x0000FF38,
+    0x0000FF39, 0x0000FF3A, 0x00002213, 0x00002135, 0x0000210F, 0x000033CB, 0x00002113, 0xFFFFFFFF,
+    0x00002127, 0x0000FF41, 0x0000FF42, 0x0000FF43, 0x0000FF44, 0x0000FF45, 0x0000FF46, 0x0000FF47,
+    0x0000FF48, 0x0000FF49, 0x0000FF4A, 0x0000FF4B, 0x0000FF4C, 0x0000FF4D, 0x0000FF4E, 0x0000FF4F,
+    0x0000FF50, 0x0000FF51, 0x0000FF52, 0x0000FF53, 0x0000FF54, 0x0000FF55, 0x0000FF56, 0x0000FF57,
+    0x0000FF58, 0x0000FF59, 0x0000FF5A, 0x000030A0, 0x00002013, 0x000029FA, 0x000029FB, 0x00003041,
+    0x00003042, 0x00003043, 0x00003044, 0x00003045, 0x00003046, 0x00003047, 0x00003048, 0x00003049,
+    0x0000304A, 0x0000304B, 0x0000304C, 0x0000304D, 0x0000304E, 0x0000304F, 0x00003050, 0x00003051,
+    0x00003052, 0x00003053, 0x00003054, 0x00003055, 0x00003056, 0x00003057, 0x00003058, 0x00003059,
+    0x0000305A, 0x0000305B, 0x0000305C, 0x0000305D, 0x0000305E, 0x0000305F, 0x00003060, 0x00003061,
+    0x00003062, 0x00003063, 0x00003064, 0x00003065, 0x00003066, 0x00003067, 0x00003068, 0x00003069,
+    0x0000306A, 0x0000306B, 0x0000306C, 0x0000306D, 0x0000306E, 0x0000306F, 0x00003070, 0x00003071,
+    0x00003072, 0x00003073, 0x00003074, 0x00003075, 0x00003076, 0x00003077, 0x00003078, 0x00003079,
+    0x0000307A, 0x0000307B, 0x0000307C, 0x0000307D, 0x0000307E, 0x0000307F, 0x00003080, 0x00003081,
+    0x00003082, 0x00003083, 0x00003084, 0x00003085, 0x00003086, 0x00003087, 0x00003088, 0x00003089,
+    0x0000308A, 0x0000308B, 0x0000308C, 0x0000308D, 0x0000308E, 0x0000308F, 0x00003090, 0x00003091,
+    0x00003092, 0x00003093, 0x00003094, 0x00003095, 0x00003096, 0x00200000, 0x00200001, 0x00200002,
+    0x00200003, 0x00200004, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x83 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000030A1, 0x000030A2, 0x000030A3, 0x000030A4, 0x000030A5, 0x000030A6, 0x000030A7, 0x000030A8,
+    0x000030A9, 0x000030AA, 0x000030AB, 0x000030AC, 0x000030AD, 0x000030AE, 0x000030AF, 0x000030B0,
+    0x000030B1, 0x000030B2, 0x000030B3, 0x000030B4, 0x000030B5, 0x000030B6, 0x000030B7, 0x000030B8,
+    0x000030B9, 0x000030BA, 0x000030BB, 0x000030BC, 0x000030BD, 0x000030BE, 0x000030BF, 0x000030C0,
+    0x000030C1, 0x000030C2, 0x000030C3, 0x000030C4, 0x000030C5, 0x000030C6, 0x000030C7, 0x000030C8,
+    0x000030C9, 0x000030CA, 0x000030CB, 0x000030CC, 0x000030CD, 0x000030CE, 0x000030CF, 0x000030D0,
+    0x000030D1, 0x000030D2, 0x000030D3, 0x000030D4, 0x000030D5, 0x000030D6, 0x000030D7, 0x000030D8,
+    0x000030D9, 0x000030DA, 0x000030DB, 0x000030DC, 0x000030DD, 0x000030DE, 0x000030DF, 0xFFFFFFFF,
+    0x000030E0, 0x000030E1, 0x000030E2, 0x000030E3, 0x000030E4, 0x000030E5, 0x000030E6, 0x000030E7,
+    0x000030E8, 0x000030E9, 0x000030EA, 0x000030EB, 0x000030EC, 0x000030ED, 0x000030EE, 0x000030EF,
+    0x000030F0, 0x000030F1, 0x000030F2, 0x000030F3, 0x000030F4, 0x000030F5, 0x000030F6, 0x00200005,
+    0x00200006, 0x00200007, 0x00200008, 0x00200009, 0x0020000A, 0x0020000B, 0x0020000C, 0x00000391,
+    0x00000392, 0x00000393, 0x00000394, 0x00000395, 0x00000396, 0x00000397, 0x00000398, 0x00000399,
+    0x0000039A, 0x0000039B, 0x0000039C, 0x0000039D, 0x0000039E, 0x0000039F, 0x000003A0, 0x000003A1,
+    0x000003A3, 0x000003A4, 0x000003A5, 0x000003A6, 0x000003A7, 0x000003A8, 0x000003A9, 0x00002664,
+    0x00002660, 0x00002662, 0x00002666, 0x00002661, 0x00002665, 0x00002667, 0x00002663, 0x000003B1,
+    0x000003B2, 0x000003B3, 0x000003B4, 0x000003B5, 0x000003B6, 0x000003B7, 0x000003B8, 0x000003B9,
+    0x000003BA, 0x000003BB, 0x000003BC, 0x000003BD, 0x000003BE, 0x000003BF, 0x000003C0, 0x000003C1,
+    0x000003C3, 0x000003C4, 0x000003C5, 0x000003C6, 0x000003C7, 0x000003C8, 0x000003C9, 0x000003C2,
+    0x000024F5, 0x000024F6, 0x000024F7, 0x000024F8, 0x000024F9, 0x000024FA, 0x000024FB, 0x000024FC,
+    0x000024FD, 0x000024FE, 0x00002616, 0x00002617, 0x00003020, 0x0000260E, 0x00002600, 0x00002601,
+    0x00002602, 0x00002603, 0x00002668, 0x000025B1, 0x000031F0, 0x000031F1, 0x000031F2, 0x000031F3,
+    0x000031F4, 0x000031F5, 0x000031F6, 0x000031F7, 0x000031F8, 0x000031F9, 0x0020000D, 0x000031FA,
+    0x000031FB, 0x000031FC, 0x000031FD, 0x000031FE, 0x000031FF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x84 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00000410, 0x00000411, 0x00000412, 0x00000413, 0x00000414, 0x00000415, 0x00000401, 0x00000416,
+    0x00000417, 0x00000418, 0x00000419, 0x0000041A, 0x0000041B, 0x0000041C, 0x0000041D, 0x0000041E,
+    0x0000041F, 0x00000420, 0x00000421, 0x00000422, 0x00000423, 0x00000424, 0x00000425, 0x00000426,
+    0x00000427, 0x00000428, 0x00000429, 0x0000042A, 0x0000042B, 0x0000042C, 0x0000042D, 0x0000042E,
+    0x0000042F, 0x000023BE, 0x000023BF, 0x000023C0, 0x000023C1, 0x000023C2, 0x000023C3, 0x000023C4,
+    0x000023C5, 0x000023C6, 0x000023C7, 0x000023C8, 0x000023C9, 0x000023CA, 0x000023CB, 0x000023CC,
+    0x00000430, 0x00000431, 0x00000432, 0x00000433, 0x00000434, 0x00000435, 0x00000451, 0x00000436,
+    0x00000437, 0x00000438, 0x00000439, 0x0000043A, 0x0000043B, 0x0000043C, 0x0000043D, 0xFFFFFFFF,
+    0x0000043E, 0x0000043F, 0x00000440, 0x00000441, 0x00000442, 0x00000443, 0x00000444, 0x00000445,
+    0x00000446, 0x00000447, 0x00000448, 0x00000449, 0x0000044A, 0x0000044B, 0x0000044C, 0x0000044D,
+    0x0000044E, 0x0000044F, 0x000030F7, 0x000030F8, 0x000030F9, 0x000030FA, 0x000022DA, 0x000022DB,
+    0x00002153, 0x00002154, 0x00002155, 0x00002713, 0x00002318, 0x00002423, 0x000023CE, 0x00002500,
+    0x00002502, 0x0000250C, 0x00002510, 0x00002518, 0x00002514, 0x0000251C, 0x0000252C, 0x00002524,
+    0x00002534, 0x0000253C, 0x00002501, 0x00002503, 0x0000250F, 0x00002513, 0x0000251B, 0x00002517,
+    0x00002523, 0x00002533, 0x0000252B, 0x0000253B, 0x0000254B, 0x00002520, 0x0000252F, 0x00002528,
+    0x00002537, 0x0000253F, 0x0000251D, 0x00002530, 0x00002525, 0x00002538, 0x00002542, 0x00003251,
+    0x00003252, 0x00003253, 0x00003254, 0x00003255, 0x00003256, 0x00003257, 0x00003258, 0x00003259,
+    0x0000325A, 0x0000325B, 0x0000325C, 0x0000325D, 0x0000325E, 0x0000325F, 0x000032B1, 0x000032B2,
+    0x000032B3, 0x000032B4, 0x000032B5, 0x000032B6, 0x000032B7, 0x000032B8, 0x000032B9, 0x000032BA,
+    0x000032BB, 0x000032BC, 0x000032BD, 0x000032BE, 0x000032BF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x000025D0, 0x000025D1, 0x000025D2,
+    0x000025D3, 0x0000203C, 0x00002047, 0x00002048, 0x00002049, 0x000001CD, 0x000001CE, 0x000001D0,
+    0x00001E3E, 0x00001E3F, 0x000001F8, 0x000001F9, 0x000001D1, 0x000001D2, 0x000001D4, 0x000001D6,
+    0x000001D8, 0x000001DA, 0x000001DC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x85 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000020AC, 0x000000A0, 0x000000A1, 0x000000A4, 0x000000A6, 0x000000A9, 0x000000AA, 0x000000AB,
+    0x000000AD, 0x000000AE, 0x000000AF, 0x000000B2, 0x000000B3, 0x000000B7, 0x000000B8, 0x000000B9,
+    0x000000BA, 0x000000BB, 0x000000BC, 0x000000BD, 0x000000BE, 0x000000BF, 0x000000C0, 0x000000C1,
+    0x000000C2, 0x000000C3, 0x000000C4, 0x000000C5, 0x000000C6, 0x000000C7, 0x000000C8, 0x000000C9,
+    0x000000CA, 0x000000CB, 0x000000CC, 0x000000CD, 0x000000CE, 0x000000CF, 0x000000D0, 0x000000D1,
+    0x000000D2, 0x000000D3, 0x000000D4, 0x000000D5, 0x000000D6, 0x000000D8, 0x000000D9, 0x000000DA,
+    0x000000DB, 0x000000DC, 0x000000DD, 0x000000DE, 0x000000DF, 0x000000E0, 0x000000E1, 0x000000E2,
+    0x000000E3, 0x000000E4, 0x000000E5, 0x000000E6, 0x000000E7, 0x000000E8, 0x000000E9, 0xFFFFFFFF,
+    0x000000EA, 0x000000EB, 0x000000EC, 0x000000ED, 0x000000EE, 0x000000EF, 0x000000F0, 0x000000F1,
+    0x000000F2, 0x000000F3, 0x000000F4, 0x000000F5, 0x000000F6, 0x000000F8, 0x000000F9, 0x000000FA,
+    0x000000FB, 0x000000FC, 0x000000FD, 0x000000FE, 0x000000FF, 0x00000100, 0x0000012A, 0x0000016A,
+    0x00000112, 0x0000014C, 0x00000101, 0x0000012B, 0x0000016B, 0x00000113, 0x0000014D, 0x00000104,
+    0x000002D8, 0x00000141, 0x0000013D, 0x0000015A, 0x00000160, 0x0000015E, 0x00000164, 0x00000179,
+    0x0000017D, 0x0000017B, 0x00000105, 0x000002DB, 0x00000142, 0x0000013E, 0x0000015B, 0x000002C7,
+    0x00000161, 0x0000015F, 0x00000165, 0x0000017A, 0x000002DD, 0x0000017E, 0x0000017C, 0x00000154,
+    0x00000102, 0x00000139, 0x00000106, 0x0000010C, 0x00000118, 0x0000011A, 0x0000010E, 0x00000143,
+    0x00000147, 0x00000150, 0x00000158, 0x0000016E, 0x00000170, 0x00000162, 0x00000155, 0x00000103,
+    0x0000013A, 0x00000107, 0x0000010D, 0x00000119, 0x0000011B, 0x0000010F, 0x00000111, 0x00000144,
+    0x00000148, 0x00000151, 0x00000159, 0x0000016F, 0x00000171, 0x00000163, 0x000002D9, 0x00000108,
+    0x0000011C, 0x00000124, 0x00000134, 0x0000015C, 0x0000016C, 0x00000109, 0x0000011D, 0x00000125,
+    0x00000135, 0x0000015D, 0x0000016D, 0x00000271, 0x0000028B, 0x0000027E, 0x00000283, 0x00000292,
+    0x0000026C, 0x0000026E, 0x00000279, 0x00000288, 0x00000256, 0x00000273, 0x0000027D, 0x00000282,
+    0x00000290, 0x0000027B, 0x0000026D, 0x0000025F, 0x00000272, 0x0000029D, 0x0000028E, 0x00000261,
+    0x0000014B, 0x00000270, 0x00000281, 0x00000127, 0x00000295, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x86 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00000294, 0x00000266, 0x00000298, 0x000001C2, 0x00000253, 0x00000257, 0x00000284, 0x00000260,
+    0x00000193, 0x00000153, 0x00000152, 0x00000268, 0x00000289, 0x00000258, 0x00000275, 0x00000259,
+    0x0000025C, 0x0000025E, 0x00000250, 0x0000026F, 0x0000028A, 0x00000264, 0x0000028C, 0x00000254,
+    0x00000251, 0x00000252, 0x0000028D, 0x00000265, 0x000002A2, 0x000002A1, 0x00000255, 0x00000291,
+    0x0000027A, 0x00000267, 0x0000025A, 0x0020000E, 0x000001FD, 0x00001F70, 0x00001F71, 0x0020000F,
+    0x00200010, 0x00200011, 0x00200012, 0x00200013, 0x00200014, 0x00200015, 0x00200016, 0x00001F72,
+    0x00001F73, 0x00000361, 0x000002C8, 0x000002CC, 0x000002D0, 0x000002D1, 0x00000306, 0x0000203F,
+    0x0000030B, 0x00000301, 0x00000304, 0x00000300, 0x0000030F, 0x0000030C, 0x00000302, 0xFFFFFFFF,
+    0x000002E5, 0x000002E6, 0x000002E7, 0x000002E8, 0x000002E9, 0x00200017, 0x00200018, 0x00000325,
+    0x0000032C, 0x00000339, 0x0000031C, 0x0000031F, 0x00000320, 0x00000308, 0x0000033D, 0x00000329,
+    0x0000032F, 0x000002DE, 0x00000324, 0x00000330, 0x0000033C, 0x00000334, 0x0000031D, 0x0000031E,
+    0x00000318, 0x00000319, 0x0000032A, 0x0000033A, 0x0000033B, 0x00000303, 0x0000031A, 0x00002776,
+    0x00002777, 0x00002778, 0x00002779, 0x0000277A, 0x0000277B, 0x0000277C, 0x0000277D, 0x0000277E,
+    0x0000277F, 0x000024EB, 0x000024EC, 0x000024ED, 0x000024EE, 0x000024EF, 0x000024F0, 0x000024F1,
+    0x000024F2, 0x000024F3, 0x000024F4, 0x00002170, 0x00002171, 0x00002172, 0x00002173, 0x00002174,
+    0x00002175, 0x00002176, 0x00002177, 0x00002178, 0x00002179, 0x0000217A, 0x0000217B, 0x000024D0,
+    0x000024D1, 0x000024D2, 0x000024D3, 0x000024D4, 0x000024D5, 0x000024D6, 0x000024D7, 0x000024D8,
+    0x000024D9, 0x000024DA, 0x000024DB, 0x000024DC, 0x000024DD, 0x000024DE, 0x000024DF, 0x000024E0,
+    0x000024E1, 0x000024E2, 0x000024E3, 0x000024E4, 0x000024E5, 0x000024E6, 0x000024E7, 0x000024E8,
+    0x000024E9, 0x000032D0, 0x000032D1, 0x000032D2, 0x000032D3, 0x000032D4, 0x000032D5, 0x000032D6,
+    0x000032D7, 0x000032D8, 0x000032D9, 0x000032DA, 0x000032DB, 0x000032DC, 0x000032DD, 0x000032DE,
+    0x000032DF, 0x000032E0, 0x000032E1, 0x000032E2, 0x000032E3, 0x000032FA, 0x000032E9, 0x000032E5,
+    0x000032ED, 0x000032EC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00002051, 0x00002042, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x87 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00002460, 0x00002461, 0x00002462, 0x00002463, 0x00002464, 0x00002465, 0x00002466, 0x00002467,
+    0x00002468, 0x00002469, 0x0000246A, 0x0000246B, 0x0000246C, 0x0000246D, 0x0000246E, 0x0000246F,
+    0x00002470, 0x00002471, 0x00002472, 0x00002473, 0x00002160, 0x00002161, 0x00002162, 0x00002163,
+    0x00002164, 0x00002165, 0x00002166, 0x00002167, 0x00002168, 0x00002169, 0x0000216A, 0x00003349,
+    0x00003314, 0x00003322, 0x0000334D, 0x00003318, 0x00003327, 0x00003303, 0x00003336, 0x00003351,
+    0x00003357, 0x0000330D, 0x00003326, 0x00003323, 0x0000332B, 0x0000334A, 0x0000333B, 0x0000339C,
+    0x0000339D, 0x0000339E, 0x0000338E, 0x0000338F, 0x000033C4, 0x000033A1, 0x0000216B, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000337B, 0xFFFFFFFF,
+    0x0000301D, 0x0000301F, 0x00002116, 0x000033CD, 0x00002121, 0x000032A4, 0x000032A5, 0x000032A6,
+    0x000032A7, 0x000032A8, 0x00003231, 0x00003232, 0x00003239, 0x0000337E, 0x0000337D, 0x0000337C,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x0000222E, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000221F, 0x000022BF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0x00002756, 0x0000261E, 0x00004FF1,
+    0x0002000B, 0x00003402, 0x00004E28, 0x00004E2F, 0x00004E30, 0x00004E8D, 0x00004EE1, 0x00004EFD,
+    0x00004EFF, 0x00004F03, 0x00004F0B, 0x00004F60, 0x00004F48, 0x00004F49, 0x00004F56, 0x00004F5F,
+    0x00004F6A, 0x00004F6C, 0x00004F7E, 0x00004F8A, 0x00004F94, 0x00004F97, 0x0000FA30, 0x00004FC9,
+    0x00004FE0, 0x00005001, 0x00005002, 0x0000500E, 0x00005018, 0x00005027, 0x0000502E, 0x00005040,
+    0x0000503B, 0x00005041, 0x00005094, 0x000050CC, 0x000050F2, 0x000050D0, 0x000050E6, 0x0000FA31,
+    0x00005106, 0x00005103, 0x0000510B, 0x0000511E, 0x00005135, 0x0000514A, 0x0000FA32, 0x00005155,
+    0x00005157, 0x000034B5, 0x0000519D, 0x000051C3, 0x000051CA, 0x000051DE, 0x000051E2, 0x000051EE,
+    0x00005201, 0x000034DB, 0x00005213, 0x00005215, 0x00005249, 0x00005257, 0x00005261, 0x00005293,
+    0x000052C8, 0x0000FA33, 0x000052CC, 0x000052D0, 0x000052D6, 0x000052DB, 0x0000FA34, 0x000052F0,
+    0x000052FB, 0x00005300, 0x00005307, 0x0000531C, 0x0000FA35, 0x00005361, 0x00005363, 0x0000537D,
+    0x00005393, 0x0000539D, 0x000053B2, 0x00005412, 0x00005427, 0x0000544D, 0x0000549C, 0x0000546B,
+    0x00005474, 0x0000547F, 0x00005488, 0x00005496, 0x000054A1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x88 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000054A9, 0x000054C6, 0x000054FF, 0x0000550E, 0x0000552B, 0x00005535, 0x00005550, 0x0000555E,
+    0x00005581, 0x00005586, 0x0000558E, 0x0000FA36, 0x000055AD, 0x000055CE, 0x0000FA37, 0x00005608,
+    0x0000560E, 0x0000563B, 0x00005649, 0x00005676, 0x00005666, 0x0000FA38, 0x0000566F, 0x00005671,
+    0x00005672, 0x00005699, 0x0000569E, 0x000056A9, 0x000056AC, 0x000056B3, 0x000056C9, 0x000056CA,
+    0x0000570A, 0x0002123D, 0x00005721, 0x0000572F, 0x00005733, 0x00005734, 0x00005770, 0x00005777,
+    0x0000577C, 0x0000579C, 0x0000FA0F, 0x0002131B, 0x000057B8, 0x000057C7, 0x000057C8, 0x000057CF,
+    0x000057E4, 0x000057ED, 0x000057F5, 0x000057F6, 0x000057FF, 0x00005809, 0x0000FA10, 0x00005861,
+    0x00005864, 0x0000FA39, 0x0000587C, 0x00005889, 0x0000589E, 0x0000FA3A, 0x000058A9, 0xFFFFFFFF,
+    0x0002146E, 0x000058D2, 0x000058CE, 0x000058D4, 0x000058DA, 0x000058E0, 0x000058E9, 0x0000590C,
+    0x00008641, 0x0000595D, 0x0000596D, 0x0000598B, 0x00005992, 0x000059A4, 0x000059C3, 0x000059D2,
+    0x000059DD, 0x00005A13, 0x00005A23, 0x00005A67, 0x00005A6D, 0x00005A77, 0x00005A7E, 0x00005A84,
+    0x00005A9E, 0x00005AA7, 0x00005AC4, 0x000218BD, 0x00005B19, 0x00005B25, 0x0000525D, 0x00004E9C,
+    0x00005516, 0x00005A03, 0x0000963F, 0x000054C0, 0x0000611B, 0x00006328, 0x000059F6, 0x00009022,
+    0x00008475, 0x0000831C, 0x00007A50, 0x000060AA, 0x000063E1, 0x00006E25, 0x000065ED, 0x00008466,
+    0x000082A6, 0x00009BF5, 0x00006893, 0x00005727, 0x000065A1, 0x00006271, 0x00005B9B, 0x000059D0,
+    0x0000867B, 0x000098F4, 0x00007D62, 0x00007DBE, 0x00009B8E, 0x00006216, 0x00007C9F, 0x000088B7,
+    0x00005B89, 0x00005EB5, 0x00006309, 0x00006697, 0x00006848, 0x000095C7, 0x0000978D, 0x0000674F,
+    0x00004EE5, 0x00004F0A, 0x00004F4D, 0x00004F9D, 0x00005049, 0x000056F2, 0x00005937, 0x000059D4,
+    0x00005A01, 0x00005C09, 0x000060DF, 0x0000610F, 0x00006170, 0x00006613, 0x00006905, 0x000070BA,
+    0x0000754F, 0x00007570, 0x000079FB, 0x00007DAD, 0x00007DEF, 0x000080C3, 0x0000840E, 0x00008863,
+    0x00008B02, 0x00009055, 0x0000907A, 0x0000533B, 0x00004E95, 0x00004EA5, 0x000057DF, 0x000080B2,
+    0x000090C1, 0x000078EF, 0x00004E00, 0x000058F1, 0x00006EA2, 0x00009038, 0x00007A32, 0x00008328,
+    0x0000828B, 0x00009C2F, 0x00005141, 0x00005370, 0x000054BD, 0x000054E1, 0x000056E0, 0x000059FB,
+    0x00005F15, 0x000098F2, 0x00006DEB, 0x000080E4, 0x0000852D, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x89 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00009662, 0x00009670, 0x000096A0, 0x000097FB, 0x0000540B, 0x000053F3, 0x00005B87, 0x000070CF,
+    0x00007FBD, 0x00008FC2, 0x000096E8, 0x0000536F, 0x00009D5C, 0x00007ABA, 0x00004E11, 0x00007893,
+    0x000081FC, 0x00006E26, 0x00005618, 0x00005504, 0x00006B1D, 0x0000851A, 0x00009C3B, 0x000059E5,
+    0x000053A9, 0x00006D66, 0x000074DC, 0x0000958F, 0x00005642, 0x00004E91, 0x0000904B, 0x000096F2,
+    0x0000834F, 0x0000990C, 0x000053E1, 0x000055B6, 0x00005B30, 0x00005F71, 0x00006620, 0x000066F3,
+    0x00006804, 0x00006C38, 0x00006CF3, 0x00006D29, 0x0000745B, 0x000076C8, 0x00007A4E, 0x00009834,
+    0x000082F1, 0x0000885B, 0x00008A60, 0x000092ED, 0x00006DB2, 0x000075AB, 0x000076CA, 0x000099C5,
+    0x000060A6, 0x00008B01, 0x00008D8A, 0x000095B2, 0x0000698E, 0x000053AD, 0x00005186, 0xFFFFFFFF,
+    0x00005712, 0x00005830, 0x00005944, 0x00005BB4, 0x00005EF6, 0x00006028, 0x000063A9, 0x000063F4,
+    0x00006CBF, 0x00006F14, 0x0000708E, 0x00007114, 0x00007159, 0x000071D5, 0x0000733F, 0x00007E01,
+    0x00008276, 0x000082D1, 0x00008597, 0x00009060, 0x0000925B, 0x00009D1B, 0x00005869, 0x000065BC,
+    0x00006C5A, 0x00007525, 0x000051F9, 0x0000592E, 0x00005965, 0x00005F80, 0x00005FDC, 0x000062BC,
+    0x000065FA, 0x00006A2A, 0x00006B27, 0x00006BB4, 0x0000738B, 0x00007FC1, 0x00008956, 0x00009D2C,
+    0x00009D0E, 0x00009EC4, 0x00005CA1, 0x00006C96, 0x0000837B, 0x00005104, 0x00005C4B, 0x000061B6,
+    0x000081C6, 0x00006876, 0x00007261, 0x00004E59, 0x00004FFA, 0x00005378, 0x00006069, 0x00006E29,
+    0x00007A4F, 0x000097F3, 0x00004E0B, 0x00005316, 0x00004EEE, 0x00004F55, 0x00004F3D, 0x00004FA1,
+    0x00004F73, 0x000052A0, 0x000053EF, 0x00005609, 0x0000590F, 0x00005AC1, 0x00005BB6, 0x00005BE1,
+    0x000079D1, 0x00006687, 0x0000679C, 0x000067B6, 0x00006B4C, 0x00006CB3, 0x0000706B, 0x000073C2,
+    0x0000798D, 0x000079BE, 0x00007A3C, 0x00007B87, 0x000082B1, 0x000082DB, 0x00008304, 0x00008377,
+    0x000083EF, 0x000083D3, 0x00008766, 0x00008AB2, 0x00005629, 0x00008CA8, 0x00008FE6, 0x0000904E,
+    0x0000971E, 0x0000868A, 0x00004FC4, 0x00005CE8, 0x00006211, 0x00007259, 0x0000753B, 0x000081E5,
+    0x000082BD, 0x000086FE, 0x00008CC0, 0x000096C5, 0x00009913, 0x000099D5, 0x00004ECB, 0x00004F1A,
+    0x000089E3, 0x000056DE, 0x0000584A, 0x000058CA, 0x00005EFB, 0x00005FEB, 0x0000602A, 0x00006094,
+    0x00006062, 0x000061D0, 0x00006212, 0x000062D0, 0x00006539, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x8A */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00009B41, 0x00006666, 0x000068B0, 0x00006D77, 0x00007070, 0x0000754C, 0x00007686, 0x00007D75,
+    0x000082A5, 0x000087F9, 0x0000958B, 0x0000968E, 0x00008C9D, 0x000051F1, 0x000052BE, 0x00005916,
+    0x000054B3, 0x00005BB3, 0x00005D16, 0x00006168, 0x00006982, 0x00006DAF, 0x0000788D, 0x000084CB,
+    0x00008857, 0x00008A72, 0x000093A7, 0x00009AB8, 0x00006D6C, 0x000099A8, 0x000086D9, 0x000057A3,
+    0x000067FF, 0x000086CE, 0x0000920E, 0x00005283, 0x00005687, 0x00005404, 0x00005ED3, 0x000062E1,
+    0x000064B9, 0x0000683C, 0x00006838, 0x00006BBB, 0x00007372, 0x000078BA, 0x00007A6B, 0x0000899A,
+    0x000089D2, 0x00008D6B, 0x00008F03, 0x000090ED, 0x000095A3, 0x00009694, 0x00009769, 0x00005B66,
+    0x00005CB3, 0x0000697D, 0x0000984D, 0x0000984E, 0x0000639B, 0x00007B20, 0x00006A2B, 0xFFFFFFFF,
+    0x00006A7F, 0x000068B6, 0x00009C0D, 0x00006F5F, 0x00005272, 0x0000559D, 0x00006070, 0x000062EC,
+    0x00006D3B, 0x00006E07, 0x00006ED1, 0x0000845B, 0x00008910, 0x00008F44, 0x00004E14, 0x00009C39,
+    0x000053F6, 0x0000691B, 0x00006A3A, 0x00009784, 0x0000682A, 0x0000515C, 0x00007AC3, 0x000084B2,
+    0x000091DC, 0x0000938C, 0x0000565B, 0x00009D28, 0x00006822, 0x00008305, 0x00008431, 0x00007CA5,
+    0x00005208, 0x000082C5, 0x000074E6, 0x00004E7E, 0x00004F83, 0x000051A0, 0x00005BD2, 0x0000520A,
+    0x000052D8, 0x000052E7, 0x00005DFB, 0x0000559A, 0x0000582A, 0x000059E6, 0x00005B8C, 0x00005B98,
+    0x00005BDB, 0x00005E72, 0x00005E79, 0x000060A3, 0x0000611F, 0x00006163, 0x000061BE, 0x000063DB,
+    0x00006562, 0x000067D1, 0x00006853, 0x000068FA, 0x00006B3E, 0x00006B53, 0x00006C57, 0x00006F22,
+    0x00006F97, 0x00006F45, 0x000074B0, 0x00007518, 0x000076E3, 0x0000770B, 0x00007AFF, 0x00007BA1,
+    0x00007C21, 0x00007DE9, 0x00007F36, 0x00007FF0, 0x0000809D, 0x00008266, 0x0000839E, 0x000089B3,
+    0x00008ACC, 0x00008CAB, 0x00009084, 0x00009451, 0x00009593, 0x00009591, 0x000095A2, 0x00009665,
+    0x000097D3, 0x00009928, 0x00008218, 0x00004E38, 0x0000542B, 0x00005CB8, 0x00005DCC, 0x000073A9,
+    0x0000764C, 0x0000773C, 0x00005CA9, 0x00007FEB, 0x00008D0B, 0x000096C1, 0x00009811, 0x00009854,
+    0x00009858, 0x00004F01, 0x00004F0E, 0x00005371, 0x0000559C, 0x00005668, 0x000057FA, 0x00005947,
+    0x00005B09, 0x00005BC4, 0x00005C90, 0x00005E0C, 0x00005E7E, 0x00005FCC, 0x000063EE, 0x0000673A,
+    0x000065D7, 0x000065E2, 0x0000671F, 0x000068CB, 0x000068C4, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x8B */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00006A5F, 0x00005E30, 0x00006BC5, 0x00006C17, 0x00006C7D, 0x0000757F, 0x00007948, 0x00005B63,
+    0x00007A00, 0x00007D00, 0x00005FBD, 0x0000898F, 0x00008A18, 0x00008CB4, 0x00008D77, 0x00008ECC,
+    0x00008F1D, 0x000098E2, 0x00009A0E, 0x00009B3C, 0x00004E80, 0x0000507D, 0x00005100, 0x00005993,
+    0x00005B9C, 0x0000622F, 0x00006280, 0x000064EC, 0x00006B3A, 0x000072A0, 0x00007591, 0x00007947,
+    0x00007FA9, 0x000087FB, 0x00008ABC, 0x00008B70, 0x000063AC, 0x000083CA, 0x000097A0, 0x00005409,
+    0x00005403, 0x000055AB, 0x00006854, 0x00006A58, 0x00008A70, 0x00007827, 0x00006775, 0x00009ECD,
+    0x00005374, 0x00005BA2, 0x0000811A, 0x00008650, 0x00009006, 0x00004E18, 0x00004E45, 0x00004EC7,
+    0x00004F11, 0x000053CA, 0x00005438, 0x00005BAE, 0x00005F13, 0x00006025, 0x00006551, 0xFFFFFFFF,
+    0x0000673D, 0x00006C42, 0x00006C72, 0x00006CE3, 0x00007078, 0x00007403, 0x00007A76, 0x00007AAE,
+    0x00007B08, 0x00007D1A, 0x00007CFE, 0x00007D66, 0x000065E7, 0x0000725B, 0x000053BB, 0x00005C45,
+    0x00005DE8, 0x000062D2, 0x000062E0, 0x00006319, 0x00006E20, 0x0000865A, 0x00008A31, 0x00008DDD,
+    0x000092F8, 0x00006F01, 0x000079A6, 0x00009B5A, 0x00004EA8, 0x00004EAB, 0x00004EAC, 0x00004F9B,
+    0x00004FA0, 0x000050D1, 0x00005147, 0x00007AF6, 0x00005171, 0x000051F6, 0x00005354, 0x00005321,
+    0x0000537F, 0x000053EB, 0x000055AC, 0x00005883, 0x00005CE1, 0x00005F37, 0x00005F4A, 0x0000602F,
+    0x00006050, 0x0000606D, 0x0000631F, 0x00006559, 0x00006A4B, 0x00006CC1, 0x000072C2, 0x000072ED,
+    0x000077EF, 0x000080F8, 0x00008105, 0x00008208, 0x0000854E, 0x000090F7, 0x000093E1, 0x000097FF,
+    0x00009957, 0x00009A5A, 0x00004EF0, 0x000051DD, 0x00005C2D, 0x00006681, 0x0000696D, 0x00005C40,
+    0x000066F2, 0x00006975, 0x00007389, 0x00006850, 0x00007C81, 0x000050C5, 0x000052E4, 0x00005747,
+    0x00005DFE, 0x00009326, 0x000065A4, 0x00006B23, 0x00006B3D, 0x00007434, 0x00007981, 0x000079BD,
+    0x00007B4B, 0x00007DCA, 0x000082B9, 0x000083CC, 0x0000887F, 0x0000895F, 0x00008B39, 0x00008FD1,
+    0x000091D1, 0x0000541F, 0x00009280, 0x00004E5D, 0x00005036, 0x000053E5, 0x0000533A, 0x000072D7,
+    0x00007396, 0x000077E9, 0x000082E6, 0x00008EAF, 0x000099C6, 0x000099C8, 0x000099D2, 0x00005177,
+    0x0000611A, 0x0000865E, 0x000055B0, 0x00007A7A, 0x00005076, 0x00005BD3, 0x00009047, 0x00009685,
+    0x00004E32, 0x00006ADB, 0x000091E7, 0x00005C51, 0x00005C48, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x8C */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00006398, 0x00007A9F, 0x00006C93, 0x00009774, 0x00008F61, 0x00007AAA, 0x0000718A, 0x00009688,
+    0x00007C82, 0x00006817, 0x00007E70, 0x00006851, 0x0000936C, 0x000052F2, 0x0000541B, 0x000085AB,
+    0x00008A13, 0x00007FA4, 0x00008ECD, 0x000090E1, 0x00005366, 0x00008888, 0x00007941, 0x00004FC2,
+    0x000050BE, 0x00005211, 0x00005144, 0x00005553, 0x0000572D, 0x000073EA, 0x0000578B, 0x00005951,
+    0x00005F62, 0x00005F84, 0x00006075, 0x00006176, 0x00006167, 0x000061A9, 0x000063B2, 0x0000643A,
+    0x0000656C, 0x0000666F, 0x00006842, 0x00006E13, 0x00007566, 0x00007A3D, 0x00007CFB, 0x00007D4C,
+    0x00007D99, 0x00007E4B, 0x00007F6B, 0x0000830E, 0x0000834A, 0x000086CD, 0x00008A08, 0x00008A63,
+    0x00008B66, 0x00008EFD, 0x0000981A, 0x00009D8F, 0x000082B8, 0x00008FCE, 0x00009BE8, 0xFFFFFFFF,
+    0x00005287, 0x0000621F, 0x00006483, 0x00006FC0, 0x00009699, 0x00006841, 0x00005091, 0x00006B20,
+    0x00006C7A, 0x00006F54, 0x00007A74, 0x00007D50, 0x00008840, 0x00008A23, 0x00006708, 0x00004EF6,
+    0x00005039, 0x00005026, 0x00005065, 0x0000517C, 0x00005238, 0x00005263, 0x000055A7, 0x0000570F,
+    0x00005805, 0x00005ACC, 0x00005EFA, 0x000061B2, 0x000061F8, 0x000062F3, 0x00006372, 0x0000691C,
+    0x00006A29, 0x0000727D, 0x000072AC, 0x0000732E, 0x00007814, 0x0000786F, 0x00007D79, 0x0000770C,
+    0x000080A9, 0x0000898B, 0x00008B19, 0x00008CE2, 0x00008ED2, 0x00009063, 0x00009375, 0x0000967A,
+    0x00009855, 0x00009A13, 0x00009E78, 0x00005143, 0x0000539F, 0x000053B3, 0x00005E7B, 0x00005F26,
+    0x00006E1B, 0x00006E90, 0x00007384, 0x000073FE, 0x00007D43, 0x00008237, 0x00008A00, 0x00008AFA,
+    0x00009650, 0x00004E4E, 0x0000500B, 0x000053E4, 0x0000547C, 0x000056FA, 0x000059D1, 0x00005B64,
+    0x00005DF1, 0x00005EAB, 0x00005F27, 0x00006238, 0x00006545, 0x000067AF, 0x00006E56, 0x000072D0,
+    0x00007CCA, 0x000088B4, 0x000080A1, 0x000080E1, 0x000083F0, 0x0000864E, 0x00008A87, 0x00008DE8,
+    0x00009237, 0x000096C7, 0x00009867, 0x00009F13, 0x00004E94, 0x00004E92, 0x00004F0D, 0x00005348,
+    0x00005449, 0x0000543E, 0x00005A2F, 0x00005F8C, 0x00005FA1, 0x0000609F, 0x000068A7, 0x00006A8E,
+    0x0000745A, 0x00007881, 0x00008A9E, 0x00008AA4, 0x00008B77, 0x00009190, 0x00004E5E, 0x00009BC9,
+    0x00004EA4, 0x00004F7C, 0x00004FAF, 0x00005019, 0x00005016, 0x00005149, 0x0000516C, 0x0000529F,
+    0x000052B9, 0x000052FE, 0x0000539A, 0x000053E3, 0x00005411, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x8D */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000540E, 0x00005589, 0x00005751, 0x000057A2, 0x0000597D, 0x00005B54, 0x00005B5D, 0x00005B8F,
+    0x00005DE5, 0x00005DE7, 0x00005DF7, 0x00005E78, 0x00005E83, 0x00005E9A, 0x00005EB7, 0x00005F18,
+    0x00006052, 0x0000614C, 0x00006297, 0x000062D8, 0x000063A7, 0x0000653B, 0x00006602, 0x00006643,
+    0x000066F4, 0x0000676D, 0x00006821, 0x00006897, 0x000069CB, 0x00006C5F, 0x00006D2A, 0x00006D69,
+    0x00006E2F, 0x00006E9D, 0x00007532, 0x00007687, 0x0000786C, 0x00007A3F, 0x00007CE0, 0x00007D05,
+    0x00007D18, 0x00007D5E, 0x00007DB1, 0x00008015, 0x00008003, 0x000080AF, 0x000080B1, 0x00008154,
+    0x0000818F, 0x0000822A, 0x00008352, 0x0000884C, 0x00008861, 0x00008B1B, 0x00008CA2, 0x00008CFC,
+    0x000090CA, 0x00009175, 0x00009271, 0x0000783F, 0x000092FC, 0x000095A4, 0x0000964D, 0xFFFFFFFF,
+    0x00009805, 0x00009999, 0x00009AD8, 0x00009D3B, 0x0000525B, 0x000052AB, 0x000053F7, 0x00005408,
+    0x000058D5, 0x000062F7, 0x00006FE0, 0x00008C6A, 0x00008F5F, 0x00009EB9, 0x0000514B, 0x0000523B,
+    0x0000544A, 0x000056FD, 0x00007A40, 0x00009177, 0x00009D60, 0x00009ED2, 0x00007344, 0x00006F09,
+    0x00008170, 0x00007511, 0x00005FFD, 0x000060DA, 0x00009AA8, 0x000072DB, 0x00008FBC, 0x00006B64,
+    0x00009803, 0x00004ECA, 0x000056F0, 0x00005764, 0x000058BE, 0x00005A5A, 0x00006068, 0x000061C7,
+    0x0000660F, 0x00006606, 0x00006839, 0x000068B1, 0x00006DF7, 0x000075D5, 0x00007D3A, 0x0000826E,
+    0x00009B42, 0x00004E9B, 0x00004F50, 0x000053C9, 0x00005506, 0x00005D6F, 0x00005DE6, 0x00005DEE,
+    0x000067FB, 0x00006C99, 0x00007473, 0x00007802, 0x00008A50, 0x00009396, 0x000088DF, 0x00005750,
+    0x00005EA7, 0x0000632B, 0x000050B5, 0x000050AC, 0x0000518D, 0x00006700, 0x000054C9, 0x0000585E,
+    0x000059BB, 0x00005BB0, 0x00005F69, 0x0000624D, 0x000063A1, 0x0000683D, 0x00006B73, 0x00006E08,
+    0x0000707D, 0x000091C7, 0x00007280, 0x00007815, 0x00007826, 0x0000796D, 0x0000658E, 0x00007D30,
+    0x000083DC, 0x000088C1, 0x00008F09, 0x0000969B, 0x00005264, 0x00005728, 0x00006750, 0x00007F6A,
+    0x00008CA1, 0x000051B4, 0x00005742, 0x0000962A, 0x0000583A, 0x0000698A, 0x000080B4, 0x000054B2,
+    0x00005D0E, 0x000057FC, 0x00007895, 0x00009DFA, 0x00004F5C, 0x0000524A, 0x0000548B, 0x0000643E,
+    0x00006628, 0x00006714, 0x000067F5, 0x00007A84, 0x00007B56, 0x00007D22, 0x0000932F, 0x0000685C,
+    0x00009BAD, 0x00007B39, 0x00005319, 0x0000518A, 0x00005237, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x8E */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00005BDF, 0x000062F6, 0x000064AE, 0x000064E6, 0x0000672D, 0x00006BBA, 0x000085A9, 0x000096D1,
+    0x00007690, 0x00009BD6, 0x0000634C, 0x00009306, 0x00009BAB, 0x000076BF, 0x00006652, 0x00004E09,
+    0x00005098, 0x000053C2, 0x00005C71, 0x000060E8, 0x00006492, 0x00006563, 0x0000685F, 0x000071E6,
+    0x000073CA, 0x00007523, 0x00007B97, 0x00007E82, 0x00008695, 0x00008B83, 0x00008CDB, 0x00009178,
+    0x00009910, 0x000065AC, 0x000066AB, 0x00006B8B, 0x00004ED5, 0x00004ED4, 0x00004F3A, 0x00004F7F,
+    0x0000523A, 0x000053F8, 0x000053F2, 0x000055E3, 0x000056DB, 0x000058EB, 0x000059CB, 0x000059C9,
+    0x000059FF, 0x00005B50, 0x00005C4D, 0x00005E02, 0x00005E2B, 0x00005FD7, 0x0000601D, 0x00006307,
+    0x0000652F, 0x00005B5C, 0x000065AF, 0x000065BD, 0x000065E8, 0x0000679D, 0x00006B62, 0xFFFFFFFF,
+    0x00006B7B, 0x00006C0F, 0x00007345, 0x00007949, 0x000079C1, 0x00007CF8, 0x00007D19, 0x00007D2B,
+    0x000080A2, 0x00008102, 0x000081F3, 0x00008996, 0x00008A5E, 0x00008A69, 0x00008A66, 0x00008A8C,
+    0x00008AEE, 0x00008CC7, 0x00008CDC, 0x000096CC, 0x000098FC, 0x00006B6F, 0x00004E8B, 0x00004F3C,
+    0x00004F8D, 0x00005150, 0x00005B57, 0x00005BFA, 0x00006148, 0x00006301, 0x00006642, 0x00006B21,
+    0x00006ECB, 0x00006CBB, 0x0000723E, 0x000074BD, 0x000075D4, 0x000078C1, 0x0000793A, 0x0000800C,
+    0x00008033, 0x000081EA, 0x00008494, 0x00008F9E, 0x00006C50, 0x00009E7F, 0x00005F0F, 0x00008B58,
+    0x00009D2B, 0x00007AFA, 0x00008EF8, 0x00005B8D, 0x000096EB, 0x00004E03, 0x000053F1, 0x000057F7,
+    0x00005931, 0x00005AC9, 0x00005BA4, 0x00006089, 0x00006E7F, 0x00006F06, 0x000075BE, 0x00008CEA,
+    0x00005B9F, 0x00008500, 0x00007BE0, 0x00005072, 0x000067F4, 0x0000829D, 0x00005C61, 0x0000854A,
+    0x00007E1E, 0x0000820E, 0x00005199, 0x00005C04, 0x00006368, 0x00008D66, 0x0000659C, 0x0000716E,
+    0x0000793E, 0x00007D17, 0x00008005, 0x00008B1D, 0x00008ECA, 0x0000906E, 0x000086C7, 0x000090AA,
+    0x0000501F, 0x000052FA, 0x00005C3A, 0x00006753, 0x0000707C, 0x00007235, 0x0000914C, 0x000091C8,
+    0x0000932B, 0x000082E5, 0x00005BC2, 0x00005F31, 0x000060F9, 0x00004E3B, 0x000053D6, 0x00005B88,
+    0x0000624B, 0x00006731, 0x00006B8A, 0x000072E9, 0x000073E0, 0x00007A2E, 0x0000816B, 0x00008DA3,
+    0x00009152, 0x00009996, 0x00005112, 0x000053D7, 0x0000546A, 0x00005BFF, 0x00006388, 0x00006A39,
+    0x00007DAC, 0x00009700, 0x000056DA, 0x000053CE, 0x00005468, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x8F */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00005B97, 0x00005C31, 0x00005DDE, 0x00004FEE, 0x00006101, 0x000062FE, 0x00006D32, 0x000079C0,
+    0x000079CB, 0x00007D42, 0x00007E4D, 0x00007FD2, 0x000081ED, 0x0000821F, 0x00008490, 0x00008846,
+    0x00008972, 0x00008B90, 0x00008E74, 0x00008F2F, 0x00009031, 0x0000914B, 0x0000916C, 0x000096C6,
+    0x0000919C, 0x00004EC0, 0x00004F4F, 0x00005145, 0x00005341, 0x00005F93, 0x0000620E, 0x000067D4,
+    0x00006C41, 0x00006E0B, 0x00007363, 0x00007E26, 0x000091CD, 0x00009283, 0x000053D4, 0x00005919,
+    0x00005BBF, 0x00006DD1, 0x0000795D, 0x00007E2E, 0x00007C9B, 0x0000587E, 0x0000719F, 0x000051FA,
+    0x00008853, 0x00008FF0, 0x00004FCA, 0x00005CFB, 0x00006625, 0x000077AC, 0x00007AE3, 0x0000821C,
+    0x000099FF, 0x000051C6, 0x00005FAA, 0x000065EC, 0x0000696F, 0x00006B89, 0x00006DF3, 0xFFFFFFFF,
+    0x00006E96, 0x00006F64, 0x000076FE, 0x00007D14, 0x00005DE1, 0x00009075, 0x00009187, 0x00009806,
+    0x000051E6, 0x0000521D, 0x00006240, 0x00006691, 0x000066D9, 0x00006E1A, 0x00005EB6, 0x00007DD2,
+    0x00007F72, 0x000066F8, 0x000085AF, 0x000085F7, 0x00008AF8, 0x000052A9, 0x000053D9, 0x00005973,
+    0x00005E8F, 0x00005F90, 0x00006055, 0x000092E4, 0x00009664, 0x000050B7, 0x0000511F, 0x000052DD,
+    0x00005320, 0x00005347, 0x000053EC, 0x000054E8, 0x00005546, 0x00005531, 0x00005617, 0x00005968,
+    0x000059BE, 0x00005A3C, 0x00005BB5, 0x00005C06, 0x00005C0F, 0x00005C11, 0x00005C1A, 0x00005E84,
+    0x00005E8A, 0x00005EE0, 0x00005F70, 0x0000627F, 0x00006284, 0x000062DB, 0x0000638C, 0x00006377,
+    0x00006607, 0x0000660C, 0x0000662D, 0x00006676, 0x0000677E, 0x000068A2, 0x00006A1F, 0x00006A35,
+    0x00006CBC, 0x00006D88, 0x00006E09, 0x00006E58, 0x0000713C, 0x00007126, 0x00007167, 0x000075C7,
+    0x00007701, 0x0000785D, 0x00007901, 0x00007965, 0x000079F0, 0x00007AE0, 0x00007B11, 0x00007CA7,
+    0x00007D39, 0x00008096, 0x000083D6, 0x0000848B, 0x00008549, 0x0000885D, 0x000088F3, 0x00008A1F,
+    0x00008A3C, 0x00008A54, 0x00008A73, 0x00008C61, 0x00008CDE, 0x000091A4, 0x00009266, 0x0000937E,
+    0x00009418, 0x0000969C, 0x00009798, 0x00004E0A, 0x00004E08, 0x00004E1E, 0x00004E57, 0x00005197,
+    0x00005270, 0x000057CE, 0x00005834, 0x000058CC, 0x00005B22, 0x00005E38, 0x000060C5, 0x000064FE,
+    0x00006761, 0x00006756, 0x00006D44, 0x000072B6, 0x00007573, 0x00007A63, 0x000084B8, 0x00008B72,
+    0x000091B8, 0x00009320, 0x00005631, 0x000057F4, 0x000098FE, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x90 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000062ED, 0x0000690D, 0x00006B96, 0x000071ED, 0x00007E54, 0x00008077, 0x00008272, 0x000089E6,
+    0x000098DF, 0x00008755, 0x00008FB1, 0x00005C3B, 0x00004F38, 0x00004FE1, 0x00004FB5, 0x00005507,
+    0x00005A20, 0x00005BDD, 0x00005BE9, 0x00005FC3, 0x0000614E, 0x0000632F, 0x000065B0, 0x0000664B,
+    0x000068EE, 0x0000699B, 0x00006D78, 0x00006DF1, 0x00007533, 0x000075B9, 0x0000771F, 0x0000795E,
+    0x000079E6, 0x00007D33, 0x000081E3, 0x000082AF, 0x000085AA, 0x000089AA, 0x00008A3A, 0x00008EAB,
+    0x00008F9B, 0x00009032, 0x000091DD, 0x00009707, 0x00004EBA, 0x00004EC1, 0x00005203, 0x00005875,
+    0x000058EC, 0x00005C0B, 0x0000751A, 0x00005C3D, 0x0000814E, 0x00008A0A, 0x00008FC5, 0x00009663,
+    0x0000976D, 0x00007B25, 0x00008ACF, 0x00009808, 0x00009162, 0x000056F3, 0x000053A8, 0xFFFFFFFF,
+    0x00009017, 0x00005439, 0x00005782, 0x00005E25, 0x000063A8, 0x00006C34, 0x0000708A, 0x00007761,
+    0x00007C8B, 0x00007FE0, 0x00008870, 0x00009042, 0x00009154, 0x00009310, 0x00009318, 0x0000968F,
+    0x0000745E, 0x00009AC4, 0x00005D07, 0x00005D69, 0x00006570, 0x000067A2, 0x00008DA8, 0x000096DB,
+    0x0000636E, 0x00006749, 0x00006919, 0x000083C5, 0x00009817, 0x000096C0, 0x000088FE, 0x00006F84,
+    0x0000647A, 0x00005BF8, 0x00004E16, 0x0000702C, 0x0000755D, 0x0000662F, 0x000051C4, 0x00005236,
+    0x000052E2, 0x000059D3, 0x00005F81, 0x00006027, 0x00006210, 0x0000653F, 0x00006574, 0x0000661F,
+    0x00006674, 0x000068F2, 0x00006816, 0x00006B63, 0x00006E05, 0x00007272, 0x0000751F, 0x000076DB,
+    0x00007CBE, 0x00008056, 0x000058F0, 0x000088FD, 0x0000897F, 0x00008AA0, 0x00008A93, 0x00008ACB,
+    0x0000901D, 0x00009192, 0x00009752, 0x00009759, 0x00006589, 0x00007A0E, 0x00008106, 0x000096BB,
+    0x00005E2D, 0x000060DC, 0x0000621A, 0x000065A5, 0x00006614, 0x00006790, 0x000077F3, 0x00007A4D,
+    0x00007C4D, 0x00007E3E, 0x0000810A, 0x00008CAC, 0x00008D64, 0x00008DE1, 0x00008E5F, 0x000078A9,
+    0x00005207, 0x000062D9, 0x000063A5, 0x00006442, 0x00006298, 0x00008A2D, 0x00007A83, 0x00007BC0,
+    0x00008AAC, 0x000096EA, 0x00007D76, 0x0000820C, 0x00008749, 0x00004ED9, 0x00005148, 0x00005343,
+    0x00005360, 0x00005BA3, 0x00005C02, 0x00005C16, 0x00005DDD, 0x00006226, 0x00006247, 0x000064B0,
+    0x00006813, 0x00006834, 0x00006CC9, 0x00006D45, 0x00006D17, 0x000067D3, 0x00006F5C, 0x0000714E,
+    0x0000717D, 0x000065CB, 0x00007A7F, 0x00007BAD, 0x00007DDA, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x91 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00007E4A, 0x00007FA8, 0x0000817A, 0x0000821B, 0x00008239, 0x000085A6, 0x00008A6E, 0x00008CCE,
+    0x00008DF5, 0x00009078, 0x00009077, 0x000092AD, 0x00009291, 0x00009583, 0x00009BAE, 0x0000524D,
+    0x00005584, 0x00006F38, 0x00007136, 0x00005168, 0x00007985, 0x00007E55, 0x000081B3, 0x00007CCE,
+    0x0000564C, 0x00005851, 0x00005CA8, 0x000063AA, 0x000066FE, 0x000066FD, 0x0000695A, 0x000072D9,
+    0x0000758F, 0x0000758E, 0x0000790E, 0x00007956, 0x000079DF, 0x00007C97, 0x00007D20, 0x00007D44,
+    0x00008607, 0x00008A34, 0x0000963B, 0x00009061, 0x00009F20, 0x000050E7, 0x00005275, 0x000053CC,
+    0x000053E2, 0x00005009, 0x000055AA, 0x000058EE, 0x0000594F, 0x0000723D, 0x00005B8B, 0x00005C64,
+    0x0000531D, 0x000060E3, 0x000060F3, 0x0000635C, 0x00006383, 0x0000633F, 0x000063BB, 0xFFFFFFFF,
+    0x000064CD, 0x000065E9, 0x000066F9, 0x00005DE3, 0x000069CD, 0x000069FD, 0x00006F15, 0x000071E5,
+    0x00004E89, 0x000075E9, 0x000076F8, 0x00007A93, 0x00007CDF, 0x00007DCF, 0x00007D9C, 0x00008061,
+    0x00008349, 0x00008358, 0x0000846C, 0x000084BC, 0x000085FB, 0x000088C5, 0x00008D70, 0x00009001,
+    0x0000906D, 0x00009397, 0x0000971C, 0x00009A12, 0x000050CF, 0x00005897, 0x0000618E, 0x000081D3,
+    0x00008535, 0x00008D08, 0x00009020, 0x00004FC3, 0x00005074, 0x00005247, 0x00005373, 0x0000606F,
+    0x00006349, 0x0000675F, 0x00006E2C, 0x00008DB3, 0x0000901F, 0x00004FD7, 0x00005C5E, 0x00008CCA,
+    0x000065CF, 0x00007D9A, 0x00005352, 0x00008896, 0x00005176, 0x000063C3, 0x00005B58, 0x00005B6B,
+    0x00005C0A, 0x0000640D, 0x00006751, 0x0000905C, 0x00004ED6, 0x0000591A, 0x0000592A, 0x00006C70,
+    0x00008A51, 0x0000553E, 0x00005815, 0x000059A5, 0x000060F0, 0x00006253, 0x000067C1, 0x00008235,
+    0x00006955, 0x00009640, 0x000099C4, 0x00009A28, 0x00004F53, 0x00005806, 0x00005BFE, 0x00008010,
+    0x00005CB1, 0x00005E2F, 0x00005F85, 0x00006020, 0x0000614B, 0x00006234, 0x000066FF, 0x00006CF0,
+    0x00006EDE, 0x000080CE, 0x0000817F, 0x000082D4, 0x0000888B, 0x00008CB8, 0x00009000, 0x0000902E,
+    0x0000968A, 0x00009EDB, 0x00009BDB, 0x00004EE3, 0x000053F0, 0x00005927, 0x00007B2C, 0x0000918D,
+    0x0000984C, 0x00009DF9, 0x00006EDD, 0x00007027, 0x00005353, 0x00005544, 0x00005B85, 0x00006258,
+    0x0000629E, 0x000062D3, 0x00006CA2, 0x00006FEF, 0x00007422, 0x00008A17, 0x00009438, 0x00006FC1,
+    0x00008AFE, 0x00008338, 0x000051E7, 0x000086F8, 0x000053EA, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x92 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000053E9, 0x00004F46, 0x00009054, 0x00008FB0, 0x0000596A, 0x00008131, 0x00005DFD, 0x00007AEA,
+    0x00008FBF, 0x000068DA, 0x00008C37, 0x000072F8, 0x00009C48, 0x00006A3D, 0x00008AB0, 0x00004E39,
+    0x00005358, 0x00005606, 0x00005766, 0x000062C5, 0x000063A2, 0x000065E6, 0x00006B4E, 0x00006DE1,
+    0x00006E5B, 0x000070AD, 0x000077ED, 0x00007AEF, 0x00007BAA, 0x00007DBB, 0x0000803D, 0x000080C6,
+    0x000086CB, 0x00008A95, 0x0000935B, 0x000056E3, 0x000058C7, 0x00005F3E, 0x000065AD, 0x00006696,
+    0x00006A80, 0x00006BB5, 0x00007537, 0x00008AC7, 0x00005024, 0x000077E5, 0x00005730, 0x00005F1B,
+    0x00006065, 0x0000667A, 0x00006C60, 0x000075F4, 0x00007A1A, 0x00007F6E, 0x000081F4, 0x00008718,
+    0x00009045, 0x000099B3, 0x00007BC9, 0x0000755C, 0x00007AF9, 0x00007B51, 0x000084C4, 0xFFFFFFFF,
+    0x00009010, 0x000079E9, 0x00007A92, 0x00008336, 0x00005AE1, 0x00007740, 0x00004E2D, 0x00004EF2,
+    0x00005B99, 0x00005FE0, 0x000062BD, 0x0000663C, 0x000067F1, 0x00006CE8, 0x0000866B, 0x00008877,
+    0x00008A3B, 0x0000914E, 0x000092F3, 0x000099D0, 0x00006A17, 0x00007026, 0x0000732A, 0x000082E7,
+    0x00008457, 0x00008CAF, 0x00004E01, 0x00005146, 0x000051CB, 0x0000558B, 0x00005BF5, 0x00005E16,
+    0x00005E33, 0x00005E81, 0x00005F14, 0x00005F35, 0x00005F6B, 0x00005FB4, 0x000061F2, 0x00006311,
+    0x000066A2, 0x0000671D, 0x00006F6E, 0x00007252, 0x0000753A, 0x0000773A, 0x00008074, 0x00008139,
+    0x00008178, 0x00008776, 0x00008ABF, 0x00008ADC, 0x00008D85, 0x00008DF3, 0x0000929A, 0x00009577,
+    0x00009802, 0x00009CE5, 0x000052C5, 0x00006357, 0x000076F4, 0x00006715, 0x00006C88, 0x000073CD,
+    0x00008CC3, 0x000093AE, 0x00009673, 0x00006D25, 0x0000589C, 0x0000690E, 0x000069CC, 0x00008FFD,
+    0x0000939A, 0x000075DB, 0x0000901A, 0x0000585A, 0x00006802, 0x000063B4, 0x000069FB, 0x00004F43,
+    0x00006F2C, 0x000067D8, 0x00008FBB, 0x00008526, 0x00007DB4, 0x00009354, 0x0000693F, 0x00006F70,
+    0x0000576A, 0x000058F7, 0x00005B2C, 0x00007D2C, 0x0000722A, 0x0000540A, 0x000091E3, 0x00009DB4,
+    0x00004EAD, 0x00004F4E, 0x0000505C, 0x00005075, 0x00005243, 0x00008C9E, 0x00005448, 0x00005824,
+    0x00005B9A, 0x00005E1D, 0x00005E95, 0x00005EAD, 0x00005EF7, 0x00005F1F, 0x0000608C, 0x000062B5,
+    0x0000633A, 0x000063D0, 0x000068AF, 0x00006C40, 0x00007887, 0x0000798E, 0x00007A0B, 0x00007DE0,
+    0x00008247, 0x00008A02, 0x00008AE6, 0x00008E44, 0x00009013, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x93 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000090B8, 0x0000912D, 0x000091D8, 0x00009F0E, 0x00006CE5, 0x00006458, 0x000064E2, 0x00006575,
+    0x00006EF4, 0x00007684, 0x00007B1B, 0x00009069, 0x000093D1, 0x00006EBA, 0x000054F2, 0x00005FB9,
+    0x000064A4, 0x00008F4D, 0x00008FED, 0x00009244, 0x00005178, 0x0000586B, 0x00005929, 0x00005C55,
+    0x00005E97, 0x00006DFB, 0x00007E8F, 0x0000751C, 0x00008CBC, 0x00008EE2, 0x0000985B, 0x000070B9,
+    0x00004F1D, 0x00006BBF, 0x00006FB1, 0x00007530, 0x000096FB, 0x0000514E, 0x00005410, 0x00005835,
+    0x00005857, 0x000059AC, 0x00005C60, 0x00005F92, 0x00006597, 0x0000675C, 0x00006E21, 0x0000767B,
+    0x000083DF, 0x00008CED, 0x00009014, 0x000090FD, 0x0000934D, 0x00007825, 0x0000783A, 0x000052AA,
+    0x00005EA6, 0x0000571F, 0x00005974, 0x00006012, 0x00005012, 0x0000515A, 0x000051AC, 0xFFFFFFFF,
+    0x000051CD, 0x00005200, 0x00005510, 0x00005854, 0x00005858, 0x00005957, 0x00005B95, 0x00005CF6,
+    0x00005D8B, 0x000060BC, 0x00006295, 0x0000642D, 0x00006771, 0x00006843, 0x000068BC, 0x000068DF,
+    0x000076D7, 0x00006DD8, 0x00006E6F, 0x00006D9B, 0x0000706F, 0x000071C8, 0x00005F53, 0x000075D8,
+    0x00007977, 0x00007B49, 0x00007B54, 0x00007B52, 0x00007CD6, 0x00007D71, 0x00005230, 0x00008463,
+    0x00008569, 0x000085E4, 0x00008A0E, 0x00008B04, 0x00008C46, 0x00008E0F, 0x00009003, 0x0000900F,
+    0x00009419, 0x00009676, 0x0000982D, 0x00009A30, 0x000095D8, 0x000050CD, 0x000052D5, 0x0000540C,
+    0x00005802, 0x00005C0E, 0x000061A7, 0x0000649E, 0x00006D1E, 0x000077B3, 0x00007AE5, 0x000080F4,
+    0x00008404, 0x00009053, 0x00009285, 0x00005CE0, 0x00009D07, 0x0000533F, 0x00005F97, 0x00005FB3,
+    0x00006D9C, 0x00007279, 0x00007763, 0x000079BF, 0x00007BE4, 0x00006BD2, 0x000072EC, 0x00008AAD,
+    0x00006803, 0x00006A61, 0x000051F8, 0x00007A81, 0x00006934, 0x00005C4A, 0x00009CF6, 0x000082EB,
+    0x00005BC5, 0x00009149, 0x0000701E, 0x00005678, 0x00005C6F, 0x000060C7, 0x00006566, 0x00006C8C,
+    0x00008C5A, 0x00009041, 0x00009813, 0x00005451, 0x000066C7, 0x0000920D, 0x00005948, 0x000090A3,
+    0x00005185, 0x00004E4D, 0x000051EA, 0x00008599, 0x00008B0E, 0x00007058, 0x0000637A, 0x0000934B,
+    0x00006962, 0x000099B4, 0x00007E04, 0x00007577, 0x00005357, 0x00006960, 0x00008EDF, 0x000096E3,
+    0x00006C5D, 0x00004E8C, 0x00005C3C, 0x00005F10, 0x00008FE9, 0x00005302, 0x00008CD1, 0x00008089,
+    0x00008679, 0x00005EFF, 0x000065E5, 0x00004E73, 0x00005165, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x94 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00005982, 0x00005C3F, 0x000097EE, 0x00004EFB, 0x0000598A, 0x00005FCD, 0x00008A8D, 0x00006FE1,
+    0x000079B0, 0x00007962, 0x00005BE7, 0x00008471, 0x0000732B, 0x000071B1, 0x00005E74, 0x00005FF5,
+    0x0000637B, 0x0000649A, 0x000071C3, 0x00007C98, 0x00004E43, 0x00005EFC, 0x00004E4B, 0x000057DC,
+    0x000056A2, 0x000060A9, 0x00006FC3, 0x00007D0D, 0x000080FD, 0x00008133, 0x000081BF, 0x00008FB2,
+    0x00008997, 0x000086A4, 0x00005DF4, 0x0000628A, 0x000064AD, 0x00008987, 0x00006777, 0x00006CE2,
+    0x00006D3E, 0x00007436, 0x00007834, 0x00005A46, 0x00007F75, 0x000082AD, 0x000099AC, 0x00004FF3,
+    0x00005EC3, 0x000062DD, 0x00006392, 0x00006557, 0x0000676F, 0x000076C3, 0x0000724C, 0x000080CC,
+    0x000080BA, 0x00008F29, 0x0000914D, 0x0000500D, 0x000057F9, 0x00005A92, 0x00006885, 0xFFFFFFFF,
+    0x00006973, 0x00007164, 0x000072FD, 0x00008CB7, 0x000058F2, 0x00008CE0, 0x0000966A, 0x00009019,
+    0x0000877F, 0x000079E4, 0x000077E7, 0x00008429, 0x00004F2F, 0x00005265, 0x0000535A, 0x000062CD,
+    0x000067CF, 0x00006CCA, 0x0000767D, 0x00007B94, 0x00007C95, 0x00008236, 0x00008584, 0x00008FEB,
+    0x000066DD, 0x00006F20, 0x00007206, 0x00007E1B, 0x000083AB, 0x000099C1, 0x00009EA6, 0x000051FD,
+    0x00007BB1, 0x00007872, 0x00007BB8, 0x00008087, 0x00007B48, 0x00006AE8, 0x00005E61, 0x0000808C,
+    0x00007551, 0x00007560, 0x0000516B, 0x00009262, 0x00006E8C, 0x0000767A, 0x00009197, 0x00009AEA,
+    0x00004F10, 0x00007F70, 0x0000629C, 0x00007B4F, 0x000095A5, 0x00009CE9, 0x0000567A, 0x00005859,
+    0x000086E4, 0x000096BC, 0x00004F34, 0x00005224, 0x0000534A, 0x000053CD, 0x000053DB, 0x00005E06,
+    0x0000642C, 0x00006591, 0x0000677F, 0x00006C3E, 0x00006C4E, 0x00007248, 0x000072AF, 0x000073ED,
+    0x00007554, 0x00007E41, 0x0000822C, 0x000085E9, 0x00008CA9, 0x00007BC4, 0x000091C6, 0x00007169,
+    0x00009812, 0x000098EF, 0x0000633D, 0x00006669, 0x0000756A, 0x000076E4, 0x000078D0, 0x00008543,
+    0x000086EE, 0x0000532A, 0x00005351, 0x00005426, 0x00005983, 0x00005E87, 0x00005F7C, 0x000060B2,
+    0x00006249, 0x00006279, 0x000062AB, 0x00006590, 0x00006BD4, 0x00006CCC, 0x000075B2, 0x000076AE,
+    0x00007891, 0x000079D8, 0x00007DCB, 0x00007F77, 0x000080A5, 0x000088AB, 0x00008AB9, 0x00008CBB,
+    0x0000907F, 0x0000975E, 0x000098DB, 0x00006A0B, 0x00007C38, 0x00005099, 0x00005C3E, 0x00005FAE,
+    0x00006787, 0x00006BD8, 0x00007435, 0x00007709, 0x00007F8E, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x95 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00009F3B, 0x000067CA, 0x00007A17, 0x00005339, 0x0000758B, 0x00009AED, 0x00005F66, 0x0000819D,
+    0x000083F1, 0x00008098, 0x00005F3C, 0x00005FC5, 0x00007562, 0x00007B46, 0x0000903C, 0x00006867,
+    0x000059EB, 0x00005A9B, 0x00007D10, 0x0000767E, 0x00008B2C, 0x00004FF5, 0x00005F6A, 0x00006A19,
+    0x00006C37, 0x00006F02, 0x000074E2, 0x00007968, 0x00008868, 0x00008A55, 0x00008C79, 0x00005EDF,
+    0x000063CF, 0x000075C5, 0x000079D2, 0x000082D7, 0x00009328, 0x000092F2, 0x0000849C, 0x000086ED,
+    0x00009C2D, 0x000054C1, 0x00005F6C, 0x0000658C, 0x00006D5C, 0x00007015, 0x00008CA7, 0x00008CD3,
+    0x0000983B, 0x0000654F, 0x000074F6, 0x00004E0D, 0x00004ED8, 0x000057E0, 0x0000592B, 0x00005A66,
+    0x00005BCC, 0x000051A8, 0x00005E03, 0x00005E9C, 0x00006016, 0x00006276, 0x00006577, 0xFFFFFFFF,
+    0x000065A7, 0x0000666E, 0x00006D6E, 0x00007236, 0x00007B26, 0x00008150, 0x0000819A, 0x00008299,
+    0x00008B5C, 0x00008CA0, 0x00008CE6, 0x00008D74, 0x0000961C, 0x00009644, 0x00004FAE, 0x000064AB,
+    0x00006B66, 0x0000821E, 0x00008461, 0x0000856A, 0x000090E8, 0x00005C01, 0x00006953, 0x000098A8,
+    0x0000847A, 0x00008557, 0x00004F0F, 0x0000526F, 0x00005FA9, 0x00005E45, 0x0000670D, 0x0000798F,
+    0x00008179, 0x00008907, 0x00008986, 0x00006DF5, 0x00005F17, 0x00006255, 0x00006CB8, 0x00004ECF,
+    0x00007269, 0x00009B92, 0x00005206, 0x0000543B, 0x00005674, 0x000058B3, 0x000061A4, 0x0000626E,
+    0x0000711A, 0x0000596E, 0x00007C89, 0x00007CDE, 0x00007D1B, 0x000096F0, 0x00006587, 0x0000805E,
+    0x00004E19, 0x00004F75, 0x00005175, 0x00005840, 0x00005E63, 0x00005E73, 0x00005F0A, 0x000067C4,
+    0x00004E26, 0x0000853D, 0x00009589, 0x0000965B, 0x00007C73, 0x00009801, 0x000050FB, 0x000058C1,
+    0x00007656, 0x000078A7, 0x00005225, 0x000077A5, 0x00008511, 0x00007B86, 0x0000504F, 0x00005909,
+    0x00007247, 0x00007BC7, 0x00007DE8, 0x00008FBA, 0x00008FD4, 0x0000904D, 0x00004FBF, 0x000052C9,
+    0x00005A29, 0x00005F01, 0x000097AD, 0x00004FDD, 0x00008217, 0x000092EA, 0x00005703, 0x00006355,
+    0x00006B69, 0x0000752B, 0x000088DC, 0x00008F14, 0x00007A42, 0x000052DF, 0x00005893, 0x00006155,
+    0x0000620A, 0x000066AE, 0x00006BCD, 0x00007C3F, 0x000083E9, 0x00005023, 0x00004FF8, 0x00005305,
+    0x00005446, 0x00005831, 0x00005949, 0x00005B9D, 0x00005CF0, 0x00005CEF, 0x00005D29, 0x00005E96,
+    0x000062B1, 0x00006367, 0x0000653E, 0x000065B9, 0x0000670B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x96 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00006CD5, 0x00006CE1, 0x000070F9, 0x00007832, 0x00007E2B, 0x000080DE, 0x000082B3, 0x0000840C,
+    0x000084EC, 0x00008702, 0x00008912, 0x00008A2A, 0x00008C4A, 0x000090A6, 0x000092D2, 0x000098FD,
+    0x00009CF3, 0x00009D6C, 0x00004E4F, 0x00004EA1, 0x0000508D, 0x00005256, 0x0000574A, 0x000059A8,
+    0x00005E3D, 0x00005FD8, 0x00005FD9, 0x0000623F, 0x000066B4, 0x0000671B, 0x000067D0, 0x000068D2,
+    0x00005192, 0x00007D21, 0x000080AA, 0x000081A8, 0x00008B00, 0x00008C8C, 0x00008CBF, 0x0000927E,
+    0x00009632, 0x00005420, 0x0000982C, 0x00005317, 0x000050D5, 0x0000535C, 0x000058A8, 0x000064B2,
+    0x00006734, 0x00007267, 0x00007766, 0x00007A46, 0x000091E6, 0x000052C3, 0x00006CA1, 0x00006B86,
+    0x00005800, 0x00005E4C, 0x00005954, 0x0000672C, 0x00007FFB, 0x000051E1, 0x000076C6, 0xFFFFFFFF,
+    0x00006469, 0x000078E8, 0x00009B54, 0x00009EBB, 0x000057CB, 0x000059B9, 0x00006627, 0x0000679A,
+    0x00006BCE, 0x000054E9, 0x000069D9, 0x00005E55, 0x0000819C, 0x00006795, 0x00009BAA, 0x000067FE,
+    0x00009C52, 0x0000685D, 0x00004EA6, 0x00004FE3, 0x000053C8, 0x000062B9, 0x0000672B, 0x00006CAB,
+    0x00008FC4, 0x00004FAD, 0x00007E6D, 0x00009EBF, 0x00004E07, 0x00006162, 0x00006E80, 0x00006F2B,
+    0x00008513, 0x00005473, 0x0000672A, 0x00009B45, 0x00005DF3, 0x00007B95, 0x00005CAC, 0x00005BC6,
+    0x0000871C, 0x00006E4A, 0x000084D1, 0x00007A14, 0x00008108, 0x00005999, 0x00007C8D, 0x00006C11,
+    0x00007720, 0x000052D9, 0x00005922, 0x00007121, 0x0000725F, 0x000077DB, 0x00009727, 0x00009D61,
+    0x0000690B, 0x00005A7F, 0x00005A18, 0x000051A5, 0x0000540D, 0x0000547D, 0x0000660E, 0x000076DF,
+    0x00008FF7, 0x00009298, 0x00009CF4, 0x000059EA, 0x0000725D, 0x00006EC5, 0x0000514D, 0x000068C9,
+    0x00007DBF, 0x00007DEC, 0x00009762, 0x00009EBA, 0x00006478, 0x00006A21, 0x00008302, 0x00005984,
+    0x00005B5F, 0x00006BDB, 0x0000731B, 0x000076F2, 0x00007DB2, 0x00008017, 0x00008499, 0x00005132,
+    0x00006728, 0x00009ED9, 0x000076EE, 0x00006762, 0x000052FF, 0x00009905, 0x00005C24, 0x0000623B,
+    0x00007C7E, 0x00008CB0, 0x0000554F, 0x000060B6, 0x00007D0B, 0x00009580, 0x00005301, 0x00004E5F,
+    0x000051B6, 0x0000591C, 0x0000723A, 0x00008036, 0x000091CE, 0x00005F25, 0x000077E2, 0x00005384,
+    0x00005F79, 0x00007D04, 0x000085AC, 0x00008A33, 0x00008E8D, 0x00009756, 0x000067F3, 0x000085AE,
+    0x00009453, 0x00006109, 0x00006108, 0x00006CB9, 0x00007652, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x97 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00008AED, 0x00008F38, 0x0000552F, 0x00004F51, 0x0000512A, 0x000052C7, 0x000053CB, 0x00005BA5,
+    0x00005E7D, 0x000060A0, 0x00006182, 0x000063D6, 0x00006709, 0x000067DA, 0x00006E67, 0x00006D8C,
+    0x00007336, 0x00007337, 0x00007531, 0x00007950, 0x000088D5, 0x00008A98, 0x0000904A, 0x00009091,
+    0x000090F5, 0x000096C4, 0x0000878D, 0x00005915, 0x00004E88, 0x00004F59, 0x00004E0E, 0x00008A89,
+    0x00008F3F, 0x00009810, 0x000050AD, 0x00005E7C, 0x00005996, 0x00005BB9, 0x00005EB8, 0x000063DA,
+    0x000063FA, 0x000064C1, 0x000066DC, 0x0000694A, 0x000069D8, 0x00006D0B, 0x00006EB6, 0x00007194,
+    0x00007528, 0x00007AAF, 0x00007F8A, 0x00008000, 0x00008449, 0x000084C9, 0x00008981, 0x00008B21,
+    0x00008E0A, 0x00009065, 0x0000967D, 0x0000990A, 0x0000617E, 0x00006291, 0x00006B32, 0xFFFFFFFF,
+    0x00006C83, 0x00006D74, 0x00007FCC, 0x00007FFC, 0x00006DC0, 0x00007F85, 0x000087BA, 0x000088F8,
+    0x00006765, 0x000083B1, 0x0000983C, 0x000096F7, 0x00006D1B, 0x00007D61, 0x0000843D, 0x0000916A,
+    0x00004E71, 0x00005375, 0x00005D50, 0x00006B04, 0x00006FEB, 0x000085CD, 0x0000862D, 0x000089A7,
+    0x00005229, 0x0000540F, 0x00005C65, 0x0000674E, 0x000068A8, 0x00007406, 0x00007483, 0x000075E2,
+    0x000088CF, 0x000088E1, 0x000091CC, 0x000096E2, 0x00009678, 0x00005F8B, 0x00007387, 0x00007ACB,
+    0x0000844E, 0x000063A0, 0x00007565, 0x00005289, 0x00006D41, 0x00006E9C, 0x00007409, 0x00007559,
+    0x0000786B, 0x00007C92, 0x00009686, 0x00007ADC, 0x00009F8D, 0x00004FB6, 0x0000616E, 0x000065C5,
+    0x0000865C, 0x00004E86, 0x00004EAE, 0x000050DA, 0x00004E21, 0x000051CC, 0x00005BEE, 0x00006599,
+    0x00006881, 0x00006DBC, 0x0000731F, 0x00007642, 0x000077AD, 0x00007A1C, 0x00007CE7, 0x0000826F,
+    0x00008AD2, 0x0000907C, 0x000091CF, 0x00009675, 0x00009818, 0x0000529B, 0x00007DD1, 0x0000502B,
+    0x00005398, 0x00006797, 0x00006DCB, 0x000071D0, 0x00007433, 0x000081E8, 0x00008F2A, 0x000096A3,
+    0x00009C57, 0x00009E9F, 0x00007460, 0x00005841, 0x00006D99, 0x00007D2F, 0x0000985E, 0x00004EE4,
+    0x00004F36, 0x00004F8B, 0x000051B7, 0x000052B1, 0x00005DBA, 0x0000601C, 0x000073B2, 0x0000793C,
+    0x000082D3, 0x00009234, 0x000096B7, 0x000096F6, 0x0000970A, 0x00009E97, 0x00009F62, 0x000066A6,
+    0x00006B74, 0x00005217, 0x000052A3, 0x000070C8, 0x000088C2, 0x00005EC9, 0x0000604B, 0x00006190,
+    0x00006F23, 0x00007149, 0x00007C3E, 0x00007DF4, 0x0000806F, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x98 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000084EE, 0x00009023, 0x0000932C, 0x00005442, 0x00009B6F, 0x00006AD3, 0x00007089, 0x00008CC2,
+    0x00008DEF, 0x00009732, 0x000052B4, 0x00005A41, 0x00005ECA, 0x00005F04, 0x00006717, 0x0000697C,
+    0x00006994, 0x00006D6A, 0x00006F0F, 0x00007262, 0x000072FC, 0x00007BED, 0x00008001, 0x0000807E,
+    0x0000874B, 0x000090CE, 0x0000516D, 0x00009E93, 0x00007984, 0x0000808B, 0x00009332, 0x00008AD6,
+    0x0000502D, 0x0000548C, 0x00008A71, 0x00006B6A, 0x00008CC4, 0x00008107, 0x000060D1, 0x000067A0,
+    0x00009DF2, 0x00004E99, 0x00004E98, 0x00009C10, 0x00008A6B, 0x000085C1, 0x00008568, 0x00006900,
+    0x00006E7E, 0x00007897, 0x00008155, 0x00020B9F, 0x00005B41, 0x00005B56, 0x00005B7D, 0x00005B93,
+    0x00005BD8, 0x00005BEC, 0x00005C12, 0x00005C1E, 0x00005C23, 0x00005C2B, 0x0000378D, 0xFFFFFFFF,
+    0x00005C62, 0x0000FA3B, 0x0000FA3C, 0x000216B4, 0x00005C7A, 0x00005C8F, 0x00005C9F, 0x00005CA3,
+    0x00005CAA, 0x00005CBA, 0x00005CCB, 0x00005CD0, 0x00005CD2, 0x00005CF4, 0x00021E34, 0x000037E2,
+    0x00005D0D, 0x00005D27, 0x0000FA11, 0x00005D46, 0x00005D47, 0x00005D53, 0x00005D4A, 0x00005D6D,
+    0x00005D81, 0x00005DA0, 0x00005DA4, 0x00005DA7, 0x00005DB8, 0x00005DCB, 0x0000541E, 0x00005F0C,
+    0x00004E10, 0x00004E15, 0x00004E2A, 0x00004E31, 0x00004E36, 0x00004E3C, 0x00004E3F, 0x00004E42,
+    0x00004E56, 0x00004E58, 0x00004E82, 0x00004E85, 0x00008C6B, 0x00004E8A, 0x00008212, 0x00005F0D,
+    0x00004E8E, 0x00004E9E, 0x00004E9F, 0x00004EA0, 0x00004EA2, 0x00004EB0, 0x00004EB3, 0x00004EB6,
+    0x00004ECE, 0x00004ECD, 0x00004EC4, 0x00004EC6, 0x00004EC2, 0x00004ED7, 0x00004EDE, 0x00004EED,
+    0x00004EDF, 0x00004EF7, 0x00004F09, 0x00004F5A, 0x00004F30, 0x00004F5B, 0x00004F5D, 0x00004F57,
+    0x00004F47, 0x00004F76, 0x00004F88, 0x00004F8F, 0x00004F98, 0x00004F7B, 0x00004F69, 0x00004F70,
+    0x00004F91, 0x00004F6F, 0x00004F86, 0x00004F96, 0x00005118, 0x00004FD4, 0x00004FDF, 0x00004FCE,
+    0x00004FD8, 0x00004FDB, 0x00004FD1, 0x00004FDA, 0x00004FD0, 0x00004FE4, 0x00004FE5, 0x0000501A,
+    0x00005028, 0x00005014, 0x0000502A, 0x00005025, 0x00005005, 0x00004F1C, 0x00004FF6, 0x00005021,
+    0x00005029, 0x0000502C, 0x00004FFE, 0x00004FEF, 0x00005011, 0x00005006, 0x00005043, 0x00005047,
+    0x00006703, 0x00005055, 0x00005050, 0x00005048, 0x0000505A, 0x00005056, 0x0000506C, 0x00005078,
+    0x00005080, 0x0000509A, 0x00005085, 0x000050B4, 0x000050B2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x99 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000050C9, 0x000050CA, 0x000050B3, 0x000050C2, 0x000050D6, 0x000050DE, 0x000050E5, 0x000050ED,
+    0x000050E3, 0x000050EE, 0x000050F9, 0x000050F5, 0x00005109, 0x00005101, 0x00005102, 0x00005116,
+    0x00005115, 0x00005114, 0x0000511A, 0x00005121, 0x0000513A, 0x00005137, 0x0000513C, 0x0000513B,
+    0x0000513F, 0x00005140, 0x00005152, 0x0000514C, 0x00005154, 0x00005162, 0x00007AF8, 0x00005169,
+    0x0000516A, 0x0000516E, 0x00005180, 0x00005182, 0x000056D8, 0x0000518C, 0x00005189, 0x0000518F,
+    0x00005191, 0x00005193, 0x00005195, 0x00005196, 0x000051A4, 0x000051A6, 0x000051A2, 0x000051A9,
+    0x000051AA, 0x000051AB, 0x000051B3, 0x000051B1, 0x000051B2, 0x000051B0, 0x000051B5, 0x000051BD,
+    0x000051C5, 0x000051C9, 0x000051DB, 0x000051E0, 0x00008655, 0x000051E9, 0x000051ED, 0xFFFFFFFF,
+    0x000051F0, 0x000051F5, 0x000051FE, 0x00005204, 0x0000520B, 0x00005214, 0x0000520E, 0x00005227,
+    0x0000522A, 0x0000522E, 0x00005233, 0x00005239, 0x0000524F, 0x00005244, 0x0000524B, 0x0000524C,
+    0x0000525E, 0x00005254, 0x0000526A, 0x00005274, 0x00005269, 0x00005273, 0x0000527F, 0x0000527D,
+    0x0000528D, 0x00005294, 0x00005292, 0x00005271, 0x00005288, 0x00005291, 0x00008FA8, 0x00008FA7,
+    0x000052AC, 0x000052AD, 0x000052BC, 0x000052B5, 0x000052C1, 0x000052CD, 0x000052D7, 0x000052DE,
+    0x000052E3, 0x000052E6, 0x000098ED, 0x000052E0, 0x000052F3, 0x000052F5, 0x000052F8, 0x000052F9,
+    0x00005306, 0x00005308, 0x00007538, 0x0000530D, 0x00005310, 0x0000530F, 0x00005315, 0x0000531A,
+    0x00005323, 0x0000532F, 0x00005331, 0x00005333, 0x00005338, 0x00005340, 0x00005346, 0x00005345,
+    0x00004E17, 0x00005349, 0x0000534D, 0x000051D6, 0x0000535E, 0x00005369, 0x0000536E, 0x00005918,
+    0x0000537B, 0x00005377, 0x00005382, 0x00005396, 0x000053A0, 0x000053A6, 0x000053A5, 0x000053AE,
+    0x000053B0, 0x000053B6, 0x000053C3, 0x00007C12, 0x000096D9, 0x000053DF, 0x000066FC, 0x000071EE,
+    0x000053EE, 0x000053E8, 0x000053ED, 0x000053FA, 0x00005401, 0x0000543D, 0x00005440, 0x0000542C,
+    0x0000542D, 0x0000543C, 0x0000542E, 0x00005436, 0x00005429, 0x0000541D, 0x0000544E, 0x0000548F,
+    0x00005475, 0x0000548E, 0x0000545F, 0x00005471, 0x00005477, 0x00005470, 0x00005492, 0x0000547B,
+    0x00005480, 0x00005476, 0x00005484, 0x00005490, 0x00005486, 0x000054C7, 0x000054A2, 0x000054B8,
+    0x000054A5, 0x000054AC, 0x000054C4, 0x000054C8, 0x000054A8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x9A */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000054AB, 0x000054C2, 0x000054A4, 0x000054BE, 0x000054BC, 0x000054D8, 0x000054E5, 0x000054E6,
+    0x0000550F, 0x00005514, 0x000054FD, 0x000054EE, 0x000054ED, 0x000054FA, 0x000054E2, 0x00005539,
+    0x00005540, 0x00005563, 0x0000554C, 0x0000552E, 0x0000555C, 0x00005545, 0x00005556, 0x00005557,
+    0x00005538, 0x00005533, 0x0000555D, 0x00005599, 0x00005580, 0x000054AF, 0x0000558A, 0x0000559F,
+    0x0000557B, 0x0000557E, 0x00005598, 0x0000559E, 0x000055AE, 0x0000557C, 0x00005583, 0x000055A9,
+    0x00005587, 0x000055A8, 0x000055DA, 0x000055C5, 0x000055DF, 0x000055C4, 0x000055DC, 0x000055E4,
+    0x000055D4, 0x00005614, 0x000055F7, 0x00005616, 0x000055FE, 0x000055FD, 0x0000561B, 0x000055F9,
+    0x0000564E, 0x00005650, 0x000071DF, 0x00005634, 0x00005636, 0x00005632, 0x00005638, 0xFFFFFFFF,
+    0x0000566B, 0x00005664, 0x0000562F, 0x0000566C, 0x0000566A, 0x00005686, 0x00005680, 0x0000568A,
+    0x000056A0, 0x00005694, 0x0000568F, 0x000056A5, 0x000056AE, 0x000056B6, 0x000056B4, 0x000056C2,
+    0x000056BC, 0x000056C1, 0x000056C3, 0x000056C0, 0x000056C8, 0x000056CE, 0x000056D1, 0x000056D3,
+    0x000056D7, 0x000056EE, 0x000056F9, 0x00005700, 0x000056FF, 0x00005704, 0x00005709, 0x00005708,
+    0x0000570B, 0x0000570D, 0x00005713, 0x00005718, 0x00005716, 0x000055C7, 0x0000571C, 0x00005726,
+    0x00005737, 0x00005738, 0x0000574E, 0x0000573B, 0x00005740, 0x0000574F, 0x00005769, 0x000057C0,
+    0x00005788, 0x00005761, 0x0000577F, 0x00005789, 0x00005793, 0x000057A0, 0x000057B3, 0x000057A4,
+    0x000057AA, 0x000057B0, 0x000057C3, 0x000057C6, 0x000057D4, 0x000057D2, 0x000057D3, 0x0000580A,
+    0x000057D6, 0x000057E3, 0x0000580B, 0x00005819, 0x0000581D, 0x00005872, 0x00005821, 0x00005862,
+    0x0000584B, 0x00005870, 0x00006BC0, 0x00005852, 0x0000583D, 0x00005879, 0x00005885, 0x000058B9,
+    0x0000589F, 0x000058AB, 0x000058BA, 0x000058DE, 0x000058BB, 0x000058B8, 0x000058AE, 0x000058C5,
+    0x000058D3, 0x000058D1, 0x000058D7, 0x000058D9, 0x000058D8, 0x000058E5, 0x000058DC, 0x000058E4,
+    0x000058DF, 0x000058EF, 0x000058FA, 0x000058F9, 0x000058FB, 0x000058FC, 0x000058FD, 0x00005902,
+    0x0000590A, 0x00005910, 0x0000591B, 0x000068A6, 0x00005925, 0x0000592C, 0x0000592D, 0x00005932,
+    0x00005938, 0x0000593E, 0x00007AD2, 0x00005955, 0x00005950, 0x0000594E, 0x0000595A, 0x00005958,
+    0x00005962, 0x00005960, 0x00005967, 0x0000596C, 0x00005969, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x9B */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00005978, 0x00005981, 0x0000599D, 0x00004F5E, 0x00004FAB, 0x000059A3, 0x000059B2, 0x000059C6,
+    0x000059E8, 0x000059DC, 0x0000598D, 0x000059D9, 0x000059DA, 0x00005A25, 0x00005A1F, 0x00005A11,
+    0x00005A1C, 0x00005A09, 0x00005A1A, 0x00005A40, 0x00005A6C, 0x00005A49, 0x00005A35, 0x00005A36,
+    0x00005A62, 0x00005A6A, 0x00005A9A, 0x00005ABC, 0x00005ABE, 0x00005ACB, 0x00005AC2, 0x00005ABD,
+    0x00005AE3, 0x00005AD7, 0x00005AE6, 0x00005AE9, 0x00005AD6, 0x00005AFA, 0x00005AFB, 0x00005B0C,
+    0x00005B0B, 0x00005B16, 0x00005B32, 0x00005AD0, 0x00005B2A, 0x00005B36, 0x00005B3E, 0x00005B43,
+    0x00005B45, 0x00005B40, 0x00005B51, 0x00005B55, 0x00005B5A, 0x00005B5B, 0x00005B65, 0x00005B69,
+    0x00005B70, 0x00005B73, 0x00005B75, 0x00005B78, 0x00006588, 0x00005B7A, 0x00005B80, 0xFFFFFFFF,
+    0x00005B83, 0x00005BA6, 0x00005BB8, 0x00005BC3, 0x00005BC7, 0x00005BC9, 0x00005BD4, 0x00005BD0,
+    0x00005BE4, 0x00005BE6, 0x00005BE2, 0x00005BDE, 0x00005BE5, 0x00005BEB, 0x00005BF0, 0x00005BF6,
+    0x00005BF3, 0x00005C05, 0x00005C07, 0x00005C08, 0x00005C0D, 0x00005C13, 0x00005C20, 0x00005C22,
+    0x00005C28, 0x00005C38, 0x00005C39, 0x00005C41, 0x00005C46, 0x00005C4E, 0x00005C53, 0x00005C50,
+    0x00005C4F, 0x00005B71, 0x00005C6C, 0x00005C6E, 0x00004E62, 0x00005C76, 0x00005C79, 0x00005C8C,
+    0x00005C91, 0x00005C94, 0x0000599B, 0x00005CAB, 0x00005CBB, 0x00005CB6, 0x00005CBC, 0x00005CB7,
+    0x00005CC5, 0x00005CBE, 0x00005CC7, 0x00005CD9, 0x00005CE9, 0x00005CFD, 0x00005CFA, 0x00005CED,
+    0x00005D8C, 0x00005CEA, 0x00005D0B, 0x00005D15, 0x00005D17, 0x00005D5C, 0x00005D1F, 0x00005D1B,
+    0x00005D11, 0x00005D14, 0x00005D22, 0x00005D1A, 0x00005D19, 0x00005D18, 0x00005D4C, 0x00005D52,
+    0x00005D4E, 0x00005D4B, 0x00005D6C, 0x00005D73, 0x00005D76, 0x00005D87, 0x00005D84, 0x00005D82,
+    0x00005DA2, 0x00005D9D, 0x00005DAC, 0x00005DAE, 0x00005DBD, 0x00005D90, 0x00005DB7, 0x00005DBC,
+    0x00005DC9, 0x00005DCD, 0x00005DD3, 0x00005DD2, 0x00005DD6, 0x00005DDB, 0x00005DEB, 0x00005DF2,
+    0x00005DF5, 0x00005E0B, 0x00005E1A, 0x00005E19, 0x00005E11, 0x00005E1B, 0x00005E36, 0x00005E37,
+    0x00005E44, 0x00005E43, 0x00005E40, 0x00005E4E, 0x00005E57, 0x00005E54, 0x00005E5F, 0x00005E62,
+    0x00005E64, 0x00005E47, 0x00005E75, 0x00005E76, 0x00005E7A, 0x00009EBC, 0x00005E7F, 0x00005EA0,
+    0x00005EC1, 0x00005EC2, 0x00005EC8, 0x00005ED0, 0x00005ECF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x9C */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00005ED6, 0x00005EE3, 0x00005EDD, 0x00005EDA, 0x00005EDB, 0x00005EE2, 0x00005EE1, 0x00005EE8,
+    0x00005EE9, 0x00005EEC, 0x00005EF1, 0x00005EF3, 0x00005EF0, 0x00005EF4, 0x00005EF8, 0x00005EFE,
+    0x00005F03, 0x00005F09, 0x00005F5D, 0x00005F5C, 0x00005F0B, 0x00005F11, 0x00005F16, 0x00005F29,
+    0x00005F2D, 0x00005F38, 0x00005F41, 0x00005F48, 0x00005F4C, 0x00005F4E, 0x00005F2F, 0x00005F51,
+    0x00005F56, 0x00005F57, 0x00005F59, 0x00005F61, 0x00005F6D, 0x00005F73, 0x00005F77, 0x00005F83,
+    0x00005F82, 0x00005F7F, 0x00005F8A, 0x00005F88, 0x00005F91, 0x00005F87, 0x00005F9E, 0x00005F99,
+    0x00005F98, 0x00005FA0, 0x00005FA8, 0x00005FAD, 0x00005FBC, 0x00005FD6, 0x00005FFB, 0x00005FE4,
+    0x00005FF8, 0x00005FF1, 0x00005FDD, 0x000060B3, 0x00005FFF, 0x00006021, 0x00006060, 0xFFFFFFFF,
+    0x00006019, 0x00006010, 0x00006029, 0x0000600E, 0x00006031, 0x0000601B, 0x00006015, 0x0000602B,
+    0x00006026, 0x0000600F, 0x0000603A, 0x0000605A, 0x00006041, 0x0000606A, 0x00006077, 0x0000605F,
+    0x0000604A, 0x00006046, 0x0000604D, 0x00006063, 0x00006043, 0x00006064, 0x00006042, 0x0000606C,
+    0x0000606B, 0x00006059, 0x00006081, 0x0000608D, 0x000060E7, 0x00006083, 0x0000609A, 0x00006084,
+    0x0000609B, 0x00006096, 0x00006097, 0x00006092, 0x000060A7, 0x0000608B, 0x000060E1, 0x000060B8,
+    0x000060E0, 0x000060D3, 0x000060B4, 0x00005FF0, 0x000060BD, 0x000060C6, 0x000060B5, 0x000060D8,
+    0x0000614D, 0x00006115, 0x00006106, 0x000060F6, 0x000060F7, 0x00006100, 0x000060F4, 0x000060FA,
+    0x00006103, 0x00006121, 0x000060FB, 0x000060F1, 0x0000610D, 0x0000610E, 0x00006147, 0x0000613E,
+    0x00006128, 0x00006127, 0x0000614A, 0x0000613F, 0x0000613C, 0x0000612C, 0x00006134, 0x0000613D,
+    0x00006142, 0x00006144, 0x00006173, 0x00006177, 0x00006158, 0x00006159, 0x0000615A, 0x0000616B,
+    0x00006174, 0x0000616F, 0x00006165, 0x00006171, 0x0000615F, 0x0000615D, 0x00006153, 0x00006175,
+    0x00006199, 0x00006196, 0x00006187, 0x000061AC, 0x00006194, 0x0000619A, 0x0000618A, 0x00006191,
+    0x000061AB, 0x000061AE, 0x000061CC, 0x000061CA, 0x000061C9, 0x000061F7, 0x000061C8, 0x000061C3,
+    0x000061C6, 0x000061BA, 0x000061CB, 0x00007F79, 0x000061CD, 0x000061E6, 0x000061E3, 0x000061F6,
+    0x000061FA, 0x000061F4, 0x000061FF, 0x000061FD, 0x000061FC, 0x000061FE, 0x00006200, 0x00006208,
+    0x00006209, 0x0000620D, 0x0000620C, 0x00006214, 0x0000621B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x9D */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000621E, 0x00006221, 0x0000622A, 0x0000622E, 0x00006230, 0x00006232, 0x00006233, 0x00006241,
+    0x0000624E, 0x0000625E, 0x00006263, 0x0000625B, 0x00006260, 0x00006268, 0x0000627C, 0x00006282,
+    0x00006289, 0x0000627E, 0x00006292, 0x00006293, 0x00006296, 0x000062D4, 0x00006283, 0x00006294,
+    0x000062D7, 0x000062D1, 0x000062BB, 0x000062CF, 0x000062FF, 0x000062C6, 0x000064D4, 0x000062C8,
+    0x000062DC, 0x000062CC, 0x000062CA, 0x000062C2, 0x000062C7, 0x0000629B, 0x000062C9, 0x0000630C,
+    0x000062EE, 0x000062F1, 0x00006327, 0x00006302, 0x00006308, 0x000062EF, 0x000062F5, 0x00006350,
+    0x0000633E, 0x0000634D, 0x0000641C, 0x0000634F, 0x00006396, 0x0000638E, 0x00006380, 0x000063AB,
+    0x00006376, 0x000063A3, 0x0000638F, 0x00006389, 0x0000639F, 0x000063B5, 0x0000636B, 0xFFFFFFFF,
+    0x00006369, 0x000063BE, 0x000063E9, 0x000063C0, 0x000063C6, 0x000063E3, 0x000063C9, 0x000063D2,
+    0x000063F6, 0x000063C4, 0x00006416, 0x00006434, 0x00006406, 0x00006413, 0x00006426, 0x00006436,
+    0x0000651D, 0x00006417, 0x00006428, 0x0000640F, 0x00006467, 0x0000646F, 0x00006476, 0x0000644E,
+    0x0000652A, 0x00006495, 0x00006493, 0x000064A5, 0x000064A9, 0x00006488, 0x000064BC, 0x000064DA,
+    0x000064D2, 0x000064C5, 0x000064C7, 0x000064BB, 0x000064D8, 0x000064C2, 0x000064F1, 0x000064E7,
+    0x00008209, 0x000064E0, 0x000064E1, 0x000062AC, 0x000064E3, 0x000064EF, 0x0000652C, 0x000064F6,
+    0x000064F4, 0x000064F2, 0x000064FA, 0x00006500, 0x000064FD, 0x00006518, 0x0000651C, 0x00006505,
+    0x00006524, 0x00006523, 0x0000652B, 0x00006534, 0x00006535, 0x00006537, 0x00006536, 0x00006538,
+    0x0000754B, 0x00006548, 0x00006556, 0x00006555, 0x0000654D, 0x00006558, 0x0000655E, 0x0000655D,
+    0x00006572, 0x00006578, 0x00006582, 0x00006583, 0x00008B8A, 0x0000659B, 0x0000659F, 0x000065AB,
+    0x000065B7, 0x000065C3, 0x000065C6, 0x000065C1, 0x000065C4, 0x000065CC, 0x000065D2, 0x000065DB,
+    0x000065D9, 0x000065E0, 0x000065E1, 0x000065F1, 0x00006772, 0x0000660A, 0x00006603, 0x000065FB,
+    0x00006773, 0x00006635, 0x00006636, 0x00006634, 0x0000661C, 0x0000664F, 0x00006644, 0x00006649,
+    0x00006641, 0x0000665E, 0x0000665D, 0x00006664, 0x00006667, 0x00006668, 0x0000665F, 0x00006662,
+    0x00006670, 0x00006683, 0x00006688, 0x0000668E, 0x00006689, 0x00006684, 0x00006698, 0x0000669D,
+    0x000066C1, 0x000066B9, 0x000066C9, 0x000066BE, 0x000066BC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x9E */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000066C4, 0x000066B8, 0x000066D6, 0x000066DA, 0x000066E0, 0x0000663F, 0x000066E6, 0x000066E9,
+    0x000066F0, 0x000066F5, 0x000066F7, 0x0000670F, 0x00006716, 0x0000671E, 0x00006726, 0x00006727,
+    0x00009738, 0x0000672E, 0x0000673F, 0x00006736, 0x00006741, 0x00006738, 0x00006737, 0x00006746,
+    0x0000675E, 0x00006760, 0x00006759, 0x00006763, 0x00006764, 0x00006789, 0x00006770, 0x000067A9,
+    0x0000677C, 0x0000676A, 0x0000678C, 0x0000678B, 0x000067A6, 0x000067A1, 0x00006785, 0x000067B7,
+    0x000067EF, 0x000067B4, 0x000067EC, 0x000067B3, 0x000067E9, 0x000067B8, 0x000067E4, 0x000067DE,
+    0x000067DD, 0x000067E2, 0x000067EE, 0x000067B9, 0x000067CE, 0x000067C6, 0x000067E7, 0x00006A9C,
+    0x0000681E, 0x00006846, 0x00006829, 0x00006840, 0x0000684D, 0x00006832, 0x0000684E, 0xFFFFFFFF,
+    0x000068B3, 0x0000682B, 0x00006859, 0x00006863, 0x00006877, 0x0000687F, 0x0000689F, 0x0000688F,
+    0x000068AD, 0x00006894, 0x0000689D, 0x0000689B, 0x00006883, 0x00006AAE, 0x000068B9, 0x00006874,
+    0x000068B5, 0x000068A0, 0x000068BA, 0x0000690F, 0x0000688D, 0x0000687E, 0x00006901, 0x000068CA,
+    0x00006908, 0x000068D8, 0x00006922, 0x00006926, 0x000068E1, 0x0000690C, 0x000068CD, 0x000068D4,
+    0x000068E7, 0x000068D5, 0x00006936, 0x00006912, 0x00006904, 0x000068D7, 0x000068E3, 0x00006925,
+    0x000068F9, 0x000068E0, 0x000068EF, 0x00006928, 0x0000692A, 0x0000691A, 0x00006923, 0x00006921,
+    0x000068C6, 0x00006979, 0x00006977, 0x0000695C, 0x00006978, 0x0000696B, 0x00006954, 0x0000697E,
+    0x0000696E, 0x00006939, 0x00006974, 0x0000693D, 0x00006959, 0x00006930, 0x00006961, 0x0000695E,
+    0x0000695D, 0x00006981, 0x0000696A, 0x000069B2, 0x000069AE, 0x000069D0, 0x000069BF, 0x000069C1,
+    0x000069D3, 0x000069BE, 0x000069CE, 0x00005BE8, 0x000069CA, 0x000069DD, 0x000069BB, 0x000069C3,
+    0x000069A7, 0x00006A2E, 0x00006991, 0x000069A0, 0x0000699C, 0x00006995, 0x000069B4, 0x000069DE,
+    0x000069E8, 0x00006A02, 0x00006A1B, 0x000069FF, 0x00006B0A, 0x000069F9, 0x000069F2, 0x000069E7,
+    0x00006A05, 0x000069B1, 0x00006A1E, 0x000069ED, 0x00006A14, 0x000069EB, 0x00006A0A, 0x00006A12,
+    0x00006AC1, 0x00006A23, 0x00006A13, 0x00006A44, 0x00006A0C, 0x00006A72, 0x00006A36, 0x00006A78,
+    0x00006A47, 0x00006A62, 0x00006A59, 0x00006A66, 0x00006A48, 0x00006A38, 0x00006A22, 0x00006A90,
+    0x00006A8D, 0x00006AA0, 0x00006A84, 0x00006AA2, 0x00006AA3, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0x9F */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00006A97, 0x00008617, 0x00006ABB, 0x00006AC3, 0x00006AC2, 0x00006AB8, 0x00006AB3, 0x00006AAC,
+    0x00006ADE, 0x00006AD1, 0x00006ADF, 0x00006AAA, 0x00006ADA, 0x00006AEA, 0x00006AFB, 0x00006B05,
+    0x00008616, 0x00006AFA, 0x00006B12, 0x00006B16, 0x00009B31, 0x00006B1F, 0x00006B38, 0x00006B37,
+    0x000076DC, 0x00006B39, 0x000098EE, 0x00006B47, 0x00006B43, 0x00006B49, 0x00006B50, 0x00006B59,
+    0x00006B54, 0x00006B5B, 0x00006B5F, 0x00006B61, 0x00006B78, 0x00006B79, 0x00006B7F, 0x00006B80,
+    0x00006B84, 0x00006B83, 0x00006B8D, 0x00006B98, 0x00006B95, 0x00006B9E, 0x00006BA4, 0x00006BAA,
+    0x00006BAB, 0x00006BAF, 0x00006BB2, 0x00006BB1, 0x00006BB3, 0x00006BB7, 0x00006BBC, 0x00006BC6,
+    0x00006BCB, 0x00006BD3, 0x00006BDF, 0x00006BEC, 0x00006BEB, 0x00006BF3, 0x00006BEF, 0xFFFFFFFF,
+    0x00009EBE, 0x00006C08, 0x00006C13, 0x00006C14, 0x00006C1B, 0x00006C24, 0x00006C23, 0x00006C5E,
+    0x00006C55, 0x00006C62, 0x00006C6A, 0x00006C82, 0x00006C8D, 0x00006C9A, 0x00006C81, 0x00006C9B,
+    0x00006C7E, 0x00006C68, 0x00006C73, 0x00006C92, 0x00006C90, 0x00006CC4, 0x00006CF1, 0x00006CD3,
+    0x00006CBD, 0x00006CD7, 0x00006CC5, 0x00006CDD, 0x00006CAE, 0x00006CB1, 0x00006CBE, 0x00006CBA,
+    0x00006CDB, 0x00006CEF, 0x00006CD9, 0x00006CEA, 0x00006D1F, 0x0000884D, 0x00006D36, 0x00006D2B,
+    0x00006D3D, 0x00006D38, 0x00006D19, 0x00006D35, 0x00006D33, 0x00006D12, 0x00006D0C, 0x00006D63,
+    0x00006D93, 0x00006D64, 0x00006D5A, 0x00006D79, 0x00006D59, 0x00006D8E, 0x00006D95, 0x00006FE4,
+    0x00006D85, 0x00006DF9, 0x00006E15, 0x00006E0A, 0x00006DB5, 0x00006DC7, 0x00006DE6, 0x00006DB8,
+    0x00006DC6, 0x00006DEC, 0x00006DDE, 0x00006DCC, 0x00006DE8, 0x00006DD2, 0x00006DC5, 0x00006DFA,
+    0x00006DD9, 0x00006DE4, 0x00006DD5, 0x00006DEA, 0x00006DEE, 0x00006E2D, 0x00006E6E, 0x00006E2E,
+    0x00006E19, 0x00006E72, 0x00006E5F, 0x00006E3E, 0x00006E23, 0x00006E6B, 0x00006E2B, 0x00006E76,
+    0x00006E4D, 0x00006E1F, 0x00006E43, 0x00006E3A, 0x00006E4E, 0x00006E24, 0x00006EFF, 0x00006E1D,
+    0x00006E38, 0x00006E82, 0x00006EAA, 0x00006E98, 0x00006EC9, 0x00006EB7, 0x00006ED3, 0x00006EBD,
+    0x00006EAF, 0x00006EC4, 0x00006EB2, 0x00006ED4, 0x00006ED5, 0x00006E8F, 0x00006EA5, 0x00006EC2,
+    0x00006E9F, 0x00006F41, 0x00006F11, 0x0000704C, 0x00006EEC, 0x00006EF8, 0x00006EFE, 0x00006F3F,
+    0x00006EF2, 0x00006F31, 0x00006EEF, 0x00006F32, 0x00006ECC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE0 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00006F3E, 0x00006F13, 0x00006EF7, 0x00006F86, 0x00006F7A, 0x00006F78, 0x00006F81, 0x00006F80,
+    0x00006F6F, 0x00006F5B, 0x00006FF3, 0x00006F6D, 0x00006F82, 0x00006F7C, 0x00006F58, 0x00006F8E,
+    0x00006F91, 0x00006FC2, 0x00006F66, 0x00006FB3, 0x00006FA3, 0x00006FA1, 0x00006FA4, 0x00006FB9,
+    0x00006FC6, 0x00006FAA, 0x00006FDF, 0x00006FD5, 0x00006FEC, 0x00006FD4, 0x00006FD8, 0x00006FF1,
+    0x00006FEE, 0x00006FDB, 0x00007009, 0x0000700B, 0x00006FFA, 0x00007011, 0x00007001, 0x0000700F,
+    0x00006FFE, 0x0000701B, 0x0000701A, 0x00006F74, 0x0000701D, 0x00007018, 0x0000701F, 0x00007030,
+    0x0000703E, 0x00007032, 0x00007051, 0x00007063, 0x00007099, 0x00007092, 0x000070AF, 0x000070F1,
+    0x000070AC, 0x000070B8, 0x000070B3, 0x000070AE, 0x000070DF, 0x000070CB, 0x000070DD, 0xFFFFFFFF,
+    0x000070D9, 0x00007109, 0x000070FD, 0x0000711C, 0x00007119, 0x00007165, 0x00007155, 0x00007188,
+    0x00007166, 0x00007162, 0x0000714C, 0x00007156, 0x0000716C, 0x0000718F, 0x000071FB, 0x00007184,
+    0x00007195, 0x000071A8, 0x000071AC, 0x000071D7, 0x000071B9, 0x000071BE, 0x000071D2, 0x000071C9,
+    0x000071D4, 0x000071CE, 0x000071E0, 0x000071EC, 0x000071E7, 0x000071F5, 0x000071FC, 0x000071F9,
+    0x000071FF, 0x0000720D, 0x00007210, 0x0000721B, 0x00007228, 0x0000722D, 0x0000722C, 0x00007230,
+    0x00007232, 0x0000723B, 0x0000723C, 0x0000723F, 0x00007240, 0x00007246, 0x0000724B, 0x00007258,
+    0x00007274, 0x0000727E, 0x00007282, 0x00007281, 0x00007287, 0x00007292, 0x00007296, 0x000072A2,
+    0x000072A7, 0x000072B9, 0x000072B2, 0x000072C3, 0x000072C6, 0x000072C4, 0x000072CE, 0x000072D2,
+    0x000072E2, 0x000072E0, 0x000072E1, 0x000072F9, 0x000072F7, 0x0000500F, 0x00007317, 0x0000730A,
+    0x0000731C, 0x00007316, 0x0000731D, 0x00007334, 0x0000732F, 0x00007329, 0x00007325, 0x0000733E,
+    0x0000734E, 0x0000734F, 0x00009ED8, 0x00007357, 0x0000736A, 0x00007368, 0x00007370, 0x00007378,
+    0x00007375, 0x0000737B, 0x0000737A, 0x000073C8, 0x000073B3, 0x000073CE, 0x000073BB, 0x000073C0,
+    0x000073E5, 0x000073EE, 0x000073DE, 0x000074A2, 0x00007405, 0x0000746F, 0x00007425, 0x000073F8,
+    0x00007432, 0x0000743A, 0x00007455, 0x0000743F, 0x0000745F, 0x00007459, 0x00007441, 0x0000745C,
+    0x00007469, 0x00007470, 0x00007463, 0x0000746A, 0x00007476, 0x0000747E, 0x0000748B, 0x0000749E,
+    0x000074A7, 0x000074CA, 0x000074CF, 0x000074D4, 0x000073F1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE1 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000074E0, 0x000074E3, 0x000074E7, 0x000074E9, 0x000074EE, 0x000074F2, 0x000074F0, 0x000074F1,
+    0x000074F8, 0x000074F7, 0x00007504, 0x00007503, 0x00007505, 0x0000750C, 0x0000750E, 0x0000750D,
+    0x00007515, 0x00007513, 0x0000751E, 0x00007526, 0x0000752C, 0x0000753C, 0x00007544, 0x0000754D,
+    0x0000754A, 0x00007549, 0x0000755B, 0x00007546, 0x0000755A, 0x00007569, 0x00007564, 0x00007567,
+    0x0000756B, 0x0000756D, 0x00007578, 0x00007576, 0x00007586, 0x00007587, 0x00007574, 0x0000758A,
+    0x00007589, 0x00007582, 0x00007594, 0x0000759A, 0x0000759D, 0x000075A5, 0x000075A3, 0x000075C2,
+    0x000075B3, 0x000075C3, 0x000075B5, 0x000075BD, 0x000075B8, 0x000075BC, 0x000075B1, 0x000075CD,
+    0x000075CA, 0x000075D2, 0x000075D9, 0x000075E3, 0x000075DE, 0x000075FE, 0x000075FF, 0xFFFFFFFF,
+    0x000075FC, 0x00007601, 0x000075F0, 0x000075FA, 0x000075F2, 0x000075F3, 0x0000760B, 0x0000760D,
+    0x00007609, 0x0000761F, 0x00007627, 0x00007620, 0x00007621, 0x00007622, 0x00007624, 0x00007634,
+    0x00007630, 0x0000763B, 0x00007647, 0x00007648, 0x00007646, 0x0000765C, 0x00007658, 0x00007661,
+    0x00007662, 0x00007668, 0x00007669, 0x0000766A, 0x00007667, 0x0000766C, 0x00007670, 0x00007672,
+    0x00007676, 0x00007678, 0x0000767C, 0x00007680, 0x00007683, 0x00007688, 0x0000768B, 0x0000768E,
+    0x00007696, 0x00007693, 0x00007699, 0x0000769A, 0x000076B0, 0x000076B4, 0x000076B8, 0x000076B9,
+    0x000076BA, 0x000076C2, 0x000076CD, 0x000076D6, 0x000076D2, 0x000076DE, 0x000076E1, 0x000076E5,
+    0x000076E7, 0x000076EA, 0x0000862F, 0x000076FB, 0x00007708, 0x00007707, 0x00007704, 0x00007729,
+    0x00007724, 0x0000771E, 0x00007725, 0x00007726, 0x0000771B, 0x00007737, 0x00007738, 0x00007747,
+    0x0000775A, 0x00007768, 0x0000776B, 0x0000775B, 0x00007765, 0x0000777F, 0x0000777E, 0x00007779,
+    0x0000778E, 0x0000778B, 0x00007791, 0x000077A0, 0x0000779E, 0x000077B0, 0x000077B6, 0x000077B9,
+    0x000077BF, 0x000077BC, 0x000077BD, 0x000077BB, 0x000077C7, 0x000077CD, 0x000077D7, 0x000077DA,
+    0x000077DC, 0x000077E3, 0x000077EE, 0x000077FC, 0x0000780C, 0x00007812, 0x00007926, 0x00007820,
+    0x0000792A, 0x00007845, 0x0000788E, 0x00007874, 0x00007886, 0x0000787C, 0x0000789A, 0x0000788C,
+    0x000078A3, 0x000078B5, 0x000078AA, 0x000078AF, 0x000078D1, 0x000078C6, 0x000078CB, 0x000078D4,
+    0x000078BE, 0x000078BC, 0x000078C5, 0x000078CA, 0x000078EC, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE2 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000078E7, 0x000078DA, 0x000078FD, 0x000078F4, 0x00007907, 0x00007912, 0x00007911, 0x00007919,
+    0x0000792C, 0x0000792B, 0x00007940, 0x00007960, 0x00007957, 0x0000795F, 0x0000795A, 0x00007955,
+    0x00007953, 0x0000797A, 0x0000797F, 0x0000798A, 0x0000799D, 0x000079A7, 0x00009F4B, 0x000079AA,
+    0x000079AE, 0x000079B3, 0x000079B9, 0x000079BA, 0x000079C9, 0x000079D5, 0x000079E7, 0x000079EC,
+    0x000079E1, 0x000079E3, 0x00007A08, 0x00007A0D, 0x00007A18, 0x00007A19, 0x00007A20, 0x00007A1F,
+    0x00007980, 0x00007A31, 0x00007A3B, 0x00007A3E, 0x00007A37, 0x00007A43, 0x00007A57, 0x00007A49,
+    0x00007A61, 0x00007A62, 0x00007A69, 0x00009F9D, 0x00007A70, 0x00007A79, 0x00007A7D, 0x00007A88,
+    0x00007A97, 0x00007A95, 0x00007A98, 0x00007A96, 0x00007AA9, 0x00007AC8, 0x00007AB0, 0xFFFFFFFF,
+    0x00007AB6, 0x00007AC5, 0x00007AC4, 0x00007ABF, 0x00009083, 0x00007AC7, 0x00007ACA, 0x00007ACD,
+    0x00007ACF, 0x00007AD5, 0x00007AD3, 0x00007AD9, 0x00007ADA, 0x00007ADD, 0x00007AE1, 0x00007AE2,
+    0x00007AE6, 0x00007AED, 0x00007AF0, 0x00007B02, 0x00007B0F, 0x00007B0A, 0x00007B06, 0x00007B33,
+    0x00007B18, 0x00007B19, 0x00007B1E, 0x00007B35, 0x00007B28, 0x00007B36, 0x00007B50, 0x00007B7A,
+    0x00007B04, 0x00007B4D, 0x00007B0B, 0x00007B4C, 0x00007B45, 0x00007B75, 0x00007B65, 0x00007B74,
+    0x00007B67, 0x00007B70, 0x00007B71, 0x00007B6C, 0x00007B6E, 0x00007B9D, 0x00007B98, 0x00007B9F,
+    0x00007B8D, 0x00007B9C, 0x00007B9A, 0x00007B8B, 0x00007B92, 0x00007B8F, 0x00007B5D, 0x00007B99,
+    0x00007BCB, 0x00007BC1, 0x00007BCC, 0x00007BCF, 0x00007BB4, 0x00007BC6, 0x00007BDD, 0x00007BE9,
+    0x00007C11, 0x00007C14, 0x00007BE6, 0x00007BE5, 0x00007C60, 0x00007C00, 0x00007C07, 0x00007C13,
+    0x00007BF3, 0x00007BF7, 0x00007C17, 0x00007C0D, 0x00007BF6, 0x00007C23, 0x00007C27, 0x00007C2A,
+    0x00007C1F, 0x00007C37, 0x00007C2B, 0x00007C3D, 0x00007C4C, 0x00007C43, 0x00007C54, 0x00007C4F,
+    0x00007C40, 0x00007C50, 0x00007C58, 0x00007C5F, 0x00007C64, 0x00007C56, 0x00007C65, 0x00007C6C,
+    0x00007C75, 0x00007C83, 0x00007C90, 0x00007CA4, 0x00007CAD, 0x00007CA2, 0x00007CAB, 0x00007CA1,
+    0x00007CA8, 0x00007CB3, 0x00007CB2, 0x00007CB1, 0x00007CAE, 0x00007CB9, 0x00007CBD, 0x00007CC0,
+    0x00007CC5, 0x00007CC2, 0x00007CD8, 0x00007CD2, 0x00007CDC, 0x00007CE2, 0x00009B3B, 0x00007CEF,
+    0x00007CF2, 0x00007CF4, 0x00007CF6, 0x00007CFA, 0x00007D06, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE3 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00007D02, 0x00007D1C, 0x00007D15, 0x00007D0A, 0x00007D45, 0x00007D4B, 0x00007D2E, 0x00007D32,
+    0x00007D3F, 0x00007D35, 0x00007D46, 0x00007D73, 0x00007D56, 0x00007D4E, 0x00007D72, 0x00007D68,
+    0x00007D6E, 0x00007D4F, 0x00007D63, 0x00007D93, 0x00007D89, 0x00007D5B, 0x00007D8F, 0x00007D7D,
+    0x00007D9B, 0x00007DBA, 0x00007DAE, 0x00007DA3, 0x00007DB5, 0x00007DC7, 0x00007DBD, 0x00007DAB,
+    0x00007E3D, 0x00007DA2, 0x00007DAF, 0x00007DDC, 0x00007DB8, 0x00007D9F, 0x00007DB0, 0x00007DD8,
+    0x00007DDD, 0x00007DE4, 0x00007DDE, 0x00007DFB, 0x00007DF2, 0x00007DE1, 0x00007E05, 0x00007E0A,
+    0x00007E23, 0x00007E21, 0x00007E12, 0x00007E31, 0x00007E1F, 0x00007E09, 0x00007E0B, 0x00007E22,
+    0x00007E46, 0x00007E66, 0x00007E3B, 0x00007E35, 0x00007E39, 0x00007E43, 0x00007E37, 0xFFFFFFFF,
+    0x00007E32, 0x00007E3A, 0x00007E67, 0x00007E5D, 0x00007E56, 0x00007E5E, 0x00007E59, 0x00007E5A,
+    0x00007E79, 0x00007E6A, 0x00007E69, 0x00007E7C, 0x00007E7B, 0x00007E83, 0x00007DD5, 0x00007E7D,
+    0x00008FAE, 0x00007E7F, 0x00007E88, 0x00007E89, 0x00007E8C, 0x00007E92, 0x00007E90, 0x00007E93,
+    0x00007E94, 0x00007E96, 0x00007E8E, 0x00007E9B, 0x00007E9C, 0x00007F38, 0x00007F3A, 0x00007F45,
+    0x00007F4C, 0x00007F4D, 0x00007F4E, 0x00007F50, 0x00007F51, 0x00007F55, 0x00007F54, 0x00007F58,
+    0x00007F5F, 0x00007F60, 0x00007F68, 0x00007F69, 0x00007F67, 0x00007F78, 0x00007F82, 0x00007F86,
+    0x00007F83, 0x00007F88, 0x00007F87, 0x00007F8C, 0x00007F94, 0x00007F9E, 0x00007F9D, 0x00007F9A,
+    0x00007FA3, 0x00007FAF, 0x00007FB2, 0x00007FB9, 0x00007FAE, 0x00007FB6, 0x00007FB8, 0x00008B71,
+    0x00007FC5, 0x00007FC6, 0x00007FCA, 0x00007FD5, 0x00007FD4, 0x00007FE1, 0x00007FE6, 0x00007FE9,
+    0x00007FF3, 0x00007FF9, 0x000098DC, 0x00008006, 0x00008004, 0x0000800B, 0x00008012, 0x00008018,
+    0x00008019, 0x0000801C, 0x00008021, 0x00008028, 0x0000803F, 0x0000803B, 0x0000804A, 0x00008046,
+    0x00008052, 0x00008058, 0x0000805A, 0x0000805F, 0x00008062, 0x00008068, 0x00008073, 0x00008072,
+    0x00008070, 0x00008076, 0x00008079, 0x0000807D, 0x0000807F, 0x00008084, 0x00008086, 0x00008085,
+    0x0000809B, 0x00008093, 0x0000809A, 0x000080AD, 0x00005190, 0x000080AC, 0x000080DB, 0x000080E5,
+    0x000080D9, 0x000080DD, 0x000080C4, 0x000080DA, 0x000080D6, 0x00008109, 0x000080EF, 0x000080F1,
+    0x0000811B, 0x00008129, 0x00008123, 0x0000812F, 0x0000814B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE4 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x0000968B, 0x00008146, 0x0000813E, 0x00008153, 0x00008151, 0x000080FC, 0x00008171, 0x0000816E,
+    0x00008165, 0x00008166, 0x00008174, 0x00008183, 0x00008188, 0x0000818A, 0x00008180, 0x00008182,
+    0x000081A0, 0x00008195, 0x000081A4, 0x000081A3, 0x0000815F, 0x00008193, 0x000081A9, 0x000081B0,
+    0x000081B5, 0x000081BE, 0x000081B8, 0x000081BD, 0x000081C0, 0x000081C2, 0x000081BA, 0x000081C9,
+    0x000081CD, 0x000081D1, 0x000081D9, 0x000081D8, 0x000081C8, 0x000081DA, 0x000081DF, 0x000081E0,
+    0x000081E7, 0x000081FA, 0x000081FB, 0x000081FE, 0x00008201, 0x00008202, 0x00008205, 0x00008207,
+    0x0000820A, 0x0000820D, 0x00008210, 0x00008216, 0x00008229, 0x0000822B, 0x00008238, 0x00008233,
+    0x00008240, 0x00008259, 0x00008258, 0x0000825D, 0x0000825A, 0x0000825F, 0x00008264, 0xFFFFFFFF,
+    0x00008262, 0x00008268, 0x0000826A, 0x0000826B, 0x0000822E, 0x00008271, 0x00008277, 0x00008278,
+    0x0000827E, 0x0000828D, 0x00008292, 0x000082AB, 0x0000829F, 0x000082BB, 0x000082AC, 0x000082E1,
+    0x000082E3, 0x000082DF, 0x000082D2, 0x000082F4, 0x000082F3, 0x000082FA, 0x00008393, 0x00008303,
+    0x000082FB, 0x000082F9, 0x000082DE, 0x00008306, 0x000082DC, 0x00008309, 0x000082D9, 0x00008335,
+    0x00008334, 0x00008316, 0x00008332, 0x00008331, 0x00008340, 0x00008339, 0x00008350, 0x00008345,
+    0x0000832F, 0x0000832B, 0x00008317, 0x00008318, 0x00008385, 0x0000839A, 0x000083AA, 0x0000839F,
+    0x000083A2, 0x00008396, 0x00008323, 0x0000838E, 0x00008387, 0x0000838A, 0x0000837C, 0x000083B5,
+    0x00008373, 0x00008375, 0x000083A0, 0x00008389, 0x000083A8, 0x000083F4, 0x00008413, 0x000083EB,
+    0x000083CE, 0x000083FD, 0x00008403, 0x000083D8, 0x0000840B, 0x000083C1, 0x000083F7, 0x00008407,
+    0x000083E0, 0x000083F2, 0x0000840D, 0x00008422, 0x00008420, 0x000083BD, 0x00008438, 0x00008506,
+    0x000083FB, 0x0000846D, 0x0000842A, 0x0000843C, 0x0000855A, 0x00008484, 0x00008477, 0x0000846B,
+    0x000084AD, 0x0000846E, 0x00008482, 0x00008469, 0x00008446, 0x0000842C, 0x0000846F, 0x00008479,
+    0x00008435, 0x000084CA, 0x00008462, 0x000084B9, 0x000084BF, 0x0000849F, 0x000084D9, 0x000084CD,
+    0x000084BB, 0x000084DA, 0x000084D0, 0x000084C1, 0x000084C6, 0x000084D6, 0x000084A1, 0x00008521,
+    0x000084FF, 0x000084F4, 0x00008517, 0x00008518, 0x0000852C, 0x0000851F, 0x00008515, 0x00008514,
+    0x000084FC, 0x00008540, 0x00008563, 0x00008558, 0x00008548, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE5 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00008541, 0x00008602, 0x0000854B, 0x00008555, 0x00008580, 0x000085A4, 0x00008588, 0x00008591,
+    0x0000858A, 0x000085A8, 0x0000856D, 0x00008594, 0x0000859B, 0x000085EA, 0x00008587, 0x0000859C,
+    0x00008577, 0x0000857E, 0x00008590, 0x000085C9, 0x000085BA, 0x000085CF, 0x000085B9, 0x000085D0,
+    0x000085D5, 0x000085DD, 0x000085E5, 0x000085DC, 0x000085F9, 0x0000860A, 0x00008613, 0x0000860B,
+    0x000085FE, 0x000085FA, 0x00008606, 0x00008622, 0x0000861A, 0x00008630, 0x0000863F, 0x0000864D,
+    0x00004E55, 0x00008654, 0x0000865F, 0x00008667, 0x00008671, 0x00008693, 0x000086A3, 0x000086A9,
+    0x000086AA, 0x0000868B, 0x0000868C, 0x000086B6, 0x000086AF, 0x000086C4, 0x000086C6, 0x000086B0,
+    0x000086C9, 0x00008823, 0x000086AB, 0x000086D4, 0x000086DE, 0x000086E9, 0x000086EC, 0xFFFFFFFF,
+    0x000086DF, 0x000086DB, 0x000086EF, 0x00008712, 0x00008706, 0x00008708, 0x00008700, 0x00008703,
+    0x000086FB, 0x00008711, 0x00008709, 0x0000870D, 0x000086F9, 0x0000870A, 0x00008734, 0x0000873F,
+    0x00008737, 0x0000873B, 0x00008725, 0x00008729, 0x0000871A, 0x00008760, 0x0000875F, 0x00008778,
+    0x0000874C, 0x0000874E, 0x00008774, 0x00008757, 0x00008768, 0x0000876E, 0x00008759, 0x00008753,
+    0x00008763, 0x0000876A, 0x00008805, 0x000087A2, 0x0000879F, 0x00008782, 0x000087AF, 0x000087CB,
+    0x000087BD, 0x000087C0, 0x000087D0, 0x000096D6, 0x000087AB, 0x000087C4, 0x000087B3, 0x000087C7,
+    0x000087C6, 0x000087BB, 0x000087EF, 0x000087F2, 0x000087E0, 0x0000880F, 0x0000880D, 0x000087FE,
+    0x000087F6, 0x000087F7, 0x0000880E, 0x000087D2, 0x00008811, 0x00008816, 0x00008815, 0x00008822,
+    0x00008821, 0x00008831, 0x00008836, 0x00008839, 0x00008827, 0x0000883B, 0x00008844, 0x00008842,
+    0x00008852, 0x00008859, 0x0000885E, 0x00008862, 0x0000886B, 0x00008881, 0x0000887E, 0x0000889E,
+    0x00008875, 0x0000887D, 0x000088B5, 0x00008872, 0x00008882, 0x00008897, 0x00008892, 0x000088AE,
+    0x00008899, 0x000088A2, 0x0000888D, 0x000088A4, 0x000088B0, 0x000088BF, 0x000088B1, 0x000088C3,
+    0x000088C4, 0x000088D4, 0x000088D8, 0x000088D9, 0x000088DD, 0x000088F9, 0x00008902, 0x000088FC,
+    0x000088F4, 0x000088E8, 0x000088F2, 0x00008904, 0x0000890C, 0x0000890A, 0x00008913, 0x00008943,
+    0x0000891E, 0x00008925, 0x0000892A, 0x0000892B, 0x00008941, 0x00008944, 0x0000893B, 0x00008936,
+    0x00008938, 0x0000894C, 0x0000891D, 0x00008960, 0x0000895E, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE6 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00008966, 0x00008964, 0x0000896D, 0x0000896A, 0x0000896F, 0x00008974, 0x00008977, 0x0000897E,
+    0x00008983, 0x00008988, 0x0000898A, 0x00008993, 0x00008998, 0x000089A1, 0x000089A9, 0x000089A6,
+    0x000089AC, 0x000089AF, 0x000089B2, 0x000089BA, 0x000089BD, 0x000089BF, 0x000089C0, 0x000089DA,
+    0x000089DC, 0x000089DD, 0x000089E7, 0x000089F4, 0x000089F8, 0x00008A03, 0x00008A16, 0x00008A10,
+    0x00008A0C, 0x00008A1B, 0x00008A1D, 0x00008A25, 0x00008A36, 0x00008A41, 0x00008A5B, 0x00008A52,
+    0x00008A46, 0x00008A48, 0x00008A7C, 0x00008A6D, 0x00008A6C, 0x00008A62, 0x00008A85, 0x00008A82,
+    0x00008A84, 0x00008AA8, 0x00008AA1, 0x00008A91, 0x00008AA5, 0x00008AA6, 0x00008A9A, 0x00008AA3,
+    0x00008AC4, 0x00008ACD, 0x00008AC2, 0x00008ADA, 0x00008AEB, 0x00008AF3, 0x00008AE7, 0xFFFFFFFF,
+    0x00008AE4, 0x00008AF1, 0x00008B14, 0x00008AE0, 0x00008AE2, 0x00008AF7, 0x00008ADE, 0x00008ADB,
+    0x00008B0C, 0x00008B07, 0x00008B1A, 0x00008AE1, 0x00008B16, 0x00008B10, 0x00008B17, 0x00008B20,
+    0x00008B33, 0x000097AB, 0x00008B26, 0x00008B2B, 0x00008B3E, 0x00008B28, 0x00008B41, 0x00008B4C,
+    0x00008B4F, 0x00008B4E, 0x00008B49, 0x00008B56, 0x00008B5B, 0x00008B5A, 0x00008B6B, 0x00008B5F,
+    0x00008B6C, 0x00008B6F, 0x00008B74, 0x00008B7D, 0x00008B80, 0x00008B8C, 0x00008B8E, 0x00008B92,
+    0x00008B93, 0x00008B96, 0x00008B99, 0x00008B9A, 0x00008C3A, 0x00008C41, 0x00008C3F, 0x00008C48,
+    0x00008C4C, 0x00008C4E, 0x00008C50, 0x00008C55, 0x00008C62, 0x00008C6C, 0x00008C78, 0x00008C7A,
+    0x00008C82, 0x00008C89, 0x00008C85, 0x00008C8A, 0x00008C8D, 0x00008C8E, 0x00008C94, 0x00008C7C,
+    0x00008C98, 0x0000621D, 0x00008CAD, 0x00008CAA, 0x00008CBD, 0x00008CB2, 0x00008CB3, 0x00008CAE,
+    0x00008CB6, 0x00008CC8, 0x00008CC1, 0x00008CE4, 0x00008CE3, 0x00008CDA, 0x00008CFD, 0x00008CFA,
+    0x00008CFB, 0x00008D04, 0x00008D05, 0x00008D0A, 0x00008D07, 0x00008D0F, 0x00008D0D, 0x00008D10,
+    0x00009F4E, 0x00008D13, 0x00008CCD, 0x00008D14, 0x00008D16, 0x00008D67, 0x00008D6D, 0x00008D71,
+    0x00008D73, 0x00008D81, 0x00008D99, 0x00008DC2, 0x00008DBE, 0x00008DBA, 0x00008DCF, 0x00008DDA,
+    0x00008DD6, 0x00008DCC, 0x00008DDB, 0x00008DCB, 0x00008DEA, 0x00008DEB, 0x00008DDF, 0x00008DE3,
+    0x00008DFC, 0x00008E08, 0x00008E09, 0x00008DFF, 0x00008E1D, 0x00008E1E, 0x00008E10, 0x00008E1F,
+    0x00008E42, 0x00008E35, 0x00008E30, 0x00008E34, 0x00008E4A, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE7 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00008E47, 0x00008E49, 0x00008E4C, 0x00008E50, 0x00008E48, 0x00008E59, 0x00008E64, 0x00008E60,
+    0x00008E2A, 0x00008E63, 0x00008E55, 0x00008E76, 0x00008E72, 0x00008E7C, 0x00008E81, 0x00008E87,
+    0x00008E85, 0x00008E84, 0x00008E8B, 0x00008E8A, 0x00008E93, 0x00008E91, 0x00008E94, 0x00008E99,
+    0x00008EAA, 0x00008EA1, 0x00008EAC, 0x00008EB0, 0x00008EC6, 0x00008EB1, 0x00008EBE, 0x00008EC5,
+    0x00008EC8, 0x00008ECB, 0x00008EDB, 0x00008EE3, 0x00008EFC, 0x00008EFB, 0x00008EEB, 0x00008EFE,
+    0x00008F0A, 0x00008F05, 0x00008F15, 0x00008F12, 0x00008F19, 0x00008F13, 0x00008F1C, 0x00008F1F,
+    0x00008F1B, 0x00008F0C, 0x00008F26, 0x00008F33, 0x00008F3B, 0x00008F39, 0x00008F45, 0x00008F42,
+    0x00008F3E, 0x00008F4C, 0x00008F49, 0x00008F46, 0x00008F4E, 0x00008F57, 0x00008F5C, 0xFFFFFFFF,
+    0x00008F62, 0x00008F63, 0x00008F64, 0x00008F9C, 0x00008F9F, 0x00008FA3, 0x00008FAD, 0x00008FAF,
+    0x00008FB7, 0x00008FDA, 0x00008FE5, 0x00008FE2, 0x00008FEA, 0x00008FEF, 0x00009087, 0x00008FF4,
+    0x00009005, 0x00008FF9, 0x00008FFA, 0x00009011, 0x00009015, 0x00009021, 0x0000900D, 0x0000901E,
+    0x00009016, 0x0000900B, 0x00009027, 0x00009036, 0x00009035, 0x00009039, 0x00008FF8, 0x0000904F,
+    0x00009050, 0x00009051, 0x00009052, 0x0000900E, 0x00009049, 0x0000903E, 0x00009056, 0x00009058,
+    0x0000905E, 0x00009068, 0x0000906F, 0x00009076, 0x000096A8, 0x00009072, 0x00009082, 0x0000907D,
+    0x00009081, 0x00009080, 0x0000908A, 0x00009089, 0x0000908F, 0x000090A8, 0x000090AF, 0x000090B1,
+    0x000090B5, 0x000090E2, 0x000090E4, 0x00006248, 0x000090DB, 0x00009102, 0x00009112, 0x00009119,
+    0x00009132, 0x00009130, 0x0000914A, 0x00009156, 0x00009158, 0x00009163, 0x00009165, 0x00009169,
+    0x00009173, 0x00009172, 0x0000918B, 0x00009189, 0x00009182, 0x000091A2, 0x000091AB, 0x000091AF,
+    0x000091AA, 0x000091B5, 0x000091B4, 0x000091BA, 0x000091C0, 0x000091C1, 0x000091C9, 0x000091CB,
+    0x000091D0, 0x000091D6, 0x000091DF, 0x000091E1, 0x000091DB, 0x000091FC, 0x000091F5, 0x000091F6,
+    0x0000921E, 0x000091FF, 0x00009214, 0x0000922C, 0x00009215, 0x00009211, 0x0000925E, 0x00009257,
+    0x00009245, 0x00009249, 0x00009264, 0x00009248, 0x00009295, 0x0000923F, 0x0000924B, 0x00009250,
+    0x0000929C, 0x00009296, 0x00009293, 0x0000929B, 0x0000925A, 0x000092CF, 0x000092B9, 0x000092B7,
+    0x000092E9, 0x0000930F, 0x000092FA, 0x00009344, 0x0000932E, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE8 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00009319, 0x00009322, 0x0000931A, 0x00009323, 0x0000933A, 0x00009335, 0x0000933B, 0x0000935C,
+    0x00009360, 0x0000937C, 0x0000936E, 0x00009356, 0x000093B0, 0x000093AC, 0x000093AD, 0x00009394,
+    0x000093B9, 0x000093D6, 0x000093D7, 0x000093E8, 0x000093E5, 0x000093D8, 0x000093C3, 0x000093DD,
+    0x000093D0, 0x000093C8, 0x000093E4, 0x0000941A, 0x00009414, 0x00009413, 0x00009403, 0x00009407,
+    0x00009410, 0x00009436, 0x0000942B, 0x00009435, 0x00009421, 0x0000943A, 0x00009441, 0x00009452,
+    0x00009444, 0x0000945B, 0x00009460, 0x00009462, 0x0000945E, 0x0000946A, 0x00009229, 0x00009470,
+    0x00009475, 0x00009477, 0x0000947D, 0x0000945A, 0x0000947C, 0x0000947E, 0x00009481, 0x0000947F,
+    0x00009582, 0x00009587, 0x0000958A, 0x00009594, 0x00009596, 0x00009598, 0x00009599, 0xFFFFFFFF,
+    0x000095A0, 0x000095A8, 0x000095A7, 0x000095AD, 0x000095BC, 0x000095BB, 0x000095B9, 0x000095BE,
+    0x000095CA, 0x00006FF6, 0x000095C3, 0x000095CD, 0x000095CC, 0x000095D5, 0x000095D4, 0x000095D6,
+    0x000095DC, 0x000095E1, 0x000095E5, 0x000095E2, 0x00009621, 0x00009628, 0x0000962E, 0x0000962F,
+    0x00009642, 0x0000964C, 0x0000964F, 0x0000964B, 0x00009677, 0x0000965C, 0x0000965E, 0x0000965D,
+    0x0000965F, 0x00009666, 0x00009672, 0x0000966C, 0x0000968D, 0x00009698, 0x00009695, 0x00009697,
+    0x000096AA, 0x000096A7, 0x000096B1, 0x000096B2, 0x000096B0, 0x000096B4, 0x000096B6, 0x000096B8,
+    0x000096B9, 0x000096CE, 0x000096CB, 0x000096C9, 0x000096CD, 0x0000894D, 0x000096DC, 0x0000970D,
+    0x000096D5, 0x000096F9, 0x00009704, 0x00009706, 0x00009708, 0x00009713, 0x0000970E, 0x00009711,
+    0x0000970F, 0x00009716, 0x00009719, 0x00009724, 0x0000972A, 0x00009730, 0x00009739, 0x0000973D,
+    0x0000973E, 0x00009744, 0x00009746, 0x00009748, 0x00009742, 0x00009749, 0x0000975C, 0x00009760,
+    0x00009764, 0x00009766, 0x00009768, 0x000052D2, 0x0000976B, 0x00009771, 0x00009779, 0x00009785,
+    0x0000977C, 0x00009781, 0x0000977A, 0x00009786, 0x0000978B, 0x0000978F, 0x00009790, 0x0000979C,
+    0x000097A8, 0x000097A6, 0x000097A3, 0x000097B3, 0x000097B4, 0x000097C3, 0x000097C6, 0x000097C8,
+    0x000097CB, 0x000097DC, 0x000097ED, 0x00009F4F, 0x000097F2, 0x00007ADF, 0x000097F6, 0x000097F5,
+    0x0000980F, 0x0000980C, 0x00009838, 0x00009824, 0x00009821, 0x00009837, 0x0000983D, 0x00009846,
+    0x0000984F, 0x0000984B, 0x0000986B, 0x0000986F, 0x00009870, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xE9 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00009871, 0x00009874, 0x00009873, 0x000098AA, 0x000098AF, 0x000098B1, 0x000098B6, 0x000098C4,
+    0x000098C3, 0x000098C6, 0x000098E9, 0x000098EB, 0x00009903, 0x00009909, 0x00009912, 0x00009914,
+    0x00009918, 0x00009921, 0x0000991D, 0x0000991E, 0x00009924, 0x00009920, 0x0000992C, 0x0000992E,
+    0x0000993D, 0x0000993E, 0x00009942, 0x00009949, 0x00009945, 0x00009950, 0x0000994B, 0x00009951,
+    0x00009952, 0x0000994C, 0x00009955, 0x00009997, 0x00009998, 0x000099A5, 0x000099AD, 0x000099AE,
+    0x000099BC, 0x000099DF, 0x000099DB, 0x000099DD, 0x000099D8, 0x000099D1, 0x000099ED, 0x000099EE,
+    0x000099F1, 0x000099F2, 0x000099FB, 0x000099F8, 0x00009A01, 0x00009A0F, 0x00009A05, 0x000099E2,
+    0x00009A19, 0x00009A2B, 0x00009A37, 0x00009A45, 0x00009A42, 0x00009A40, 0x00009A43, 0xFFFFFFFF,
+    0x00009A3E, 0x00009A55, 0x00009A4D, 0x00009A5B, 0x00009A57, 0x00009A5F, 0x00009A62, 0x00009A65,
+    0x00009A64, 0x00009A69, 0x00009A6B, 0x00009A6A, 0x00009AAD, 0x00009AB0, 0x00009ABC, 0x00009AC0,
+    0x00009ACF, 0x00009AD1, 0x00009AD3, 0x00009AD4, 0x00009ADE, 0x00009ADF, 0x00009AE2, 0x00009AE3,
+    0x00009AE6, 0x00009AEF, 0x00009AEB, 0x00009AEE, 0x00009AF4, 0x00009AF1, 0x00009AF7, 0x00009AFB,
+    0x00009B06, 0x00009B18, 0x00009B1A, 0x00009B1F, 0x00009B22, 0x00009B23, 0x00009B25, 0x00009B27,
+    0x00009B28, 0x00009B29, 0x00009B2A, 0x00009B2E, 0x00009B2F, 0x00009B32, 0x00009B44, 0x00009B43,
+    0x00009B4F, 0x00009B4D, 0x00009B4E, 0x00009B51, 0x00009B58, 0x00009B74, 0x00009B93, 0x00009B83,
+    0x00009B91, 0x00009B96, 0x00009B97, 0x00009B9F, 0x00009BA0, 0x00009BA8, 0x00009BB4, 0x00009BC0,
+    0x00009BCA, 0x00009BB9, 0x00009BC6, 0x00009BCF, 0x00009BD1, 0x00009BD2, 0x00009BE3, 0x00009BE2,
+    0x00009BE4, 0x00009BD4, 0x00009BE1, 0x00009C3A, 0x00009BF2, 0x00009BF1, 0x00009BF0, 0x00009C15,
+    0x00009C14, 0x00009C09, 0x00009C13, 0x00009C0C, 0x00009C06, 0x00009C08, 0x00009C12, 0x00009C0A,
+    0x00009C04, 0x00009C2E, 0x00009C1B, 0x00009C25, 0x00009C24, 0x00009C21, 0x00009C30, 0x00009C47,
+    0x00009C32, 0x00009C46, 0x00009C3E, 0x00009C5A, 0x00009C60, 0x00009C67, 0x00009C76, 0x00009C78,
+    0x00009CE7, 0x00009CEC, 0x00009CF0, 0x00009D09, 0x00009D08, 0x00009CEB, 0x00009D03, 0x00009D06,
+    0x00009D2A, 0x00009D26, 0x00009DAF, 0x00009D23, 0x00009D1F, 0x00009D44, 0x00009D15, 0x00009D12,
+    0x00009D41, 0x00009D3F, 0x00009D3E, 0x00009D46, 0x00009D48, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xEA */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00009D5D, 0x00009D5E, 0x00009D64, 0x00009D51, 0x00009D50, 0x00009D59, 0x00009D72, 0x00009D89,
+    0x00009D87, 0x00009DAB, 0x00009D6F, 0x00009D7A, 0x00009D9A, 0x00009DA4, 0x00009DA9, 0x00009DB2,
+    0x00009DC4, 0x00009DC1, 0x00009DBB, 0x00009DB8, 0x00009DBA, 0x00009DC6, 0x00009DCF, 0x00009DC2,
+    0x00009DD9, 0x00009DD3, 0x00009DF8, 0x00009DE6, 0x00009DED, 0x00009DEF, 0x00009DFD, 0x00009E1A,
+    0x00009E1B, 0x00009E1E, 0x00009E75, 0x00009E79, 0x00009E7D, 0x00009E81, 0x00009E88, 0x00009E8B,
+    0x00009E8C, 0x00009E92, 0x00009E95, 0x00009E91, 0x00009E9D, 0x00009EA5, 0x00009EA9, 0x00009EB8,
+    0x00009EAA, 0x00009EAD, 0x00009761, 0x00009ECC, 0x00009ECE, 0x00009ECF, 0x00009ED0, 0x00009ED4,
+    0x00009EDC, 0x00009EDE, 0x00009EDD, 0x00009EE0, 0x00009EE5, 0x00009EE8, 0x00009EEF, 0xFFFFFFFF,
+    0x00009EF4, 0x00009EF6, 0x00009EF7, 0x00009EF9, 0x00009EFB, 0x00009EFC, 0x00009EFD, 0x00009F07,
+    0x00009F08, 0x000076B7, 0x00009F15, 0x00009F21, 0x00009F2C, 0x00009F3E, 0x00009F4A, 0x00009F52,
+    0x00009F54, 0x00009F63, 0x00009F5F, 0x00009F60, 0x00009F61, 0x00009F66, 0x00009F67, 0x00009F6C,
+    0x00009F6A, 0x00009F77, 0x00009F72, 0x00009F76, 0x00009F95, 0x00009F9C, 0x00009FA0, 0x0000582F,
+    0x000069C7, 0x00009059, 0x00007464, 0x000051DC, 0x00007199, 0x00005653, 0x00005DE2, 0x00005E14,
+    0x00005E18, 0x00005E58, 0x00005E5E, 0x00005EBE, 0x0000F928, 0x00005ECB, 0x00005EF9, 0x00005F00,
+    0x00005F02, 0x00005F07, 0x00005F1D, 0x00005F23, 0x00005F34, 0x00005F36, 0x00005F3D, 0x00005F40,
+    0x00005F45, 0x00005F54, 0x00005F58, 0x00005F64, 0x00005F67, 0x00005F7D, 0x00005F89, 0x00005F9C,
+    0x00005FA7, 0x00005FAF, 0x00005FB5, 0x00005FB7, 0x00005FC9, 0x00005FDE, 0x00005FE1, 0x00005FE9,
+    0x0000600D, 0x00006014, 0x00006018, 0x00006033, 0x00006035, 0x00006047, 0x0000FA3D, 0x0000609D,
+    0x0000609E, 0x000060CB, 0x000060D4, 0x000060D5, 0x000060DD, 0x000060F8, 0x0000611C, 0x0000612B,
+    0x00006130, 0x00006137, 0x0000FA3E, 0x0000618D, 0x0000FA3F, 0x000061BC, 0x000061B9, 0x0000FA40,
+    0x00006222, 0x0000623E, 0x00006243, 0x00006256, 0x0000625A, 0x0000626F, 0x00006285, 0x000062C4,
+    0x000062D6, 0x000062FC, 0x0000630A, 0x00006318, 0x00006339, 0x00006343, 0x00006365, 0x0000637C,
+    0x000063E5, 0x000063ED, 0x000063F5, 0x00006410, 0x00006414, 0x00006422, 0x00006479, 0x00006451,
+    0x00006460, 0x0000646D, 0x000064CE, 0x000064BE, 0x000064BF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xEB */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000064C4, 0x000064CA, 0x000064D0, 0x000064F7, 0x000064FB, 0x00006522, 0x00006529, 0x0000FA41,
+    0x00006567, 0x0000659D, 0x0000FA42, 0x00006600, 0x00006609, 0x00006615, 0x0000661E, 0x0000663A,
+    0x00006622, 0x00006624, 0x0000662B, 0x00006630, 0x00006631, 0x00006633, 0x000066FB, 0x00006648,
+    0x0000664C, 0x000231C4, 0x00006659, 0x0000665A, 0x00006661, 0x00006665, 0x00006673, 0x00006677,
+    0x00006678, 0x0000668D, 0x0000FA43, 0x000066A0, 0x000066B2, 0x000066BB, 0x000066C6, 0x000066C8,
+    0x00003B22, 0x000066DB, 0x000066E8, 0x000066FA, 0x00006713, 0x0000F929, 0x00006733, 0x00006766,
+    0x00006747, 0x00006748, 0x0000677B, 0x00006781, 0x00006793, 0x00006798, 0x0000679B, 0x000067BB,
+    0x000067F9, 0x000067C0, 0x000067D7, 0x000067FC, 0x00006801, 0x00006852, 0x0000681D, 0xFFFFFFFF,
+    0x0000682C, 0x00006831, 0x0000685B, 0x00006872, 0x00006875, 0x0000FA44, 0x000068A3, 0x000068A5,
+    0x000068B2, 0x000068C8, 0x000068D0, 0x000068E8, 0x000068ED, 0x000068F0, 0x000068F1, 0x000068FC,
+    0x0000690A, 0x00006949, 0x000235C4, 0x00006935, 0x00006942, 0x00006957, 0x00006963, 0x00006964,
+    0x00006968, 0x00006980, 0x0000FA14, 0x000069A5, 0x000069AD, 0x000069CF, 0x00003BB6, 0x00003BC3,
+    0x000069E2, 0x000069E9, 0x000069EA, 0x000069F5, 0x000069F6, 0x00006A0F, 0x00006A15, 0x0002373F,
+    0x00006A3B, 0x00006A3E, 0x00006A45, 0x00006A50, 0x00006A56, 0x00006A5B, 0x00006A6B, 0x00006A73,
+    0x00023763, 0x00006A89, 0x00006A94, 0x00006A9D, 0x00006A9E, 0x00006AA5, 0x00006AE4, 0x00006AE7,
+    0x00003C0F, 0x0000F91D, 0x00006B1B, 0x00006B1E, 0x00006B2C, 0x00006B35, 0x00006B46, 0x00006B56,
+    0x00006B60, 0x00006B65, 0x00006B67, 0x00006B77, 0x00006B82, 0x00006BA9, 0x00006BAD, 0x0000F970,
+    0x00006BCF, 0x00006BD6, 0x00006BD7, 0x00006BFF, 0x00006C05, 0x00006C10, 0x00006C33, 0x00006C59,
+    0x00006C5C, 0x00006CAA, 0x00006C74, 0x00006C76, 0x00006C85, 0x00006C86, 0x00006C98, 0x00006C9C,
+    0x00006CFB, 0x00006CC6, 0x00006CD4, 0x00006CE0, 0x00006CEB, 0x00006CEE, 0x00023CFE, 0x00006D04,
+    0x00006D0E, 0x00006D2E, 0x00006D31, 0x00006D39, 0x00006D3F, 0x00006D58, 0x00006D65, 0x0000FA45,
+    0x00006D82, 0x00006D87, 0x00006D89, 0x00006D94, 0x00006DAA, 0x00006DAC, 0x00006DBF, 0x00006DC4,
+    0x00006DD6, 0x00006DDA, 0x00006DDB, 0x00006DDD, 0x00006DFC, 0x0000FA46, 0x00006E34, 0x00006E44,
+    0x00006E5C, 0x00006E5E, 0x00006EAB, 0x00006EB1, 0x00006EC1, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xEC */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00006EC7, 0x00006ECE, 0x00006F10, 0x00006F1A, 0x0000FA47, 0x00006F2A, 0x00006F2F, 0x00006F33,
+    0x00006F51, 0x00006F59, 0x00006F5E, 0x00006F61, 0x00006F62, 0x00006F7E, 0x00006F88, 0x00006F8C,
+    0x00006F8D, 0x00006F94, 0x00006FA0, 0x00006FA7, 0x00006FB6, 0x00006FBC, 0x00006FC7, 0x00006FCA,
+    0x00006FF9, 0x00006FF0, 0x00006FF5, 0x00007005, 0x00007006, 0x00007028, 0x0000704A, 0x0000705D,
+    0x0000705E, 0x0000704E, 0x00007064, 0x00007075, 0x00007085, 0x000070A4, 0x000070AB, 0x000070B7,
+    0x000070D4, 0x000070D8, 0x000070E4, 0x0000710F, 0x0000712B, 0x0000711E, 0x00007120, 0x0000712E,
+    0x00007130, 0x00007146, 0x00007147, 0x00007151, 0x0000FA48, 0x00007152, 0x0000715C, 0x00007160,
+    0x00007168, 0x0000FA15, 0x00007185, 0x00007187, 0x00007192, 0x000071C1, 0x000071BA, 0xFFFFFFFF,
+    0x000071C4, 0x000071FE, 0x00007200, 0x00007215, 0x00007255, 0x00007256, 0x00003E3F, 0x0000728D,
+    0x0000729B, 0x000072BE, 0x000072C0, 0x000072FB, 0x000247F1, 0x00007327, 0x00007328, 0x0000FA16,
+    0x00007350, 0x00007366, 0x0000737C, 0x00007395, 0x0000739F, 0x000073A0, 0x000073A2, 0x000073A6,
+    0x000073AB, 0x000073C9, 0x000073CF, 0x000073D6, 0x000073D9, 0x000073E3, 0x000073E9, 0x00007407,
+    0x0000740A, 0x0000741A, 0x0000741B, 0x0000FA4A, 0x00007426, 0x00007428, 0x0000742A, 0x0000742B,
+    0x0000742C, 0x0000742E, 0x0000742F, 0x00007430, 0x00007444, 0x00007446, 0x00007447, 0x0000744B,
+    0x00007457, 0x00007462, 0x0000746B, 0x0000746D, 0x00007486, 0x00007487, 0x00007489, 0x00007498,
+    0x0000749C, 0x0000749F, 0x000074A3, 0x00007490, 0x000074A6, 0x000074A8, 0x000074A9, 0x000074B5,
+    0x000074BF, 0x000074C8, 0x000074C9, 0x000074DA, 0x000074FF, 0x00007501, 0x00007517, 0x0000752F,
+    0x0000756F, 0x00007579, 0x00007592, 0x00003F72, 0x000075CE, 0x000075E4, 0x00007600, 0x00007602,
+    0x00007608, 0x00007615, 0x00007616, 0x00007619, 0x0000761E, 0x0000762D, 0x00007635, 0x00007643,
+    0x0000764B, 0x00007664, 0x00007665, 0x0000766D, 0x0000766F, 0x00007671, 0x00007681, 0x0000769B,
+    0x0000769D, 0x0000769E, 0x000076A6, 0x000076AA, 0x000076B6, 0x000076C5, 0x000076CC, 0x000076CE,
+    0x000076D4, 0x000076E6, 0x000076F1, 0x000076FC, 0x0000770A, 0x00007719, 0x00007734, 0x00007736,
+    0x00007746, 0x0000774D, 0x0000774E, 0x0000775C, 0x0000775F, 0x00007762, 0x0000777A, 0x00007780,
+    0x00007794, 0x000077AA, 0x000077E0, 0x0000782D, 0x0002548E, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xED */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00007843, 0x0000784E, 0x0000784F, 0x00007851, 0x00007868, 0x0000786E, 0x0000FA4B, 0x000078B0,
+    0x0002550E, 0x000078AD, 0x000078E4, 0x000078F2, 0x00007900, 0x000078F7, 0x0000791C, 0x0000792E,
+    0x00007931, 0x00007934, 0x0000FA4C, 0x0000FA4D, 0x00007945, 0x00007946, 0x0000FA4E, 0x0000FA4F,
+    0x0000FA50, 0x0000795C, 0x0000FA51, 0x0000FA19, 0x0000FA1A, 0x00007979, 0x0000FA52, 0x0000FA53,
+    0x0000FA1B, 0x00007998, 0x000079B1, 0x000079B8, 0x000079C8, 0x000079CA, 0x00025771, 0x000079D4,
+    0x000079DE, 0x000079EB, 0x000079ED, 0x00007A03, 0x0000FA54, 0x00007A39, 0x00007A5D, 0x00007A6D,
+    0x0000FA55, 0x00007A85, 0x00007AA0, 0x000259C4, 0x00007AB3, 0x00007ABB, 0x00007ACE, 0x00007AEB,
+    0x00007AFD, 0x00007B12, 0x00007B2D, 0x00007B3B, 0x00007B47, 0x00007B4E, 0x00007B60, 0xFFFFFFFF,
+    0x00007B6D, 0x00007B6F, 0x00007B72, 0x00007B9E, 0x0000FA56, 0x00007BD7, 0x00007BD9, 0x00007C01,
+    0x00007C31, 0x00007C1E, 0x00007C20, 0x00007C33, 0x00007C36, 0x00004264, 0x00025DA1, 0x00007C59,
+    0x00007C6D, 0x00007C79, 0x00007C8F, 0x00007C94, 0x00007CA0, 0x00007CBC, 0x00007CD5, 0x00007CD9,
+    0x00007CDD, 0x00007D07, 0x00007D08, 0x00007D13, 0x00007D1D, 0x00007D23, 0x00007D31, 0x00007D41,
+    0x00007D48, 0x00007D53, 0x00007D5C, 0x00007D7A, 0x00007D83, 0x00007D8B, 0x00007DA0, 0x00007DA6,
+    0x00007DC2, 0x00007DCC, 0x00007DD6, 0x00007DE3, 0x0000FA57, 0x00007E28, 0x00007E08, 0x00007E11,
+    0x00007E15, 0x0000FA59, 0x00007E47, 0x00007E52, 0x00007E61, 0x00007E8A, 0x00007E8D, 0x00007F47,
+    0x0000FA5A, 0x00007F91, 0x00007F97, 0x00007FBF, 0x00007FCE, 0x00007FDB, 0x00007FDF, 0x00007FEC,
+    0x00007FEE, 0x00007FFA, 0x0000FA5B, 0x00008014, 0x00008026, 0x00008035, 0x00008037, 0x0000803C,
+    0x000080CA, 0x000080D7, 0x000080E0, 0x000080F3, 0x00008118, 0x0000814A, 0x00008160, 0x00008167,
+    0x00008168, 0x0000816D, 0x000081BB, 0x000081CA, 0x000081CF, 0x000081D7, 0x0000FA5C, 0x00004453,
+    0x0000445B, 0x00008260, 0x00008274, 0x00026AFF, 0x0000828E, 0x000082A1, 0x000082A3, 0x000082A4,
+    0x000082A9, 0x000082AE, 0x000082B7, 0x000082BE, 0x000082BF, 0x000082C6, 0x000082D5, 0x000082FD,
+    0x000082FE, 0x00008300, 0x00008301, 0x00008362, 0x00008322, 0x0000832D, 0x0000833A, 0x00008343,
+    0x00008347, 0x00008351, 0x00008355, 0x0000837D, 0x00008386, 0x00008392, 0x00008398, 0x000083A7,
+    0x000083A9, 0x000083BF, 0x000083C0, 0x000083C7, 0x000083CF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xEE */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000083D1, 0x000083E1, 0x000083EA, 0x00008401, 0x00008406, 0x0000840A, 0x0000FA5F, 0x00008448,
+    0x0000845F, 0x00008470, 0x00008473, 0x00008485, 0x0000849E, 0x000084AF, 0x000084B4, 0x000084BA,
+    0x000084C0, 0x000084C2, 0x00026E40, 0x00008532, 0x0000851E, 0x00008523, 0x0000852F, 0x00008559,
+    0x00008564, 0x0000FA1F, 0x000085AD, 0x0000857A, 0x0000858C, 0x0000858F, 0x000085A2, 0x000085B0,
+    0x000085CB, 0x000085CE, 0x000085ED, 0x00008612, 0x000085FF, 0x00008604, 0x00008605, 0x00008610,
+    0x000270F4, 0x00008618, 0x00008629, 0x00008638, 0x00008657, 0x0000865B, 0x0000F936, 0x00008662,
+    0x0000459D, 0x0000866C, 0x00008675, 0x00008698, 0x000086B8, 0x000086FA, 0x000086FC, 0x000086FD,
+    0x0000870B, 0x00008771, 0x00008787, 0x00008788, 0x000087AC, 0x000087AD, 0x000087B5, 0xFFFFFFFF,
+    0x000045EA, 0x000087D6, 0x000087EC, 0x00008806, 0x0000880A, 0x00008810, 0x00008814, 0x0000881F,
+    0x00008898, 0x000088AA, 0x000088CA, 0x000088CE, 0x00027684, 0x000088F5, 0x0000891C, 0x0000FA60,
+    0x00008918, 0x00008919, 0x0000891A, 0x00008927, 0x00008930, 0x00008932, 0x00008939, 0x00008940,
+    0x00008994, 0x0000FA61, 0x000089D4, 0x000089E5, 0x000089F6, 0x00008A12, 0x00008A15, 0x00008A22,
+    0x00008A37, 0x00008A47, 0x00008A4E, 0x00008A5D, 0x00008A61, 0x00008A75, 0x00008A79, 0x00008AA7,
+    0x00008AD0, 0x00008ADF, 0x00008AF4, 0x00008AF6, 0x0000FA22, 0x0000FA62, 0x0000FA63, 0x00008B46,
+    0x00008B54, 0x00008B59, 0x00008B69, 0x00008B9D, 0x00008C49, 0x00008C68, 0x0000FA64, 0x00008CE1,
+    0x00008CF4, 0x00008CF8, 0x00008CFE, 0x0000FA65, 0x00008D12, 0x00008D1B, 0x00008DAF, 0x00008DCE,
+    0x00008DD1, 0x00008DD7, 0x00008E20, 0x00008E23, 0x00008E3D, 0x00008E70, 0x00008E7B, 0x00028277,
+    0x00008EC0, 0x00004844, 0x00008EFA, 0x00008F1E, 0x00008F2D, 0x00008F36, 0x00008F54, 0x000283CD,
+    0x00008FA6, 0x00008FB5, 0x00008FE4, 0x00008FE8, 0x00008FEE, 0x00009008, 0x0000902D, 0x0000FA67,
+    0x00009088, 0x00009095, 0x00009097, 0x00009099, 0x0000909B, 0x000090A2, 0x000090B3, 0x000090BE,
+    0x000090C4, 0x000090C5, 0x000090C7, 0x000090D7, 0x000090DD, 0x000090DE, 0x000090EF, 0x000090F4,
+    0x0000FA26, 0x00009114, 0x00009115, 0x00009116, 0x00009122, 0x00009123, 0x00009127, 0x0000912F,
+    0x00009131, 0x00009134, 0x0000913D, 0x00009148, 0x0000915B, 0x00009183, 0x0000919E, 0x000091AC,
+    0x000091B1, 0x000091BC, 0x000091D7, 0x000091FB, 0x000091E4, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xEF */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000091E5, 0x000091ED, 0x000091F1, 0x00009207, 0x00009210, 0x00009238, 0x00009239, 0x0000923A,
+    0x0000923C, 0x00009240, 0x00009243, 0x0000924F, 0x00009278, 0x00009288, 0x000092C2, 0x000092CB,
+    0x000092CC, 0x000092D3, 0x000092E0, 0x000092FF, 0x00009304, 0x0000931F, 0x00009321, 0x00009325,
+    0x00009348, 0x00009349, 0x0000934A, 0x00009364, 0x00009365, 0x0000936A, 0x00009370, 0x0000939B,
+    0x000093A3, 0x000093BA, 0x000093C6, 0x000093DE, 0x000093DF, 0x00009404, 0x000093FD, 0x00009433,
+    0x0000944A, 0x00009463, 0x0000946B, 0x00009471, 0x00009472, 0x0000958E, 0x0000959F, 0x000095A6,
+    0x000095A9, 0x000095AC, 0x000095B6, 0x000095BD, 0x000095CB, 0x000095D0, 0x000095D3, 0x000049B0,
+    0x000095DA, 0x000095DE, 0x00009658, 0x00009684, 0x0000F9DC, 0x0000969D, 0x000096A4, 0xFFFFFFFF,
+    0x000096A5, 0x000096D2, 0x000096DE, 0x0000FA68, 0x000096E9, 0x000096EF, 0x00009733, 0x0000973B,
+    0x0000974D, 0x0000974E, 0x0000974F, 0x0000975A, 0x0000976E, 0x00009773, 0x00009795, 0x000097AE,
+    0x000097BA, 0x000097C1, 0x000097C9, 0x000097DE, 0x000097DB, 0x000097F4, 0x0000FA69, 0x0000980A,
+    0x0000981E, 0x0000982B, 0x00009830, 0x0000FA6A, 0x00009852, 0x00009853, 0x00009856, 0x00009857,
+    0x00009859, 0x0000985A, 0x0000F9D0, 0x00009865, 0x0000986C, 0x000098BA, 0x000098C8, 0x000098E7,
+    0x00009958, 0x0000999E, 0x00009A02, 0x00009A03, 0x00009A24, 0x00009A2D, 0x00009A2E, 0x00009A38,
+    0x00009A4A, 0x00009A4E, 0x00009A52, 0x00009AB6, 0x00009AC1, 0x00009AC3, 0x00009ACE, 0x00009AD6,
+    0x00009AF9, 0x00009B02, 0x00009B08, 0x00009B20, 0x00004C17, 0x00009B2D, 0x00009B5E, 0x00009B79,
+    0x00009B66, 0x00009B72, 0x00009B75, 0x00009B84, 0x00009B8A, 0x00009B8F, 0x00009B9E, 0x00009BA7,
+    0x00009BC1, 0x00009BCE, 0x00009BE5, 0x00009BF8, 0x00009BFD, 0x00009C00, 0x00009C23, 0x00009C41,
+    0x00009C4F, 0x00009C50, 0x00009C53, 0x00009C63, 0x00009C65, 0x00009C77, 0x00009D1D, 0x00009D1E,
+    0x00009D43, 0x00009D47, 0x00009D52, 0x00009D63, 0x00009D70, 0x00009D7C, 0x00009D8A, 0x00009D96,
+    0x00009DC0, 0x00009DAC, 0x00009DBC, 0x00009DD7, 0x0002A190, 0x00009DE7, 0x00009E07, 0x00009E15,
+    0x00009E7C, 0x00009E9E, 0x00009EA4, 0x00009EAC, 0x00009EAF, 0x00009EB4, 0x00009EB5, 0x00009EC3,
+    0x00009ED1, 0x00009F10, 0x00009F39, 0x00009F57, 0x00009F90, 0x00009F94, 0x00009F97, 0x00009FA2,
+    0x000059F8, 0x00005C5B, 0x00005E77, 0x00007626, 0x00007E6B, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF0 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00020089, 0x00004E02, 0x00004E0F, 0x00004E12, 0x00004E29, 0x00004E2B, 0x00004E2E, 0x00004E40,
+    0x00004E47, 0x00004E48, 0x000200A2, 0x00004E51, 0x00003406, 0x000200A4, 0x00004E5A, 0x00004E69,
+    0x00004E9D, 0x0000342C, 0x0000342E, 0x00004EB9, 0x00004EBB, 0x000201A2, 0x00004EBC, 0x00004EC3,
+    0x00004EC8, 0x00004ED0, 0x00004EEB, 0x00004EDA, 0x00004EF1, 0x00004EF5, 0x00004F00, 0x00004F16,
+    0x00004F64, 0x00004F37, 0x00004F3E, 0x00004F54, 0x00004F58, 0x00020213, 0x00004F77, 0x00004F78,
+    0x00004F7A, 0x00004F7D, 0x00004F82, 0x00004F85, 0x00004F92, 0x00004F9A, 0x00004FE6, 0x00004FB2,
+    0x00004FBE, 0x00004FC5, 0x00004FCB, 0x00004FCF, 0x00004FD2, 0x0000346A, 0x00004FF2, 0x00005000,
+    0x00005010, 0x00005013, 0x0000501C, 0x0000501E, 0x00005022, 0x00003468, 0x00005042, 0xFFFFFFFF,
+    0x00005046, 0x0000504E, 0x00005053, 0x00005057, 0x00005063, 0x00005066, 0x0000506A, 0x00005070,
+    0x000050A3, 0x00005088, 0x00005092, 0x00005093, 0x00005095, 0x00005096, 0x0000509C, 0x000050AA,
+    0x0002032B, 0x000050B1, 0x000050BA, 0x000050BB, 0x000050C4, 0x000050C7, 0x000050F3, 0x00020381,
+    0x000050CE, 0x00020371, 0x000050D4, 0x000050D9, 0x000050E1, 0x000050E9, 0x00003492, 0x00005B96,
+    0x00005BAC, 0x00003761, 0x00005BC0, 0x00003762, 0x00005BCE, 0x00005BD6, 0x0000376C, 0x0000376B,
+    0x00005BF1, 0x00005BFD, 0x00003775, 0x00005C03, 0x00005C29, 0x00005C30, 0x00021C56, 0x00005C5F,
+    0x00005C63, 0x00005C67, 0x00005C68, 0x00005C69, 0x00005C70, 0x00021D2D, 0x00021D45, 0x00005C7C,
+    0x00021D78, 0x00021D62, 0x00005C88, 0x00005C8A, 0x000037C1, 0x00021DA1, 0x00021D9C, 0x00005CA0,
+    0x00005CA2, 0x00005CA6, 0x00005CA7, 0x00021D92, 0x00005CAD, 0x00005CB5, 0x00021DB7, 0x00005CC9,
+    0x00021DE0, 0x00021E33, 0x00005D06, 0x00005D10, 0x00005D2B, 0x00005D1D, 0x00005D20, 0x00005D24,
+    0x00005D26, 0x00005D31, 0x00005D39, 0x00005D42, 0x000037E8, 0x00005D61, 0x00005D6A, 0x000037F4,
+    0x00005D70, 0x00021F1E, 0x000037FD, 0x00005D88, 0x00003800, 0x00005D92, 0x00005D94, 0x00005D97,
+    0x00005D99, 0x00005DB0, 0x00005DB2, 0x00005DB4, 0x00021F76, 0x00005DB9, 0x00005DD1, 0x00005DD7,
+    0x00005DD8, 0x00005DE0, 0x00021FFA, 0x00005DE4, 0x00005DE9, 0x0000382F, 0x00005E00, 0x00003836,
+    0x00005E12, 0x00005E15, 0x00003840, 0x00005E1F, 0x00005E2E, 0x00005E3E, 0x00005E49, 0x0000385C,
+    0x00005E56, 0x00003861, 0x00005E6B, 0x00005E6C, 0x00005E6D, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF1 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00005108, 0x000203F9, 0x00005117, 0x0000511B, 0x0002044A, 0x00005160, 0x00020509, 0x00005173,
+    0x00005183, 0x0000518B, 0x000034BC, 0x00005198, 0x000051A3, 0x000051AD, 0x000034C7, 0x000051BC,
+    0x000205D6, 0x00020628, 0x000051F3, 0x000051F4, 0x00005202, 0x00005212, 0x00005216, 0x0002074F,
+    0x00005255, 0x0000525C, 0x0000526C, 0x00005277, 0x00005284, 0x00005282, 0x00020807, 0x00005298,
+    0x0002083A, 0x000052A4, 0x000052A6, 0x000052AF, 0x000052BA, 0x000052BB, 0x000052CA, 0x0000351F,
+    0x000052D1, 0x000208B9, 0x000052F7, 0x0000530A, 0x0000530B, 0x00005324, 0x00005335, 0x0000533E,
+    0x00005342, 0x0002097C, 0x0002099D, 0x00005367, 0x0000536C, 0x0000537A, 0x000053A4, 0x000053B4,
+    0x00020AD3, 0x000053B7, 0x000053C0, 0x00020B1D, 0x0000355D, 0x0000355E, 0x000053D5, 0xFFFFFFFF,
+    0x000053DA, 0x00003563, 0x000053F4, 0x000053F5, 0x00005455, 0x00005424, 0x00005428, 0x0000356E,
+    0x00005443, 0x00005462, 0x00005466, 0x0000546C, 0x0000548A, 0x0000548D, 0x00005495, 0x000054A0,
+    0x000054A6, 0x000054AD, 0x000054AE, 0x000054B7, 0x000054BA, 0x000054BF, 0x000054C3, 0x00020D45,
+    0x000054EC, 0x000054EF, 0x000054F1, 0x000054F3, 0x00005500, 0x00005501, 0x00005509, 0x0000553C,
+    0x00005541, 0x000035A6, 0x00005547, 0x0000554A, 0x000035A8, 0x00005560, 0x00005561, 0x00005564,
+    0x00020DE1, 0x0000557D, 0x00005582, 0x00005588, 0x00005591, 0x000035C5, 0x000055D2, 0x00020E95,
+    0x00020E6D, 0x000055BF, 0x000055C9, 0x000055CC, 0x000055D1, 0x000055DD, 0x000035DA, 0x000055E2,
+    0x00020E64, 0x000055E9, 0x00005628, 0x00020F5F, 0x00005607, 0x00005610, 0x00005630, 0x00005637,
+    0x000035F4, 0x0000563D, 0x0000563F, 0x00005640, 0x00005647, 0x0000565E, 0x00005660, 0x0000566D,
+    0x00003605, 0x00005688, 0x0000568C, 0x00005695, 0x0000569A, 0x0000569D, 0x000056A8, 0x000056AD,
+    0x000056B2, 0x000056C5, 0x000056CD, 0x000056DF, 0x000056E8, 0x000056F6, 0x000056F7, 0x00021201,
+    0x00005715, 0x00005723, 0x00021255, 0x00005729, 0x0002127B, 0x00005745, 0x00005746, 0x0000574C,
+    0x0000574D, 0x00021274, 0x00005768, 0x0000576F, 0x00005773, 0x00005774, 0x00005775, 0x0000577B,
+    0x000212E4, 0x000212D7, 0x000057AC, 0x0000579A, 0x0000579D, 0x0000579E, 0x000057A8, 0x000057D7,
+    0x000212FD, 0x000057CC, 0x00021336, 0x00021344, 0x000057DE, 0x000057E6, 0x000057F0, 0x0000364A,
+    0x000057F8, 0x000057FB, 0x000057FD, 0x00005804, 0x0000581E, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF2 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00005820, 0x00005827, 0x00005832, 0x00005839, 0x000213C4, 0x00005849, 0x0000584C, 0x00005867,
+    0x0000588A, 0x0000588B, 0x0000588D, 0x0000588F, 0x00005890, 0x00005894, 0x0000589D, 0x000058AA,
+    0x000058B1, 0x0002146D, 0x000058C3, 0x000058CD, 0x000058E2, 0x000058F3, 0x000058F4, 0x00005905,
+    0x00005906, 0x0000590B, 0x0000590D, 0x00005914, 0x00005924, 0x000215D7, 0x00003691, 0x0000593D,
+    0x00003699, 0x00005946, 0x00003696, 0x00026C29, 0x0000595B, 0x0000595F, 0x00021647, 0x00005975,
+    0x00005976, 0x0000597C, 0x0000599F, 0x000059AE, 0x000059BC, 0x000059C8, 0x000059CD, 0x000059DE,
+    0x000059E3, 0x000059E4, 0x000059E7, 0x000059EE, 0x00021706, 0x00021742, 0x000036CF, 0x00005A0C,
+    0x00005A0D, 0x00005A17, 0x00005A27, 0x00005A2D, 0x00005A55, 0x00005A65, 0x00005A7A, 0xFFFFFFFF,
+    0x00005A8B, 0x00005A9C, 0x00005A9F, 0x00005AA0, 0x00005AA2, 0x00005AB1, 0x00005AB3, 0x00005AB5,
+    0x00005ABA, 0x00005ABF, 0x00005ADA, 0x00005ADC, 0x00005AE0, 0x00005AE5, 0x00005AF0, 0x00005AEE,
+    0x00005AF5, 0x00005B00, 0x00005B08, 0x00005B17, 0x00005B34, 0x00005B2D, 0x00005B4C, 0x00005B52,
+    0x00005B68, 0x00005B6F, 0x00005B7C, 0x00005B7F, 0x00005B81, 0x00005B84, 0x000219C3, 0x00005E6E,
+    0x0002217B, 0x00005EA5, 0x00005EAA, 0x00005EAC, 0x00005EB9, 0x00005EBF, 0x00005EC6, 0x00005ED2,
+    0x00005ED9, 0x0002231E, 0x00005EFD, 0x00005F08, 0x00005F0E, 0x00005F1C, 0x000223AD, 0x00005F1E,
+    0x00005F47, 0x00005F63, 0x00005F72, 0x00005F7E, 0x00005F8F, 0x00005FA2, 0x00005FA4, 0x00005FB8,
+    0x00005FC4, 0x000038FA, 0x00005FC7, 0x00005FCB, 0x00005FD2, 0x00005FD3, 0x00005FD4, 0x00005FE2,
+    0x00005FEE, 0x00005FEF, 0x00005FF3, 0x00005FFC, 0x00003917, 0x00006017, 0x00006022, 0x00006024,
+    0x0000391A, 0x0000604C, 0x0000607F, 0x0000608A, 0x00006095, 0x000060A8, 0x000226F3, 0x000060B0,
+    0x000060B1, 0x000060BE, 0x000060C8, 0x000060D9, 0x000060DB, 0x000060EE, 0x000060F2, 0x000060F5,
+    0x00006110, 0x00006112, 0x00006113, 0x00006119, 0x0000611E, 0x0000613A, 0x0000396F, 0x00006141,
+    0x00006146, 0x00006160, 0x0000617C, 0x0002285B, 0x00006192, 0x00006193, 0x00006197, 0x00006198,
+    0x000061A5, 0x000061A8, 0x000061AD, 0x000228AB, 0x000061D5, 0x000061DD, 0x000061DF, 0x000061F5,
+    0x0002298F, 0x00006215, 0x00006223, 0x00006229, 0x00006246, 0x0000624C, 0x00006251, 0x00006252,
+    0x00006261, 0x00006264, 0x0000627B, 0x0000626D, 0x00006273, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF3 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00006299, 0x000062A6, 0x000062D5, 0x00022AB8, 0x000062FD, 0x00006303, 0x0000630D, 0x00006310,
+    0x00022B4F, 0x00022B50, 0x00006332, 0x00006335, 0x0000633B, 0x0000633C, 0x00006341, 0x00006344,
+    0x0000634E, 0x00022B46, 0x00006359, 0x00022C1D, 0x00022BA6, 0x0000636C, 0x00006384, 0x00006399,
+    0x00022C24, 0x00006394, 0x000063BD, 0x000063F7, 0x000063D4, 0x000063D5, 0x000063DC, 0x000063E0,
+    0x000063EB, 0x000063EC, 0x000063F2, 0x00006409, 0x0000641E, 0x00006425, 0x00006429, 0x0000642F,
+    0x0000645A, 0x0000645B, 0x0000645D, 0x00006473, 0x0000647D, 0x00006487, 0x00006491, 0x0000649D,
+    0x0000649F, 0x000064CB, 0x000064CC, 0x000064D5, 0x000064D7, 0x00022DE1, 0x000064E4, 0x000064E5,
+    0x000064FF, 0x00006504, 0x00003A6E, 0x0000650F, 0x00006514, 0x00006516, 0x00003A73, 0xFFFFFFFF,
+    0x0000651E, 0x00006532, 0x00006544, 0x00006554, 0x0000656B, 0x0000657A, 0x00006581, 0x00006584,
+    0x00006585, 0x0000658A, 0x000065B2, 0x000065B5, 0x000065B8, 0x000065BF, 0x000065C2, 0x000065C9,
+    0x000065D4, 0x00003AD6, 0x000065F2, 0x000065F9, 0x000065FC, 0x00006604, 0x00006608, 0x00006621,
+    0x0000662A, 0x00006645, 0x00006651, 0x0000664E, 0x00003AEA, 0x000231C3, 0x00006657, 0x0000665B,
+    0x00006663, 0x000231F5, 0x000231B6, 0x0000666A, 0x0000666B, 0x0000666C, 0x0000666D, 0x0000667B,
+    0x00006680, 0x00006690, 0x00006692, 0x00006699, 0x00003B0E, 0x000066AD, 0x000066B1, 0x000066B5,
+    0x00003B1A, 0x000066BF, 0x00003B1C, 0x000066EC, 0x00003AD7, 0x00006701, 0x00006705, 0x00006712,
+    0x00023372, 0x00006719, 0x000233D3, 0x000233D2, 0x0000674C, 0x0000674D, 0x00006754, 0x0000675D,
+    0x000233D0, 0x000233E4, 0x000233D5, 0x00006774, 0x00006776, 0x000233DA, 0x00006792, 0x000233DF,
+    0x00008363, 0x00006810, 0x000067B0, 0x000067B2, 0x000067C3, 0x000067C8, 0x000067D2, 0x000067D9,
+    0x000067DB, 0x000067F0, 0x000067F7, 0x0002344A, 0x00023451, 0x0002344B, 0x00006818, 0x0000681F,
+    0x0000682D, 0x00023465, 0x00006833, 0x0000683B, 0x0000683E, 0x00006844, 0x00006845, 0x00006849,
+    0x0000684C, 0x00006855, 0x00006857, 0x00003B77, 0x0000686B, 0x0000686E, 0x0000687A, 0x0000687C,
+    0x00006882, 0x00006890, 0x00006896, 0x00003B6D, 0x00006898, 0x00006899, 0x0000689A, 0x0000689C,
+    0x000068AA, 0x000068AB, 0x000068B4, 0x000068BB, 0x000068FB, 0x000234E4, 0x0002355A, 0x0000FA13,
+    0x000068C3, 0x000068C5, 0x000068CC, 0x000068CF, 0x000068D6, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF4 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000068D9, 0x000068E4, 0x000068E5, 0x000068EC, 0x000068F7, 0x00006903, 0x00006907, 0x00003B87,
+    0x00003B88, 0x00023594, 0x0000693B, 0x00003B8D, 0x00006946, 0x00006969, 0x0000696C, 0x00006972,
+    0x0000697A, 0x0000697F, 0x00006992, 0x00003BA4, 0x00006996, 0x00006998, 0x000069A6, 0x000069B0,
+    0x000069B7, 0x000069BA, 0x000069BC, 0x000069C0, 0x000069D1, 0x000069D6, 0x00023639, 0x00023647,
+    0x00006A30, 0x00023638, 0x0002363A, 0x000069E3, 0x000069EE, 0x000069EF, 0x000069F3, 0x00003BCD,
+    0x000069F4, 0x000069FE, 0x00006A11, 0x00006A1A, 0x00006A1D, 0x0002371C, 0x00006A32, 0x00006A33,
+    0x00006A34, 0x00006A3F, 0x00006A46, 0x00006A49, 0x00006A7A, 0x00006A4E, 0x00006A52, 0x00006A64,
+    0x0002370C, 0x00006A7E, 0x00006A83, 0x00006A8B, 0x00003BF0, 0x00006A91, 0x00006A9F, 0xFFFFFFFF,
+    0x00006AA1, 0x00023764, 0x00006AAB, 0x00006ABD, 0x00006AC6, 0x00006AD4, 0x00006AD0, 0x00006ADC,
+    0x00006ADD, 0x000237FF, 0x000237E7, 0x00006AEC, 0x00006AF1, 0x00006AF2, 0x00006AF3, 0x00006AFD,
+    0x00023824, 0x00006B0B, 0x00006B0F, 0x00006B10, 0x00006B11, 0x0002383D, 0x00006B17, 0x00003C26,
+    0x00006B2F, 0x00006B4A, 0x00006B58, 0x00006B6C, 0x00006B75, 0x00006B7A, 0x00006B81, 0x00006B9B,
+    0x00006BAE, 0x00023A98, 0x00006BBD, 0x00006BBE, 0x00006BC7, 0x00006BC8, 0x00006BC9, 0x00006BDA,
+    0x00006BE6, 0x00006BE7, 0x00006BEE, 0x00006BF1, 0x00006C02, 0x00006C0A, 0x00006C0E, 0x00006C35,
+    0x00006C36, 0x00006C3A, 0x00023C7F, 0x00006C3F, 0x00006C4D, 0x00006C5B, 0x00006C6D, 0x00006C84,
+    0x00006C89, 0x00003CC3, 0x00006C94, 0x00006C95, 0x00006C97, 0x00006CAD, 0x00006CC2, 0x00006CD0,
+    0x00003CD2, 0x00006CD6, 0x00006CDA, 0x00006CDC, 0x00006CE9, 0x00006CEC, 0x00006CED, 0x00023D00,
+    0x00006D00, 0x00006D0A, 0x00006D24, 0x00006D26, 0x00006D27, 0x00006C67, 0x00006D2F, 0x00006D3C,
+    0x00006D5B, 0x00006D5E, 0x00006D60, 0x00006D70, 0x00006D80, 0x00006D81, 0x00006D8A, 0x00006D8D,
+    0x00006D91, 0x00006D98, 0x00023D40, 0x00006E17, 0x00023DFA, 0x00023DF9, 0x00023DD3, 0x00006DAB,
+    0x00006DAE, 0x00006DB4, 0x00006DC2, 0x00006D34, 0x00006DC8, 0x00006DCE, 0x00006DCF, 0x00006DD0,
+    0x00006DDF, 0x00006DE9, 0x00006DF6, 0x00006E36, 0x00006E1E, 0x00006E22, 0x00006E27, 0x00003D11,
+    0x00006E32, 0x00006E3C, 0x00006E48, 0x00006E49, 0x00006E4B, 0x00006E4C, 0x00006E4F, 0x00006E51,
+    0x00006E53, 0x00006E54, 0x00006E57, 0x00006E63, 0x00003D1E, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF5 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00006E93, 0x00006EA7, 0x00006EB4, 0x00006EBF, 0x00006EC3, 0x00006ECA, 0x00006ED9, 0x00006F35,
+    0x00006EEB, 0x00006EF9, 0x00006EFB, 0x00006F0A, 0x00006F0C, 0x00006F18, 0x00006F25, 0x00006F36,
+    0x00006F3C, 0x00023F7E, 0x00006F52, 0x00006F57, 0x00006F5A, 0x00006F60, 0x00006F68, 0x00006F98,
+    0x00006F7D, 0x00006F90, 0x00006F96, 0x00006FBE, 0x00006F9F, 0x00006FA5, 0x00006FAF, 0x00003D64,
+    0x00006FB5, 0x00006FC8, 0x00006FC9, 0x00006FDA, 0x00006FDE, 0x00006FE9, 0x00024096, 0x00006FFC,
+    0x00007000, 0x00007007, 0x0000700A, 0x00007023, 0x00024103, 0x00007039, 0x0000703A, 0x0000703C,
+    0x00007043, 0x00007047, 0x0000704B, 0x00003D9A, 0x00007054, 0x00007065, 0x00007069, 0x0000706C,
+    0x0000706E, 0x00007076, 0x0000707E, 0x00007081, 0x00007086, 0x00007095, 0x00007097, 0xFFFFFFFF,
+    0x000070BB, 0x000241C6, 0x0000709F, 0x000070B1, 0x000241FE, 0x000070EC, 0x000070CA, 0x000070D1,
+    0x000070D3, 0x000070DC, 0x00007103, 0x00007104, 0x00007106, 0x00007107, 0x00007108, 0x0000710C,
+    0x00003DC0, 0x0000712F, 0x00007131, 0x00007150, 0x0000714A, 0x00007153, 0x0000715E, 0x00003DD4,
+    0x00007196, 0x00007180, 0x0000719B, 0x000071A0, 0x000071A2, 0x000071AE, 0x000071AF, 0x000071B3,
+    0x000243BC, 0x000071CB, 0x000071D3, 0x000071D9, 0x000071DC, 0x00007207, 0x00003E05, 0x0000FA49,
+    0x0000722B, 0x00007234, 0x00007238, 0x00007239, 0x00004E2C, 0x00007242, 0x00007253, 0x00007257,
+    0x00007263, 0x00024629, 0x0000726E, 0x0000726F, 0x00007278, 0x0000727F, 0x0000728E, 0x000246A5,
+    0x000072AD, 0x000072AE, 0x000072B0, 0x000072B1, 0x000072C1, 0x00003E60, 0x000072CC, 0x00003E66,
+    0x00003E68, 0x000072F3, 0x000072FA, 0x00007307, 0x00007312, 0x00007318, 0x00007319, 0x00003E83,
+    0x00007339, 0x0000732C, 0x00007331, 0x00007333, 0x0000733D, 0x00007352, 0x00003E94, 0x0000736B,
+    0x0000736C, 0x00024896, 0x0000736E, 0x0000736F, 0x00007371, 0x00007377, 0x00007381, 0x00007385,
+    0x0000738A, 0x00007394, 0x00007398, 0x0000739C, 0x0000739E, 0x000073A5, 0x000073A8, 0x000073B5,
+    0x000073B7, 0x000073B9, 0x000073BC, 0x000073BF, 0x000073C5, 0x000073CB, 0x000073E1, 0x000073E7,
+    0x000073F9, 0x00007413, 0x000073FA, 0x00007401, 0x00007424, 0x00007431, 0x00007439, 0x00007453,
+    0x00007440, 0x00007443, 0x0000744D, 0x00007452, 0x0000745D, 0x00007471, 0x00007481, 0x00007485,
+    0x00007488, 0x00024A4D, 0x00007492, 0x00007497, 0x00007499, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF6 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x000074A0, 0x000074A1, 0x000074A5, 0x000074AA, 0x000074AB, 0x000074B9, 0x000074BB, 0x000074BA,
+    0x000074D6, 0x000074D8, 0x000074DE, 0x000074EF, 0x000074EB, 0x00024B56, 0x000074FA, 0x00024B6F,
+    0x00007520, 0x00007524, 0x0000752A, 0x00003F57, 0x00024C16, 0x0000753D, 0x0000753E, 0x00007540,
+    0x00007548, 0x0000754E, 0x00007550, 0x00007552, 0x0000756C, 0x00007572, 0x00007571, 0x0000757A,
+    0x0000757D, 0x0000757E, 0x00007581, 0x00024D14, 0x0000758C, 0x00003F75, 0x000075A2, 0x00003F77,
+    0x000075B0, 0x000075B7, 0x000075BF, 0x000075C0, 0x000075C6, 0x000075CF, 0x000075D3, 0x000075DD,
+    0x000075DF, 0x000075E0, 0x000075E7, 0x000075EC, 0x000075EE, 0x000075F1, 0x000075F9, 0x00007603,
+    0x00007618, 0x00007607, 0x0000760F, 0x00003FAE, 0x00024E0E, 0x00007613, 0x0000761B, 0xFFFFFFFF,
+    0x0000761C, 0x00024E37, 0x00007625, 0x00007628, 0x0000763C, 0x00007633, 0x00024E6A, 0x00003FC9,
+    0x00007641, 0x00024E8B, 0x00007649, 0x00007655, 0x00003FD7, 0x0000766E, 0x00007695, 0x0000769C,
+    0x000076A1, 0x000076A0, 0x000076A7, 0x000076A8, 0x000076AF, 0x0002504A, 0x000076C9, 0x00025055,
+    0x000076E8, 0x000076EC, 0x00025122, 0x00007717, 0x0000771A, 0x0000772D, 0x00007735, 0x000251A9,
+    0x00004039, 0x000251E5, 0x000251CD, 0x00007758, 0x00007760, 0x0000776A, 0x0002521E, 0x00007772,
+    0x0000777C, 0x0000777D, 0x0002524C, 0x00004058, 0x0000779A, 0x0000779F, 0x000077A2, 0x000077A4,
+    0x000077A9, 0x000077DE, 0x000077DF, 0x000077E4, 0x000077E6, 0x000077EA, 0x000077EC, 0x00004093,
+    0x000077F0, 0x000077F4, 0x000077FB, 0x0002542E, 0x00007805, 0x00007806, 0x00007809, 0x0000780D,
+    0x00007819, 0x00007821, 0x0000782C, 0x00007847, 0x00007864, 0x0000786A, 0x000254D9, 0x0000788A,
+    0x00007894, 0x000078A4, 0x0000789D, 0x0000789E, 0x0000789F, 0x000078BB, 0x000078C8, 0x000078CC,
+    0x000078CE, 0x000078D5, 0x000078E0, 0x000078E1, 0x000078E6, 0x000078F9, 0x000078FA, 0x000078FB,
+    0x000078FE, 0x000255A7, 0x00007910, 0x0000791B, 0x00007930, 0x00007925, 0x0000793B, 0x0000794A,
+    0x00007958, 0x0000795B, 0x00004105, 0x00007967, 0x00007972, 0x00007994, 0x00007995, 0x00007996,
+    0x0000799B, 0x000079A1, 0x000079A9, 0x000079B4, 0x000079BB, 0x000079C2, 0x000079C7, 0x000079CC,
+    0x000079CD, 0x000079D6, 0x00004148, 0x000257A9, 0x000257B4, 0x0000414F, 0x00007A0A, 0x00007A11,
+    0x00007A15, 0x00007A1B, 0x00007A1E, 0x00004163, 0x00007A2D, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF7 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00007A38, 0x00007A47, 0x00007A4C, 0x00007A56, 0x00007A59, 0x00007A5C, 0x00007A5F, 0x00007A60,
+    0x00007A67, 0x00007A6A, 0x00007A75, 0x00007A78, 0x00007A82, 0x00007A8A, 0x00007A90, 0x00007AA3,
+    0x00007AAC, 0x000259D4, 0x000041B4, 0x00007AB9, 0x00007ABC, 0x00007ABE, 0x000041BF, 0x00007ACC,
+    0x00007AD1, 0x00007AE7, 0x00007AE8, 0x00007AF4, 0x00025AE4, 0x00025AE3, 0x00007B07, 0x00025AF1,
+    0x00007B3D, 0x00007B27, 0x00007B2A, 0x00007B2E, 0x00007B2F, 0x00007B31, 0x000041E6, 0x000041F3,
+    0x00007B7F, 0x00007B41, 0x000041EE, 0x00007B55, 0x00007B79, 0x00007B64, 0x00007B66, 0x00007B69,
+    0x00007B73, 0x00025BB2, 0x00004207, 0x00007B90, 0x00007B91, 0x00007B9B, 0x0000420E, 0x00007BAF,
+    0x00007BB5, 0x00007BBC, 0x00007BC5, 0x00007BCA, 0x00025C4B, 0x00025C64, 0x00007BD4, 0xFFFFFFFF,
+    0x00007BD6, 0x00007BDA, 0x00007BEA, 0x00007BF0, 0x00007C03, 0x00007C0B, 0x00007C0E, 0x00007C0F,
+    0x00007C26, 0x00007C45, 0x00007C4A, 0x00007C51, 0x00007C57, 0x00007C5E, 0x00007C61, 0x00007C69,
+    0x00007C6E, 0x00007C6F, 0x00007C70, 0x00025E2E, 0x00025E56, 0x00025E65, 0x00007CA6, 0x00025E62,
+    0x00007CB6, 0x00007CB7, 0x00007CBF, 0x00025ED8, 0x00007CC4, 0x00025EC2, 0x00007CC8, 0x00007CCD,
+    0x00025EE8, 0x00007CD7, 0x00025F23, 0x00007CE6, 0x00007CEB, 0x00025F5C, 0x00007CF5, 0x00007D03,
+    0x00007D09, 0x000042C6, 0x00007D12, 0x00007D1E, 0x00025FE0, 0x00025FD4, 0x00007D3D, 0x00007D3E,
+    0x00007D40, 0x00007D47, 0x0002600C, 0x00025FFB, 0x000042D6, 0x00007D59, 0x00007D5A, 0x00007D6A,
+    0x00007D70, 0x000042DD, 0x00007D7F, 0x00026017, 0x00007D86, 0x00007D88, 0x00007D8C, 0x00007D97,
+    0x00026060, 0x00007D9D, 0x00007DA7, 0x00007DAA, 0x00007DB6, 0x00007DB7, 0x00007DC0, 0x00007DD7,
+    0x00007DD9, 0x00007DE6, 0x00007DF1, 0x00007DF9, 0x00004302, 0x000260ED, 0x0000FA58, 0x00007E10,
+    0x00007E17, 0x00007E1D, 0x00007E20, 0x00007E27, 0x00007E2C, 0x00007E45, 0x00007E73, 0x00007E75,
+    0x00007E7E, 0x00007E86, 0x00007E87, 0x0000432B, 0x00007E91, 0x00007E98, 0x00007E9A, 0x00004343,
+    0x00007F3C, 0x00007F3B, 0x00007F3E, 0x00007F43, 0x00007F44, 0x00007F4F, 0x000034C1, 0x00026270,
+    0x00007F52, 0x00026286, 0x00007F61, 0x00007F63, 0x00007F64, 0x00007F6D, 0x00007F7D, 0x00007F7E,
+    0x0002634C, 0x00007F90, 0x0000517B, 0x00023D0E, 0x00007F96, 0x00007F9C, 0x00007FAD, 0x00026402,
+    0x00007FC3, 0x00007FCF, 0x00007FE3, 0x00007FE5, 0x00007FEF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF8 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00007FF2, 0x00008002, 0x0000800A, 0x00008008, 0x0000800E, 0x00008011, 0x00008016, 0x00008024,
+    0x0000802C, 0x00008030, 0x00008043, 0x00008066, 0x00008071, 0x00008075, 0x0000807B, 0x00008099,
+    0x0000809C, 0x000080A4, 0x000080A7, 0x000080B8, 0x0002667E, 0x000080C5, 0x000080D5, 0x000080D8,
+    0x000080E6, 0x000266B0, 0x0000810D, 0x000080F5, 0x000080FB, 0x000043EE, 0x00008135, 0x00008116,
+    0x0000811E, 0x000043F0, 0x00008124, 0x00008127, 0x0000812C, 0x0002671D, 0x0000813D, 0x00004408,
+    0x00008169, 0x00004417, 0x00008181, 0x0000441C, 0x00008184, 0x00008185, 0x00004422, 0x00008198,
+    0x000081B2, 0x000081C1, 0x000081C3, 0x000081D6, 0x000081DB, 0x000268DD, 0x000081E4, 0x000268EA,
+    0x000081EC, 0x00026951, 0x000081FD, 0x000081FF, 0x0002696F, 0x00008204, 0x000269DD, 0xFFFFFFFF,
+    0x00008219, 0x00008221, 0x00008222, 0x00026A1E, 0x00008232, 0x00008234, 0x0000823C, 0x00008246,
+    0x00008249, 0x00008245, 0x00026A58, 0x0000824B, 0x00004476, 0x0000824F, 0x0000447A, 0x00008257,
+    0x00026A8C, 0x0000825C, 0x00008263, 0x00026AB7, 0x0000FA5D, 0x0000FA5E, 0x00008279, 0x00004491,
+    0x0000827D, 0x0000827F, 0x00008283, 0x0000828A, 0x00008293, 0x000082A7, 0x000082A8, 0x000082B2,
+    0x000082B4, 0x000082BA, 0x000082BC, 0x000082E2, 0x000082E8, 0x000082F7, 0x00008307, 0x00008308,
+    0x0000830C, 0x00008354, 0x0000831B, 0x0000831D, 0x00008330, 0x0000833C, 0x00008344, 0x00008357,
+    0x000044BE, 0x0000837F, 0x000044D4, 0x000044B3, 0x0000838D, 0x00008394, 0x00008395, 0x0000839B,
+    0x0000839D, 0x000083C9, 0x000083D0, 0x000083D4, 0x000083DD, 0x000083E5, 0x000083F9, 0x0000840F,
+    0x00008411, 0x00008415, 0x00026C73, 0x00008417, 0x00008439, 0x0000844A, 0x0000844F, 0x00008451,
+    0x00008452, 0x00008459, 0x0000845A, 0x0000845C, 0x00026CDD, 0x00008465, 0x00008476, 0x00008478,
+    0x0000847C, 0x00008481, 0x0000450D, 0x000084DC, 0x00008497, 0x000084A6, 0x000084BE, 0x00004508,
+    0x000084CE, 0x000084CF, 0x000084D3, 0x00026E65, 0x000084E7, 0x000084EA, 0x000084EF, 0x000084F0,
+    0x000084F1, 0x000084FA, 0x000084FD, 0x0000850C, 0x0000851B, 0x00008524, 0x00008525, 0x0000852B,
+    0x00008534, 0x0000854F, 0x0000856F, 0x00004525, 0x00004543, 0x0000853E, 0x00008551, 0x00008553,
+    0x0000855E, 0x00008561, 0x00008562, 0x00026F94, 0x0000857B, 0x0000857D, 0x0000857F, 0x00008581,
+    0x00008586, 0x00008593, 0x0000859D, 0x0000859F, 0x00026FF8, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xF9 */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00026FF6, 0x00026FF7, 0x000085B7, 0x000085BC, 0x000085C7, 0x000085CA, 0x000085D8, 0x000085D9,
+    0x000085DF, 0x000085E1, 0x000085E6, 0x000085F6, 0x00008600, 0x00008611, 0x0000861E, 0x00008621,
+    0x00008624, 0x00008627, 0x0002710D, 0x00008639, 0x0000863C, 0x00027139, 0x00008640, 0x0000FA20,
+    0x00008653, 0x00008656, 0x0000866F, 0x00008677, 0x0000867A, 0x00008687, 0x00008689, 0x0000868D,
+    0x00008691, 0x0000869C, 0x0000869D, 0x000086A8, 0x0000FA21, 0x000086B1, 0x000086B3, 0x000086C1,
+    0x000086C3, 0x000086D1, 0x000086D5, 0x000086D7, 0x000086E3, 0x000086E6, 0x000045B8, 0x00008705,
+    0x00008707, 0x0000870E, 0x00008710, 0x00008713, 0x00008719, 0x0000871F, 0x00008721, 0x00008723,
+    0x00008731, 0x0000873A, 0x0000873E, 0x00008740, 0x00008743, 0x00008751, 0x00008758, 0xFFFFFFFF,
+    0x00008764, 0x00008765, 0x00008772, 0x0000877C, 0x000273DB, 0x000273DA, 0x000087A7, 0x00008789,
+    0x0000878B, 0x00008793, 0x000087A0, 0x000273FE, 0x000045E5, 0x000087BE, 0x00027410, 0x000087C1,
+    0x000087CE, 0x000087F5, 0x000087DF, 0x00027449, 0x000087E3, 0x000087E5, 0x000087E6, 0x000087EA,
+    0x000087EB, 0x000087ED, 0x00008801, 0x00008803, 0x0000880B, 0x00008813, 0x00008828, 0x0000882E,
+    0x00008832, 0x0000883C, 0x0000460F, 0x0000884A, 0x00008858, 0x0000885F, 0x00008864, 0x00027615,
+    0x00027614, 0x00008869, 0x00027631, 0x0000886F, 0x000088A0, 0x000088BC, 0x000088BD, 0x000088BE,
+    0x000088C0, 0x000088D2, 0x00027693, 0x000088D1, 0x000088D3, 0x000088DB, 0x000088F0, 0x000088F1,
+    0x00004641, 0x00008901, 0x0002770E, 0x00008937, 0x00027723, 0x00008942, 0x00008945, 0x00008949,
+    0x00027752, 0x00004665, 0x00008962, 0x00008980, 0x00008989, 0x00008990, 0x0000899F, 0x000089B0,
+    0x000089B7, 0x000089D6, 0x000089D8, 0x000089EB, 0x000046A1, 0x000089F1, 0x000089F3, 0x000089FD,
+    0x000089FF, 0x000046AF, 0x00008A11, 0x00008A14, 0x00027985, 0x00008A21, 0x00008A35, 0x00008A3E,
+    0x00008A45, 0x00008A4D, 0x00008A58, 0x00008AAE, 0x00008A90, 0x00008AB7, 0x00008ABE, 0x00008AD7,
+    0x00008AFC, 0x00027A84, 0x00008B0A, 0x00008B05, 0x00008B0D, 0x00008B1C, 0x00008B1F, 0x00008B2D,
+    0x00008B43, 0x0000470C, 0x00008B51, 0x00008B5E, 0x00008B76, 0x00008B7F, 0x00008B81, 0x00008B8B,
+    0x00008B94, 0x00008B95, 0x00008B9C, 0x00008B9E, 0x00008C39, 0x00027BB3, 0x00008C3D, 0x00027BBE,
+    0x00027BC7, 0x00008C45, 0x00008C47, 0x00008C4F, 0x00008C54, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xFA */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00008C57, 0x00008C69, 0x00008C6D, 0x00008C73, 0x00027CB8, 0x00008C93, 0x00008C92, 0x00008C99,
+    0x00004764, 0x00008C9B, 0x00008CA4, 0x00008CD6, 0x00008CD5, 0x00008CD9, 0x00027DA0, 0x00008CF0,
+    0x00008CF1, 0x00027E10, 0x00008D09, 0x00008D0E, 0x00008D6C, 0x00008D84, 0x00008D95, 0x00008DA6,
+    0x00027FB7, 0x00008DC6, 0x00008DC8, 0x00008DD9, 0x00008DEC, 0x00008E0C, 0x000047FD, 0x00008DFD,
+    0x00008E06, 0x0002808A, 0x00008E14, 0x00008E16, 0x00008E21, 0x00008E22, 0x00008E27, 0x000280BB,
+    0x00004816, 0x00008E36, 0x00008E39, 0x00008E4B, 0x00008E54, 0x00008E62, 0x00008E6C, 0x00008E6D,
+    0x00008E6F, 0x00008E98, 0x00008E9E, 0x00008EAE, 0x00008EB3, 0x00008EB5, 0x00008EB6, 0x00008EBB,
+    0x00028282, 0x00008ED1, 0x00008ED4, 0x0000484E, 0x00008EF9, 0x000282F3, 0x00008F00, 0xFFFFFFFF,
+    0x00008F08, 0x00008F17, 0x00008F2B, 0x00008F40, 0x00008F4A, 0x00008F58, 0x0002840C, 0x00008FA4,
+    0x00008FB4, 0x0000FA66, 0x00008FB6, 0x00028455, 0x00008FC1, 0x00008FC6, 0x0000FA24, 0x00008FCA,
+    0x00008FCD, 0x00008FD3, 0x00008FD5, 0x00008FE0, 0x00008FF1, 0x00008FF5, 0x00008FFB, 0x00009002,
+    0x0000900C, 0x00009037, 0x0002856B, 0x00009043, 0x00009044, 0x0000905D, 0x000285C8, 0x000285C9,
+    0x00009085, 0x0000908C, 0x00009090, 0x0000961D, 0x000090A1, 0x000048B5, 0x000090B0, 0x000090B6,
+    0x000090C3, 0x000090C8, 0x000286D7, 0x000090DC, 0x000090DF, 0x000286FA, 0x000090F6, 0x000090F2,
+    0x00009100, 0x000090EB, 0x000090FE, 0x000090FF, 0x00009104, 0x00009106, 0x00009118, 0x0000911C,
+    0x0000911E, 0x00009137, 0x00009139, 0x0000913A, 0x00009146, 0x00009147, 0x00009157, 0x00009159,
+    0x00009161, 0x00009164, 0x00009174, 0x00009179, 0x00009185, 0x0000918E, 0x000091A8, 0x000091AE,
+    0x000091B3, 0x000091B6, 0x000091C3, 0x000091C4, 0x000091DA, 0x00028949, 0x00028946, 0x000091EC,
+    0x000091EE, 0x00009201, 0x0000920A, 0x00009216, 0x00009217, 0x0002896B, 0x00009233, 0x00009242,
+    0x00009247, 0x0000924A, 0x0000924E, 0x00009251, 0x00009256, 0x00009259, 0x00009260, 0x00009261,
+    0x00009265, 0x00009267, 0x00009268, 0x00028987, 0x00028988, 0x0000927C, 0x0000927D, 0x0000927F,
+    0x00009289, 0x0000928D, 0x00009297, 0x00009299, 0x0000929F, 0x000092A7, 0x000092AB, 0x000289BA,
+    0x000289BB, 0x000092B2, 0x000092BF, 0x000092C0, 0x000092C6, 0x000092CE, 0x000092D0, 0x000092D7,
+    0x000092D9, 0x000092E5, 0x000092E7, 0x00009311, 0x00028A1E, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xFB */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00028A29, 0x000092F7, 0x000092F9, 0x000092FB, 0x00009302, 0x0000930D, 0x00009315, 0x0000931D,
+    0x0000931E, 0x00009327, 0x00009329, 0x00028A71, 0x00028A43, 0x00009347, 0x00009351, 0x00009357,
+    0x0000935A, 0x0000936B, 0x00009371, 0x00009373, 0x000093A1, 0x00028A99, 0x00028ACD, 0x00009388,
+    0x0000938B, 0x0000938F, 0x0000939E, 0x000093F5, 0x00028AE4, 0x00028ADD, 0x000093F1, 0x000093C1,
+    0x000093C7, 0x000093DC, 0x000093E2, 0x000093E7, 0x00009409, 0x0000940F, 0x00009416, 0x00009417,
+    0x000093FB, 0x00009432, 0x00009434, 0x0000943B, 0x00009445, 0x00028BC1, 0x00028BEF, 0x0000946D,
+    0x0000946F, 0x00009578, 0x00009579, 0x00009586, 0x0000958C, 0x0000958D, 0x00028D10, 0x000095AB,
+    0x000095B4, 0x00028D71, 0x000095C8, 0x00028DFB, 0x00028E1F, 0x0000962C, 0x00009633, 0xFFFFFFFF,
+    0x00009634, 0x00028E36, 0x0000963C, 0x00009641, 0x00009661, 0x00028E89, 0x00009682, 0x00028EEB,
+    0x0000969A, 0x00028F32, 0x000049E7, 0x000096A9, 0x000096AF, 0x000096B3, 0x000096BA, 0x000096BD,
+    0x000049FA, 0x00028FF8, 0x000096D8, 0x000096DA, 0x000096DD, 0x00004A04, 0x00009714, 0x00009723,
+    0x00004A29, 0x00009736, 0x00009741, 0x00009747, 0x00009755, 0x00009757, 0x0000975B, 0x0000976A,
+    0x000292A0, 0x000292B1, 0x00009796, 0x0000979A, 0x0000979E, 0x000097A2, 0x000097B1, 0x000097B2,
+    0x000097BE, 0x000097CC, 0x000097D1, 0x000097D4, 0x000097D8, 0x000097D9, 0x000097E1, 0x000097F1,
+    0x00009804, 0x0000980D, 0x0000980E, 0x00009814, 0x00009816, 0x00004ABC, 0x00029490, 0x00009823,
+    0x00009832, 0x00009833, 0x00009825, 0x00009847, 0x00009866, 0x000098AB, 0x000098AD, 0x000098B0,
+    0x000295CF, 0x000098B7, 0x000098B8, 0x000098BB, 0x000098BC, 0x000098BF, 0x000098C2, 0x000098C7,
+    0x000098CB, 0x000098E0, 0x0002967F, 0x000098E1, 0x000098E3, 0x000098E5, 0x000098EA, 0x000098F0,
+    0x000098F1, 0x000098F3, 0x00009908, 0x00004B3B, 0x000296F0, 0x00009916, 0x00009917, 0x00029719,
+    0x0000991A, 0x0000991B, 0x0000991C, 0x00029750, 0x00009931, 0x00009932, 0x00009933, 0x0000993A,
+    0x0000993B, 0x0000993C, 0x00009940, 0x00009941, 0x00009946, 0x0000994D, 0x0000994E, 0x0000995C,
+    0x0000995F, 0x00009960, 0x000099A3, 0x000099A6, 0x000099B9, 0x000099BD, 0x000099BF, 0x000099C3,
+    0x000099C9, 0x000099D4, 0x000099D9, 0x000099DE, 0x000298C6, 0x000099F0, 0x000099F9, 0x000099FC,
+    0x00009A0A, 0x00009A11, 0x00009A16, 0x00009A1A, 0x00009A20, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+  { /* lead 0xFC */
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0x00009A31, 0x00009A36, 0x00009A44, 0x00009A4C, 0x00009A58, 0x00004BC2, 0x00009AAF, 0x00004BCA,
+    0x00009AB7, 0x00004BD2, 0x00009AB9, 0x00029A72, 0x00009AC6, 0x00009AD0, 0x00009AD2, 0x00009AD5,
+    0x00004BE8, 0x00009ADC, 0x00009AE0, 0x00009AE5, 0x00009AE9, 0x00009B03, 0x00009B0C, 0x00009B10,
+    0x00009B12, 0x00009B16, 0x00009B1C, 0x00009B2B, 0x00009B33, 0x00009B3D, 0x00004C20, 0x00009B4B,
+    0x00009B63, 0x00009B65, 0x00009B6B, 0x00009B6C, 0x00009B73, 0x00009B76, 0x00009B77, 0x00009BA6,
+    0x00009BAC, 0x00009BB1, 0x00029DDB, 0x00029E3D, 0x00009BB2, 0x00009BB8, 0x00009BBE, 0x00009BC7,
+    0x00009BF3, 0x00009BD8, 0x00009BDD, 0x00009BE7, 0x00009BEA, 0x00009BEB, 0x00009BEF, 0x00009BEE,
+    0x00029E15, 0x00009BFA, 0x00029E8A, 0x00009BF7, 0x00029E49, 0x00009C16, 0x00009C18, 0xFFFFFFFF,
+    0x00009C19, 0x00009C1A, 0x00009C1D, 0x00009C22, 0x00009C27, 0x00009C29, 0x00009C2A, 0x00029EC4,
+    0x00009C31, 0x00009C36, 0x00009C37, 0x00009C45, 0x00009C5C, 0x00029EE9, 0x00009C49, 0x00009C4A,
+    0x00029EDB, 0x00009C54, 0x00009C58, 0x00009C5B, 0x00009C5D, 0x00009C5F, 0x00009C69, 0x00009C6A,
+    0x00009C6B, 0x00009C6D, 0x00009C6E, 0x00009C70, 0x00009C72, 0x00009C75, 0x00009C7A, 0x00009CE6,
+    0x00009CF2, 0x00009D0B, 0x00009D02, 0x00029FCE, 0x00009D11, 0x00009D17, 0x00009D18, 0x0002A02F,
+    0x00004CC4, 0x0002A01A, 0x00009D32, 0x00004CD1, 0x00009D42, 0x00009D4A, 0x00009D5F, 0x00009D62,
+    0x0002A0F9, 0x00009D69, 0x00009D6B, 0x0002A082, 0x00009D73, 0x00009D76, 0x00009D77, 0x00009D7E,
+    0x00009D84, 0x00009D8D, 0x00009D99, 0x00009DA1, 0x00009DBF, 0x00009DB5, 0x00009DB9, 0x00009DBD,
+    0x00009DC3, 0x00009DC7, 0x00009DC9, 0x00009DD6, 0x00009DDA, 0x00009DDF, 0x00009DE0, 0x00009DE3,
+    0x00009DF4, 0x00004D07, 0x00009E0A, 0x00009E02, 0x00009E0D, 0x00009E19, 0x00009E1C, 0x00009E1D,
+    0x00009E7B, 0x00022218, 0x00009E80, 0x00009E85, 0x00009E9B, 0x00009EA8, 0x0002A38C, 0x00009EBD,
+    0x0002A437, 0x00009EDF, 0x00009EE7, 0x00009EEE, 0x00009EFF, 0x00009F02, 0x00004D77, 0x00009F03,
+    0x00009F17, 0x00009F19, 0x00009F2F, 0x00009F37, 0x00009F3A, 0x00009F3D, 0x00009F41, 0x00009F45,
+    0x00009F46, 0x00009F53, 0x00009F55, 0x00009F58, 0x0002A5F1, 0x00009F5D, 0x0002A602, 0x00009F69,
+    0x0002A61A, 0x00009F6D, 0x00009F70, 0x00009F75, 0x0002A6B2, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+    0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF, 0xFFFFFFFF,
+  },
+};
+
+/* 2 コード点になる文字: { 基底, 結合文字 } */
+SJ2004_TABLE_CONST uint16_t SJ2004_PAIRS[25][2] = {
+  { 0x304B, 0x309A },
+  { 0x304D, 0x309A },
+  { 0x304F, 0x309A },
+  { 0x3051, 0x309A },
+  { 0x3053, 0x309A },
+  { 0x30AB, 0x309A },
+  { 0x30AD, 0x309A },
+  { 0x30AF, 0x309A },
+  { 0x30B1, 0x309A },
+  { 0x30B3, 0x309A },
+  { 0x30BB, 0x309A },
+  { 0x30C4, 0x309A },
+  { 0x30C8, 0x309A },
+  { 0x31F7, 0x309A },
+  { 0x00E6, 0x0300 },
+  { 0x0254, 0x0300 },
+  { 0x0254, 0x0301 },
+  { 0x028C, 0x0300 },
+  { 0x028C, 0x0301 },
+  { 0x0259, 0x0300 },
+  { 0x0259, 0x0301 },
+  { 0x025A, 0x0300 },
+  { 0x025A, 0x0301 },
+  { 0x02E9, 0x02E5 },
+  { 0x02E5, 0x02E9 },
+};
+
+/* Unicode (U+0000–U+2FFFF) の上位ビット → U2SJ2004 のページ (0 = 対応なし) */
+SJ2004_TABLE_CONST uint16_t U2SJ2004_PAGE[768] = {
+    1,   2,   3,   4,   5,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   6,   7,
+    8,   9,  10,  11,  12,  13,  14,  15,   0,  16,   0,   0,   0,   0,   0,   0,
+   17,  18,  19,  20,  21,  22,  23,  24,  25,  26,  27,  28,  29,  30,  31,  32,
+   33,  34,  35,  36,  37,  38,  39,  40,  41,  42,  43,  44,  45,  46,  47,  48,
+   49,  50,  51,  52,  53,  54,  55,  56,  57,  58,  59,  60,  61,  62,  63,  64,
+   65,  66,  67,  68,  69,  70,  71,  72,  73,  74,  75,  76,  77,  78,  79,  80,
+   81,  82,  83,  84,  85,  86,  87,  88,  89,  90,  91,  92,  93,  94,  95,  96,
+   97,  98,  99, 100, 101, 102, 103, 104, 105, 106, 107, 108, 109, 110, 111, 112,
+  113, 114, 115, 116, 117, 118, 119, 120, 121, 122, 123, 124, 125, 126, 127, 128,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0, 129, 130,   0,   0,   0, 131, 132,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+  133, 134, 135, 136, 137, 138, 139, 140, 141, 142, 143, 144,   0, 145, 146, 147,
+    0,   0, 148, 149, 150, 151, 152, 153, 154, 155,   0,   0, 156, 157, 158, 159,
+    0, 160, 161, 162,   0,   0, 163,   0, 164, 165, 166, 167, 168, 169,   0,   0,
+    0, 170,   0, 171, 172, 173, 174, 175, 176,   0, 177,   0, 178, 179,   0, 180,
+  181, 182,   0, 183,   0,   0, 184, 185, 186,   0, 187, 188, 189, 190, 191,   0,
+  192, 193, 194,   0, 195, 196,   0, 197,   0, 198, 199, 200, 201, 202, 203, 204,
+  205,   0, 206, 207, 208,   0, 209, 210, 211, 212, 213,   0, 214,   0, 215, 216,
+  217, 218,   0, 219, 220,   0, 221, 222,   0, 223, 224, 225, 226, 227, 228, 229,
+  230,   0, 231, 232, 233, 234, 235,   0,   0, 236, 237, 238,   0, 239, 240, 241,
+    0,   0, 242,   0, 243, 244, 245, 246, 247,   0, 248,   0,   0, 249, 250, 251,
+  252, 253,   0, 254, 255, 256, 257,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+    0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,   0,
+};
+
+/* Unicode → SJIS: U2SJ2004[U2SJ2004_PAGE[u >> 8]][u & 0xFF] */
+SJ2004_TABLE_CONST uint16_t U2SJ2004[258][256] = {
+  { /* unmapped */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+00xx */
+    0x0000, 0x0001, 0x0002, 0x0003, 0x0004, 0x0005, 0x0006, 0x0007, 0x0008, 0x0009, 0x000A, 0x000B, 0x000C, 0x000D, 0x000E, 0x000F,
+    0x0010, 0x0011, 0x0012, 0x0013, 0x0014, 0x0015, 0x0016, 0x0017, 0x0018, 0x0019, 0x001A, 0x001B, 0x001C, 0x001D, 0x001E, 0x001F,
+    0x0020, 0x0021, 0x0022, 0x0023, 0x0024, 0x0025, 0x0026, 0x0027, 0x0028, 0x0029, 0x002A, 0x002B, 0x002C, 0x002D, 0x002E, 0x002F,
+    0x0030, 0x0031, 0x0032, 0x0033, 0x0034, 0x0035, 0x0036, 0x0037, 0x0038, 0x0039, 0x003A, 0x003B, 0x003C, 0x003D, 0x003E, 0x003F,
+    0x0040, 0x0041, 0x0042, 0x0043, 0x0044, 0x0045, 0x0046, 0x0047, 0x0048, 0x0049, 0x004A, 0x004B, 0x004C, 0x004D, 0x004E, 0x004F,
+    0x0050, 0x0051, 0x0052, 0x0053, 0x0054, 0x0055, 0x0056, 0x0057, 0x0058, 0x0059, 0x005A, 0x005B, 0x005C, 0x005D, 0x005E, 0x005F,
+    0x0060, 0x0061, 0x0062, 0x0063, 0x0064, 0x0065, 0x0066, 0x0067, 0x0068, 0x0069, 0x006A, 0x006B, 0x006C, 0x006D, 0x006E, 0x006F,
+    0x0070, 0x0071, 0x0072, 0x0073, 0x0074, 0x0075, 0x0076, 0x0077, 0x0078, 0x0079, 0x007A, 0x007B, 0x007C, 0x007D, 0x007E, 0x007F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8541, 0x8542, 0x8191, 0x8192, 0x8543, 0xFFFF, 0x8544, 0x8198, 0x814E, 0x8545, 0x8546, 0x8547, 0x81CA, 0x8548, 0x8549, 0x854A,
+    0x818B, 0x817D, 0x854B, 0x854C, 0x814C, 0xFFFF, 0x81F7, 0x854D, 0x854E, 0x854F, 0x8550, 0x8551, 0x8552, 0x8553, 0x8554, 0x8555,
+    0x8556, 0x8557, 0x8558, 0x8559, 0x855A, 0x855B, 0x855C, 0x855D, 0x855E, 0x855F, 0x8560, 0x8561, 0x8562, 0x8563, 0x8564, 0x8565,
+    0x8566, 0x8567, 0x8568, 0x8569, 0x856A, 0x856B, 0x856C, 0x817E, 0x856D, 0x856E, 0x856F, 0x8570, 0x8571, 0x8572, 0x8573, 0x8574,
+    0x8575, 0x8576, 0x8577, 0x8578, 0x8579, 0x857A, 0x0100, 0x857C, 0x857D, 0x857E, 0x8580, 0x8581, 0x8582, 0x8583, 0x8584, 0x8585,
+    0x8586, 0x8587, 0x8588, 0x8589, 0x858A, 0x858B, 0x858C, 0x8180, 0x858D, 0x858E, 0x858F, 0x8590, 0x8591, 0x8592, 0x8593, 0x8594,
+  },
+  { /* U+01xx */
+    0x8595, 0x859A, 0x85B8, 0x85C7, 0x859F, 0x85AA, 0x85BA, 0x85C9, 0x85D7, 0x85DD, 0xFFFF, 0xFFFF, 0x85BB, 0x85CA, 0x85BE, 0x85CD,
+    0xFFFF, 0x85CE, 0x8598, 0x859D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x85BC, 0x85CB, 0x85BD, 0x85CC, 0x85D8, 0x85DE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x85D9, 0x85DF, 0xFFFF, 0x85FB, 0xFFFF, 0xFFFF, 0x8596, 0x859B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x85DA, 0x85E0, 0xFFFF, 0xFFFF, 0xFFFF, 0x85B9, 0x85C8, 0xFFFF, 0xFFFF, 0x85A2, 0x85AD, 0xFFFF,
+    0xFFFF, 0x85A1, 0x85AC, 0x85BF, 0x85CF, 0xFFFF, 0xFFFF, 0x85C0, 0x85D0, 0xFFFF, 0xFFFF, 0x85F8, 0x8599, 0x859E, 0xFFFF, 0xFFFF,
+    0x85C1, 0x85D1, 0x864A, 0x8649, 0x85B7, 0x85C6, 0xFFFF, 0xFFFF, 0x85C2, 0x85D2, 0x85A3, 0x85AE, 0x85DB, 0x85E1, 0x85A5, 0x85B1,
+    0x85A4, 0x85B0, 0x85C5, 0x85D5, 0x85A6, 0x85B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8597, 0x859C, 0x85DC, 0x85E2, 0x85C3, 0x85D3,
+    0x85C4, 0x85D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x85A7, 0x85B3, 0x85A9, 0x85B6, 0x85A8, 0x85B5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8648, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8643, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x84ED, 0x84EE, 0xFFFF,
+    0x84EF, 0x84F4, 0x84F5, 0xFFFF, 0x84F6, 0xFFFF, 0x84F7, 0xFFFF, 0x84F8, 0xFFFF, 0x84F9, 0xFFFF, 0x84FA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x84F2, 0x84F3, 0xFFFF, 0xFFFF, 0xFFFF, 0x8664, 0xFFFF, 0xFFFF,
+  },
+  { /* U+02xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8652, 0x8658, 0x8659, 0x8644, 0x0101, 0x865E, 0x85EC, 0x8645, 0x864D, 0x0102, 0x0103, 0xFFFF, 0x8650, 0xFFFF, 0x8651, 0x85F3,
+    0x8647, 0x85F7, 0xFFFF, 0xFFFF, 0x8655, 0x865B, 0x8641, 0x8661, 0x864B, 0xFFFF, 0xFFFF, 0xFFFF, 0x85E8, 0x85F2, 0x85E9, 0x8653,
+    0x85F9, 0x85E3, 0x85F4, 0x85ED, 0xFFFF, 0x864E, 0xFFFF, 0xFFFF, 0xFFFF, 0x85EA, 0x8660, 0x85F1, 0xFFFF, 0x85EE, 0x85E5, 0xFFFF,
+    0xFFFF, 0x85FA, 0x85EF, 0x85E6, 0x8646, 0xFFFF, 0xFFFF, 0xFFFF, 0x85EB, 0x864C, 0x8654, 0x85E4, 0x0104, 0x865A, 0x85F6, 0xFFFF,
+    0x85F0, 0x865F, 0x85E7, 0xFFFF, 0x8640, 0x85FC, 0xFFFF, 0xFFFF, 0x8642, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x85F5, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x865D, 0x865C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x85AF, 0x8672, 0xFFFF, 0xFFFF, 0xFFFF, 0x8673, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8674, 0x8675, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x85A0, 0x85D6, 0xFFFF, 0x85AB, 0xFFFF, 0x85B4, 0x8691, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x0105, 0x8681, 0x8682, 0x8683, 0x0106, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+03xx */
+    0x867B, 0x8679, 0x867E, 0x869D, 0x867A, 0xFFFF, 0x8676, 0xFFFF, 0x868D, 0xFFFF, 0xFFFF, 0x8678, 0x867D, 0xFFFF, 0xFFFF, 0x867C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8698, 0x8699, 0x869E, 0xFFFF, 0x868A, 0x8696, 0x8697, 0x868B,
+    0x868C, 0xFFFF, 0xFFFF, 0xFFFF, 0x8692, 0x8687, 0xFFFF, 0xFFFF, 0xFFFF, 0x868F, 0x869A, 0xFFFF, 0x8688, 0xFFFF, 0xFFFF, 0x8690,
+    0x8693, 0xFFFF, 0xFFFF, 0xFFFF, 0x8695, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8689, 0x869B, 0x869C, 0x8694, 0x868E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8671, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x839F, 0x83A0, 0x83A1, 0x83A2, 0x83A3, 0x83A4, 0x83A5, 0x83A6, 0x83A7, 0x83A8, 0x83A9, 0x83AA, 0x83AB, 0x83AC, 0x83AD,
+    0x83AE, 0x83AF, 0xFFFF, 0x83B0, 0x83B1, 0x83B2, 0x83B3, 0x83B4, 0x83B5, 0x83B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x83BF, 0x83C0, 0x83C1, 0x83C2, 0x83C3, 0x83C4, 0x83C5, 0x83C6, 0x83C7, 0x83C8, 0x83C9, 0x83CA, 0x83CB, 0x83CC, 0x83CD,
+    0x83CE, 0x83CF, 0x83D7, 0x83D0, 0x83D1, 0x83D2, 0x83D3, 0x83D4, 0x83D5, 0x83D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+04xx */
+    0xFFFF, 0x8446, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8440, 0x8441, 0x8442, 0x8443, 0x8444, 0x8445, 0x8447, 0x8448, 0x8449, 0x844A, 0x844B, 0x844C, 0x844D, 0x844E, 0x844F, 0x8450,
+    0x8451, 0x8452, 0x8453, 0x8454, 0x8455, 0x8456, 0x8457, 0x8458, 0x8459, 0x845A, 0x845B, 0x845C, 0x845D, 0x845E, 0x845F, 0x8460,
+    0x8470, 0x8471, 0x8472, 0x8473, 0x8474, 0x8475, 0x8477, 0x8478, 0x8479, 0x847A, 0x847B, 0x847C, 0x847D, 0x847E, 0x8480, 0x8481,
+    0x8482, 0x8483, 0x8484, 0x8485, 0x8486, 0x8487, 0x8488, 0x8489, 0x848A, 0x848B, 0x848C, 0x848D, 0x848E, 0x848F, 0x8490, 0x8491,
+    0xFFFF, 0x8476, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+1Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x84F0, 0x84F1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+1Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8665, 0x8666, 0x866F, 0x8670, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+20xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x815D, 0xFFFF, 0xFFFF, 0x829C, 0xFFFF, 0x815C, 0x8161, 0xFFFF, 0x8165, 0x8166, 0xFFFF, 0xFFFF, 0x8167, 0x8168, 0xFFFF, 0xFFFF,
+    0x81F5, 0x81F6, 0x825F, 0xFFFF, 0xFFFF, 0x8164, 0x8163, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x81F1, 0xFFFF, 0x818C, 0x818D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81A6, 0x84E9, 0xFFFF, 0xFFFF, 0x8677,
+    0xFFFF, 0xFFFF, 0x86FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x84EA, 0x84EB, 0x84EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x86FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8540, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+21xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x818E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x827C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x827E, 0xFFFF, 0xFFFF, 0x8782, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8784, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8280, 0xFFFF, 0xFFFF, 0xFFFF, 0x81F0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x827B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8498, 0x8499, 0x849A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8754, 0x8755, 0x8756, 0x8757, 0x8758, 0x8759, 0x875A, 0x875B, 0x875C, 0x875D, 0x875E, 0x8776, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x86B3, 0x86B4, 0x86B5, 0x86B6, 0x86B7, 0x86B8, 0x86B9, 0x86BA, 0x86BB, 0x86BC, 0x86BD, 0x86BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x81A9, 0x81AA, 0x81A8, 0x81AB, 0x81EF, 0xFFFF, 0x8246, 0x8244, 0x8245, 0x8247, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8248, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x81CB, 0xFFFF, 0x81CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x824A, 0x824B, 0x8249, 0x824C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+22xx */
+    0x81CD, 0xFFFF, 0x81DD, 0x81CE, 0xFFFF, 0x81C5, 0xFFFF, 0x81DE, 0x81B8, 0x81C4, 0xFFFF, 0x81B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x817C, 0x827A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81E3, 0xFFFF, 0xFFFF, 0x81E5, 0x8187, 0x8798,
+    0x81DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81D2, 0x81D3, 0x81C8, 0x81C9, 0x81BF, 0x81BE, 0x81E7, 0x81E8, 0xFFFF, 0x8793, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8188, 0x81E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81E4, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x81EA, 0xFFFF, 0x81EB, 0xFFFF, 0xFFFF, 0x81EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x81E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8182, 0x81DF, 0x81E9, 0xFFFF, 0xFFFF, 0xFFFF, 0x8185, 0x8186, 0xFFFF, 0xFFFF, 0x81E1, 0x81E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81ED, 0x81EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x81BC, 0x81BD, 0x81C0, 0x81C1, 0x81BA, 0x81BB, 0xFFFF, 0xFFFF, 0x81C2, 0x81C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81CF, 0x81D0, 0x81D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8799,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8496, 0x8497, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+23xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81C6, 0x81C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x81DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x849C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8461, 0x8462,
+    0x8463, 0x8464, 0x8465, 0x8466, 0x8467, 0x8468, 0x8469, 0x846A, 0x846B, 0x846C, 0x846D, 0x846E, 0x846F, 0xFFFF, 0x849E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+24xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x849D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8740, 0x8741, 0x8742, 0x8743, 0x8744, 0x8745, 0x8746, 0x8747, 0x8748, 0x8749, 0x874A, 0x874B, 0x874C, 0x874D, 0x874E, 0x874F,
+    0x8750, 0x8751, 0x8752, 0x8753, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x86BF, 0x86C0, 0x86C1, 0x86C2, 0x86C3, 0x86C4, 0x86C5, 0x86C6, 0x86C7, 0x86C8, 0x86C9, 0x86CA, 0x86CB, 0x86CC, 0x86CD, 0x86CE,
+    0x86CF, 0x86D0, 0x86D1, 0x86D2, 0x86D3, 0x86D4, 0x86D5, 0x86D6, 0x86D7, 0x86D8, 0xFFFF, 0x86A9, 0x86AA, 0x86AB, 0x86AC, 0x86AD,
+    0x86AE, 0x86AF, 0x86B0, 0x86B1, 0x86B2, 0x83D8, 0x83D9, 0x83DA, 0x83DB, 0x83DC, 0x83DD, 0x83DE, 0x83DF, 0x83E0, 0x83E1, 0xFFFF,
+  },
+  { /* U+25xx */
+    0x849F, 0x84AA, 0x84A0, 0x84AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x84A1, 0xFFFF, 0xFFFF, 0x84AC,
+    0x84A2, 0xFFFF, 0xFFFF, 0x84AD, 0x84A4, 0xFFFF, 0xFFFF, 0x84AF, 0x84A3, 0xFFFF, 0xFFFF, 0x84AE, 0x84A5, 0x84BA, 0xFFFF, 0xFFFF,
+    0x84B5, 0xFFFF, 0xFFFF, 0x84B0, 0x84A7, 0x84BC, 0xFFFF, 0xFFFF, 0x84B7, 0xFFFF, 0xFFFF, 0x84B2, 0x84A6, 0xFFFF, 0xFFFF, 0x84B6,
+    0x84BB, 0xFFFF, 0xFFFF, 0x84B1, 0x84A8, 0xFFFF, 0xFFFF, 0x84B8, 0x84BD, 0xFFFF, 0xFFFF, 0x84B3, 0x84A9, 0xFFFF, 0xFFFF, 0x84B9,
+    0xFFFF, 0xFFFF, 0x84BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x84B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x81A1, 0x81A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x83EB, 0x81A3, 0x81A2, 0xFFFF, 0xFFFF, 0x8241, 0x8240, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81A5, 0x81A4, 0xFFFF, 0xFFFF,
+    0x8243, 0x8242, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x819F, 0x819E, 0xFFFF, 0x825A, 0xFFFF, 0x819B, 0xFFFF, 0xFFFF, 0x819D, 0x819C,
+    0x84E5, 0x84E6, 0x84E7, 0x84E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x825E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81FC,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+26xx */
+    0x83E6, 0x83E7, 0x83E8, 0x83E9, 0xFFFF, 0x819A, 0x8199, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x83E5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x83E2, 0x83E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x879E, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x818A, 0xFFFF, 0x8189, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x83B8, 0x83BB, 0x83B9, 0x83BE, 0x83B7, 0x83BC, 0x83BA, 0x83BD, 0x83EA, 0x81FB, 0x81F4, 0x81F9, 0x81FA, 0x81F3, 0x81F8, 0x81F2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+27xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x849B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x879D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x869F, 0x86A0, 0x86A1, 0x86A2, 0x86A3, 0x86A4, 0x86A5, 0x86A6, 0x86A7, 0x86A8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+29xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x824D, 0x824E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81D4, 0x81D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8259,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x829D, 0x829E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+30xx */
+    0x8140, 0x8141, 0x8142, 0x8156, 0xFFFF, 0x8158, 0x8159, 0x815A, 0x8171, 0x8172, 0x8173, 0x8174, 0x8175, 0x8176, 0x8177, 0x8178,
+    0x8179, 0x817A, 0x81A7, 0x81AC, 0x816B, 0x816C, 0x81D8, 0x81D9, 0x81D6, 0x81D7, 0xFFFF, 0xFFFF, 0x8160, 0x8780, 0xFFFF, 0x8781,
+    0x83E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x81B1, 0x81B2, 0x81B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x81B4, 0x81B5, 0x825B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x829F, 0x82A0, 0x82A1, 0x82A2, 0x82A3, 0x82A4, 0x82A5, 0x82A6, 0x82A7, 0x82A8, 0x0107, 0x82AA, 0x0108, 0x82AC, 0x0109,
+    0x82AE, 0x010A, 0x82B0, 0x010B, 0x82B2, 0x82B3, 0x82B4, 0x82B5, 0x82B6, 0x82B7, 0x82B8, 0x82B9, 0x82BA, 0x82BB, 0x82BC, 0x82BD,
+    0x82BE, 0x82BF, 0x82C0, 0x82C1, 0x82C2, 0x82C3, 0x82C4, 0x82C5, 0x82C6, 0x82C7, 0x82C8, 0x82C9, 0x82CA, 0x82CB, 0x82CC, 0x82CD,
+    0x82CE, 0x82CF, 0x82D0, 0x82D1, 0x82D2, 0x82D3, 0x82D4, 0x82D5, 0x82D6, 0x82D7, 0x82D8, 0x82D9, 0x82DA, 0x82DB, 0x82DC, 0x82DD,
+    0x82DE, 0x82DF, 0x82E0, 0x82E1, 0x82E2, 0x82E3, 0x82E4, 0x82E5, 0x82E6, 0x82E7, 0x82E8, 0x82E9, 0x82EA, 0x82EB, 0x82EC, 0x82ED,
+    0x82EE, 0x82EF, 0x82F0, 0x82F1, 0x82F2, 0x82F3, 0x82F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x814A, 0x814B, 0x8154, 0x8155, 0x81B7,
+    0x829B, 0x8340, 0x8341, 0x8342, 0x8343, 0x8344, 0x8345, 0x8346, 0x8347, 0x8348, 0x8349, 0x010C, 0x834B, 0x010D, 0x834D, 0x010E,
+    0x834F, 0x010F, 0x8351, 0x0110, 0x8353, 0x8354, 0x8355, 0x8356, 0x8357, 0x8358, 0x8359, 0x0111, 0x835B, 0x835C, 0x835D, 0x835E,
+    0x835F, 0x8360, 0x8361, 0x8362, 0x0112, 0x8364, 0x8365, 0x8366, 0x0113, 0x8368, 0x8369, 0x836A, 0x836B, 0x836C, 0x836D, 0x836E,
+    0x836F, 0x8370, 0x8371, 0x8372, 0x8373, 0x8374, 0x8375, 0x8376, 0x8377, 0x8378, 0x8379, 0x837A, 0x837B, 0x837C, 0x837D, 0x837E,
+    0x8380, 0x8381, 0x8382, 0x8383, 0x8384, 0x8385, 0x8386, 0x8387, 0x8388, 0x8389, 0x838A, 0x838B, 0x838C, 0x838D, 0x838E, 0x838F,
+    0x8390, 0x8391, 0x8392, 0x8393, 0x8394, 0x8395, 0x8396, 0x8492, 0x8493, 0x8494, 0x8495, 0x8145, 0x815B, 0x8152, 0x8153, 0x81B6,
+  },
+  { /* U+31xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x83EC, 0x83ED, 0x83EE, 0x83EF, 0x83F0, 0x83F1, 0x83F2, 0x0114, 0x83F4, 0x83F5, 0x83F7, 0x83F8, 0x83F9, 0x83FA, 0x83FB, 0x83FC,
+  },
+  { /* U+32xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x878A, 0x878B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x878C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x84BF, 0x84C0, 0x84C1, 0x84C2, 0x84C3, 0x84C4, 0x84C5, 0x84C6, 0x84C7, 0x84C8, 0x84C9, 0x84CA, 0x84CB, 0x84CC, 0x84CD,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8785, 0x8786, 0x8787, 0x8788, 0x8789, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x84CE, 0x84CF, 0x84D0, 0x84D1, 0x84D2, 0x84D3, 0x84D4, 0x84D5, 0x84D6, 0x84D7, 0x84D8, 0x84D9, 0x84DA, 0x84DB, 0x84DC,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x86D9, 0x86DA, 0x86DB, 0x86DC, 0x86DD, 0x86DE, 0x86DF, 0x86E0, 0x86E1, 0x86E2, 0x86E3, 0x86E4, 0x86E5, 0x86E6, 0x86E7, 0x86E8,
+    0x86E9, 0x86EA, 0x86EB, 0x86EC, 0xFFFF, 0x86EF, 0xFFFF, 0xFFFF, 0xFFFF, 0x86EE, 0xFFFF, 0xFFFF, 0x86F1, 0x86F0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x86ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+33xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8765, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8769, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8760, 0xFFFF, 0xFFFF, 0xFFFF, 0x8763, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8761, 0x876B, 0xFFFF, 0xFFFF, 0x876A, 0x8764, 0xFFFF, 0xFFFF, 0xFFFF, 0x876C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8766, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x876E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x875F, 0x876D, 0xFFFF, 0xFFFF, 0x8762, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8767, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8768, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x877E, 0x878F, 0x878E, 0x878D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8772, 0x8773,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x876F, 0x8770, 0x8771, 0xFFFF,
+    0xFFFF, 0x8775, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8774, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x827D, 0xFFFF, 0x8783, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+34xx */
+    0xFFFF, 0xFFFF, 0x87A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xF04C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF051, 0xFFFF, 0xF052, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF07D, 0xFFFF, 0xF075, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF09E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x87D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF14A, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF7E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF14E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x87D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+35xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF167,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF17C, 0xF17D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF181, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF187, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1A1, 0xFFFF, 0xF1A4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+36xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF25E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF262, 0xFFFF, 0xFFFF, 0xF260, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF276,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+37xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF0A1, 0xF0A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0A7, 0xF0A6, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x987E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF0BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x988F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0DA, 0xFFFF, 0xFFFF,
+  },
+  { /* U+38xx */
+    0xF0DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0ED,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF0F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0F7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF0F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+39xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2C4, 0xFFFF, 0xFFFF, 0xF2C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2DE,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+3Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF37A, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF37E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF391, 0xF3B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF39C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+3Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3AC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3B0, 0xFFFF, 0xF3B2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEB68, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3EB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF447, 0xF448, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF44B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF453, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xEB9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF467, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF47C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+3Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBB8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF497, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF4B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF4C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+3Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF4EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4FC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF55F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF573, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF590, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF597, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+3Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC86,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF5BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5BF, 0xFFFF, 0xF5C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF5C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+3Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF653, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xECCB, 0xFFFF, 0xFFFF, 0xF665, 0xFFFF, 0xF667, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF67B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF687, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF68C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+40xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF6B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+41xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6F5,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF6FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF752, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF756,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF766, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF76A, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF767, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+42xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF772, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF776, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED8D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7B9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+43xx */
+    0xFFFF, 0xFFFF, 0xF7CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF85D, 0xFFFF,
+    0xF861, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+44xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF867, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF869, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF86B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF86E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xEDD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEDD8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF88C, 0xFFFF, 0xFFFF, 0xFFFF, 0xF88E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF897, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF8B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8B0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+45xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8D2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF8EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE70, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF96E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF98C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE80, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+46xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF9B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF9CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9D1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+47xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA48, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA5E, 0xFFFF, 0xFFFF,
+  },
+  { /* U+48xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA68, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA7B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+49xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEF77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB8A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB95, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBB5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFC45, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC47, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFC49, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC50, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFC5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCA8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFCAB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCC9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+4Exx */
+    0x88EA, 0x929A, 0xF041, 0x8EB5, 0xFFFF, 0xFFFF, 0xFFFF, 0x969C, 0x8FE4, 0x8E4F, 0x8FE3, 0x89BA, 0xFFFF, 0x9573, 0x975E, 0xF042,
+    0x98A0, 0x894E, 0xF043, 0xFFFF, 0x8A8E, 0x98A1, 0x90A2, 0x99C0, 0x8B75, 0x95B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FE5, 0xFFFF,
+    0xFFFF, 0x97BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x95C0, 0xFFFF, 0x87A2, 0xF044, 0x98A2, 0xF045, 0xF5AC, 0x9286, 0xF046, 0x87A3,
+    0x87A4, 0x98A3, 0x8BF8, 0xFFFF, 0xFFFF, 0xFFFF, 0x98A4, 0xFFFF, 0x8ADB, 0x924F, 0xFFFF, 0x8EE5, 0x98A5, 0xFFFF, 0xFFFF, 0x98A6,
+    0xF047, 0xFFFF, 0x98A7, 0x9454, 0xFFFF, 0x8B76, 0xFFFF, 0xF048, 0xF049, 0xFFFF, 0xFFFF, 0x9456, 0xFFFF, 0x93E1, 0x8CC1, 0x9652,
+    0xFFFF, 0xF04B, 0xFFFF, 0xFFFF, 0xFFFF, 0xE568, 0x98A8, 0x8FE6, 0x98A9, 0x89B3, 0xF04E, 0xFFFF, 0xFFFF, 0x8BE3, 0x8CEE, 0x96E7,
+    0xFFFF, 0xFFFF, 0x9BA4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF04F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9790, 0xFFFF, 0x93FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8AA3, 0xFFFF,
+    0x8B54, 0xFFFF, 0x98AA, 0xFFFF, 0xFFFF, 0x98AB, 0x97B9, 0xFFFF, 0x975C, 0x9188, 0x98AD, 0x8E96, 0x93F1, 0x87A5, 0x98B0, 0xFFFF,
+    0xFFFF, 0x895D, 0x8CDD, 0xFFFF, 0x8CDC, 0x88E4, 0xFFFF, 0xFFFF, 0x986A, 0x9869, 0xFFFF, 0x8DB1, 0x889F, 0xF050, 0x98B1, 0x98B2,
+    0x98B3, 0x9653, 0x98B4, 0xFFFF, 0x8CF0, 0x88E5, 0x9692, 0xFFFF, 0x8B9C, 0xFFFF, 0xFFFF, 0x8B9D, 0x8B9E, 0x92E0, 0x97BA, 0xFFFF,
+    0x98B5, 0xFFFF, 0xFFFF, 0x98B6, 0xFFFF, 0xFFFF, 0x98B7, 0xFFFF, 0xFFFF, 0xF053, 0x906C, 0xF054, 0xF056, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8F59, 0x906D, 0x98BC, 0xF057, 0x98BA, 0xFFFF, 0x98BB, 0x8B77, 0xF058, 0xFFFF, 0x8DA1, 0x89EE, 0xFFFF, 0x98B9, 0x98B8, 0x95A7,
+    0xF059, 0xFFFF, 0xFFFF, 0xFFFF, 0x8E65, 0x8E64, 0x91BC, 0x98BD, 0x9574, 0x90E5, 0xF05B, 0xFFFF, 0xFFFF, 0x8157, 0x98BE, 0x98C0,
+    0xFFFF, 0x87A6, 0xFFFF, 0x91E3, 0x97DF, 0x88C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF05A, 0xFFFF, 0x98BF, 0x89BC, 0xFFFF,
+    0x8BC2, 0xF05C, 0x9287, 0xFFFF, 0xFFFF, 0xF05D, 0x8C8F, 0x98C1, 0xFFFF, 0xFFFF, 0xFFFF, 0x9443, 0xFFFF, 0x87A7, 0xFFFF, 0x87A8,
+  },
+  { /* U+4Fxx */
+    0xF05E, 0x8AE9, 0xFFFF, 0x87A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x98C2, 0x88C9, 0x87AA, 0xFFFF, 0x8CDE, 0x8AEA, 0x959A,
+    0x94B0, 0x8B78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF05F, 0xFFFF, 0xFFFF, 0xFFFF, 0x89EF, 0xFFFF, 0x98E5, 0x9360, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x948C,
+    0x98C4, 0xFFFF, 0xFFFF, 0xFFFF, 0x94BA, 0xFFFF, 0x97E0, 0xF061, 0x904C, 0xFFFF, 0x8E66, 0xFFFF, 0x8E97, 0x89BE, 0xF062, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x92CF, 0xFFFF, 0xFFFF, 0x9241, 0x98C8, 0x87AC, 0x87AD, 0xFFFF, 0xFFFF, 0xFFFF, 0x88CA, 0x92E1, 0x8F5A,
+    0x8DB2, 0x9743, 0xFFFF, 0x91CC, 0xF063, 0x89BD, 0x87AE, 0x98C7, 0xF064, 0x975D, 0x98C3, 0x98C5, 0x8DEC, 0x98C6, 0x9B43, 0x87AF,
+    0x87AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF060, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x98CE, 0x87B0, 0xFFFF, 0x87B1, 0xFFFF, 0xFFFF, 0x98D1,
+    0x98CF, 0xFFFF, 0xFFFF, 0x89C0, 0xFFFF, 0x95B9, 0x98C9, 0xF066, 0xF067, 0xFFFF, 0xF068, 0x98CD, 0x8CF1, 0xF069, 0x87B2, 0x8E67,
+    0xFFFF, 0xFFFF, 0xF06A, 0x8AA4, 0xFFFF, 0xF06B, 0x98D2, 0xFFFF, 0x98CA, 0xFFFF, 0x87B3, 0x97E1, 0xFFFF, 0x8E98, 0xFFFF, 0x98CB,
+    0xFFFF, 0x98D0, 0xF06C, 0xFFFF, 0x87B4, 0xFFFF, 0x98D3, 0x87B5, 0x98CC, 0xFFFF, 0xF06D, 0x8B9F, 0xFFFF, 0x88CB, 0xFFFF, 0xFFFF,
+    0x8BA0, 0x89BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B44, 0xFFFF, 0x9699, 0x958E, 0x8CF2,
+    0xFFFF, 0xFFFF, 0xF06F, 0xFFFF, 0xFFFF, 0x904E, 0x97B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF070, 0x95D6,
+    0xFFFF, 0xFFFF, 0x8C57, 0x91A3, 0x89E2, 0xF071, 0xFFFF, 0xFFFF, 0xFFFF, 0x87B7, 0x8F72, 0xF072, 0xFFFF, 0xFFFF, 0x98D7, 0xF073,
+    0x98DC, 0x98DA, 0xF074, 0xFFFF, 0x98D5, 0xFFFF, 0xFFFF, 0x91AD, 0x98D8, 0xFFFF, 0x98DB, 0x98D9, 0xFFFF, 0x95DB, 0xFFFF, 0x98D6,
+    0x87B8, 0x904D, 0xFFFF, 0x9693, 0x98DD, 0x98DE, 0xF06E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F43, 0x98EB,
+    0xFFFF, 0x879F, 0xF076, 0x946F, 0xFFFF, 0x9555, 0x98E6, 0xFFFF, 0x95EE, 0xFFFF, 0x89B4, 0xFFFF, 0xFFFF, 0xFFFF, 0x98EA, 0xFFFF,
+  },
+  { /* U+50xx */
+    0xF077, 0x87B9, 0x87BA, 0xFFFF, 0xFFFF, 0x98E4, 0x98ED, 0xFFFF, 0xFFFF, 0x9171, 0xFFFF, 0x8CC2, 0xFFFF, 0x947B, 0x87BB, 0xE0C5,
+    0xF078, 0x98EC, 0x937C, 0xF079, 0x98E1, 0xFFFF, 0x8CF4, 0xFFFF, 0x87BC, 0x8CF3, 0x98DF, 0xFFFF, 0xF07A, 0xFFFF, 0xF07B, 0x8ED8,
+    0xFFFF, 0x98E7, 0xF07C, 0x95ED, 0x926C, 0x98E3, 0x8C91, 0x87BD, 0x98E0, 0x98E8, 0x98E2, 0x97CF, 0x98E9, 0x9860, 0x87BE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8BE4, 0xFFFF, 0xFFFF, 0x8C90, 0xFFFF, 0x87C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x87BF, 0x87C1, 0xF07E, 0x98EE, 0xFFFF, 0xFFFF, 0xF080, 0x98EF, 0x98F3, 0x88CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF081, 0x95CE,
+    0x98F2, 0xFFFF, 0xFFFF, 0xF082, 0xFFFF, 0x98F1, 0x98F5, 0xF083, 0xFFFF, 0xFFFF, 0x98F4, 0xFFFF, 0x92E2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF084, 0xFFFF, 0x8C92, 0xF085, 0xFFFF, 0xFFFF, 0xFFFF, 0xF086, 0xFFFF, 0x98F6, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF087, 0xFFFF, 0x8EC3, 0xFFFF, 0x91A4, 0x92E3, 0x8BF4, 0xFFFF, 0x98F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B55, 0xFFFF, 0xFFFF,
+    0x98F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x98FA, 0xFFFF, 0xFFFF, 0xF089, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9654, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8C86, 0xF08A, 0xF08B, 0x87C2, 0xF08C, 0xF08D, 0xFFFF, 0x8E50, 0x94F5, 0x98F9, 0xFFFF, 0xF08E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF088, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF08F, 0xFFFF, 0x8DC3, 0x9762, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF091, 0x98FC, 0x9942, 0x98FB, 0x8DC2, 0xFFFF, 0x8F9D, 0xFFFF, 0xFFFF, 0xF092, 0xF093, 0xFFFF, 0xFFFF, 0x8C58, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9943, 0xFFFF, 0xF094, 0x8BCD, 0xFFFF, 0xF095, 0xFFFF, 0x9940, 0x9941, 0xFFFF, 0x87C3, 0x93AD, 0xF098, 0x919C,
+    0x87C5, 0x8BA1, 0xFFFF, 0xFFFF, 0xF09A, 0x966C, 0x9944, 0xFFFF, 0xFFFF, 0xF09B, 0x97BB, 0xFFFF, 0xFFFF, 0xFFFF, 0x9945, 0xFFFF,
+    0xFFFF, 0xF09C, 0xFFFF, 0x9948, 0xFFFF, 0x9946, 0x87C6, 0x916D, 0xFFFF, 0xF09D, 0xFFFF, 0xFFFF, 0xFFFF, 0x9947, 0x9949, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x87C4, 0xF096, 0xFFFF, 0x994B, 0xFFFF, 0xFFFF, 0xFFFF, 0x994A, 0xFFFF, 0x95C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+51xx */
+    0x8B56, 0x994D, 0x994E, 0x87C9, 0x89AD, 0xFFFF, 0x87C8, 0xFFFF, 0xF140, 0x994C, 0xFFFF, 0x87CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8EF2, 0xFFFF, 0x9951, 0x9950, 0x994F, 0xF142, 0x98D4, 0xFFFF, 0x9952, 0xF143, 0xFFFF, 0xFFFF, 0x87CB, 0x8F9E,
+    0xFFFF, 0x9953, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9744, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x96D7, 0xFFFF, 0xFFFF, 0x87CC, 0xFFFF, 0x9955, 0xFFFF, 0xFFFF, 0x9954, 0x9957, 0x9956, 0xFFFF, 0xFFFF, 0x9958,
+    0x9959, 0x88F2, 0xFFFF, 0x8CB3, 0x8C5A, 0x8F5B, 0x929B, 0x8BA2, 0x90E6, 0x8CF5, 0x87CD, 0x8D8E, 0x995B, 0x96C6, 0x9365, 0xFFFF,
+    0x8E99, 0xFFFF, 0x995A, 0xFFFF, 0x995C, 0x87CF, 0xFFFF, 0x87D0, 0xFFFF, 0xFFFF, 0x937D, 0xFFFF, 0x8A95, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF145, 0xFFFF, 0x995D, 0xFFFF, 0xFFFF, 0x93FC, 0xFFFF, 0xFFFF, 0x9153, 0x995F, 0x9960, 0x94AA, 0x8CF6, 0x985A, 0x9961, 0xFFFF,
+    0xFFFF, 0x8BA4, 0xFFFF, 0xF147, 0xFFFF, 0x95BA, 0x91B4, 0x8BEF, 0x9354, 0xFFFF, 0xFFFF, 0xF7F2, 0x8C93, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9962, 0xFFFF, 0x9963, 0xF148, 0xFFFF, 0x93E0, 0x897E, 0xFFFF, 0xFFFF, 0x9966, 0x8DFB, 0xF149, 0x9965, 0x8DC4, 0xFFFF, 0x9967,
+    0xE3EC, 0x9968, 0x9660, 0x9969, 0xFFFF, 0x996A, 0x996B, 0x8FE7, 0xF14B, 0x8ECA, 0xFFFF, 0xFFFF, 0xFFFF, 0x87D2, 0xFFFF, 0xFFFF,
+    0x8AA5, 0xFFFF, 0x996E, 0xF14C, 0x996C, 0x96BB, 0x996D, 0xFFFF, 0x9579, 0x996F, 0x9970, 0x9971, 0x937E, 0xF14D, 0xFFFF, 0xFFFF,
+    0x9975, 0x9973, 0x9974, 0x9972, 0x8DE1, 0x9976, 0x96E8, 0x97E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF14F, 0x9977, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x87D3, 0x90A6, 0x9978, 0x8F79, 0xFFFF, 0xFFFF, 0x9979, 0x87D4, 0x929C, 0x97BD, 0x9380, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x99C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x997A, 0xEAA3, 0x8BC3, 0x87D5, 0xFFFF,
+    0x997B, 0x967D, 0x87D6, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F88, 0x91FA, 0xFFFF, 0x997D, 0x93E2, 0xFFFF, 0xFFFF, 0x997E, 0x87D7, 0xFFFF,
+    0x9980, 0x8A4D, 0xFFFF, 0xF152, 0xF153, 0x9981, 0x8BA5, 0xFFFF, 0x93CA, 0x899A, 0x8F6F, 0xFFFF, 0xFFFF, 0x949F, 0x9982, 0xFFFF,
+  },
+  { /* U+52xx */
+    0x9381, 0x87D8, 0xF154, 0x906E, 0x9983, 0xFFFF, 0x95AA, 0x90D8, 0x8AA0, 0xFFFF, 0x8AA7, 0x9984, 0xFFFF, 0xFFFF, 0x9986, 0xFFFF,
+    0xFFFF, 0x8C59, 0xF155, 0x87DA, 0x9985, 0x87DB, 0xF156, 0x97F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F89, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94BB, 0x95CA, 0xFFFF, 0x9987, 0xFFFF, 0x9798, 0x9988, 0xFFFF, 0xFFFF, 0xFFFF, 0x9989, 0xFFFF,
+    0x939E, 0xFFFF, 0xFFFF, 0x998A, 0xFFFF, 0xFFFF, 0x90A7, 0x8DFC, 0x8C94, 0x998B, 0x8E68, 0x8D8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x92E4, 0x998D, 0xFFFF, 0xFFFF, 0x91A5, 0xFFFF, 0x87DC, 0x8DED, 0x998E, 0x998F, 0x914F, 0xFFFF, 0x998C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9991, 0xF158, 0x9655, 0x87DD, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D84, 0xF159, 0x889E, 0x9990, 0xFFFF,
+    0xFFFF, 0x87DE, 0xFFFF, 0x8C95, 0x8DDC, 0x948D, 0xFFFF, 0xFFFF, 0xFFFF, 0x9994, 0x9992, 0xFFFF, 0xF15A, 0xFFFF, 0xFFFF, 0x959B,
+    0x8FE8, 0x999B, 0x8A84, 0x9995, 0x9993, 0x916E, 0xFFFF, 0xF15B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9997, 0xFFFF, 0x9996,
+    0xFFFF, 0xFFFF, 0xF15D, 0x8A63, 0xF15C, 0xFFFF, 0xFFFF, 0x8C80, 0x999C, 0x97AB, 0xFFFF, 0xFFFF, 0xFFFF, 0x9998, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x999D, 0x999A, 0x87DF, 0x9999, 0xFFFF, 0xFFFF, 0xFFFF, 0xF15F, 0xFFFF, 0xFFFF, 0x97CD, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CF7,
+    0x89C1, 0xFFFF, 0xFFFF, 0x97F2, 0xF161, 0xFFFF, 0xF162, 0xFFFF, 0xFFFF, 0x8F95, 0x9377, 0x8D85, 0x99A0, 0x99A1, 0xFFFF, 0xF163,
+    0xFFFF, 0x97E3, 0xFFFF, 0xFFFF, 0x984A, 0x99A3, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CF8, 0xF164, 0xF165, 0x99A2, 0xFFFF, 0x8A4E, 0xFFFF,
+    0xFFFF, 0x99A4, 0xFFFF, 0x9675, 0xFFFF, 0x92BA, 0xFFFF, 0x9745, 0x87E0, 0x95D7, 0xF166, 0xFFFF, 0x87E2, 0x99A5, 0xFFFF, 0xFFFF,
+    0x87E3, 0xF168, 0xE8D3, 0xFFFF, 0xFFFF, 0x93AE, 0x87E4, 0x99A6, 0x8AA8, 0x96B1, 0xFFFF, 0x87E5, 0xFFFF, 0x8F9F, 0x99A7, 0x95E5,
+    0x99AB, 0xFFFF, 0x90A8, 0x99A8, 0x8BCE, 0xFFFF, 0x99A9, 0x8AA9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x87E7, 0xFFFF, 0x8C4D, 0x99AC, 0xFFFF, 0x99AD, 0xFFFF, 0xF16A, 0x99AE, 0x99AF, 0x8ED9, 0x87E8, 0xFFFF, 0xFFFF, 0x8CF9, 0x96DC,
+  },
+  { /* U+53xx */
+    0x87E9, 0x96E6, 0x93F5, 0xFFFF, 0xFFFF, 0x95EF, 0x99B0, 0x87EA, 0x99B1, 0xFFFF, 0xF16B, 0xF16C, 0xFFFF, 0x99B3, 0xFFFF, 0x99B5,
+    0x99B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x99B6, 0x89BB, 0x966B, 0xFFFF, 0x8DFA, 0x99B7, 0xFFFF, 0x87EB, 0x9178, 0xFFFF, 0xFFFF,
+    0x8FA0, 0x8BA7, 0xFFFF, 0x99B8, 0xF16D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x99B9,
+    0xFFFF, 0x99BA, 0xFFFF, 0x99BB, 0xFFFF, 0xF16E, 0xFFFF, 0xFFFF, 0x99BC, 0x9543, 0x8BE6, 0x88E3, 0xFFFF, 0xFFFF, 0xF16F, 0x93BD,
+    0x99BD, 0x8F5C, 0xF170, 0x90E7, 0xFFFF, 0x99BF, 0x99BE, 0x8FA1, 0x8CDF, 0x99C1, 0x94BC, 0xFFFF, 0xFFFF, 0x99C2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x94DA, 0x91B2, 0x91EC, 0x8BA6, 0xFFFF, 0xFFFF, 0x93EC, 0x9250, 0xFFFF, 0x948E, 0xFFFF, 0x966D, 0xFFFF, 0x99C4, 0xFFFF,
+    0x90E8, 0x87ED, 0xFFFF, 0x87EE, 0xFFFF, 0xFFFF, 0x8C54, 0xF173, 0xFFFF, 0x99C5, 0xFFFF, 0xFFFF, 0xF174, 0xFFFF, 0x99C6, 0x894B,
+    0x88F3, 0x8AEB, 0xFFFF, 0x91A6, 0x8B70, 0x9791, 0xFFFF, 0x99C9, 0x89B5, 0xFFFF, 0xF175, 0x99C8, 0xFFFF, 0x87EF, 0xFFFF, 0x8BA8,
+    0xFFFF, 0xFFFF, 0x99CA, 0xFFFF, 0x96EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x87F0, 0xFFFF, 0xFFFF, 0x99CB, 0xFFFF, 0x97D0, 0xFFFF, 0x8CFA, 0xFFFF, 0xFFFF, 0x87F1, 0xFFFF, 0x8CB4,
+    0x99CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xF176, 0x99CE, 0x99CD, 0xFFFF, 0x907E, 0x8958, 0xFFFF, 0xFFFF, 0xFFFF, 0x897D, 0x99CF, 0xFFFF,
+    0x99D0, 0xFFFF, 0x87F2, 0x8CB5, 0xF177, 0xFFFF, 0x99D1, 0xF179, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF17A, 0xFFFF, 0x8E51, 0x99D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9694, 0x8DB3, 0x8B79, 0x9746, 0x916F, 0x94BD, 0x8EFB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F66, 0xF17E, 0x8EE6, 0x8EF3, 0xFFFF, 0x8F96, 0xF180, 0x94BE, 0xFFFF, 0xFFFF, 0xFFFF, 0x99D5,
+    0xFFFF, 0x8962, 0x9170, 0x8CFB, 0x8CC3, 0x8BE5, 0xFFFF, 0xFFFF, 0x99D9, 0x9240, 0x91FC, 0x8BA9, 0x8FA2, 0x99DA, 0x99D8, 0x89C2,
+    0x91E4, 0x8EB6, 0x8E6A, 0x8945, 0xF182, 0xF183, 0x8A90, 0x8D86, 0x8E69, 0xFFFF, 0x99DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+54xx */
+    0xFFFF, 0x99DC, 0xFFFF, 0x8B68, 0x8A65, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D87, 0x8B67, 0x92DD, 0x8944, 0x93AF, 0x96BC, 0x8D40, 0x9799,
+    0x9366, 0x8CFC, 0x87F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C4E, 0xFFFF, 0x99E5, 0x989E, 0x8BE1,
+    0x9669, 0xFFFF, 0xFFFF, 0xFFFF, 0xF185, 0xFFFF, 0x94DB, 0x87F4, 0xF186, 0x99E4, 0xFFFF, 0x8ADC, 0x99DF, 0x99E0, 0x99E2, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x99E3, 0xFFFF, 0x8B7A, 0x9081, 0xFFFF, 0x95AB, 0x99E1, 0x99DD, 0x8CE1, 0xFFFF,
+    0x99DE, 0xFFFF, 0x9843, 0xF188, 0xFFFF, 0xFFFF, 0x95F0, 0xFFFF, 0x92E6, 0x8CE0, 0x8D90, 0xFFFF, 0xFFFF, 0x87F5, 0x99E6, 0xFFFF,
+    0xFFFF, 0x93DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF184, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x99EA,
+    0xFFFF, 0xFFFF, 0xF189, 0xFFFF, 0xFFFF, 0xFFFF, 0xF18A, 0xFFFF, 0x8EFC, 0xFFFF, 0x8EF4, 0x87F7, 0xF18B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x99ED, 0x99EB, 0xFFFF, 0x96A1, 0x87F8, 0x99E8, 0x99F1, 0x99EC, 0xFFFF, 0xFFFF, 0xFFFF, 0x99EF, 0x8CC4, 0x96BD, 0xFFFF, 0x87F9,
+    0x99F0, 0xFFFF, 0xFFFF, 0xFFFF, 0x99F2, 0xFFFF, 0x99F4, 0xFFFF, 0x87FA, 0xFFFF, 0xF18C, 0x8DEE, 0x9861, 0xF18D, 0x99E9, 0x99E7,
+    0x99F3, 0xFFFF, 0x99EE, 0xFFFF, 0xFFFF, 0xF18E, 0x87FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x87F6, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF18F, 0x87FC, 0x99F6, 0xFFFF, 0x9A42, 0x99F8, 0xF190, 0xFFFF, 0x99FC, 0x8840, 0xFFFF, 0x9A40, 0x99F9, 0xF191, 0xF192, 0x9A5D,
+    0xFFFF, 0xFFFF, 0x8DE7, 0x8A50, 0xFFFF, 0xFFFF, 0xFFFF, 0xF193, 0x99F7, 0xFFFF, 0xF194, 0xFFFF, 0x9A44, 0x88F4, 0x9A43, 0xF195,
+    0x88A3, 0x9569, 0x9A41, 0xF196, 0x99FA, 0xFFFF, 0x8841, 0x99F5, 0x99FB, 0x8DC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A45, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x88F5, 0x9A4E, 0xFFFF, 0xFFFF, 0x9A46, 0x9A47, 0xFFFF, 0x8FA3, 0x9689, 0xFFFF, 0xFFFF, 0xF198, 0x9A4C, 0x9A4B, 0xF199,
+    0xFFFF, 0xF19A, 0x934E, 0xF19B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A4D, 0xFFFF, 0xFFFF, 0x9A4A, 0xFFFF, 0x8842,
+  },
+  { /* U+55xx */
+    0xF19C, 0xF19D, 0xFFFF, 0xFFFF, 0x8953, 0xFFFF, 0x8DB4, 0x904F, 0xFFFF, 0xF19E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8843, 0x9A48,
+    0x9382, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A49, 0xFFFF, 0x88A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8844, 0xFFFF, 0xFFFF, 0x9A53, 0x9742,
+    0xFFFF, 0x8FA5, 0xFFFF, 0x9A59, 0xFFFF, 0x8845, 0xFFFF, 0xFFFF, 0x9A58, 0x9A4F, 0xFFFF, 0xFFFF, 0xF19F, 0xFFFF, 0x91C1, 0xFFFF,
+    0x9A50, 0xF1A0, 0xFFFF, 0xFFFF, 0x91ED, 0x9A55, 0x8FA4, 0xF1A2, 0xFFFF, 0xFFFF, 0xF1A3, 0xFFFF, 0x9A52, 0xFFFF, 0xFFFF, 0x96E2,
+    0x8846, 0xFFFF, 0xFFFF, 0x8C5B, 0xFFFF, 0xFFFF, 0x9A56, 0x9A57, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A54, 0x9A5A, 0x8847, 0xFFFF,
+    0xF1A5, 0xF1A6, 0xFFFF, 0x9A51, 0xF1A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A60, 0x9A65, 0xF1A9, 0x9A61, 0xFFFF,
+    0x9A5C, 0x8848, 0xF1AA, 0x9A66, 0x9150, 0xFFFF, 0x8849, 0x9A68, 0xF1AB, 0x8D41, 0x9A5E, 0x929D, 0xFFFF, 0xFFFF, 0x884A, 0xFFFF,
+    0xFFFF, 0xF1AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A62, 0x9A5B, 0x8AAB, 0xFFFF, 0x8AEC, 0x8A85, 0x9A63, 0x9A5F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C96, 0x9A69, 0x9A67, 0x9172, 0x8B69, 0x8BAA, 0x884C, 0x9A64, 0xFFFF,
+    0x8BF2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8963, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1B1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A6D, 0x9A6B, 0xFFFF, 0x9AA5, 0xFFFF, 0xF1B2, 0xFFFF, 0xFFFF, 0xF1B3, 0xFFFF, 0x884D, 0xFFFF,
+    0xFFFF, 0xF1B4, 0xF1AE, 0xFFFF, 0x9A70, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A6A, 0xFFFF, 0x9A6E, 0xF1B5, 0xFFFF, 0x9A6C,
+    0xFFFF, 0xFFFF, 0xF1B7, 0x8E6B, 0x9A6F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A72, 0xFFFF, 0x9A77, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A75, 0x9A74, 0xFFFF,
+  },
+  { /* U+56xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9251, 0xF1BC, 0x884F, 0x89C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8850, 0xFFFF,
+    0xF1BD, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A71, 0xFFFF, 0x9A73, 0x8FA6, 0x8952, 0xFFFF, 0xFFFF, 0x9A76, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1BA, 0x89DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A82,
+    0xF1BE, 0x8FFA, 0x9A7D, 0xFFFF, 0x9A7B, 0xFFFF, 0x9A7C, 0xF1BF, 0x9A7E, 0xFFFF, 0xFFFF, 0x8851, 0xFFFF, 0xF1C1, 0xFFFF, 0xF1C2,
+    0xF1C3, 0xFFFF, 0x895C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1C4, 0xFFFF, 0x8852, 0xFFFF, 0xFFFF, 0x9158, 0xFFFF, 0x9A78, 0xFFFF,
+    0x9A79, 0xFFFF, 0xFFFF, 0xEAA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A9A, 0xFFFF, 0xFFFF, 0xF1C5, 0xFFFF,
+    0xF1C6, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A81, 0xFFFF, 0x8854, 0xFFFF, 0x8AED, 0xFFFF, 0x9A84, 0x9A80, 0x9A83, 0xF1C7, 0xFFFF, 0x8856,
+    0xFFFF, 0x8857, 0x8858, 0xFFFF, 0x95AC, 0xFFFF, 0x8853, 0xFFFF, 0x93D3, 0xFFFF, 0x94B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9A86, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A85, 0x8A64, 0xF1C9, 0xFFFF, 0x9A87, 0xFFFF, 0xF1CA, 0xFFFF, 0xFFFF, 0x9A8A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A89, 0xF1CB, 0xFFFF, 0xFFFF, 0xFFFF, 0x8859, 0xF1CC, 0xFFFF, 0xFFFF, 0xF1CD, 0x885A, 0xFFFF,
+    0x9A88, 0xFFFF, 0x9458, 0xFFFF, 0xFFFF, 0x9A8B, 0xFFFF, 0xFFFF, 0xF1CE, 0x885B, 0xFFFF, 0xFFFF, 0x885C, 0xF1CF, 0x9A8C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF1D0, 0x885D, 0x9A8E, 0xFFFF, 0x9A8D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A90, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9A93, 0x9A91, 0x9A8F, 0x9A92, 0xFFFF, 0xF1D1, 0xFFFF, 0xFFFF, 0x9A94, 0x885E, 0x885F, 0xFFFF, 0xFFFF, 0xF1D2, 0x9A95, 0xFFFF,
+    0xFFFF, 0x9A96, 0xFFFF, 0x9A97, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A98, 0x9964, 0xFFFF, 0x8EFA, 0x8E6C, 0xFFFF, 0xFFFF, 0x89F1, 0xF1D3,
+    0x88F6, 0xFFFF, 0xFFFF, 0x9263, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A99, 0xFFFF,
+    0x8DA2, 0xFFFF, 0x88CD, 0x907D, 0xFFFF, 0xFFFF, 0xF1D5, 0xF1D6, 0xFFFF, 0x9A9A, 0x8CC5, 0xFFFF, 0xFFFF, 0x8D91, 0xFFFF, 0x9A9C,
+  },
+  { /* U+57xx */
+    0x9A9B, 0xFFFF, 0xFFFF, 0x95DE, 0x9A9D, 0xFFFF, 0xFFFF, 0xFFFF, 0x9A9F, 0x9A9E, 0x8860, 0x9AA0, 0xFFFF, 0x9AA1, 0xFFFF, 0x8C97,
+    0xFFFF, 0xFFFF, 0x8980, 0x9AA2, 0xFFFF, 0xF1D8, 0x9AA4, 0xFFFF, 0x9AA3, 0xFFFF, 0xFFFF, 0xFFFF, 0x9AA6, 0xFFFF, 0xFFFF, 0x9379,
+    0xFFFF, 0x8862, 0xFFFF, 0xF1D9, 0xFFFF, 0xFFFF, 0x9AA7, 0x88B3, 0x8DDD, 0xF1DB, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C5C, 0xFFFF, 0x8863,
+    0x926E, 0xFFFF, 0xFFFF, 0x8864, 0x8865, 0xFFFF, 0xFFFF, 0x9AA8, 0x9AA9, 0xFFFF, 0xFFFF, 0x9AAB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9AAC, 0xFFFF, 0x8DE2, 0xFFFF, 0xFFFF, 0xF1DD, 0xF1DE, 0x8BCF, 0xFFFF, 0xFFFF, 0x9656, 0xFFFF, 0xF1DF, 0xF1E0, 0x9AAA, 0x9AAD,
+    0x8DBF, 0x8D42, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9AB1, 0xFFFF, 0xFFFF, 0x8DA3, 0xFFFF, 0x9252, 0xFFFF, 0xF1E2, 0x9AAE, 0x92D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1E3,
+    0x8866, 0xFFFF, 0xFFFF, 0xF1E4, 0xF1E5, 0xF1E6, 0xFFFF, 0x8867, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1E7, 0x8868, 0xFFFF, 0xFFFF, 0x9AB2,
+    0xFFFF, 0xFFFF, 0x9082, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9AB0, 0x9AB3, 0xFFFF, 0x8C5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9AB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1EB, 0xFFFF, 0x8869, 0xF1EC, 0xF1ED, 0xFFFF,
+    0x9AB5, 0xFFFF, 0x8D43, 0x8A5F, 0x9AB7, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1EE, 0xFFFF, 0x9AB8, 0xFFFF, 0xF1EA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9AB9, 0xFFFF, 0xFFFF, 0x9AB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x886C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9AAF, 0xFFFF, 0xFFFF, 0x9ABA, 0xFFFF, 0xFFFF, 0x9ABB, 0x886D, 0x886E, 0xFFFF, 0xFFFF, 0x9684, 0xF1F1, 0xFFFF, 0x8FE9, 0x886F,
+    0xFFFF, 0xFFFF, 0x9ABD, 0x9ABE, 0x9ABC, 0xFFFF, 0x9AC0, 0xF1EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9457, 0xFFFF, 0xF1F4, 0x88E6,
+    0x9575, 0xFFFF, 0xFFFF, 0x9AC1, 0x8870, 0xFFFF, 0xF1F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8871, 0xFFFF, 0xFFFF,
+    0xF1F6, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FFB, 0x8872, 0x8873, 0x8EB7, 0xF1F8, 0x947C, 0x8AEE, 0xF1F9, 0x8DE9, 0xF1FA, 0xFFFF, 0x8874,
+  },
+  { /* U+58xx */
+    0x9678, 0xFFFF, 0x93B0, 0xFFFF, 0xF1FB, 0x8C98, 0x91CD, 0xFFFF, 0xFFFF, 0x8875, 0x9ABF, 0x9AC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x91C2, 0xFFFF, 0xFFFF, 0xFFFF, 0x9AC3, 0xFFFF, 0xFFFF, 0xFFFF, 0x9AC4, 0xF1FC, 0xFFFF,
+    0xF240, 0x9AC6, 0xFFFF, 0xFFFF, 0x92E7, 0xFFFF, 0xFFFF, 0xF241, 0xFFFF, 0xFFFF, 0x8AAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA9F,
+    0x8981, 0x95F1, 0xF242, 0xFFFF, 0x8FEA, 0x9367, 0xFFFF, 0xFFFF, 0xFFFF, 0xF243, 0x8DE4, 0xFFFF, 0xFFFF, 0x9ACC, 0xFFFF, 0xFFFF,
+    0x95BB, 0x97DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF245, 0x89F2, 0x9AC8, 0xF246, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9159, 0x9ACB, 0xFFFF, 0x9383, 0xFFFF, 0xFFFF, 0x9368, 0x9384, 0x94B7, 0x92CB, 0xFFFF, 0xFFFF, 0xFFFF, 0x8DC7, 0xFFFF,
+    0xFFFF, 0x8877, 0x9AC7, 0xFFFF, 0x8878, 0xFFFF, 0xFFFF, 0xF247, 0xFFFF, 0x8996, 0xFFFF, 0x9355, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9AC9, 0xFFFF, 0x9AC5, 0xFFFF, 0xFFFF, 0x906F, 0xFFFF, 0xFFFF, 0xFFFF, 0x9ACD, 0xFFFF, 0xFFFF, 0x887A, 0xFFFF, 0x8F6D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8BAB, 0xFFFF, 0x9ACE, 0xFFFF, 0xFFFF, 0xFFFF, 0x887B, 0xF248, 0xF249, 0xFFFF, 0xF24A, 0xFFFF, 0xF24B,
+    0xF24C, 0xFFFF, 0xFFFF, 0x95E6, 0xF24D, 0xFFFF, 0xFFFF, 0x919D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x92C4, 0xF24E, 0x887C, 0x9AD0,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x966E, 0x887E, 0xF24F, 0x9AD1, 0xFFFF, 0xFFFF, 0x9AD6, 0xFFFF,
+    0xFFFF, 0xF250, 0xFFFF, 0x95AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9AD5, 0x9ACF, 0x9AD2, 0x9AD4, 0xFFFF, 0xFFFF, 0x8DA4, 0xFFFF,
+    0xFFFF, 0x95C7, 0xFFFF, 0xF252, 0xFFFF, 0x9AD7, 0xFFFF, 0x9264, 0xFFFF, 0xFFFF, 0x89F3, 0xFFFF, 0x8FEB, 0xF253, 0x8882, 0xFFFF,
+    0xFFFF, 0x9AD9, 0x8881, 0x9AD8, 0x8883, 0x8D88, 0xFFFF, 0x9ADA, 0x9ADC, 0x9ADB, 0x8884, 0xFFFF, 0x9ADE, 0xFFFF, 0x9AD3, 0x9AE0,
+    0x8885, 0xFFFF, 0xF254, 0xFFFF, 0x9ADF, 0x9ADD, 0xFFFF, 0xFFFF, 0xFFFF, 0x8886, 0xFFFF, 0x8E6D, 0x9070, 0xFFFF, 0x9173, 0x9AE1,
+    0x90BA, 0x88EB, 0x9484, 0xF255, 0xF256, 0xFFFF, 0xFFFF, 0x92D9, 0xFFFF, 0x9AE3, 0x9AE2, 0x9AE4, 0x9AE5, 0x9AE6, 0xFFFF, 0xFFFF,
+  },
+  { /* U+59xx */
+    0xFFFF, 0xFFFF, 0x9AE7, 0xFFFF, 0xFFFF, 0xF257, 0xF258, 0xFFFF, 0xFFFF, 0x95CF, 0x9AE8, 0xF259, 0x8887, 0xF25A, 0xFFFF, 0x89C4,
+    0x9AE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xF25B, 0x975B, 0x8A4F, 0xFFFF, 0x99C7, 0x8F67, 0x91BD, 0x9AEA, 0x96E9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x96B2, 0xFFFF, 0xF25C, 0x9AEC, 0xFFFF, 0x91E5, 0xFFFF, 0x9356, 0x91BE, 0x9576, 0x9AED, 0x9AEE, 0x899B, 0xFFFF,
+    0xFFFF, 0x8EB8, 0x9AEF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x88CE, 0x9AF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF25F, 0x9AF1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8982, 0xFFFF, 0xF261, 0x8AEF, 0x93DE, 0x95F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9AF5, 0x9174,
+    0x9AF4, 0x8C5F, 0xFFFF, 0xFFFF, 0x967A, 0x9AF3, 0xFFFF, 0x9385, 0x9AF7, 0xFFFF, 0x9AF6, 0xF264, 0xFFFF, 0x8889, 0xFFFF, 0xF265,
+    0x9AF9, 0xFFFF, 0x9AF8, 0xFFFF, 0xFFFF, 0x899C, 0xFFFF, 0x9AFA, 0x8FA7, 0x9AFC, 0x9244, 0xFFFF, 0x9AFB, 0x888A, 0x95B1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8F97, 0x937A, 0xF267, 0xF268, 0xFFFF, 0x9B40, 0xFFFF, 0xFFFF, 0xFFFF, 0xF269, 0x8D44, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9B41, 0x9440, 0x94DC, 0x96CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9444, 0x888B, 0xFFFF, 0x9B4A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x888C, 0x8B57, 0xFFFF, 0xFFFF, 0x9764, 0xFFFF, 0xFFFF, 0x96AD, 0xFFFF, 0x9BAA, 0xFFFF, 0x9B42, 0xFFFF, 0xF26A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9B45, 0x888D, 0x91C3, 0xFFFF, 0xFFFF, 0x9657, 0xFFFF, 0xFFFF, 0xFFFF, 0x9369, 0xFFFF, 0xF26B, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9B46, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9685, 0xFFFF, 0x8DC8, 0xF26C, 0xFFFF, 0x8FA8, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x888E, 0xFFFF, 0xFFFF, 0x9B47, 0xFFFF, 0xF26D, 0x8E6F, 0xFFFF, 0x8E6E, 0xFFFF, 0xF26E, 0xFFFF, 0xFFFF,
+    0x88B7, 0x8CC6, 0x888F, 0x90A9, 0x88CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B4B, 0x9B4C, 0xFFFF, 0x9B49, 0x8890, 0xF26F, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF270, 0xF271, 0x8957, 0x8AAD, 0xF272, 0x9B48, 0xFFFF, 0x96C3, 0x9550, 0xFFFF, 0xFFFF, 0xF273, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x88A6, 0xFFFF, 0xEFF8, 0xFFFF, 0xFFFF, 0x88F7, 0xFFFF, 0xFFFF, 0xFFFF, 0x8E70,
+  },
+  { /* U+5Axx */
+    0xFFFF, 0x88D0, 0xFFFF, 0x88A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B51, 0xFFFF, 0xFFFF, 0xF277, 0xF278, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9B4F, 0xFFFF, 0x8891, 0xFFFF, 0xFFFF, 0xFFFF, 0xF279, 0x96BA, 0xFFFF, 0x9B52, 0xFFFF, 0x9B50, 0xFFFF, 0xFFFF, 0x9B4E,
+    0x9050, 0xFFFF, 0xFFFF, 0x8892, 0xFFFF, 0x9B4D, 0xFFFF, 0xF27A, 0xFFFF, 0x95D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xF27B, 0xFFFF, 0x8CE2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B56, 0x9B57, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FA9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9B53, 0x984B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x946B, 0xFFFF, 0xFFFF, 0x9B55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF27C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8DA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9B58, 0xFFFF, 0xFFFF, 0xF27D, 0x9577, 0x8893, 0xFFFF, 0xFFFF, 0x9B59, 0xFFFF, 0x9B54, 0x8894, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8895, 0xFFFF, 0xFFFF, 0xF27E, 0xFFFF, 0xFFFF, 0xFFFF, 0x8896, 0x96B9,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8897, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF280, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x947D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B5A, 0x9551, 0xF281, 0xFFFF, 0x8898, 0xF282,
+    0xF283, 0xFFFF, 0xF284, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8899, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF285, 0xFFFF, 0xF286, 0xFFFF, 0xF287, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF288, 0xFFFF, 0x9B5B, 0x9B5F, 0x9B5C, 0xF289,
+    0xFFFF, 0x89C5, 0x9B5E, 0xFFFF, 0x889A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EB9, 0xFFFF, 0x9B5D, 0x8C99, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9B6B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B64, 0x9B61, 0xFFFF, 0xFFFF, 0xF28A, 0xFFFF, 0xF28B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF28C, 0x9284, 0xFFFF, 0x9B60, 0xFFFF, 0xF28D, 0x9B62, 0xFFFF, 0xFFFF, 0x9B63, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF28F, 0xFFFF,
+    0xF28E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF290, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B65, 0x9B66, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+5Bxx */
+    0xF291, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF292, 0x8AF0, 0xFFFF, 0x9B68, 0x9B67, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B69, 0xF293, 0xFFFF, 0x889C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8FEC, 0xFFFF, 0xFFFF, 0x889D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B6C, 0xFFFF, 0x92DA, 0xF295, 0xFFFF, 0xFFFF,
+    0x8964, 0xFFFF, 0x9B6A, 0xFFFF, 0xF294, 0xFFFF, 0x9B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B6E, 0xFFFF,
+    0x9B71, 0x9874, 0xFFFF, 0x9B6F, 0xFFFF, 0x9B70, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF296, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8E71, 0x9B72, 0xF297, 0xFFFF, 0x8D45, 0x9B73, 0x9875, 0x8E9A, 0x91B6, 0xFFFF, 0x9B74, 0x9B75, 0x8E79, 0x8D46, 0xFFFF, 0x96D0,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8B47, 0x8CC7, 0x9B76, 0x8A77, 0xFFFF, 0xF298, 0x9B77, 0xFFFF, 0x91B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xF299,
+    0x9B78, 0x9BA1, 0xFFFF, 0x9B79, 0xFFFF, 0x9B7A, 0xFFFF, 0xFFFF, 0x9B7B, 0xFFFF, 0x9B7D, 0xFFFF, 0xF29A, 0x9876, 0xFFFF, 0xF29B,
+    0x9B7E, 0xF29C, 0xFFFF, 0x9B80, 0xF29D, 0x91EE, 0xFFFF, 0x8946, 0x8EE7, 0x88C0, 0xFFFF, 0x9176, 0x8AAE, 0x8EB3, 0xFFFF, 0x8D47,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9877, 0xFFFF, 0x9386, 0xF09F, 0x8F40, 0x8AAF, 0x9288, 0x92E8, 0x88B6, 0x8B58, 0x95F3, 0xFFFF, 0x8EC0,
+    0xFFFF, 0xFFFF, 0x8B71, 0x90E9, 0x8EBA, 0x9747, 0x9B81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0A0, 0xFFFF, 0x8B7B, 0xFFFF,
+    0x8DC9, 0xFFFF, 0xFFFF, 0x8A51, 0x8983, 0x8FAA, 0x89C6, 0xFFFF, 0x9B82, 0x9765, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F68,
+    0xF0A2, 0xFFFF, 0x8EE2, 0x9B83, 0x8AF1, 0x93D0, 0x96A7, 0x9B84, 0xFFFF, 0x9B85, 0xFFFF, 0xFFFF, 0x9578, 0xFFFF, 0xF0A4, 0xFFFF,
+    0x9B87, 0xFFFF, 0x8AA6, 0x8BF5, 0x9B86, 0xFFFF, 0xF0A5, 0xFFFF, 0x9878, 0xFFFF, 0xFFFF, 0x8AB0, 0xFFFF, 0x9051, 0x9B8B, 0x8E40,
+    0xFFFF, 0x89C7, 0x9B8A, 0xFFFF, 0x9B88, 0x9B8C, 0x9B89, 0x944A, 0x9ECB, 0x9052, 0xFFFF, 0x9B8D, 0x9879, 0xFFFF, 0x97BE, 0xFFFF,
+    0x9B8E, 0xF0A8, 0xFFFF, 0x9B90, 0xFFFF, 0x929E, 0x9B8F, 0xFFFF, 0x90A1, 0xFFFF, 0x8E9B, 0xFFFF, 0xFFFF, 0xF0A9, 0x91CE, 0x8EF5,
+  },
+  { /* U+5Cxx */
+    0xFFFF, 0x9595, 0x90EA, 0xF0AB, 0x8ECB, 0x9B91, 0x8FAB, 0x9B92, 0x9B93, 0x88D1, 0x91B8, 0x9071, 0xFFFF, 0x9B94, 0x93B1, 0x8FAC,
+    0xFFFF, 0x8FAD, 0x987A, 0x9B95, 0xFFFF, 0xFFFF, 0x90EB, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FAE, 0xFFFF, 0xFFFF, 0xFFFF, 0x987B, 0xFFFF,
+    0x9B96, 0xFFFF, 0x9B97, 0x987C, 0x96DE, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B98, 0xF0AC, 0xFFFF, 0x987D, 0xFFFF, 0x8BC4, 0xFFFF, 0xFFFF,
+    0xF0AD, 0x8F41, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9B99, 0x9B9A, 0x8EDA, 0x904B, 0x93F2, 0x9073, 0x94F6, 0x9441,
+    0x8BC7, 0x9B9B, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B8F, 0x9B9C, 0xFFFF, 0x8BFC, 0xFFFF, 0x93CD, 0x89AE, 0xFFFF, 0x8E72, 0x9B9D, 0x9BA0,
+    0x9B9F, 0x8BFB, 0xFFFF, 0x9B9E, 0xFFFF, 0x9357, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFF9, 0xFFFF, 0xFFFF, 0x91AE, 0xF0AF,
+    0x936A, 0x8EC6, 0x9880, 0xF0B0, 0x9177, 0x979A, 0xFFFF, 0xF0B1, 0xF0B2, 0xF0B3, 0xFFFF, 0xFFFF, 0x9BA2, 0xFFFF, 0x9BA3, 0x93D4,
+    0xF0B4, 0x8E52, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BA5, 0xFFFF, 0xFFFF, 0x9BA6, 0x9884, 0xFFFF, 0xF0B7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0BA, 0xFFFF, 0xF0BB, 0xFFFF, 0x9BA7, 0xFFFF, 0xFFFF, 0x9885,
+    0x8AF2, 0x9BA8, 0xFFFF, 0xFFFF, 0x9BA9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9886,
+    0xF0BF, 0x89AA, 0xF0C0, 0x9887, 0xFFFF, 0xFFFF, 0xF0C1, 0xF0C2, 0x915A, 0x8AE2, 0x9888, 0x9BAB, 0x96A6, 0xF0C4, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x91D0, 0xFFFF, 0x8A78, 0xFFFF, 0xF0C5, 0x9BAD, 0x9BAF, 0x8ADD, 0xFFFF, 0x9889, 0x9BAC, 0x9BAE, 0xFFFF, 0x9BB1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BB0, 0xFFFF, 0x9BB2, 0xFFFF, 0xF0C7, 0xFFFF, 0x988A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x988B, 0xFFFF, 0x988C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x93BB, 0x8BAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x89E3, 0x9BB4, 0x9BB9, 0xFFFF, 0xFFFF, 0x9BB7, 0xFFFF, 0x95F5,
+    0x95F4, 0xFFFF, 0xFFFF, 0xFFFF, 0x988D, 0xFFFF, 0x9387, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BB6, 0x8F73, 0xFFFF, 0x9BB5, 0xFFFF, 0xFFFF,
+  },
+  { /* U+5Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0CA, 0x9092, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BBA, 0xFFFF, 0x9890, 0x8DE8, 0xFFFF,
+    0xF0CB, 0x9BC0, 0xFFFF, 0xFFFF, 0x9BC1, 0x9BBB, 0x8A52, 0x9BBC, 0x9BC5, 0x9BC4, 0x9BC3, 0x9BBF, 0xFFFF, 0xF0CD, 0xFFFF, 0x9BBE,
+    0xF0CE, 0xFFFF, 0x9BC2, 0xFFFF, 0xF0CF, 0xFFFF, 0xF0D0, 0x9891, 0xFFFF, 0x95F6, 0xFFFF, 0xF0CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF0D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF0D3, 0xFFFF, 0xFFFF, 0xFFFF, 0x9893, 0x9894, 0xFFFF, 0xFFFF, 0x9896, 0x9BC9, 0x9BC6, 0xFFFF, 0x9BC8, 0xFFFF,
+    0x9792, 0xFFFF, 0x9BC7, 0x9895, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BBD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF0D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9093, 0xF0D6, 0xFFFF, 0x9BCA, 0x9897, 0xFFFF, 0x8DB5,
+    0xF0D8, 0xFFFF, 0xFFFF, 0x9BCB, 0xFFFF, 0xFFFF, 0x9BCC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9898, 0x9BCF, 0xFFFF, 0x9BCE, 0xFFFF, 0xFFFF, 0x9BCD, 0xF0DB, 0xFFFF, 0xFFFF, 0x9388, 0x9BB8, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9BD5, 0xFFFF, 0xF0DD, 0xFFFF, 0xF0DE, 0xFFFF, 0xFFFF, 0xF0DF, 0xFFFF, 0xF0E0, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BD1, 0xFFFF, 0xFFFF,
+    0x9899, 0xFFFF, 0x9BD0, 0xFFFF, 0x989A, 0xFFFF, 0xFFFF, 0x989B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BD2, 0xFFFF, 0x9BD3, 0xFFFF,
+    0xF0E1, 0xFFFF, 0xF0E2, 0xFFFF, 0xF0E3, 0xFFFF, 0xFFFF, 0x9BD6, 0x989C, 0xF0E5, 0x97E4, 0xFFFF, 0x9BD7, 0x9BD4, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BD8, 0xFFFF, 0x989D, 0x8ADE, 0x9BD9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF0E6, 0x9BDB, 0x9BDA, 0xFFFF, 0xFFFF, 0x9BDC, 0xF0E7, 0xF0E8, 0xFFFF, 0xFFFF, 0x9BDD, 0xFFFF, 0x90EC, 0x8F42, 0xFFFF,
+    0xF0E9, 0x8F84, 0xEAA6, 0x9183, 0xF0EB, 0x8D48, 0x8DB6, 0x8D49, 0x8B90, 0xF0EC, 0xFFFF, 0x9BDE, 0xFFFF, 0xFFFF, 0x8DB7, 0xFFFF,
+    0xFFFF, 0x8CC8, 0x9BDF, 0x96A4, 0x9462, 0x9BE0, 0xFFFF, 0x8D4A, 0xFFFF, 0xFFFF, 0xFFFF, 0x8AAA, 0xFFFF, 0x9246, 0x8BD0, 0xFFFF,
+  },
+  { /* U+5Exx */
+    0xF0EE, 0xFFFF, 0x8E73, 0x957A, 0xFFFF, 0xFFFF, 0x94BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BE1, 0x8AF3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9BE4, 0xF0F0, 0xFFFF, 0xEAA7, 0xF0F1, 0x929F, 0xFFFF, 0xEAA8, 0x9BE3, 0x9BE2, 0x9BE5, 0xFFFF, 0x92E9, 0xFFFF, 0xF0F3,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9083, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8E74, 0xFFFF, 0x90C8, 0xF0F4, 0x91D1,
+    0x8B41, 0xFFFF, 0xFFFF, 0x92A0, 0xFFFF, 0xFFFF, 0x9BE6, 0x9BE7, 0x8FED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9658, 0xF0F5, 0xFFFF,
+    0x9BEA, 0xFFFF, 0xFFFF, 0x9BE9, 0x9BE8, 0x959D, 0xFFFF, 0x9BF1, 0xFFFF, 0xF0F6, 0xFFFF, 0xFFFF, 0x9679, 0xFFFF, 0x9BEB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BED, 0x968B, 0xF0F8, 0x9BEC, 0xEAA9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAAA, 0x9BEE,
+    0xFFFF, 0x94A6, 0x9BEF, 0x95BC, 0x9BF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0FA, 0xF0FB, 0xF0FC, 0xF29F, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8AB1, 0x95BD, 0x944E, 0x9BF2, 0x9BF3, 0xEFFA, 0x8D4B, 0x8AB2, 0x9BF4, 0x8CB6, 0x9763, 0x9748, 0x8AF4, 0x9BF6,
+    0xFFFF, 0x92A1, 0xFFFF, 0x8D4C, 0x8FAF, 0xFFFF, 0xFFFF, 0x94DD, 0xFFFF, 0xFFFF, 0x8FB0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F98,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x92EA, 0x95F7, 0x9358, 0xFFFF, 0xFFFF, 0x8D4D, 0xFFFF, 0x957B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9BF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2A1, 0x9378, 0x8DC0, 0xFFFF, 0xFFFF, 0xF2A2, 0x8CC9, 0xF2A3, 0x92EB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x88C1, 0x8F8E, 0x8D4E, 0x9766, 0xF2A4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAAB, 0xF2A5,
+    0xFFFF, 0x9BF8, 0x9BF9, 0x9470, 0xFFFF, 0xFFFF, 0xF2A6, 0xFFFF, 0x9BFA, 0x97F5, 0x984C, 0xEAAD, 0xFFFF, 0xFFFF, 0xFFFF, 0x9BFC,
+    0x9BFB, 0xFFFF, 0xF2A7, 0x8A66, 0xFFFF, 0xFFFF, 0x9C40, 0xFFFF, 0xFFFF, 0xF2A8, 0x9C43, 0x9C44, 0xFFFF, 0x9C42, 0xFFFF, 0x955F,
+    0x8FB1, 0x9C46, 0x9C45, 0x9C41, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C47, 0x9C48, 0xFFFF, 0xFFFF, 0x9C49, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9C4C, 0x9C4A, 0xFFFF, 0x9C4B, 0x9C4D, 0xFFFF, 0x8984, 0x92EC, 0x9C4E, 0xEAAE, 0x8C9A, 0x89F4, 0x9455, 0xF2AA, 0x9C4F, 0x93F9,
+  },
+  { /* U+5Fxx */
+    0xEAAF, 0x95D9, 0xEAB0, 0x9C50, 0x984D, 0xFFFF, 0xFFFF, 0xEAB1, 0xF2AB, 0x9C51, 0x95BE, 0x9C54, 0x989F, 0x98AF, 0xF2AC, 0x8EAE,
+    0x93F3, 0x9C55, 0xFFFF, 0x8B7C, 0x92A2, 0x88F8, 0x9C56, 0x95A4, 0x8D4F, 0xFFFF, 0xFFFF, 0x926F, 0xF2AD, 0xEAB2, 0xF2AF, 0x92ED,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xEAB3, 0xFFFF, 0x96ED, 0x8CB7, 0x8CCA, 0xFFFF, 0x9C57, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C58, 0xFFFF, 0x9C5E,
+    0xFFFF, 0x8EE3, 0xFFFF, 0xFFFF, 0xEAB4, 0x92A3, 0xEAB5, 0x8BAD, 0x9C59, 0xFFFF, 0xFFFF, 0xFFFF, 0x954A, 0xEAB6, 0x9265, 0xFFFF,
+    0xEAB7, 0x9C5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAB8, 0xFFFF, 0xF2B0, 0x9C5B, 0xFFFF, 0x8BAE, 0xFFFF, 0x9C5C, 0xFFFF, 0x9C5D, 0xFFFF,
+    0xFFFF, 0x9C5F, 0xFFFF, 0x9396, 0xEAB9, 0xFFFF, 0x9C60, 0x9C61, 0xEABA, 0x9C62, 0xFFFF, 0xFFFF, 0x9C53, 0x9C52, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9C63, 0x8C60, 0xF2B1, 0xEABB, 0xFFFF, 0x9546, 0xEABC, 0xFFFF, 0x8DCA, 0x9556, 0x92A4, 0x956A, 0x9C64, 0xFFFF, 0xFFFF,
+    0x8FB2, 0x8965, 0xF2B2, 0x9C65, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C66, 0xFFFF, 0x96F0, 0xFFFF, 0xFFFF, 0x94DE, 0xEABD, 0xF2B3, 0x9C69,
+    0x899D, 0x90AA, 0x9C68, 0x9C67, 0x8C61, 0x91D2, 0xFFFF, 0x9C6D, 0x9C6B, 0xEABE, 0x9C6A, 0x97A5, 0x8CE3, 0xFFFF, 0xFFFF, 0xF2B4,
+    0x8F99, 0x9C6C, 0x936B, 0x8F5D, 0xFFFF, 0xFFFF, 0xFFFF, 0x93BE, 0x9C70, 0x9C6F, 0xFFFF, 0xFFFF, 0xEABF, 0xFFFF, 0x9C6E, 0xFFFF,
+    0x9C71, 0x8CE4, 0xF2B5, 0xFFFF, 0xF2B6, 0xFFFF, 0xFFFF, 0xEAC0, 0x9C72, 0x959C, 0x8F7A, 0xFFFF, 0xFFFF, 0x9C73, 0x94F7, 0xEAC1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x93BF, 0x92A5, 0xEAC2, 0xFFFF, 0xEAC3, 0xF2B7, 0x934F, 0xFFFF, 0xFFFF, 0x9C74, 0x8B4A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9053, 0xF2B8, 0x954B, 0xFFFF, 0xF2BA, 0xFFFF, 0xEAC4, 0xFFFF, 0xF2BB, 0x8AF5, 0x9445, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF2BC, 0xF2BD, 0xF2BE, 0xFFFF, 0x9C75, 0x8E75, 0x9659, 0x965A, 0xFFFF, 0xFFFF, 0x899E, 0x9C7A, 0xEAC5, 0xFFFF,
+    0x9289, 0xEAC6, 0xF2BF, 0xFFFF, 0x9C77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAC7, 0xFFFF, 0x89F5, 0xFFFF, 0xFFFF, 0xF2C0, 0xF2C1,
+    0x9CAB, 0x9C79, 0xFFFF, 0xF2C2, 0xFFFF, 0x944F, 0xFFFF, 0xFFFF, 0x9C78, 0xFFFF, 0xFFFF, 0x9C76, 0xF2C3, 0x8D9A, 0xFFFF, 0x9C7C,
+  },
+  { /* U+60xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAC8, 0x9C83, 0x9C89,
+    0x9C81, 0xFFFF, 0x937B, 0xFFFF, 0xEAC9, 0x9C86, 0x957C, 0xF2C5, 0xEACA, 0x9C80, 0xFFFF, 0x9C85, 0x97E5, 0x8E76, 0xFFFF, 0xFFFF,
+    0x91D3, 0x9C7D, 0xF2C6, 0xFFFF, 0xF2C7, 0x8B7D, 0x9C88, 0x90AB, 0x8985, 0x9C82, 0x89F6, 0x9C87, 0xFFFF, 0xFFFF, 0xFFFF, 0x8BAF,
+    0xFFFF, 0x9C84, 0xFFFF, 0xEACB, 0xFFFF, 0xEACC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C8A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9C8C, 0x9C96, 0x9C94, 0xFFFF, 0xFFFF, 0x9C91, 0xEACD, 0xFFFF, 0xFFFF, 0x9C90, 0x97F6, 0xF2C9, 0x9C92, 0xFFFF, 0xFFFF,
+    0x8BB0, 0xFFFF, 0x8D50, 0xFFFF, 0xFFFF, 0x8F9A, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C99, 0x9C8B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C8F,
+    0x9C7E, 0xFFFF, 0x89F8, 0x9C93, 0x9C95, 0x9270, 0xFFFF, 0xFFFF, 0x8DA6, 0x89B6, 0x9C8D, 0x9C98, 0x9C97, 0x8BB1, 0xFFFF, 0x91A7,
+    0x8A86, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C62, 0xFFFF, 0x9C8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2CA,
+    0xFFFF, 0x9C9A, 0xFFFF, 0x9C9D, 0x9C9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EBB, 0xF2CB, 0x9CA5, 0x92EE, 0x9C9B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9CA3, 0xFFFF, 0x89F7, 0xF2CC, 0x9CA1, 0x9CA2, 0xFFFF, 0xFFFF, 0x9C9E, 0x9CA0, 0xFFFF, 0xEACF, 0xEAD0, 0x8CE5,
+    0x9749, 0xFFFF, 0xFFFF, 0x8AB3, 0xFFFF, 0xFFFF, 0x8978, 0x9CA4, 0xF2CD, 0x9459, 0x88AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF2CF, 0xF2D0, 0x94DF, 0x9C7B, 0x9CAA, 0x9CAE, 0x96E3, 0xFFFF, 0x9CA7, 0xFFFF, 0xFFFF, 0xFFFF, 0x9389, 0x9CAC, 0xF2D1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FEE, 0x9CAD, 0x93D5, 0xF2D2, 0xFFFF, 0xFFFF, 0xEAD1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9866, 0xFFFF, 0x9CA9, 0xEAD2, 0xEAD3, 0xFFFF, 0xFFFF, 0x9CAF, 0xF2D3, 0x8D9B, 0xF2D4, 0x90C9, 0xEAD4, 0xFFFF, 0x88D2,
+    0x9CA8, 0x9CA6, 0xFFFF, 0x9179, 0xFFFF, 0xFFFF, 0xFFFF, 0x9C9C, 0x8E53, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2D5, 0xFFFF,
+    0x91C4, 0x9CBB, 0xF2D6, 0x917A, 0x9CB6, 0xF2D7, 0x9CB3, 0x9CB4, 0xEAD5, 0x8EE4, 0x9CB7, 0x9CBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+61xx */
+    0x9CB5, 0x8F44, 0xFFFF, 0x9CB8, 0xFFFF, 0xFFFF, 0x9CB2, 0xFFFF, 0x96FA, 0x96F9, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CBC, 0x9CBD, 0x88D3,
+    0xF2D8, 0xFFFF, 0xF2D9, 0xF2DA, 0xFFFF, 0x9CB1, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2DB, 0x8BF0, 0x88A4, 0xEAD6, 0xFFFF, 0xF2DC, 0x8AB4,
+    0xFFFF, 0x9CB9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CC1, 0x9CC0, 0xFFFF, 0xFFFF, 0xEAD7, 0x9CC5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEAD8, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CC6, 0xFFFF, 0xFFFF, 0xEAD9, 0xFFFF, 0xFFFF, 0xF2DD, 0xFFFF, 0x9CC4, 0x9CC7, 0x9CBF, 0x9CC3,
+    0xFFFF, 0xF2DF, 0x9CC8, 0xFFFF, 0x9CC9, 0xFFFF, 0xF2E0, 0x9CBE, 0x8E9C, 0xFFFF, 0x9CC2, 0x91D4, 0x8D51, 0x9CB0, 0x9054, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9CD6, 0xFFFF, 0x95E7, 0xFFFF, 0xFFFF, 0x9CCC, 0x9CCD, 0x9CCE, 0xFFFF, 0xFFFF, 0x9CD5, 0xFFFF, 0x9CD4,
+    0xF2E1, 0xFFFF, 0x969D, 0x8AB5, 0xFFFF, 0x9CD2, 0xFFFF, 0x8C64, 0x8A53, 0xFFFF, 0xFFFF, 0x9CCF, 0xFFFF, 0xFFFF, 0x97B6, 0x9CD1,
+    0x88D4, 0x9CD3, 0xFFFF, 0x9CCA, 0x9CD0, 0x9CD7, 0x8C63, 0x9CCB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2E2, 0xFFFF, 0x977C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x974A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CDA, 0xFFFF, 0xFFFF, 0x9CDE, 0xFFFF, 0xFFFF, 0xEADB, 0x919E, 0xFFFF,
+    0x97F7, 0x9CDF, 0xF2E4, 0xF2E5, 0x9CDC, 0xFFFF, 0x9CD9, 0xF2E6, 0xF2E7, 0x9CD8, 0x9CDD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x95AE, 0xF2E8, 0xFFFF, 0x93B2, 0xF2E9, 0x8C65, 0xFFFF, 0x9CE0, 0x9CDB, 0xF2EA, 0x9CE1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8C9B, 0xFFFF, 0xFFFF, 0xFFFF, 0x89AF, 0xFFFF, 0xFFFF, 0xEADE, 0x9CE9, 0xFFFF, 0xEADD, 0xFFFF, 0x8AB6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9CE7, 0xFFFF, 0xFFFF, 0x9CE8, 0x8DA7, 0x9CE6, 0x9CE4, 0x9CE3, 0x9CEA, 0x9CE2, 0x9CEC, 0xFFFF, 0xFFFF,
+    0x89F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2EC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2ED, 0xFFFF, 0xF2EE,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9CEE, 0xFFFF, 0xFFFF, 0x9CED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x92A6, 0xFFFF, 0x9CF1, 0xF2EF, 0x9CEF, 0x9CE5, 0x8C9C, 0xFFFF, 0x9CF0, 0xFFFF, 0x9CF4, 0x9CF3, 0x9CF5, 0x9CF2,
+  },
+  { /* U+62xx */
+    0x9CF6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9CF7, 0x9CF8, 0x95E8, 0xFFFF, 0x9CFA, 0x9CF9, 0x8F5E, 0xFFFF,
+    0x90AC, 0x89E4, 0x89FA, 0xFFFF, 0x9CFB, 0xF2F1, 0x88BD, 0xFFFF, 0xFFFF, 0xFFFF, 0x90CA, 0x9CFC, 0xFFFF, 0xE6C1, 0x9D40, 0x8C81,
+    0xFFFF, 0x9D41, 0xEAE0, 0xF2F2, 0xFFFF, 0xFFFF, 0x90ED, 0xFFFF, 0xFFFF, 0xF2F3, 0x9D42, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D43, 0x8B59,
+    0x9D44, 0xFFFF, 0x9D45, 0x9D46, 0x91D5, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CCB, 0xFFFF, 0xFFFF, 0x96DF, 0xFFFF, 0xFFFF, 0xEAE1, 0x965B,
+    0x8F8A, 0x9D47, 0xFFFF, 0xEAE2, 0xFFFF, 0xFFFF, 0xF2F4, 0x90EE, 0xE7BB, 0x94E0, 0xFFFF, 0x8EE8, 0xF2F5, 0x8DCB, 0x9D48, 0xFFFF,
+    0xFFFF, 0xF2F6, 0xF2F7, 0x91C5, 0xFFFF, 0x95A5, 0xEAE3, 0xFFFF, 0x91EF, 0xFFFF, 0xEAE4, 0x9D4B, 0xFFFF, 0xFFFF, 0x9D49, 0xFFFF,
+    0x9D4C, 0xF2F8, 0xFFFF, 0x9D4A, 0xF2F9, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2FB, 0x95AF, 0xEAE5,
+    0xFFFF, 0x88B5, 0xFFFF, 0xF2FC, 0xFFFF, 0xFFFF, 0x957D, 0xFFFF, 0xFFFF, 0x94E1, 0xFFFF, 0xF2FA, 0x9D4E, 0xFFFF, 0x9D51, 0x8FB3,
+    0x8B5A, 0xFFFF, 0x9D4F, 0x9D56, 0x8FB4, 0xEAE6, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D50, 0x9463, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x977D, 0x9D52, 0x9D53, 0x9D57, 0x938A, 0x9D54, 0x8D52, 0x90DC, 0xF340, 0xFFFF, 0x9D65, 0x94B2, 0xFFFF, 0x91F0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF341, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94E2, 0x9DAB, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x95F8, 0xFFFF, 0xFFFF, 0xFFFF, 0x92EF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9695, 0xFFFF, 0x9D5A, 0x899F, 0x928A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9D63, 0xFFFF, 0xEAE7, 0x9253, 0x9D5D, 0x9D64, 0x9D5F, 0x9D66, 0x9D62, 0xFFFF, 0x9D61, 0x948F, 0xFFFF, 0x9D5B,
+    0x89FB, 0x9D59, 0x8B91, 0x91F1, 0x9D55, 0xF342, 0xEAE8, 0x9D58, 0x8D53, 0x90D9, 0xFFFF, 0x8FB5, 0x9D60, 0x9471, 0xFFFF, 0xFFFF,
+    0x8B92, 0x8A67, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A87, 0x9040, 0x9D68, 0x9D6D,
+    0xFFFF, 0x9D69, 0xFFFF, 0x8C9D, 0xFFFF, 0x9D6E, 0x8E41, 0x8D89, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAE9, 0xF344, 0x8F45, 0x9D5C,
+  },
+  { /* U+63xx */
+    0xFFFF, 0x8E9D, 0x9D6B, 0xF345, 0xFFFF, 0xFFFF, 0xFFFF, 0x8E77, 0x9D6C, 0x88C2, 0xEAEA, 0xFFFF, 0x9D67, 0xF346, 0xFFFF, 0xFFFF,
+    0xF347, 0x92A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAEB, 0x8B93, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8BB2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D6A, 0x88A5, 0xFFFF, 0xFFFF, 0x8DC1, 0xFFFF, 0xFFFF, 0xFFFF, 0x9055,
+    0xFFFF, 0xFFFF, 0xF34A, 0xFFFF, 0xFFFF, 0xF34B, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAEC, 0x92F0, 0xF34C, 0xF34D, 0x94D2, 0x9D70, 0x917D,
+    0xFFFF, 0xF34E, 0xFFFF, 0xEAED, 0xF34F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x91A8, 0xFFFF, 0xFFFF, 0x8E4A, 0x9D71, 0xF350, 0x9D73,
+    0x9D6F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x95DF, 0xFFFF, 0x92BB, 0xFFFF, 0xF352, 0xFFFF, 0xFFFF, 0x917B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAEE, 0xFFFF, 0x95F9, 0x8ECC, 0x9D80, 0xFFFF, 0x9D7E, 0xF355, 0xFFFF, 0x9098, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8C9E, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D78, 0x8FB7, 0xFFFF, 0xFFFF, 0x93E6, 0x9450, 0xEAEF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9D76, 0xFFFF, 0xFFFF, 0x917C, 0xF356, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EF6, 0x9D7B, 0xFFFF, 0xFFFF, 0x8FB6, 0xFFFF, 0x9D75, 0x9D7A,
+    0xFFFF, 0xFFFF, 0x9472, 0xFFFF, 0xF359, 0xFFFF, 0x9D74, 0xFFFF, 0x8C40, 0xF357, 0xFFFF, 0x8A7C, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D7C,
+    0x97A9, 0x8DCC, 0x9254, 0x9D79, 0xFFFF, 0x90DA, 0xFFFF, 0x8D54, 0x9084, 0x8986, 0x915B, 0x9D77, 0x8B64, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8C66, 0xFFFF, 0x92CD, 0x9D7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x917E, 0xFFFF, 0xF35A, 0x9D81, 0xFFFF,
+    0x9D83, 0xFFFF, 0xFFFF, 0x91B5, 0x9D89, 0xFFFF, 0x9D84, 0xFFFF, 0xFFFF, 0x9D86, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9560,
+    0x92F1, 0xFFFF, 0x9D87, 0xFFFF, 0xF35C, 0xF35D, 0x974B, 0xFFFF, 0xFFFF, 0xFFFF, 0x9767, 0x8AB7, 0xF35E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF35F, 0x88AC, 0xFFFF, 0x9D85, 0xFFFF, 0xEAF0, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D82, 0xFFFF, 0xF360, 0xF361, 0xEAF1, 0x8AF6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF362, 0xFFFF, 0x8987, 0xEAF2, 0x9D88, 0xF35B, 0xFFFF, 0xFFFF, 0x9768, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+64xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D8C, 0xFFFF, 0xFFFF, 0xF363, 0xFFFF, 0xFFFF, 0xFFFF, 0x91B9, 0xFFFF, 0x9D93,
+    0xEAF3, 0xFFFF, 0xFFFF, 0x9D8D, 0xEAF4, 0xFFFF, 0x9D8A, 0x9D91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D72, 0xFFFF, 0xF364, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEAF5, 0xFFFF, 0xFFFF, 0xF365, 0x9D8E, 0xFFFF, 0x9D92, 0xF366, 0xFFFF, 0xFFFF, 0x94C0, 0x938B, 0xFFFF, 0xF367,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D8B, 0xFFFF, 0x9D8F, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C67, 0xFFFF, 0xFFFF, 0xFFFF, 0x8DEF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x90DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D97, 0xFFFF,
+    0xFFFF, 0xEAF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9345, 0xFFFF, 0xF368, 0xF369, 0xFFFF, 0xF36A, 0xFFFF, 0xFFFF,
+    0xEAF8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D94, 0xFFFF, 0x9680, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAF9, 0xFFFF, 0x9D95,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF36B, 0xFFFF, 0xFFFF, 0x9D96, 0xFFFF, 0x96CC, 0xEAF6, 0x90A0, 0xFFFF, 0xFFFF, 0xF36C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8C82, 0xFFFF, 0xFFFF, 0xFFFF, 0xF36D, 0x9D9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF36E, 0x8E54, 0x9D9A, 0xFFFF, 0x9D99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9451, 0xFFFF, 0xFFFF, 0xF36F, 0x93B3, 0xF370,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9350, 0x9D9B, 0xFFFF, 0xFFFF, 0xFFFF, 0x9D9C, 0xFFFF, 0x958F, 0xFFFF, 0x9464, 0x8E42, 0xFFFF,
+    0x90EF, 0xFFFF, 0x966F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A68, 0xFFFF, 0x9DA3, 0x9D9E, 0xFFFF, 0xEAFB, 0xEAFC,
+    0xFFFF, 0x9769, 0x9DA5, 0xFFFF, 0xEB40, 0x9DA1, 0xFFFF, 0x9DA2, 0xFFFF, 0xFFFF, 0xEB41, 0xF371, 0xF372, 0x9180, 0xEAFA, 0xFFFF,
+    0xEB42, 0xFFFF, 0x9DA0, 0xFFFF, 0x9D5E, 0xF373, 0xFFFF, 0xF374, 0x9DA4, 0xFFFF, 0x9D9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9DA9, 0x9DAA, 0x9346, 0x9DAC, 0xF376, 0xF377, 0x8E43, 0x9DA7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B5B, 0xFFFF, 0xFFFF, 0x9DAD,
+    0xFFFF, 0x9DA6, 0x9DB1, 0xFFFF, 0x9DB0, 0xFFFF, 0x9DAF, 0xEB43, 0xFFFF, 0xFFFF, 0x9DB2, 0xEB44, 0xFFFF, 0x9DB4, 0x8FEF, 0xF378,
+  },
+  { /* U+65xx */
+    0x9DB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xF379, 0x9DB7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF37B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF37C, 0xFFFF, 0xF37D, 0xFFFF, 0x9DB5, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DB6, 0x9D90, 0xF380, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEB45, 0x9DB9, 0x9DB8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB46, 0x9D98, 0x9DBA, 0x9DAE, 0xFFFF, 0xFFFF, 0x8E78,
+    0xFFFF, 0xFFFF, 0xF381, 0xFFFF, 0x9DBB, 0x9DBC, 0x9DBE, 0x9DBD, 0x9DBF, 0x89FC, 0xFFFF, 0x8D55, 0xFFFF, 0xFFFF, 0x95FA, 0x90AD,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF382, 0x8CCC, 0xFFFF, 0xFFFF, 0x9DC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DC4, 0xFFFF, 0x9571,
+    0xFFFF, 0x8B7E, 0xFFFF, 0xFFFF, 0xF383, 0x9DC3, 0x9DC2, 0x9473, 0x9DC5, 0x8BB3, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DC7, 0x9DC6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8AB8, 0x8E55, 0xFFFF, 0xFFFF, 0x93D6, 0xEB48, 0xFFFF, 0xFFFF, 0xFFFF, 0xF384, 0x8C68, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9094, 0xFFFF, 0x9DC8, 0xFFFF, 0x90AE, 0x9347, 0xFFFF, 0x957E, 0x9DC9, 0xFFFF, 0xF385, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF386, 0x9DCA, 0x9DCB, 0xF387, 0xF388, 0xFFFF, 0x95B6, 0x9B7C, 0x90C4, 0xF389, 0xFFFF, 0x956B, 0xFFFF, 0x8DD6, 0xFFFF,
+    0x94E3, 0x94C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x936C, 0xFFFF, 0x97BF, 0xFFFF, 0x9DCD, 0x8ECE, 0xEB49, 0xFFFF, 0x9DCE,
+    0xFFFF, 0x88B4, 0xFFFF, 0xFFFF, 0x8BD2, 0x90CB, 0xFFFF, 0x9580, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DCF, 0x8E61, 0x9266, 0xFFFF, 0x8E7A,
+    0x9056, 0xFFFF, 0xF38A, 0xFFFF, 0xFFFF, 0xF38B, 0xFFFF, 0x9DD0, 0xF38C, 0x95FB, 0xFFFF, 0xFFFF, 0x8997, 0x8E7B, 0xFFFF, 0xF38D,
+    0xFFFF, 0x9DD3, 0xF38E, 0x9DD1, 0x9DD4, 0x97B7, 0x9DD2, 0xFFFF, 0xFFFF, 0xF38F, 0xFFFF, 0x90F9, 0x9DD5, 0xFFFF, 0xFFFF, 0x91B0,
+    0xFFFF, 0xFFFF, 0x9DD6, 0xFFFF, 0xF390, 0xFFFF, 0xFFFF, 0x8AF8, 0xFFFF, 0x9DD8, 0xFFFF, 0x9DD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9DD9, 0x9DDA, 0x8AF9, 0xFFFF, 0xFFFF, 0x93FA, 0x9255, 0x8B8C, 0x8E7C, 0x9181, 0xFFFF, 0xFFFF, 0x8F7B, 0x88AE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9DDB, 0xF392, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF393, 0x89A0, 0x9DDF, 0xF394, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+66xx */
+    0xEB4B, 0xFFFF, 0x8D56, 0x9DDE, 0xF395, 0xFFFF, 0x8DA9, 0x8FB8, 0xF396, 0xEB4C, 0x9DDD, 0xFFFF, 0x8FB9, 0xFFFF, 0x96BE, 0x8DA8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x88D5, 0x90CC, 0xEB4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DE4, 0xFFFF, 0xEB4E, 0x90AF,
+    0x8966, 0xF397, 0xEB50, 0xFFFF, 0xEB51, 0x8F74, 0xFFFF, 0x9686, 0x8DF0, 0xFFFF, 0xF398, 0xEB52, 0xFFFF, 0x8FBA, 0xFFFF, 0x90A5,
+    0xEB53, 0xEB54, 0xFFFF, 0xEB55, 0x9DE3, 0x9DE1, 0x9DE2, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB4F, 0xFFFF, 0x928B, 0xFFFF, 0xFFFF, 0x9E45,
+    0xFFFF, 0x9DE8, 0x8E9E, 0x8D57, 0x9DE6, 0xF399, 0xFFFF, 0xFFFF, 0xEB57, 0x9DE7, 0xFFFF, 0x9057, 0xEB58, 0xFFFF, 0xF39B, 0x9DE5,
+    0xFFFF, 0xF39A, 0x8E4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF39E, 0xFFFF, 0xEB5A, 0xEB5B, 0xF39F, 0xFFFF, 0x9DEA, 0x9DE9, 0x9DEE,
+    0xFFFF, 0xEB5C, 0x9DEF, 0xF3A0, 0x9DEB, 0xEB5D, 0x8A41, 0x9DEC, 0x9DED, 0x94D3, 0xF3A3, 0xF3A4, 0xF3A5, 0xF3A6, 0x9581, 0x8C69,
+    0x9DF0, 0xFFFF, 0xFFFF, 0xEB5E, 0x90B0, 0xFFFF, 0x8FBB, 0xEB5F, 0xEB60, 0xFFFF, 0x9271, 0xF3A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF3A8, 0x8BC5, 0xFFFF, 0x9DF1, 0x9DF5, 0xFFFF, 0xFFFF, 0x89C9, 0x9DF2, 0x9DF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB61, 0x9DF3, 0xFFFF,
+    0xF3A9, 0x8F8B, 0xF3AA, 0xFFFF, 0xFFFF, 0xFFFF, 0x9267, 0x88C3, 0x9DF6, 0xF3AB, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DF7, 0xFFFF, 0xFFFF,
+    0xEB63, 0xFFFF, 0x92A8, 0xFFFF, 0xFFFF, 0xFFFF, 0x97EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8E62, 0xFFFF, 0xF3AD, 0x95E9, 0xFFFF,
+    0xFFFF, 0xF3AE, 0xEB64, 0xFFFF, 0x965C, 0xF3AF, 0xFFFF, 0xFFFF, 0x9E41, 0x9DF9, 0xFFFF, 0xEB65, 0x9DFC, 0xFFFF, 0x9DFB, 0xF3B1,
+    0xFFFF, 0x9DF8, 0xFFFF, 0xFFFF, 0x9E40, 0xFFFF, 0xEB66, 0x93DC, 0xEB67, 0x9DFA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E42, 0xFFFF, 0xFFFF, 0x8F8C, 0x9E43, 0xEB69, 0x976A, 0x9498, 0xFFFF, 0xFFFF,
+    0x9E44, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E46, 0xFFFF, 0xEB6A, 0x9E47, 0xFFFF, 0xFFFF, 0xF3B3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9E48, 0xFFFF, 0x8BC8, 0x8967, 0x8D58, 0x9E49, 0xFFFF, 0x9E4A, 0x8F91, 0x9182, 0xEB6B, 0xEB56, 0x99D6, 0x915D, 0x915C, 0x91D6,
+  },
+  { /* U+67xx */
+    0x8DC5, 0xF3B5, 0xFFFF, 0x98F0, 0xFFFF, 0xF3B6, 0xFFFF, 0xFFFF, 0x8C8E, 0x974C, 0xFFFF, 0x95FC, 0xFFFF, 0x959E, 0xFFFF, 0x9E4B,
+    0xFFFF, 0xFFFF, 0xF3B7, 0xEB6C, 0x8DF1, 0x92BD, 0x9E4C, 0x984E, 0xFFFF, 0xF3B9, 0xFFFF, 0x965D, 0xFFFF, 0x92A9, 0x9E4D, 0x8AFA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E4E, 0x9E4F, 0x96D8, 0xFFFF, 0x96A2, 0x9696, 0x967B, 0x8E44, 0x9E51, 0xFFFF,
+    0xFFFF, 0x8EE9, 0xFFFF, 0xEB6E, 0x9670, 0xFFFF, 0x9E53, 0x9E56, 0x9E55, 0xFFFF, 0x8AF7, 0xFFFF, 0xFFFF, 0x8B80, 0xFFFF, 0x9E52,
+    0xFFFF, 0x9E54, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E57, 0xEB70, 0xEB71, 0x9099, 0xFFFF, 0xFFFF, 0xF3BC, 0xF3BD, 0x979B, 0x88C7,
+    0x8DDE, 0x91BA, 0xFFFF, 0x8EDB, 0xF3BE, 0xFFFF, 0x8FF1, 0xFFFF, 0xFFFF, 0x9E5A, 0xFFFF, 0xFFFF, 0x936D, 0xF3BF, 0x9E58, 0x91A9,
+    0x9E59, 0x8FF0, 0x96DB, 0x9E5B, 0x9E5C, 0x9788, 0xEB6F, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E61, 0xFFFF, 0xFFFF, 0x8D59, 0xFFFF, 0x9474,
+    0x9E5E, 0x938C, 0x9DDC, 0x9DE0, 0xF3C3, 0x8B6E, 0xF3C4, 0x9466, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB72, 0x9E60, 0xFFFF, 0x8FBC, 0x94C2,
+    0xFFFF, 0xEB73, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E66, 0xFFFF, 0x94F8, 0xFFFF, 0x9E5D, 0xFFFF, 0x9E63, 0x9E62, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x90CD, 0xFFFF, 0xF3C6, 0xEB74, 0xFFFF, 0x968D, 0xFFFF, 0x97D1, 0xEB75, 0xFFFF, 0x9687, 0xEB76, 0x89CA, 0x8E7D, 0xFFFF, 0xFFFF,
+    0x9867, 0x9E65, 0x9095, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E64, 0xFFFF, 0xFFFF, 0x9E5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CCD,
+    0xF3CA, 0xFFFF, 0xF3CB, 0x9E6B, 0x9E69, 0xFFFF, 0x89CB, 0x9E67, 0x9E6D, 0x9E73, 0xFFFF, 0xEB77, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEB79, 0x91C6, 0xFFFF, 0xF3CC, 0x95BF, 0xFFFF, 0x9E75, 0xFFFF, 0xF3CD, 0xFFFF, 0x9541, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E74, 0x9490,
+    0x965E, 0x8AB9, 0xF3CE, 0x90F5, 0x8F5F, 0xFFFF, 0xFFFF, 0xEB7A, 0x92D1, 0xF3CF, 0x974D, 0xF3D0, 0xFFFF, 0x9E70, 0x9E6F, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9E71, 0xFFFF, 0x9E6E, 0xFFFF, 0xFFFF, 0x9E76, 0xFFFF, 0x9E6C, 0xFFFF, 0xFFFF, 0x9E6A, 0xFFFF, 0x9E72, 0x9E68,
+    0xF3D1, 0x928C, 0xFFFF, 0x96F6, 0x8EC4, 0x8DF2, 0xFFFF, 0xF3D2, 0xFFFF, 0xEB78, 0xFFFF, 0x8DB8, 0xEB7B, 0xFFFF, 0x968F, 0x8A60,
+  },
+  { /* U+68xx */
+    0xFFFF, 0xEB7C, 0x92CC, 0x93C8, 0x8968, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF3C9, 0xFFFF, 0xFFFF, 0x90F0, 0xFFFF, 0xFFFF, 0x90B2, 0x8C49, 0xF3D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB7E, 0x9E78, 0xF3D7,
+    0xFFFF, 0x8D5A, 0x8A9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E7A, 0x8A94, 0x9E81, 0xEB80, 0xF3D8, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEB81, 0x9E7D, 0xF3DA, 0x90F1, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A6A, 0x8DAA, 0xFFFF, 0xF3DB, 0x8A69, 0x8DCD, 0xF3DC, 0xFFFF,
+    0x9E7B, 0x8C85, 0x8C6A, 0x938D, 0xF3DD, 0xF3DE, 0x9E79, 0xFFFF, 0x88C4, 0xF3DF, 0xFFFF, 0xFFFF, 0xF3E0, 0x9E7C, 0x9E7E, 0xFFFF,
+    0x8BCB, 0x8C4B, 0xEB7D, 0x8ABA, 0x8B6A, 0xF3E1, 0xFFFF, 0xF3E2, 0xFFFF, 0x9E82, 0xFFFF, 0xEB82, 0x8DF7, 0x9691, 0xFFFF, 0x8E56,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9E83, 0xFFFF, 0xFFFF, 0xFFFF, 0x954F, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3E4, 0xFFFF, 0xFFFF, 0xF3E5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEB83, 0xFFFF, 0x9E8F, 0xEB84, 0x89B1, 0x9E84, 0xFFFF, 0xFFFF, 0xF3E6, 0xFFFF, 0xF3E7, 0xFFFF, 0x9E95, 0x9E85,
+    0xFFFF, 0x97C0, 0xF3E8, 0x9E8C, 0xFFFF, 0x947E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E94, 0xFFFF, 0x9E87,
+    0xF3E9, 0xFFFF, 0xFFFF, 0x88B2, 0x9E89, 0xFFFF, 0xF3EA, 0x8D5B, 0xF3EC, 0xF3ED, 0xF3EE, 0x9E8B, 0xF3EF, 0x9E8A, 0xFFFF, 0x9E86,
+    0x9E91, 0xFFFF, 0x8FBD, 0xEB86, 0xFFFF, 0xEB87, 0x9AEB, 0x8CE6, 0x979C, 0xFFFF, 0xF3F0, 0xF3F1, 0xFFFF, 0x9E88, 0xFFFF, 0x92F2,
+    0x8A42, 0x8DAB, 0xEB88, 0x9E80, 0xF3F2, 0x9E90, 0x8A81, 0xFFFF, 0xFFFF, 0x9E8E, 0x9E92, 0xF3F3, 0x938E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF3F8, 0x8AFC, 0xF3F9, 0x9EB0, 0xFFFF, 0xEB89, 0x96C7, 0x9E97, 0x8AFB, 0xF3FA, 0x9E9E, 0xFFFF, 0xF3FB,
+    0xEB8A, 0xFFFF, 0x965F, 0xFFFF, 0x9E9F, 0x9EA1, 0xF3FC, 0x9EA5, 0x9E99, 0xF440, 0x9249, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x938F,
+    0x9EA9, 0x9E9C, 0xFFFF, 0x9EA6, 0xF441, 0xF442, 0xFFFF, 0x9EA0, 0xEB8B, 0xFFFF, 0xFFFF, 0xFFFF, 0xF443, 0xEB8C, 0x9058, 0x9EAA,
+    0xEB8D, 0xEB8E, 0x90B1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF444, 0xFFFF, 0x9EA8, 0x8ABB, 0xF3F4, 0xEB8F, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+69xx */
+    0x986F, 0x9E96, 0xFFFF, 0xF445, 0x9EA4, 0x88D6, 0xFFFF, 0xF446, 0x9E98, 0xFFFF, 0xEB90, 0x96B8, 0x9E9D, 0x9041, 0x92C5, 0x9E93,
+    0xFFFF, 0xFFFF, 0x9EA3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x909A, 0x9EAD, 0x8A91, 0x8C9F, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9EAF, 0x9E9A, 0x9EAE, 0xFFFF, 0x9EA7, 0x9E9B, 0xFFFF, 0x9EAB, 0xFFFF, 0x9EAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9EBD, 0xFFFF, 0xFFFF, 0xFFFF, 0x93CC, 0xEB93, 0x9EA2, 0xFFFF, 0xFFFF, 0x9EB9, 0xFFFF, 0xF44A, 0xFFFF, 0x9EBB, 0xFFFF, 0x92D6,
+    0xFFFF, 0xFFFF, 0xEB94, 0xFFFF, 0xFFFF, 0xFFFF, 0xF44C, 0xFFFF, 0xFFFF, 0xEB91, 0x976B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9596, 0x9EB6, 0x91C8, 0xFFFF, 0xEB95, 0xFFFF, 0x9EBC, 0x915E, 0xFFFF, 0x9EB3, 0x9EC0, 0x9EBF, 0xFFFF,
+    0x93ED, 0x9EBE, 0x93E8, 0xEB96, 0xEB97, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB98, 0xF44D, 0x9EC2, 0x9EB5, 0xF44E, 0x8BC6, 0x9EB8, 0x8F7C,
+    0xFFFF, 0xFFFF, 0xF44F, 0x9480, 0x9EBA, 0x8BC9, 0xFFFF, 0x9EB2, 0x9EB4, 0x9EB1, 0xF450, 0xFFFF, 0x984F, 0x8A79, 0x9EB7, 0xF451,
+    0xEB99, 0x9EC1, 0x8A54, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8DE5, 0xFFFF, 0xFFFF, 0xFFFF, 0x897C, 0xFFFF,
+    0xFFFF, 0x9ED2, 0xF452, 0xFFFF, 0x9850, 0x9ED5, 0xF454, 0xFFFF, 0xF455, 0xFFFF, 0xFFFF, 0x9059, 0x9ED4, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9ED3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB9B, 0xF456, 0x9ED0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB9C, 0x9EC4, 0xFFFF,
+    0xF457, 0x9EE1, 0x9EC3, 0xFFFF, 0x9ED6, 0xFFFF, 0xFFFF, 0xF458, 0xFFFF, 0xFFFF, 0xF459, 0x9ECE, 0xF45A, 0xFFFF, 0x9EC9, 0x9EC6,
+    0xF45B, 0x9EC7, 0xFFFF, 0x9ECF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAA0, 0xFFFF, 0xFFFF, 0x9ECC, 0x8D5C, 0x92C6, 0x9184, 0x9ECA, 0xEB9D,
+    0x9EC5, 0xF45C, 0xFFFF, 0x9EC8, 0xFFFF, 0xFFFF, 0xF45D, 0xFFFF, 0x976C, 0x968A, 0xFFFF, 0xFFFF, 0xFFFF, 0x9ECD, 0x9ED7, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEBA0, 0xF463, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EDF, 0x9ED8, 0xEBA1, 0xEBA2, 0x9EE5, 0xFFFF, 0x9EE3, 0xF464, 0xF465,
+    0xFFFF, 0xFFFF, 0x9EDE, 0xF466, 0xF468, 0xEBA3, 0xEBA4, 0xFFFF, 0xFFFF, 0x9EDD, 0xFFFF, 0x92CE, 0xFFFF, 0x9185, 0xF469, 0x9EDB,
+  },
+  { /* U+6Axx */
+    0xFFFF, 0xFFFF, 0x9ED9, 0xFFFF, 0xFFFF, 0x9EE0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EE6, 0x94F3, 0x9EEC, 0xFFFF, 0xFFFF, 0xEBA5,
+    0xFFFF, 0xF46A, 0x9EE7, 0x9EEA, 0x9EE4, 0xEBA6, 0xFFFF, 0x9294, 0xFFFF, 0x9557, 0xF46B, 0x9EDA, 0xFFFF, 0xF46C, 0x9EE2, 0x8FBE,
+    0xFFFF, 0x96CD, 0x9EF6, 0x9EE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CA0, 0x89A1, 0x8A7E, 0xFFFF, 0xFFFF, 0x9ED1, 0xFFFF,
+    0xF460, 0xFFFF, 0xF46E, 0xF46F, 0xF470, 0x8FBF, 0x9EEE, 0xFFFF, 0x9EF5, 0x8EF7, 0x8A92, 0xEBA8, 0xFFFF, 0x924D, 0xEBA9, 0xF471,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EEB, 0xEBAA, 0xF472, 0x9EF0, 0x9EF4, 0xF473, 0xFFFF, 0x8BB4, 0xFFFF, 0xFFFF, 0xF475, 0xFFFF,
+    0xEBAB, 0xFFFF, 0xF476, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBAC, 0xFFFF, 0x8B6B, 0x9EF2, 0xFFFF, 0xEBAD, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B40,
+    0xFFFF, 0x93C9, 0x9EF1, 0xFFFF, 0xF477, 0xFFFF, 0x9EF3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9EED, 0xEBAF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EEF, 0xFFFF, 0xF474, 0xFFFF, 0xFFFF, 0xFFFF, 0xF479, 0x8A80,
+    0x9268, 0xFFFF, 0xFFFF, 0xF47A, 0x9EFA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBB1, 0xFFFF, 0xF47B, 0xFFFF, 0x9EF8, 0x8CE7, 0xFFFF,
+    0x9EF7, 0xF47D, 0xFFFF, 0xFFFF, 0xEBB2, 0xFFFF, 0xFFFF, 0x9F40, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9E77, 0xEBB3, 0xEBB4, 0xF47E,
+    0x9EF9, 0xF480, 0x9EFB, 0x9EFC, 0xFFFF, 0xEBB5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F4B, 0xF482, 0x9F47, 0xFFFF, 0x9E8D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9F46, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F45, 0xFFFF, 0xFFFF, 0x9F42, 0xFFFF, 0xF483, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9EE8, 0x9F44, 0x9F43, 0xFFFF, 0xFFFF, 0xF484, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF486, 0x9F49, 0xFFFF, 0x9845, 0xF485, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F4C, 0x8BF9, 0xF487, 0xF488, 0x9F48, 0x9F4A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBB6, 0xFFFF, 0xFFFF, 0xEBB7, 0x94A5, 0xFFFF, 0x9F4D, 0xFFFF, 0xF48B, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF48C, 0xF48D, 0xF48E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F51, 0x9F4E, 0xFFFF, 0xF48F, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9793, 0x9F4F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9EDC, 0xF491, 0xFFFF, 0xFFFF, 0xFFFF, 0xF492,
+    0xF493, 0xF494, 0x9F52, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F53, 0xF496, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBBA, 0xFFFF, 0x8954, 0xEBBB, 0x9F55,
+    0x8C87, 0x8E9F, 0xFFFF, 0x8BD3, 0xFFFF, 0xFFFF, 0xFFFF, 0x89A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBBC, 0xFFFF, 0xFFFF, 0xF498,
+    0xFFFF, 0xFFFF, 0x977E, 0xFFFF, 0xFFFF, 0xEBBD, 0xFFFF, 0x9F57, 0x9F56, 0x9F59, 0x8B5C, 0xFFFF, 0xFFFF, 0x8BD4, 0x8ABC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9F5C, 0xFFFF, 0xFFFF, 0xEBBE, 0x9F5B, 0xFFFF, 0x9F5D, 0xF499, 0xFFFF, 0x89CC, 0xFFFF, 0x9256, 0xFFFF,
+    0x9F5E, 0xFFFF, 0xFFFF, 0x8ABD, 0x9F60, 0xFFFF, 0xEBBF, 0xFFFF, 0xF49A, 0x9F5F, 0xFFFF, 0x9F61, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F62,
+    0xEBC0, 0x9F63, 0x8E7E, 0x90B3, 0x8D9F, 0xEBC1, 0x9590, 0xEBC2, 0xFFFF, 0x95E0, 0x9863, 0xFFFF, 0xF49B, 0xFFFF, 0xFFFF, 0x8E95,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8DCE, 0x97F0, 0xF49C, 0xFFFF, 0xEBC3, 0x9F64, 0x9F65, 0xF49D, 0x8E80, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F66,
+    0x9F67, 0xF49E, 0xEBC4, 0x9F69, 0x9F68, 0xFFFF, 0x9677, 0xFFFF, 0xFFFF, 0x8F7D, 0x8EEA, 0x8E63, 0xFFFF, 0x9F6A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F6C, 0x9042, 0xFFFF, 0x9F6B, 0xFFFF, 0xFFFF, 0xF49F, 0xFFFF, 0xFFFF, 0x9F6D, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F6E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBC5, 0x9F6F, 0x9F70, 0xFFFF, 0xEBC6, 0xF4A0, 0x9F71,
+    0xFFFF, 0x9F73, 0x9F72, 0x9F74, 0x89A3, 0x9269, 0xFFFF, 0x9F75, 0xFFFF, 0xFFFF, 0x8E45, 0x8A6B, 0x9F76, 0xF4A2, 0xF4A3, 0x9361,
+    0x9ACA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B42, 0x9F77, 0xF4A4, 0xF4A5, 0xF4A6, 0xFFFF, 0x9F78, 0xFFFF, 0x95EA, 0x9688, 0xEBC8,
+    0xFFFF, 0xFFFF, 0x93C5, 0x9F79, 0x94E4, 0xFFFF, 0xEBC9, 0xEBCA, 0x94F9, 0xFFFF, 0xF4A7, 0x96D1, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F7A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4A8, 0xF4A9, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F7C, 0x9F7B, 0xFFFF, 0xF4AA, 0x9F7E,
+    0xFFFF, 0xF4AB, 0xFFFF, 0x9F7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBCB,
+  },
+  { /* U+6Cxx */
+    0xFFFF, 0xFFFF, 0xF4AC, 0xFFFF, 0xFFFF, 0xEBCC, 0xFFFF, 0xFFFF, 0x9F81, 0xFFFF, 0xF4AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4AE, 0x8E81,
+    0xEBCD, 0x96AF, 0xFFFF, 0x9F82, 0x9F83, 0xFFFF, 0xFFFF, 0x8B43, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F84, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9F86, 0x9F85, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xEBCE, 0x9085, 0xF4AF, 0xF4B0, 0x9558, 0x8969, 0xFFFF, 0xF4B1, 0xFFFF, 0xFFFF, 0xFFFF, 0x94C3, 0xF4B3,
+    0x92F3, 0x8F60, 0x8B81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4B4, 0x94C4, 0xFFFF,
+    0x8EAC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9F88, 0xFFFF, 0x8ABE, 0xFFFF, 0xEBCF, 0x8998, 0xF4B5, 0xEBD0, 0x93F0, 0x9F87, 0x8D5D,
+    0x9272, 0xFFFF, 0x9F89, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4CD, 0x9F91, 0xFFFF, 0x9F8A, 0xFFFF, 0xFFFF, 0xF4B6, 0xFFFF, 0xFFFF,
+    0x91BF, 0xFFFF, 0x8B82, 0x9F92, 0xEBD2, 0xFFFF, 0xEBD3, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C88, 0xFFFF, 0xFFFF, 0x8B44, 0x9F90, 0xFFFF,
+    0xFFFF, 0x9F8E, 0x9F8B, 0x9780, 0xF4B7, 0xEBD4, 0xEBD5, 0xFFFF, 0x92BE, 0xF4B8, 0xFFFF, 0xFFFF, 0x93D7, 0x9F8C, 0xFFFF, 0xFFFF,
+    0x9F94, 0xFFFF, 0x9F93, 0x8C42, 0xF4BA, 0xF4BB, 0x89AB, 0xF4BC, 0xEBD6, 0x8DB9, 0x9F8D, 0x9F8F, 0xEBD7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9676, 0x91F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBD1, 0x9697, 0xFFFF, 0xF4BD, 0x9F9C, 0xFFFF,
+    0xFFFF, 0x9F9D, 0xFFFF, 0x89CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x95A6, 0x96FB, 0x9F9F, 0x8EA1, 0x8FC0, 0x9F98, 0x9F9E, 0x8988,
+    0xFFFF, 0x8BB5, 0xF4BE, 0xFFFF, 0x9F95, 0x9F9A, 0xEBD9, 0xFFFF, 0xFFFF, 0x90F2, 0x9491, 0xFFFF, 0x94E5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF4BF, 0xFFFF, 0xFFFF, 0x9F97, 0xEBDA, 0x9640, 0xF4C1, 0x9F99, 0xFFFF, 0x9FA2, 0xF4C2, 0x9FA0, 0xF4C3, 0x9F9B, 0xFFFF, 0xFFFF,
+    0xEBDB, 0x9641, 0x9467, 0x8B83, 0xFFFF, 0x9344, 0xFFFF, 0xFFFF, 0x928D, 0xF4C4, 0x9FA3, 0xEBDC, 0xF4C5, 0xF4C6, 0xEBDD, 0x9FA1,
+    0x91D7, 0x9F96, 0xFFFF, 0x896A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBD8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Dxx */
+    0xF4C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4C9, 0x976D, 0x9FAE, 0xFFFF, 0xEBE0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9FAD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x90F4, 0xFFFF, 0x9FAA, 0xFFFF, 0x978C, 0xFFFF, 0xFFFF, 0x93B4, 0x9FA4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4CA, 0x92C3, 0xF4CB, 0xF4CC, 0xFFFF, 0x896B, 0x8D5E, 0x9FA7, 0xFFFF, 0xFFFF, 0xEBE1, 0xF4CE,
+    0xFFFF, 0xEBE2, 0x8F46, 0x9FAC, 0xF4E3, 0x9FAB, 0x9FA6, 0xFFFF, 0x9FA9, 0xEBE3, 0xFFFF, 0x8A88, 0xF4CF, 0x9FA8, 0x9468, 0xEBE4,
+    0xFFFF, 0x97AC, 0xFFFF, 0xFFFF, 0x8FF2, 0x90F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBE5, 0x9FB4, 0x9FB2, 0xF4D0, 0x956C, 0xFFFF, 0xF4D1, 0xFFFF,
+    0xF4D2, 0xFFFF, 0xFFFF, 0x9FAF, 0x9FB1, 0xEBE6, 0x8959, 0xFFFF, 0xFFFF, 0x8D5F, 0x9851, 0xFFFF, 0x8A5C, 0xFFFF, 0x9582, 0xFFFF,
+    0xF4D3, 0xFFFF, 0xFFFF, 0xFFFF, 0x9781, 0xFFFF, 0xFFFF, 0x8A43, 0x905A, 0x9FB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF4D4, 0xF4D5, 0xEBE8, 0xFFFF, 0xFFFF, 0x9FB8, 0xFFFF, 0xEBE9, 0x8FC1, 0xEBEA, 0xF4D6, 0xFFFF, 0x974F, 0xF4D7, 0x9FB5, 0xFFFF,
+    0xFFFF, 0xF4D8, 0xFFFF, 0x9FB0, 0xEBEB, 0x9FB6, 0xFFFF, 0xFFFF, 0xF4D9, 0x97DC, 0xFFFF, 0x9393, 0x93C0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBEC, 0xF4DF, 0xEBED, 0xFFFF, 0xF4E0, 0x8A55,
+    0xFFFF, 0xFFFF, 0x8974, 0xFFFF, 0xF4E1, 0x9FBC, 0xFFFF, 0xFFFF, 0x9FBF, 0xFFFF, 0xFFFF, 0xFFFF, 0x97C1, 0xFFFF, 0xFFFF, 0xEBEE,
+    0x9784, 0xFFFF, 0xF4E2, 0xFFFF, 0xEBEF, 0x9FC6, 0x9FC0, 0x9FBD, 0xF4E4, 0xFFFF, 0xFFFF, 0x97D2, 0x9FC3, 0xFFFF, 0xF4E5, 0xF4E6,
+    0xF4E7, 0x8F69, 0x9FC5, 0xFFFF, 0xFFFF, 0x9FCA, 0xEBF0, 0xFFFF, 0x9391, 0x9FC8, 0xEBF1, 0xEBF2, 0xFFFF, 0xEBF3, 0x9FC2, 0xF4E8,
+    0xFFFF, 0x9257, 0xFFFF, 0xFFFF, 0x9FC9, 0xFFFF, 0x9FBE, 0xFFFF, 0x9FC4, 0xF4E9, 0x9FCB, 0x88FA, 0x9FC1, 0xFFFF, 0x9FCC, 0xFFFF,
+    0xFFFF, 0x905B, 0xFFFF, 0x8F7E, 0xFFFF, 0x95A3, 0xF4EA, 0x8DAC, 0xFFFF, 0x9FB9, 0x9FC7, 0x9359, 0xEBF4, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+6Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x90B4, 0xFFFF, 0x8A89, 0x8DCF, 0x8FC2, 0x9FBB, 0x8F61, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8C6B, 0xFFFF, 0x9FBA, 0xFFFF, 0xF4DB, 0xFFFF, 0x9FD0, 0x8F8D, 0x8CB8, 0xFFFF, 0x9FDF, 0xF4EC, 0x9FD9,
+    0x8B94, 0x936E, 0xF4ED, 0x9FD4, 0x9FDD, 0x88AD, 0x8951, 0xF4EE, 0xFFFF, 0x89B7, 0xFFFF, 0x9FD6, 0x91AA, 0x9FCD, 0x9FCF, 0x8D60,
+    0xFFFF, 0xFFFF, 0xF4F0, 0xFFFF, 0xEBF6, 0xFFFF, 0xF4EB, 0xFFFF, 0x9FE0, 0xFFFF, 0x9FDB, 0xFFFF, 0xF4F1, 0xFFFF, 0x9FD3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9FDA, 0xEBF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4F2, 0xF4F3, 0x96A9, 0xF4F4, 0xF4F5, 0x9FD8, 0x9FDC, 0xF4F6,
+    0xFFFF, 0xF4F7, 0xFFFF, 0xF4F8, 0xF4F9, 0xFFFF, 0x8CCE, 0xF4FA, 0x8FC3, 0xFFFF, 0xFFFF, 0x9258, 0xEBF8, 0xFFFF, 0xEBF9, 0x9FD2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF4FB, 0xFFFF, 0xFFFF, 0xFFFF, 0x974E, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FD5, 0xFFFF, 0xFFFF, 0x9FCE, 0x9392,
+    0xFFFF, 0xFFFF, 0x9FD1, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9870, 0x8EBC,
+    0x969E, 0xFFFF, 0x9FE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94AC, 0xFFFF, 0xFFFF, 0x9FED,
+    0x8CB9, 0xFFFF, 0xFFFF, 0xF540, 0xFFFF, 0xFFFF, 0x8F80, 0xFFFF, 0x9FE3, 0xFFFF, 0xFFFF, 0xFFFF, 0x97AD, 0x8D61, 0xFFFF, 0x9FF0,
+    0xFFFF, 0xFFFF, 0x88EC, 0xFFFF, 0xFFFF, 0x9FEE, 0xFFFF, 0xF541, 0xFFFF, 0xFFFF, 0x9FE2, 0xEBFA, 0xFFFF, 0xFFFF, 0xFFFF, 0x9FE8,
+    0xFFFF, 0xEBFB, 0x9FEA, 0xFFFF, 0xF542, 0xFFFF, 0x976E, 0x9FE5, 0xFFFF, 0xFFFF, 0x934D, 0xFFFF, 0xFFFF, 0x9FE7, 0xFFFF, 0xF543,
+    0xFFFF, 0xEBFC, 0x9FEF, 0xF544, 0x9FE9, 0x96C5, 0xFFFF, 0xEC40, 0xFFFF, 0x9FE4, 0xF545, 0x8EA0, 0x9FFC, 0xFFFF, 0xEC41, 0xFFFF,
+    0xFFFF, 0x8A8A, 0xFFFF, 0x9FE6, 0x9FEB, 0x9FEC, 0xFFFF, 0xFFFF, 0xFFFF, 0xF546, 0xFFFF, 0xFFFF, 0xFFFF, 0x91EA, 0x91D8, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF548, 0x9FF4, 0xFFFF, 0xFFFF, 0x9FFA,
+    0xFFFF, 0xFFFF, 0x9FF8, 0xFFFF, 0x9348, 0xFFFF, 0xFFFF, 0xE042, 0x9FF5, 0xF549, 0xFFFF, 0xF54A, 0xFFFF, 0xFFFF, 0x9FF6, 0x9FDE,
+  },
+  { /* U+6Fxx */
+    0xFFFF, 0x8B99, 0x9559, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EBD, 0xFFFF, 0xFFFF, 0x8D97, 0xF54B, 0xFFFF, 0xF54C, 0xFFFF, 0xFFFF, 0x9852,
+    0xEC42, 0x9FF2, 0xFFFF, 0xE041, 0x8989, 0x9186, 0xFFFF, 0xFFFF, 0xF54D, 0xFFFF, 0xEC43, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9499, 0xFFFF, 0x8ABF, 0x97F8, 0xFFFF, 0xF54E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC45, 0x969F, 0x92D0, 0xFFFF, 0xFFFF, 0xEC46,
+    0xFFFF, 0x9FF9, 0x9FFB, 0xEC47, 0xFFFF, 0xF547, 0xF54F, 0xFFFF, 0x9151, 0xFFFF, 0xFFFF, 0xFFFF, 0xF550, 0xFFFF, 0xE040, 0x9FF7,
+    0xFFFF, 0x9FF1, 0xFFFF, 0xFFFF, 0xFFFF, 0x8AC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEC48, 0xF552, 0xFFFF, 0x8C89, 0xFFFF, 0xFFFF, 0xF553, 0xE04E, 0xEC49, 0xF554, 0xE049, 0x90F6, 0xFFFF, 0xEC4A, 0x8A83,
+    0xF555, 0xEC4B, 0xEC4C, 0xFFFF, 0x8F81, 0xFFFF, 0xE052, 0xFFFF, 0xF556, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE04B, 0x92AA, 0xE048,
+    0x92D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xE06B, 0xFFFF, 0xFFFF, 0xFFFF, 0xE045, 0xFFFF, 0xE044, 0xFFFF, 0xE04D, 0xF558, 0xEC4D, 0xFFFF,
+    0xE047, 0xE046, 0xE04C, 0xFFFF, 0x909F, 0xFFFF, 0xE043, 0xFFFF, 0xEC4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC4F, 0xEC50, 0xE04F, 0xFFFF,
+    0xF559, 0xE050, 0xFFFF, 0xFFFF, 0xEC51, 0xFFFF, 0xF55A, 0x8AC0, 0xF557, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF55C,
+    0xEC52, 0xE055, 0xFFFF, 0xE054, 0xE056, 0xF55D, 0xFFFF, 0xEC53, 0xFFFF, 0xFFFF, 0xE059, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF55E,
+    0xFFFF, 0x9362, 0xFFFF, 0xE053, 0xFFFF, 0xF560, 0xEC54, 0xFFFF, 0xFFFF, 0xE057, 0xFFFF, 0xFFFF, 0xEC55, 0xFFFF, 0xF55B, 0xFFFF,
+    0x8C83, 0x91F7, 0xE051, 0x945A, 0xFFFF, 0xFFFF, 0xE058, 0xEC56, 0xF561, 0xF562, 0xEC57, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE05D, 0xE05B, 0xFFFF, 0xFFFF, 0xE05E, 0xFFFF, 0xF563, 0xE061, 0xFFFF, 0xFFFF, 0xF564, 0xE05A,
+    0x8D8A, 0x9447, 0xFFFF, 0xFFFF, 0x9FB7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF565, 0xFFFF, 0x9794, 0xE05C, 0xFFFF, 0xE060, 0x91F3,
+    0xEC59, 0xE05F, 0xFFFF, 0xE04A, 0xFFFF, 0xEC5A, 0xE889, 0xFFFF, 0xFFFF, 0xEC58, 0xE064, 0xFFFF, 0xF567, 0xFFFF, 0xE068, 0xFFFF,
+  },
+  { /* U+70xx */
+    0xF568, 0xE066, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC5B, 0xEC5C, 0xF569, 0xFFFF, 0xE062, 0xF56A, 0xE063, 0xFFFF, 0xFFFF, 0xFFFF, 0xE067,
+    0xFFFF, 0xE065, 0xFFFF, 0xFFFF, 0xFFFF, 0x956D, 0xFFFF, 0xFFFF, 0xE06D, 0xFFFF, 0xE06A, 0xE069, 0xFFFF, 0xE06C, 0x93D2, 0xE06E,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF56B, 0xFFFF, 0xFFFF, 0x9295, 0x91EB, 0xEC5D, 0xFFFF, 0xFFFF, 0xFFFF, 0x90A3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE06F, 0xFFFF, 0xE071, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF56D, 0xF56E, 0xFFFF, 0xF56F, 0xFFFF, 0xE070, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF570, 0xFFFF, 0xFFFF, 0xFFFF, 0xF571, 0xFFFF, 0xFFFF, 0xEC5E, 0xF572, 0x9FF3, 0xFFFF, 0xEC61, 0xFFFF,
+    0xFFFF, 0xE072, 0xFFFF, 0xFFFF, 0xF574, 0xFFFF, 0xFFFF, 0xFFFF, 0x93E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC5F, 0xEC60, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE073, 0xEC62, 0xF575, 0xFFFF, 0xFFFF, 0xFFFF, 0xF576, 0xFFFF, 0x89CE, 0xF577, 0xFFFF, 0xF578, 0x9394,
+    0x8A44, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC63, 0xF579, 0xFFFF, 0x8B84, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EDC, 0x8DD0, 0xF57A, 0xFFFF,
+    0xFFFF, 0xF57B, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC64, 0xF57C, 0xFFFF, 0xFFFF, 0x9846, 0x9086, 0xFFFF, 0xFFFF, 0xFFFF, 0x898A, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE075, 0xFFFF, 0xFFFF, 0xF57D, 0xFFFF, 0xF57E, 0xFFFF, 0xE074, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF582,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC66, 0xE078, 0x9259, 0xE07B, 0xE076,
+    0xFFFF, 0xF583, 0xFFFF, 0xE07A, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC67, 0xE079, 0x935F, 0x88D7, 0xF580, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x97F3, 0xFFFF, 0xF586, 0xE07D, 0xFFFF, 0xFFFF, 0xFFFF, 0x8947,
+    0xFFFF, 0xF587, 0xFFFF, 0xF588, 0xEC68, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC69, 0xE080, 0xFFFF, 0xFFFF, 0xF589, 0xE07E, 0xFFFF, 0xE07C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC6A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF585, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE077, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9642, 0xFFFF, 0xFFFF, 0xFFFF, 0xE082, 0xFFFF, 0xFFFF,
+  },
+  { /* U+71xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF58A, 0xF58B, 0xFFFF, 0xF58C, 0xF58D, 0xF58E, 0xE081, 0xFFFF, 0xFFFF, 0xF58F, 0xFFFF, 0xFFFF, 0xEC6B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x898B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE084, 0x95B0, 0xFFFF, 0xE083, 0xFFFF, 0xEC6D, 0xFFFF,
+    0xEC6E, 0x96B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FC5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC6C, 0xFFFF, 0xFFFF, 0xEC6F, 0xF591,
+    0xEC70, 0xF592, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9152, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FC4, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC71, 0xEC72, 0xFFFF, 0x97F9, 0xF594, 0xFFFF, 0xE08A, 0xFFFF, 0x90F7, 0xFFFF,
+    0xF593, 0xEC73, 0xEC75, 0xF595, 0xFFFF, 0xE086, 0xE08B, 0xFFFF, 0xFFFF, 0x898C, 0xFFFF, 0xFFFF, 0xEC76, 0xFFFF, 0xF596, 0xFFFF,
+    0xEC77, 0xFFFF, 0xE089, 0xFFFF, 0x9481, 0xE085, 0xE088, 0x8FC6, 0xEC78, 0x94CF, 0xFFFF, 0xFFFF, 0xE08C, 0xFFFF, 0x8ECF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x90F8, 0xFFFF, 0xFFFF,
+    0xF599, 0xFFFF, 0xFFFF, 0xFFFF, 0xE08F, 0xEC7A, 0xFFFF, 0xEC7B, 0xE087, 0xFFFF, 0x8C46, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE08D,
+    0xFFFF, 0xFFFF, 0xEC7C, 0xFFFF, 0x976F, 0xE090, 0xF598, 0xFFFF, 0xFFFF, 0xEAA4, 0xFFFF, 0xF59A, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F6E,
+    0xF59B, 0xFFFF, 0xF59C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE091, 0xFFFF, 0xFFFF, 0xFFFF, 0xE092, 0xFFFF, 0xF59D, 0xF59E,
+    0xFFFF, 0x944D, 0xFFFF, 0xF59F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE094, 0xEC7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xE095, 0xFFFF,
+    0xFFFF, 0xEC7D, 0xFFFF, 0x9452, 0xEC80, 0xFFFF, 0xFFFF, 0xFFFF, 0x9395, 0xE097, 0xFFFF, 0xF5A1, 0xFFFF, 0xFFFF, 0xE099, 0xFFFF,
+    0x97D3, 0xFFFF, 0xE096, 0xF5A2, 0xE098, 0x898D, 0xFFFF, 0xE093, 0xFFFF, 0xF5A3, 0xFFFF, 0xFFFF, 0xF5A4, 0xFFFF, 0xFFFF, 0x9A7A,
+    0xE09A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9187, 0x8E57, 0xE09C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE09B, 0x9043, 0x99D7, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE09D, 0xFFFF, 0xFFFF, 0xFFFF, 0xE09F, 0xFFFF, 0xE08E, 0xE09E, 0xFFFF, 0xEC81, 0xE0A0,
+  },
+  { /* U+72xx */
+    0xEC82, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x949A, 0xF5A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0A1, 0xFFFF, 0xFFFF,
+    0xE0A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC83, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0A4, 0xFFFF, 0x92DC, 0xF5A8, 0xE0A6, 0xE0A5, 0xFFFF, 0xFFFF,
+    0xE0A7, 0xFFFF, 0xE0A8, 0xFFFF, 0xF5A9, 0x8EDD, 0x9583, 0xFFFF, 0xF5AA, 0xF5AB, 0x96EA, 0xE0A9, 0xE0AA, 0x9175, 0x8EA2, 0xE0AB,
+    0xE0AC, 0xFFFF, 0xF5AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0AD, 0x95D0, 0x94C5, 0xFFFF, 0xFFFF, 0xE0AE, 0x9476, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x92AB, 0xF5AE, 0xFFFF, 0xEC84, 0xEC85, 0xF5AF, 0xE0AF, 0x89E5, 0xFFFF, 0x8B8D, 0xFFFF, 0x96C4, 0xFFFF, 0x96B4,
+    0xFFFF, 0x89B2, 0x9853, 0xF5B0, 0xFFFF, 0xFFFF, 0xFFFF, 0x9671, 0xFFFF, 0x95A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5B2, 0xF5B3,
+    0xFFFF, 0xFFFF, 0x90B5, 0xFFFF, 0xE0B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5B4, 0x93C1, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CA1, 0xE0B1, 0xF5B5,
+    0x8DD2, 0xE0B3, 0xE0B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC87, 0xF5B6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE0B5, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC88, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8B5D, 0xFFFF, 0xE0B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CA2, 0xF5B8, 0xF5B9, 0x94C6,
+    0xF5BA, 0xF5BB, 0xE0BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FF3, 0xFFFF, 0xFFFF, 0xE0B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC89, 0xFFFF,
+    0xEC8A, 0xF5BC, 0x8BB6, 0xE0BB, 0xE0BD, 0xFFFF, 0xE0BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5BE, 0xFFFF, 0xE0BE, 0xFFFF,
+    0x8CCF, 0xFFFF, 0xE0BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8BE7, 0xFFFF, 0x915F, 0xFFFF, 0x8D9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE0C1, 0xE0C2, 0xE0C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EEB, 0xFFFF, 0xFFFF, 0x93C6, 0x8BB7, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF5C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0C4, 0x924B, 0xE0C3, 0xF5C2, 0xEC8B, 0x9854, 0x9482, 0xFFFF, 0xFFFF,
+  },
+  { /* U+73xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5C3, 0xFFFF, 0xFFFF, 0xE0C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF5C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0C9, 0xE0C6, 0xF5C5, 0xF5C6, 0xFFFF, 0x96D2, 0xE0C8, 0xE0CA, 0xFFFF, 0x97C2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0CE, 0xFFFF, 0xEC8D, 0xEC8E, 0xE0CD, 0x9296, 0x944C, 0xF5C9, 0xFFFF, 0x8CA3, 0xE0CC,
+    0xFFFF, 0xF5CA, 0xFFFF, 0xF5CB, 0xE0CB, 0xFFFF, 0x9750, 0x9751, 0xFFFF, 0xF5C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5CC, 0xE0CF, 0x898E,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D96, 0x8E82, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0D0, 0xE0D1,
+    0xEC90, 0xFFFF, 0xF5CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8F62, 0xFFFF, 0xFFFF, 0xEC91, 0xFFFF, 0xE0D5, 0xFFFF, 0xE0D4, 0xF5CF, 0xF5D0, 0xFFFF, 0xF5D2, 0xF5D3,
+    0xE0D6, 0xF5D4, 0x8A6C, 0xFFFF, 0xFFFF, 0xE0D8, 0xFFFF, 0xF5D5, 0xE0D7, 0xFFFF, 0xE0DA, 0xE0D9, 0xEC92, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF5D6, 0xFFFF, 0xFFFF, 0x8CBA, 0xF5D7, 0xFFFF, 0x97A6, 0xFFFF, 0x8BCA, 0xF5D8, 0x89A4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5D9, 0xEC93, 0x8BE8, 0xFFFF, 0xF5DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5DB, 0xFFFF, 0xF5DC, 0xEC94,
+    0xEC95, 0xFFFF, 0xEC96, 0xFFFF, 0xFFFF, 0xF5DD, 0xEC97, 0xFFFF, 0xF5DE, 0x8ADF, 0xFFFF, 0xEC98, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x97E6, 0xE0DC, 0xFFFF, 0xF5DF, 0xFFFF, 0xF5E0, 0xFFFF, 0xF5E1, 0xFFFF, 0xE0DE, 0xF5E2, 0xFFFF, 0xFFFF, 0xF5E3,
+    0xE0DF, 0xFFFF, 0x89CF, 0xFFFF, 0xFFFF, 0xF5E4, 0xFFFF, 0xFFFF, 0xE0DB, 0xEC99, 0x8E58, 0xF5E5, 0xFFFF, 0x92BF, 0xE0DD, 0xEC9A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEC9B, 0xFFFF, 0xFFFF, 0xEC9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0E2, 0xFFFF,
+    0x8EEC, 0xF5E6, 0xFFFF, 0xEC9D, 0xFFFF, 0xE0E0, 0xFFFF, 0xF5E7, 0xFFFF, 0xEC9E, 0x8C5D, 0xFFFF, 0xFFFF, 0x94C7, 0xE0E1, 0xFFFF,
+    0xFFFF, 0xE0FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0E7, 0xF5E8, 0xF5EA, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CBB, 0xFFFF,
+  },
+  { /* U+74xx */
+    0xFFFF, 0xF5EB, 0xFFFF, 0x8B85, 0xFFFF, 0xE0E4, 0x979D, 0xEC9F, 0xFFFF, 0x97AE, 0xECA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF5E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECA1, 0xECA2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x91F4, 0xFFFF, 0xF5EC, 0xE0E6, 0xECA4, 0xFFFF, 0xECA5, 0xFFFF, 0xECA6, 0xECA7, 0xECA8, 0xFFFF, 0xECA9, 0xECAA,
+    0xECAB, 0xF5ED, 0xE0E8, 0x97D4, 0x8BD5, 0x94FA, 0x9469, 0xFFFF, 0xFFFF, 0xF5EE, 0xE0E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0EB,
+    0xF5F0, 0xE0EE, 0xFFFF, 0xF5F1, 0xECAC, 0xFFFF, 0xECAD, 0xECAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xECAF, 0xFFFF, 0xF5F2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF5F3, 0xF5EF, 0xFFFF, 0xE0EA, 0xFFFF, 0xECB0, 0xFFFF, 0xE0ED, 0x8CE8, 0x896C, 0xE0EF, 0xF5F4, 0x9090, 0xE0EC,
+    0x97DA, 0xFFFF, 0xECB1, 0xE0F2, 0xEAA2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0F0, 0xE0F3, 0xECB2, 0xFFFF, 0xECB3, 0xFFFF, 0xE0E5,
+    0xE0F1, 0xF5F5, 0xFFFF, 0x8DBA, 0xFFFF, 0xFFFF, 0xE0F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0F5, 0xFFFF,
+    0xFFFF, 0xF5F6, 0xFFFF, 0x979E, 0xFFFF, 0xF5F7, 0xECB4, 0xECB5, 0xF5F8, 0xECB6, 0xFFFF, 0xE0F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xECBB, 0xFFFF, 0xF5FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5FB, 0xECB7, 0xF5FC, 0xFFFF, 0xFFFF, 0xECB8, 0xFFFF, 0xE0F7, 0xECB9,
+    0xF640, 0xF641, 0xE0E3, 0xECBA, 0xFFFF, 0xF642, 0xECBC, 0xE0F8, 0xECBD, 0xECBE, 0xF643, 0xF644, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8AC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF645, 0xF647, 0xF646, 0xFFFF, 0x8EA3, 0xFFFF, 0xECC0,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECC1, 0xECC2, 0xE0F9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0FA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0FB, 0xFFFF, 0xF648, 0xFFFF, 0xF649, 0xFFFF, 0xECC3, 0xFFFF, 0x895A, 0xFFFF, 0xF64A, 0xFFFF,
+    0xE140, 0xFFFF, 0x955A, 0xE141, 0xFFFF, 0xFFFF, 0x8AA2, 0xE142, 0xFFFF, 0xE143, 0xFFFF, 0xF64C, 0xFFFF, 0xFFFF, 0xE144, 0xF64B,
+    0xE146, 0xE147, 0xE145, 0xFFFF, 0xFFFF, 0xFFFF, 0x9572, 0xE149, 0xE148, 0xFFFF, 0xF64E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECC4,
+  },
+  { /* U+75xx */
+    0xFFFF, 0xECC5, 0xFFFF, 0xE14B, 0xE14A, 0xE14C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE14D, 0xE14F, 0xE14E, 0xFFFF,
+    0xFFFF, 0x8D99, 0xFFFF, 0xE151, 0xFFFF, 0xE150, 0xFFFF, 0xECC6, 0x8AC3, 0xFFFF, 0x9072, 0xFFFF, 0x935B, 0xFFFF, 0xE152, 0x90B6,
+    0xF650, 0xFFFF, 0xFFFF, 0x8E59, 0xF651, 0x8999, 0xE153, 0xFFFF, 0x9770, 0xFFFF, 0xF652, 0x95E1, 0xE154, 0xFFFF, 0xFFFF, 0xECC7,
+    0x9363, 0x9752, 0x8D62, 0x905C, 0xFFFF, 0xFFFF, 0xFFFF, 0x926A, 0x99B2, 0xFFFF, 0x92AC, 0x89E6, 0xE155, 0xF655, 0xF656, 0xFFFF,
+    0xF657, 0xFFFF, 0xFFFF, 0xFFFF, 0xE156, 0xFFFF, 0xE15B, 0xFFFF, 0xF658, 0xE159, 0xE158, 0x9DC0, 0x8A45, 0xE157, 0xF659, 0x88D8,
+    0xF65A, 0x94A8, 0xF65B, 0xFFFF, 0x94C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x97AF, 0xE15C, 0xE15A, 0x927B, 0x90A4, 0xFFFF, 0xFFFF,
+    0x94A9, 0xFFFF, 0x954C, 0xFFFF, 0xE15E, 0x97AA, 0x8C6C, 0xE15F, 0xFFFF, 0xE15D, 0x94D4, 0xE160, 0xF65C, 0xE161, 0xFFFF, 0xECC8,
+    0x88D9, 0xF65E, 0xF65D, 0x8FF4, 0xE166, 0xFFFF, 0xE163, 0x93EB, 0xE162, 0xECC9, 0xF65F, 0xFFFF, 0xFFFF, 0xF660, 0xF661, 0x8B45,
+    0xFFFF, 0xF662, 0xE169, 0xFFFF, 0xFFFF, 0xFFFF, 0xE164, 0xE165, 0xFFFF, 0xE168, 0xE167, 0x9544, 0xF664, 0xFFFF, 0x9161, 0x9160,
+    0xFFFF, 0x8B5E, 0xECCA, 0xFFFF, 0xE16A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE16B, 0xFFFF, 0xFFFF, 0xE16C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF666, 0xE16E, 0xFFFF, 0xE16D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8975, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF668, 0xE176, 0x94E6, 0xE170, 0xFFFF, 0xE172, 0xFFFF, 0xF669, 0xE174, 0x905D, 0xFFFF, 0xFFFF, 0xE175, 0xE173, 0x8EBE, 0xF66A,
+    0xF66B, 0xFFFF, 0xE16F, 0xE171, 0xFFFF, 0x9561, 0xF66C, 0x8FC7, 0xFFFF, 0xFFFF, 0xE178, 0xFFFF, 0xFFFF, 0xE177, 0xECCC, 0xF66D,
+    0xFFFF, 0xFFFF, 0xE179, 0xF66E, 0x8EA4, 0x8DAD, 0xFFFF, 0xFFFF, 0x9397, 0xE17A, 0xFFFF, 0x92C9, 0xFFFF, 0xF66F, 0xE17C, 0xF670,
+    0xF671, 0xFFFF, 0x979F, 0xE17B, 0xECCD, 0xFFFF, 0xFFFF, 0xF672, 0xFFFF, 0x9189, 0xFFFF, 0xFFFF, 0xF673, 0xFFFF, 0xF674, 0xFFFF,
+    0xE182, 0xF675, 0xE184, 0xE185, 0x9273, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF676, 0xE183, 0xFFFF, 0xE180, 0xFFFF, 0xE17D, 0xE17E,
+  },
+  { /* U+76xx */
+    0xECCE, 0xE181, 0xECCF, 0xF677, 0xFFFF, 0xFFFF, 0xFFFF, 0xF679, 0xECD0, 0xE188, 0xFFFF, 0xE186, 0xFFFF, 0xE187, 0xFFFF, 0xF67A,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF67D, 0xFFFF, 0xECD1, 0xECD2, 0xFFFF, 0xF678, 0xECD3, 0xFFFF, 0xF67E, 0xF680, 0xFFFF, 0xECD4, 0xE189,
+    0xE18B, 0xE18C, 0xE18D, 0xFFFF, 0xE18E, 0xF682, 0xEFFB, 0xE18A, 0xF683, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECD5, 0xFFFF, 0xFFFF,
+    0xE190, 0xFFFF, 0xFFFF, 0xF685, 0xE18F, 0xECD6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE191, 0xF684, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF688, 0x97C3, 0xECD7, 0xFFFF, 0xFFFF, 0xE194, 0xE192, 0xE193, 0xF68A, 0xFFFF, 0xECD8, 0x8AE0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x96FC, 0xFFFF, 0xFFFF, 0xF68B, 0x95C8, 0xFFFF, 0xE196, 0xFFFF, 0xFFFF, 0xFFFF, 0xE195, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE197, 0xE198, 0xFFFF, 0xECD9, 0xECDA, 0xFFFF, 0xE19C, 0xE199, 0xE19A, 0xE19B, 0xFFFF, 0xE19D, 0xECDB, 0xF68D, 0xECDC,
+    0xE19E, 0xECDD, 0xE19F, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1A0, 0xFFFF, 0xE1A1, 0xFFFF, 0x94AD, 0x936F, 0xE1A2, 0x9492, 0x9553, 0xFFFF,
+    0xE1A3, 0xECDE, 0xFFFF, 0xE1A4, 0x9349, 0xFFFF, 0x8A46, 0x8D63, 0xE1A5, 0xFFFF, 0xFFFF, 0xE1A6, 0xFFFF, 0xFFFF, 0xE1A7, 0xFFFF,
+    0x8E48, 0xFFFF, 0xFFFF, 0xE1A9, 0xFFFF, 0xF68E, 0xE1A8, 0xFFFF, 0xFFFF, 0xE1AA, 0xE1AB, 0xECDF, 0xF68F, 0xECE0, 0xECE1, 0xFFFF,
+    0xF691, 0xF690, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECE2, 0xF692, 0xF693, 0xFFFF, 0xECE3, 0xFFFF, 0xFFFF, 0xFFFF, 0x94E7, 0xF694,
+    0xE1AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1AD, 0xFFFF, 0xECE4, 0xEA89, 0xE1AE, 0xE1AF, 0xE1B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8E4D,
+    0xFFFF, 0xFFFF, 0xE1B1, 0x9475, 0xFFFF, 0xECE5, 0x967E, 0xFFFF, 0x896D, 0xF696, 0x8976, 0xFFFF, 0xECE6, 0xE1B2, 0xECE7, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE1B4, 0xFFFF, 0xECE8, 0xFFFF, 0xE1B3, 0x9390, 0xFFFF, 0xFFFF, 0xFFFF, 0x90B7, 0x9F58, 0xFFFF, 0xE1B5, 0x96BF,
+    0xFFFF, 0xE1B6, 0xFFFF, 0x8AC4, 0x94D5, 0xE1B7, 0xECE9, 0xE1B8, 0xF698, 0xFFFF, 0xE1B9, 0xFFFF, 0xF699, 0xFFFF, 0x96DA, 0xFFFF,
+    0xFFFF, 0xECEA, 0x96D3, 0xFFFF, 0x92BC, 0xFFFF, 0xFFFF, 0xFFFF, 0x918A, 0xFFFF, 0xFFFF, 0xE1BB, 0xECEB, 0xFFFF, 0x8F82, 0xFFFF,
+  },
+  { /* U+77xx */
+    0xFFFF, 0x8FC8, 0xFFFF, 0xFFFF, 0xE1BE, 0xFFFF, 0xFFFF, 0xE1BD, 0xE1BC, 0x94FB, 0xECEC, 0x8AC5, 0x8CA7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF69B, 0xFFFF, 0xECED, 0xF69C, 0xE1C4, 0xFFFF, 0xFFFF, 0xE1C1, 0x905E,
+    0x96B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1C0, 0xE1C2, 0xE1C3, 0xFFFF, 0xFFFF, 0xE1BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF69D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECEE, 0xF69E, 0xECEF, 0xE1C5, 0xE1C6, 0xFFFF, 0x92AD, 0xFFFF, 0x8AE1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9285, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECF0, 0xE1C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECF1, 0xECF2, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6A3, 0xFFFF, 0xE1C8, 0xE1CB, 0xECF3, 0xFFFF, 0xFFFF, 0xECF4,
+    0xF6A4, 0x9087, 0xECF5, 0x93C2, 0xFFFF, 0xE1CC, 0x9672, 0xFFFF, 0xE1C9, 0xFFFF, 0xF6A5, 0xE1CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF6A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1CF, 0xECF6, 0xFFFF, 0xF6A8, 0xF6A9, 0xE1CE, 0xE1CD,
+    0xECF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1D1, 0xFFFF, 0xFFFF, 0xE1D0, 0xFFFF,
+    0xFFFF, 0xE1D2, 0xFFFF, 0xFFFF, 0xECF8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1D4, 0xF6AD,
+    0xE1D3, 0xFFFF, 0xF6AE, 0xFFFF, 0xF6AF, 0x95CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6B0, 0xECF9, 0xFFFF, 0x8F75, 0x97C4, 0xFFFF, 0xFFFF,
+    0xE1D5, 0xFFFF, 0xFFFF, 0x93B5, 0xFFFF, 0xFFFF, 0xE1D6, 0xFFFF, 0xFFFF, 0xE1D7, 0xFFFF, 0xE1DB, 0xE1D9, 0xE1DA, 0xFFFF, 0xE1D8,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1DD, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1DE, 0xFFFF, 0xFFFF, 0xE1DF, 0x96B5, 0xE1E0, 0xFFFF, 0xF6B1, 0xF6B2,
+    0xECFA, 0xFFFF, 0x96EE, 0xE1E1, 0xF6B3, 0x926D, 0xF6B4, 0x948A, 0xFFFF, 0x8BE9, 0xF6B5, 0xFFFF, 0xF6B6, 0x925A, 0xE1E2, 0x8BB8,
+    0xF6B8, 0xFFFF, 0xFFFF, 0x90CE, 0xF6B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6BA, 0xE1E3, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+78xx */
+    0xFFFF, 0xFFFF, 0x8DBB, 0xFFFF, 0xFFFF, 0xF6BC, 0xF6BD, 0xFFFF, 0xFFFF, 0xF6BE, 0xFFFF, 0xFFFF, 0xE1E4, 0xF6BF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE1E5, 0xFFFF, 0x8CA4, 0x8DD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE1E7, 0xF6C1, 0xFFFF, 0xFFFF, 0xFFFF, 0x9375, 0x8DD4, 0x8B6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6C2, 0xECFB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9643, 0xFFFF, 0x946A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9376, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D7B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xED40, 0xFFFF, 0xE1E9, 0xFFFF, 0xF6C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED41, 0xED42,
+    0xFFFF, 0xED43, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FC9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xED44, 0xFFFF, 0xF6C5, 0x97B0, 0x8D64, 0xFFFF, 0xED45, 0x8CA5,
+    0xFFFF, 0xFFFF, 0x94A1, 0xFFFF, 0xE1EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1ED, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8CE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1EC, 0x92F4, 0xFFFF, 0xFFFF, 0xF6C7, 0xFFFF, 0xE1EF, 0x8A56, 0xE1EA, 0xFFFF,
+    0xFFFF, 0x94E8, 0xFFFF, 0x894F, 0xF6C8, 0x8DEA, 0xFFFF, 0x9871, 0xFFFF, 0xFFFF, 0xE1EE, 0xFFFF, 0xFFFF, 0xF6CA, 0xF6CB, 0xF6CC,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE1F0, 0xF6C9, 0xFFFF, 0xFFFF, 0x95C9, 0xFFFF, 0x90D7, 0xE1F2, 0xFFFF, 0xFFFF, 0xED49, 0xFFFF, 0xE1F3,
+    0xED47, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A6D, 0xF6CD, 0xE1F9, 0xFFFF, 0xE1F8, 0xFFFF,
+    0xFFFF, 0x8EA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1FA, 0xE1F5, 0xFFFF, 0xF6CE, 0xFFFF, 0xE1FB, 0xE1F6, 0xF6CF, 0xFFFF, 0xF6D0, 0xFFFF,
+    0x94D6, 0xE1F4, 0xFFFF, 0xFFFF, 0xE1F7, 0xF6D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE241, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF6D2, 0xF6D3, 0xFFFF, 0xFFFF, 0xED4A, 0xFFFF, 0xF6D4, 0xE240, 0x9681, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1FC, 0xFFFF, 0xFFFF, 0x88E9,
+    0xFFFF, 0xFFFF, 0xED4B, 0xFFFF, 0xE243, 0xFFFF, 0xFFFF, 0xED4D, 0xFFFF, 0xF6D5, 0xF6D6, 0xF6D7, 0xFFFF, 0xE242, 0xF6D8, 0xFFFF,
+  },
+  { /* U+79xx */
+    0xED4C, 0x8FCA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE244, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9162, 0xFFFF,
+    0xF6DA, 0xE246, 0xE245, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE247, 0xFFFF, 0xF6DB, 0xED4E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6DD, 0xE1E6, 0xFFFF, 0xFFFF, 0xFFFF, 0xE1E8, 0xE249, 0xE248, 0xFFFF, 0xED4F, 0xFFFF,
+    0xF6DC, 0xED50, 0xFFFF, 0xFFFF, 0xED51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EA6, 0xF6DE, 0x97E7, 0xFFFF, 0x8ED0, 0xFFFF,
+    0xE24A, 0x8C56, 0xFFFF, 0xFFFF, 0xFFFF, 0xED54, 0xED55, 0x8B5F, 0x8B46, 0x8E83, 0xF6DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9753, 0xFFFF, 0xFFFF, 0xE250, 0xFFFF, 0xE24F, 0x9163, 0xE24C, 0xF6E0, 0xFFFF, 0xE24E, 0xF6E1, 0xED59, 0x8F6A, 0x905F, 0xE24D,
+    0xE24B, 0xFFFF, 0x9449, 0xFFFF, 0xFFFF, 0x8FCB, 0xFFFF, 0xF6E3, 0x955B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8DD5, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF6E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9398, 0xFFFF, 0xED5D, 0xE251, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE252,
+    0xE268, 0x8BD6, 0xFFFF, 0xFFFF, 0x985C, 0x9154, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE253, 0xFFFF, 0xFFFF, 0x89D0, 0x92F5, 0x959F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6E5, 0xF6E6, 0xF6E7, 0xFFFF, 0xED61, 0xFFFF, 0xFFFF, 0xF6E8, 0xFFFF, 0xE254, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF6E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B9A, 0xE255, 0xFFFF, 0xF6EA, 0xE257, 0xFFFF, 0xFFFF, 0xFFFF, 0xE258, 0xFFFF,
+    0x9448, 0xED62, 0xFFFF, 0xE259, 0xF6EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xED63, 0xE25A, 0xE25B, 0xF6EC, 0xFFFF, 0x8BD7, 0x89D1, 0x93C3,
+    0x8F47, 0x8E84, 0xF6ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6EE, 0xED64, 0xE25C, 0xED65, 0x8F48, 0xF6EF, 0xF6F0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x89C8, 0x9562, 0xFFFF, 0xED67, 0xE25D, 0xF6F1, 0xFFFF, 0x94E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED68, 0x9164,
+    0xFFFF, 0xE260, 0xFFFF, 0xE261, 0x9489, 0xFFFF, 0x9060, 0xE25E, 0xFFFF, 0x9281, 0xFFFF, 0xED69, 0xE25F, 0xED6A, 0xFFFF, 0xFFFF,
+    0x8FCC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x88DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Axx */
+    0x8B48, 0xFFFF, 0xFFFF, 0xED6B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE262, 0xFFFF, 0xF6F6, 0x92F6, 0xFFFF, 0xE263, 0x90C5, 0xFFFF,
+    0xFFFF, 0xF6F7, 0xFFFF, 0xFFFF, 0x96AB, 0xF6F8, 0xFFFF, 0x9542, 0xE264, 0xE265, 0x9274, 0xF6F9, 0x97C5, 0xFFFF, 0xF6FA, 0xE267,
+    0xE266, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6FC, 0x8EED, 0xFFFF,
+    0xFFFF, 0xE269, 0x88EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE26C, 0xF740, 0xED6D, 0xFFFF, 0xE26A, 0x89D2, 0x8C6D, 0xE26B, 0x8D65,
+    0x8D92, 0xFFFF, 0x95E4, 0xE26D, 0xFFFF, 0xFFFF, 0x9673, 0xF741, 0xFFFF, 0xE26F, 0xFFFF, 0xFFFF, 0xF742, 0x90CF, 0x896E, 0x89B8,
+    0x88AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF743, 0xE26E, 0xFFFF, 0xF744, 0xFFFF, 0xFFFF, 0xF745, 0xED6E, 0xFFFF, 0xF746,
+    0xF747, 0xE270, 0xE271, 0x8FF5, 0xFFFF, 0xFFFF, 0xFFFF, 0xF748, 0xFFFF, 0xE272, 0xF749, 0x8A6E, 0xFFFF, 0xED6F, 0xFFFF, 0xFFFF,
+    0xE274, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C8A, 0xF74A, 0x8B86, 0xFFFF, 0xF74B, 0xE275, 0x8BF3, 0xFFFF, 0xFFFF, 0xE276, 0xFFFF, 0x90FA,
+    0xFFFF, 0x93CB, 0xF74C, 0x90DE, 0x8DF3, 0xED71, 0xFFFF, 0xFFFF, 0xE277, 0xFFFF, 0xF74D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF74E, 0xFFFF, 0x9282, 0x918B, 0xFFFF, 0xE279, 0xE27B, 0xE278, 0xE27A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C41,
+    0xED72, 0xFFFF, 0xFFFF, 0xF74F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE27C, 0x8C45, 0xFFFF, 0xF750, 0xFFFF, 0x8B87, 0x9771,
+    0xE27E, 0xFFFF, 0xFFFF, 0xED74, 0xFFFF, 0xFFFF, 0xE280, 0xFFFF, 0xFFFF, 0xF753, 0x894D, 0xED75, 0xF754, 0xFFFF, 0xF755, 0xE283,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8A96, 0xE282, 0xE281, 0xFFFF, 0xE285, 0xE27D, 0xFFFF, 0xE286, 0x97A7, 0xF757, 0xE287, 0xED76, 0xE288,
+    0xFFFF, 0xF758, 0x9AF2, 0xE28A, 0xFFFF, 0xE289, 0xFFFF, 0xFFFF, 0xFFFF, 0xE28B, 0xE28C, 0xFFFF, 0x97B3, 0xE28D, 0xFFFF, 0xE8ED,
+    0x8FCD, 0xE28E, 0xE28F, 0x8F76, 0xFFFF, 0x93B6, 0xE290, 0xF759, 0xF75A, 0xFFFF, 0x9247, 0xED77, 0xFFFF, 0xE291, 0xFFFF, 0x925B,
+    0xE292, 0xFFFF, 0xFFFF, 0xFFFF, 0xF75B, 0xFFFF, 0x8BA3, 0xFFFF, 0x995E, 0x927C, 0x8EB1, 0xFFFF, 0xFFFF, 0xED78, 0xFFFF, 0x8AC6,
+  },
+  { /* U+7Bxx */
+    0xFFFF, 0xFFFF, 0xE293, 0xFFFF, 0xE2A0, 0xFFFF, 0xE296, 0xF75E, 0x8B88, 0xFFFF, 0xE295, 0xE2A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xE294,
+    0xFFFF, 0x8FCE, 0xED79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE298, 0xE299, 0xFFFF, 0x934A, 0xFFFF, 0xFFFF, 0xE29A, 0xFFFF,
+    0x8A7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9079, 0x9584, 0xF761, 0xE29C, 0xFFFF, 0xF762, 0xFFFF, 0x91E6, 0xED7A, 0xF763, 0xF764,
+    0xFFFF, 0xF765, 0xFFFF, 0xE297, 0xFFFF, 0xE29B, 0xE29D, 0xFFFF, 0xFFFF, 0x8DF9, 0xFFFF, 0xED7B, 0xFFFF, 0xF760, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF769, 0xFFFF, 0xFFFF, 0xFFFF, 0xE2A4, 0x954D, 0xED7C, 0x94A4, 0x9399, 0xFFFF, 0x8BD8, 0xE2A3, 0xE2A1, 0xED7D, 0x94B3,
+    0xE29E, 0x927D, 0x939B, 0xFFFF, 0x939A, 0xF76B, 0x8DF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE2B6, 0xFFFF, 0xFFFF,
+    0xED7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xF76D, 0xE2A6, 0xF76E, 0xE2A8, 0xFFFF, 0xF76F, 0xFFFF, 0xFFFF, 0xE2AB, 0xED80, 0xE2AC, 0xED81,
+    0xE2A9, 0xE2AA, 0xED82, 0xF770, 0xE2A7, 0xE2A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xF76C, 0xE29F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF768,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x95CD, 0x89D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xE2B3, 0xFFFF, 0xE2B0, 0xFFFF, 0xE2B5,
+    0xF773, 0xF774, 0xE2B4, 0xFFFF, 0x9493, 0x96A5, 0xFFFF, 0x8E5A, 0xE2AE, 0xE2B7, 0xE2B2, 0xF775, 0xE2B1, 0xE2AD, 0xED83, 0xE2AF,
+    0xFFFF, 0x8AC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x925C, 0xFFFF, 0xFFFF, 0x90FB, 0xFFFF, 0xF777,
+    0xFFFF, 0x94A0, 0xFFFF, 0xFFFF, 0xE2BC, 0xF778, 0xFFFF, 0xFFFF, 0x94A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xF779, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x90DF, 0xE2B9, 0xFFFF, 0xFFFF, 0x94CD, 0xF77A, 0xE2BD, 0x95D1, 0xFFFF, 0x927A, 0xF77B, 0xE2B8, 0xE2BA, 0xFFFF, 0xFFFF, 0xE2BB,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77E, 0xFFFF, 0xF780, 0xED85, 0xFFFF, 0xED86, 0xF781, 0xFFFF, 0xFFFF, 0xE2BE, 0xFFFF, 0xFFFF,
+    0x8EC2, 0xFFFF, 0xFFFF, 0xFFFF, 0x93C4, 0xE2C3, 0xE2C2, 0xFFFF, 0xFFFF, 0xE2BF, 0xF782, 0xFFFF, 0xFFFF, 0x9855, 0xFFFF, 0xFFFF,
+    0xF783, 0xFFFF, 0xFFFF, 0xE2C8, 0xFFFF, 0xFFFF, 0xE2CC, 0xE2C9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Cxx */
+    0xE2C5, 0xED87, 0xFFFF, 0xF784, 0xFFFF, 0xFFFF, 0xFFFF, 0xE2C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xF785, 0xFFFF, 0xE2CB, 0xF786, 0xF787,
+    0xFFFF, 0xE2C0, 0x99D3, 0xE2C7, 0xE2C1, 0xFFFF, 0xFFFF, 0xE2CA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED89, 0xE2D0,
+    0xED8A, 0x8AC8, 0xFFFF, 0xE2CD, 0xFFFF, 0xFFFF, 0xF788, 0xE2CE, 0xFFFF, 0xFFFF, 0xE2CF, 0xE2D2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xED88, 0xFFFF, 0xED8B, 0xFFFF, 0xFFFF, 0xED8C, 0xE2D1, 0x94F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE2D3, 0x97FA, 0x95EB,
+    0xE2D8, 0xFFFF, 0xFFFF, 0xE2D5, 0xFFFF, 0xF789, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF78A, 0xFFFF, 0xE2D4, 0x90D0, 0xFFFF, 0xE2D7,
+    0xE2D9, 0xF78B, 0xFFFF, 0xFFFF, 0xE2D6, 0xFFFF, 0xE2DD, 0xF78C, 0xE2DA, 0xED8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF78D, 0xE2DB,
+    0xE2C4, 0xF78E, 0xFFFF, 0xFFFF, 0xE2DC, 0xE2DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xF78F, 0xFFFF, 0xFFFF, 0xE2DF, 0xED90, 0xF790, 0xF791,
+    0xF792, 0xFFFF, 0xFFFF, 0x95C4, 0xFFFF, 0xE2E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xED91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x96E0, 0xFFFF,
+    0xFFFF, 0x8BCC, 0x8C48, 0xE2E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x95B2, 0xFFFF, 0x9088, 0xFFFF, 0x96AE, 0xFFFF, 0xED92,
+    0xE2E2, 0xFFFF, 0x97B1, 0xFFFF, 0xED93, 0x9494, 0xFFFF, 0x9165, 0x9453, 0xFFFF, 0xFFFF, 0x8F6C, 0xFFFF, 0xFFFF, 0xFFFF, 0x88BE,
+    0xED94, 0xE2E7, 0xE2E5, 0xFFFF, 0xE2E3, 0x8A9F, 0xF796, 0x8FCF, 0xE2E8, 0xFFFF, 0xFFFF, 0xE2E6, 0xFFFF, 0xE2E4, 0xE2EC, 0xFFFF,
+    0xFFFF, 0xE2EB, 0xE2EA, 0xE2E9, 0xFFFF, 0xFFFF, 0xF798, 0xF799, 0xFFFF, 0xE2ED, 0xFFFF, 0xFFFF, 0xED95, 0xE2EE, 0x90B8, 0xF79A,
+    0xE2EF, 0xFFFF, 0xE2F1, 0xFFFF, 0xF79C, 0xE2F0, 0xFFFF, 0xFFFF, 0xF79E, 0xFFFF, 0x8CD0, 0xFFFF, 0xFFFF, 0xF79F, 0x9157, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE2F3, 0xFFFF, 0xFFFF, 0xED96, 0x939C, 0xF7A1, 0xE2F2, 0xED97, 0xFFFF, 0xFFFF, 0xE2F4, 0xED98, 0x95B3, 0x918C,
+    0x8D66, 0xFFFF, 0xE2F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7A3, 0x97C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7A4, 0xFFFF, 0xFFFF, 0xFFFF, 0xE2F7,
+    0xFFFF, 0xFFFF, 0xE2F8, 0xFFFF, 0xE2F9, 0xF7A6, 0xE2FA, 0xFFFF, 0x8E85, 0xFFFF, 0xE2FB, 0x8C6E, 0xFFFF, 0xFFFF, 0x8B8A, 0xFFFF,
+  },
+  { /* U+7Dxx */
+    0x8B49, 0xFFFF, 0xE340, 0xF7A7, 0x96F1, 0x8D67, 0xE2FC, 0xED99, 0xED9A, 0xF7A8, 0xE343, 0x96E4, 0xFFFF, 0x945B, 0xFFFF, 0xFFFF,
+    0x9552, 0xFFFF, 0xF7AA, 0xED9B, 0x8F83, 0xE342, 0xFFFF, 0x8ED1, 0x8D68, 0x8E86, 0x8B89, 0x95B4, 0xE341, 0xED9C, 0xF7AB, 0xFFFF,
+    0x9166, 0x9661, 0x8DF5, 0xED9D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8E87, 0x92DB, 0xFFFF, 0xE346, 0x97DD,
+    0x8DD7, 0xED9E, 0xE347, 0x9061, 0xFFFF, 0xE349, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FD0, 0x8DAE, 0xFFFF, 0xFFFF, 0xF7AE, 0xF7AF, 0xE348,
+    0xF7B0, 0xED9F, 0x8F49, 0x8CBC, 0x9167, 0xE344, 0xE34A, 0xF7B1, 0xEDA0, 0xFFFF, 0xFFFF, 0xE345, 0x8C6F, 0xFFFF, 0xE34D, 0xE351,
+    0x8C8B, 0xFFFF, 0xFFFF, 0xEDA1, 0xFFFF, 0xFFFF, 0xE34C, 0xFFFF, 0xFFFF, 0xF7B5, 0xF7B6, 0xE355, 0xEDA2, 0xFFFF, 0x8D69, 0xFFFF,
+    0xFFFF, 0x978D, 0x88BA, 0xE352, 0xFFFF, 0xFFFF, 0x8B8B, 0xFFFF, 0xE34F, 0xFFFF, 0xF7B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xE350, 0xFFFF,
+    0xF7B8, 0x939D, 0xE34E, 0xE34B, 0xFFFF, 0x8A47, 0x90E2, 0xFFFF, 0xFFFF, 0x8CA6, 0xEDA3, 0xFFFF, 0xFFFF, 0xE357, 0xFFFF, 0xF7BA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xEDA4, 0xFFFF, 0xFFFF, 0xF7BC, 0xFFFF, 0xF7BD, 0xE354, 0xFFFF, 0xEDA5, 0xF7BE, 0xFFFF, 0xFFFF, 0xE356,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE353, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BF, 0xFFFF, 0x8C70, 0x91B1, 0xE358, 0x918E, 0xF7C1, 0xFFFF, 0xE365,
+    0xEDA6, 0xFFFF, 0xE361, 0xE35B, 0xFFFF, 0xFFFF, 0xEDA7, 0xF7C2, 0xFFFF, 0xFFFF, 0xF7C3, 0xE35F, 0x8EF8, 0x88DB, 0xE35A, 0xE362,
+    0xE366, 0x8D6A, 0x96D4, 0xFFFF, 0x92D4, 0xE35C, 0xF7C4, 0xF7C5, 0xE364, 0xFFFF, 0xE359, 0x925D, 0xFFFF, 0xE35E, 0x88BB, 0x96C8,
+    0xF7C6, 0xFFFF, 0xEDA8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE35D, 0xFFFF, 0xFFFF, 0x8BD9, 0x94EA, 0xEDA9, 0xFFFF, 0xFFFF, 0x918D,
+    0xFFFF, 0x97CE, 0x8F8F, 0xFFFF, 0xFFFF, 0xE38E, 0xEDAA, 0xF7C7, 0xE367, 0xF7C8, 0x90FC, 0xFFFF, 0xE363, 0xE368, 0xE36A, 0xFFFF,
+    0x92F7, 0xE36D, 0xFFFF, 0xEDAB, 0xE369, 0xFFFF, 0xF7C9, 0xFFFF, 0x95D2, 0x8AC9, 0xFFFF, 0xFFFF, 0x96C9, 0xFFFF, 0xFFFF, 0x88DC,
+    0xFFFF, 0xF7CA, 0xE36C, 0xFFFF, 0x97FB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7CB, 0xFFFF, 0xE36B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Exx */
+    0xFFFF, 0x898F, 0xFFFF, 0xFFFF, 0x93EA, 0xE36E, 0xFFFF, 0xFFFF, 0xEDAE, 0xE375, 0xE36F, 0xE376, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF7CF, 0xEDAF, 0xE372, 0xFFFF, 0xFFFF, 0xEDB0, 0xFFFF, 0xF7D0, 0xFFFF, 0xFFFF, 0xFFFF, 0x949B, 0xFFFF, 0xF7D1, 0x8EC8, 0xE374,
+    0xF7D2, 0xE371, 0xE377, 0xE370, 0xFFFF, 0xFFFF, 0x8F63, 0xF7D3, 0xEDAD, 0xFFFF, 0xFFFF, 0x9644, 0xF7D4, 0xFFFF, 0x8F6B, 0xFFFF,
+    0xFFFF, 0xE373, 0xE380, 0xFFFF, 0xFFFF, 0xE37B, 0xFFFF, 0xE37E, 0xFFFF, 0xE37C, 0xE381, 0xE37A, 0xFFFF, 0xE360, 0x90D1, 0xFFFF,
+    0xFFFF, 0x94C9, 0xFFFF, 0xE37D, 0xFFFF, 0xF7D5, 0xE378, 0xEDB2, 0xFFFF, 0xFFFF, 0x9140, 0x8C71, 0xFFFF, 0x8F4A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEDB3, 0xFFFF, 0x9044, 0x9155, 0xE384, 0xFFFF, 0xFFFF, 0xE386, 0xE387, 0xFFFF, 0xFFFF, 0xE383, 0xE385, 0xFFFF,
+    0xFFFF, 0xEDB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE379, 0xE382, 0xFFFF, 0xE38A, 0xE389, 0xEFFC, 0xFFFF, 0x969A, 0xFFFF, 0xFFFF,
+    0x8C4A, 0xFFFF, 0xFFFF, 0xF7D6, 0xFFFF, 0xF7D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xE388, 0xFFFF, 0xE38C, 0xE38B, 0xE38F, 0xF7D8, 0xE391,
+    0xFFFF, 0xFFFF, 0x8E5B, 0xE38D, 0xFFFF, 0xFFFF, 0xF7D9, 0xF7DA, 0xE392, 0xE393, 0xEDB5, 0xFFFF, 0xE394, 0xEDB6, 0xE39A, 0x935A,
+    0xE396, 0xF7DC, 0xE395, 0xE397, 0xE398, 0xFFFF, 0xE399, 0xFFFF, 0xF7DD, 0xFFFF, 0xF7DE, 0xE39B, 0xE39C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+7Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8ACA, 0xFFFF, 0xE39D, 0xFFFF, 0xE39E, 0xF7E1, 0xF7E0, 0xFFFF, 0xF7E2, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF7E3, 0xF7E4, 0xE39F, 0xFFFF, 0xEDB7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3A0, 0xE3A1, 0xE3A2, 0xF7E5,
+    0xE3A3, 0xE3A4, 0xF7E8, 0xFFFF, 0xE3A6, 0xE3A5, 0xFFFF, 0xFFFF, 0xE3A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3A8,
+    0xE3A9, 0xF7EA, 0xFFFF, 0xF7EB, 0xF7EC, 0xFFFF, 0xFFFF, 0xE3AC, 0xE3AA, 0xE3AB, 0x8DDF, 0x8C72, 0xFFFF, 0xF7ED, 0x9275, 0xFFFF,
+    0x94B1, 0xFFFF, 0x8F90, 0xFFFF, 0xFFFF, 0x946C, 0xFFFF, 0x94EB, 0xE3AD, 0x9CEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7EE, 0xF7EF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE3AE, 0xE3B0, 0xFFFF, 0x9785, 0xE3AF, 0xE3B2, 0xE3B1, 0xFFFF, 0x9772, 0xFFFF, 0xE3B3, 0xFFFF, 0x94FC, 0xFFFF,
+    0xF7F1, 0xEDB9, 0xFFFF, 0xFFFF, 0xE3B4, 0xFFFF, 0xF7F4, 0xEDBA, 0xFFFF, 0xFFFF, 0xE3B7, 0xFFFF, 0xF7F5, 0xE3B6, 0xE3B5, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE3B8, 0x8C51, 0xFFFF, 0xFFFF, 0xFFFF, 0x9141, 0x8B60, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7F6, 0xE3BC, 0xE3B9,
+    0xFFFF, 0xFFFF, 0xE3BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3BD, 0xFFFF, 0xE3BE, 0xE3BB, 0xFFFF, 0xFFFF, 0xFFFF, 0x8948, 0xFFFF, 0xEDBB,
+    0xFFFF, 0x89A5, 0xFFFF, 0xF7F8, 0xFFFF, 0xE3C0, 0xE3C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3C2, 0xFFFF, 0x9782, 0xFFFF, 0xEDBC, 0xF7F9,
+    0xFFFF, 0xFFFF, 0x8F4B, 0xFFFF, 0xE3C4, 0xE3C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEDBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xEDBE,
+    0x9089, 0xE3C5, 0xFFFF, 0xF7FA, 0xFFFF, 0xF7FB, 0xE3C6, 0xFFFF, 0xFFFF, 0xE3C7, 0xFFFF, 0x8AE3, 0xEDBF, 0xFFFF, 0xEDC0, 0xF7FC,
+    0x8ACB, 0xFFFF, 0xF840, 0xE3C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3C9, 0xEDC1, 0x967C, 0x9783, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+80xx */
+    0x9773, 0x9856, 0xF841, 0x8D6C, 0xE3CC, 0x8ED2, 0xE3CB, 0xFFFF, 0xF843, 0xFFFF, 0xF842, 0xE3CD, 0x8EA7, 0xFFFF, 0xF844, 0xFFFF,
+    0x91CF, 0xF845, 0xE3CE, 0xFFFF, 0xEDC3, 0x8D6B, 0xF846, 0x96D5, 0xE3CF, 0xE3D0, 0xFFFF, 0xFFFF, 0xE3D1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE3D2, 0xFFFF, 0xFFFF, 0xF847, 0xFFFF, 0xEDC4, 0xFFFF, 0xE3D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xF848, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF849, 0xFFFF, 0xFFFF, 0x8EA8, 0xFFFF, 0xEDC5, 0x96EB, 0xEDC6, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3D5, 0xEDC7, 0x925E, 0xFFFF, 0xE3D4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF84A, 0xFFFF, 0xFFFF, 0xE3D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3D6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE3D8, 0xFFFF, 0xFFFF, 0xFFFF, 0x90B9, 0xFFFF, 0xE3D9, 0xFFFF, 0xE3DA, 0xFFFF, 0xFFFF, 0xFFFF, 0x95B7, 0xE3DB,
+    0xFFFF, 0x918F, 0xE3DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xF84B, 0xFFFF, 0xE3DD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x97FC,
+    0xE3E0, 0xF84C, 0xE3DF, 0xE3DE, 0x92AE, 0xF84D, 0xE3E1, 0x9045, 0xFFFF, 0xE3E2, 0xFFFF, 0xF84E, 0xFFFF, 0xE3E3, 0x9857, 0xE3E4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3E5, 0xE3E7, 0xE3E6, 0x94A3, 0xFFFF, 0x93F7, 0xFFFF, 0x985D, 0x94A7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE3E9, 0xFFFF, 0xFFFF, 0x8FD1, 0xFFFF, 0x9549, 0xF84F, 0xE3EA, 0xE3E8, 0xF850, 0x8ACC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8CD2, 0x8E88, 0xFFFF, 0xF851, 0x94EC, 0xFFFF, 0xF852, 0xFFFF, 0x8CA8, 0x9662, 0xFFFF, 0xE3ED, 0xE3EB, 0xFFFF, 0x8D6D,
+    0xFFFF, 0x8D6E, 0x88E7, 0xFFFF, 0x8DE6, 0xFFFF, 0xFFFF, 0xFFFF, 0xF853, 0xFFFF, 0x9478, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x88DD, 0xE3F2, 0xF855, 0x925F, 0xFFFF, 0xFFFF, 0xFFFF, 0xEDC8, 0xFFFF, 0x9477, 0xFFFF, 0x91D9, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF856, 0xE3F4, 0xEDC9, 0xF857, 0xE3F0, 0xE3F3, 0xE3EE, 0xFFFF, 0xE3F1, 0x9645, 0xFFFF,
+    0xEDCA, 0x8CD3, 0xFFFF, 0xFFFF, 0x88FB, 0xE3EF, 0xF858, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE3F6,
+    0xFFFF, 0xE3F7, 0xFFFF, 0xEDCB, 0x93B7, 0xF85B, 0xFFFF, 0xFFFF, 0x8BB9, 0xFFFF, 0xFFFF, 0xF85C, 0xE445, 0x945C, 0xFFFF, 0xFFFF,
+  },
+  { /* U+81xx */
+    0xFFFF, 0xFFFF, 0x8E89, 0xFFFF, 0xFFFF, 0x8BBA, 0x90C6, 0x9865, 0x96AC, 0xE3F5, 0x90D2, 0xFFFF, 0xFFFF, 0xF85A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF85F, 0xFFFF, 0xEDCC, 0xFFFF, 0x8B72, 0xE3F8, 0xFFFF, 0xFFFF, 0xF860, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE3FA, 0xF862, 0xFFFF, 0xFFFF, 0xF863, 0xFFFF, 0xE3F9, 0xFFFF, 0xFFFF, 0xF864, 0xFFFF, 0xFFFF, 0xE3FB,
+    0xFFFF, 0x9245, 0xFFFF, 0x945D, 0xFFFF, 0xF85E, 0xFFFF, 0xFFFF, 0xFFFF, 0x92AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF866, 0xE442, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE441, 0xFFFF, 0xFFFF, 0xFFFF, 0xEDCD, 0xE3FC, 0xFFFF, 0xFFFF, 0x9074, 0xFFFF,
+    0x9585, 0xE444, 0xFFFF, 0xE443, 0x8D6F, 0x9872, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE454,
+    0xEDCE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE448, 0xE449, 0xEDCF, 0xEDD0, 0xF868, 0xFFFF, 0x8EEE, 0xFFFF, 0xEDD1, 0xE447, 0xFFFF,
+    0x8D98, 0xE446, 0xFFFF, 0xFFFF, 0xE44A, 0xFFFF, 0xFFFF, 0xFFFF, 0x92B0, 0x95A0, 0x9142, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x91DA,
+    0xE44E, 0xF86A, 0xE44F, 0xE44B, 0xF86C, 0xF86D, 0xFFFF, 0xFFFF, 0xE44C, 0xFFFF, 0xE44D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D70,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE455, 0xFFFF, 0xE451, 0xFFFF, 0xFFFF, 0xF86F, 0xFFFF, 0x9586, 0xFFFF, 0x968C, 0x9547, 0xFFFF, 0xFFFF,
+    0xE450, 0xFFFF, 0xFFFF, 0xE453, 0xE452, 0xFFFF, 0xFFFF, 0xFFFF, 0x9663, 0xE456, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE457, 0xFFFF, 0xF870, 0x9156, 0xFFFF, 0xE458, 0xFFFF, 0xFFFF, 0xE45A, 0xFFFF, 0xE45E, 0xEDD2, 0xFFFF, 0xE45B, 0xE459, 0x945E,
+    0xE45C, 0xF871, 0xE45D, 0xF872, 0xFFFF, 0xFFFF, 0x89B0, 0xFFFF, 0xE464, 0xE45F, 0xEDD3, 0xFFFF, 0xFFFF, 0xE460, 0xFFFF, 0xEDD4,
+    0xFFFF, 0xE461, 0xFFFF, 0x919F, 0xFFFF, 0xFFFF, 0xF873, 0xEDD5, 0xE463, 0xE462, 0xE465, 0xF874, 0xFFFF, 0xFFFF, 0xFFFF, 0xE466,
+    0xE467, 0xFFFF, 0xFFFF, 0x9062, 0xF876, 0x89E7, 0xFFFF, 0xE468, 0x97D5, 0xFFFF, 0x8EA9, 0xFFFF, 0xF878, 0x8F4C, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8E8A, 0x9276, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE469, 0xE46A, 0x8950, 0xF87A, 0xE46B, 0xF87B,
+  },
+  { /* U+82xx */
+    0xFFFF, 0xE46C, 0xE46D, 0xFFFF, 0xF87D, 0xE46E, 0xFFFF, 0xE46F, 0x8BBB, 0x9DA8, 0xE470, 0xFFFF, 0x90E3, 0xE471, 0x8EC9, 0xFFFF,
+    0xE472, 0xFFFF, 0x98AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xE473, 0x95DC, 0x8ADA, 0xF880, 0xFFFF, 0x9143, 0x8F77, 0xFFFF, 0x9591, 0x8F4D,
+    0xFFFF, 0xF881, 0xF882, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE474, 0x8D71, 0xE475, 0x94CA, 0xFFFF, 0xE484, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF884, 0xE477, 0xF885, 0x91C7, 0x9495, 0x8CBD, 0xE476, 0x9144, 0xFFFF, 0xFFFF, 0xF886, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE478, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF889, 0xF887, 0x92F8, 0xFFFF, 0xF888, 0xFFFF, 0xF88B, 0xFFFF, 0xFFFF, 0xFFFF, 0xF88D,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF88F, 0xE47A, 0xE479, 0xE47C, 0xFFFF, 0xF891, 0xE47B, 0xFFFF, 0xE47D,
+    0xEDD9, 0xFFFF, 0xE480, 0xF892, 0xE47E, 0xFFFF, 0x8ACD, 0xFFFF, 0xE481, 0xFFFF, 0xE482, 0xE483, 0xFFFF, 0xFFFF, 0x8DAF, 0x97C7,
+    0xFFFF, 0xE485, 0x9046, 0xFFFF, 0xEDDA, 0xFFFF, 0x8990, 0xE486, 0xE487, 0xF896, 0xFFFF, 0xFFFF, 0xFFFF, 0xF898, 0xE488, 0xF899,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF89A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF89B, 0x88F0, 0xFFFF, 0xE489, 0xEDDC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE48A, 0xF89C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9587, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EC5, 0xFFFF, 0xE48C,
+    0xFFFF, 0xEDDD, 0xFFFF, 0xEDDE, 0xEDDF, 0x8A48, 0x88B0, 0xF89D, 0xF89E, 0xEDE0, 0xFFFF, 0xE48B, 0xE48E, 0x946D, 0xEDE1, 0x9063,
+    0xFFFF, 0x89D4, 0xF89F, 0x9646, 0xF8A0, 0xFFFF, 0xFFFF, 0xEDE2, 0x8C7C, 0x8BDA, 0xF8A1, 0xE48D, 0xF8A2, 0x89E8, 0xEDE3, 0xEDE4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8AA1, 0xEDE5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8991, 0xE492, 0x97E8, 0x91DB, 0xEDE6, 0xFFFF, 0x9563, 0xFFFF, 0xE49E, 0xFFFF, 0x89D5, 0xE49C, 0xFFFF, 0xE49A, 0xE491,
+    0xFFFF, 0xE48F, 0xF8A3, 0xE490, 0xFFFF, 0x8EE1, 0x8BEA, 0x9297, 0xF8A4, 0xFFFF, 0xFFFF, 0x93CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8970, 0xFFFF, 0xE494, 0xE493, 0xFFFF, 0xFFFF, 0xF8A5, 0xFFFF, 0xE499, 0xE495, 0xE498, 0xFFFF, 0xEDE7, 0xEDE8, 0xFFFF,
+  },
+  { /* U+83xx */
+    0xEDE9, 0xEDEA, 0x96CE, 0xE497, 0x89D6, 0x8A9D, 0xE49B, 0xF8A6, 0xF8A7, 0xE49D, 0xFFFF, 0xFFFF, 0xF8A8, 0xFFFF, 0x8C73, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4A1, 0xE4AA, 0xE4AB, 0xFFFF, 0xFFFF, 0xF8AA, 0x88A9, 0xF8AB, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEDEC, 0xE4B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x88EF, 0xFFFF, 0xFFFF, 0xE4A9, 0xFFFF, 0xEDED, 0xFFFF, 0xE4A8,
+    0xF8AC, 0xE4A3, 0xE4A2, 0xFFFF, 0xE4A0, 0xE49F, 0x9283, 0xFFFF, 0x91F9, 0xE4A5, 0xEDEE, 0xFFFF, 0xF8AD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE4A4, 0xFFFF, 0xFFFF, 0xEDEF, 0xF8AE, 0xE4A7, 0xFFFF, 0xEDF0, 0xFFFF, 0x9190, 0x8C74, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8960,
+    0xE4A6, 0xEDF1, 0x8D72, 0xFFFF, 0xF8A9, 0xEDF2, 0xFFFF, 0xF8AF, 0x9191, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEDEB, 0xF3C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE4B8, 0xFFFF, 0xE4B9, 0xFFFF, 0x89D7, 0xFFFF, 0xFFFF, 0xFFFF, 0x89AC, 0xE4B6, 0xEDF3, 0xFFFF, 0xF8B1,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4AC, 0xEDF4, 0xE4B4, 0xFFFF, 0xE4BB, 0xE4B5, 0xFFFF, 0xFFFF, 0xF8B4, 0xE4B3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEDF5, 0xE496, 0xF8B5, 0xF8B6, 0xE4B1, 0xFFFF, 0xEDF6, 0xFFFF, 0xE4AD, 0xF8B7, 0xFFFF, 0xF8B8, 0x8ACE, 0xE4AF,
+    0xE4BA, 0xFFFF, 0xE4B0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEDF7, 0xE4BC, 0xEDF8, 0xE4AE, 0x949C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x9789, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4CD, 0xFFFF, 0xEDF9,
+    0xEDFA, 0xE4C5, 0xFFFF, 0xFFFF, 0xFFFF, 0x909B, 0xFFFF, 0xEDFB, 0xFFFF, 0xF8B9, 0x8B65, 0xFFFF, 0x8BDB, 0xFFFF, 0xE4C0, 0xEDFC,
+    0xF8BA, 0xEE40, 0xFFFF, 0x89D9, 0xF8BB, 0xFFFF, 0x8FD2, 0xFFFF, 0xE4C3, 0xFFFF, 0xFFFF, 0xFFFF, 0x8DD8, 0xF8BC, 0xFFFF, 0x9370,
+    0xE4C8, 0xEE41, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8BD, 0xFFFF, 0xFFFF, 0xFFFF, 0x95EC, 0xEE42, 0xE4BF, 0xFFFF, 0xFFFF, 0xFFFF, 0x89D8,
+    0x8CD4, 0x9548, 0xE4C9, 0xFFFF, 0xE4BD, 0xFFFF, 0xFFFF, 0xE4C6, 0xFFFF, 0xF8BE, 0xFFFF, 0xE4D0, 0xFFFF, 0xE4C1, 0xFFFF, 0xFFFF,
+  },
+  { /* U+84xx */
+    0xFFFF, 0xEE43, 0xFFFF, 0xE4C2, 0x93B8, 0xFFFF, 0xEE44, 0xE4C7, 0xFFFF, 0xFFFF, 0xEE45, 0xE4C4, 0x9647, 0xE4CA, 0x88DE, 0xF8BF,
+    0xFFFF, 0xF8C0, 0xFFFF, 0xE4BE, 0xFFFF, 0xF8C1, 0xFFFF, 0xF8C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE4CC, 0xFFFF, 0xE4CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x948B, 0xE4D2, 0xFFFF, 0xE4DD, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8A9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4E0, 0xFFFF, 0xFFFF, 0xE4CE, 0xF8C4, 0xFFFF, 0xFFFF, 0xE4D3, 0x978E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4DC, 0xFFFF, 0xEE47, 0x9774, 0xF8C5, 0xFFFF, 0xFFFF, 0xFFFF, 0x97A8, 0xF8C6,
+    0xFFFF, 0xF8C7, 0xF8C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9298, 0xFFFF, 0xF8C9, 0xF8CA, 0x8A8B, 0xF8CB, 0xFFFF, 0xFFFF, 0xEE48,
+    0xFFFF, 0x9592, 0xE4E2, 0x939F, 0xFFFF, 0xF8CD, 0x88AF, 0xFFFF, 0xFFFF, 0xE4DB, 0xFFFF, 0xE4D7, 0x9192, 0xE4D1, 0xE4D9, 0xE4DE,
+    0xEE49, 0x944B, 0xFFFF, 0xEE4A, 0xFFFF, 0x88A8, 0xF8CE, 0xE4D6, 0xF8CF, 0xE4DF, 0x9598, 0xFFFF, 0xF8D0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF8D1, 0xE4DA, 0xFFFF, 0xE4D5, 0xEE4B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FD3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8F4E, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EAA, 0xFFFF, 0xFFFF, 0xF8D4, 0xFFFF, 0x96D6, 0xFFFF, 0xFFFF, 0x9566, 0xFFFF, 0xEE4C, 0xE4E5,
+    0xFFFF, 0xE4EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4D8, 0xFFFF, 0xEE4D,
+    0xFFFF, 0xFFFF, 0x8A97, 0xFFFF, 0xEE4E, 0xFFFF, 0xFFFF, 0xFFFF, 0x8FF6, 0xE4E3, 0xEE4F, 0xE4E8, 0x9193, 0xFFFF, 0xF8D6, 0xE4E4,
+    0xEE50, 0xE4EB, 0xEE51, 0xFFFF, 0x927E, 0xFFFF, 0xE4EC, 0xFFFF, 0xFFFF, 0x9775, 0xE4E1, 0x8A57, 0xFFFF, 0xE4E7, 0xF8D8, 0xF8D9,
+    0xE4EA, 0x96AA, 0xFFFF, 0xF8DA, 0xFFFF, 0xFFFF, 0xE4ED, 0xFFFF, 0xFFFF, 0xE4E6, 0xE4E9, 0xFFFF, 0xF8D3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8DC, 0xFFFF, 0xFFFF, 0xF8DD, 0xFFFF, 0x9648, 0xFFFF, 0x9840, 0xF8DE,
+    0xF8DF, 0xF8E0, 0xFFFF, 0xFFFF, 0xE4F1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8E1, 0xFFFF, 0xE4F8, 0xF8E2, 0xFFFF, 0xE4F0,
+  },
+  { /* U+85xx */
+    0x8EC1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4CF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8E3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x95CC, 0xFFFF, 0x96A0, 0xE4F7, 0xE4F6, 0xFFFF, 0xE4F2, 0xE4F3, 0xFFFF, 0x8955, 0xF8E4, 0xFFFF, 0xFFFF, 0xEE54, 0xE4F5,
+    0xFFFF, 0xE4EF, 0xFFFF, 0xEE55, 0xF8E5, 0xF8E6, 0x92D3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8E7, 0xE4F4, 0x88FC, 0xFFFF, 0xEE56,
+    0xFFFF, 0xFFFF, 0xEE53, 0xFFFF, 0xF8E8, 0x91A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x95C1, 0xF8ED, 0xFFFF,
+    0xE4F9, 0xE540, 0xFFFF, 0x94D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE4FC, 0x8FD4, 0x8EC7, 0xE542, 0xFFFF, 0xFFFF, 0x8BBC, 0xF8E9,
+    0xFFFF, 0xF8EE, 0xFFFF, 0xF8EF, 0xFFFF, 0xE543, 0xFFFF, 0x9599, 0xE4FB, 0xEE57, 0xE4D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8F0, 0xFFFF,
+    0xFFFF, 0xF8F1, 0xF8F2, 0xE4FA, 0xEE58, 0xFFFF, 0xFFFF, 0xFFFF, 0x986E, 0x93A0, 0x9593, 0xFFFF, 0xFFFF, 0xE54A, 0xFFFF, 0xF8EA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE550, 0xFFFF, 0xFFFF, 0xEE5B, 0xF8F4, 0xFFFF, 0xF8F5, 0xE551, 0xF8F6,
+    0xE544, 0xF8F7, 0xFFFF, 0xFFFF, 0x9496, 0xFFFF, 0xF8F8, 0xE54E, 0xE546, 0xFFFF, 0xE548, 0xFFFF, 0xEE5C, 0xFFFF, 0xFFFF, 0xEE5D,
+    0xE552, 0xE547, 0xFFFF, 0xF8F9, 0xE54B, 0xFFFF, 0xFFFF, 0x8992, 0xFFFF, 0x93E3, 0xFFFF, 0xE54C, 0xE54F, 0xF8FA, 0xFFFF, 0xF8FB,
+    0xFFFF, 0xFFFF, 0xEE5E, 0xFFFF, 0xE545, 0xFFFF, 0x9145, 0xFFFF, 0xE549, 0x8E46, 0x9064, 0x8C4F, 0x96F2, 0xEE5A, 0x96F7, 0x8F92,
+    0xEE5F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF942, 0xFFFF, 0xE556, 0xE554, 0xFFFF, 0xF943, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x986D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF944, 0xFFFF, 0xE553, 0xF945, 0xEE60, 0xFFFF, 0x9795, 0xEE61, 0xE555,
+    0xE557, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE558, 0xFFFF, 0xFFFF, 0xF946, 0xF947, 0xFFFF, 0xFFFF, 0xE55B, 0xE559, 0xFFFF, 0xF948,
+    0xFFFF, 0xF949, 0xFFFF, 0xFFFF, 0x93A1, 0xE55A, 0xF94A, 0xFFFF, 0xFFFF, 0x94CB, 0xE54D, 0xFFFF, 0xFFFF, 0xEE62, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF94B, 0x8F93, 0xFFFF, 0xE55C, 0xE561, 0x9194, 0xFFFF, 0xFFFF, 0xE560, 0xEE64,
+  },
+  { /* U+86xx */
+    0xF94C, 0xFFFF, 0xE541, 0xFFFF, 0xEE65, 0xEE66, 0xE562, 0x9168, 0xFFFF, 0xFFFF, 0xE55D, 0xE55F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEE67, 0xF94D, 0xEE63, 0xE55E, 0xFFFF, 0xFFFF, 0x9F50, 0x9F41, 0xEE69, 0xFFFF, 0xE564, 0xFFFF, 0xFFFF, 0xFFFF, 0xF94E, 0xFFFF,
+    0xFFFF, 0xF94F, 0xE563, 0xFFFF, 0xF950, 0xFFFF, 0xFFFF, 0xF951, 0xFFFF, 0xEE6A, 0xFFFF, 0xFFFF, 0xFFFF, 0x9796, 0xFFFF, 0xE1BA,
+    0xE565, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE6B, 0xF953, 0xFFFF, 0xFFFF, 0xF954, 0xFFFF, 0xFFFF, 0xE566,
+    0xF956, 0x8888, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE567, 0x8CD5, 0xFFFF,
+    0x8B73, 0xFFFF, 0xFFFF, 0xF958, 0xE569, 0x997C, 0xF959, 0xEE6C, 0xFFFF, 0xFFFF, 0x8B95, 0xEE6D, 0x97B8, 0xFFFF, 0x8BF1, 0xE56A,
+    0xFFFF, 0xFFFF, 0xEE6F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE56B, 0xFFFF, 0xFFFF, 0xFFFF, 0x928E, 0xEE71, 0xFFFF, 0xFFFF, 0xF95A,
+    0xFFFF, 0xE56C, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE72, 0xFFFF, 0xF95B, 0xFFFF, 0x93F8, 0xF95C, 0x88B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF95D, 0xFFFF, 0xF95E, 0x89E1, 0xE571, 0xE572, 0xF95F, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF960, 0xFFFF, 0xE56D, 0xFFFF, 0x8E5C, 0xFFFF, 0xFFFF, 0xEE73, 0xFFFF, 0xFFFF, 0xFFFF, 0xF961, 0xF962, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE56E, 0x9461, 0xFFFF, 0xFFFF, 0xFFFF, 0xF963, 0xE56F, 0xE570, 0xE57A, 0xFFFF, 0xFFFF, 0xFFFF, 0xE574,
+    0xE577, 0xF965, 0xFFFF, 0xF966, 0xFFFF, 0xFFFF, 0xE573, 0xFFFF, 0xEE74, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF967, 0xFFFF, 0xF968, 0xE575, 0xFFFF, 0xE576, 0x8ED6, 0xFFFF, 0xE578, 0xFFFF, 0x9260, 0xFFFF, 0x8C75, 0x8A61, 0xFFFF,
+    0xFFFF, 0xF969, 0xFFFF, 0xFFFF, 0xE57B, 0xF96A, 0xFFFF, 0xF96B, 0xFFFF, 0x8A5E, 0xFFFF, 0xE581, 0xFFFF, 0xFFFF, 0xE57C, 0xE580,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF96C, 0x94B8, 0xFFFF, 0xF96D, 0xFFFF, 0xFFFF, 0xE57D, 0xFFFF, 0xFFFF, 0xE57E, 0x9567, 0x94D8, 0xE582,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x91FB, 0xE58C, 0xEE75, 0xE588, 0xEE76, 0xEE77, 0x89E9, 0xFFFF,
+  },
+  { /* U+87xx */
+    0xE586, 0xFFFF, 0x9649, 0xE587, 0xFFFF, 0xF96F, 0xE584, 0xF970, 0xE585, 0xE58A, 0xE58D, 0xEE78, 0xFFFF, 0xE58B, 0xF971, 0xFFFF,
+    0xF972, 0xE589, 0xE583, 0xF973, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9277, 0xF974, 0xE594, 0xFFFF, 0x96A8, 0xFFFF, 0xFFFF, 0xF975,
+    0xFFFF, 0xF976, 0xFFFF, 0xF977, 0xFFFF, 0xE592, 0xFFFF, 0xFFFF, 0xFFFF, 0xE593, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF978, 0xFFFF, 0xFFFF, 0xE58E, 0xFFFF, 0xFFFF, 0xE590, 0xFFFF, 0xFFFF, 0xF979, 0xE591, 0xFFFF, 0xFFFF, 0xF97A, 0xE58F,
+    0xF97B, 0xFFFF, 0xFFFF, 0xF97C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x90E4, 0xFFFF, 0x9858, 0xE598, 0xFFFF, 0xE599, 0xFFFF,
+    0xFFFF, 0xF97D, 0xFFFF, 0xE59F, 0xFFFF, 0x9049, 0xFFFF, 0xE59B, 0xF97E, 0xE59E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE596,
+    0xE595, 0xFFFF, 0xFFFF, 0xE5A0, 0xF980, 0xF981, 0x89DA, 0xFFFF, 0xE59C, 0xFFFF, 0xE5A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xE59D, 0xFFFF,
+    0xFFFF, 0xEE79, 0xF982, 0xFFFF, 0xE59A, 0xFFFF, 0x92B1, 0xFFFF, 0xE597, 0xFFFF, 0xFFFF, 0xFFFF, 0xF983, 0xFFFF, 0xFFFF, 0x9488,
+    0xFFFF, 0xFFFF, 0xE5A5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE7A, 0xEE7B, 0xF987, 0xFFFF, 0xF988, 0xFFFF, 0x975A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF989, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5A4,
+    0xF98A, 0xFFFF, 0xE5A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF986, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5AC, 0xEE7C, 0xEE7D, 0xFFFF, 0xE5A6,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE5AE, 0xFFFF, 0xEE7E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9786, 0xE5B1, 0xFFFF, 0xE5A8, 0xF98D, 0xFFFF,
+    0xE5A9, 0xF98F, 0xFFFF, 0xFFFF, 0xE5AD, 0xFFFF, 0xE5B0, 0xE5AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5A7, 0xFFFF, 0xFFFF, 0xF990, 0xFFFF,
+    0xE5AA, 0xFFFF, 0xE5BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF992,
+    0xE5B4, 0xFFFF, 0xFFFF, 0xF994, 0xFFFF, 0xF995, 0xF996, 0xFFFF, 0xFFFF, 0xFFFF, 0xF997, 0xF998, 0xEE82, 0xF999, 0xFFFF, 0xE5B2,
+    0xFFFF, 0xFFFF, 0xE5B3, 0xFFFF, 0xFFFF, 0xF991, 0xE5B8, 0xE5B9, 0xFFFF, 0x8A49, 0xFFFF, 0x8B61, 0xFFFF, 0xFFFF, 0xE5B7, 0xFFFF,
+  },
+  { /* U+88xx */
+    0xFFFF, 0xF99A, 0xFFFF, 0xF99B, 0xFFFF, 0xE5A2, 0xEE83, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE84, 0xF99C, 0xFFFF, 0xE5B6, 0xE5BA, 0xE5B5,
+    0xEE85, 0xE5BC, 0xFFFF, 0xF99D, 0xEE86, 0xE5BE, 0xE5BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE87,
+    0xFFFF, 0xE5C0, 0xE5BF, 0xE579, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5C4, 0xF99E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF99F, 0xFFFF,
+    0xFFFF, 0xE5C1, 0xF9A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5C2, 0xFFFF, 0xFFFF, 0xE5C3, 0xFFFF, 0xE5C5, 0xF9A1, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8C8C, 0xFFFF, 0xE5C7, 0xFFFF, 0xE5C6, 0xFFFF, 0x8F4F, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A3, 0xFFFF, 0x8D73, 0x9FA5, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE5C8, 0x8F70, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A58, 0xF9A4, 0xE5C9, 0xFFFF, 0x8971, 0xFFFF, 0x8FD5, 0xE5CA, 0xF9A5,
+    0xFFFF, 0x8D74, 0xE5CB, 0x88DF, 0xF9A6, 0xFFFF, 0xFFFF, 0xFFFF, 0x955C, 0xF9A9, 0xFFFF, 0xE5CC, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9AB,
+    0x908A, 0xFFFF, 0xE5D3, 0xFFFF, 0xFFFF, 0xE5D0, 0xFFFF, 0x928F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5D1, 0xE5CE, 0x8BDC,
+    0xFFFF, 0xE5CD, 0xE5D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C55, 0xFFFF, 0xFFFF, 0x91DC, 0xFFFF, 0xE5DA, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE5D6, 0xFFFF, 0xFFFF, 0xFFFF, 0x91B3, 0xE5D5, 0xEE88, 0xE5D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5CF, 0xFFFF,
+    0xF9AC, 0xFFFF, 0xE5D9, 0xFFFF, 0xE5DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE89, 0x94ED, 0xFFFF, 0xFFFF, 0xE5D7, 0xFFFF,
+    0xE5DC, 0xE5DE, 0xFFFF, 0xFFFF, 0x8CD1, 0xE5D2, 0xFFFF, 0x88BF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9AD, 0xF9AE, 0xF9AF, 0xE5DD,
+    0xF9B0, 0x8DD9, 0x97F4, 0xE5DF, 0xE5E0, 0x9195, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE8A, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE8B, 0x97A0,
+    0xFFFF, 0xF9B3, 0xF9B1, 0xF9B4, 0xE5E1, 0x9754, 0xFFFF, 0xFFFF, 0xE5E2, 0xE5E3, 0xFFFF, 0xF9B5, 0x95E2, 0xE5E4, 0xFFFF, 0x8DBE,
+    0xFFFF, 0x97A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF9B6, 0xF9B7, 0xE5EA, 0x8FD6, 0xE5E8, 0xEE8D, 0xFFFF, 0xFFFF, 0x9787, 0xE5E5, 0xFFFF, 0xFFFF, 0xE5E7, 0x90BB, 0x909E, 0xFFFF,
+  },
+  { /* U+89xx */
+    0xFFFF, 0xF9B9, 0xE5E6, 0xFFFF, 0xE5EB, 0xFFFF, 0xFFFF, 0x95A1, 0xFFFF, 0xFFFF, 0xE5ED, 0xFFFF, 0xE5EC, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8A8C, 0xFFFF, 0x964A, 0xE5EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE90, 0xEE91, 0xEE92, 0xFFFF, 0xEE8E, 0xE5FA, 0xE5F0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5F1, 0xFFFF, 0xEE93, 0xFFFF, 0xFFFF, 0xE5F2, 0xE5F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEE94, 0xFFFF, 0xEE95, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5F7, 0xF9BB, 0xE5F8, 0xEE96, 0xFFFF, 0xE5F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEE97, 0xE5F4, 0xF9BD, 0xE5EF, 0xE5F5, 0xF9BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9BF, 0xFFFF, 0xFFFF, 0xE5F9, 0xE8B5, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x89A6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE5FC, 0x8BDD,
+    0xE5FB, 0xFFFF, 0xF9C2, 0xFFFF, 0xE641, 0xFFFF, 0xE640, 0xFFFF, 0xFFFF, 0xFFFF, 0xE643, 0xFFFF, 0xFFFF, 0xE642, 0xFFFF, 0xE644,
+    0xFFFF, 0xFFFF, 0x8F50, 0xFFFF, 0xE645, 0xFFFF, 0xFFFF, 0xE646, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE647, 0x90BC,
+    0xF9C3, 0x9776, 0xFFFF, 0xE648, 0xFFFF, 0xFFFF, 0x95A2, 0x9465, 0xE649, 0xF9C4, 0xE64A, 0x8CA9, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B4B,
+    0xF9C5, 0xFFFF, 0xFFFF, 0xE64B, 0xEE98, 0xFFFF, 0x8E8B, 0x9460, 0xE64C, 0xFFFF, 0x8A6F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9C6,
+    0xFFFF, 0xE64D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE64F, 0x9797, 0xFFFF, 0xE64E, 0x9065, 0xFFFF, 0xE650, 0xFFFF, 0xFFFF, 0xE651,
+    0xF9C7, 0xFFFF, 0xE652, 0x8ACF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9C8, 0xFFFF, 0xFFFF, 0xE653, 0xFFFF, 0xFFFF, 0xE654, 0xFFFF, 0xE655,
+    0xE656, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8A70, 0xFFFF, 0xEE9A, 0xFFFF, 0xF9C9, 0xFFFF, 0xF9CA, 0xFFFF, 0xE657, 0xFFFF, 0xE658, 0xE659, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x89F0, 0xFFFF, 0xEE9B, 0x9047, 0xE65A, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9CB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF9CD, 0xFFFF, 0xF9CE, 0xE65B, 0xFFFF, 0xEE9C, 0xFFFF, 0xE65C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9CF, 0xFFFF, 0xF9D0,
+  },
+  { /* U+8Axx */
+    0x8CBE, 0xFFFF, 0x92F9, 0xE65D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C76, 0xFFFF, 0x9075, 0xFFFF, 0xE660, 0xFFFF, 0x93A2, 0xFFFF,
+    0xE65F, 0xF9D2, 0xEE9D, 0x8C50, 0xF9D3, 0xEE9E, 0xE65E, 0x91F5, 0x8B4C, 0xFFFF, 0xFFFF, 0xE661, 0xFFFF, 0xE662, 0xFFFF, 0x8FD7,
+    0xFFFF, 0xF9D5, 0xEE9F, 0x8C8D, 0xFFFF, 0xE663, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x964B, 0xFFFF, 0xFFFF, 0x90DD, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8B96, 0xFFFF, 0x96F3, 0x9169, 0xF9D6, 0xE664, 0xEEA0, 0xFFFF, 0xFFFF, 0x9066, 0x9290, 0x8FD8, 0xFFFF, 0xF9D7, 0xFFFF,
+    0xFFFF, 0xE665, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9D8, 0xE668, 0xEEA1, 0xE669, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9D9, 0xEEA2, 0xFFFF,
+    0x8DBC, 0x91C0, 0xE667, 0xFFFF, 0x8FD9, 0x955D, 0xFFFF, 0xFFFF, 0xF9DA, 0xFFFF, 0xFFFF, 0xE666, 0xFFFF, 0xEEA3, 0x8E8C, 0xFFFF,
+    0x8972, 0xEEA4, 0xE66D, 0x8C77, 0xFFFF, 0xFFFF, 0x8E8E, 0xFFFF, 0xFFFF, 0x8E8D, 0xFFFF, 0x986C, 0xE66C, 0xE66B, 0x9146, 0xFFFF,
+    0x8B6C, 0x9862, 0x8A59, 0x8FDA, 0xFFFF, 0xEEA5, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEA6, 0xFFFF, 0xFFFF, 0xE66A, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE66F, 0xFFFF, 0xE670, 0xE66E, 0xFFFF, 0x8CD6, 0xFFFF, 0x975F, 0xFFFF, 0xFFFF, 0x8E8F, 0x9446, 0xFFFF, 0xFFFF,
+    0xF9DC, 0xE673, 0xFFFF, 0x90BE, 0xFFFF, 0x9261, 0xFFFF, 0xFFFF, 0x9755, 0xFFFF, 0xE676, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CEA, 0xFFFF,
+    0x90BD, 0xE672, 0xFFFF, 0xE677, 0x8CEB, 0xE674, 0xE675, 0xEEA7, 0xE671, 0xFFFF, 0xFFFF, 0xFFFF, 0x90E0, 0x93C7, 0xF9DB, 0xFFFF,
+    0x924E, 0xFFFF, 0x89DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9DD, 0xFFFF, 0x94EE, 0xFFFF, 0xFFFF, 0x8B62, 0xFFFF, 0xF9DE, 0x92B2,
+    0xFFFF, 0xFFFF, 0xE67A, 0xFFFF, 0xE678, 0xFFFF, 0xFFFF, 0x926B, 0xFFFF, 0xFFFF, 0xFFFF, 0x90BF, 0x8AD0, 0xE679, 0xFFFF, 0x907A,
+    0xEEA8, 0xFFFF, 0x97C8, 0xFFFF, 0xFFFF, 0xFFFF, 0x985F, 0xF9DF, 0xFFFF, 0xFFFF, 0xE67B, 0xE687, 0x92B3, 0xFFFF, 0xE686, 0xEEA9,
+    0xE683, 0xE68B, 0xE684, 0xFFFF, 0xE680, 0xFFFF, 0x92FA, 0xE67E, 0xFFFF, 0xFFFF, 0xFFFF, 0xE67C, 0xFFFF, 0x9740, 0x8E90, 0xFFFF,
+    0xFFFF, 0xE681, 0xFFFF, 0xE67D, 0xEEAA, 0xFFFF, 0xEEAB, 0xE685, 0x8F94, 0xFFFF, 0x8CBF, 0xFFFF, 0xF9E0, 0xFFFF, 0x91F8, 0xFFFF,
+  },
+  { /* U+8Bxx */
+    0x9664, 0x8979, 0x88E0, 0xFFFF, 0x93A3, 0xF9E3, 0xFFFF, 0xE689, 0xFFFF, 0xFFFF, 0xF9E2, 0xFFFF, 0xE688, 0xF9E4, 0x93E4, 0xFFFF,
+    0xE68D, 0xFFFF, 0xFFFF, 0xFFFF, 0xE682, 0xFFFF, 0xE68C, 0xE68E, 0xFFFF, 0x8CAA, 0xE68A, 0x8D75, 0xF9E5, 0x8ED3, 0xFFFF, 0xF9E6,
+    0xE68F, 0x9777, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE692, 0xFFFF, 0xE695, 0xFFFF, 0xFFFF, 0xE693, 0x9554, 0xF9E7, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE690, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8BDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE694, 0xFFFF,
+    0xFFFF, 0xE696, 0xFFFF, 0xF9E8, 0xFFFF, 0xFFFF, 0xEEAF, 0xFFFF, 0xFFFF, 0xE69A, 0xFFFF, 0xFFFF, 0xE697, 0xFFFF, 0xE699, 0xE698,
+    0xFFFF, 0xF9EA, 0xFFFF, 0xFFFF, 0xEEB0, 0xFFFF, 0xE69B, 0xFFFF, 0x8EAF, 0xEEB1, 0xE69D, 0xE69C, 0x9588, 0xFFFF, 0xF9EB, 0xE69F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8C78, 0xFFFF, 0xFFFF, 0xEEB2, 0xFFFF, 0xE69E, 0xE6A0, 0xFFFF, 0xFFFF, 0xE6A1,
+    0x8B63, 0xE3BF, 0x8FF7, 0xFFFF, 0xE6A2, 0xFFFF, 0xF9EC, 0x8CEC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6A3, 0xFFFF, 0xF9ED,
+    0xE6A4, 0xF9EE, 0xFFFF, 0x8E5D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9DCC, 0xF9EF, 0xE6A5, 0xFFFF, 0xE6A6, 0xFFFF,
+    0x8F51, 0xFFFF, 0xE6A7, 0xE6A8, 0xF9F0, 0xF9F1, 0xE6A9, 0xFFFF, 0xFFFF, 0xE6AA, 0xE6AB, 0xFFFF, 0xF9F2, 0xEEB3, 0xF9F3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+8Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x924A, 0xFFFF, 0xF9F4, 0xE6AC, 0xFFFF, 0xFFFF, 0xF9F6, 0xFFFF, 0xE6AE,
+    0xFFFF, 0xE6AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9F9, 0x93A4, 0xF9FA, 0xE6AF, 0xEEB4, 0x964C, 0xFFFF, 0xE6B0, 0xFFFF, 0xE6B1, 0xF9FB,
+    0xE6B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9FC, 0xE6B3, 0xFFFF, 0xFA40, 0xFFFF, 0xFFFF, 0x93D8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8FDB, 0xE6B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEB5, 0xFA41, 0x8D8B, 0x98AC, 0xE6B5, 0xFA42, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFA43, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6B6, 0x955E, 0xE6B7, 0xFFFF, 0xE6BF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE6B8, 0xFFFF, 0xFFFF, 0xE6BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6B9, 0xE6BB, 0xFFFF, 0x9665, 0xE6BC, 0xE6BD, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFA46, 0xFA45, 0xE6BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6C0, 0xFA47, 0xFFFF, 0xFA49, 0xFFFF, 0x8A4C, 0x92E5, 0xFFFF,
+    0x9589, 0x8DE0, 0x8D76, 0xFFFF, 0xFA4A, 0xFFFF, 0xFFFF, 0x956E, 0x89DD, 0x94CC, 0xE6C3, 0x8AD1, 0x90D3, 0xE6C2, 0xE6C7, 0x9299,
+    0x96E1, 0xFFFF, 0xE6C5, 0xE6C6, 0x8B4D, 0xFFFF, 0xE6C8, 0x9483, 0x91DD, 0xFFFF, 0xFFFF, 0x94EF, 0x935C, 0xE6C4, 0xFFFF, 0x9666,
+    0x89EA, 0xE6CA, 0x9847, 0x92C0, 0x9864, 0xFFFF, 0xFFFF, 0x8E91, 0xE6C9, 0xFFFF, 0x91AF, 0xFFFF, 0xFFFF, 0xE6DA, 0x9147, 0xFFFF,
+    0xFFFF, 0x93F6, 0xFFFF, 0x956F, 0xFFFF, 0xFA4C, 0xFA4B, 0xFFFF, 0xFFFF, 0xFA4D, 0xE6CD, 0x8E5E, 0x8E92, 0xFFFF, 0x8FDC, 0xFFFF,
+    0x9485, 0xEEB7, 0x8CAB, 0xE6CC, 0xE6CB, 0xFFFF, 0x958A, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EBF, 0xFFFF, 0xFFFF, 0x9371, 0xFFFF, 0xFFFF,
+    0xFA4F, 0xFA50, 0xFFFF, 0xFFFF, 0xEEB8, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEB9, 0xFFFF, 0xE6CF, 0xE6D0, 0x8D77, 0xE6CE, 0xEEBA, 0xFFFF,
+  },
+  { /* U+8Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6D1, 0xE6D2, 0xFFFF, 0xE6D4, 0x91A1, 0xFA52, 0xE6D3, 0x8AE4, 0xFFFF, 0xE6D6, 0xFA53, 0xE6D5,
+    0xE6D7, 0xFFFF, 0xEEBC, 0xE6D9, 0xE6DB, 0xFFFF, 0xE6DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x90D4, 0xFFFF, 0x8ECD, 0xE6DD, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A71, 0xFA54, 0xE6DE, 0xFFFF, 0xFFFF,
+    0x9196, 0xE6DF, 0xFFFF, 0xE6E0, 0x958B, 0xFFFF, 0xFFFF, 0x8B4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE6E1, 0xFFFF, 0xFFFF, 0xFA55, 0x92B4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x897A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA56, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6E2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8EEF, 0xFFFF, 0xFFFF, 0xFA57, 0xFFFF, 0x9096, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEBE,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x91AB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6E5, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6E4, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE6E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA59, 0xFFFF, 0xFA5A, 0xFFFF, 0xFFFF, 0xE6EB, 0xE6E9, 0xFFFF, 0xEEBF, 0xE6E6,
+    0xFFFF, 0xEEC0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6E8, 0xEEC1, 0xFFFF, 0xFA5B, 0xE6E7, 0xE6EA, 0xFFFF, 0x8B97, 0xFFFF, 0xE6EE,
+    0xFFFF, 0x90D5, 0xFFFF, 0xE6EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8CD7, 0xFFFF, 0xE6EC, 0xE6ED, 0xFA5C, 0xFFFF, 0xFFFF, 0x9848,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x92B5, 0xFFFF, 0x9148, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6F0, 0xFA5F, 0xFFFF, 0xE6F3,
+  },
+  { /* U+8Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA60, 0xFFFF, 0xE6F1, 0xE6F2, 0x9778, 0xFFFF, 0xFA5D, 0xFFFF, 0xFFFF, 0x93A5,
+    0xE6F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA62, 0xFFFF, 0xFA63, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6F4, 0xE6F5, 0xE6F7,
+    0xEEC2, 0xFA64, 0xFA65, 0xEEC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA66, 0xFFFF, 0xFFFF, 0xE748, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE6FA, 0xFFFF, 0xFFFF, 0xFFFF, 0xE6FB, 0xE6F9, 0xFA69, 0xFFFF, 0xFFFF, 0xFA6A, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEC4, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE6F8, 0xFFFF, 0x92FB, 0xFFFF, 0xFFFF, 0xE740, 0xE744, 0xE741, 0xE6FC, 0xFA6B, 0xE742, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE743, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA6C, 0xE74A, 0xFFFF, 0xFFFF, 0xFFFF, 0xE745, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x90D6,
+    0xE747, 0xFFFF, 0xFA6D, 0xE749, 0xE746, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA6E, 0xFA6F, 0xFFFF, 0xFA70,
+    0xEEC5, 0xFFFF, 0xE74C, 0xFFFF, 0x8F52, 0xFFFF, 0xE74B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEC6, 0xE74D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE74E, 0xFFFF, 0xFFFF, 0xE751, 0xE750, 0xFFFF, 0xE74F, 0xFFFF, 0xFFFF, 0xE753, 0xE752, 0xFFFF, 0x96F4, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE755, 0xFFFF, 0xE754, 0xE756, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA71, 0xE757, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA72, 0xFFFF,
+    0xFFFF, 0xE759, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE758, 0x9067, 0xE75A, 0xFFFF, 0xFA73, 0x8BEB,
+    0xE75B, 0xE75D, 0xFFFF, 0xFA74, 0xFFFF, 0xFA75, 0xFA76, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA77, 0xFFFF, 0xFFFF, 0xE75E, 0xFFFF,
+    0xEEC8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE75F, 0xE75C, 0xFFFF, 0xE760, 0xFFFF, 0x8ED4, 0xE761, 0x8B4F, 0x8C52, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFA79, 0x8CAC, 0xFFFF, 0xFA7A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE762, 0xFFFF, 0xFFFF, 0xFFFF, 0x93EE,
+    0xFFFF, 0xFFFF, 0x935D, 0xE763, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE766, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EB2, 0xFA7C, 0xEECA, 0xE765, 0xE764, 0x8C79, 0xE767, 0xFFFF,
+  },
+  { /* U+8Fxx */
+    0xFA7E, 0xFFFF, 0xFFFF, 0x8A72, 0xFFFF, 0xE769, 0xFFFF, 0xFFFF, 0xFA80, 0x8DDA, 0xE768, 0xFFFF, 0xE771, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE76B, 0xE76D, 0x95E3, 0xE76A, 0xFFFF, 0xFA81, 0xFFFF, 0xE76C, 0xFFFF, 0xE770, 0xE76E, 0x8B50, 0xEECB, 0xE76F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE772, 0xFFFF, 0xFFFF, 0x9479, 0x97D6, 0xFA82, 0xFFFF, 0xEECC, 0xFFFF, 0x8F53,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE773, 0xFFFF, 0xFFFF, 0xEECD, 0xFFFF, 0x9741, 0xE775, 0xFFFF, 0xE774, 0xFFFF, 0xFFFF, 0xE778, 0x9760,
+    0xFA83, 0xFFFF, 0xE777, 0xFFFF, 0x8A8D, 0xE776, 0xE77B, 0xFFFF, 0xFFFF, 0xE77A, 0xFA84, 0xFFFF, 0xE779, 0x9351, 0xE77C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEECE, 0xFFFF, 0xFFFF, 0xE77D, 0xFA85, 0xFFFF, 0xFFFF, 0xFFFF, 0xE77E, 0xFFFF, 0xFFFF, 0x8D8C,
+    0xFFFF, 0x8C44, 0xE780, 0xE781, 0xE782, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9068, 0xE783, 0xFFFF, 0x8EAB, 0xE784,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE785, 0xFA87, 0xFFFF, 0xEED0, 0x999F, 0x999E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE786, 0xE390, 0xE787,
+    0x9243, 0x904A, 0x945F, 0xFFFF, 0xFA88, 0xEED1, 0xFA8A, 0xE788, 0xFFFF, 0xFFFF, 0x95D3, 0x92D2, 0x8D9E, 0xFFFF, 0xFFFF, 0x9248,
+    0xFFFF, 0xFA8C, 0x8949, 0xFFFF, 0x9698, 0x9076, 0xFA8D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA8F, 0xFFFF, 0xFFFF, 0xFA90, 0x8C7D, 0xFFFF,
+    0xFFFF, 0x8BDF, 0xFFFF, 0xFA91, 0x95D4, 0xFA92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE789, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFA93, 0xFFFF, 0xE78B, 0xFFFF, 0xEED2, 0xE78A, 0x89DE, 0xFFFF, 0xEED3, 0x93F4, 0xE78C, 0x9497, 0xFFFF, 0x9352, 0xEED4, 0xE78D,
+    0x8F71, 0xFA94, 0xFFFF, 0xFFFF, 0xE78F, 0xFA95, 0xFFFF, 0x96C0, 0xE79E, 0xE791, 0xE792, 0xFA96, 0xFFFF, 0x92C7, 0xFFFF, 0xFFFF,
+  },
+  { /* U+90xx */
+    0x91DE, 0x9197, 0xFA97, 0x93A6, 0xFFFF, 0xE790, 0x8B74, 0xFFFF, 0xEED5, 0xFFFF, 0xFFFF, 0xE799, 0xFA98, 0xE796, 0xE7A3, 0x93A7,
+    0x9280, 0xE793, 0xFFFF, 0x92FC, 0x9372, 0xE794, 0xE798, 0x9080, 0xFFFF, 0x9487, 0x92CA, 0xFFFF, 0xFFFF, 0x90C0, 0xE797, 0x91AC,
+    0x91A2, 0xE795, 0x88A7, 0x9841, 0xFFFF, 0xFFFF, 0xFFFF, 0xE79A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEED6, 0x91DF, 0xFFFF,
+    0xFFFF, 0x8F54, 0x9069, 0xFFFF, 0xFFFF, 0xE79C, 0xE79B, 0xFA99, 0x88ED, 0xE79D, 0xFFFF, 0xFFFF, 0x954E, 0xFFFF, 0xE7A5, 0xFFFF,
+    0xFFFF, 0x93D9, 0x908B, 0xFA9B, 0xFA9C, 0x9278, 0xFFFF, 0x8BF6, 0xFFFF, 0xE7A4, 0x9756, 0x895E, 0xFFFF, 0x95D5, 0x89DF, 0xE79F,
+    0xE7A0, 0xE7A1, 0xE7A2, 0x93B9, 0x9242, 0x88E1, 0xE7A6, 0xFFFF, 0xE7A7, 0xEAA1, 0xFFFF, 0xFFFF, 0x91BB, 0xFA9D, 0xE7A8, 0xFFFF,
+    0x8993, 0x916B, 0xFFFF, 0x8CAD, 0xFFFF, 0x9779, 0xFFFF, 0xFFFF, 0xE7A9, 0x934B, 0xFFFF, 0xFFFF, 0xFFFF, 0x9198, 0x8ED5, 0xE7AA,
+    0xFFFF, 0xFFFF, 0xE7AD, 0xFFFF, 0xFFFF, 0x8F85, 0xE7AB, 0x914A, 0x9149, 0xFFFF, 0x88E2, 0xFFFF, 0x97C9, 0xE7AF, 0xFFFF, 0x94F0,
+    0xE7B1, 0xE7B0, 0xE7AE, 0xE284, 0x8AD2, 0xFAA0, 0xFFFF, 0xE78E, 0xEED8, 0xE7B3, 0xE7B2, 0xFFFF, 0xFAA1, 0xFFFF, 0xFFFF, 0xE7B4,
+    0xFAA2, 0x9757, 0xFFFF, 0xFFFF, 0xFFFF, 0xEED9, 0xFFFF, 0xEEDA, 0xFFFF, 0xEEDB, 0xFFFF, 0xEEDC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFAA4, 0xEEDD, 0x93DF, 0xFFFF, 0xFFFF, 0x964D, 0xFFFF, 0xE7B5, 0xFFFF, 0x8ED7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7B6,
+    0xFAA6, 0xE7B7, 0xFFFF, 0xEEDE, 0xFFFF, 0xE7B8, 0xFAA7, 0xFFFF, 0x9340, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEDF, 0xFFFF,
+    0xFFFF, 0x88E8, 0xFFFF, 0xFAA8, 0xEEE0, 0xEEE1, 0xFFFF, 0xEEE2, 0xFAA9, 0xFFFF, 0x8D78, 0xFFFF, 0xFFFF, 0xFFFF, 0x9859, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEE3, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7BC, 0xFAAB, 0xEEE4, 0xEEE5, 0xFAAC,
+    0xFFFF, 0x8C53, 0xE7B9, 0xFFFF, 0xE7BA, 0xFFFF, 0xFFFF, 0xFFFF, 0x9594, 0xFFFF, 0xFFFF, 0xFAB1, 0xFFFF, 0x8A73, 0xFFFF, 0xEEE6,
+    0xFFFF, 0xFFFF, 0xFAAF, 0xFFFF, 0xEEE7, 0x9758, 0xFAAE, 0x8BBD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9373, 0xFAB2, 0xFAB3,
+  },
+  { /* U+91xx */
+    0xFAB0, 0xFFFF, 0xE7BD, 0xFFFF, 0xFAB4, 0xFFFF, 0xFAB5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE7BE, 0xFFFF, 0xEEE9, 0xEEEA, 0xEEEB, 0xFFFF, 0xFAB6, 0xE7BF, 0xFFFF, 0xFFFF, 0xFAB7, 0xFFFF, 0xFAB8, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEEEC, 0xEEED, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9341, 0xFFFF, 0xEEEF,
+    0xE7C1, 0xEEF0, 0xE7C0, 0xFFFF, 0xEEF1, 0xFFFF, 0xFFFF, 0xFAB9, 0xFFFF, 0xFABA, 0xFABB, 0xFFFF, 0xFFFF, 0xEEF2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFABC, 0xFABD, 0xEEF3, 0x93D1, 0xE7C2, 0x8F55, 0x8EDE, 0x947A, 0x9291, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x8EF0, 0xFFFF, 0x908C, 0xFFFF, 0xE7C3, 0xFABE, 0xE7C4, 0xFABF, 0xFFFF, 0xEEF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFAC0, 0x907C, 0xE7C5, 0xFAC1, 0xE7C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7C7, 0x978F, 0xFFFF, 0x8F56, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE7C9, 0xE7C8, 0xFAC2, 0x8D79, 0xFFFF, 0x8D93, 0x8E5F, 0xFAC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE7CC, 0xEEF5, 0xFFFF, 0xFAC4, 0xFFFF, 0x8F86, 0xFFFF, 0xE7CB, 0xFFFF, 0xE7CA, 0xFFFF, 0x91E7, 0xFAC5, 0xFFFF,
+    0x8CED, 0xFFFF, 0x90C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F58, 0xFFFF, 0xEEF6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xE7CD, 0xFFFF, 0x8FDD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAC6, 0xFFFF, 0xE7D0, 0xE7CE, 0xEEF7, 0xFFFF, 0xFAC7, 0xE7CF,
+    0xFFFF, 0xEEF8, 0xFFFF, 0xFAC8, 0xE7D2, 0xE7D1, 0xFAC9, 0xFFFF, 0x8FF8, 0xFFFF, 0xE7D3, 0xFFFF, 0xEEF9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE7D4, 0xE7D5, 0xFFFF, 0xFACA, 0xFACB, 0xFFFF, 0x94CE, 0x8DD1, 0x8EDF, 0xE7D6, 0xFFFF, 0xE7D7, 0x97A2, 0x8F64, 0x96EC, 0x97CA,
+    0xE7D8, 0x8BE0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7D9, 0xEEFA, 0x9342, 0xFFFF, 0xFACC, 0xE7DC, 0x8A98, 0x906A, 0xFFFF, 0xE7DA,
+    0xFFFF, 0xE7DB, 0xFFFF, 0x92DE, 0xEEFC, 0xEF40, 0x9674, 0x8BFA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFACF, 0xEF41, 0xFAD0, 0xFFFF,
+    0xFFFF, 0xEF42, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7DE, 0xE7DF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEFB, 0xE7DD, 0xFFFF, 0xFFFF, 0xE7E1,
+  },
+  { /* U+92xx */
+    0xFFFF, 0xFAD1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF43, 0xFFFF, 0xFFFF, 0xFAD2, 0xFFFF, 0xFFFF, 0x93DD, 0x8A62, 0xFFFF,
+    0xEF44, 0xE7E5, 0xFFFF, 0xFFFF, 0xE7E2, 0xE7E4, 0xFAD3, 0xFAD4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7E0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE86E, 0xFFFF, 0xFFFF, 0xE7E3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFAD6, 0x97E9, 0xFFFF, 0xFFFF, 0x8CD8, 0xEF45, 0xEF46, 0xEF47, 0xFFFF, 0xEF48, 0xFFFF, 0xFFFF, 0xE7ED,
+    0xEF49, 0xFFFF, 0xFAD7, 0xEF4A, 0x9353, 0xE7E8, 0xFFFF, 0xFAD8, 0xE7EB, 0xE7E9, 0xFAD9, 0xE7EE, 0xFFFF, 0xFFFF, 0xFADA, 0xEF4B,
+    0xE7EF, 0xFADB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFADC, 0xE7E7, 0xFFFF, 0xFADD, 0xE7F4, 0x8994, 0xFFFF, 0xFFFF, 0xE7E6, 0xFFFF,
+    0xFADE, 0xFADF, 0x94AB, 0xFFFF, 0xE7EA, 0xFAE0, 0x8FDE, 0xFAE1, 0xFAE2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8D7A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAE5, 0xFAE6, 0x9667, 0xFAE7,
+    0x8BE2, 0xFFFF, 0xFFFF, 0x8F65, 0xFFFF, 0x93BA, 0xFFFF, 0xFFFF, 0xEF4D, 0xFAE8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAE9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x914C, 0xFFFF, 0xE7F2, 0xFFFF, 0xE7EC, 0xE7F1, 0xFAEA, 0x96C1, 0xFAEB, 0x92B6, 0xE7F3, 0xE7F0, 0xFFFF, 0xFFFF, 0xFAEC,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAEE, 0xFFFF, 0x914B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFAF1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7F7, 0xFFFF, 0xE7F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAF2,
+    0xFAF3, 0xFFFF, 0xEF4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF4F, 0xEF50, 0xFFFF, 0xFAF5, 0xE7F5,
+    0xFAF6, 0xFFFF, 0x964E, 0xEF51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAF7, 0xFFFF, 0xFAF8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEF52, 0xFFFF, 0xFFFF, 0xFFFF, 0x8F9B, 0xFAF9, 0xFFFF, 0xFAFA, 0xFFFF, 0xE7F8, 0x95DD, 0xFFFF, 0xFFFF, 0x8973, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x9565, 0x9292, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB41, 0x8B98, 0xFB42, 0xE7FA, 0xFB43, 0x8D7C, 0xFFFF, 0xFFFF, 0xEF53,
+  },
+  { /* U+93xx */
+    0xFFFF, 0xFFFF, 0xFB44, 0xFFFF, 0xEF54, 0xFFFF, 0x8E4B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB45, 0xFFFF, 0xE7F9,
+    0x908D, 0xFAFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB46, 0xFFFF, 0xFFFF, 0x908E, 0xE840, 0xE842, 0xFFFF, 0xFFFF, 0xFB47, 0xFB48, 0xEF55,
+    0x8FF9, 0xEF56, 0xE841, 0xE843, 0xFFFF, 0xEF57, 0x8BD1, 0xFB49, 0x9564, 0xFB4A, 0xFFFF, 0x8EE0, 0x9842, 0xFFFF, 0xE7FC, 0x8DF6,
+    0xFFFF, 0xFFFF, 0x985E, 0xFFFF, 0xFFFF, 0xE845, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE844, 0xE846, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE7FB, 0xFFFF, 0xFFFF, 0xFB4D, 0xEF58, 0xEF59, 0xEF5A, 0x93E7, 0xFFFF, 0x9374, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFB4E, 0xFFFF, 0xFFFF, 0x92D5, 0xFFFF, 0xE84B, 0xFB4F, 0xFFFF, 0xFFFF, 0xFB50, 0x9262, 0xE847, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE848, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5B, 0xEF5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF5D, 0xFB51, 0x8C4C, 0xFFFF, 0xE84A, 0xFFFF,
+    0xEF5E, 0xFB52, 0xFFFF, 0xFB53, 0xFFFF, 0x8CAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE849, 0xFFFF, 0x8FDF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB57, 0xFFFF, 0xFFFF, 0xFB58, 0x8A99, 0xFFFF, 0xFFFF, 0xFB59,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE84F, 0xFFFF, 0x8DBD, 0x9199, 0xFFFF, 0xFFFF, 0x92C8, 0xEF5F, 0xFFFF, 0xFFFF, 0xFB5A, 0xFFFF,
+    0xFFFF, 0xFB54, 0xFFFF, 0xEF60, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A5A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE84D, 0xE84E, 0x92C1, 0xFFFF,
+    0xE84C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE850, 0xEF61, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFB5F, 0xFFFF, 0xE856, 0xFFFF, 0xFFFF, 0xEF62, 0xFB60, 0xE859, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE858, 0x934C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE851, 0xE852, 0xE855, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB61, 0xE857, 0xEF63, 0xEF64,
+    0xFFFF, 0x8BBE, 0xFB62, 0xFFFF, 0xE85A, 0xE854, 0xFFFF, 0xFB63, 0xE853, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFB5E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB5B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB68, 0xFFFF, 0xEF66, 0xFFFF, 0xFFFF,
+  },
+  { /* U+94xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE85E, 0xEF65, 0xFFFF, 0xFFFF, 0xE85F, 0xFFFF, 0xFB64, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB65,
+    0xE860, 0xFFFF, 0xFFFF, 0xE85D, 0xE85C, 0xFFFF, 0xFB66, 0xFB67, 0x8FE0, 0x93A8, 0xE85B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE864, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE862, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFB69, 0xEF67, 0xFB6A, 0xE863, 0xE861, 0xFFFF, 0x91F6, 0xFFFF, 0xE865, 0xFB6B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE866, 0xFFFF, 0xFFFF, 0xE868, 0xFB6C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF68, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8AD3, 0xE867, 0x96F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE873, 0xE869, 0xFFFF, 0xFFFF, 0xE86C, 0xFFFF,
+    0xE86A, 0xFFFF, 0xE86B, 0xEF69, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE86D, 0xEF6A, 0xFFFF, 0xFB6F, 0xFFFF, 0xFB70,
+    0xE86F, 0xEF6B, 0xEF6C, 0xFFFF, 0xFFFF, 0xE870, 0xFFFF, 0xE871, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE874, 0xE872, 0xE875, 0xE877,
+    0xFFFF, 0xE876, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+95xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x92B7, 0xFB71, 0xFB72, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x96E5, 0xFFFF, 0xE878, 0x914D, 0xFFFF, 0xFFFF, 0xFB73, 0xE879, 0xFFFF, 0x95C2, 0xE87A, 0x8A4A, 0xFB74, 0xFB75, 0xEF6D, 0x895B,
+    0xFFFF, 0x8AD5, 0xFFFF, 0x8AD4, 0xE87B, 0xFFFF, 0xE87C, 0xFFFF, 0xE87D, 0xE87E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF6E,
+    0xE880, 0xFFFF, 0x8AD6, 0x8A74, 0x8D7D, 0x94B4, 0xEF6F, 0xE882, 0xE881, 0xEF70, 0xFFFF, 0xFB77, 0xEF71, 0xE883, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x897B, 0xFFFF, 0xFB78, 0xFFFF, 0xEF72, 0xFFFF, 0xFFFF, 0xE886, 0xFFFF, 0xE885, 0xE884, 0xEF73, 0xE887, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE88A, 0xFFFF, 0xFFFF, 0xFFFF, 0x88C5, 0xFB7A, 0xFFFF, 0xE888, 0xEF74, 0xE88C, 0xE88B, 0xFFFF, 0xFFFF,
+    0xEF75, 0xFFFF, 0xFFFF, 0xEF76, 0xE88E, 0xE88D, 0xE88F, 0xFFFF, 0x93AC, 0xFFFF, 0xEF78, 0xFFFF, 0xE890, 0xFFFF, 0xEF79, 0xFFFF,
+    0xFFFF, 0xE891, 0xE893, 0xFFFF, 0xFFFF, 0xE892, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+96xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x958C, 0xFAA3, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE894, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE895, 0xFFFF, 0x8DE3, 0xFFFF, 0xFB7D, 0xFFFF, 0xE896, 0xE897,
+    0xFFFF, 0xFFFF, 0x9668, 0xFB7E, 0xFB80, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x916A, 0xFB82, 0xFFFF, 0xFFFF, 0x88A2,
+    0x91C9, 0xFB83, 0xE898, 0xFFFF, 0x958D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE89B, 0xE899, 0x8D7E, 0xFFFF, 0xE89A,
+    0x8CC0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7A, 0xFFFF, 0xFFFF, 0x95C3, 0xE89D, 0xE89F, 0xE89E, 0xE8A0,
+    0xFFFF, 0xFB84, 0x8940, 0x9077, 0x8F9C, 0x8AD7, 0xE8A1, 0xFFFF, 0xFFFF, 0xFFFF, 0x9486, 0xFFFF, 0xE8A3, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8941, 0xFFFF, 0xE8A2, 0x92C2, 0xFFFF, 0x97CB, 0x93A9, 0xE89C, 0x97A4, 0xFFFF, 0x8CAF, 0xFFFF, 0xFFFF, 0x977A, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFB86, 0xFFFF, 0xEF7B, 0x8BF7, 0x97B2, 0xFFFF, 0x8C47, 0xFFFF, 0x91E0, 0xE440, 0xFFFF, 0xE8A4, 0x8A4B, 0x908F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8A75, 0xE8A6, 0xFFFF, 0xE8A7, 0xE8A5, 0x8C84, 0xFB88, 0x8DDB, 0x8FE1, 0xEF7D, 0xFFFF, 0xFFFF,
+    0x8942, 0xFFFF, 0xFFFF, 0x97D7, 0xEF7E, 0xEF80, 0xFFFF, 0xE8A9, 0xE7AC, 0xFB8B, 0xE8A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB8C,
+    0xE8AC, 0xE8AA, 0xE8AB, 0xFB8D, 0xE8AD, 0xFFFF, 0xE8AE, 0x97EA, 0xE8AF, 0xE8B0, 0xFB8E, 0x90C7, 0x94B9, 0xFB8F, 0xFFFF, 0xFFFF,
+    0x909D, 0x8AE5, 0xFFFF, 0xFFFF, 0x9759, 0x89EB, 0x8F57, 0x8CD9, 0xFFFF, 0xE8B3, 0xFFFF, 0xE8B2, 0x8E93, 0xE8B4, 0xE8B1, 0xFFFF,
+    0xFFFF, 0x8E47, 0xEF81, 0xFFFF, 0xFFFF, 0xE8B8, 0xE5AB, 0xFFFF, 0xFB92, 0x99D4, 0xFB93, 0x9097, 0xE8B6, 0xFB94, 0xEF82, 0xFFFF,
+    0xFFFF, 0xFFFF, 0x97A3, 0x93EF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x894A, 0xEF84, 0x90E1, 0x8EB4, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF85,
+    0x95B5, 0xFFFF, 0x895F, 0xFFFF, 0xFFFF, 0xFFFF, 0x97EB, 0x978B, 0xFFFF, 0xE8B9, 0xFFFF, 0x9364, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+97xx */
+    0x8EF9, 0xFFFF, 0xFFFF, 0xFFFF, 0xE8BA, 0xFFFF, 0xE8BB, 0x906B, 0xE8BC, 0xFFFF, 0x97EC, 0xFFFF, 0xFFFF, 0xE8B7, 0xE8BE, 0xE8C0,
+    0xFFFF, 0xE8BF, 0xFFFF, 0xE8BD, 0xFB96, 0xFFFF, 0xE8C1, 0xFFFF, 0xFFFF, 0xE8C2, 0xFFFF, 0xFFFF, 0x919A, 0xFFFF, 0x89E0, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFB97, 0xE8C3, 0xFFFF, 0xFFFF, 0x96B6, 0xFFFF, 0xFFFF, 0xE8C4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE8C5, 0xFFFF, 0x9849, 0xEF86, 0xFFFF, 0xFFFF, 0xFB99, 0xFFFF, 0x9E50, 0xE8C6, 0xFFFF, 0xEF87, 0xFFFF, 0xE8C7, 0xE8C8, 0xFFFF,
+    0xFFFF, 0xFB9A, 0xE8CC, 0xFFFF, 0xE8C9, 0xFFFF, 0xE8CA, 0xFB9B, 0xE8CB, 0xE8CD, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF88, 0xEF89, 0xEF8A,
+    0xFFFF, 0xFFFF, 0x90C2, 0xFFFF, 0xFFFF, 0xFB9C, 0x96F5, 0xFB9D, 0xFFFF, 0x90C3, 0xEF8B, 0xFB9E, 0xE8CE, 0xFFFF, 0x94F1, 0xFFFF,
+    0xE8CF, 0xEA72, 0x96CA, 0xFFFF, 0xE8D0, 0xFFFF, 0xE8D1, 0xFFFF, 0xE8D2, 0x8A76, 0xFB9F, 0xE8D4, 0xFFFF, 0x9078, 0xEF8C, 0xFFFF,
+    0xFFFF, 0xE8D5, 0xFFFF, 0xEF8D, 0x8C43, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE8D6, 0xE8DA, 0xFFFF, 0xE8D8, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE8D9, 0xFFFF, 0xFFFF, 0x8A93, 0xE8D7, 0xE8DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE8DC, 0xFFFF, 0x88C6, 0xFFFF, 0xE8DD,
+    0xE8DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF8E, 0xFBA2, 0xFFFF, 0x8FE2, 0xFFFF, 0xFBA3, 0xFFFF, 0xE8DF, 0xFFFF, 0xFBA4, 0xFFFF,
+    0x8B66, 0xFFFF, 0xFBA5, 0xE8E2, 0xFFFF, 0xFFFF, 0xE8E1, 0xFFFF, 0xE8E0, 0xFFFF, 0xFFFF, 0xE691, 0xFFFF, 0x95DA, 0xEF8F, 0xFFFF,
+    0xFFFF, 0xFBA6, 0xFBA7, 0xE8E3, 0xE8E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBA8, 0xFFFF,
+    0xFFFF, 0xEF91, 0xFFFF, 0xE8E5, 0xFFFF, 0xFFFF, 0xE8E6, 0xFFFF, 0xE8E7, 0xEF92, 0xFFFF, 0xE8E8, 0xFBA9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFBAA, 0xFFFF, 0x8AD8, 0xFBAB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBAC, 0xFBAD, 0xFFFF, 0xEF94, 0xE8E9, 0xFFFF, 0xEF93, 0xFFFF,
+    0xFFFF, 0xFBAE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE8EA, 0x9442, 0xFFFF,
+    0xFFFF, 0xFBAF, 0xE8EC, 0x89B9, 0xEF95, 0xE8EF, 0xE8EE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8943, 0xFFFF, 0xFFFF, 0xFFFF, 0x8BBF,
+  },
+  { /* U+98xx */
+    0xFFFF, 0x95C5, 0x92B8, 0x8DA0, 0xFBB0, 0x8D80, 0x8F87, 0xFFFF, 0x907B, 0xFFFF, 0xEF97, 0xFFFF, 0xE8F1, 0xFBB1, 0xFBB2, 0xE8F0,
+    0x9761, 0x8AE6, 0x94D0, 0x93DA, 0xFBB3, 0xFFFF, 0xFBB4, 0x909C, 0x97CC, 0xFFFF, 0x8C7A, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF98, 0xFFFF,
+    0xFFFF, 0xE8F4, 0xFFFF, 0xFBB7, 0xE8F3, 0xFBBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF99, 0x966A, 0x93AA, 0xFFFF, 0xFFFF,
+    0xEF9A, 0xFFFF, 0xFBB8, 0xFBB9, 0x896F, 0xFFFF, 0xFFFF, 0xE8F5, 0xE8F2, 0xFFFF, 0xFFFF, 0x9570, 0x978A, 0xE8F6, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE8F7, 0xFBBB, 0xFFFF, 0xFFFF, 0xFFFF, 0xE8F9, 0x91E8, 0x8A7A, 0x8A7B, 0xE8F8,
+    0xFFFF, 0xFFFF, 0xEF9C, 0xEF9D, 0x8AE7, 0x8CB0, 0xEF9E, 0xEF9F, 0x8AE8, 0xEFA0, 0xEFA1, 0x935E, 0xFFFF, 0xFFFF, 0x97DE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFA3, 0xFBBC, 0x8CDA, 0xFFFF, 0xFFFF, 0xFFFF, 0xE8FA, 0xEFA4, 0xFFFF, 0xFFFF, 0xE8FB,
+    0xE8FC, 0xE940, 0xFFFF, 0xE942, 0xE941, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9597, 0xFFFF, 0xE943, 0xFBBD, 0xFFFF, 0xFBBE, 0xFFFF, 0xE944,
+    0xFBBF, 0xE945, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE946, 0xFBC1, 0xFBC2, 0xFFFF, 0xEFA5, 0xFBC3, 0xFBC4, 0xFFFF, 0xFFFF, 0xFBC5,
+    0xFFFF, 0xFFFF, 0xFBC6, 0xE948, 0xE947, 0xFFFF, 0xE949, 0xFBC7, 0xEFA6, 0xFFFF, 0xFFFF, 0xFBC8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x94F2, 0xE3CA, 0xFFFF, 0xFFFF, 0x9048,
+    0xFBC9, 0xFBCB, 0x8B51, 0xFBCC, 0xFFFF, 0xFBCD, 0xFFFF, 0xEFA7, 0xFFFF, 0xE94A, 0xFBCE, 0xE94B, 0xFFFF, 0x99AA, 0x9F5A, 0x94D1,
+    0xFBCF, 0xFBD0, 0x88F9, 0xFBD1, 0x88B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8E94, 0x964F, 0x8FFC, 0xFFFF,
+  },
+  { /* U+99xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE94C, 0xFFFF, 0x96DD, 0xFFFF, 0xFFFF, 0xFBD2, 0xE94D, 0x977B, 0xFFFF, 0x8961, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x8E60, 0xFFFF, 0xE94E, 0x89EC, 0xE94F, 0xFFFF, 0xFBD5, 0xFBD6, 0xE950, 0xFFFF, 0xFBD8, 0xFBD9, 0xFBDA, 0xE952, 0xE953, 0xFFFF,
+    0xE955, 0xE951, 0xFFFF, 0xFFFF, 0xE954, 0xFFFF, 0xFFFF, 0xFFFF, 0x8AD9, 0xFFFF, 0xFFFF, 0xFFFF, 0xE956, 0xFFFF, 0xE957, 0xFFFF,
+    0xFFFF, 0xFBDC, 0xFBDD, 0xFBDE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBDF, 0xFBE0, 0xFBE1, 0xE958, 0xE959, 0xFFFF,
+    0xFBE2, 0xFBE3, 0xE95A, 0xFFFF, 0xFFFF, 0xE95C, 0xFBE4, 0xFFFF, 0xFFFF, 0xE95B, 0xFFFF, 0xE95E, 0xE961, 0xFBE5, 0xFBE6, 0xFFFF,
+    0xE95D, 0xE95F, 0xE960, 0xFFFF, 0xFFFF, 0xE962, 0xFFFF, 0x8BC0, 0xEFA8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBE7, 0xFFFF, 0xFFFF, 0xFBE8,
+    0xFBE9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8EF1, 0xE963, 0xE964, 0x8D81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFA9, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFBEA, 0xFFFF, 0xE965, 0xFBEB, 0xFFFF, 0x8A5D, 0xFFFF, 0xFFFF, 0xFFFF, 0x946E, 0xE966, 0xE967, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x9279, 0x93E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBEC, 0xFFFF, 0xFFFF, 0xE968, 0xFBED, 0xFFFF, 0xFBEE,
+    0xFFFF, 0x949D, 0xFFFF, 0xFBEF, 0x91CA, 0x8977, 0x8BEC, 0xFFFF, 0x8BED, 0xFBF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x9293, 0xE96D, 0x8BEE, 0xFFFF, 0xFBF1, 0x89ED, 0xFFFF, 0xFFFF, 0xE96C, 0xFBF2, 0xFFFF, 0xE96A, 0xFFFF, 0xE96B, 0xFBF3, 0xE969,
+    0xFFFF, 0xFFFF, 0xE977, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE96E, 0xE96F, 0xFFFF,
+    0xFBF5, 0xE970, 0xE971, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE973, 0xFBF6, 0xFFFF, 0xE972, 0xFBF7, 0xFFFF, 0xFFFF, 0x8F78,
+  },
+  { /* U+9Axx */
+    0xFFFF, 0xE974, 0xEFAA, 0xEFAB, 0xFFFF, 0xE976, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBF8, 0xFFFF, 0xFFFF, 0xFFFF, 0x8B52, 0xE975,
+    0xFFFF, 0xFBF9, 0x919B, 0x8CB1, 0xFFFF, 0xFFFF, 0xFBFA, 0xFFFF, 0xFFFF, 0xE978, 0xFBFB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFBFC, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFAC, 0xFFFF, 0xFFFF, 0xFFFF, 0x91CB, 0xFFFF, 0xFFFF, 0xE979, 0xFFFF, 0xEFAD, 0xEFAE, 0xFFFF,
+    0x93AB, 0xFC40, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC41, 0xE97A, 0xEFAF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE980, 0xFFFF,
+    0xE97D, 0xFFFF, 0xE97C, 0xE97E, 0xFC42, 0xE97B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFB0, 0xFFFF, 0xFC43, 0xE982, 0xEFB1, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xEFB2, 0xFFFF, 0xFFFF, 0xE981, 0xFFFF, 0xE984, 0xFC44, 0xFFFF, 0x8BC1, 0xE983, 0xFFFF, 0xFFFF, 0xFFFF, 0xE985,
+    0xFFFF, 0xFFFF, 0xE986, 0xFFFF, 0xE988, 0xE987, 0xFFFF, 0xFFFF, 0xFFFF, 0xE989, 0xE98B, 0xE98A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D9C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE98C, 0xFFFF, 0xFC46,
+    0xE98D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFB3, 0xFC48, 0x8A5B, 0xFC4A, 0xFFFF, 0xFFFF, 0xE98E, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE98F, 0xEFB4, 0xFFFF, 0xEFB5, 0x9091, 0xFFFF, 0xFC4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFB6, 0xE990,
+    0xFC4D, 0xE991, 0xFC4E, 0xE992, 0xE993, 0xFC4F, 0xEFB7, 0xFFFF, 0x8D82, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC51, 0xFFFF, 0xE994, 0xE995,
+    0xFC52, 0xFFFF, 0xE996, 0xE997, 0xFFFF, 0xFC53, 0xE998, 0xFFFF, 0xFFFF, 0xFC54, 0x94AF, 0xE99A, 0xFFFF, 0x9545, 0xE99B, 0xE999,
+    0xFFFF, 0xE99D, 0xFFFF, 0xFFFF, 0xE99C, 0xFFFF, 0xFFFF, 0xE99E, 0xFFFF, 0xEFB8, 0xFFFF, 0xE99F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Bxx */
+    0xFFFF, 0xFFFF, 0xEFB9, 0xFC55, 0xFFFF, 0xFFFF, 0xE9A0, 0xFFFF, 0xEFBA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC56, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFC57, 0xFFFF, 0xFC58, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC59, 0xFFFF, 0xE9A1, 0xFFFF, 0xE9A2, 0xFFFF, 0xFC5A, 0xFFFF, 0xFFFF, 0xE9A3,
+    0xEFBB, 0xFFFF, 0xE9A4, 0xE9A5, 0xFFFF, 0xE9A6, 0xFFFF, 0xE9A7, 0xE9A8, 0xE9A9, 0xE9AA, 0xFC5B, 0xFFFF, 0xEFBD, 0xE9AB, 0xE9AC,
+    0xFFFF, 0x9F54, 0xE9AD, 0xFC5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE2F6, 0x8B53, 0xFC5D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x8A40, 0x8DB0, 0xE9AF, 0xE9AE, 0x96A3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC5F, 0xFFFF, 0xE9B1, 0xE9B2, 0xE9B0,
+    0xFFFF, 0xE9B3, 0xFFFF, 0xFFFF, 0x9682, 0xFFFF, 0xFFFF, 0xFFFF, 0xE9B4, 0xFFFF, 0x8B9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFBE, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFC60, 0xFFFF, 0xFC61, 0xEFC0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC62, 0xFC63, 0xFFFF, 0xFFFF, 0x9844,
+    0xFFFF, 0xFFFF, 0xEFC1, 0xFC64, 0xE9B5, 0xEFC2, 0xFC65, 0xFC66, 0xFFFF, 0xEFBF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE9B7, 0xEFC3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFC4, 0xFFFF, 0xFFFF, 0xFFFF, 0x88BC, 0xEFC5,
+    0xFFFF, 0xE9B8, 0x95A9, 0xE9B6, 0xFFFF, 0xFFFF, 0xE9B9, 0xE9BA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFC6, 0xE9BB,
+    0xE9BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC67, 0xEFC7, 0xE9BD, 0xFFFF, 0x968E, 0x8E4C, 0xFC68, 0x8DF8, 0x914E, 0xFFFF,
+    0xFFFF, 0xFC69, 0xFC6C, 0xFFFF, 0xE9BE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC6D, 0xE9C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC6E, 0xFFFF,
+    0xE9BF, 0xEFC8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xE9C2, 0xFC6F, 0xFFFF, 0x8CEF, 0xE9C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFC9, 0xE9C3,
+    0xFFFF, 0xE9C4, 0xE9C5, 0xFFFF, 0xE9C9, 0xFFFF, 0x8E49, 0xFFFF, 0xFC71, 0xFFFF, 0xFFFF, 0x91E2, 0xFFFF, 0xFC72, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE9CA, 0xE9C7, 0xE9C6, 0xE9C8, 0xEFCA, 0xFFFF, 0xFC73, 0x8C7E, 0xFFFF, 0xFC74, 0xFC75, 0xFFFF, 0xFFFF, 0xFC77, 0xFC76,
+    0xE9CE, 0xE9CD, 0xE9CC, 0xFC70, 0xFFFF, 0x88B1, 0xFFFF, 0xFC7B, 0xEFCB, 0xFFFF, 0xFC79, 0xFFFF, 0xFFFF, 0xEFCC, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Cxx */
+    0xEFCD, 0xFFFF, 0xFFFF, 0xFFFF, 0xE9D8, 0xFFFF, 0xE9D4, 0xFFFF, 0xE9D5, 0xE9D1, 0xE9D7, 0xFFFF, 0xE9D3, 0x8A82, 0xFFFF, 0xFFFF,
+    0x986B, 0xFFFF, 0xE9D6, 0xE9D2, 0xE9D0, 0xE9CF, 0xFC7D, 0xFFFF, 0xFC7E, 0xFC80, 0xFC81, 0xE9DA, 0xFFFF, 0xFC82, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xE9DD, 0xFC83, 0xEFCE, 0xE9DC, 0xE9DB, 0xFFFF, 0xFC84, 0xFFFF, 0xFC85, 0xFC86, 0xFFFF, 0xFFFF, 0x9568, 0xE9D9, 0x88F1,
+    0xE9DE, 0xFC88, 0xE9E0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC89, 0xFC8A, 0xFFFF, 0x8A8F, 0xE9CB, 0x8956, 0xFFFF, 0xFFFF, 0xE9E2, 0xFFFF,
+    0xFFFF, 0xEFCF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC8B, 0xE9E1, 0xE9DF, 0x924C, 0xFC8E, 0xFC8F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFD0,
+    0xEFD1, 0xFFFF, 0x9690, 0xEFD2, 0xFC91, 0xFFFF, 0xFFFF, 0x97D8, 0xFC92, 0xFFFF, 0xE9E3, 0xFC93, 0xFC8C, 0xFC94, 0xFFFF, 0xFC95,
+    0xE9E4, 0xFFFF, 0xFFFF, 0xEFD3, 0xFFFF, 0xEFD4, 0xFFFF, 0xE9E5, 0xFFFF, 0xFC96, 0xFC97, 0xFC98, 0xFFFF, 0xFC99, 0xFC9A, 0xFFFF,
+    0xFC9B, 0xFFFF, 0xFC9C, 0xFFFF, 0xFFFF, 0xFC9D, 0xE9E6, 0xEFD5, 0xE9E7, 0xFFFF, 0xFC9E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x92B9, 0xFC9F, 0xE9E8, 0xFFFF, 0x94B5, 0xFFFF, 0xE9ED, 0xE9E9, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xE9EA, 0xFFFF, 0xFCA0, 0x9650, 0x96C2, 0xFFFF, 0x93CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Dxx */
+    0xFFFF, 0xFFFF, 0xFCA2, 0xE9EE, 0xFFFF, 0xFFFF, 0xE9EF, 0x93BC, 0xE9EC, 0xE9EB, 0xFFFF, 0xFCA1, 0xFFFF, 0xFFFF, 0x89A8, 0xFFFF,
+    0xFFFF, 0xFCA4, 0xE9F7, 0xFFFF, 0xFFFF, 0xE9F6, 0xFFFF, 0xFCA5, 0xFCA6, 0xFFFF, 0xFFFF, 0x8995, 0xFFFF, 0xEFD6, 0xEFD7, 0xE9F4,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xE9F3, 0xFFFF, 0xFFFF, 0xE9F1, 0xFFFF, 0x8A9B, 0xFFFF, 0xE9F0, 0x8EB0, 0x89A7, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFCAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8D83, 0xFFFF, 0xFFFF, 0xE9FA, 0xE9F9,
+    0xFFFF, 0xE9F8, 0xFCAC, 0xEFD8, 0xE9F5, 0xFFFF, 0xE9FB, 0xEFD9, 0xE9FC, 0xFFFF, 0xFCAD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEA44, 0xEA43, 0xEFDA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA45, 0xFFFF, 0xFFFF, 0x894C, 0xEA40, 0xEA41, 0xFCAE,
+    0x8D94, 0x96B7, 0xFCAF, 0xEFDB, 0xEA42, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB1, 0xFFFF, 0xFCB2, 0x9651, 0xFFFF, 0xFFFF, 0xEA4A,
+    0xEFDC, 0xFFFF, 0xEA46, 0xFCB4, 0xFFFF, 0xFFFF, 0xFCB5, 0xFCB6, 0xFFFF, 0xFFFF, 0xEA4B, 0xFFFF, 0xEFDD, 0xFFFF, 0xFCB7, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB8, 0xFFFF, 0xFFFF, 0xEA48, 0xFFFF, 0xEA47, 0xEFDE, 0xFFFF, 0xFFFF, 0xFCB9, 0xFFFF, 0x8C7B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFDF, 0xFFFF, 0xFFFF, 0xFCBA, 0xEA4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFCBB, 0xFFFF, 0xFFFF, 0xEA4D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA4E, 0xFFFF, 0xEA49, 0xEFE1, 0xFFFF, 0xFFFF, 0xE9F2,
+    0xFFFF, 0xFFFF, 0xEA4F, 0xFFFF, 0x92DF, 0xFCBD, 0xFFFF, 0xFFFF, 0xEA53, 0xFCBE, 0xEA54, 0xEA52, 0xEFE2, 0xFCBF, 0xFFFF, 0xFCBC,
+    0xEFE0, 0xEA51, 0xEA57, 0xFCC0, 0xEA50, 0xFFFF, 0xEA55, 0xFCC1, 0xFFFF, 0xFCC2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA56,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xEA59, 0xFFFF, 0xFFFF, 0xFCC3, 0xEFE3, 0xFFFF, 0xEA58, 0xFCC4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCC5,
+    0xFCC6, 0xFFFF, 0xFFFF, 0xFCC7, 0xFFFF, 0xFFFF, 0xEA5B, 0xEFE5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA5C, 0xFFFF, 0xEA5D,
+    0xFFFF, 0xFFFF, 0x9868, 0xFFFF, 0xFCC8, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA5A, 0x91E9, 0x8DEB, 0xFFFF, 0xFFFF, 0xEA5E, 0xFFFF, 0xFFFF,
+  },
+  { /* U+9Exx */
+    0xFFFF, 0xFFFF, 0xFCCB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFE6, 0xFFFF, 0xFFFF, 0xFCCA, 0xFFFF, 0xFFFF, 0xFCCC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFE7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCCD, 0xEA5F, 0xEA60, 0xFCCE, 0xFCCF, 0xEA61, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA62, 0xFFFF, 0xFFFF, 0x8CB2, 0xEA63, 0xFFFF, 0xFCD0, 0xEFE8, 0xEA64, 0xFFFF, 0x8EAD,
+    0xFCD2, 0xEA65, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCD3, 0xFFFF, 0xFFFF, 0xEA66, 0xFFFF, 0xFFFF, 0xEA67, 0xEA68, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEA6B, 0xEA69, 0x985B, 0xFFFF, 0xEA6A, 0xFFFF, 0x97ED, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCD4, 0xFFFF, 0xEA6C, 0xEFE9, 0x97D9,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFEA, 0xEA6D, 0x949E, 0xFFFF, 0xFCD5, 0xEA6E, 0xEA70, 0xFFFF, 0xEFEB, 0xEA71, 0xFFFF, 0xEFEC,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFED, 0xEFEE, 0xFFFF, 0xFFFF, 0xEA6F, 0x8D8D, 0x96CB, 0x9683, 0x9BF5, 0xFCD7, 0x9F80, 0x969B,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xEFEF, 0x89A9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA73, 0x8B6F, 0xEA74, 0xEA75,
+    0xEA76, 0xEFF0, 0x8D95, 0xFFFF, 0xEA77, 0xFFFF, 0xFFFF, 0xFFFF, 0xE0D2, 0x96D9, 0xFFFF, 0x91E1, 0xEA78, 0xEA7A, 0xEA79, 0xFCD9,
+    0xEA7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA7C, 0xFFFF, 0xFCDA, 0xEA7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCDB, 0xEA7E,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA80, 0xFFFF, 0xEA81, 0xEA82, 0xFFFF, 0xEA83, 0xFFFF, 0xEA84, 0xEA85, 0xEA86, 0xFFFF, 0xFCDC,
+  },
+  { /* U+9Fxx */
+    0xFFFF, 0xFFFF, 0xFCDD, 0xFCDF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA87, 0xEA88, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9343, 0xFFFF,
+    0xEFF1, 0xFFFF, 0xFFFF, 0x8CDB, 0xFFFF, 0xEA8A, 0xFFFF, 0xFCE0, 0xFFFF, 0xFCE1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x916C, 0xEA8B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA8C, 0xFFFF, 0xFFFF, 0xFCE2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCE3, 0xFFFF, 0xEFF2, 0xFCE4, 0x9540, 0xFFFF, 0xFCE5, 0xEA8D, 0xFFFF,
+    0xFFFF, 0xFCE6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCE7, 0xFCE8, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA8E, 0xE256, 0xFFFF, 0xFFFF, 0xE6D8, 0xE8EB,
+    0xFFFF, 0xFFFF, 0xEA8F, 0xFCE9, 0xEA90, 0xFCEA, 0xFFFF, 0xEFF3, 0xFCEB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCED, 0xFFFF, 0xEA92,
+    0xEA93, 0xEA94, 0x97EE, 0xEA91, 0xFFFF, 0xFFFF, 0xEA95, 0xEA96, 0xFFFF, 0xFCEF, 0xEA98, 0xFFFF, 0xEA97, 0xFCF1, 0xFFFF, 0xFFFF,
+    0xFCF2, 0xFFFF, 0xEA9A, 0xFFFF, 0xFFFF, 0xFCF3, 0xEA9B, 0xEA99, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x97B4, 0xFFFF, 0xFFFF,
+    0xEFF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xEFF5, 0xEA9C, 0xFFFF, 0xEFF6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEA9D, 0xE273, 0xFFFF, 0xFFFF,
+    0xEA9E, 0xFFFF, 0xEFF7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+F9xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBB9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEAAC, 0xEB6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE6E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEBC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEFA2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEF7C, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+FAxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x886A,
+    0x8876, 0x9892, 0xFFFF, 0xF3F7, 0xEB9A, 0xEC79, 0xEC8F, 0xFFFF, 0xFFFF, 0xED5B, 0xED5C, 0xED60, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE59,
+    0xF957, 0xF964, 0xEEAC, 0xFFFF, 0xFA8E, 0xFFFF, 0xEEE8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0x87B6, 0x87C7, 0x87CE, 0x87E1, 0x87E6, 0x87EC, 0x884B, 0x884E, 0x8855, 0x8879, 0x887D, 0x9881, 0x9882, 0xEACE, 0xEADA, 0xEADC,
+    0xEADF, 0xEB47, 0xEB4A, 0xEB62, 0xEB85, 0xEBE7, 0xEBF5, 0xEC44, 0xEC74, 0xF5A7, 0xECA3, 0xED46, 0xED52, 0xED53, 0xED56, 0xED57,
+    0xED58, 0xED5A, 0xED5E, 0xED5F, 0xED6C, 0xED70, 0xED84, 0xEDAC, 0xF7CE, 0xEDB1, 0xEDB8, 0xEDC2, 0xEDD6, 0xF894, 0xF895, 0xEE46,
+    0xEE8F, 0xEE99, 0xEEAD, 0xEEAE, 0xEEB6, 0xEEBB, 0xFA89, 0xEED7, 0xEF83, 0xEF96, 0xEF9B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+FExx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x825D, 0x825C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+FFxx */
+    0xFFFF, 0x8149, 0x81AE, 0x8194, 0x8190, 0x8193, 0x8195, 0x81AD, 0x8169, 0x816A, 0x8196, 0x817B, 0x8143, 0x81AF, 0x8144, 0x815E,
+    0x824F, 0x8250, 0x8251, 0x8252, 0x8253, 0x8254, 0x8255, 0x8256, 0x8257, 0x8258, 0x8146, 0x8147, 0x8183, 0x8181, 0x8184, 0x8148,
+    0x8197, 0x8260, 0x8261, 0x8262, 0x8263, 0x8264, 0x8265, 0x8266, 0x8267, 0x8268, 0x8269, 0x826A, 0x826B, 0x826C, 0x826D, 0x826E,
+    0x826F, 0x8270, 0x8271, 0x8272, 0x8273, 0x8274, 0x8275, 0x8276, 0x8277, 0x8278, 0x8279, 0x816D, 0xFFFF, 0x816E, 0x814F, 0x8151,
+    0x814D, 0x8281, 0x8282, 0x8283, 0x8284, 0x8285, 0x8286, 0x8287, 0x8288, 0x8289, 0x828A, 0x828B, 0x828C, 0x828D, 0x828E, 0x828F,
+    0x8290, 0x8291, 0x8292, 0x8293, 0x8294, 0x8295, 0x8296, 0x8297, 0x8298, 0x8299, 0x829A, 0x816F, 0x8162, 0x8170, 0xFFFF, 0xFFFF,
+    0xFFFF, 0x00A1, 0x00A2, 0x00A3, 0x00A4, 0x00A5, 0x00A6, 0x00A7, 0x00A8, 0x00A9, 0x00AA, 0x00AB, 0x00AC, 0x00AD, 0x00AE, 0x00AF,
+    0x00B0, 0x00B1, 0x00B2, 0x00B3, 0x00B4, 0x00B5, 0x00B6, 0x00B7, 0x00B8, 0x00B9, 0x00BA, 0x00BB, 0x00BC, 0x00BD, 0x00BE, 0x00BF,
+    0x00C0, 0x00C1, 0x00C2, 0x00C3, 0x00C4, 0x00C5, 0x00C6, 0x00C7, 0x00C8, 0x00C9, 0x00CA, 0x00CB, 0x00CC, 0x00CD, 0x00CE, 0x00CF,
+    0x00D0, 0x00D1, 0x00D2, 0x00D3, 0x00D4, 0x00D5, 0x00D6, 0x00D7, 0x00D8, 0x00D9, 0x00DA, 0x00DB, 0x00DC, 0x00DD, 0x00DE, 0x00DF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0x8150, 0xFFFF, 0x818F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+200xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x87A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF040, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF04A, 0xFFFF, 0xF04D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+201xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF055, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+202xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF065, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+203xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF090, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF099, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF097, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF141, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+204xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF144, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+205xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF146, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF150, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+206xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF151, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+207xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF157,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+208xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF15E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF160, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF169, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+209xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF171, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF172, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+20Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF178, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+20Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF17B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9873,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+20Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF197, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF1A8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+20Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1B0, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1AF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+20Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1BB,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+212xx */
+    0xFFFF, 0xF1D7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x8861, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1E8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1F0, 0xFFFF, 0xFFFF,
+  },
+  { /* U+213xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x886B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1F2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF1F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF244, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+214xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF251, 0x8880, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+215xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF25D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+216xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF266, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x9883, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+217xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF274, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF275, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+218xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0x889B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+219xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF29E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+21Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0AE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+21Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0B5, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0B6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF0B9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF0C3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0BE, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF0BD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF0C8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+21Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF0C9, 0x988E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+21Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0D9, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0E4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF0EA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+221xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+222xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCD1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+223xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2A9, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2AE, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+226xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF2CE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+228xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2E3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2EB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+229xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF2F0,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+22Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF343, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+22Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF351, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF348,
+    0xF349, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF354, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+22Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF353, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF358, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+22Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF375, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+231xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF39D, 0xEB59, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+233xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF3B8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF3C0, 0xFFFF, 0xF3BB, 0xF3BA, 0xFFFF, 0xF3C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3C5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3C7,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3C1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+234xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3D3, 0xF3D5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF3D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+235xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF3F6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF449, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEB92, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+236xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF461, 0xF45E, 0xF462, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF45F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+237xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF478, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF46D, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBA7,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xEBB0, 0xF481, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF48A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF489,
+  },
+  { /* U+238xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF490, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF495, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+23Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+23Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4B2,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEBDE, 0xFFFF,
+  },
+  { /* U+23Dxx */
+    0xF4C7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7F3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF4DA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF4DE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF4DD, 0xF4DC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+23Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF551, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+240xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF566, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+241xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF56C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF581, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF584, 0xFFFF,
+  },
+  { /* U+243xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5A0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+246xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5B1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5B7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+247xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xEC8C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+248xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5D1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+24Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF5F9, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+24Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF64D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF64F,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+24Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF654, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+24Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF663, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+24Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF67C, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF681, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF686, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF689, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+250xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF695, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF697, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+251xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF69A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF69F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6A2, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6A1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+252xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6A6, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6AA, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+254xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6BB, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xECFC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6C6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+255xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED48, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6D9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+257xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xED66, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF6F4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+259xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xED73, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF751, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+25Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF75D, 0xF75C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF75F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+25Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF771, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+25Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF77D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+25Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xED8E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+25Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF793, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF794, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF797, 0xFFFF, 0xFFFF, 0xF795, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF79D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF79B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7A0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+25Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF7A2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7A5, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7AD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF7AC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7B3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+260xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7B2, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7BB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF7C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7CD, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+262xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF7E7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7E9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+263xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF7F0, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+264xx */
+    0xFFFF, 0xFFFF, 0xF7F7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+266xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF854, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF859, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+267xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF865, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+268xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF875, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF877, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+269xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF879, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF87C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF87E, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+26Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF883, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF88A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF890, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF893, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEDDB,
+  },
+  { /* U+26Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF263, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF8C2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8CC, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+26Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEE52, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8DB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+26Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF8F3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF940, 0xF941, 0xF8FC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+270xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE68, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+271xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF952, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF955, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+273xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF985, 0xF984, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF98B, 0xFFFF,
+  },
+  { /* U+274xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xF98E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF993, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+276xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9A8, 0xF9A7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xF9AA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEE8C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF9B2, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+277xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9BA, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF9BC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xF9C0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+279xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9D4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+27Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9E1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+27Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xF9F5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9F7, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xF9F8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+27Cxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA44, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+27Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFA4E, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+27Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFA51, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+27Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA58, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+280xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA61, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA67, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+282xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEEC7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFA78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFA7D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+283xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xEECF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+284xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA86, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA8B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+285xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA9A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFA9E, 0xFA9F, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+286xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAAA, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAAD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+289xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFACE, 0xFFFF, 0xFFFF, 0xFACD, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAD5, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAE3, 0xFAE4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAEF, 0xFAF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+28Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFAFC, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB40, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFB4C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFB4B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB55, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB56, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB5D, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB5C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+28Bxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFB6D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB6E,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+28Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFB76, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFB79, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB7B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+28Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB7C,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB81, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB85, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB87, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+28Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFB89, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFB91, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+292xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFBA0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFBA1, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+294xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFBB6, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+295xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBC0,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+296xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBCA,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFBD4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+297xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBD7, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFBDB, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+298xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFBF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+29Axx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFC4B, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+29Dxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC6A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+29Exx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC78, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC6B, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC7C, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC7A, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC87, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC90, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFC8D, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+29Fxx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCA3, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+2A0xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCA9, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCA7,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFCB3, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCB0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+2A1xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xEFE4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+2A3xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCD6, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+2A4xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCD8, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+2A5xx */
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFCEC, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+  { /* U+2A6xx */
+    0xFFFF, 0xFFFF, 0xFCEE, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFCF0, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFCF4, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+    0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF, 0xFFFF,
+  },
+};
+
+/* 合成の基底: 単独のコードと、直後の結合文字 comb[i] と合わせたコード with[i] (0 = 無し) */
+typedef struct { uint16_t sjis; uint16_t comb[2]; uint16_t with[2]; } sj2004_base_t;
+SJ2004_TABLE_CONST sj2004_base_t SJ2004_BASES[21] = {
+  { 0x857B, { 0x0300, 0x0000 }, { 0x8663, 0x0000 } },
+  { 0x8657, { 0x0300, 0x0301 }, { 0x8667, 0x8668 } },
+  { 0x864F, { 0x0300, 0x0301 }, { 0x866B, 0x866C } },
+  { 0x8662, { 0x0300, 0x0301 }, { 0x866D, 0x866E } },
+  { 0x8656, { 0x0300, 0x0301 }, { 0x8669, 0x866A } },
+  { 0x8680, { 0x02E9, 0x0000 }, { 0x8686, 0x0000 } },
+  { 0x8684, { 0x02E5, 0x0000 }, { 0x8685, 0x0000 } },
+  { 0x82A9, { 0x309A, 0x0000 }, { 0x82F5, 0x0000 } },
+  { 0x82AB, { 0x309A, 0x0000 }, { 0x82F6, 0x0000 } },
+  { 0x82AD, { 0x309A, 0x0000 }, { 0x82F7, 0x0000 } },
+  { 0x82AF, { 0x309A, 0x0000 }, { 0x82F8, 0x0000 } },
+  { 0x82B1, { 0x309A, 0x0000 }, { 0x82F9, 0x0000 } },
+  { 0x834A, { 0x309A, 0x0000 }, { 0x8397, 0x0000 } },
+  { 0x834C, { 0x309A, 0x0000 }, { 0x8398, 0x0000 } },
+  { 0x834E, { 0x309A, 0x0000 }, { 0x8399, 0x0000 } },
+  { 0x8350, { 0x309A, 0x0000 }, { 0x839A, 0x0000 } },
+  { 0x8352, { 0x309A, 0x0000 }, { 0x839B, 0x0000 } },
+  { 0x835A, { 0x309A, 0x0000 }, { 0x839C, 0x0000 } },
+  { 0x8363, { 0x309A, 0x0000 }, { 0x839D, 0x0000 } },
+  { 0x8367, { 0x309A, 0x0000 }, { 0x839E, 0x0000 } },
+  { 0x83F3, { 0x309A, 0x0000 }, { 0x83F6, 0x0000 } },
+};
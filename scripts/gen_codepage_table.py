@@ -0,0 +1,332 @@
+#!/usr/bin/env python3
+"""
+Generate include/codepage_table.h from Microsoft vendor mapping files (CPxxxx.TXT)
+and include/ebcdic_table.h for the Japanese EBCDIC host code pages (IBM930 / IBM939).
+
+- ダウンロード先: unicode.org (MAPPINGS/VENDORS/MICSFT/WINDOWS/CPxxxx.TXT)
+- EBCDIC       : unicode.org に表が無いので、IBMxxx.TXT (同じ形式。2 byte は SO/SI の間の
+                 コード) を --input-dir に置くか、無ければ実行環境の iconv (glibc の
+                 gconv IBM930 / IBM939 = IBM CDRA の表) に全てのコードを通して作る
+- 出力先       : include/codepage_table.h / include/ebcdic_table.h
+  コードページごとに (CPxxxx_ を前に付けて):
+  * SB2U            : 1 byte → Unicode (lead byte と未定義は CP_NOMAP)
+  * LEAD2ROW        : lead byte の分類。0 = 1 byte の文字、それ以外は DB2U の行
+  * DB2U            : 行ごとの trail → Unicode (行 0 は番兵)
+  * U2CP_PAGE / U2CP: BMP の上位 8 bit → ページ / ページ内 → コード (2 byte は lead << 8 | trail)
+  * TABLE           : 上の表をまとめた cp_table_t (src/codepage.c が引く)
+  1 byte だけのコードページ (CP1250–1258) は LEAD2ROW / DB2U を共有の空の表にする。
+  EBCDIC は SO/SI で 1 byte と 2 byte を切り替えるので、lead byte も SB2U に残す
+  (どちらの表を引くかは src/ebcdic.c が状態で決める)。
+  逆引きの重複は最小のコードを採る (sjis_table.h と同じ)。ただし REVERSE_OVERRIDES の
+  文字は Windows (best fit 表) / glibc / Python と同じコードにする
+  (CP950 の 十 / 卅 は 0xA2CC / 0xA2CE の数字ではなく 0xA451 / 0xA4CA の漢字)。
+  C では static const、C++ では inline constexpr (sjis_table.h と同じ)。
+
+CP932 は NEC / IBM 拡張の規則があるので gen_sjis_table.py が別に作る。
+
+実行例:
+    $ python scripts/gen_codepage_table.py
+    $ python scripts/gen_codepage_table.py --input-dir vendor/   # CPxxxx.TXT / IBMxxx.TXT を置いた場所 (ダウンロードしない)
+"""
+
+from __future__ import annotations
+from pathlib import Path
+import argparse
+import ctypes
+import ctypes.util
+import re
+import ssl
+import urllib.request
+
+CODEPAGES = ("CP936", "CP949", "CP950",
+             "CP1250", "CP1251", "CP1252", "CP1253", "CP1254",
+             "CP1255", "CP1256", "CP1257", "CP1258")
+
+EBCDIC = ("IBM930", "IBM939")                   # SO (0x0E) / SI (0x0F) で切り替える
+
+# 逆引きで最小のコードを採らない重複: {コードページ: {Unicode: コード}}
+REVERSE_OVERRIDES = {
+    "CP950": {0x5341: 0xA451, 0x5345: 0xA4CA},  # 十 / 卅 (0xA2CC / 0xA2CE は蘇州数字の位置)
+}
+
+BASE_URLS = (
+    "https://www.unicode.org/Public/MAPPINGS/VENDORS/MICSFT/WINDOWS/{}.TXT",
+    "https://ftp.unicode.org/Public/MAPPINGS/VENDORS/MICSFT/WINDOWS/{}.TXT",
+)
+
+HEADER_TEMPLATE = """\
+/* Auto‑generated by gen_codepage_table.py — DO NOT EDIT */
+#pragma once
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#  define CP_TABLE_CONST inline constexpr
+#else
+#  define CP_TABLE_CONST static const
+#endif
+
+#define CP_NOMAP  0xFFFF   /* 未定義 (順引き / 逆引きとも) */
+
+#ifndef CP_TABLE_T_DEFINED
+#define CP_TABLE_T_DEFINED
+/* 1 つのコードページの表 (codepage_table.h / ebcdic_table.h で共通) */
+typedef struct {{
+    const uint16_t* sb2u;          /* [256] 1 byte → Unicode                        */
+    const uint8_t*  lead2row;      /* [256] lead byte の分類 (0 = 1 byte、他は db2u の行) */
+    const uint16_t (*db2u)[256];   /* [行][trail] → Unicode                          */
+    const uint8_t*  u2cp_page;     /* [256] Unicode 上位 8 bit → u2cp のページ        */
+    const uint16_t (*u2cp)[256];   /* [ページ][下位 8 bit] → コード                    */
+}} cp_table_t;
+#endif
+{shared}{pages}"""
+
+SBCS_SHARED_TEMPLATE = """
+/* 1 byte だけのコードページが共有する、lead byte の無い表 */
+CP_TABLE_CONST uint8_t CP_SBCS_LEAD2ROW[256] = {{ 0 }};
+CP_TABLE_CONST uint16_t CP_SBCS_DB2U[1][256] = {{ {{
+{sbcs_db2u}
+}} }};
+"""
+
+PAGE_TEMPLATE = """
+/*----------------------------------------------------------------------
+ *  {name}
+ *--------------------------------------------------------------------*/
+CP_TABLE_CONST uint16_t {name}_SB2U[256] = {{
+{sb2u}
+}};
+{dbcs}
+CP_TABLE_CONST uint8_t {name}_U2CP_PAGE[256] = {{
+{u2c_page}
+}};
+
+CP_TABLE_CONST uint16_t {name}_U2CP[{npages}][256] = {{
+{u2c}
+}};
+
+CP_TABLE_CONST cp_table_t {name}_TABLE = {{
+    {name}_SB2U, {lead2row}, {db2u}, {name}_U2CP_PAGE, {name}_U2CP
+}};
+"""
+
+DBCS_TEMPLATE = """
+CP_TABLE_CONST uint8_t {name}_LEAD2ROW[256] = {{
+{lead2row}
+}};
+
+CP_TABLE_CONST uint16_t {name}_DB2U[{nrows}][256] = {{
+{db2u}
+}};
+"""
+
+NOMAP = 0xFFFF
+
+
+def download(urls: list[str]) -> str:
+    ctx = ssl.create_default_context()
+    ctx.check_hostname = False
+    ctx.verify_mode = ssl.CERT_NONE
+
+    last_err: Exception | None = None
+    for url in urls:
+        try:
+            with urllib.request.urlopen(url, context=ctx) as resp:
+                return resp.read().decode("ascii", "replace")
+        except Exception as e:           # 404 / network error
+            print(f"  ‑ {url} ... failed ({e})")
+            last_err = e
+    raise last_err or RuntimeError("No URL succeeded")
+
+
+def dump_iconv(name: str) -> str:
+    """実行環境の iconv で name の全ての 1 byte と SO ll tt SI を UTF-32BE に変換し、
+    CPxxxx.TXT と同じ形式の表にする (EBCDIC の表の入手先)"""
+    libc = ctypes.CDLL(ctypes.util.find_library("c"), use_errno=True)
+    libc.iconv_open.restype = ctypes.c_void_p
+    libc.iconv_open.argtypes = [ctypes.c_char_p, ctypes.c_char_p]
+    libc.iconv.restype = ctypes.c_size_t
+    libc.iconv.argtypes = [ctypes.c_void_p, ctypes.POINTER(ctypes.c_char_p), ctypes.POINTER(ctypes.c_size_t),
+                           ctypes.POINTER(ctypes.c_char_p), ctypes.POINTER(ctypes.c_size_t)]
+    cd = libc.iconv_open(b"UTF-32BE", name.encode())
+    if cd is None or cd == ctypes.c_void_p(-1).value:
+        raise SystemExit(f"{name}: not supported by the platform iconv (use --input-dir)")
+    fail = ctypes.c_size_t(-1).value
+
+    def one(data: bytes) -> int | None:
+        libc.iconv(cd, None, None, None, None)
+        inb = ctypes.create_string_buffer(data, len(data))
+        outb = ctypes.create_string_buffer(16)
+        ip, il = ctypes.c_char_p(ctypes.addressof(inb)), ctypes.c_size_t(len(data))
+        op, ol = ctypes.c_char_p(ctypes.addressof(outb)), ctypes.c_size_t(16)
+        if libc.iconv(cd, ctypes.byref(ip), ctypes.byref(il), ctypes.byref(op), ctypes.byref(ol)) == fail or il.value:
+            return None
+        libc.iconv(cd, None, None, ctypes.byref(op), ctypes.byref(ol))
+        out = outb.raw[:16 - ol.value]
+        return int.from_bytes(out, "big") if len(out) == 4 and out[:2] == b"\0\0" else None
+
+    lines = [f"#    Name:     {name} to Unicode table (dumped from the platform iconv)"]
+    for b in range(256):
+        u = None if b in (0x0E, 0x0F) else one(bytes([b]))
+        if u is not None:
+            lines.append(f"0x{b:02X}\t0x{u:04X}\t#")
+    for lead in range(0x40, 0xFF):
+        for trail in range(0x40, 0xFF):
+            u = one(bytes([0x0E, lead, trail, 0x0F]))
+            if u is not None:
+                lines.append(f"0x{lead:02X}{trail:02X}\t0x{u:04X}\t#")
+    return "\n".join(lines) + "\n"
+
+
+def parse_mapping(text: str) -> tuple[dict[int, int], dict[int, int], set[int]]:
+    """Parse '0xXX 0xUUUU', '0xXXXX 0xUUUU' and '0xXX  #DBCS LEAD BYTE' lines.
+
+    Return: (1 byte → Unicode, 2 byte → Unicode, lead byte の集合)
+    """
+    pat = re.compile(r"^0x([0-9A-F]{2}|[0-9A-F]{4})\s+(?:0x([0-9A-F]{4}))?\s*(#.*)?$", re.IGNORECASE)
+    single: dict[int, int] = {}
+    double: dict[int, int] = {}
+    leads: set[int] = set()
+    for line in text.splitlines():
+        m = pat.match(line.strip())
+        if not m:
+            continue
+        code = int(m[1], 16)
+        if m[2] is None:
+            if m[3] and "LEAD" in m[3].upper():
+                leads.add(code)
+            continue
+        if len(m[1]) == 2:
+            single[code] = int(m[2], 16)
+        else:
+            double[code] = int(m[2], 16)
+    leads |= {c >> 8 for c in double}
+    return single, double, leads
+
+
+def fmt_u8(values: list[int]) -> str:
+    return "\n".join(
+        "  " + " ".join(f"{v:3d}," for v in values[i:i + 16])
+        for i in range(0, len(values), 16)
+    )
+
+
+def fmt_u16(values: list[int], indent: str = "  ") -> str:
+    return "\n".join(
+        indent + " ".join(f"0x{v:04X}," for v in values[i:i + 16])
+        for i in range(0, len(values), 16)
+    )
+
+
+def fmt_rows(rows: list[list[int]], labels: list[str]) -> str:
+    out: list[str] = []
+    for label, row in zip(labels, rows):
+        out.append(f"  {{ /* {label} */")
+        out.append(fmt_u16(row, "    "))
+        out.append("  },")
+    return "\n".join(out)
+
+
+def emit_codepage(name: str, single: dict[int, int], double: dict[int, int], leads: set[int],
+                  shifted: bool = False) -> str:
+    """shifted = SO/SI で切り替える (lead byte も 1 byte の文字として残す)"""
+    sb2u = [NOMAP] * 256
+    for b, u in single.items():
+        if shifted or b not in leads:
+            sb2u[b] = u
+
+    # --- 順引き: lead 別の行 ---
+    dbcs = ""
+    lead2row_name, db2u_name = "CP_SBCS_LEAD2ROW", "CP_SBCS_DB2U"
+    if leads:
+        lead2row = [0] * 256
+        rows = [[NOMAP] * 256]
+        labels = ["not a lead byte"]
+        for lead in sorted(leads):
+            lead2row[lead] = len(rows)
+            rows.append([NOMAP] * 256)
+            labels.append(f"lead 0x{lead:02X}")
+        for code, u in double.items():
+            rows[lead2row[code >> 8]][code & 0xFF] = u
+        dbcs = DBCS_TEMPLATE.format(name=name, lead2row=fmt_u8(lead2row),
+                                    nrows=len(rows), db2u=fmt_rows(rows, labels))
+        lead2row_name, db2u_name = f"{name}_LEAD2ROW", f"{name}_DB2U"
+
+    # --- 逆引き: 重複は最小のコード (EBCDIC では 1 byte が先) ---
+    rev: dict[int, int] = {}
+    pairs = [(b, u) for b, u in enumerate(sb2u) if u != NOMAP] + sorted(double.items())
+    for code, u in pairs:
+        if u not in rev or code < rev[u]:
+            rev[u] = code
+    for u, code in REVERSE_OVERRIDES.get(name, {}).items():
+        if double.get(code, sb2u[code] if code < 0x100 else NOMAP) != u:
+            raise SystemExit(f"{name}: override U+{u:04X} -> 0x{code:X} does not decode back")
+        rev[u] = code
+    pages = sorted({u >> 8 for u in rev})
+    if len(pages) >= 256:
+        raise SystemExit(f"{name}: Unicode pages do not fit U2CP_PAGE")
+    u2c_page = [0] * 256
+    u2c_rows = [[NOMAP] * 256]
+    u2c_labels = ["unmapped"]
+    for pg in pages:
+        u2c_page[pg] = len(u2c_rows)
+        u2c_rows.append([NOMAP] * 256)
+        u2c_labels.append(f"U+{pg:02X}xx")
+    for u, code in rev.items():
+        u2c_rows[u2c_page[u >> 8]][u & 0xFF] = code
+
+    return PAGE_TEMPLATE.format(
+        name=name, sb2u=fmt_u16(sb2u), dbcs=dbcs,
+        u2c_page=fmt_u8(u2c_page), npages=len(u2c_rows), u2c=fmt_rows(u2c_rows, u2c_labels),
+        lead2row=lead2row_name, db2u=db2u_name,
+    )
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-o", "--output",
+        default=str(Path(__file__).resolve().parents[1] / "include" / "codepage_table.h"),
+        help="output header path (default: include/codepage_table.h)",
+    )
+    parser.add_argument(
+        "--ebcdic-output",
+        default=str(Path(__file__).resolve().parents[1] / "include" / "ebcdic_table.h"),
+        help="output header path for IBM930 / IBM939 (default: include/ebcdic_table.h)",
+    )
+    parser.add_argument(
+        "-i", "--input-dir",
+        help="directory with local CPxxxx.TXT / IBMxxx.TXT files (skip download)",
+    )
+    args = parser.parse_args()
+
+    def load(name: str) -> str:
+        local = Path(args.input_dir) / f"{name}.TXT" if args.input_dir else None
+        if local and local.exists():
+            return local.read_text(encoding="ascii", errors="replace")
+        if name in EBCDIC:
+            print(f"Dumping {name} from the platform iconv ...")
+            return dump_iconv(name)
+        if local:
+            raise SystemExit(f"{local}: not found")
+        print(f"Downloading {name}.TXT ...")
+        return download([u.format(name) for u in BASE_URLS])
+
+    for names, output, shared in (
+        (CODEPAGES, args.output, SBCS_SHARED_TEMPLATE.format(sbcs_db2u=fmt_u16([NOMAP] * 256))),
+        (EBCDIC, args.ebcdic_output, ""),
+    ):
+        body: list[str] = []
+        for name in names:
+            single, double, leads = parse_mapping(load(name))
+            body.append(emit_codepage(name, single, double, leads, shifted=name in EBCDIC))
+            print(f"  {name}: {len(single)} single, {len(double)} double, {len(leads)} lead bytes")
+
+        hdr = HEADER_TEMPLATE.format(shared=shared, pages="".join(body))
+        out_path = Path(output)
+        out_path.parent.mkdir(parents=True, exist_ok=True)
+        out_path.write_text(hdr, encoding="utf-8")
+        print(f"Wrote {out_path}.")
+
+
+if __name__ == "__main__":
+    main()
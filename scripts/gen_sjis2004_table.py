@@ -0,0 +1,240 @@
+#!/usr/bin/env python3
+"""
+Generate include/sjis2004_table.h from the JIS X 0213:2004 Shift_JIS mapping file.
+
+- ダウンロード先: x0213.org (codetable/sjis-0213-2004-std.txt)
+- 出力先       : include/sjis2004_table.h
+  * SJ2004_LEAD2ROW / SJ2004_DB2U : lead byte → 行番号 / 行ごとの trail → Unicode
+                                    (第 2 面の漢字は補助面なので uint32_t。
+                                     SJ2004_PAIR 以上は 2 コード点になる文字で SJ2004_PAIRS の添字)
+  * SJ2004_PAIRS                  : 2 コード点 (基底 + 結合文字。か゚ / ˩˥ など 25 字)
+  * U2SJ2004_PAGE / U2SJ2004      : Unicode 上位ビット (U+2FFFF まで) → ページ / ページ内 → SJIS
+                                    SJ2004_BASE 以上 0x8100 未満は合成の基底で SJ2004_BASES の添字
+  * SJ2004_BASES                  : 基底の単独のコードと、後ろに来ると合成できる結合文字
+  未定義は SJ2004_NOMAP (順引き) / SJ2004_U_NOMAP (逆引き)、行 0 / ページ 0 は番兵。
+  C では static const、C++ では inline constexpr (sjis_table.h と同じ)。
+
+1 byte は CP932 と同じに扱う: 0x00–0x7F は ASCII (規格の 0x5C = ¥ / 0x7E = ‾ ではなく)、
+0xA1–0xDF は半角カナ。逆引きの重複 (U+005C / U+007E の 2 byte 側) は最小コードを採る。
+
+実行例:
+    $ python scripts/gen_sjis2004_table.py
+    $ python scripts/gen_sjis2004_table.py --input sjis-0213-2004-std.txt   # ダウンロードしない
+"""
+
+from __future__ import annotations
+from pathlib import Path
+import argparse
+import re
+import ssl
+import urllib.request
+
+SJIS2004_URLS = (
+    "http://x0213.org/codetable/sjis-0213-2004-std.txt",
+)
+
+HEADER_TEMPLATE = """\
+/* Auto‑generated by gen_sjis2004_table.py — DO NOT EDIT */
+#pragma once
+#include <stdint.h>
+
+#if defined(__cplusplus)
+#  define SJ2004_TABLE_CONST inline constexpr
+#else
+#  define SJ2004_TABLE_CONST static const
+#endif
+
+#define SJ2004_NOMAP    0xFFFFFFFFu   /* 順引きの未定義                               */
+#define SJ2004_PAIR     0x00200000u   /* 順引き: これ以上は SJ2004_PAIRS[v - SJ2004_PAIR] */
+#define SJ2004_U_NOMAP  0xFFFF        /* 逆引きの未定義                               */
+#define SJ2004_BASE     0x0100        /* 逆引き: これ以上 0x8100 未満は合成の基底      */
+
+/* lead byte → SJ2004_DB2U の行 (0 = lead ではない) */
+SJ2004_TABLE_CONST uint8_t SJ2004_LEAD2ROW[256] = {{
+{lead2row}
+}};
+
+/* 2 byte → Unicode: SJ2004_DB2U[SJ2004_LEAD2ROW[lead]][trail] */
+SJ2004_TABLE_CONST uint32_t SJ2004_DB2U[{nrows}][256] = {{
+{db2u}
+}};
+
+/* 2 コード点になる文字: {{ 基底, 結合文字 }} */
+SJ2004_TABLE_CONST uint16_t SJ2004_PAIRS[{npairs}][2] = {{
+{pairs}
+}};
+
+/* Unicode (U+0000–U+2FFFF) の上位ビット → U2SJ2004 のページ (0 = 対応なし) */
+SJ2004_TABLE_CONST uint16_t U2SJ2004_PAGE[768] = {{
+{u2s_page}
+}};
+
+/* Unicode → SJIS: U2SJ2004[U2SJ2004_PAGE[u >> 8]][u & 0xFF] */
+SJ2004_TABLE_CONST uint16_t U2SJ2004[{npages}][256] = {{
+{u2s}
+}};
+
+/* 合成の基底: 単独のコードと、直後の結合文字 comb[i] と合わせたコード with[i] (0 = 無し) */
+typedef struct {{ uint16_t sjis; uint16_t comb[2]; uint16_t with[2]; }} sj2004_base_t;
+SJ2004_TABLE_CONST sj2004_base_t SJ2004_BASES[{nbases}] = {{
+{bases}
+}};
+"""
+
+NOMAP = 0xFFFFFFFF
+U_NOMAP = 0xFFFF
+PAIR = 0x00200000
+BASE = 0x0100
+
+
+def download(urls: tuple[str, ...]) -> str:
+    ctx = ssl.create_default_context()
+    ctx.check_hostname = False
+    ctx.verify_mode = ssl.CERT_NONE
+
+    last_err: Exception | None = None
+    for url in urls:
+        try:
+            with urllib.request.urlopen(url, context=ctx) as resp:
+                return resp.read().decode("ascii", "replace")
+        except Exception as e:           # 404 / network error
+            print(f"  ‑ {url} ... failed ({e})")
+            last_err = e
+    raise last_err or RuntimeError("No URL succeeded")
+
+
+def parse_entries(text: str) -> dict[int, tuple[int, ...]]:
+    """Parse lines like '0x8140  U+3000  # ...' or '0x82F5  U+304B+309A  # ...'
+
+    2 byte のコードだけを採る (1 byte は CP932 と同じ固定の対応)。
+    """
+    pat = re.compile(r"^0x([0-9A-F]{4})\s+U\+([0-9A-F]{4,6})(?:\+([0-9A-F]{4,6}))?", re.IGNORECASE)
+    entries: dict[int, tuple[int, ...]] = {}
+    for line in text.splitlines():
+        m = pat.match(line)
+        if m:
+            cps = (int(m[2], 16),) if m[3] is None else (int(m[2], 16), int(m[3], 16))
+            entries[int(m[1], 16)] = cps
+    return entries
+
+
+def fmt_u8(values: list[int]) -> str:
+    return "\n".join(
+        "  " + " ".join(f"{v:3d}," for v in values[i:i + 16])
+        for i in range(0, len(values), 16)
+    )
+
+
+def fmt_rows(rows: list[list[int]], labels: list[str], width: int) -> str:
+    out: list[str] = []
+    per = 16 if width == 4 else 8
+    for label, row in zip(labels, rows):
+        out.append(f"  {{ /* {label} */")
+        for i in range(0, 256, per):
+            out.append("    " + " ".join(f"0x{v:0{width}X}," for v in row[i:i + per]))
+        out.append("  },")
+    return "\n".join(out)
+
+
+def emit_header(entries: dict[int, tuple[int, ...]]) -> str:
+    # --- 1 byte: ASCII と半角カナ ---
+    single = {b: b for b in range(0x80)}
+    single.update({b: b + 0xFEC0 for b in range(0xA1, 0xE0)})
+
+    # --- 順引き: lead 別の行 ---
+    leads = sorted({sj >> 8 for sj in entries})
+    lead2row = [0] * 256
+    db_rows = [[NOMAP] * 256]
+    db_labels = ["not a lead byte"]
+    for lead in leads:
+        lead2row[lead] = len(db_rows)
+        db_rows.append([NOMAP] * 256)
+        db_labels.append(f"lead 0x{lead:02X}")
+    pairs: list[tuple[int, int]] = []
+    for sj, cps in sorted(entries.items()):
+        if len(cps) == 1:
+            v = cps[0]
+        else:
+            v = PAIR + len(pairs)
+            pairs.append(cps)
+        db_rows[lead2row[sj >> 8]][sj & 0xFF] = v
+
+    # --- 逆引き: 1 コード点の文字だけ。重複は最小コード ---
+    rev: dict[int, int] = {}
+    for sj, uni in list(single.items()) + [(sj, cps[0]) for sj, cps in entries.items() if len(cps) == 1]:
+        if uni not in rev or sj < rev[uni]:
+            rev[uni] = sj
+
+    # --- 合成の基底 (逆引きの値を SJ2004_BASE + 添字に置き換える) ---
+    combos: dict[int, list[tuple[int, int]]] = {}
+    for sj, cps in sorted(entries.items()):
+        if len(cps) == 2:
+            combos.setdefault(cps[0], []).append((cps[1], sj))
+    bases: list[tuple[int, list[tuple[int, int]]]] = []
+    for uni in sorted(combos):
+        if uni not in rev or len(combos[uni]) > 2:
+            raise SystemExit(f"U+{uni:04X}: base without a single code / too many combinations")
+        bases.append((rev[uni], combos[uni]))
+        rev[uni] = BASE + len(bases) - 1
+
+    pages = sorted({uni >> 8 for uni in rev})
+    if pages[-1] >= 0x300:
+        raise SystemExit("Unicode pages do not fit U2SJ2004_PAGE")
+    u2s_page = [0] * 0x300
+    u2s_rows = [[U_NOMAP] * 256]
+    u2s_labels = ["unmapped"]
+    for pg in pages:
+        u2s_page[pg] = len(u2s_rows)
+        u2s_rows.append([U_NOMAP] * 256)
+        u2s_labels.append(f"U+{pg:02X}xx")
+    for uni, sj in rev.items():
+        u2s_rows[u2s_page[uni >> 8]][uni & 0xFF] = sj
+
+    base_lines = []
+    for sj, cl in bases:
+        comb = [c for c, _ in cl] + [0] * (2 - len(cl))
+        with_ = [w for _, w in cl] + [0] * (2 - len(cl))
+        base_lines.append(
+            f"  {{ 0x{sj:04X}, {{ 0x{comb[0]:04X}, 0x{comb[1]:04X} }}, {{ 0x{with_[0]:04X}, 0x{with_[1]:04X} }} }},")
+
+    return HEADER_TEMPLATE.format(
+        lead2row=fmt_u8(lead2row),
+        nrows=len(db_rows), db2u=fmt_rows(db_rows, db_labels, 8),
+        npairs=len(pairs),
+        pairs="\n".join(f"  {{ 0x{a:04X}, 0x{b:04X} }}," for a, b in pairs),
+        u2s_page=fmt_u8(u2s_page),
+        npages=len(u2s_rows), u2s=fmt_rows(u2s_rows, u2s_labels, 4),
+        nbases=len(bases), bases="\n".join(base_lines),
+    )
+
+
+def main() -> None:
+    parser = argparse.ArgumentParser()
+    parser.add_argument(
+        "-o", "--output",
+        default=str(Path(__file__).resolve().parents[1] / "include" / "sjis2004_table.h"),
+        help="output header path (default: include/sjis2004_table.h)",
+    )
+    parser.add_argument(
+        "-i", "--input",
+        help="local sjis-0213-2004-std.txt (skip download)",
+    )
+    args = parser.parse_args()
+
+    if args.input:
+        text = Path(args.input).read_text(encoding="ascii", errors="replace")
+    else:
+        print("Downloading sjis-0213-2004-std.txt ...")
+        text = download(SJIS2004_URLS)
+    print("Parsing ...")
+    entries = parse_entries(text)
+    hdr = emit_header(entries)
+
+    out_path = Path(args.output)
+    out_path.parent.mkdir(parents=True, exist_ok=True)
+    out_path.write_text(hdr, encoding="utf-8")
+    print(f"Wrote {out_path} ({len(entries)} entries).")
+
+
+if __name__ == "__main__":
+    main()
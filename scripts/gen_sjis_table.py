@@ -4,11 +4,27 @@ Generate include/sjis_table.h from official CP932 mapping file.
 
 - ダウンロード先: Unicode Consortium (PUBLIC/MAPPINGS/OBSOLETE/EASTASIA/OTHERS/CP932.TXT)
 - 出力先       : include/sjis_table.h
-  * sjis_pair_t { uint16_t sjis; uint32_t uni; } の配列
-  * バイナリ検索用に SJIS 昇順でソート
+  * SJIS_MAP      : sjis_pair_t { uint16_t sjis; uint32_t uni; } の配列 (SJIS 昇順)
+  * SJIS_SB2U     : 1 byte SJIS → Unicode
+  * SJIS_LEAD2ROW / SJIS_DB2U : lead byte → 行番号 / 行ごとの trail → Unicode
+  * U2SJIS_PAGE   / U2SJIS    : Unicode 上位 8 bit → ページ番号 / ページ内 → SJIS
+  * U2SJIS_BITS   : BMP の各コード点が SJIS にあるかの bitset (8 KB、検証用)
+  * SJIS_IBM2NEC  : IBM 拡張 (lead 0xFA–0xFC) → 同じ文字の NEC 選定 IBM 拡張 (0xED / 0xEE)
+                    (EUC-JP / JIS は 94 区までなので、0xFA 以降は NEC 選定側で表す)
+  * SJIS_CANON_ROW / SJIS_CANON : 記号・NEC 特殊文字・IBM 拡張などの lead (CANON_LEADS) の
+                    SJIS → 同じ文字の正規の SJIS (= U2SJIS[SJIS_DB2U[s]])。表を引かない
+                    SJIS ⇆ EUC-JP / JIS の核が、算術だけでは往復しない区で使う小さな表
+  いずれも未定義は SJIS_NOMAP (0xFFFF)、行 0 / ページ 0 は全て未定義の番兵。
+  C では static const、C++ では inline constexpr (全 TU で 1 つ・定数式で使える)。
+
+逆引きの重複 (同じ Unicode に複数の SJIS) は Microsoft / glibc CP932 と同じく
+  - NEC 選定 IBM 拡張 (lead 0xED / 0xEE) は他に候補があれば採らない
+  - それ以外は SJIS コードが最小のもの
+を採る。
 
 実行例:
     $ python scripts/gen_sjis_table.py
+    $ python scripts/gen_sjis_table.py --input CP932.TXT   # ダウンロードしない
 """
 
 from __future__ import annotations
@@ -30,12 +46,71 @@ HEADER_TEMPLATE = """\
 #pragma once
 #include <stdint.h>
 
+#if defined(__cplusplus)
+#  define SJIS_TABLE_CONST inline constexpr
+#else
+#  define SJIS_TABLE_CONST static const
+#endif
+
+#define SJIS_NOMAP 0xFFFF
+
 typedef struct {{ uint16_t sjis; uint32_t uni; }} sjis_pair_t;
-static const sjis_pair_t SJIS_MAP[{size}] = {{
+SJIS_TABLE_CONST sjis_pair_t SJIS_MAP[{size}] = {{
 {rows}
 }};
+
+/* 1 byte SJIS → Unicode */
+SJIS_TABLE_CONST uint16_t SJIS_SB2U[256] = {{
+{sb2u}
+}};
+
+/* lead byte → SJIS_DB2U の行 (0 = lead ではない) */
+SJIS_TABLE_CONST uint8_t SJIS_LEAD2ROW[256] = {{
+{lead2row}
+}};
+
+/* 2 byte SJIS → Unicode: SJIS_DB2U[SJIS_LEAD2ROW[lead]][trail] */
+SJIS_TABLE_CONST uint16_t SJIS_DB2U[{nrows}][256] = {{
+{db2u}
+}};
+
+/* Unicode 上位 8 bit → U2SJIS のページ (0 = 対応なし) */
+SJIS_TABLE_CONST uint8_t U2SJIS_PAGE[256] = {{
+{u2s_page}
+}};
+
+/* Unicode (BMP) → SJIS: U2SJIS[U2SJIS_PAGE[u >> 8]][u & 0xFF] */
+SJIS_TABLE_CONST uint16_t U2SJIS[{npages}][256] = {{
+{u2s}
+}};
+
+/* Unicode (BMP) が SJIS で表せるか: U2SJIS_BITS[u >> 6] の bit (u & 63) */
+SJIS_TABLE_CONST uint64_t U2SJIS_BITS[1024] = {{
+{u2s_bits}
+}};
+
+/* IBM 拡張 → NEC 選定 IBM 拡張: SJIS_IBM2NEC[lead - 0xFA][trail] (無ければ SJIS_NOMAP) */
+SJIS_TABLE_CONST uint16_t SJIS_IBM2NEC[3][256] = {{
+{ibm2nec}
+}};
+
+/* 算術だけでは往復しない lead の SJIS → 正規の SJIS (U2SJIS[SJIS_DB2U[s]]):
+   SJIS_CANON[SJIS_CANON_ROW[lead]][trail]。行 0 (他の lead) は全て SJIS_NOMAP */
+SJIS_TABLE_CONST uint8_t SJIS_CANON_ROW[256] = {{
+{canon_row}
+}};
+
+SJIS_TABLE_CONST uint16_t SJIS_CANON[{ncanon}][256] = {{
+{canon}
+}};
 """
 
+# 1–15 区 (記号・NEC 特殊文字)、47 / 84 区の後ろ、85–94 区 (NEC 選定 IBM 拡張) と IBM 拡張。
+# 他の lead (16–83 区) は全ての点が算術で往復する (iconv_internal.h の jis_dense)
+CANON_LEADS = (*range(0x81, 0x89), 0x98, *range(0xEA, 0xF0), 0xFA, 0xFB, 0xFC)
+
+NOMAP = 0xFFFF
+
 
 def download_cp932(urls: list[str]) -> str:
     ctx = ssl.create_default_context()
@@ -70,12 +145,108 @@ def parse_pairs(text: str) -> list[tuple[int, int]]:
     return pairs
 
 
+def reverse_map(pairs: list[tuple[int, int]]) -> dict[int, int]:
+    """Unicode → SJIS。重複は NEC 選定 IBM 拡張 (0xED/0xEE) を避け、最小コードを採る"""
+    def rank(sj: int) -> tuple[int, int]:
+        return (1 if (sj >> 8) in (0xED, 0xEE) else 0, sj)
+
+    rev: dict[int, int] = {}
+    for sj, uni in pairs:
+        if uni not in rev or rank(sj) < rank(rev[uni]):
+            rev[uni] = sj
+    return rev
+
+
+def fmt_u8(values: list[int]) -> str:
+    return "\n".join(
+        "  " + " ".join(f"{v:3d}," for v in values[i:i + 16])
+        for i in range(0, len(values), 16)
+    )
+
+
+def fmt_u16_rows(rows: list[list[int]], labels: list[str]) -> str:
+    out: list[str] = []
+    for label, row in zip(labels, rows):
+        out.append(f"  {{ /* {label} */")
+        for i in range(0, 256, 16):
+            out.append("    " + " ".join(f"0x{v:04X}," for v in row[i:i + 16]))
+        out.append("  },")
+    return "\n".join(out)
+
+
 def emit_header(pairs: list[tuple[int, int]]) -> str:
     row_lines = [
         f"  {{0x{sj:04X}, 0x{uni:04X}}},"
         for sj, uni in pairs
     ]
-    return HEADER_TEMPLATE.format(size=len(pairs), rows="\n".join(row_lines))
+
+    # --- 順引き: 1 byte と lead 別の行 ---
+    sb2u = [NOMAP] * 256
+    leads = sorted({sj >> 8 for sj, _ in pairs if sj > 0xFF})
+    lead2row = [0] * 256
+    db_rows = [[NOMAP] * 256]
+    db_labels = ["not a lead byte"]
+    for lead in leads:
+        lead2row[lead] = len(db_rows)
+        db_rows.append([NOMAP] * 256)
+        db_labels.append(f"lead 0x{lead:02X}")
+    for sj, uni in pairs:
+        if sj <= 0xFF:
+            sb2u[sj] = uni
+        else:
+            db_rows[lead2row[sj >> 8]][sj & 0xFF] = uni
+
+    # --- 逆引き: Unicode 256 コード点単位のページ ---
+    rev = reverse_map(pairs)
+    pages = sorted({uni >> 8 for uni in rev})
+    u2s_page = [0] * 256
+    u2s_rows = [[NOMAP] * 256]
+    u2s_labels = ["unmapped"]
+    for pg in pages:
+        u2s_page[pg] = len(u2s_rows)
+        u2s_rows.append([NOMAP] * 256)
+        u2s_labels.append(f"U+{pg:02X}xx")
+    for uni, sj in rev.items():
+        u2s_rows[u2s_page[uni >> 8]][uni & 0xFF] = sj
+    u2s_bits = [0] * 1024
+    for uni in rev:
+        u2s_bits[uni >> 6] |= 1 << (uni & 63)
+
+    # --- IBM 拡張 → NEC 選定 IBM 拡張 (同じ Unicode) ---
+    nec = {uni: sj for sj, uni in pairs if (sj >> 8) in (0xED, 0xEE)}
+    ibm2nec = [[NOMAP] * 256 for _ in range(3)]
+    for sj, uni in pairs:
+        if (sj >> 8) in (0xFA, 0xFB, 0xFC) and uni in nec:
+            ibm2nec[(sj >> 8) - 0xFA][sj & 0xFF] = nec[uni]
+
+    # --- 正規化: 算術で往復しない lead の SJIS → U2SJIS[SJIS_DB2U[s]] ---
+    canon_row = [0] * 256
+    canon = [[NOMAP] * 256]
+    for lead in CANON_LEADS:
+        canon_row[lead] = len(canon)
+        canon.append([NOMAP] * 256)
+    for sj, uni in pairs:
+        if sj > 0xFF and canon_row[sj >> 8] and uni in rev:
+            if rev[uni] <= 0xFF:
+                raise SystemExit(f"0x{sj:04X}: canonical code is a single byte")
+            canon[canon_row[sj >> 8]][sj & 0xFF] = rev[uni]
+
+    return HEADER_TEMPLATE.format(
+        size=len(pairs), rows="\n".join(row_lines),
+        sb2u="\n".join(
+            "  " + " ".join(f"0x{v:04X}," for v in sb2u[i:i + 16])
+            for i in range(0, 256, 16)),
+        lead2row=fmt_u8(lead2row),
+        nrows=len(db_rows), db2u=fmt_u16_rows(db_rows, db_labels),
+        u2s_page=fmt_u8(u2s_page),
+        npages=len(u2s_rows), u2s=fmt_u16_rows(u2s_rows, u2s_labels),
+        u2s_bits="\n".join(
+            "  " + " ".join(f"0x{v:016X}ull," for v in u2s_bits[i:i + 4])
+            for i in range(0, 1024, 4)),
+        ibm2nec=fmt_u16_rows(ibm2nec, [f"lead 0x{ld:02X}" for ld in (0xFA, 0xFB, 0xFC)]),
+        canon_row=fmt_u8(canon_row), ncanon=len(canon),
+        canon=fmt_u16_rows(canon, ["not listed"] + [f"lead 0x{ld:02X}" for ld in CANON_LEADS]),
+    )
 
 
 def main() -> None:
@@ -85,10 +256,17 @@ def main() -> None:
         default=str(Path(__file__).resolve().parents[1] / "include" / "sjis_table.h"),
         help="output header path (default: include/sjis_table.h)",
     )
+    parser.add_argument(
+        "-i", "--input",
+        help="local CP932.TXT (skip download)",
+    )
     args = parser.parse_args()
 
-    print("Downloading CP932.TXT ...")
-    text = download_cp932(CP932_URLS)
+    if args.input:
+        text = Path(args.input).read_text(encoding="ascii", errors="replace")
+    else:
+        print("Downloading CP932.TXT ...")
+        text = download_cp932(CP932_URLS)
     print("Parsing ...")
     pairs = parse_pairs(text)
     hdr = emit_header(pairs)
@@ -0,0 +1,110 @@
+/*----------------------------------------------------------------------
+ *  src/ascii.c  —  ASCII (0x00‑0x7F) 連続長の高速スキャン
+ *
+ *  ASCII は CP932 と UTF‑8 でバイト列が完全に一致するため、
+ *  先頭から何バイトが ASCII かが分かれば変換そのものを省略できる。
+ *  x86/x64 は SSE2、ARM64 は NEON、それ以外は 8 バイト SWAR で走査する。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define ASCII_USE_SSE2 1
+#elif defined(__ARM_NEON) || defined(_M_ARM64)
+#  include <arm_neon.h>
+#  define ASCII_USE_NEON 1
+#endif
+
+#if defined(_MSC_VER)
+#  include <intrin.h>
+static unsigned ctz32(unsigned v)
+{
+    unsigned long i;
+    _BitScanForward(&i, v);
+    return (unsigned)i;
+}
+#else
+#  define ctz32(v) ((unsigned)__builtin_ctz(v))
+#endif
+
+/*======================================================================
+ *  ascii_span - 先頭から連続する ASCII バイト数を返す
+ *
+ *  Input:  p - 走査対象
+ *          n - バイト数
+ *  Return: 最初の非 ASCII バイトの位置 (全て ASCII なら n)
+ *====================================================================*/
+size_t ascii_span(const unsigned char* p, size_t n)
+{
+    size_t i = 0;
+
+#if defined(ASCII_USE_SSE2)
+    /* 64 バイト単位: 4 本 OR して最上位ビットをまとめて検査 */
+    for (; i + 64 <= n; i += 64) {
+        __m128i a = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i b = _mm_loadu_si128((const __m128i*)(p + i + 16));
+        __m128i c = _mm_loadu_si128((const __m128i*)(p + i + 32));
+        __m128i d = _mm_loadu_si128((const __m128i*)(p + i + 48));
+        __m128i o = _mm_or_si128(_mm_or_si128(a, b), _mm_or_si128(c, d));
+        if (_mm_movemask_epi8(o)) break;          /* 位置は下で特定 */
+    }
+    for (; i + 16 <= n; i += 16) {
+        int m = _mm_movemask_epi8(_mm_loadu_si128((const __m128i*)(p + i)));
+        if (m) return i + ctz32((unsigned)m);
+    }
+#elif defined(ASCII_USE_NEON)
+    for (; i + 64 <= n; i += 64) {
+        uint8x16_t o = vorrq_u8(vorrq_u8(vld1q_u8(p + i),      vld1q_u8(p + i + 16)),
+                                vorrq_u8(vld1q_u8(p + i + 32), vld1q_u8(p + i + 48)));
+        if (vmaxvq_u8(o) >= 0x80) break;
+    }
+    for (; i + 16 <= n; i += 16) {
+        if (vmaxvq_u8(vld1q_u8(p + i)) >= 0x80) break;
+    }
+#endif
+
+    /* 8 バイト SWAR (SIMD 無し環境 / 端数) */
+    for (; i + 8 <= n; i += 8) {
+        uint64_t w;
+        memcpy(&w, p + i, 8);
+        if (w & 0x8080808080808080ull) break;
+    }
+    while (i < n && p[i] < 0x80) ++i;
+    return i;
+}
+
+/*======================================================================
+ *  ascii_span_noesc - 先頭から連続する「ESC 以外の ASCII」バイト数を返す
+ *
+ *  符号化方式の推定用。ISO-2022-JP のエスケープ (0x1B) でも止まる。
+ *  ESC と一致したレーンは 0xFF になるので、最上位ビットの検査にまとめられる。
+ *
+ *  Input:  p - 走査対象
+ *          n - バイト数
+ *  Return: 最初の非 ASCII バイトまたは ESC の位置 (無ければ n)
+ *====================================================================*/
+size_t ascii_span_noesc(const unsigned char* p, size_t n)
+{
+    size_t i = 0;
+
+#if defined(ASCII_USE_SSE2)
+    const __m128i esc = _mm_set1_epi8(0x1B);
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+        int m = _mm_movemask_epi8(_mm_or_si128(v, _mm_cmpeq_epi8(v, esc)));
+        if (m) return i + ctz32((unsigned)m);
+    }
+#elif defined(ASCII_USE_NEON)
+    const uint8x16_t esc = vdupq_n_u8(0x1B);
+    for (; i + 16 <= n; i += 16) {
+        uint8x16_t v = vld1q_u8(p + i);
+        if (vmaxvq_u8(vorrq_u8(v, vceqq_u8(v, esc))) >= 0x80) break;
+    }
+#endif
+
+    while (i < n && p[i] < 0x80 && p[i] != 0x1B) ++i;
+    return i;
+}
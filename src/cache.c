@@ -0,0 +1,202 @@
+/*----------------------------------------------------------------------
+ *  src/cache.c  —  短い文字列の変換結果キャッシュ (iconv_alt_cache)
+ *
+ *  8-way セット連想。各スロットは入力と出力をインラインで持つ固定長
+ *  レコードで、seqlock で保護する。
+ *    - 読み取り: ロックなし (seq を前後で比較し、書き換え中なら素通り)
+ *    - 書き込み: seq の CAS で 1 スロットだけ確保。取れなければ諦める
+ *    - 追い出し: セットごとの CLOCK (参照ビット + 針)
+ *  レコードを解放しないので読み取り側の use-after-free は起きない。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include "compat_thread.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define CACHE_WAYS     8
+#define CACHE_OUT_MAX  (ICONV_ALT_CACHE_MAX_INPUT * 3)   /* SJIS → UTF-8 の最悪値 (超える結果は登録しない) */
+
+typedef struct {
+    volatile uint32_t seq;        /* 奇数 = 書き込み中 / 0 = 未使用         */
+    volatile uint32_t ref;        /* CLOCK 参照ビット                        */
+    uint64_t hash;
+    uint16_t pair;                /* from * ENC_COUNT + to                   */
+    uint8_t  inlen;
+    uint16_t outlen;
+    char     data[ICONV_ALT_CACHE_MAX_INPUT + CACHE_OUT_MAX];  /* 入力 | 出力 */
+} cache_slot;
+
+typedef struct {
+    cache_slot        slot[CACHE_WAYS];
+    volatile uint32_t hand;       /* CLOCK の針                              */
+} cache_set;
+
+struct iconv_alt_cache {
+    cache_set*        sets;
+    size_t            mask;       /* セット数 - 1                            */
+    volatile uint64_t hits, misses, inserts, evictions, bypassed;
+};
+
+/*======================================================================
+ *  1.  ハッシュ (8 バイト単位の乗算ミックス、非暗号学的)
+ *====================================================================*/
+static uint64_t hash_bytes(const unsigned char* p, size_t n, uint64_t seed)
+{
+    const uint64_t K = 0x9E3779B97F4A7C15ull;
+    uint64_t h = seed ^ (n * K);
+    while (n >= 8) {
+        uint64_t w; memcpy(&w, p, 8);
+        h = (h ^ w) * K; h ^= h >> 29;
+        p += 8; n -= 8;
+    }
+    if (n) {
+        uint64_t w = 0; memcpy(&w, p, n);
+        h = (h ^ w) * K; h ^= h >> 29;
+    }
+    h ^= h >> 32; h *= 0xD6E8FEB86659FD93ull; h ^= h >> 32;
+    return h;
+}
+
+/*======================================================================
+ *  2.  生成 / 破棄 / 統計
+ *====================================================================*/
+iconv_alt_cache* iconv_alt_cache_create(size_t capacity)
+{
+    size_t nsets = 1;
+    while (nsets * CACHE_WAYS < capacity) nsets <<= 1;
+
+    iconv_alt_cache* c = (iconv_alt_cache*)calloc(1, sizeof(*c));
+    if (!c) { errno = ENOMEM; return NULL; }
+    c->sets = (cache_set*)calloc(nsets, sizeof(cache_set));
+    if (!c->sets) { free(c); errno = ENOMEM; return NULL; }
+    c->mask = nsets - 1;
+    return c;
+}
+
+void iconv_alt_cache_destroy(iconv_alt_cache* cache)
+{
+    if (!cache) return;
+    free(cache->sets);
+    free(cache);
+}
+
+void iconv_alt_cache_get_stats(iconv_alt_cache* cache, iconv_alt_cache_stats* st)
+{
+    if (!cache || !st) return;
+    st->hits = compat_load_u64(&cache->hits);
+    st->misses = compat_load_u64(&cache->misses);
+    st->inserts = compat_load_u64(&cache->inserts);
+    st->evictions = compat_load_u64(&cache->evictions);
+    st->bypassed = compat_load_u64(&cache->bypassed);
+}
+
+/*======================================================================
+ *  3.  検索 (ロックなし)
+ *  Return: 出力バイト数 / 見つからない → (size_t)-1 (errno は触らない)
+ *          出力先が小さい → (size_t)-2
+ *====================================================================*/
+static size_t cache_lookup(cache_set* set, uint64_t h, uint16_t pair,
+    const char* in, size_t inlen, char* out, size_t outlen)
+{
+    for (int w = 0; w < CACHE_WAYS; ++w) {
+        cache_slot* s = &set->slot[w];
+        uint32_t seq = compat_load_acq_u32(&s->seq);
+        if (seq == 0 || (seq & 1)) continue;               /* 空 / 書き込み中 */
+        if (s->hash != h || s->pair != pair || s->inlen != inlen) continue;
+        if (memcmp(s->data, in, inlen) != 0) continue;
+
+        size_t n = s->outlen;
+        if (n <= outlen) memcpy(out, s->data + inlen, n);
+
+        compat_fence_acq();                                /* 読み取り完了を確定 */
+        if (compat_load_acq_u32(&s->seq) != seq) return (size_t)-1;  /* 途中で書き換え */
+        if (n > outlen) return (size_t)-2;                 /* 確かめた outlen でだけ E2BIG */
+
+        if (!s->ref) s->ref = 1;                           /* 無駄な書き込みを避ける */
+        return n;
+    }
+    return (size_t)-1;
+}
+
+/*======================================================================
+ *  4.  登録 (セット内 CLOCK で追い出し、競合したら諦める)
+ *====================================================================*/
+static void cache_insert(iconv_alt_cache* c, cache_set* set, uint64_t h, uint16_t pair,
+    const char* in, size_t inlen, const char* out, size_t outlen)
+{
+    cache_slot* victim = NULL;
+
+    /* 同じキーが (他スレッドにより) 既に登録済みなら何もしない。空きは優先 */
+    for (int w = 0; w < CACHE_WAYS; ++w) {
+        cache_slot* s = &set->slot[w];
+        uint32_t seq = compat_load_acq_u32(&s->seq);
+        if (seq == 0) { if (!victim) victim = s; continue; }
+        if (s->hash == h && s->pair == pair && s->inlen == inlen) return;
+    }
+
+    /* CLOCK: 参照ビットが立っていれば落として次へ (最大 2 周) */
+    int evict = 0;
+    if (!victim) {
+        uint32_t hand = set->hand;
+        for (int i = 0; i < 2 * CACHE_WAYS; ++i, ++hand) {
+            cache_slot* s = &set->slot[hand % CACHE_WAYS];
+            if (s->ref) { s->ref = 0; continue; }
+            victim = s; ++hand;
+            break;
+        }
+        set->hand = hand;                                  /* 競合しても針がずれるだけ */
+        if (!victim) return;
+        evict = 1;
+    }
+
+    uint32_t seq = compat_load_acq_u32(&victim->seq);
+    if ((seq & 1) || !compat_cas_u32(&victim->seq, seq, seq + 1)) return;
+
+    victim->hash = h;
+    victim->pair = pair;
+    victim->inlen = (uint8_t)inlen;
+    victim->outlen = (uint16_t)outlen;
+    memcpy(victim->data, in, inlen);
+    memcpy(victim->data + inlen, out, outlen);
+    victim->ref = 0;
+    compat_store_rel_u32(&victim->seq, seq + 2);
+
+    compat_add_u64(&c->inserts, 1);
+    if (evict) compat_add_u64(&c->evictions, 1);
+}
+
+/*======================================================================
+ *  5.  公開 API
+ *====================================================================*/
+size_t iconv_alt_cache_convert(iconv_alt_cache* cache, iconv_t cd,
+    const char* in, size_t inlen, char* out, size_t outlen)
+{
+    const iconv_ctx* ctx = (const iconv_ctx*)cd;
+    if (!cache || !ctx || cd == (iconv_t)-1 || (!in && inlen) || (!out && outlen)) {
+        errno = EINVAL; return (size_t)-1;
+    }
+
+    size_t wrote;
+    if (inlen > ICONV_ALT_CACHE_MAX_INPUT) {               /* 長い入力はキャッシュしない */
+        compat_add_u64(&cache->bypassed, 1);
+        if (iconv_ctx_oneshot(ctx, in, inlen, out, outlen, &wrote, NULL) < 0) return (size_t)-1;
+        return wrote;
+    }
+
+    uint16_t pair = (uint16_t)(ctx->from * ENC_COUNT + ctx->to);
+    uint64_t h = hash_bytes((const unsigned char*)in, inlen, pair);
+    cache_set* set = &cache->sets[(size_t)h & cache->mask];
+
+    size_t n = cache_lookup(set, h, pair, in, inlen, out, outlen);
+    if (n == (size_t)-2) { errno = E2BIG; return (size_t)-1; }
+    if (n != (size_t)-1) { compat_add_u64(&cache->hits, 1); return n; }
+
+    compat_add_u64(&cache->misses, 1);
+    if (iconv_ctx_oneshot(ctx, in, inlen, out, outlen, &wrote, NULL) < 0) return (size_t)-1;
+    if (wrote <= CACHE_OUT_MAX)
+        cache_insert(cache, set, h, pair, in, inlen, out, wrote);
+    return wrote;
+}
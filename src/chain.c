@@ -0,0 +1,186 @@
+/*----------------------------------------------------------------------
+ *  src/chain.c  —  チャンク連結 (rope) 出力とブロックプール
+ *
+ *  iconv() の E2BIG を「次のブロックへ進む」合図として使い、出力を
+ *  固定長ブロックの連結リストへ書く。既に書いたブロックは一切動かさない。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "compat_thread.h"
+#include <errno.h>
+#include <stdlib.h>
+
+/* 1 文字 (最大 4 byte) が必ず収まる最小ブロック長 */
+#define BLOCK_SIZE_MIN  16
+
+typedef struct chain_block {
+    struct chain_block* next;
+    size_t              used;
+    char                data[];
+} chain_block;
+
+struct iconv_alt_block_pool {
+    size_t       block_size;
+    size_t       max_free;     /* 0 = 無制限 */
+    size_t       nfree;
+    chain_block* free_list;
+    compat_mutex lock;
+};
+
+struct iconv_alt_chain {
+    iconv_alt_block_pool* pool;
+    chain_block*          head;
+    chain_block*          tail;
+    size_t                total;
+    int                   nblocks;
+};
+
+/*======================================================================
+ *  1.  ブロックプール
+ *====================================================================*/
+iconv_alt_block_pool* iconv_alt_block_pool_create(size_t block_size, size_t max_free)
+{
+    if (block_size == 0) block_size = ICONV_ALT_BLOCK_SIZE_DEFAULT;
+    if (block_size < BLOCK_SIZE_MIN) { errno = EINVAL; return NULL; }
+
+    iconv_alt_block_pool* pool = (iconv_alt_block_pool*)calloc(1, sizeof(*pool));
+    if (!pool) { errno = ENOMEM; return NULL; }
+    pool->block_size = block_size;
+    pool->max_free = max_free;
+    compat_mutex_init(&pool->lock);
+    return pool;
+}
+
+void iconv_alt_block_pool_destroy(iconv_alt_block_pool* pool)
+{
+    if (!pool) return;
+    chain_block* b = pool->free_list;
+    while (b) { chain_block* n = b->next; free(b); b = n; }
+    compat_mutex_destroy(&pool->lock);
+    free(pool);
+}
+
+static chain_block* pool_get(iconv_alt_block_pool* pool)
+{
+    compat_mutex_lock(&pool->lock);
+    chain_block* b = pool->free_list;
+    if (b) { pool->free_list = b->next; pool->nfree--; }
+    compat_mutex_unlock(&pool->lock);
+
+    if (!b) {
+        b = (chain_block*)malloc(sizeof(chain_block) + pool->block_size);
+        if (!b) return NULL;
+    }
+    b->next = NULL;
+    b->used = 0;
+    return b;
+}
+
+/* head〜tail を一括でフリーリストへ戻す (上限を超えた分は解放) */
+static void pool_put_list(iconv_alt_block_pool* pool, chain_block* head)
+{
+    compat_mutex_lock(&pool->lock);
+    while (head && (pool->max_free == 0 || pool->nfree < pool->max_free)) {
+        chain_block* n = head->next;
+        head->next = pool->free_list;
+        pool->free_list = head;
+        pool->nfree++;
+        head = n;
+    }
+    compat_mutex_unlock(&pool->lock);
+
+    while (head) { chain_block* n = head->next; free(head); head = n; }
+}
+
+/*======================================================================
+ *  2.  chain
+ *====================================================================*/
+iconv_alt_chain* iconv_alt_chain_create(iconv_alt_block_pool* pool)
+{
+    if (!pool) { errno = EINVAL; return NULL; }
+    iconv_alt_chain* c = (iconv_alt_chain*)calloc(1, sizeof(*c));
+    if (!c) { errno = ENOMEM; return NULL; }
+    c->pool = pool;
+    return c;
+}
+
+void iconv_alt_chain_reset(iconv_alt_chain* chain)
+{
+    if (!chain) return;
+    if (chain->head) pool_put_list(chain->pool, chain->head);
+    chain->head = chain->tail = NULL;
+    chain->total = 0;
+    chain->nblocks = 0;
+}
+
+void iconv_alt_chain_destroy(iconv_alt_chain* chain)
+{
+    if (!chain) return;
+    iconv_alt_chain_reset(chain);
+    free(chain);
+}
+
+static chain_block* chain_grow(iconv_alt_chain* chain)
+{
+    chain_block* b = pool_get(chain->pool);
+    if (!b) return NULL;
+    if (chain->tail) chain->tail->next = b;
+    else             chain->head = b;
+    chain->tail = b;
+    chain->nblocks++;
+    return b;
+}
+
+size_t iconv_alt_chain_convert(iconv_t cd, iconv_alt_chain* chain,
+    char** inbuf, size_t* inbytesleft)
+{
+    if (!chain || !inbuf || !*inbuf || !inbytesleft) { errno = EINVAL; return (size_t)-1; }
+
+    const size_t bs = chain->pool->block_size;
+    for (;;) {
+        chain_block* b = chain->tail;
+        if (!b || b->used == bs) {
+            if (!(b = chain_grow(chain))) { errno = ENOMEM; return (size_t)-1; }
+        }
+
+        char* q = b->data + b->used;
+        size_t room = bs - b->used;
+        size_t r = iconv(cd, inbuf, inbytesleft, &q, &room);
+        size_t wrote = (bs - b->used) - room;
+        b->used += wrote;
+        chain->total += wrote;
+
+        if (r != (size_t)-1) return r;
+        if (errno != E2BIG) return (size_t)-1;
+
+        /* 残りが 1 文字に満たない: 端数は空けたまま次のブロックへ
+           (iov の長さは used なので writev 側で自然に詰まる) */
+        if (b->used == 0) { errno = E2BIG; return (size_t)-1; }
+        if (!chain_grow(chain)) { errno = ENOMEM; return (size_t)-1; }
+    }
+}
+
+/*======================================================================
+ *  3.  アクセサ
+ *====================================================================*/
+size_t iconv_alt_chain_size(const iconv_alt_chain* chain)
+{
+    return chain ? chain->total : 0;
+}
+
+int iconv_alt_chain_iovcnt(const iconv_alt_chain* chain)
+{
+    return chain ? chain->nblocks : 0;
+}
+
+int iconv_alt_chain_iov(const iconv_alt_chain* chain, struct iovec* iov, int iovcnt)
+{
+    int n = 0;
+    if (!chain || !iov) return 0;
+    for (const chain_block* b = chain->head; b && n < iovcnt; b = b->next) {
+        if (b->used == 0) continue;        /* 空ブロックは渡さない */
+        iov[n].iov_base = (void*)b->data;
+        iov[n].iov_len = b->used;
+        n++;
+    }
+    return n;
+}
@@ -0,0 +1,269 @@
+/*----------------------------------------------------------------------
+ *  src/codec.c  —  符号化方式の登録表と、Unicode を介した汎用変換
+ *
+ *  iconv_open() は名前を enc_codecs[] の添字に引き、組ごとに経路を選ぶ:
+ *      CP932 ⇆ UTF-8 : iconv_core.c の専用ループ (M_SJIS2U8 / M_U82SJIS)
+ *      それ以外       : pivot_iconv() (M_PIVOT)
+ *  pivot_iconv() は「1 文字復号 → 1 コード点符号化」を繰り返すだけだが、
+ *  組ごとの核 (pair_kernel) があれば先に呼び、易しい文字の連続をまとめて
+ *  中間表現なしに変換させる (CP932 ⇆ UTF-16 / EUC-JP、UTF-8 ⇆ UTF-16 / UTF-32、
+ *  ISO-2022-JP → CP932 / UTF-8、CP932 → ISO-2022-JP、Shift_JIS-2004 ⇆ UTF-8、表のコードページ ⇆ UTF-8、
+ *  EBCDIC → CP932 / UTF-8)。
+ *  核の無い組でも、両方が ASCII をそのまま表すなら ASCII の連続はまとめて写す。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include <errno.h>
+#include <string.h>
+
+/*======================================================================
+ *  1.  登録表
+ *====================================================================*/
+static const char* const cp932_names[] = {
+    "CP932", "MS932", "WINDOWS-31J",     /* 先頭が iconv_alt_list の代表名 */
+    "SHIFT_JIS", "SHIFT-JIS", "SHIFTJIS", "SJIS",
+    "CSSHIFTJIS", "X-SJIS", "X-MS-CP932",
+    NULL
+};
+static const char* const utf8_names[]    = { "UTF-8", "UTF8", "CSUTF8", NULL };
+
+/* WCHAR_T は処理系の wchar_t (Windows は UTF-16LE、他は 4 byte の UTF-32) */
+#if defined(_WIN32)
+#  define WCHAR_UTF16LE  "WCHAR_T",
+#  define WCHAR_UTF32LE
+#  define WCHAR_UTF32BE
+#elif defined(__BYTE_ORDER__) && __BYTE_ORDER__ == __ORDER_BIG_ENDIAN__
+#  define WCHAR_UTF16LE
+#  define WCHAR_UTF32LE
+#  define WCHAR_UTF32BE  "WCHAR_T",
+#else
+#  define WCHAR_UTF16LE
+#  define WCHAR_UTF32LE  "WCHAR_T",
+#  define WCHAR_UTF32BE
+#endif
+
+static const char* const utf16_names[]   = { "UTF-16", "UTF16", "CSUTF16", NULL };
+static const char* const utf16le_names[] = { "UTF-16LE", "UTF16LE", "CSUTF16LE", WCHAR_UTF16LE NULL };
+static const char* const utf16be_names[] = { "UTF-16BE", "UTF16BE", "CSUTF16BE", NULL };
+static const char* const utf32_names[]   = { "UTF-32", "UTF32", "CSUTF32", NULL };
+static const char* const utf32le_names[] = { "UTF-32LE", "UTF32LE", "CSUTF32LE", "UCS-4LE",
+                                             WCHAR_UTF32LE NULL };
+static const char* const utf32be_names[] = { "UTF-32BE", "UTF32BE", "CSUTF32BE", "UCS-4", "UCS-4BE",
+                                             "ISO-10646-UCS-4", "CSUCS4", WCHAR_UTF32BE NULL };
+static const char* const eucjp_names[]   = { "EUC-JP", "EUCJP", "CSEUCPKDFMTJAPANESE", "X-EUC-JP",
+                                             "CP51932", "WINDOWS-51932", "EUCJP-MS", "EUC-JP-MS",
+                                             "EUCJP-WIN", NULL };
+/* ISO-2022-JP は半角カナを持たない。CP50221 は ESC ( I で半角カナも書く */
+static const char* const iso2022jp_names[] = { "ISO-2022-JP", "ISO2022JP", "CSISO2022JP", NULL };
+static const char* const cp50221_names[] = { "CP50221", "WINDOWS-50221", "ISO-2022-JP-MS",
+                                             "ISO2022JPMS", NULL };
+/* JIS X 0213。1 byte は CP932 と同じ (0x5C / 0x7E は ASCII) */
+static const char* const sjis2004_names[] = { "SHIFT_JIS-2004", "SHIFT_JISX0213", "SJIS-2004",
+                                              "SHIFT-JIS-2004", NULL };
+/* Windows のコードページ (codepage_table.h の表で決まる) */
+static const char* const cp936_names[]  = { "CP936", "GBK", "WINDOWS-936", "MS936", NULL };
+static const char* const cp949_names[]  = { "CP949", "UHC", "WINDOWS-949", "MS949", "KS_C_5601-1987", NULL };
+static const char* const cp950_names[]  = { "CP950", "BIG5", "BIG-5", "WINDOWS-950", "MS950", "CSBIG5", NULL };
+static const char* const cp1250_names[] = { "CP1250", "WINDOWS-1250", "MS-EE", NULL };
+static const char* const cp1251_names[] = { "CP1251", "WINDOWS-1251", "MS-CYRL", NULL };
+static const char* const cp1252_names[] = { "CP1252", "WINDOWS-1252", "MS-ANSI", NULL };
+static const char* const cp1253_names[] = { "CP1253", "WINDOWS-1253", "MS-GREEK", NULL };
+static const char* const cp1254_names[] = { "CP1254", "WINDOWS-1254", "MS-TURK", NULL };
+static const char* const cp1255_names[] = { "CP1255", "WINDOWS-1255", "MS-HEBR", NULL };
+static const char* const cp1256_names[] = { "CP1256", "WINDOWS-1256", "MS-ARAB", NULL };
+static const char* const cp1257_names[] = { "CP1257", "WINDOWS-1257", "WINBALTRIM", NULL };
+static const char* const cp1258_names[] = { "CP1258", "WINDOWS-1258", NULL };
+/* 日本語 EBCDIC (SO/SI で 1 byte と DBCS を切り替える) */
+static const char* const ibm930_names[] = { "IBM-930", "IBM930", "CP930", "CSIBM930", NULL };
+static const char* const ibm939_names[] = { "IBM-939", "IBM939", "CP939", "CSIBM939", NULL };
+
+const enc_codec enc_codecs[ENC_COUNT] = {
+    /* names          decode           encode           split                reset            in bmp max pre order  flags */
+    { cp932_names,   cp932_decode,    cp932_encode,    sjis_split_point,    NULL,            1, 2, 2, 0, 0,        ENC_ASCII | ENC_BMP },
+    { utf8_names,    utf8_decode,     utf8_encode,     utf8_split_point,    NULL,            1, 3, 4, 0, 0,        ENC_ASCII },
+    { utf16_names,   utf16_decode,    utf16_encode,    NULL,                NULL,            2, 2, 4, 2, BO_UNSET, ENC_OUT_STATE },
+    { utf16le_names, utf16le_decode,  utf16le_encode,  utf16le_split_point, NULL,            2, 2, 4, 0, BO_LE,    0 },
+    { utf16be_names, utf16be_decode,  utf16be_encode,  utf16be_split_point, NULL,            2, 2, 4, 0, BO_BE,    0 },
+    { utf32_names,   utf32_decode,    utf32_encode,    NULL,                NULL,            4, 4, 4, 4, BO_UNSET, ENC_OUT_STATE },
+    { utf32le_names, utf32le_decode,  utf32le_encode,  utf32_split_point,   NULL,            4, 4, 4, 0, BO_LE,    0 },
+    { utf32be_names, utf32be_decode,  utf32be_encode,  utf32_split_point,   NULL,            4, 4, 4, 0, BO_BE,    0 },
+    { eucjp_names,   eucjp_decode,    eucjp_encode,    eucjp_split_point,   NULL,            1, 2, 2, 0, 0,        ENC_ASCII | ENC_BMP },
+    { iso2022jp_names, iso2022jp_decode, iso2022jp_encode, NULL,            iso2022jp_reset, 1, 5, 5, 3, 0,        ENC_BMP | ENC_OUT_STATE },
+    { cp50221_names, iso2022jp_decode, cp50221_encode,  NULL,                iso2022jp_reset, 1, 5, 5, 3, 0,        ENC_BMP | ENC_OUT_STATE },
+    { sjis2004_names, sjis2004_decode, sjis2004_encode, sjis_split_point,   sjis2004_reset,  1, 4, 4, 2, 0,        ENC_OUT_STATE },
+    { cp936_names,   codepage_decode, codepage_encode, dbcs_split_point,    NULL,            1, 2, 2, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp949_names,   codepage_decode, codepage_encode, dbcs_split_point,    NULL,            1, 2, 2, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp950_names,   codepage_decode, codepage_encode, dbcs_split_point,    NULL,            1, 2, 2, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1250_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1251_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1252_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1253_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1254_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1255_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1256_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1257_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { cp1258_names,  codepage_decode, codepage_encode, sbcs_split_point,    NULL,            1, 1, 1, 0, 0,        ENC_ASCII | ENC_BMP },
+    { ibm930_names,  ebcdic_decode,   ebcdic_encode,   NULL,                ebcdic_reset,    1, 3, 3, 1, 0,        ENC_BMP | ENC_OUT_STATE },
+    { ibm939_names,  ebcdic_decode,   ebcdic_encode,   NULL,                ebcdic_reset,    1, 3, 3, 1, 0,        ENC_BMP | ENC_OUT_STATE },
+};
+
+/* pivot_one() の 1 歩は 2 コード点の文字 (dpend) で 2 つ書く。表の prefix + 2 × max_out の
+   最大 (ISO-2022-JP の 3 + 2 × 5、BOM 付き UTF-32 の 4 + 2 × 4) が ENC_STEP_MAX に
+   収まることをコンパイル時に確かめる (表の行を変えたらここも直す) */
+typedef char enc_step_max_covers_dpend[(ENC_STEP_MAX >= 3 + 2 * 5 && ENC_STEP_MAX >= 4 + 2 * 4) ? 1 : -1];
+
+/* 大文字小文字を区別せずに比較 */
+static int name_equal(const char* a, const char* n)
+{
+    while (*a && *n) {
+        char ca = (*a >= 'a' && *a <= 'z') ? (char)(*a - 32) : *a;
+        char cn = (*n >= 'a' && *n <= 'z') ? (char)(*n - 32) : *n;
+        if (ca != cn) return 0;
+        ++a; ++n;
+    }
+    return *a == '\0' && *n == '\0';
+}
+
+int enc_lookup(const char* name)
+{
+    if (!name) return -1;
+    for (int e = 0; e < ENC_COUNT; ++e)
+        for (const char* const* a = enc_codecs[e].names; *a; ++a)
+            if (name_equal(*a, name)) return e;
+    return -1;
+}
+
+/* 組ごとの核。無い組は NULL (pivot_iconv が 1 文字ずつ処理する) */
+pair_kernel_fn pair_kernel(enc_id from, enc_id to)
+{
+    int u16_from = from == ENC_UTF16 || from == ENC_UTF16LE || from == ENC_UTF16BE;
+    int u16_to   = to == ENC_UTF16 || to == ENC_UTF16LE || to == ENC_UTF16BE;
+    int u32_from = from == ENC_UTF32 || from == ENC_UTF32LE || from == ENC_UTF32BE;
+    int u32_to   = to == ENC_UTF32 || to == ENC_UTF32LE || to == ENC_UTF32BE;
+    if (from == ENC_CP932 && u16_to) return sjis_to_utf16_kernel;
+    if (u16_from && to == ENC_CP932) return utf16_to_sjis_kernel;
+    if (from == ENC_UTF8 && u16_to)  return utf8_to_utf16_kernel;
+    if (from == ENC_UTF8 && u32_to)  return utf8_to_utf32_kernel;
+    if (u16_from && to == ENC_UTF8)  return utf16_to_utf8_kernel;
+    if (u32_from && to == ENC_UTF8)  return utf32_to_utf8_kernel;
+    if (from == ENC_EUCJP && to == ENC_CP932) return eucjp_to_sjis_kernel;
+    if (from == ENC_CP932 && to == ENC_EUCJP) return sjis_to_eucjp_kernel;
+    if (from == ENC_ISO2022JP || from == ENC_CP50221) {
+        if (to == ENC_CP932) return iso2022jp_to_sjis_kernel;
+        if (to == ENC_UTF8)  return iso2022jp_to_utf8_kernel;
+    }
+    if (from == ENC_CP932 && to == ENC_ISO2022JP) return sjis_to_iso2022jp_kernel;
+    if (from == ENC_CP932 && to == ENC_CP50221)   return sjis_to_cp50221_kernel;
+    if (from == ENC_SJIS2004 && to == ENC_UTF8) return sjis2004_to_utf8_kernel;
+    if (from == ENC_UTF8 && to == ENC_SJIS2004) return utf8_to_sjis2004_kernel;
+    if (from >= ENC_CP936 && from <= ENC_CP1258 && to == ENC_UTF8) return codepage_to_utf8_kernel;
+    if (from == ENC_UTF8 && to >= ENC_CP936 && to <= ENC_CP1258) return utf8_to_codepage_kernel;
+    if (from == ENC_IBM930 || from == ENC_IBM939) {
+        if (to == ENC_CP932) return ebcdic_to_sjis_kernel;
+        if (to == ENC_UTF8)  return ebcdic_to_utf8_kernel;
+    }
+    return NULL;
+}
+
+/*======================================================================
+ *  2.  Unicode を介した iconv()
+ *
+ *  契約は iconv_core.c と同じ:
+ *      EINVAL : 入力末尾の途中の文字は pend に預けて消費したことにする
+ *      EILSEQ : 入力位置はその文字の先頭 (pend から始まる文字なら入力の先頭)
+ *      E2BIG  : 入力位置はその文字の先頭、状態も文字の前へ戻す
+ *====================================================================*/
+/* 1 文字を変換。Return: 消費バイト数 / 0 (EINVAL) / -1 (errno) */
+static int pivot_one(iconv_ctx* c, const unsigned char* p, size_t n,
+    unsigned char** q, unsigned char* qend)
+{
+    uint8_t ds = c->dstate, es = c->estate;
+    uint32_t eh = c->ehold;
+    uint32_t cp;
+    int r = enc_codecs[c->from].decode(c, p, n, &cp);
+    if (r == 0) return 0;
+    if (r < 0) { c->dstate = ds; errno = EILSEQ; return -1; }
+    if (cp != CP_NONE) {
+        size_t room = (size_t)(qend - *q);
+        int w = enc_codecs[c->to].encode(c, cp, *q, room);
+        if (c->dpend) {                     /* 2 コード点の文字: 両方書けて 1 文字 */
+            uint32_t cp2 = c->dpend;
+            c->dpend = 0;
+            if (w >= 0) {
+                int w2 = enc_codecs[c->to].encode(c, cp2, *q + w, room - (size_t)w);
+                w = w2 < 0 ? w2 : w + w2;
+            }
+        }
+        if (w < 0) {
+            c->dstate = ds; c->estate = es; c->ehold = eh;
+            errno = (w == -2) ? E2BIG : EILSEQ;
+            return -1;
+        }
+        *q += w;
+    }
+    return r;
+}
+
+size_t pivot_iconv(iconv_ctx* c, char** inbuf, size_t* inleft,
+    char** outbuf, size_t* outleft)
+{
+    const unsigned char* p = (const unsigned char*)*inbuf;
+    const unsigned char* end = p + *inleft;
+    unsigned char* q = (unsigned char*)*outbuf;
+    unsigned char* qend = q + *outleft;
+    int failed = 0;
+
+    /* --- 前回の途中の文字を今回の入力で完成させる --- */
+    if (c->npend) {
+        unsigned char tmp[2 * sizeof(c->pend)];
+        size_t k = c->npend;
+        size_t take = (size_t)(end - p);
+        if (take > sizeof(tmp) - k) take = sizeof(tmp) - k;
+        memcpy(tmp, c->pend, k);
+        memcpy(tmp + k, p, take);
+        int r = pivot_one(c, tmp, k + take, &q, qend);
+        if (r == 0) {                               /* まだ足りない */
+            memcpy(c->pend + k, p, take);
+            c->npend = (uint8_t)(k + take);
+            p += take;
+            errno = EINVAL; failed = 1;
+        }
+        else if (r < 0) {
+            if (errno == EILSEQ) c->npend = 0;      /* 預けた分は捨てる */
+            failed = 1;
+        }
+        else {
+            p += (size_t)r - k;                     /* 預けた分より長いはず */
+            c->npend = 0;
+        }
+    }
+
+    int ascii = !c->kernel && conv_ascii_identity(c);
+    while (!failed && p < end) {
+        if (c->kernel) {
+            c->kernel(c, &p, end, &q, qend);
+            if (p >= end) break;
+        }
+        else if (ascii && *p < 0x80) {
+            size_t n = ascii_span(p, (size_t)(end - p));
+            if (n > (size_t)(qend - q)) n = (size_t)(qend - q);
+            memcpy(q, p, n);
+            p += n; q += n;
+            if (p >= end) break;
+        }
+        int r = pivot_one(c, p, (size_t)(end - p), &q, qend);
+        if (r > 0) { p += r; continue; }
+        if (r == 0) {                               /* 入力の終わりで文字が途中 */
+            c->npend = (uint8_t)(end - p);
+            memcpy(c->pend, p, c->npend);
+            p = end;
+            errno = EINVAL;
+        }
+        failed = 1;
+    }
+
+    *inleft = (size_t)(end - p);
+    *inbuf = (char*)p;
+    *outleft = (size_t)(qend - q);
+    *outbuf = (char*)q;
+    return failed ? (size_t)-1 : 0;
+}
@@ -0,0 +1,189 @@
+/*----------------------------------------------------------------------
+ *  src/codepage.c  —  表だけで決まるコードページ (Windows の DBCS / SBCS) の共通処理
+ *
+ *      DBCS : CP936 (GBK) / CP949 (UHC) / CP950 (Big5)
+ *      SBCS : CP1250–CP1258
+ *  表は scripts/gen_codepage_table.py がベンダーの CPxxxx.TXT から作る codepage_table.h。
+ *  どのコードページも同じ形 (cp_table_t) なので、復号・符号化・核は 1 組だけで、
+ *  コードページは c->from / c->to から cp_tables[] の表を選ぶだけで決まる:
+ *      復号   : lead2row[b] が 0 なら sb2u[b]、それ以外は db2u[行][trail]
+ *      符号化 : u2cp[u2cp_page[u >> 8]][u & 0xFF] (0x100 以上は 2 byte)
+ *  ASCII の連続は ascii_span (SIMD) でまとめて写す。
+ *  新しいコードページは表を生成し、enc_id と cp_tables[] と enc_codecs[] に
+ *  1 行ずつ足せば、専用のループを書かずに同じ経路に乗る。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include "codepage_table.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+/* enc_id (ENC_CP936 から) → 表 */
+static const cp_table_t* const cp_tables[ENC_CP1258 - ENC_CP936 + 1] = {
+    &CP936_TABLE, &CP949_TABLE, &CP950_TABLE,
+    &CP1250_TABLE, &CP1251_TABLE, &CP1252_TABLE, &CP1253_TABLE, &CP1254_TABLE,
+    &CP1255_TABLE, &CP1256_TABLE, &CP1257_TABLE, &CP1258_TABLE,
+};
+
+static inline const cp_table_t* cp_table(unsigned e) { return cp_tables[e - ENC_CP936]; }
+
+static inline uint16_t cp_from_unicode(const cp_table_t* t, uint32_t u)
+{
+    if (u > 0xFFFF) return CP_NOMAP;
+    return t->u2cp[t->u2cp_page[u >> 8]][u & 0xFF];
+}
+
+/*======================================================================
+ *  1.  1 文字の復号 / 符号化
+ *====================================================================*/
+int codepage_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    const cp_table_t* t = cp_table(c->from);
+    unsigned row = t->lead2row[p[0]];
+    uint16_t u;
+    int len = 1;
+    if (row == 0) u = t->sb2u[p[0]];
+    else {
+        if (n < 2) return 0;
+        u = t->db2u[row][p[1]];
+        len = 2;
+    }
+    if (u == CP_NOMAP) return -1;
+    *cp = u;
+    return len;
+}
+
+int codepage_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    uint16_t s = cp_from_unicode(cp_table(c->to), cp);
+    if (s == CP_NOMAP) return -1;
+    if (s < 0x100) {
+        if (room < 1) return -2;
+        q[0] = (unsigned char)s;
+        return 1;
+    }
+    if (room < 2) return -2;
+    q[0] = (unsigned char)(s >> 8);
+    q[1] = (unsigned char)(s & 0xFF);
+    return 2;
+}
+
+/* 1 byte だけのコードページはどこでも文字の境界 */
+size_t sbcs_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos)
+{
+    (void)in; (void)inlen; (void)lo;
+    return pos;
+}
+
+/* DBCS: trail は 0x40 以上なので、0x40 未満の次のバイトは文字の先頭。
+   見つからなければ lo から 0x81–0xFE を lead として数え直す
+   (CP936 / CP949 / CP950 の lead は全てこの範囲。正しい入力なら境界は合う) */
+size_t dbcs_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos)
+{
+    size_t end = (inlen - pos > 4096) ? pos + 4096 : inlen;
+    for (size_t i = pos; i < end; ++i)
+        if (in[i] < 0x40) return i + 1;
+    size_t q = pos;
+    while (q > lo && in[q - 1] >= 0x40) --q;        /* 直前の確かな境界 */
+    while (q < pos) q += (in[q] >= 0x81 && in[q] <= 0xFE) ? 2 : 1;
+    return q;
+}
+
+/*======================================================================
+ *  2.  コードページ ⇆ UTF-8 の核 (pair_kernel)
+ *====================================================================*/
+static inline unsigned char* put_utf8(unsigned char* q, uint32_t u)
+{
+    if (u < 0x80) { *q = (unsigned char)u; return q + 1; }
+    if (u < 0x800) {
+        q[0] = (unsigned char)(0xC0 | (u >> 6));
+        q[1] = (unsigned char)(0x80 | (u & 0x3F));
+        return q + 2;
+    }
+    q[0] = (unsigned char)(0xE0 | (u >> 12));
+    q[1] = (unsigned char)(0x80 | ((u >> 6) & 0x3F));
+    q[2] = (unsigned char)(0x80 | (u & 0x3F));
+    return q + 3;
+}
+
+void codepage_to_utf8_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    const cp_table_t* t = cp_table(c->from);
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        if (*p < 0x80) {
+            size_t n = ascii_span(p, (size_t)(end - p));
+            if (n > (size_t)(qend - q)) n = (size_t)(qend - q);
+            if (n == 0) break;
+            memcpy(q, p, n);
+            p += n; q += n;
+            continue;
+        }
+        if (qend - q < 3) break;
+        unsigned row = t->lead2row[*p];
+        uint16_t u;
+        if (row == 0) u = t->sb2u[*p];
+        else {
+            if (end - p < 2) break;
+            u = t->db2u[row][p[1]];
+        }
+        if (u == CP_NOMAP) break;                       /* 未定義は 1 文字ずつの経路で */
+        q = put_utf8(q, u);
+        p += row ? 2 : 1;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+void utf8_to_codepage_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    const cp_table_t* t = cp_table(c->to);
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        if (*p < 0x80) {
+            size_t n = ascii_span(p, (size_t)(end - p));
+            if (n > (size_t)(qend - q)) n = (size_t)(qend - q);
+            if (n == 0) break;
+            memcpy(q, p, n);
+            p += n; q += n;
+            continue;
+        }
+        /* 2 / 3 byte の正しい UTF-8 だけ。他は 1 文字ずつの経路でエラーにする */
+        unsigned b = p[0];
+        uint32_t u;
+        int len;
+        if (b >= 0xC2 && b < 0xE0) {
+            if (end - p < 2 || (p[1] & 0xC0) != 0x80) break;
+            u = ((b & 0x1Fu) << 6) | (p[1] & 0x3Fu);
+            len = 2;
+        }
+        else if (b >= 0xE0 && b < 0xF0) {
+            if (end - p < 3 || (p[1] & 0xC0) != 0x80 || (p[2] & 0xC0) != 0x80) break;
+            u = ((b & 0x0Fu) << 12) | ((p[1] & 0x3Fu) << 6) | (p[2] & 0x3Fu);
+            if (u < 0x800 || (u >= 0xD800 && u <= 0xDFFF)) break;
+            len = 3;
+        }
+        else break;
+        uint16_t s = t->u2cp[t->u2cp_page[u >> 8]][u & 0xFF];
+        if (s == CP_NOMAP) break;
+        if (s < 0x100) {
+            if (q >= qend) break;
+            *q++ = (unsigned char)s;
+        }
+        else {
+            if (qend - q < 2) break;
+            q[0] = (unsigned char)(s >> 8);
+            q[1] = (unsigned char)(s & 0xFF);
+            q += 2;
+        }
+        p += len;
+    }
+    *pp = p;
+    *qq = q;
+}
@@ -0,0 +1,203 @@
+/*----------------------------------------------------------------------
+ *  src/compat_thread.h  —  スレッド関連の移植レイヤ (Win32 / POSIX)
+ *  MSVC の C モードでは <threads.h> / <stdatomic.h> が使えないため自前で包む
+ *--------------------------------------------------------------------*/
+#ifndef ICONV_ALT_COMPAT_THREAD_H
+#define ICONV_ALT_COMPAT_THREAD_H
+
+#include <stdint.h>
+#include <stdlib.h>
+
+#if defined(_WIN32)
+#  ifndef WIN32_LEAN_AND_MEAN
+#    define WIN32_LEAN_AND_MEAN
+#  endif
+#  include <windows.h>
+#  include <process.h>
+#else
+#  include <pthread.h>
+#  include <unistd.h>
+#endif
+#if defined(_MSC_VER)
+#  include <intrin.h>
+#endif
+
+/*======================================================================
+ *  1.  mutex
+ *====================================================================*/
+#if defined(_WIN32)
+typedef SRWLOCK compat_mutex;
+static inline void compat_mutex_init(compat_mutex* m)    { InitializeSRWLock(m); }
+static inline void compat_mutex_destroy(compat_mutex* m) { (void)m; }
+static inline void compat_mutex_lock(compat_mutex* m)    { AcquireSRWLockExclusive(m); }
+static inline void compat_mutex_unlock(compat_mutex* m)  { ReleaseSRWLockExclusive(m); }
+#else
+typedef pthread_mutex_t compat_mutex;
+static inline void compat_mutex_init(compat_mutex* m)    { pthread_mutex_init(m, NULL); }
+static inline void compat_mutex_destroy(compat_mutex* m) { pthread_mutex_destroy(m); }
+static inline void compat_mutex_lock(compat_mutex* m)    { pthread_mutex_lock(m); }
+static inline void compat_mutex_unlock(compat_mutex* m)  { pthread_mutex_unlock(m); }
+#endif
+
+/*======================================================================
+ *  2.  condition variable (compat_mutex と組で使う)
+ *====================================================================*/
+#if defined(_WIN32)
+typedef CONDITION_VARIABLE compat_cond;
+static inline void compat_cond_init(compat_cond* c)      { InitializeConditionVariable(c); }
+static inline void compat_cond_destroy(compat_cond* c)   { (void)c; }
+static inline void compat_cond_wait(compat_cond* c, compat_mutex* m)
+{ SleepConditionVariableSRW(c, m, INFINITE, 0); }
+static inline void compat_cond_signal(compat_cond* c)    { WakeConditionVariable(c); }
+static inline void compat_cond_broadcast(compat_cond* c) { WakeAllConditionVariable(c); }
+#else
+typedef pthread_cond_t compat_cond;
+static inline void compat_cond_init(compat_cond* c)      { pthread_cond_init(c, NULL); }
+static inline void compat_cond_destroy(compat_cond* c)   { pthread_cond_destroy(c); }
+static inline void compat_cond_wait(compat_cond* c, compat_mutex* m) { pthread_cond_wait(c, m); }
+static inline void compat_cond_signal(compat_cond* c)    { pthread_cond_signal(c); }
+static inline void compat_cond_broadcast(compat_cond* c) { pthread_cond_broadcast(c); }
+#endif
+
+/*======================================================================
+ *  3.  thread (void fn(void*) を起動して join するだけ)
+ *====================================================================*/
+typedef struct { void (*fn)(void*); void* arg; } compat_thread_start;
+
+#if defined(_WIN32)
+typedef HANDLE compat_thread;
+static inline unsigned __stdcall compat_thread_tramp(void* p)
+{
+    compat_thread_start s = *(compat_thread_start*)p;
+    free(p);
+    s.fn(s.arg);
+    return 0;
+}
+#else
+typedef pthread_t compat_thread;
+static inline void* compat_thread_tramp(void* p)
+{
+    compat_thread_start s = *(compat_thread_start*)p;
+    free(p);
+    s.fn(s.arg);
+    return NULL;
+}
+#endif
+
+/* Return: 0 / -1 */
+static inline int compat_thread_create(compat_thread* t, void (*fn)(void*), void* arg)
+{
+    compat_thread_start* s = (compat_thread_start*)malloc(sizeof(*s));
+    if (!s) return -1;
+    s->fn = fn; s->arg = arg;
+#if defined(_WIN32)
+    *t = (HANDLE)_beginthreadex(NULL, 0, compat_thread_tramp, s, 0, NULL);
+    if (*t == 0) { free(s); return -1; }
+#else
+    if (pthread_create(t, NULL, compat_thread_tramp, s) != 0) { free(s); return -1; }
+#endif
+    return 0;
+}
+
+static inline void compat_thread_join(compat_thread t)
+{
+#if defined(_WIN32)
+    WaitForSingleObject(t, INFINITE);
+    CloseHandle(t);
+#else
+    pthread_join(t, NULL);
+#endif
+}
+
+/* オンラインの論理 CPU 数 (取れなければ 1) */
+static inline unsigned compat_cpu_count(void)
+{
+#if defined(_WIN32)
+    SYSTEM_INFO si;
+    GetSystemInfo(&si);
+    return si.dwNumberOfProcessors ? (unsigned)si.dwNumberOfProcessors : 1u;
+#else
+    long n = sysconf(_SC_NPROCESSORS_ONLN);
+    return n > 0 ? (unsigned)n : 1u;
+#endif
+}
+
+/*======================================================================
+ *  4.  atomics (acquire / release / relaxed / seq_cst の最小セット)
+ *====================================================================*/
+#if defined(_MSC_VER)
+#  if defined(_M_ARM64) || defined(_M_ARM)
+#    define COMPAT_BARRIER() __dmb(_ARM64_BARRIER_ISH)
+#  else
+#    define COMPAT_BARRIER() _ReadWriteBarrier()     /* x86/x64 は TSO */
+#  endif
+static inline uint32_t compat_load_acq_u32(volatile uint32_t* p)
+{ uint32_t v = *p; COMPAT_BARRIER(); return v; }
+static inline void compat_store_rel_u32(volatile uint32_t* p, uint32_t v)
+{ COMPAT_BARRIER(); *p = v; }
+static inline int compat_cas_u32(volatile uint32_t* p, uint32_t expect, uint32_t desired)
+{ return (uint32_t)InterlockedCompareExchange((volatile LONG*)p, (LONG)desired, (LONG)expect) == expect; }
+static inline uint64_t compat_add_u64(volatile uint64_t* p, uint64_t v)
+{ return (uint64_t)InterlockedExchangeAdd64((volatile LONG64*)p, (LONG64)v) + v; }
+static inline uint64_t compat_load_u64(volatile uint64_t* p)
+{ return (uint64_t)InterlockedOr64((volatile LONG64*)p, 0); }
+static inline void compat_fence_acq(void) { COMPAT_BARRIER(); }
+
+/* Chase-Lev deque 用 (64 bit 添字 / ポインタ / 逐次一貫) */
+static inline int64_t compat_load_i64(volatile int64_t* p) { return *p; }
+static inline int64_t compat_load_acq_i64(volatile int64_t* p)
+{ int64_t v = *p; COMPAT_BARRIER(); return v; }
+static inline void compat_store_i64(volatile int64_t* p, int64_t v) { *p = v; }
+static inline int compat_cas_sc_i64(volatile int64_t* p, int64_t expect, int64_t desired)
+{ return InterlockedCompareExchange64((volatile LONG64*)p, desired, expect) == expect; }
+static inline void* compat_load_ptr(void* volatile* p) { return *p; }
+static inline void* compat_load_acq_ptr(void* volatile* p)
+{ void* v = *p; COMPAT_BARRIER(); return v; }
+static inline void compat_store_ptr(void* volatile* p, void* v) { *p = v; }
+static inline void compat_store_rel_ptr(void* volatile* p, void* v)
+{ COMPAT_BARRIER(); *p = v; }
+static inline uint32_t compat_add_sc_u32(volatile uint32_t* p, uint32_t v)
+{ return (uint32_t)InterlockedExchangeAdd((volatile LONG*)p, (LONG)v) + v; }
+static inline uint32_t compat_load_sc_u32(volatile uint32_t* p)
+{ return (uint32_t)InterlockedOr((volatile LONG*)p, 0); }
+static inline void compat_fence_rel(void) { COMPAT_BARRIER(); }
+static inline void compat_fence_sc(void) { MemoryBarrier(); }
+#else
+static inline uint32_t compat_load_acq_u32(volatile uint32_t* p)
+{ return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void compat_store_rel_u32(volatile uint32_t* p, uint32_t v)
+{ __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline int compat_cas_u32(volatile uint32_t* p, uint32_t expect, uint32_t desired)
+{ return __atomic_compare_exchange_n(p, &expect, desired, 0, __ATOMIC_ACQUIRE, __ATOMIC_RELAXED); }
+static inline uint64_t compat_add_u64(volatile uint64_t* p, uint64_t v)
+{ return __atomic_add_fetch(p, v, __ATOMIC_RELAXED); }
+static inline uint64_t compat_load_u64(volatile uint64_t* p)
+{ return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static inline void compat_fence_acq(void) { __atomic_thread_fence(__ATOMIC_ACQUIRE); }
+
+/* Chase-Lev deque 用 (64 bit 添字 / ポインタ / 逐次一貫) */
+static inline int64_t compat_load_i64(volatile int64_t* p)
+{ return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static inline int64_t compat_load_acq_i64(volatile int64_t* p)
+{ return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void compat_store_i64(volatile int64_t* p, int64_t v)
+{ __atomic_store_n(p, v, __ATOMIC_RELAXED); }
+static inline int compat_cas_sc_i64(volatile int64_t* p, int64_t expect, int64_t desired)
+{ return __atomic_compare_exchange_n(p, &expect, desired, 0, __ATOMIC_SEQ_CST, __ATOMIC_RELAXED); }
+static inline void* compat_load_ptr(void* volatile* p)
+{ return __atomic_load_n(p, __ATOMIC_RELAXED); }
+static inline void* compat_load_acq_ptr(void* volatile* p)
+{ return __atomic_load_n(p, __ATOMIC_ACQUIRE); }
+static inline void compat_store_ptr(void* volatile* p, void* v)
+{ __atomic_store_n(p, v, __ATOMIC_RELAXED); }
+static inline void compat_store_rel_ptr(void* volatile* p, void* v)
+{ __atomic_store_n(p, v, __ATOMIC_RELEASE); }
+static inline uint32_t compat_add_sc_u32(volatile uint32_t* p, uint32_t v)
+{ return __atomic_add_fetch(p, v, __ATOMIC_SEQ_CST); }
+static inline uint32_t compat_load_sc_u32(volatile uint32_t* p)
+{ return __atomic_load_n(p, __ATOMIC_SEQ_CST); }
+static inline void compat_fence_rel(void) { __atomic_thread_fence(__ATOMIC_RELEASE); }
+static inline void compat_fence_sc(void) { __atomic_thread_fence(__ATOMIC_SEQ_CST); }
+#endif
+
+#endif /* ICONV_ALT_COMPAT_THREAD_H */
@@ -0,0 +1,62 @@
+/*----------------------------------------------------------------------
+ *  src/convert.c  —  iconv_alt_convert / iconv_alt_measure
+ *  完結した文字列の単発変換と、出力を作らない出力サイズ計測
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include <errno.h>
+
+/* 計測用の捨てバッファ (スタック上) */
+#define MEASURE_SCRATCH  1024
+
+size_t iconv_alt_convert(iconv_t cd, const char* in, size_t inlen,
+    char* out, size_t outlen, size_t* stop)
+{
+    const iconv_ctx* ctx = (const iconv_ctx*)cd;
+    if (!ctx || cd == (iconv_t)-1 || (!in && inlen) || (!out && outlen)) {
+        errno = EINVAL; return (size_t)-1;
+    }
+    size_t wrote, used;
+    if (iconv_ctx_oneshot(ctx, in, inlen, out, outlen, &wrote, &used) < 0) {
+        if (stop) *stop = used;
+        return (size_t)-1;
+    }
+    return wrote;
+}
+
+size_t iconv_alt_measure(iconv_t cd, const char* in, size_t inlen, size_t* stop)
+{
+    const iconv_ctx* ctx = (const iconv_ctx*)cd;
+    if (!ctx || cd == (iconv_t)-1 || (!in && inlen)) {
+        errno = EINVAL; return (size_t)-1;
+    }
+
+    /* ASCII が両側で 1 byte → 1 byte なら数えるだけ */
+    size_t pos = conv_ascii_identity(ctx) ? ascii_span((const unsigned char*)in, inlen) : 0;
+    size_t total = pos;
+
+    /* 残りは一時コンテキストで捨てバッファへ変換し、書いた量を足す。
+       E2BIG は文字境界で止まるので同じ ctx のまま続けられる */
+    iconv_ctx tmp = *ctx;
+    iconv_ctx_reset(&tmp);
+    char scratch[MEASURE_SCRATCH];
+    while (pos < inlen) {
+        char* p = (char*)in + pos;
+        size_t left = inlen - pos;
+        char* q = scratch;
+        size_t room = sizeof(scratch);
+        size_t r = iconv((iconv_t)&tmp, &p, &left, &q, &room);
+        total += sizeof(scratch) - room;
+        pos = inlen - left;
+        if (r != (size_t)-1) break;
+        if (errno == E2BIG) continue;
+
+        if (stop)                     /* EILSEQ: 文字の先頭 / EINVAL: 持ち越し分を戻す */
+            *stop = (errno == EINVAL) ? iconv_ctx_pending_start(&tmp, in, pos) : pos;
+        return (size_t)-1;
+    }
+    char* q = scratch;                /* 終わりのエスケープ (状態付きの出力) */
+    size_t room = sizeof(scratch);
+    iconv((iconv_t)&tmp, NULL, NULL, &q, &room);
+    return total + (sizeof(scratch) - room);
+}
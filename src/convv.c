@@ -0,0 +1,120 @@
+/*----------------------------------------------------------------------
+ *  src/convv.c  —  iconv_alt_convv (scatter / gather 変換)
+ *
+ *  入力 iovec 列・出力 iovec 列をそれぞれ連続したバイト列として扱う。
+ *  入力側で分断された文字は cd の持ち越し状態 (lead / utf8_need) が繋ぎ、
+ *  出力側で入りきらない文字は一時バッファ経由で次のフラグメントへ跨がせる。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include <errno.h>
+#include <string.h>
+
+/* 跨ぎ書き用の一時バッファ (変換 1 歩分の出力。BOM / エスケープと、2 コード点に
+   なる Shift_JIS-2004 の文字の 2 つ分を含めて ENC_STEP_MAX) */
+#define SPILL_MAX  ENC_STEP_MAX
+
+/* 出力位置 (j, off) 以降の空き容量 (limit で打ち切り) */
+static size_t out_room_from(const struct iovec* out, int outn, int j, size_t off, size_t limit)
+{
+    size_t cap = 0;
+    for (; j < outn && cap < limit; ++j, off = 0)
+        cap += out[j].iov_len - off;
+    return (cap < limit) ? cap : limit;
+}
+
+/* 一時バッファの内容を出力フラグメント列へ順に書き込む */
+static void scatter(const char* src, size_t n,
+    struct iovec* out, int outn, iconv_alt_progress* pr)
+{
+    while (n > 0 && pr->out_index < outn) {
+        struct iovec* o = &out[pr->out_index];
+        size_t room = o->iov_len - pr->out_offset;
+        if (room == 0) { pr->out_index++; pr->out_offset = 0; continue; }
+        size_t k = (n < room) ? n : room;
+        memcpy((char*)o->iov_base + pr->out_offset, src, k);
+        src += k; n -= k;
+        pr->out_offset += k; pr->out_total += k;
+    }
+}
+
+/* index 以降に空でない入力フラグメントが残っているか */
+static int more_input(const struct iovec* in, int inn, int index)
+{
+    for (; index < inn; ++index)
+        if (in[index].iov_len) return 1;
+    return 0;
+}
+
+/* 文字がフラグメント境界で分断されただけの EINVAL か (状態で持ち越せる) */
+static int split_char(const struct iovec* in, int inn, const iconv_alt_progress* pr)
+{
+    return errno == EINVAL
+        && pr->in_offset == in[pr->in_index].iov_len
+        && more_input(in, inn, pr->in_index + 1);
+}
+
+/* 現在の入力フラグメントに対して iconv() を 1 回呼び、progress を進める */
+static size_t step(iconv_t cd, const struct iovec* f, iconv_alt_progress* pr,
+    char** op, size_t* ol)
+{
+    char* ip = (char*)f->iov_base + pr->in_offset;
+    size_t il = f->iov_len - pr->in_offset;
+    size_t r = iconv(cd, &ip, &il, op, ol);
+    size_t used = (f->iov_len - pr->in_offset) - il;
+    pr->in_offset += used;
+    pr->in_total += used;
+    return r;
+}
+
+size_t iconv_alt_convv(iconv_t cd,
+    const struct iovec* in, int inn,
+    struct iovec* out, int outn,
+    iconv_alt_progress* progress)
+{
+    iconv_alt_progress* pr = progress;
+    if (!pr || inn < 0 || outn < 0 || (!in && inn) || (!out && outn)) {
+        errno = EINVAL; return (size_t)-1;
+    }
+    pr->in_total = 0;
+    pr->out_total = 0;
+
+    while (pr->in_index < inn) {
+        const struct iovec* f = &in[pr->in_index];
+        if (pr->in_offset >= f->iov_len) {            /* 次の入力フラグメントへ */
+            pr->in_index++; pr->in_offset = 0;
+            continue;
+        }
+        while (pr->out_index < outn && pr->out_offset >= out[pr->out_index].iov_len) {
+            pr->out_index++; pr->out_offset = 0;
+        }
+        if (pr->out_index >= outn) { errno = E2BIG; return (size_t)-1; }
+
+        /* --- 通常: 現在の出力フラグメントへ直接書く --- */
+        struct iovec* o = &out[pr->out_index];
+        char* op = (char*)o->iov_base + pr->out_offset;
+        size_t room = o->iov_len - pr->out_offset;
+        size_t ol = room;
+        size_t r = step(cd, f, pr, &op, &ol);
+        pr->out_offset += room - ol;
+        pr->out_total += room - ol;
+
+        if (r != (size_t)-1) continue;
+        if (split_char(in, inn, pr)) continue;        /* 分断文字: 状態で持ち越し */
+        if (errno != E2BIG) return (size_t)-1;
+
+        /* --- フラグメント末尾の端数: 一時バッファ経由で跨いで書く --- */
+        char tmp[SPILL_MAX];
+        size_t cap = out_room_from(out, outn, pr->out_index, pr->out_offset, sizeof(tmp));
+        char* tq = tmp;
+        size_t tl = cap;
+        r = step(cd, f, pr, &tq, &tl);
+        scatter(tmp, cap - tl, out, outn, pr);
+
+        if (r != (size_t)-1) continue;
+        if (split_char(in, inn, pr)) continue;
+        if (errno == E2BIG && cap - tl > 0) continue;  /* まだ進める */
+        return (size_t)-1;                             /* EILSEQ / 本当に満杯 */
+    }
+    return 0;
+}
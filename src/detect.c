@@ -0,0 +1,298 @@
+/*----------------------------------------------------------------------
+ *  src/detect.c  —  日本語の符号化方式の推定 (UTF-8 / SJIS / EUC-JP / ISO-2022-JP)
+ *
+ *  試しに iconv() で変換してみる代わりに、先頭から 1 回だけ読んで
+ *  4 方式の状態機械を同時に進める。
+ *      ASCII の連続   : ascii_span_noesc() (SSE2 / NEON) で読み飛ばす
+ *      非 ASCII / ESC : 1 byte ずつ各方式に渡し、不正なら候補から外す
+ *  有効な文字には「日本語の文章での出やすさ」で点を付ける
+ *  (かな 4 / 第 1 水準漢字 3 / 句読点・全角英数 2 / その他 1 / 利用者定義 0)。
+ *  SJIS と EUC-JP は区で、UTF-8 はコード点で重みを決める。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include <errno.h>
+#include <string.h>
+
+/* 偶然に正しい UTF-8 になるレガシーな列はまず無いので、UTF-8 の点は重くする */
+#define DETECT_UTF8_FACTOR  4
+
+/*======================================================================
+ *  1.  文字の重み
+ *====================================================================*/
+/* JIS X 0208 の区 (SJIS / EUC-JP / ISO-2022-JP 共通) */
+static unsigned ku_weight(unsigned ku)
+{
+    if (ku == 4 || ku == 5) return 4;               /* ひらがな / カタカナ */
+    if (ku >= 16 && ku <= 47) return 3;             /* 第 1 水準漢字       */
+    if (ku == 1 || ku == 3) return 2;               /* 句読点・記号 / 英数 */
+    if (ku >= 85 && ku <= 88) return 0;             /* 利用者定義 (EUC)    */
+    if (ku >= 95 && ku <= 114) return 0;            /* 利用者定義 (SJIS)   */
+    return 1;
+}
+
+/* 半角カナ (0xA1–0xDF)。句読点 0xA1–0xA5 は文字より軽い */
+static unsigned kana_weight(unsigned b)
+{
+    return b <= 0xA5 ? 1 : 2;
+}
+
+static unsigned ucs_weight(uint32_t cp)
+{
+    if (cp >= 0x3041 && cp <= 0x30FF) return 4;
+    if (cp >= 0x4E00 && cp <= 0x9FFF) return 3;
+    if ((cp >= 0x3000 && cp <= 0x303F) || (cp >= 0xFF01 && cp <= 0xFF5E)) return 2;
+    if (cp >= 0xFF61 && cp <= 0xFF9F) return kana_weight(cp - 0xFF61 + 0xA1);
+    if (cp < 0xA0 || (cp >= 0xE000 && cp <= 0xF8FF) || cp == 0xFEFF) return 0;
+    return 1;
+}
+
+/*======================================================================
+ *  2.  方式ごとの状態機械
+ *====================================================================*/
+typedef struct {
+    unsigned char valid;
+    size_t        chars;
+    unsigned long score;
+} detect_cand;
+
+enum { ISO_ASCII, ISO_ROMAN, ISO_KANA, ISO_JIS0208, ISO_OTHER94x94 };
+
+typedef struct {
+    detect_cand c[ICONV_ALT_DETECT_COUNT];
+    /* UTF-8 */
+    unsigned u_need, u_lo, u_hi;    /* 残りバイト数 / 次のバイトの範囲 */
+    uint32_t u_cp;
+    /* SJIS */
+    unsigned s_lead;
+    /* EUC-JP */
+    unsigned e_need, e_first;       /* e_first: 0x8E / 0x8F / 行バイト */
+    /* ISO-2022-JP */
+    unsigned i_mode, i_first;
+    unsigned char i_esc[4];
+    unsigned i_esc_len;
+} detector;
+
+static void feed_utf8(detector* d, unsigned b)
+{
+    detect_cand* c = &d->c[ICONV_ALT_DETECT_UTF8];
+    if (d->u_need == 0) {
+        if (b < 0x80) return;
+        d->u_lo = 0x80; d->u_hi = 0xBF;
+        if (b >= 0xC2 && b <= 0xDF)      { d->u_need = 1; d->u_cp = b & 0x1F; }
+        else if (b >= 0xE0 && b <= 0xEF) { d->u_need = 2; d->u_cp = b & 0x0F;
+                                           if (b == 0xE0) d->u_lo = 0xA0;   /* 冗長 */
+                                           if (b == 0xED) d->u_hi = 0x9F; } /* サロゲート */
+        else if (b >= 0xF0 && b <= 0xF4) { d->u_need = 3; d->u_cp = b & 0x07;
+                                           if (b == 0xF0) d->u_lo = 0x90;
+                                           if (b == 0xF4) d->u_hi = 0x8F; } /* > U+10FFFF */
+        else c->valid = 0;
+        return;
+    }
+    if (b < d->u_lo || b > d->u_hi) { c->valid = 0; return; }
+    d->u_lo = 0x80; d->u_hi = 0xBF;
+    d->u_cp = (d->u_cp << 6) | (b & 0x3F);
+    if (--d->u_need == 0) {
+        c->chars++;
+        c->score += (unsigned long)ucs_weight(d->u_cp) * DETECT_UTF8_FACTOR;
+    }
+}
+
+static void feed_sjis(detector* d, unsigned b)
+{
+    detect_cand* c = &d->c[ICONV_ALT_DETECT_SJIS];
+    uint32_t u;
+    if (d->s_lead) {
+        unsigned lead = d->s_lead;
+        d->s_lead = 0;
+        if (sjis_to_unicode((uint16_t)((lead << 8) | b), &u) != 0) { c->valid = 0; return; }
+        c->chars++;
+        c->score += ku_weight(sjis_ku(lead, b));
+        return;
+    }
+    if (b < 0x80) return;
+    if (sjis_is_lead(b)) { d->s_lead = b; return; }
+    if (sjis_to_unicode((uint16_t)b, &u) != 0) { c->valid = 0; return; }  /* 0x80 / 0xA0 / 0xFD– */
+    c->chars++;
+    c->score += kana_weight(b);
+}
+
+static void feed_eucjp(detector* d, unsigned b)
+{
+    detect_cand* c = &d->c[ICONV_ALT_DETECT_EUCJP];
+    uint32_t u;
+    if (d->e_need == 0) {
+        if (b < 0x80) return;
+        if (b == 0x8E)                   d->e_need = 1;   /* SS2: 半角カナ         */
+        else if (b == 0x8F)              d->e_need = 2;   /* SS3: JIS X 0212       */
+        else if (b >= 0xA1 && b <= 0xFE) d->e_need = 1;   /* JIS X 0208 の行       */
+        else { c->valid = 0; return; }
+        d->e_first = b;
+        return;
+    }
+    if (d->e_first == 0x8E) {
+        d->e_need = 0;
+        if (b < 0xA1 || b > 0xDF) { c->valid = 0; return; }
+        c->chars++;
+        c->score += kana_weight(b);
+        return;
+    }
+    if (b < 0xA1 || b > 0xFE) { c->valid = 0; return; }
+    if (--d->e_need) return;                              /* SS3 の 1 byte 目 */
+    c->chars++;
+    if (d->e_first == 0x8F) { c->score += 1; return; }
+    unsigned ku = d->e_first - 0xA0;
+    if (sjis_to_unicode(jis_to_sjis(d->e_first - 0x80, b - 0x80), &u) == 0)
+        c->score += ku_weight(ku);
+    else if (ku < 85)                                     /* 85–94 区は利用者定義 */
+        c->valid = 0;
+}
+
+/* ISO-2022-JP の指示 (ESC の後ろ) と切り替え先 */
+static const struct { const char* seq; unsigned mode; } iso_escapes[] = {
+    { "(B", ISO_ASCII },   { "(J", ISO_ROMAN },   { "(I", ISO_KANA },
+    { "$@", ISO_JIS0208 }, { "$B", ISO_JIS0208 }, { "&@", ~0u },      /* 1990 版の告知 */
+    { "$(D", ISO_OTHER94x94 }, { "$(O", ISO_OTHER94x94 },
+    { "$(P", ISO_OTHER94x94 }, { "$(Q", ISO_OTHER94x94 },
+};
+
+static void feed_iso2022jp(detector* d, unsigned b)
+{
+    detect_cand* c = &d->c[ICONV_ALT_DETECT_ISO2022JP];
+    if (b >= 0x80) { c->valid = 0; return; }
+    if (d->i_esc_len) {
+        d->i_esc[d->i_esc_len - 1] = (unsigned char)b;
+        size_t n = d->i_esc_len;
+        for (size_t k = 0; k < sizeof(iso_escapes) / sizeof(iso_escapes[0]); ++k) {
+            if (strncmp(iso_escapes[k].seq, (const char*)d->i_esc, n) != 0) continue;
+            if (iso_escapes[k].seq[n] != '\0') { d->i_esc_len++; return; }   /* 続きを待つ */
+            if (iso_escapes[k].mode != ~0u) d->i_mode = iso_escapes[k].mode;
+            d->i_esc_len = 0;
+            d->i_first = 0;
+            c->score += 1;                                /* 指示そのものも証拠 */
+            return;
+        }
+        c->valid = 0;
+        return;
+    }
+    if (b == 0x1B) { d->i_esc_len = 1; return; }
+    switch (d->i_mode) {
+    case ISO_KANA:
+        if (b >= 0x21 && b <= 0x5F) { c->chars++; c->score += kana_weight(b | 0x80); }
+        else if (b != '\r' && b != '\n') c->valid = 0;
+        break;
+    case ISO_JIS0208:
+    case ISO_OTHER94x94:
+        if (b < 0x21 || b > 0x7E) { c->valid = 0; break; }
+        if (!d->i_first) { d->i_first = b; break; }
+        c->chars++;
+        if (d->i_mode == ISO_JIS0208) {
+            uint32_t u;
+            if (sjis_to_unicode(jis_to_sjis(d->i_first, b), &u) != 0) { c->valid = 0; break; }
+            c->score += ku_weight(d->i_first - 0x20);
+        } else {
+            c->score += 1;
+        }
+        d->i_first = 0;
+        break;
+    default:
+        if (b == 0x0E || b == 0x0F) c->valid = 0;         /* SO / SI は使わない */
+        break;
+    }
+}
+
+/* どの方式も文字の途中ではなく、ASCII をまとめて読み飛ばせる */
+static int detector_idle(const detector* d)
+{
+    const detect_cand* iso = &d->c[ICONV_ALT_DETECT_ISO2022JP];
+    return d->u_need == 0 && d->s_lead == 0 && d->e_need == 0 &&
+        (!iso->valid || (d->i_esc_len == 0 && d->i_mode <= ISO_ROMAN));
+}
+
+/* 証拠のある有効な候補が 1 つだけで、十分な文字数がある */
+static int detector_confident(const detector* d, size_t bom)
+{
+    int n = 0;
+    size_t chars = 0;
+    for (int e = ICONV_ALT_DETECT_UTF8; e < ICONV_ALT_DETECT_COUNT; ++e) {
+        const detect_cand* c = &d->c[e];
+        if (!c->valid || (c->chars == 0 && c->score == 0)) continue;
+        ++n;
+        chars = c->chars + (e == ICONV_ALT_DETECT_UTF8 ? bom : 0);
+    }
+    return n == 1 && chars >= ICONV_ALT_DETECT_CONFIDENT;
+}
+
+/*======================================================================
+ *  3.  公開 API
+ *====================================================================*/
+int iconv_alt_detect(const void* buf, size_t len, iconv_alt_detect_result* result)
+{
+    if (!result || (!buf && len)) { errno = EINVAL; return -1; }
+    const unsigned char* p = (const unsigned char*)buf;
+    size_t n = len < ICONV_ALT_DETECT_MAX_SCAN ? len : ICONV_ALT_DETECT_MAX_SCAN;
+
+    detector d;
+    memset(&d, 0, sizeof(d));
+    for (int e = 0; e < ICONV_ALT_DETECT_COUNT; ++e) d.c[e].valid = 1;
+
+    /* UTF-8 の BOM はそれだけで十分な証拠 */
+    size_t bom = (n >= 3 && p[0] == 0xEF && p[1] == 0xBB && p[2] == 0xBF)
+        ? ICONV_ALT_DETECT_CONFIDENT : 0;
+
+    size_t i = 0;
+    while (i < n) {
+        if (detector_idle(&d)) {
+            i += ascii_span_noesc(p + i, n - i);
+            if (i >= n) break;
+        }
+        unsigned b = p[i++];
+        if (b >= 0x80) d.c[ICONV_ALT_DETECT_ASCII].valid = 0;
+        if (d.c[ICONV_ALT_DETECT_UTF8].valid)      feed_utf8(&d, b);
+        if (d.c[ICONV_ALT_DETECT_SJIS].valid)      feed_sjis(&d, b);
+        if (d.c[ICONV_ALT_DETECT_EUCJP].valid)     feed_eucjp(&d, b);
+        if (d.c[ICONV_ALT_DETECT_ISO2022JP].valid) feed_iso2022jp(&d, b);
+        if (detector_idle(&d) && detector_confident(&d, bom))
+            break;
+    }
+
+    /* 入力の本当の終わりで文字が途中なら不正 (打ち切った場合は問わない) */
+    if (i == len) {
+        if (d.u_need) d.c[ICONV_ALT_DETECT_UTF8].valid = 0;
+        if (d.s_lead) d.c[ICONV_ALT_DETECT_SJIS].valid = 0;
+        if (d.e_need) d.c[ICONV_ALT_DETECT_EUCJP].valid = 0;
+        if (d.i_esc_len || d.i_first) d.c[ICONV_ALT_DETECT_ISO2022JP].valid = 0;
+    }
+
+    /* 証拠のある有効な候補から点の最も高いもの (同点は列挙順) */
+    iconv_alt_encoding best = ICONV_ALT_DETECT_UNKNOWN;
+    unsigned long total = 0;
+    for (int e = ICONV_ALT_DETECT_UTF8; e < ICONV_ALT_DETECT_COUNT; ++e) {
+        const detect_cand* c = &d.c[e];
+        if (!c->valid || (c->chars == 0 && c->score == 0)) continue;
+        total += c->score;
+        if (best == ICONV_ALT_DETECT_UNKNOWN || c->score > d.c[best].score)
+            best = (iconv_alt_encoding)e;
+    }
+    if (best == ICONV_ALT_DETECT_UNKNOWN && d.c[ICONV_ALT_DETECT_ASCII].valid)
+        best = ICONV_ALT_DETECT_ASCII;
+    for (int e = ICONV_ALT_DETECT_UTF8; best == ICONV_ALT_DETECT_UNKNOWN && e < ICONV_ALT_DETECT_COUNT; ++e)
+        if (d.c[e].valid) best = (iconv_alt_encoding)e;     /* 打ち切りで途中の文字だけ */
+
+    static const char* const names[ICONV_ALT_DETECT_COUNT] = {
+        "UTF-8", "UTF-8", "CP932", "EUC-JP", "ISO-2022-JP"
+    };
+    memset(result, 0, sizeof(*result));
+    result->best = best;
+    result->name = best == ICONV_ALT_DETECT_UNKNOWN ? NULL : names[best];
+    result->scanned = i;
+    for (int e = 0; e < ICONV_ALT_DETECT_COUNT; ++e) {
+        result->valid[e] = d.c[e].valid;
+        result->chars[e] = d.c[e].chars;
+        result->score[e] = d.c[e].score;
+    }
+    if (best == ICONV_ALT_DETECT_UNKNOWN) { errno = EILSEQ; return -1; }
+    result->confidence = (best == ICONV_ALT_DETECT_ASCII || total == 0) ? 100u
+        : (unsigned)((d.c[best].score * 100 + total / 2) / total);
+    return 0;
+}
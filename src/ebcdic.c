@@ -0,0 +1,200 @@
+/*----------------------------------------------------------------------
+ *  src/ebcdic.c  —  日本語 EBCDIC (IBM-930 / IBM-939。ホストの SO/SI 混在データ) と、その復号の核
+ *
+ *      IBM-930 : 1 byte は英小文字の代わりに半角カナを持つ (CCSID 290 + 300)
+ *      IBM-939 : 1 byte は英小文字を持つラテン (CCSID 1027 + 300)
+ *  どちらも SO (0x0E) から SI (0x0F) までは 2 byte (lead / trail 0x40–0xFE) の DBCS。
+ *  現在の状態は復号側が dstate、符号化側が estate に持つ (EBC_*)。
+ *  表は scripts/gen_codepage_table.py が作る ebcdic_table.h (codepage.c と同じ cp_table_t。
+ *  lead byte も 1 byte の文字として sb2u に残してあり、状態でどちらを引くか決める)。
+ *  符号化は 1 byte / 2 byte が変わるときだけ SO / SI を書き (最短)、出力の終わりで
+ *  iconv(cd, NULL, ...) → ebcdic_reset() が SI を書いて 1 byte の状態へ戻す。
+ *  U+000E / U+000F は状態を壊すので、どちらの向きでも文字としては扱わない。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include "ebcdic_table.h"
+#include "sjis_table.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define EBC_SO  0x0E
+#define EBC_SI  0x0F
+
+static inline const cp_table_t* ebcdic_table(unsigned e)
+{
+    return e == ENC_IBM930 ? &IBM930_TABLE : &IBM939_TABLE;
+}
+
+/*======================================================================
+ *  1.  1 文字の復号 / 符号化
+ *====================================================================*/
+int ebcdic_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    const cp_table_t* t = ebcdic_table(c->from);
+    unsigned b = p[0];
+    if (b == EBC_SO || b == EBC_SI) {
+        c->dstate = b == EBC_SO ? EBC_DBCS : EBC_SBCS;
+        *cp = CP_NONE;
+        return 1;
+    }
+    uint16_t u;
+    int len = 1;
+    if (c->dstate == EBC_SBCS) u = t->sb2u[b];
+    else {
+        if (n < 2) return 0;
+        u = t->db2u[t->lead2row[b]][p[1]];
+        len = 2;
+    }
+    if (u == CP_NOMAP) return -1;
+    *cp = u;
+    return len;
+}
+
+int ebcdic_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    const cp_table_t* t = ebcdic_table(c->to);
+    if (cp > 0xFFFF) return -1;
+    uint16_t s = t->u2cp[t->u2cp_page[cp >> 8]][cp & 0xFF];
+    if (s == CP_NOMAP) return -1;
+    uint8_t set = s < 0x100 ? EBC_SBCS : EBC_DBCS;
+    size_t shift = (set != c->estate) ? 1 : 0;
+    size_t len = set == EBC_DBCS ? 2 : 1;
+    if (room < shift + len) return -2;
+    if (shift) {
+        *q++ = set == EBC_DBCS ? EBC_SO : EBC_SI;
+        c->estate = set;
+    }
+    if (len == 2) *q++ = (unsigned char)(s >> 8);
+    *q = (unsigned char)(s & 0xFF);
+    return (int)(shift + len);
+}
+
+int ebcdic_reset(iconv_ctx* c, unsigned char* q, size_t room)
+{
+    if (c->estate == EBC_SBCS) return 0;
+    if (room < 1) return -2;
+    q[0] = EBC_SI;
+    c->estate = EBC_SBCS;
+    return 1;
+}
+
+/*======================================================================
+ *  2.  復号の核 (pair_kernel)
+ *
+ *  SO / SI の間の連続を、状態ごとの内側のループでまとめて変換する。
+ *  1 byte の連続は 8 byte ずつ 256 要素の表を引き、8 つとも ASCII になる塊は
+ *  分岐なしで書く (SO / SI / 未定義 / C1 制御は表の値が 0x80 以上なので、
+ *  混ざれば塊をやめて 1 byte ずつ見る)。DBCS は lead → 行 → trail の 2 段の表。
+ *  未定義・途中で切れた 2 byte などでは抜けて pivot_iconv() に 1 文字任せる
+ *  (状態は dstate にあるので続きから戻れる)。
+ *====================================================================*/
+static inline unsigned char* put_utf8(unsigned char* q, uint32_t u)
+{
+    if (u < 0x80) { *q = (unsigned char)u; return q + 1; }
+    if (u < 0x800) {
+        q[0] = (unsigned char)(0xC0 | (u >> 6));
+        q[1] = (unsigned char)(0x80 | (u & 0x3F));
+        return q + 2;
+    }
+    q[0] = (unsigned char)(0xE0 | (u >> 12));
+    q[1] = (unsigned char)(0x80 | ((u >> 6) & 0x3F));
+    q[2] = (unsigned char)(0x80 | (u & 0x3F));
+    return q + 3;
+}
+
+/* 1 byte の文字を 8 byte ずつ引き、全て ASCII になる塊を写す。Return: 変換したバイト数 */
+static inline size_t sbcs_ascii_run(const uint16_t* sb2u, const unsigned char* p,
+    const unsigned char* end, unsigned char* q, unsigned char* qend)
+{
+    size_t lim = (size_t)(end - p);
+    if (lim > (size_t)(qend - q)) lim = (size_t)(qend - q);
+    size_t n = 0;
+    while (lim - n >= 8) {
+        const unsigned char* s = p + n;
+        unsigned u0 = sb2u[s[0]], u1 = sb2u[s[1]], u2 = sb2u[s[2]], u3 = sb2u[s[3]];
+        unsigned u4 = sb2u[s[4]], u5 = sb2u[s[5]], u6 = sb2u[s[6]], u7 = sb2u[s[7]];
+        if ((u0 | u1 | u2 | u3 | u4 | u5 | u6 | u7) >= 0x80) break;
+        unsigned char* d = q + n;
+        d[0] = (unsigned char)u0; d[1] = (unsigned char)u1;
+        d[2] = (unsigned char)u2; d[3] = (unsigned char)u3;
+        d[4] = (unsigned char)u4; d[5] = (unsigned char)u5;
+        d[6] = (unsigned char)u6; d[7] = (unsigned char)u7;
+        n += 8;
+    }
+    return n;
+}
+
+/* SO / SI なら状態を変えて 1 を返す */
+static inline int take_shift(iconv_ctx* c, unsigned b)
+{
+    if (b != EBC_SO && b != EBC_SI) return 0;
+    c->dstate = b == EBC_SO ? EBC_DBCS : EBC_SBCS;
+    return 1;
+}
+
+void ebcdic_to_utf8_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    const cp_table_t* t = ebcdic_table(c->from);
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        if (take_shift(c, *p)) { ++p; continue; }
+        const unsigned char* start = p;
+        if (c->dstate == EBC_SBCS) {
+            for (;;) {
+                size_t n = sbcs_ascii_run(t->sb2u, p, end, q, qend);
+                p += n; q += n;
+                if (p >= end || qend - q < 3) break;
+                uint16_t u = t->sb2u[*p];
+                if (u == CP_NOMAP) break;               /* SO / SI / 未定義 */
+                q = put_utf8(q, u);
+                ++p;
+            }
+        }
+        else {
+            while (end - p >= 2 && qend - q >= 3) {
+                uint16_t u = t->db2u[t->lead2row[p[0]]][p[1]];
+                if (u == CP_NOMAP) break;               /* SI / 未定義 */
+                q = put_utf8(q, u);
+                p += 2;
+            }
+        }
+        if (p == start || (p < end && *p != EBC_SO && *p != EBC_SI)) break;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+void ebcdic_to_sjis_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    const cp_table_t* t = ebcdic_table(c->from);
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        if (take_shift(c, *p)) { ++p; continue; }
+        const unsigned char* start = p;
+        int dbcs = c->dstate == EBC_DBCS;
+        for (;;) {
+            if (!dbcs) {
+                size_t n = sbcs_ascii_run(t->sb2u, p, end, q, qend);
+                p += n; q += n;
+            }
+            if (end - p < 1 + dbcs || qend - q < 2) break;
+            uint16_t u = dbcs ? t->db2u[t->lead2row[p[0]]][p[1]] : t->sb2u[p[0]];
+            if (u == CP_NOMAP) break;                   /* SO / SI / 未定義 */
+            uint16_t s = u < 0x80 ? u : U2SJIS[U2SJIS_PAGE[u >> 8]][u & 0xFF];
+            if (s == SJIS_NOMAP) break;                 /* CP932 に無い (¥ など) */
+            if (s >= 0x100) *q++ = (unsigned char)(s >> 8);
+            *q++ = (unsigned char)(s & 0xFF);
+            p += 1 + dbcs;
+        }
+        if (p == start || (p < end && *p != EBC_SO && *p != EBC_SI)) break;
+    }
+    *pp = p;
+    *qq = q;
+}
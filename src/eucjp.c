@@ -0,0 +1,187 @@
+/*----------------------------------------------------------------------
+ *  src/eucjp.c  —  EUC-JP (CP51932 / eucJP-ms の 2 byte 面) と CP932 ⇆ EUC-JP の核
+ *
+ *      0x00–0x7F          : ASCII
+ *      0x8E + 0xA1–0xDF   : 半角カナ
+ *      0xA1–0xFE の 2 byte : JIS X 0208 の区点 + 0x80
+ *                           (NEC 特殊文字 13 区・NEC 選定 IBM 拡張 89–92 区を含む)
+ *      0x8F + 2 byte      : JIS X 0212 (補助漢字)。表を持たないので EILSEQ
+ *  区点と SJIS は算術で行き来できる (jis_to_sjis / sjis_to_jis) ので、
+ *  Unicode との対応は EUC-JP 専用の表を作らず、SJIS に直して CP932 の表
+ *  (SJIS_DB2U / U2SJIS) を引く。IBM 拡張 (SJIS 0xFA–0xFC) は 94 区に
+ *  収まらないので、符号化では SJIS_IBM2NEC で NEC 選定側へ寄せる (CP51932 と同じ)。
+ *  CP932 ⇆ EUC-JP の核は Unicode を介さない: 漢字の連続は jis.c の SSE2 レーンで
+ *  8 文字ずつ、それ以外の 2 byte は 1 文字ずつ算術で変換し、往復しない区
+ *  (記号・NEC / IBM 拡張) だけ小さな表 SJIS_CANON で正規化する (jis.c)。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include "sjis_table.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define EUC_SS2  0x8E        /* 半角カナの前置 */
+#define EUC_SS3  0x8F        /* JIS X 0212 の前置 */
+
+static inline int is_kana(unsigned b) { return b - 0xA1u <= 0x3Eu; }
+static inline int is_euc(unsigned b)  { return b - 0xA1u <= 0x5Du; }   /* 0xA1–0xFE */
+
+/*======================================================================
+ *  1.  1 文字の復号 / 符号化 (CP932 の表を区点の算術で引く)
+ *====================================================================*/
+int eucjp_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    (void)c;
+    unsigned b = p[0];
+    if (b < 0x80) { *cp = b; return 1; }
+    if (b == EUC_SS2) {
+        if (n < 2) return 0;
+        if (!is_kana(p[1])) return -1;
+        *cp = p[1] + 0xFEC0u;
+        return 2;
+    }
+    if (!is_euc(b)) return -1;                          /* SS3 (JIS X 0212) も */
+    if (n < 2) return 0;
+    if (!is_euc(p[1])) return -1;
+    uint16_t s = jis_to_sjis(b - 0x80, p[1] - 0x80u);
+    uint16_t u = SJIS_DB2U[SJIS_LEAD2ROW[s >> 8]][s & 0xFF];
+    if (u == SJIS_NOMAP) return -1;
+    *cp = u;
+    return 2;
+}
+
+int eucjp_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    (void)c;
+    if (cp < 0x80) {
+        if (room < 1) return -2;
+        q[0] = (unsigned char)cp;
+        return 1;
+    }
+    if (cp > 0xFFFF) return -1;
+    uint16_t s = U2SJIS[U2SJIS_PAGE[cp >> 8]][cp & 0xFF];
+    if (s == SJIS_NOMAP) return -1;
+    if (s < 0x100) {                                    /* 1 byte は半角カナだけ */
+        if (!is_kana(s)) return -1;
+        if (room < 2) return -2;
+        q[0] = EUC_SS2;
+        q[1] = (unsigned char)s;
+        return 2;
+    }
+    if (s >= 0xFA00) {
+        s = SJIS_IBM2NEC[(s >> 8) - 0xFA][s & 0xFF];
+        if (s == SJIS_NOMAP) return -1;
+    }
+    uint16_t j = sjis_to_jis(s >> 8, s & 0xFF);
+    if ((j >> 8) > 0x7E) return -1;                     /* 95 区以降 */
+    if (room < 2) return -2;
+    q[0] = (unsigned char)((j >> 8) | 0x80);
+    q[1] = (unsigned char)((j & 0xFF) | 0x80);
+    return 2;
+}
+
+/*======================================================================
+ *  2.  並列分割: 0xA1 未満のバイトは trail にならないので文字の先頭
+ *====================================================================*/
+size_t eucjp_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos)
+{
+    size_t end = (inlen - pos > 4096) ? pos + 4096 : inlen;
+    for (size_t i = pos; i < end; ++i)
+        if (in[i] < 0xA1) return i;
+    /* 2 byte 文字ばかりが続く: 境界 lo から文字単位で進める */
+    size_t i = lo;
+    while (i < pos) {
+        unsigned b = in[i];
+        i += b == EUC_SS3 ? 3 : (b == EUC_SS2 || b >= 0xA1) ? 2 : 1;
+    }
+    return i < inlen ? i : inlen;
+}
+
+/*======================================================================
+ *  3.  CP932 ⇆ EUC-JP の核 (pair_kernel、Unicode を介さない)
+ *====================================================================*/
+/* ASCII の連続をそのまま写す。Return: 写したバイト数 */
+static inline size_t copy_ascii(const unsigned char* p, const unsigned char* end,
+    unsigned char* q, unsigned char* qend)
+{
+    size_t n = ascii_span(p, (size_t)(end - p));
+    if (n > (size_t)(qend - q)) n = (size_t)(qend - q);
+    memcpy(q, p, n);
+    return n;
+}
+
+void eucjp_to_sjis_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    (void)c;
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        unsigned b = *p;
+        if (b < 0x80) {
+            size_t n = copy_ascii(p, end, q, qend);
+            if (n == 0) break;
+            p += n; q += n;
+            continue;
+        }
+        size_t room = (size_t)(qend - q);
+        size_t n = jis_lanes_to_sjis(p, (size_t)(end - p) < room ? (size_t)(end - p) : room, q, 0x80);
+        if (n) { p += n; q += n; continue; }
+        if (end - p < 2) break;
+        unsigned t = p[1];
+        if (b == EUC_SS2) {
+            if (!is_kana(t) || q >= qend) break;
+            *q++ = (unsigned char)t;
+        }
+        else {
+            if (!is_euc(b) || !is_euc(t) || qend - q < 2) break;
+            uint16_t s = jis_to_sjis_canon(b - 0x80, t - 0x80);
+            if (s == 0) break;                          /* CP932 に無い */
+            q[0] = (unsigned char)(s >> 8);
+            q[1] = (unsigned char)(s & 0xFF);
+            q += 2;
+        }
+        p += 2;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+void sjis_to_eucjp_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    (void)c;
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        unsigned b = *p;
+        if (b < 0x80) {
+            size_t n = copy_ascii(p, end, q, qend);
+            if (n == 0) break;
+            p += n; q += n;
+            continue;
+        }
+        if (qend - q < 2) break;
+        if (is_kana(b)) {
+            q[0] = EUC_SS2;
+            q[1] = (unsigned char)b;
+            p += 1; q += 2;
+            continue;
+        }
+        size_t room = (size_t)(qend - q);
+        size_t n = sjis_lanes_to_jis(p, (size_t)(end - p) < room ? (size_t)(end - p) : room, q, 0x80);
+        if (n) { p += n; q += n; continue; }
+        if (end - p < 2 || !sjis_is_lead(b)) break;
+        unsigned t = p[1];
+        if (t < 0x40 || t == 0x7F || t > 0xFC) break;
+        uint16_t j = sjis_to_jis_canon(b, t);
+        if (j == 0) break;                              /* 未定義 / 外字 */
+        q[0] = (unsigned char)((j >> 8) | 0x80);
+        q[1] = (unsigned char)((j & 0xFF) | 0x80);
+        p += 2; q += 2;
+    }
+    *pp = p;
+    *qq = q;
+}
@@ -0,0 +1,384 @@
+/*----------------------------------------------------------------------
+ *  src/fdconv.c  —  iconv_alt_convert_fd (fd → fd のストリーミング変換)
+ *
+ *  3 段のパイプライン:
+ *      reader スレッド : in[0] / in[1] へ交互に read()
+ *      呼び出しスレッド: in[i] を変換して out[j] へ
+ *      writer スレッド : out[0] / out[1] を交互に write()
+ *  各スロットの full フラグを 1 組の mutex / cond で受け渡す。
+ *  ブロック全体が ASCII なら out[j] は in[i] を指すだけにして (コピーなし)、
+ *  in[i] の解放は writer が書き終えたときに行う。
+ *  ICONV_ALT_FD_NO_THREADS では同じループを read / write 直呼びで回す。
+ *  変換側がエラーで止まったとき、パイプの read() で待っている reader は
+ *  POSIX では wake パイプ (poll) で、Windows では CancelSynchronousIo で起こす。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include "compat_thread.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+#if defined(_WIN32)
+#  include <io.h>
+#else
+#  include <fcntl.h>
+#  include <poll.h>
+#  include <unistd.h>
+#endif
+
+#define FD_BLOCK_MIN  64
+
+/* スロットの状態。素通しした入力は writer が書き終えるまで SLOT_LENT のまま
+   (変換側が同じ内容を 2 度取らないよう SLOT_READY と区別する) */
+enum { SLOT_EMPTY = 0, SLOT_READY = 1, SLOT_LENT = 2 };
+
+/*======================================================================
+ *  1.  read / write (EINTR と部分書き込みを吸収)
+ *====================================================================*/
+static long fd_read(int fd, char* buf, size_t n)
+{
+#if defined(_WIN32)
+    return _read(fd, buf, (unsigned)(n > 0x40000000u ? 0x40000000u : n));
+#else
+    for (;;) {
+        ssize_t r = read(fd, buf, n);
+        if (r < 0 && errno == EINTR) continue;
+        return (long)r;
+    }
+#endif
+}
+
+static int fd_write_all(int fd, const char* p, size_t n)
+{
+    while (n > 0) {
+#if defined(_WIN32)
+        int r = _write(fd, p, (unsigned)(n > 0x40000000u ? 0x40000000u : n));
+#else
+        ssize_t r = write(fd, p, n);
+        if (r < 0 && errno == EINTR) continue;
+#endif
+        if (r <= 0) { if (r == 0) errno = EIO; return -1; }
+        p += r; n -= (size_t)r;
+    }
+    return 0;
+}
+
+/*======================================================================
+ *  2.  パイプラインの状態
+ *====================================================================*/
+typedef struct {
+    char*       data;       /* 固定長バッファ                               */
+    const char* ptr;        /* 出力: 書き出す先頭 (data か素通し元の入力)   */
+    size_t      len;
+    int         full;       /* SLOT_* (出力は 0 / SLOT_READY のみ)           */
+    int         eof, err;   /* 入力: EOF / read の errno                     */
+    int         in_ref;     /* 出力: 素通し元の入力スロット (-1 = なし)      */
+} fd_slot;
+
+typedef struct {
+    int          in_fd, out_fd;
+    size_t       block;
+    int          threaded;
+    compat_mutex mu;
+    compat_cond  cv;
+    fd_slot      in[2], out[2];
+    int          done;      /* 変換側が最後の出力を渡し終えた               */
+    int          stop_read; /* 変換側がもう入力を読まない                   */
+    int          werr;      /* write の errno (0 = なし)                    */
+#if !defined(_WIN32)
+    int          wake[2];   /* reader を poll から起こすパイプ (-1 = なし)  */
+#endif
+    unsigned long long written;
+} fd_pipe;
+
+/* Return: 0 / -1 (止めるよう起こされた。何も読んでいない) */
+static int read_slot(fd_pipe* pp, fd_slot* s)
+{
+#if !defined(_WIN32)
+    if (pp->wake[0] >= 0) {
+        /* 入力が来るか起こされるまで待つ (poll 自体の失敗なら read に任せる) */
+        struct pollfd pf[2] = { { pp->in_fd, POLLIN, 0 }, { pp->wake[0], POLLIN, 0 } };
+        while (poll(pf, 2, -1) < 0 && errno == EINTR) {}
+        if (pf[1].revents) return -1;
+    }
+#endif
+    long n = fd_read(pp->in_fd, s->data, pp->block);
+    s->len = (n > 0) ? (size_t)n : 0;
+    s->eof = (n == 0);
+    s->err = (n < 0) ? errno : 0;
+    return 0;
+}
+
+static void write_slot(fd_pipe* pp, fd_slot* o)
+{
+    if (pp->werr) return;
+    if (fd_write_all(pp->out_fd, o->ptr, o->len) < 0) pp->werr = errno;
+    else pp->written += o->len;
+}
+
+/*======================================================================
+ *  3.  reader / writer スレッド
+ *====================================================================*/
+static void reader_main(void* arg)
+{
+    fd_pipe* pp = (fd_pipe*)arg;
+    for (int i = 0;; i ^= 1) {
+        fd_slot* s = &pp->in[i];
+        compat_mutex_lock(&pp->mu);
+        while (s->full && !pp->stop_read && !pp->werr) compat_cond_wait(&pp->cv, &pp->mu);
+        int stop = pp->stop_read || pp->werr;
+        compat_mutex_unlock(&pp->mu);
+        if (stop) return;
+
+        if (read_slot(pp, s) < 0) return; /* ロック外で読む (変換と重なる) */
+
+        compat_mutex_lock(&pp->mu);
+        s->full = SLOT_READY;
+        compat_cond_broadcast(&pp->cv);
+        compat_mutex_unlock(&pp->mu);
+        if (s->eof || s->err) return;
+    }
+}
+
+static void writer_main(void* arg)
+{
+    fd_pipe* pp = (fd_pipe*)arg;
+    for (int j = 0;; j ^= 1) {
+        fd_slot* o = &pp->out[j];
+        compat_mutex_lock(&pp->mu);
+        while (!o->full && !pp->done) compat_cond_wait(&pp->cv, &pp->mu);
+        int have = o->full;
+        compat_mutex_unlock(&pp->mu);
+        if (!have) return;                /* done かつ残りなし */
+
+        write_slot(pp, o);                /* エラー後は書かずに空けるだけ */
+
+        compat_mutex_lock(&pp->mu);
+        o->full = SLOT_EMPTY;
+        if (o->in_ref >= 0) { pp->in[o->in_ref].full = SLOT_EMPTY; o->in_ref = -1; }
+        compat_cond_broadcast(&pp->cv);
+        compat_mutex_unlock(&pp->mu);
+    }
+}
+
+/*======================================================================
+ *  4.  変換側のスロット操作 (NO_THREADS なら I/O を直接行う)
+ *      take_* は write エラーで止まったとき NULL を返す
+ *====================================================================*/
+static fd_slot* take_input(fd_pipe* pp, int i)
+{
+    fd_slot* s = &pp->in[i];
+    if (!pp->threaded) {
+        if (pp->werr) return NULL;
+        (void)read_slot(pp, s); s->full = SLOT_READY;
+        return s;
+    }
+    compat_mutex_lock(&pp->mu);
+    while (s->full != SLOT_READY && !pp->werr) compat_cond_wait(&pp->cv, &pp->mu);
+    int bad = pp->werr;
+    compat_mutex_unlock(&pp->mu);
+    return bad ? NULL : s;
+}
+
+static void release_input(fd_pipe* pp, int i)
+{
+    compat_mutex_lock(&pp->mu);
+    pp->in[i].full = SLOT_EMPTY;
+    compat_cond_broadcast(&pp->cv);
+    compat_mutex_unlock(&pp->mu);
+}
+
+static fd_slot* take_output(fd_pipe* pp, int j)
+{
+    fd_slot* o = &pp->out[j];
+    compat_mutex_lock(&pp->mu);
+    while (o->full && !pp->werr) compat_cond_wait(&pp->cv, &pp->mu);
+    int bad = pp->werr;
+    compat_mutex_unlock(&pp->mu);
+    if (bad) return NULL;
+    o->ptr = o->data; o->len = 0; o->in_ref = -1;
+    return o;
+}
+
+static void submit_output(fd_pipe* pp, fd_slot* o)
+{
+    if (!pp->threaded) {
+        write_slot(pp, o);
+        if (o->in_ref >= 0) pp->in[o->in_ref].full = SLOT_EMPTY;
+        o->in_ref = -1;
+        return;
+    }
+    compat_mutex_lock(&pp->mu);
+    if (o->in_ref >= 0) pp->in[o->in_ref].full = SLOT_LENT;
+    o->full = SLOT_READY;
+    compat_cond_broadcast(&pp->cv);
+    compat_mutex_unlock(&pp->mu);
+}
+
+/* 入力の終わり: 状態付きの出力を初期状態へ戻す列 (ESC ( B など) を書く */
+static int finish_output(fd_pipe* pp, iconv_ctx* cd, size_t out_cap, int j)
+{
+    fd_slot* o = take_output(pp, j);
+    if (!o) return 0;
+    char* op = o->data;
+    size_t ol = out_cap;
+    if (iconv((iconv_t)cd, NULL, NULL, &op, &ol) == (size_t)-1) return errno;
+    o->len = out_cap - ol;
+    if (o->len > 0) submit_output(pp, o);
+    return 0;
+}
+
+/*======================================================================
+ *  5.  変換ループ
+ *  Return: 0 / errno (EILSEQ / read の errno / 末尾不完全 EINVAL)
+ *====================================================================*/
+static int run(fd_pipe* pp, iconv_ctx* cd, size_t out_cap, iconv_alt_fd_options* st)
+{
+    int i = 0, j = 0, pending = 0, err = 0;
+
+    for (;; i ^= 1) {
+        fd_slot* s = take_input(pp, i);
+        if (!s) break;
+        if (s->err) { err = s->err; break; }
+        if (s->eof) { err = pending ? EINVAL : finish_output(pp, cd, out_cap, j); break; }
+
+        /* --- ブロック全体が ASCII: 入力バッファをそのまま書く --- */
+        if (!pending && conv_ascii_identity(cd) && ascii_span((const unsigned char*)s->data, s->len) == s->len) {
+            fd_slot* o = take_output(pp, j);
+            if (!o) break;
+            st->in_total += s->len;             /* 渡した後の s は reader が上書きし得る */
+            st->ascii_blocks++;
+            o->ptr = s->data; o->len = s->len; o->in_ref = i;   /* 解放は書き終えてから */
+            submit_output(pp, o);
+            j ^= 1;
+            continue;
+        }
+
+        /* --- 変換 (out_cap は 1 ブロック分の最悪値なので通常 1 回で済む) --- */
+        char* ip = s->data;
+        size_t il = s->len;
+        int stopped = 0;
+        while (il > 0 && !err) {
+            fd_slot* o = take_output(pp, j);
+            if (!o) { stopped = 1; break; }
+            char* op = o->data;
+            size_t ol = out_cap;
+            size_t before = il;
+            size_t r = iconv((iconv_t)cd, &ip, &il, &op, &ol);
+            int e = errno;
+            st->in_total += before - il;
+            o->len = out_cap - ol;
+
+            if (r != (size_t)-1) pending = 0;
+            else if (e == EINVAL) pending = 1;      /* 分断文字: 次のブロックへ持ち越し */
+            else if (e == EILSEQ) err = EILSEQ;     /* 手前までは書き出してから止まる */
+            /* E2BIG: 次の出力スロットで続ける */
+
+            if (o->len > 0) { submit_output(pp, o); j ^= 1; }
+            else if (!err && e == E2BIG && r == (size_t)-1) { err = E2BIG; break; }
+        }
+        release_input(pp, i);
+        if (err || stopped) break;
+    }
+    return err;
+}
+
+/*======================================================================
+ *  6.  公開 API
+ *====================================================================*/
+int iconv_alt_convert_fd(iconv_t cd, int in_fd, int out_fd,
+    iconv_alt_fd_options* options)
+{
+    iconv_ctx* ctx = (iconv_ctx*)cd;
+    if (!ctx || cd == (iconv_t)-1 || in_fd < 0 || out_fd < 0) {
+        errno = EINVAL; return -1;
+    }
+
+    iconv_alt_fd_options local;
+    memset(&local, 0, sizeof(local));
+    iconv_alt_fd_options* st = options ? options : &local;
+    st->in_total = st->out_total = st->ascii_blocks = 0;
+
+    fd_pipe pp;
+    memset(&pp, 0, sizeof(pp));
+    pp.in_fd = in_fd;
+    pp.out_fd = out_fd;
+    pp.block = st->block_size ? st->block_size : ICONV_ALT_FD_BLOCK_DEFAULT;
+    if (pp.block < FD_BLOCK_MIN) pp.block = FD_BLOCK_MIN;
+    pp.threaded = !(st->flags & ICONV_ALT_FD_NO_THREADS);
+#if !defined(_WIN32)
+    pp.wake[0] = pp.wake[1] = -1;
+#endif
+
+    size_t out_cap = conv_max_output(ctx, pp.block);
+    int err = 0;
+    for (int k = 0; k < 2; ++k) {
+        pp.in[k].data = (char*)malloc(pp.block);
+        pp.out[k].data = (char*)malloc(out_cap);
+        pp.out[k].in_ref = -1;
+        if (!pp.in[k].data || !pp.out[k].data) err = ENOMEM;
+    }
+
+    compat_thread rd, wr;
+    int have_rd = 0, have_wr = 0;
+    if (!err) {
+        compat_mutex_init(&pp.mu);
+        compat_cond_init(&pp.cv);
+        if (pp.threaded) {
+            /* スレッドが作れなければ同期で。writer を先に立てる: writer は入力に
+               触れないので、reader が作れなくても止めてから同期に切り替えられる */
+#if !defined(_WIN32)
+            if (pipe(pp.wake) == 0) {             /* 作れなければ起こさずに待つだけ */
+                fcntl(pp.wake[0], F_SETFD, FD_CLOEXEC);
+                fcntl(pp.wake[1], F_SETFD, FD_CLOEXEC);
+            } else pp.wake[0] = pp.wake[1] = -1;
+#endif
+            have_wr = compat_thread_create(&wr, writer_main, &pp) == 0;
+            have_rd = have_wr && compat_thread_create(&rd, reader_main, &pp) == 0;
+            if (!have_rd) {
+                if (have_wr) {
+                    compat_mutex_lock(&pp.mu);
+                    pp.done = 1;
+                    compat_cond_broadcast(&pp.cv);
+                    compat_mutex_unlock(&pp.mu);
+                    compat_thread_join(wr);
+                    have_wr = 0;
+                    pp.done = 0;
+                }
+                pp.threaded = 0;
+            }
+        }
+        err = run(&pp, ctx, out_cap, st);
+
+        compat_mutex_lock(&pp.mu);
+        pp.done = 1;
+        pp.stop_read = 1;
+        compat_cond_broadcast(&pp.cv);
+        compat_mutex_unlock(&pp.mu);
+        if (have_wr) compat_thread_join(wr);      /* 残りを書き切る */
+        if (have_rd) {                            /* 入力待ちの reader を起こす */
+#if defined(_WIN32)
+            while (WaitForSingleObject(rd, 10) == WAIT_TIMEOUT) CancelSynchronousIo(rd);
+#else
+            if (pp.wake[1] >= 0) {
+                char c = 0;
+                while (write(pp.wake[1], &c, 1) < 0 && errno == EINTR) {}
+            }
+#endif
+            compat_thread_join(rd);
+        }
+#if !defined(_WIN32)
+        if (pp.wake[0] >= 0) { close(pp.wake[0]); close(pp.wake[1]); }
+#endif
+
+        compat_cond_destroy(&pp.cv);
+        compat_mutex_destroy(&pp.mu);
+    }
+
+    for (int k = 0; k < 2; ++k) { free(pp.in[k].data); free(pp.out[k].data); }
+    st->out_total = pp.written;
+
+    if (pp.werr) err = pp.werr;
+    if (err) { errno = err; return -1; }
+    return 0;
+}
@@ -1,22 +1,16 @@
 /*----------------------------------------------------------------------
  *  src/iconv_core.c  ―  iconv_open / iconv / iconv_close
  *  SJIS ⇆ UTF‑8   (CP932 superset)  —  完全ストリーム対応
+ *  その他の組 (UTF-16 など) は codec.c の pivot_iconv() へ回す
  *--------------------------------------------------------------------*/
 #define _CRT_SECURE_NO_WARNINGS
-#include "iconv.h"
-#include "sjis_table.h"            /* SJIS_MAP[]                       */
+#include "iconv_alt.h"          /* iconv.h + iconv_alt_list            */
+#include "iconv_internal.h"        /* iconv_ctx / 内部関数宣言          */
 #include <errno.h>
 #include <stdint.h>
 #include <stdlib.h>
 #include <string.h>
 
-/*======================================================================
- *  0.  External functions (defined in sjis.c and utf8.c)
- *====================================================================*/
-extern int sjis_to_unicode(uint16_t code, uint32_t* uni);
-extern int unicode_to_sjis(uint32_t uni, uint16_t* sjis);
-extern int u32_to_utf8(uint32_t cp, char* out);
-
 static int utf8_feed(uint8_t byte, uint8_t* buf, uint8_t* need, uint32_t* cp)
 {
     /* Feed one byte; buf[0..*need-1] contains sequence being built.
@@ -34,81 +28,29 @@ static int utf8_feed(uint8_t byte, uint8_t* buf, uint8_t* need, uint32_t* cp)
     return (*need == 0) ? 1 : 0;
 }
 
-/*======================================================================
- *  2.  状態構造体
- *====================================================================*/
-typedef enum { M_SJIS2U8, M_U82SJIS } conv_mode;
-
-typedef struct {
-    conv_mode mode;
-    /* --- pending for SJIS -> UTF‑8 --- */
-    uint8_t    lead;          /* first byte saved          */
-    uint8_t    have_lead;     /* 1 if lead is valid        */
-    /* --- pending for UTF‑8 -> SJIS --- */
-    uint8_t    utf8_need;     /* bytes still needed        */
-    uint32_t   utf8_cp;       /* partially built scalar    */
-} iconv_ctx;
-
 /*======================================================================
  *  3.  iconv_open / close
  *====================================================================*/
 
-/* Check if encoding name matches SJIS variants (case-insensitive) */
-static int is_sjis_encoding(const char* name)
-{
-    /* Common SJIS aliases */
-    static const char* sjis_aliases[] = {
-        "SHIFT_JIS", "SHIFT-JIS", "SHIFTJIS",
-        "SJIS", "CP932", "MS932", "WINDOWS-31J",
-        "CSSHIFTJIS", "X-SJIS", "X-MS-CP932",
-        NULL
-    };
-    for (const char** p = sjis_aliases; *p; ++p) {
-        const char* a = *p;
-        const char* n = name;
-        /* Case-insensitive comparison */
-        while (*a && *n) {
-            char ca = (*a >= 'a' && *a <= 'z') ? (*a - 32) : *a;
-            char cn = (*n >= 'a' && *n <= 'z') ? (*n - 32) : *n;
-            if (ca != cn) break;
-            ++a; ++n;
-        }
-        if (*a == '\0' && *n == '\0') return 1;
-    }
-    return 0;
-}
-
-/* Check if encoding name matches UTF-8 variants (case-insensitive) */
-static int is_utf8_encoding(const char* name)
-{
-    static const char* utf8_aliases[] = {
-        "UTF-8", "UTF8", "CSUTF8",
-        NULL
-    };
-    for (const char** p = utf8_aliases; *p; ++p) {
-        const char* a = *p;
-        const char* n = name;
-        while (*a && *n) {
-            char ca = (*a >= 'a' && *a <= 'z') ? (*a - 32) : *a;
-            char cn = (*n >= 'a' && *n <= 'z') ? (*n - 32) : *n;
-            if (ca != cn) break;
-            ++a; ++n;
-        }
-        if (*a == '\0' && *n == '\0') return 1;
-    }
-    return 0;
-}
-
+/* 名前は codec.c の enc_codecs[] で引く (大文字小文字は区別しない) */
 iconv_t iconv_open(const char* tocode, const char* fromcode)
 {
     iconv_ctx* c = (iconv_ctx*)calloc(1, sizeof(iconv_ctx));
     if (!c) return (iconv_t)-1;
 
-    if (is_sjis_encoding(fromcode) && is_utf8_encoding(tocode))
+    int from = enc_lookup(fromcode), to = enc_lookup(tocode);
+    if (from < 0 || to < 0) { free(c); errno = EINVAL; return (iconv_t)-1; }
+    c->from = (uint8_t)from;
+    c->to = (uint8_t)to;
+
+    if (from == ENC_CP932 && to == ENC_UTF8)
         c->mode = M_SJIS2U8;
-    else if (is_utf8_encoding(fromcode) && is_sjis_encoding(tocode))
+    else if (from == ENC_UTF8 && to == ENC_CP932)
         c->mode = M_U82SJIS;
-    else { free(c); errno = EINVAL; return (iconv_t)-1; }
+    else {                                   /* Unicode を介す (codec.c) */
+        c->mode = M_PIVOT;
+        c->kernel = pair_kernel((enc_id)from, (enc_id)to);
+    }
 
     return (iconv_t)c;
 }
@@ -119,6 +61,32 @@ int iconv_close(iconv_t cd)
     return 0;
 }
 
+/* 対応する符号化方式を 1 つずつ (別名の組で) 渡す。do_one が非 0 なら打ち切る */
+void iconv_alt_list(int (*do_one)(unsigned int namescount,
+    const char* const* names, void* data), void* data)
+{
+    for (int e = 0; e < ENC_COUNT; ++e) {
+        const char* const* names = enc_codecs[e].names;
+        unsigned int n = 0;
+        while (names[n]) ++n;
+        if (do_one(n, names, data)) return;
+    }
+}
+
+/* 入力側の符号化方式で in の先頭 1 文字を読む。cd の状態 (G0 の文字集合、
+   BOM で決めた順序など) は写しに対して進めるので cd 自体は変わらない */
+int iconv_alt_char_length(iconv_t cd, const char* in, size_t inlen)
+{
+    const iconv_ctx* ctx = (const iconv_ctx*)cd;
+    if (!ctx || cd == (iconv_t)-1 || (!in && inlen)) { errno = EINVAL; return -1; }
+    if (inlen == 0) return 0;
+    iconv_ctx c = *ctx;
+    uint32_t cp;
+    int r = enc_codecs[c.from].decode(&c, (const unsigned char*)in, inlen, &cp);
+    if (r < 0) errno = EILSEQ;
+    return r;
+}
+
 /*======================================================================
  *  4.  iconv() 本体
  *====================================================================*/
@@ -137,26 +105,47 @@ static int put_sjis(uint16_t sj, char** out, size_t* left)   /* helper */
     return 0;
 }
 
+/* 入力なしの呼び出し (POSIX): 出力を初期状態へ戻す列 (ISO-2022-JP の
+   ESC ( B など) を書き、持ち越し状態を捨てる。出力先が無ければ捨てるだけ */
+static size_t iconv_ctx_finish(iconv_ctx* ctx, char** outbuf, size_t* outbytesleft)
+{
+    enc_reset_fn reset = ctx->mode == M_PIVOT ? enc_codecs[ctx->to].reset : NULL;
+    if (reset && outbuf && *outbuf && outbytesleft) {
+        int w = reset(ctx, (unsigned char*)*outbuf, *outbytesleft);
+        if (w < 0) { errno = E2BIG; return (size_t)-1; }
+        *outbuf += w;
+        *outbytesleft -= (size_t)w;
+    }
+    iconv_ctx_reset(ctx);
+    return 0;
+}
+
 size_t iconv(iconv_t cd,
     char** inbuf, size_t* inbytesleft,
     char** outbuf, size_t* outbytesleft)
 {
     iconv_ctx* ctx = (iconv_ctx*)cd;
-    if (!inbuf || !*inbuf) { errno = EINVAL; return (size_t)-1; }
+    if (!inbuf || !*inbuf)
+        return iconv_ctx_finish(ctx, outbuf, outbytesleft);
+    if (ctx->mode == M_PIVOT)
+        return pivot_iconv(ctx, inbuf, inbytesleft, outbuf, outbytesleft);
 
     const unsigned char* p = (const unsigned char*)(*inbuf);
     const unsigned char* end = p + *inbytesleft;
     char* q = *outbuf;
     size_t  l = *outbytesleft;
 
+    /* エラー時の入力位置は「その文字の先頭」に戻す。
+       E2BIG なら出力を空けて同じ位置から再開でき、EILSEQ なら
+       呼び出し側が不正バイトを読み飛ばせる (POSIX と同じ契約)。 */
     if (ctx->mode == M_SJIS2U8) {
         while (p < end) {
+            const unsigned char* mark = p;   /* この文字の先頭 */
             uint16_t sj;
 
             /* --- バイト取得 SJIS --- */
             if (ctx->have_lead) {          /* 前回残った 1 バイトと結合 */
-                sj = (ctx->lead << 8) | *p;
-                ctx->have_lead = 0;  p++;
+                sj = (ctx->lead << 8) | *p++;
             }
             else {
                 uint8_t b = *p++;
@@ -173,27 +162,36 @@ size_t iconv(iconv_t cd,
 
             /* --- SJIS -> Unicode --- */
             uint32_t uni;
-            if (sjis_to_unicode(sj, &uni) != 0) { errno = EILSEQ; goto stop_err; }
+            if (sjis_to_unicode(sj, &uni) != 0) {
+                ctx->have_lead = 0; p = mark;        /* 持ち越しの lead は破棄 */
+                errno = EILSEQ; goto stop_err;
+            }
 
             /* --- Unicode -> UTF‑8 put --- */
             char tmp[4]; int n = u32_to_utf8(uni, tmp);
-            if (l < (size_t)n) { p -= (ctx->have_lead ? 0 : 0); errno = E2BIG; goto stop_err; }
+            if (l < (size_t)n) { p = mark; errno = E2BIG; goto stop_err; } /* lead は保持 */
             memcpy(q, tmp, n); q += n; l -= n;
+            ctx->have_lead = 0;
         }
     }
     else {  /* -------- UTF‑8 -> SJIS -------- */
         while (p < end) {
-            int st = utf8_feed(*p++, &ctx->utf8_need, &ctx->utf8_need, &ctx->utf8_cp);
-            if (st < 0) { errno = EILSEQ; goto stop_err; }
-            if (st == 0) {               /* more bytes needed */
-                if (p == end) { errno = EINVAL; goto stop_err; }
-                continue;
-            }
+            const unsigned char* mark = p;
+            uint8_t  save_need = ctx->utf8_need;     /* E2BIG 時の巻き戻し用 */
+            uint32_t save_cp = ctx->utf8_cp;
+            int st;
+            do st = utf8_feed(*p++, &ctx->utf8_need, &ctx->utf8_need, &ctx->utf8_cp);
+            while (st == 0 && p < end);
+            if (st < 0) { ctx->utf8_need = 0; p = mark; errno = EILSEQ; goto stop_err; }
+            if (st == 0) { errno = EINVAL; goto stop_err; }  /* more bytes needed */
+
             /* 完成したコードポイント */
             uint16_t sj;
-            if (unicode_to_sjis(ctx->utf8_cp, &sj) != 0) { errno = EILSEQ; goto stop_err; }
-            if (put_sjis(sj, &q, &l) < 0) { errno = E2BIG; goto stop_err; }
-            ctx->utf8_need = 0;
+            if (unicode_to_sjis(ctx->utf8_cp, &sj) != 0) { p = mark; errno = EILSEQ; goto stop_err; }
+            if (put_sjis(sj, &q, &l) < 0) {
+                ctx->utf8_need = save_need; ctx->utf8_cp = save_cp; p = mark;
+                errno = E2BIG; goto stop_err;
+            }
         }
     }
 
@@ -211,3 +209,33 @@ stop_err:
     *outbuf = q;
     return (size_t)-1;
 }
+
+/*======================================================================
+ *  5.  単発変換 (拡張 API 共通の内部ヘルパ)
+ *
+ *  proto の mode だけを借り、持ち越し状態は空の一時コンテキストで
+ *  in を完結した文字列として変換する。proto は読むだけなので、
+ *  同じ cd を複数スレッドから共有しても安全。
+ *  Return: 0 / -1 (errno)。*written / *consumed は失敗時も更新する。
+ *          EINVAL (末尾の不完全な文字) では *consumed はその文字の先頭。
+ *====================================================================*/
+int iconv_ctx_oneshot(const iconv_ctx* proto, const char* in, size_t inlen,
+    char* out, size_t outlen, size_t* written, size_t* consumed)
+{
+    iconv_ctx tmp = *proto;
+    iconv_ctx_reset(&tmp);
+
+    char* p = (char*)in;
+    size_t left = inlen;
+    char* q = out;
+    size_t room = outlen;
+    size_t r = iconv((iconv_t)&tmp, &p, &left, &q, &room);
+    if (r != (size_t)-1)
+        r = iconv((iconv_t)&tmp, NULL, NULL, &q, &room);   /* 終わりのエスケープ */
+    size_t used = inlen - left;
+    if (r == (size_t)-1 && errno == EINVAL)
+        used = iconv_ctx_pending_start(&tmp, in, used);
+    if (written)  *written = outlen - room;
+    if (consumed) *consumed = used;
+    return (r == (size_t)-1) ? -1 : 0;
+}
@@ -0,0 +1,356 @@
+/*----------------------------------------------------------------------
+ *  src/iconv_internal.h  —  ライブラリ内部で共有する状態構造体と関数宣言
+ *  (公開ヘッダではない。include/ には置かないこと)
+ *--------------------------------------------------------------------*/
+#ifndef ICONV_ALT_INTERNAL_H
+#define ICONV_ALT_INTERNAL_H
+
+#include <stddef.h>
+#include <stdint.h>
+
+/*======================================================================
+ *  1.  変換ディスクリプタ (iconv_t の実体)
+ *====================================================================*/
+/* SJIS ⇆ UTF-8 は専用の経路、それ以外の組は Unicode を介す (codec.c) */
+typedef enum { M_SJIS2U8, M_U82SJIS, M_PIVOT } conv_mode;
+
+/* 符号化方式。enc_codecs[] の添字 (並びは iconv_alt_list の順) */
+typedef enum {
+    ENC_CP932, ENC_UTF8,
+    ENC_UTF16, ENC_UTF16LE, ENC_UTF16BE,
+    ENC_UTF32, ENC_UTF32LE, ENC_UTF32BE,
+    ENC_EUCJP,
+    ENC_ISO2022JP, ENC_CP50221,
+    ENC_SJIS2004,
+    ENC_CP936, ENC_CP949, ENC_CP950,                       /* codepage.c の表で決まる */
+    ENC_CP1250, ENC_CP1251, ENC_CP1252, ENC_CP1253, ENC_CP1254,
+    ENC_CP1255, ENC_CP1256, ENC_CP1257, ENC_CP1258,
+    ENC_IBM930, ENC_IBM939,                                /* ebcdic.c (SO/SI) */
+    ENC_COUNT
+} enc_id;
+
+struct iconv_ctx;
+typedef struct iconv_ctx iconv_ctx;
+
+/* 易しい文字が続く間を一気に変換する組ごとの核 (任意)。
+   完結した文字だけを進め、不正・途中・出力不足の手前で止まる */
+typedef void (*pair_kernel_fn)(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+
+struct iconv_ctx {
+    conv_mode mode;
+    uint8_t    from, to;      /* enc_id                    */
+    /* --- pending for SJIS -> UTF‑8 --- */
+    uint8_t    lead;          /* first byte saved          */
+    uint8_t    have_lead;     /* 1 if lead is valid        */
+    /* --- pending for UTF‑8 -> SJIS --- */
+    uint8_t    utf8_need;     /* bytes still needed        */
+    uint32_t   utf8_cp;       /* partially built scalar    */
+    /* --- M_PIVOT --- */
+    uint8_t    pend[8];       /* 文字の途中で切れた入力     */
+    uint8_t    npend;
+    uint8_t    dstate;        /* 復号側の状態 (BOM で決めた順序、G0 の文字集合など) */
+    uint8_t    estate;        /* 符号化側の状態 (BOM を書いたか、G0 の文字集合等)  */
+    uint32_t   dpend;         /* 復号で出た 2 つ目のコード点 (0 = 無し)       */
+    uint32_t   ehold;         /* 合成を待って預けた符号化前のコード点 (0 = 無し) */
+    pair_kernel_fn kernel;    /* NULL = 1 文字ずつ          */
+};
+
+/*----------------------------------------------------------------------
+ *  符号化方式ごとの処理 (codec.c の enc_codecs[])
+ *--------------------------------------------------------------------*/
+#define CP_NONE  0xFFFFFFFFu   /* 復号したが出力する文字は無い (BOM など) */
+
+/* 1 文字を復号。Return: 消費バイト数 / 0 = 入力が足りない / -1 = 不正
+   (2 コード点になる文字は 2 つ目を c->dpend に置く) */
+typedef int (*enc_decode_fn)(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+/* 1 コード点を符号化。Return: 書いたバイト数 / -1 = 表せない / -2 = 出力が足りない */
+typedef int (*enc_encode_fn)(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+/* 並列分割: lo (既知の境界) より後ろ、pos 付近の文字境界 */
+typedef size_t (*enc_split_fn)(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+/* 出力を初期状態へ戻す列を書く (iconv(cd, NULL, ...))。Return: バイト数 / -2 = 出力が足りない */
+typedef int (*enc_reset_fn)(iconv_ctx* c, unsigned char* q, size_t room);
+
+/* ISO-2022-JP の G0 (dstate / estate の値。初期状態は ASCII) */
+#define JIS_ASCII  0
+#define JIS_ROMAN  1         /* ESC ( J : JIS X 0201 ラテン文字 */
+#define JIS_KANA   2         /* ESC ( I : JIS X 0201 片仮名     */
+#define JIS_X0208  3         /* ESC $ @ / ESC $ B                */
+
+/* 日本語 EBCDIC の SO/SI (dstate / estate の値。初期状態は 1 byte) */
+#define EBC_SBCS   0         /* SI (0x0F) の後 */
+#define EBC_DBCS   1         /* SO (0x0E) の後 */
+
+/* UTF-16 / UTF-32 のバイト順 (BOM 付き形式では dstate / estate の値) */
+#define BO_UNSET  0          /* BOM をまだ読んでいない / 書いていない */
+#define BO_BE     1
+#define BO_LE     2
+
+#define ENC_ASCII     0x1u   /* ASCII をそのまま 1 byte で表し、状態を持たない */
+#define ENC_BMP       0x2u   /* 復号結果は BMP のみ                           */
+#define ENC_OUT_STATE 0x4u   /* 出力に状態がある (BOM 等。並列に分けられない) */
+
+typedef struct {
+    const char* const* names;     /* 別名 (先頭が代表名、NULL 終端) */
+    enc_decode_fn decode;
+    enc_encode_fn encode;
+    enc_split_fn  split;          /* NULL = 入力を分けられない (状態あり) */
+    enc_reset_fn  reset;          /* NULL = 出力を戻す列は無い            */
+    uint8_t       min_in;         /* 1 文字の最小バイト数                 */
+    uint8_t       max_bmp;        /* BMP の 1 文字の最大出力バイト数      */
+    uint8_t       max_out;        /* 任意の 1 文字の最大出力バイト数      */
+    uint8_t       prefix;         /* 出力の先頭 / 末尾に付き得るバイト数 (BOM、終わりのエスケープ) */
+    uint8_t       order;          /* BO_LE / BO_BE 固定、BO_UNSET = BOM 次第 */
+    unsigned      flags;          /* ENC_*                                */
+} enc_codec;
+
+extern const enc_codec enc_codecs[ENC_COUNT];
+
+/* 1 回の変換 (pivot_one の 1 歩) で出し得る最大バイト数 = 表の prefix + 2 × max_out の最大。
+   Shift_JIS-2004 の 2 コード点の文字 (dpend) は 1 歩で 2 つ書く:
+   BOM 付き UTF-32 で 4 + 4 + 4 = 12、ISO-2022-JP の上限は 3 + 2 × 5 = 13。
+   max_out / prefix の大きい行を足すときはこれも上げる */
+#define ENC_STEP_MAX  16
+
+/* 入力 / 出力のバイト順 (BOM 付き形式で BOM の前なら BO_UNSET) */
+static inline int conv_in_order(const iconv_ctx* c)
+{
+    int o = enc_codecs[c->from].order;
+    return o ? o : c->dstate;
+}
+
+static inline int conv_out_order(const iconv_ctx* c)
+{
+    int o = enc_codecs[c->to].order;
+    return o ? o : c->estate;
+}
+
+/* ストリーム途中の持ち越し状態だけを捨てる (mode は保持) */
+static inline void iconv_ctx_reset(iconv_ctx* c)
+{
+    c->lead = 0;  c->have_lead = 0;
+    c->utf8_need = 0;  c->utf8_cp = 0;
+    c->npend = 0;  c->dstate = 0;  c->estate = 0;
+    c->dpend = 0;  c->ehold = 0;
+}
+
+/* 入力 inlen バイトを変換したときの出力バイト数の上限
+ *   SJIS → UTF‑8 : 半角カナ 1 byte → 3 byte が最悪
+ *   UTF‑8 → SJIS : 出力が入力を超えることはない
+ *   その他       : 最短の文字ばかりで、それぞれが最長の出力になる場合 */
+static inline size_t conv_max_output(const iconv_ctx* c, size_t inlen)
+{
+    if (c->mode == M_SJIS2U8) return inlen * 3;
+    if (c->mode == M_U82SJIS) return inlen;
+    const enc_codec* from = &enc_codecs[c->from];
+    const enc_codec* to = &enc_codecs[c->to];
+    size_t chars = (inlen + from->min_in - 1) / from->min_in;
+    return chars * ((from->flags & ENC_BMP) ? to->max_bmp : to->max_out) + to->prefix;
+}
+
+/* ASCII がどちらの方式でも同じ 1 byte (ASCII の連続は変換を省ける) */
+static inline int conv_ascii_identity(const iconv_ctx* c)
+{
+    return (enc_codecs[c->from].flags & enc_codecs[c->to].flags & ENC_ASCII) != 0;
+}
+
+/* 入力を文字境界で分けて別々に変換し、出力を繋いでも同じになるか */
+static inline int conv_splittable(const iconv_ctx* c)
+{
+    return enc_codecs[c->from].split && !(enc_codecs[c->to].flags & ENC_OUT_STATE);
+}
+
+/* SJIS の lead byte になり得るか (0x81–0x9F / 0xE0–0xFC) */
+static inline int sjis_is_lead(unsigned b)
+{
+    return (b >= 0x81 && b <= 0x9F) || (b >= 0xE0 && b <= 0xFC);
+}
+
+/* JIS X 0208 の 2 byte (各 0x21–0x7E) → SJIS 2 byte (表を引かない算術変換) */
+static inline uint16_t jis_to_sjis(unsigned j1, unsigned j2)
+{
+    unsigned s1 = ((j1 + 1) >> 1) + (j1 <= 0x5E ? 0x70 : 0xB0);
+    unsigned s2 = j2 + ((j1 & 1) ? (j2 < 0x60 ? 0x1F : 0x20) : 0x7E);
+    return (uint16_t)((s1 << 8) | s2);
+}
+
+/* SJIS 2 byte の区 (1 始まり。0xF0 以降は 95 区以上) */
+static inline unsigned sjis_ku(unsigned lead, unsigned trail)
+{
+    return (lead - (lead <= 0x9F ? 0x80u : 0xC0u)) * 2 - (trail < 0x9F ? 1u : 0u);
+}
+
+/* SJIS 2 byte → JIS の 2 byte (j1 << 8 | j2。jis_to_sjis の逆。0xF0 以降は j1 > 0x7E) */
+static inline uint16_t sjis_to_jis(unsigned lead, unsigned trail)
+{
+    unsigned j1 = sjis_ku(lead, trail) + 0x20;
+    unsigned j2 = trail >= 0x9F ? trail - 0x7E : trail - (trail >= 0x80 ? 0x20u : 0x1Fu);
+    return (uint16_t)((j1 << 8) | j2);
+}
+
+/* 表を引かずに SJIS ⇆ EUC-JP / JIS を変換してよい区点か:
+ * 全ての点が CP932 にあり、逆引きでも同じコードに戻る区 (1, 4, 5, 16–83 区。
+ * 4 / 5 / 47 区は後ろが空き)。2–8 区の記号・13 区・89–92 区などは表で確かめる
+ * (jis.c の jis_to_sjis_canon / sjis_to_jis_canon が SJIS_CANON を引く) */
+static inline int jis_dense(unsigned j1, unsigned j2)
+{
+    unsigned ku = j1 - 0x20, ten = j2 - 0x20;
+    if (ku >= 16 && ku <= 83) return ku != 47 || ten <= 51;
+    return ku == 1 || (ku == 4 && ten <= 83) || (ku == 5 && ten <= 86);
+}
+
+/* EINVAL で持ち越しに入ったバイトを戻し、不完全な文字の先頭を返す
+ *   (c は in の先頭から状態を空にして変換したコンテキスト)        */
+static inline size_t iconv_ctx_pending_start(const iconv_ctx* c,
+    const char* in, size_t used)
+{
+    if (c->mode == M_SJIS2U8)
+        return used - c->have_lead;
+    if (c->mode == M_PIVOT)
+        return used - c->npend;
+    while (used > 0 && ((unsigned char)in[used - 1] & 0xC0) == 0x80) --used;
+    return used > 0 ? used - 1 : 0;                /* lead byte */
+}
+
+/*======================================================================
+ *  2.  モジュール間の内部関数
+ *====================================================================*/
+/* codec.c */
+int  enc_lookup(const char* name);               /* enc_id / -1 */
+pair_kernel_fn pair_kernel(enc_id from, enc_id to);
+size_t pivot_iconv(iconv_ctx* c, char** inbuf, size_t* inleft,
+    char** outbuf, size_t* outleft);
+
+/* iconv_core.c */
+int iconv_ctx_oneshot(const iconv_ctx* proto, const char* in, size_t inlen,
+    char* out, size_t outlen, size_t* written, size_t* consumed);
+
+/* sjis.c */
+int sjis_to_unicode(uint16_t code, uint32_t* uni);
+int unicode_to_sjis(uint32_t uni, uint16_t* sjis);
+size_t sjis_resync(const unsigned char* buf, size_t lo, size_t pos);
+
+/* sjis.c (M_PIVOT 用) */
+int cp932_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int cp932_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+
+/* utf8.c */
+int u32_to_utf8(uint32_t cp, char* out);
+int utf8_next(const unsigned char** p, const unsigned char* end, uint32_t* out_cp);
+int utf8_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int utf8_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+
+/* utf16.c */
+int utf16_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int utf16le_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int utf16be_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int utf16_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+int utf16le_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+int utf16be_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+size_t utf16le_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+size_t utf16be_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+void sjis_to_utf16_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void utf16_to_sjis_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+
+/* utf32.c */
+int utf32_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int utf32le_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int utf32be_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int utf32_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+int utf32le_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+int utf32be_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+size_t utf32_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+
+/* unicode.c */
+void utf8_to_utf16_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void utf8_to_utf32_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void utf16_to_utf8_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void utf32_to_utf8_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+
+/* jis.c (SJIS ⇆ 区点。hi = バイトに足す値: EUC-JP 0x80 / ISO-2022-JP 0) */
+uint16_t jis_to_sjis_canon(unsigned j1, unsigned j2);      /* 0 = CP932 に無い */
+uint16_t sjis_to_jis_canon(unsigned lead, unsigned trail); /* 0 = 区点で表せない */
+size_t jis_lanes_to_sjis(const unsigned char* p, size_t n, unsigned char* q, unsigned hi);
+size_t sjis_lanes_to_jis(const unsigned char* p, size_t n, unsigned char* q, unsigned hi);
+
+/* eucjp.c */
+int eucjp_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int eucjp_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+size_t eucjp_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+void eucjp_to_sjis_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void sjis_to_eucjp_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+
+/* iso2022jp.c */
+int iso2022jp_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int iso2022jp_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+int cp50221_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+int iso2022jp_reset(iconv_ctx* c, unsigned char* q, size_t room);
+void iso2022jp_to_sjis_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void iso2022jp_to_utf8_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void sjis_to_iso2022jp_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void sjis_to_cp50221_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+
+/* sjis2004.c */
+int sjis2004_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int sjis2004_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+int sjis2004_reset(iconv_ctx* c, unsigned char* q, size_t room);
+void sjis2004_to_utf8_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void utf8_to_sjis2004_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+
+/* codepage.c (ENC_CP936 – ENC_CP1258 で共有。表は c->from / c->to で選ぶ) */
+int codepage_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int codepage_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+size_t sbcs_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+size_t dbcs_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+void codepage_to_utf8_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void utf8_to_codepage_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+
+/* ebcdic.c (ENC_IBM930 / ENC_IBM939 で共有) */
+int ebcdic_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp);
+int ebcdic_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room);
+int ebcdic_reset(iconv_ctx* c, unsigned char* q, size_t room);
+void ebcdic_to_utf8_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+void ebcdic_to_sjis_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend);
+
+/* parallel.c (並列変換 / thread pool 共用) */
+typedef struct {
+    char*       data;       /* 書き込み先 (len バイト)           */
+    size_t      len;
+    int         fd;         /* POSIX: map した出力 (一時ファイル) */
+    const char* path;       /* commit で置き換える / 書き出す先   */
+    char*       tmp;        /* POSIX: 同じディレクトリの一時ファイル */
+} par_out_file;
+
+size_t par_split_point(const iconv_ctx* ctx, const unsigned char* in, size_t inlen,
+    size_t lo, size_t pos);
+size_t sjis_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+size_t utf8_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos);
+int  par_file_read(const char* path, const char** data, size_t* len);
+void par_file_release(const char* data, size_t len);
+int  par_file_create(const char* path, size_t len, par_out_file* f);
+int  par_file_commit(par_out_file* f);
+void par_file_discard(par_out_file* f);
+
+/* ascii.c */
+size_t ascii_span(const unsigned char* p, size_t n);
+size_t ascii_span_noesc(const unsigned char* p, size_t n);
+
+#endif /* ICONV_ALT_INTERNAL_H */
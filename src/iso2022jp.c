@@ -0,0 +1,350 @@
+/*----------------------------------------------------------------------
+ *  src/iso2022jp.c  —  ISO-2022-JP / CP50221 (状態付き 7 bit 符号) と、CP932 / UTF-8 との核
+ *
+ *      ESC ( B   : ASCII (初期状態)
+ *      ESC ( J   : JIS X 0201 ラテン文字 (CP5022x と同じく ASCII として読む)
+ *      ESC ( I   : JIS X 0201 片仮名 (0x21–0x5F が半角カナ。CP50221 のみ書く)
+ *      ESC $ @ / ESC $ B : JIS X 0208 (0x21–0x7E の 2 byte が区点)
+ *  現在の G0 は復号側が dstate、符号化側が estate に持つ (JIS_*)。
+ *  区点 → Unicode は EUC-JP と同じく SJIS に直して CP932 の表を引くので、
+ *  NEC 特殊文字 (13 区) と NEC 選定 IBM 拡張 (89–92 区) も読み書きできる。
+ *  符号化は文字集合が変わるときだけエスケープを書き (最短)、出力の終わりで
+ *  iconv(cd, NULL, ...) → iso2022jp_reset() が ESC ( B を書いて ASCII へ戻す。
+ *  制御文字 (0x21 未満と 0x7F) はどの文字集合でもそのまま通す。
+ *  JIS X 0212 / 0213 の面 (ISO-2022-JP-1 / -2004) は表が無いので扱わない。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include "sjis_table.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#define JIS_ESC  0x1B
+
+static inline int is_jis(unsigned b)  { return b - 0x21u <= 0x5Du; }   /* 0x21–0x7E */
+static inline int is_kana(unsigned b) { return b - 0xA1u <= 0x3Eu; }   /* SJIS 0xA1–0xDF */
+
+/* エスケープ列を読む。Return: 長さ / 0 = 途中で切れている / -1 = 知らない列 */
+static inline int jis_escape(const unsigned char* p, size_t n, uint8_t* set)
+{
+    if (n < 3) return (n < 2 || p[1] == '(' || p[1] == '$') ? 0 : -1;
+    if (p[1] == '(') {
+        switch (p[2]) {
+        case 'B': *set = JIS_ASCII; return 3;
+        case 'J': *set = JIS_ROMAN; return 3;
+        case 'I': *set = JIS_KANA;  return 3;
+        }
+    }
+    else if (p[1] == '$' && (p[2] == '@' || p[2] == 'B')) {
+        *set = JIS_X0208;
+        return 3;
+    }
+    return -1;
+}
+
+/* 区点 (各 0x21–0x7E) → Unicode。SJIS_NOMAP = 未定義 */
+static inline uint16_t jis_to_unicode(unsigned j1, unsigned j2)
+{
+    uint16_t s = jis_to_sjis(j1, j2);
+    return SJIS_DB2U[SJIS_LEAD2ROW[s >> 8]][s & 0xFF];
+}
+
+/*======================================================================
+ *  1.  1 文字の復号 / 符号化
+ *====================================================================*/
+int iso2022jp_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    unsigned b = p[0];
+    if (b == JIS_ESC) {
+        uint8_t set;
+        int r = jis_escape(p, n, &set);
+        if (r > 0) { c->dstate = set; *cp = CP_NONE; }
+        return r;
+    }
+    if (b >= 0x80) return -1;
+    if (b < 0x21 || b == 0x7F || c->dstate <= JIS_ROMAN) { *cp = b; return 1; }
+    if (c->dstate == JIS_KANA) {
+        if (b > 0x5F) return -1;
+        *cp = b + 0xFF40u;
+        return 1;
+    }
+    if (n < 2) return 0;
+    if (!is_jis(p[1])) return -1;
+    uint16_t u = jis_to_unicode(b, p[1]);
+    if (u == SJIS_NOMAP) return -1;
+    *cp = u;
+    return 2;
+}
+
+/* kana = 半角カナを ESC ( I で書くか (CP50221)。書けない文字は -1 */
+static int jis_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room, int kana)
+{
+    unsigned char ch[2];
+    size_t len;
+    uint8_t set;
+    if (cp < 0x80) {
+        if (cp == JIS_ESC) return -1;                   /* 状態を壊す */
+        set = JIS_ASCII;
+        ch[0] = (unsigned char)cp;
+        len = 1;
+    }
+    else {
+        if (cp > 0xFFFF) return -1;
+        uint16_t s = U2SJIS[U2SJIS_PAGE[cp >> 8]][cp & 0xFF];
+        if (s == SJIS_NOMAP) return -1;
+        if (s < 0x100) {
+            if (!kana || !is_kana(s)) return -1;
+            set = JIS_KANA;
+            ch[0] = (unsigned char)(s - 0x80);
+            len = 1;
+        }
+        else {
+            if (s >= 0xFA00) {                          /* IBM 拡張 → NEC 選定 */
+                s = SJIS_IBM2NEC[(s >> 8) - 0xFA][s & 0xFF];
+                if (s == SJIS_NOMAP) return -1;
+            }
+            uint16_t j = sjis_to_jis(s >> 8, s & 0xFF);
+            if ((j >> 8) > 0x7E) return -1;             /* 95 区以降 */
+            set = JIS_X0208;
+            ch[0] = (unsigned char)(j >> 8);
+            ch[1] = (unsigned char)(j & 0xFF);
+            len = 2;
+        }
+    }
+    size_t esc = (set != c->estate) ? 3 : 0;
+    if (room < esc + len) return -2;
+    if (esc) {
+        q[0] = JIS_ESC;
+        q[1] = set == JIS_X0208 ? '$' : '(';
+        q[2] = set == JIS_X0208 ? 'B' : set == JIS_KANA ? 'I' : 'B';
+        c->estate = set;
+    }
+    memcpy(q + esc, ch, len);
+    return (int)(esc + len);
+}
+
+int iso2022jp_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    return jis_encode(c, cp, q, room, 0);
+}
+
+int cp50221_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    return jis_encode(c, cp, q, room, 1);
+}
+
+int iso2022jp_reset(iconv_ctx* c, unsigned char* q, size_t room)
+{
+    if (c->estate == JIS_ASCII) return 0;
+    if (room < 3) return -2;
+    q[0] = JIS_ESC; q[1] = '('; q[2] = 'B';
+    c->estate = JIS_ASCII;
+    return 3;
+}
+
+/*======================================================================
+ *  2.  復号の核 (pair_kernel)
+ *
+ *  エスケープの間の連続を、文字集合ごとの内側のループでまとめて変換する。
+ *  1 文字ごとに状態を見ない: ASCII は ascii_span_noesc で ESC まで一気に写し、
+ *  JIS X 0208 は漢字の区を jis.c の SSE2 レーンで 8 文字ずつ、他の区点を
+ *  1 文字ずつ算術か小さな表 (jis_to_sjis_canon) で変換し続ける。
+ *  途中で切れたエスケープ・制御文字・未定義の区点などでは抜けて
+ *  pivot_iconv() に 1 文字任せる (状態は dstate にあるので続きから戻れる)。
+ *====================================================================*/
+/* レーンに渡せる長さ (入力と出力の短い方) */
+static inline size_t room_for(const unsigned char* p, const unsigned char* end,
+    const unsigned char* q, const unsigned char* qend)
+{
+    size_t n = (size_t)(end - p), room = (size_t)(qend - q);
+    return n < room ? n : room;
+}
+
+/* ASCII (と ESC ( J) の連続を ESC の手前まで写す。Return: 写したバイト数 */
+static inline size_t copy_ascii(const unsigned char* p, const unsigned char* end,
+    unsigned char* q, unsigned char* qend)
+{
+    size_t n = ascii_span_noesc(p, (size_t)(end - p));
+    if (n > (size_t)(qend - q)) n = (size_t)(qend - q);
+    memcpy(q, p, n);
+    return n;
+}
+
+void iso2022jp_to_sjis_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        if (*p == JIS_ESC) {
+            uint8_t set;
+            if (jis_escape(p, (size_t)(end - p), &set) <= 0) break;
+            c->dstate = set;
+            p += 3;
+            continue;
+        }
+        const unsigned char* start = p;
+        if (c->dstate <= JIS_ROMAN) {
+            size_t n = copy_ascii(p, end, q, qend);
+            p += n; q += n;
+        }
+        else if (c->dstate == JIS_KANA) {
+            while (p < end && q < qend && p[0] - 0x21u <= 0x3Eu)
+                *q++ = (unsigned char)(*p++ + 0x80);
+        }
+        else {
+            for (;;) {
+                size_t n = jis_lanes_to_sjis(p, room_for(p, end, q, qend), q, 0);
+                p += n; q += n;
+                if (end - p < 2 || qend - q < 2 || !is_jis(p[0]) || !is_jis(p[1])) break;
+                uint16_t s = jis_to_sjis_canon(p[0], p[1]);   /* 記号・NEC の区は表で正規化 */
+                if (s == 0) break;
+                q[0] = (unsigned char)(s >> 8);
+                q[1] = (unsigned char)(s & 0xFF);
+                p += 2; q += 2;
+            }
+        }
+        if (p == start || (p < end && *p != JIS_ESC)) break;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+void iso2022jp_to_utf8_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        if (*p == JIS_ESC) {
+            uint8_t set;
+            if (jis_escape(p, (size_t)(end - p), &set) <= 0) break;
+            c->dstate = set;
+            p += 3;
+            continue;
+        }
+        const unsigned char* start = p;
+        if (c->dstate <= JIS_ROMAN) {
+            size_t n = copy_ascii(p, end, q, qend);
+            p += n; q += n;
+        }
+        else if (c->dstate == JIS_KANA) {
+            while (p < end && qend - q >= 3 && p[0] - 0x21u <= 0x3Eu) {
+                unsigned u = *p++ + 0xFF40u;            /* U+FF61–FF9F */
+                q[0] = 0xEF;
+                q[1] = (unsigned char)(0x80 | ((u >> 6) & 0x3F));
+                q[2] = (unsigned char)(0x80 | (u & 0x3F));
+                q += 3;
+            }
+        }
+        else {
+            while (end - p >= 2 && qend - q >= 3 && is_jis(p[0]) && is_jis(p[1])) {
+                unsigned u = jis_to_unicode(p[0], p[1]);
+                if (u == SJIS_NOMAP) break;
+                if (u < 0x800) {                        /* 1 区の記号 (§ ° ± × ÷ など) */
+                    q[0] = (unsigned char)(0xC0 | (u >> 6));
+                    q[1] = (unsigned char)(0x80 | (u & 0x3F));
+                    q += 2;
+                }
+                else {
+                    q[0] = (unsigned char)(0xE0 | (u >> 12));
+                    q[1] = (unsigned char)(0x80 | ((u >> 6) & 0x3F));
+                    q[2] = (unsigned char)(0x80 | (u & 0x3F));
+                    q += 3;
+                }
+                p += 2;
+            }
+        }
+        if (p == start || (p < end && *p != JIS_ESC)) break;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+/*======================================================================
+ *  3.  CP932 → ISO-2022-JP / CP50221 の核 (pair_kernel、Unicode を介さない)
+ *
+ *  文字集合が変わるときだけエスケープを書き (jis_encode と同じ最短の列)、
+ *  同じ文字集合の連続は内側のループでまとめる: ASCII は ESC の手前まで写し、
+ *  2 byte は漢字の区を jis.c の SSE2 レーンで 8 文字ずつ、他は 1 文字ずつ
+ *  sjis_to_jis_canon (記号・NEC / IBM 拡張は小さな表で正規化) で区点にする。
+ *  エスケープは次の 1 文字も書けるときだけ書くので、途中で抜けても出力は
+ *  1 文字ずつの経路と同じ。ESC・区点に無い文字・ISO-2022-JP の半角カナでは
+ *  抜けて pivot_iconv() に任せる。
+ *====================================================================*/
+static inline unsigned char* put_escape(unsigned char* q, uint8_t set)
+{
+    q[0] = JIS_ESC;
+    q[1] = set == JIS_X0208 ? '$' : '(';
+    q[2] = set == JIS_KANA ? 'I' : 'B';
+    return q + 3;
+}
+
+static void sjis_to_jis_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend, int kana)
+{
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        unsigned b = *p;
+        size_t esc;
+        if (b < 0x80) {
+            if (b == JIS_ESC) break;                    /* 状態を壊す */
+            esc = c->estate != JIS_ASCII ? 3 : 0;
+            if ((size_t)(qend - q) < esc + 1) break;
+            if (esc) { q = put_escape(q, JIS_ASCII); c->estate = JIS_ASCII; }
+            size_t n = copy_ascii(p, end, q, qend);
+            p += n; q += n;
+        }
+        else if (is_kana(b)) {
+            if (!kana) break;
+            esc = c->estate != JIS_KANA ? 3 : 0;
+            if ((size_t)(qend - q) < esc + 1) break;
+            if (esc) { q = put_escape(q, JIS_KANA); c->estate = JIS_KANA; }
+            while (p < end && q < qend && is_kana(*p))
+                *q++ = (unsigned char)(*p++ - 0x80);
+        }
+        else {
+            if (end - p < 2 || !sjis_is_lead(b)) break;
+            unsigned t = p[1];
+            if (t < 0x40 || t == 0x7F || t > 0xFC) break;
+            uint16_t j = sjis_to_jis_canon(b, t);
+            if (j == 0) break;                          /* 未定義 / 外字 */
+            esc = c->estate != JIS_X0208 ? 3 : 0;
+            if ((size_t)(qend - q) < esc + 2) break;
+            if (esc) { q = put_escape(q, JIS_X0208); c->estate = JIS_X0208; }
+            q[0] = (unsigned char)(j >> 8);
+            q[1] = (unsigned char)(j & 0xFF);
+            p += 2; q += 2;
+            for (;;) {
+                size_t n = sjis_lanes_to_jis(p, room_for(p, end, q, qend), q, 0);
+                p += n; q += n;
+                if (end - p < 2 || qend - q < 2 || !sjis_is_lead(p[0])) break;
+                t = p[1];
+                if (t < 0x40 || t == 0x7F || t > 0xFC) break;
+                j = sjis_to_jis_canon(p[0], t);
+                if (j == 0) break;
+                q[0] = (unsigned char)(j >> 8);
+                q[1] = (unsigned char)(j & 0xFF);
+                p += 2; q += 2;
+            }
+        }
+    }
+    *pp = p;
+    *qq = q;
+}
+
+void sjis_to_iso2022jp_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    sjis_to_jis_kernel(c, pp, end, qq, qend, 0);
+}
+
+void sjis_to_cp50221_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    sjis_to_jis_kernel(c, pp, end, qq, qend, 1);
+}
@@ -0,0 +1,123 @@
+/*----------------------------------------------------------------------
+ *  src/jis.c  —  SJIS ⇆ JIS X 0208 区点の表を引かない変換 (EUC-JP / ISO-2022-JP の核が共有)
+ *
+ *  SJIS の lead / trail と区点は算術で 1 対 1 に行き来できる (jis_to_sjis /
+ *  sjis_to_jis)。16–83 区 (jis_dense) は全ての点が CP932 にあって往復するので、
+ *  Unicode を介さずに算術だけで変換してよい:
+ *      jis_lanes_to_sjis / sjis_lanes_to_jis : 16 byte (8 文字) ずつの SSE2 レーン。
+ *          8 文字とも漢字の区 (16–46 / 48–83 区) なら分岐なしで変換する
+ *      jis_to_sjis_canon / sjis_to_jis_canon : 1 文字。記号・NEC 特殊文字 (13 区)・
+ *          NEC 選定 IBM 拡張 (89–92 区)・IBM 拡張 (SJIS 0xFA–0xFC) などの区は
+ *          小さな表 SJIS_CANON (同じ文字の正規の SJIS) と SJIS_IBM2NEC で正規化する
+ *  どちらも Unicode を介した 1 文字ずつの経路 (pivot_iconv) と同じ結果になり、
+ *  表せない文字では 0 を返して、errno と位置はその経路に決めさせる。
+ *  hi はバイトに足す値 (EUC-JP は 0x80、ISO-2022-JP は 0)。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include "sjis_table.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define JIS_USE_SSE2 1
+#endif
+
+/*======================================================================
+ *  1.  1 文字 (表で確かめる区を含む)
+ *====================================================================*/
+uint16_t jis_to_sjis_canon(unsigned j1, unsigned j2)
+{
+    uint16_t s = jis_to_sjis(j1, j2);
+    if (jis_dense(j1, j2)) return s;
+    s = SJIS_CANON[SJIS_CANON_ROW[s >> 8]][s & 0xFF];
+    return s == SJIS_NOMAP ? 0 : s;
+}
+
+uint16_t sjis_to_jis_canon(unsigned lead, unsigned trail)
+{
+    uint16_t j = sjis_to_jis(lead, trail);
+    if ((j >> 8) <= 0x7E && jis_dense(j >> 8, j & 0xFF)) return j;
+    uint16_t s = SJIS_CANON[SJIS_CANON_ROW[lead]][trail];
+    if (s == SJIS_NOMAP) return 0;                      /* 未定義 / 外字 (95 区以降) */
+    if (s >= 0xFA00) {                                  /* IBM 拡張 → NEC 選定 */
+        s = SJIS_IBM2NEC[(s >> 8) - 0xFA][s & 0xFF];
+        if (s == SJIS_NOMAP) return 0;
+    }
+    j = sjis_to_jis(s >> 8, s & 0xFF);
+    return (j >> 8) > 0x7E ? 0 : j;
+}
+
+/*======================================================================
+ *  2.  SSE2 レーン (16 bit 単位に lead / trail を並べて 8 文字ずつ)
+ *====================================================================*/
+#if defined(JIS_USE_SSE2)
+static inline __m128i set16(int v) { return _mm_set1_epi16((short)v); }
+
+/* lo <= v <= hi の 16 bit 単位を全 bit 1 に */
+static inline __m128i in_range(__m128i v, int lo, int hi)
+{
+    return _mm_and_si128(_mm_cmpgt_epi16(v, set16(lo - 1)), _mm_cmplt_epi16(v, set16(hi + 1)));
+}
+#endif
+
+size_t jis_lanes_to_sjis(const unsigned char* p, size_t n, unsigned char* q, unsigned hi)
+{
+    size_t i = 0;
+#if defined(JIS_USE_SSE2)
+    const __m128i lo8 = set16(0xFF);
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i j1 = _mm_sub_epi16(_mm_and_si128(v, lo8), set16((int)hi));
+        __m128i j2 = _mm_sub_epi16(_mm_srli_epi16(v, 8), set16((int)hi));
+        /* 16–46 / 48–83 区 (0x30–0x4E / 0x50–0x73) と 0x21–0x7E の点だけ */
+        __m128i ok = _mm_andnot_si128(_mm_cmpeq_epi16(j1, set16(0x4F)), in_range(j1, 0x30, 0x73));
+        ok = _mm_and_si128(ok, in_range(j2, 0x21, 0x7E));
+        if (_mm_movemask_epi8(ok) != 0xFFFF) break;
+        /* s1 = ((j1 + 1) >> 1) + (j1 <= 0x5E ? 0x70 : 0xB0) */
+        __m128i s1 = _mm_add_epi16(_mm_srli_epi16(_mm_add_epi16(j1, set16(1)), 1),
+                                   _mm_add_epi16(set16(0x70), _mm_and_si128(_mm_cmpgt_epi16(j1, set16(0x5E)), set16(0x40))));
+        /* s2 = j2 + (奇数区 ? (j2 < 0x60 ? 0x1F : 0x20) : 0x7E) */
+        __m128i odd = _mm_cmpeq_epi16(_mm_and_si128(j1, set16(1)), set16(1));
+        __m128i add_odd = _mm_sub_epi16(set16(0x20), _mm_and_si128(_mm_cmplt_epi16(j2, set16(0x60)), set16(1)));
+        __m128i add = _mm_or_si128(_mm_and_si128(odd, add_odd), _mm_andnot_si128(odd, set16(0x7E)));
+        __m128i s2 = _mm_add_epi16(j2, add);
+        _mm_storeu_si128((__m128i*)(q + i), _mm_or_si128(s1, _mm_slli_epi16(s2, 8)));
+    }
+#else
+    (void)p; (void)n; (void)q; (void)hi;
+#endif
+    return i;
+}
+
+size_t sjis_lanes_to_jis(const unsigned char* p, size_t n, unsigned char* q, unsigned hi)
+{
+    size_t i = 0;
+#if defined(JIS_USE_SSE2)
+    const __m128i lo8 = set16(0xFF);
+    for (; i + 16 <= n; i += 16) {
+        __m128i v = _mm_loadu_si128((const __m128i*)(p + i));
+        __m128i l = _mm_and_si128(v, lo8);
+        __m128i t = _mm_srli_epi16(v, 8);
+        /* lead 0x89–0x97 / 0x99–0x9F / 0xE0–0xE9 (17–46 / 49–82 区)、trail 0x40–0x7E / 0x80–0xFC */
+        __m128i ok = _mm_or_si128(_mm_andnot_si128(_mm_cmpeq_epi16(l, set16(0x98)), in_range(l, 0x89, 0x9F)),
+                                  in_range(l, 0xE0, 0xE9));
+        ok = _mm_and_si128(ok, _mm_or_si128(in_range(t, 0x40, 0x7E), in_range(t, 0x80, 0xFC)));
+        if (_mm_movemask_epi8(ok) != 0xFFFF) break;
+        /* 区 = (lead - (lead <= 0x9F ? 0x80 : 0xC0)) * 2 - (trail < 0x9F) */
+        __m128i base = _mm_add_epi16(set16(0x80), _mm_and_si128(_mm_cmpgt_epi16(l, set16(0x9F)), set16(0x40)));
+        __m128i ge9f = _mm_cmpgt_epi16(t, set16(0x9E));
+        __m128i j1 = _mm_add_epi16(_mm_slli_epi16(_mm_sub_epi16(l, base), 1),
+                                   _mm_add_epi16(_mm_andnot_si128(ge9f, set16(-1)), set16(0x20)));
+        /* 点 = trail - (trail >= 0x9F ? 0x7E : trail >= 0x80 ? 0x20 : 0x1F) */
+        __m128i sub = _mm_add_epi16(set16(0x1F), _mm_and_si128(_mm_cmpgt_epi16(t, set16(0x7F)), set16(1)));
+        sub = _mm_or_si128(_mm_and_si128(ge9f, set16(0x7E)), _mm_andnot_si128(ge9f, sub));
+        __m128i j2 = _mm_sub_epi16(t, sub);
+        __m128i out = _mm_or_si128(j1, _mm_slli_epi16(j2, 8));
+        _mm_storeu_si128((__m128i*)(q + i), _mm_add_epi8(out, _mm_set1_epi8((char)hi)));
+    }
+#else
+    (void)p; (void)n; (void)q; (void)hi;
+#endif
+    return i;
+}
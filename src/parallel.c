@@ -0,0 +1,397 @@
+/*----------------------------------------------------------------------
+ *  src/parallel.c  —  iconv_alt_convert_parallel / iconv_alt_convert_file
+ *
+ *  1. 入力を文字境界で n 個のチャンクに分ける (逐次、各境界の近傍だけ見る)
+ *  2. 各チャンクの出力サイズを並列に計測 (iconv_alt_measure と同じ処理)
+ *  3. 累積和で各チャンクの出力位置を決め、最終位置へ並列に変換
+ *  チャンク 0 は呼び出しスレッドが受け持ち、残りに 1 本ずつスレッドを立てる。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include "compat_thread.h"
+#include <errno.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#if !defined(_WIN32)
+#  include <fcntl.h>
+#  include <sys/mman.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+/* SJIS で 0x40 未満のバイトを探す距離 (見つからなければ後方へ再同期) */
+#define SPLIT_SCAN  4096
+
+/* 出力の一時ファイル (out_path + ".<pid>.<n>" + これ。commit で rename) */
+#define PAR_TMP_SUFFIX  ".iconv-alt.tmp"
+
+/*======================================================================
+ *  1.  分割点
+ *====================================================================*/
+/* lo (既知の境界) より後ろ、pos 付近の文字境界。
+   状態を持つ組は分けられないので inlen (= 分割しない) */
+size_t par_split_point(const iconv_ctx* ctx, const unsigned char* in, size_t inlen,
+    size_t lo, size_t pos)
+{
+    if (!conv_splittable(ctx)) return inlen;
+    return enc_codecs[ctx->from].split(in, inlen, lo, pos);
+}
+
+/* UTF-8: 継続バイトを飛ばす */
+size_t utf8_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos)
+{
+    (void)lo;
+    while (pos < inlen && (in[pos] & 0xC0) == 0x80) ++pos;
+    return pos;
+}
+
+/* SJIS: 0x40 未満は trail にならないので、その次のバイトは必ず文字の先頭 */
+size_t sjis_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos)
+{
+    size_t end = (inlen - pos > SPLIT_SCAN) ? pos + SPLIT_SCAN : inlen;
+    for (size_t i = pos; i < end; ++i)
+        if (in[i] < 0x40) return i + 1;
+    return sjis_resync(in, lo, pos);
+}
+
+/*======================================================================
+ *  2.  チャンクと並列実行
+ *====================================================================*/
+typedef struct {
+    const iconv_ctx* ctx;
+    const char*      in;
+    size_t           len;
+    char*            out;       /* 変換段階の書き込み先 (計測段階は NULL) */
+    size_t           room;
+    size_t           result;    /* 出力バイト数 / (size_t)-1 */
+    size_t           stop;      /* チャンク内の停止位置 */
+    int              err;
+} par_chunk;
+
+static void chunk_measure(void* arg)
+{
+    par_chunk* c = (par_chunk*)arg;
+    c->result = iconv_alt_measure((iconv_t)c->ctx, c->in, c->len, &c->stop);
+    c->err = (c->result == (size_t)-1) ? errno : 0;
+}
+
+static void chunk_convert(void* arg)
+{
+    par_chunk* c = (par_chunk*)arg;
+    c->result = iconv_alt_convert((iconv_t)c->ctx, c->in, c->len, c->out, c->room, &c->stop);
+    c->err = (c->result == (size_t)-1) ? errno : 0;
+}
+
+/* n 個を並列に実行。スレッドが作れなかった分は呼び出しスレッドで行う */
+static void run_all(par_chunk* c, size_t n, void (*fn)(void*))
+{
+    compat_thread* th = (compat_thread*)malloc(n * sizeof(*th));
+    unsigned char* ok = (unsigned char*)calloc(n, 1);
+    for (size_t k = 1; th && ok && k < n; ++k)
+        ok[k] = compat_thread_create(&th[k], fn, &c[k]) == 0;
+    fn(&c[0]);
+    for (size_t k = 1; k < n; ++k) {
+        if (th && ok && ok[k]) compat_thread_join(th[k]);
+        else fn(&c[k]);
+    }
+    free(ok);
+    free(th);
+}
+
+/* 最初に失敗したチャンク / n (全て成功) */
+static size_t first_error(const par_chunk* c, size_t n)
+{
+    for (size_t k = 0; k < n; ++k)
+        if (c[k].result == (size_t)-1) return k;
+    return n;
+}
+
+/* チャンク分割。途中で文字が終わらないチャンクの EINVAL は、逐次なら
+   次のバイトで EILSEQ になるので合わせる */
+static size_t plan(const iconv_ctx* ctx, const char* in, size_t inlen,
+    unsigned threads, par_chunk* c)
+{
+    size_t n = 0, lo = 0;
+    size_t step = inlen / threads;
+    for (unsigned k = 1; k < threads; ++k) {
+        size_t b = par_split_point(ctx, (const unsigned char*)in, inlen, lo, step * k);
+        if (b <= lo || b >= inlen) continue;
+        c[n].ctx = ctx; c[n].in = in + lo; c[n].len = b - lo; ++n;
+        lo = b;
+    }
+    c[n].ctx = ctx; c[n].in = in + lo; c[n].len = inlen - lo; ++n;
+    return n;
+}
+
+static unsigned thread_count(unsigned threads, size_t inlen)
+{
+    if (threads == 0) threads = compat_cpu_count();
+    size_t most = inlen / ICONV_ALT_PARALLEL_MIN_CHUNK;
+    if (most < threads) threads = most ? (unsigned)most : 1u;
+    return threads;
+}
+
+/* 計測段階。Return: 全体の出力サイズ / (size_t)-1 (errno, *stop) */
+static size_t measure_all(par_chunk* c, size_t n, const char* in, size_t* stop)
+{
+    run_all(c, n, chunk_measure);
+    size_t k = first_error(c, n);
+    if (k < n) {
+        int err = c[k].err;
+        if (err == EINVAL && k + 1 < n) err = EILSEQ;
+        if (stop) *stop = (size_t)(c[k].in - in) + c[k].stop;
+        errno = err;
+        return (size_t)-1;
+    }
+    size_t total = 0;
+    for (k = 0; k < n; ++k) total += c[k].result;
+    return total;
+}
+
+/* 変換段階。out は計測結果ちょうど以上あること */
+static size_t convert_all(par_chunk* c, size_t n, const char* in, char* out, size_t* stop)
+{
+    size_t off = 0;
+    for (size_t k = 0; k < n; ++k) {
+        c[k].out = out + off;
+        c[k].room = c[k].result;
+        off += c[k].result;
+    }
+    run_all(c, n, chunk_convert);
+    size_t k = first_error(c, n);            /* 計測と同じ入力なので通常は起きない */
+    if (k < n) {
+        if (stop) *stop = (size_t)(c[k].in - in) + c[k].stop;
+        errno = c[k].err;
+        return (size_t)-1;
+    }
+    return off;
+}
+
+/*======================================================================
+ *  3.  公開 API: バッファ
+ *====================================================================*/
+size_t iconv_alt_convert_parallel(iconv_t cd, const char* in, size_t inlen,
+    char* out, size_t outlen, unsigned threads, size_t* stop)
+{
+    const iconv_ctx* ctx = (const iconv_ctx*)cd;
+    if (!ctx || cd == (iconv_t)-1 || (!in && inlen) || (!out && outlen)) {
+        errno = EINVAL; return (size_t)-1;
+    }
+    threads = thread_count(threads, inlen);
+    if (threads == 1) return iconv_alt_convert(cd, in, inlen, out, outlen, stop);
+
+    par_chunk* c = (par_chunk*)calloc(threads, sizeof(*c));
+    if (!c) { errno = ENOMEM; return (size_t)-1; }
+    size_t n = plan(ctx, in, inlen, threads, c);
+
+    size_t r = measure_all(c, n, in, stop);
+    if (r != (size_t)-1 && r > outlen) {
+        /* 収まらない: 溢れるチャンクを逐次変換して E2BIG の停止位置を得る */
+        size_t off = 0, k = 0;
+        while (off + c[k].result <= outlen) off += c[k++].result;
+        size_t local = 0;
+        iconv_alt_convert(cd, c[k].in, c[k].len, out + off, outlen - off, &local);
+        if (stop) *stop = (size_t)(c[k].in - in) + local;
+        errno = E2BIG;
+        r = (size_t)-1;
+    }
+    else if (r != (size_t)-1) {
+        r = convert_all(c, n, in, out, stop);
+    }
+    int err = errno;
+    free(c);
+    errno = err;
+    return r;
+}
+
+/*======================================================================
+ *  4.  ファイルの入出力 (POSIX: mmap / Windows: 全体を読み書き)
+ *====================================================================*/
+/* 長さ 0 の mmap はできないので、空の入力は静的な空バッファで表す */
+static const char empty_input[1];
+
+#if !defined(_WIN32)
+
+int par_file_read(const char* path, const char** data, size_t* len)
+{
+    int fd = open(path, O_RDONLY);
+    if (fd < 0) return -1;
+    struct stat sb;
+    if (fstat(fd, &sb) < 0) { int e = errno; close(fd); errno = e; return -1; }
+    *len = (size_t)sb.st_size;
+    *data = empty_input;
+    if (*len > 0) {
+        void* m = mmap(NULL, *len, PROT_READ, MAP_PRIVATE, fd, 0);
+        if (m == MAP_FAILED) { int e = errno; close(fd); errno = e; return -1; }
+        madvise(m, *len, MADV_SEQUENTIAL);
+        *data = (const char*)m;
+    }
+    close(fd);
+    return 0;
+}
+
+void par_file_release(const char* data, size_t len)
+{
+    if (data != empty_input) munmap((void*)data, len);
+}
+
+/* 一時ファイルの名前の通し番号 (同じプロセスの並行する呼び出しを分ける) */
+static volatile uint32_t tmp_serial;
+
+/* path と同じディレクトリに一時ファイルを作って len バイトに伸ばし、書き込み可能に
+   map する。path は commit の rename で初めて置き換わるので、path が入力と同じ
+   (またはそのハードリンク) でも map した入力は壊れない。既存の path の許可と所有者は引き継ぐ */
+int par_file_create(const char* path, size_t len, par_out_file* f)
+{
+    f->data = NULL;
+    f->len = len;
+    f->path = path;
+    f->fd = -1;
+    size_t cap = strlen(path) + sizeof(PAR_TMP_SUFFIX) + 32;
+    f->tmp = (char*)malloc(cap);
+    if (!f->tmp) { errno = ENOMEM; return -1; }
+    do {
+        snprintf(f->tmp, cap, "%s.%ld.%u" PAR_TMP_SUFFIX, path, (long)getpid(),
+                 (unsigned)compat_add_sc_u32(&tmp_serial, 1));
+        f->fd = open(f->tmp, O_RDWR | O_CREAT | O_EXCL | O_CLOEXEC, 0666);
+    } while (f->fd < 0 && errno == EEXIST);
+    if (f->fd < 0) goto fail;
+    /* 置き換える既存の path の許可と所有者を引き継ぐ (chown は set-id を落とすので先に。
+       root 以外で所有者を変えられないのは許す) */
+    struct stat sb;
+    if (stat(path, &sb) == 0) {
+        if (fchown(f->fd, sb.st_uid, sb.st_gid) < 0) {}
+        if (fchmod(f->fd, sb.st_mode & 07777) < 0) goto fail;
+    }
+    if (ftruncate(f->fd, (off_t)len) < 0) goto fail;
+    if (len > 0) {
+        void* m = mmap(NULL, len, PROT_READ | PROT_WRITE, MAP_SHARED, f->fd, 0);
+        if (m == MAP_FAILED) goto fail;
+        f->data = (char*)m;
+    }
+    return 0;
+fail:;
+    int e = errno;
+    if (f->fd >= 0) { close(f->fd); unlink(f->tmp); }
+    free(f->tmp);
+    errno = e;
+    return -1;
+}
+
+/* 書き終えた一時ファイルを閉じ、rename で path に置き換える */
+int par_file_commit(par_out_file* f)
+{
+    if (f->data) munmap(f->data, f->len);
+    int rc = close(f->fd);
+    if (rc == 0) rc = rename(f->tmp, f->path);
+    if (rc < 0) { int e = errno; unlink(f->tmp); errno = e; }
+    free(f->tmp);
+    return rc;
+}
+
+/* 失敗: 一時ファイルを消し、path には触れない */
+void par_file_discard(par_out_file* f)
+{
+    if (f->data) munmap(f->data, f->len);
+    close(f->fd);
+    unlink(f->tmp);
+    free(f->tmp);
+}
+
+#else  /* _WIN32 */
+
+int par_file_read(const char* path, const char** data, size_t* len)
+{
+    FILE* fp = fopen(path, "rb");
+    if (!fp) return -1;
+    size_t cap = 1 << 16, n = 0, got;
+    char* buf = (char*)malloc(cap);
+    while (buf && (got = fread(buf + n, 1, cap - n, fp)) > 0) {
+        n += got;
+        if (n == cap) {
+            char* p = (char*)realloc(buf, cap *= 2);
+            if (!p) { free(buf); buf = NULL; }
+            else buf = p;
+        }
+    }
+    fclose(fp);
+    if (!buf) { errno = ENOMEM; return -1; }
+    *data = buf;
+    *len = n;
+    return 0;
+}
+
+void par_file_release(const char* data, size_t len)
+{
+    (void)len;
+    if (data != empty_input) free((void*)data);
+}
+
+/* Windows ではメモリ上に作り、commit で書き出す */
+int par_file_create(const char* path, size_t len, par_out_file* f)
+{
+    f->path = path;
+    f->len = len;
+    f->data = (char*)malloc(len ? len : 1);
+    if (!f->data) { errno = ENOMEM; return -1; }
+    return 0;
+}
+
+int par_file_commit(par_out_file* f)
+{
+    int rc = -1;
+    FILE* fp = fopen(f->path, "wb");
+    if (fp) {
+        int ok = fwrite(f->data, 1, f->len, fp) == f->len;
+        if (fclose(fp) == 0 && ok) rc = 0;
+    }
+    free(f->data);
+    return rc;
+}
+
+void par_file_discard(par_out_file* f)
+{
+    free(f->data);
+}
+
+#endif
+
+/*======================================================================
+ *  5.  公開 API: ファイル
+ *====================================================================*/
+int iconv_alt_convert_file(iconv_t cd, const char* in_path,
+    const char* out_path, unsigned threads, size_t* stop)
+{
+    const iconv_ctx* ctx = (const iconv_ctx*)cd;
+    if (!ctx || cd == (iconv_t)-1 || !in_path || !out_path) {
+        errno = EINVAL; return -1;
+    }
+
+    const char* in;
+    size_t inlen;
+    if (par_file_read(in_path, &in, &inlen) < 0) return -1;
+
+    int rc = -1, err = 0;
+    unsigned nt = thread_count(threads, inlen);
+    par_chunk* c = (par_chunk*)calloc(nt, sizeof(*c));
+    size_t n = c ? plan(ctx, in, inlen, nt, c) : 0;
+    size_t total = c ? measure_all(c, n, in, stop) : (size_t)-1;
+    if (!c) err = ENOMEM;
+    else if (total == (size_t)-1) err = errno;
+
+    /* 計測が通ってから出力を作る */
+    par_out_file of;
+    if (!err && par_file_create(out_path, total, &of) < 0) err = errno;
+    if (!err) {
+        if (total > 0 && convert_all(c, n, in, of.data, stop) == (size_t)-1) err = errno;
+        if (err) par_file_discard(&of);
+        else if (par_file_commit(&of) < 0) err = errno;
+        else rc = 0;
+    }
+
+    par_file_release(in, inlen);
+    free(c);
+    if (rc < 0) errno = err;
+    return rc;
+}
@@ -0,0 +1,672 @@
+/*----------------------------------------------------------------------
+ *  src/pool.c  —  iconv_alt_thread_pool (work-stealing の非同期変換)
+ *
+ *  ワーカーごとに Chase-Lev deque を 1 本持つ。持ち主は底 (bottom) で
+ *  push / take し、他のワーカーは天井 (top) から CAS で盗む。
+ *  外から submit されたジョブは mutex 付きの投入キューに入り、最初に拾った
+ *  ワーカーが準備タスクを実行してチャンクを自分の deque に積む。
+ *
+ *  大きなジョブの段階 (iconv_alt_convert_parallel と同じ):
+ *      準備   → チャンクごとの計測 → 累積和 → チャンクごとの変換 → 完了
+ *  各段の最後のチャンクを終えたワーカーが次の段を積む (remaining で数える)。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include "compat_thread.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdlib.h>
+#include <string.h>
+
+#define POOL_CHUNK      ICONV_ALT_PARALLEL_MIN_CHUNK
+#define DEQUE_INITIAL   64
+#define TASK_PREPARE    SIZE_MAX        /* pool_task.index: 準備タスク */
+
+typedef struct pool_task {
+    struct pool_task* next;             /* 投入キュー用 */
+    iconv_alt_job*    job;
+    size_t            index;            /* チャンク番号 / TASK_PREPARE */
+} pool_task;
+
+/*======================================================================
+ *  1.  Chase-Lev deque
+ *      (Lê, Pop, Cohen, Zappa Nardelli, "Correct and Efficient
+ *       Work-Stealing for Weak Memory Models", PPoPP 2013 の順序付け)
+ *====================================================================*/
+typedef struct cl_array {
+    int64_t          cap;               /* 2 の冪 */
+    struct cl_array* prev;              /* 縮小しない。古い配列は盗み手が読み得るので destroy まで残す */
+    void* volatile   slot[];
+} cl_array;
+
+typedef struct {
+    volatile int64_t top;
+    volatile int64_t bottom;
+    void* volatile   array;             /* cl_array* */
+} cl_deque;
+
+static cl_array* cl_array_new(int64_t cap, cl_array* prev)
+{
+    cl_array* a = (cl_array*)malloc(sizeof(cl_array) + (size_t)cap * sizeof(void*));
+    if (a) { a->cap = cap; a->prev = prev; }
+    return a;
+}
+
+static int cl_init(cl_deque* d)
+{
+    d->top = d->bottom = 0;
+    d->array = cl_array_new(DEQUE_INITIAL, NULL);
+    return d->array ? 0 : -1;
+}
+
+static void cl_destroy(cl_deque* d)
+{
+    cl_array* a = (cl_array*)d->array;
+    while (a) { cl_array* p = a->prev; free(a); a = p; }
+}
+
+/* 持ち主だけが呼ぶ。Return: 0 / -1 (ENOMEM) */
+static int cl_push(cl_deque* d, pool_task* t)
+{
+    int64_t b = compat_load_i64(&d->bottom);
+    int64_t top = compat_load_acq_i64(&d->top);
+    cl_array* a = (cl_array*)compat_load_ptr(&d->array);
+    if (b - top > a->cap - 1) {                         /* 満杯: 倍にして写す */
+        cl_array* na = cl_array_new(a->cap * 2, a);
+        if (!na) return -1;
+        for (int64_t i = top; i < b; ++i)
+            compat_store_ptr(&na->slot[i & (na->cap - 1)],
+                compat_load_ptr(&a->slot[i & (a->cap - 1)]));
+        compat_store_rel_ptr(&d->array, na);
+        a = na;
+    }
+    compat_store_ptr(&a->slot[b & (a->cap - 1)], t);
+    compat_fence_rel();
+    compat_store_i64(&d->bottom, b + 1);
+    return 0;
+}
+
+/* 持ち主だけが呼ぶ (LIFO) */
+static pool_task* cl_take(cl_deque* d)
+{
+    int64_t b = compat_load_i64(&d->bottom) - 1;
+    cl_array* a = (cl_array*)compat_load_ptr(&d->array);
+    compat_store_i64(&d->bottom, b);
+    compat_fence_sc();
+    int64_t t = compat_load_i64(&d->top);
+    pool_task* x = NULL;
+    if (t <= b) {
+        x = (pool_task*)compat_load_ptr(&a->slot[b & (a->cap - 1)]);
+        if (t == b) {                                   /* 最後の 1 個は盗み手と競争 */
+            if (!compat_cas_sc_i64(&d->top, t, t + 1)) x = NULL;
+            compat_store_i64(&d->bottom, b + 1);
+        }
+    } else {
+        compat_store_i64(&d->bottom, b + 1);
+    }
+    return x;
+}
+
+/* 誰でも呼べる (FIFO)。競争に負けたら NULL */
+static pool_task* cl_steal(cl_deque* d)
+{
+    int64_t t = compat_load_acq_i64(&d->top);
+    compat_fence_sc();
+    int64_t b = compat_load_acq_i64(&d->bottom);
+    if (t >= b) return NULL;
+    cl_array* a = (cl_array*)compat_load_acq_ptr(&d->array);
+    pool_task* x = (pool_task*)compat_load_ptr(&a->slot[t & (a->cap - 1)]);
+    return compat_cas_sc_i64(&d->top, t, t + 1) ? x : NULL;
+}
+
+/*======================================================================
+ *  2.  プールとジョブ
+ *====================================================================*/
+typedef struct {
+    iconv_alt_thread_pool* pool;
+    cl_deque               dq;
+    compat_thread          th;
+    uint32_t               rng;         /* 盗む相手の選択 (xorshift) */
+} pool_worker;
+
+struct iconv_alt_thread_pool {
+    unsigned          n;
+    pool_worker*      w;
+    compat_mutex      mu;
+    compat_cond       work_cv;          /* ワーカーの眠り */
+    compat_cond       done_cv;          /* ジョブの完了 */
+    pool_task*        inject_head;      /* 外からの投入 (mu) */
+    pool_task*        inject_tail;
+    volatile uint32_t injected;         /* 投入キューの長さ */
+    volatile uint32_t queued;           /* 積まれてまだ誰も取っていないタスク数 */
+    volatile uint32_t sleepers;
+    int               stop;             /* (mu) */
+    size_t            active;           /* 未完了ジョブ数 (mu) */
+    size_t            poll_pending;     /* callback 無しの未完了ジョブ数 (mu) */
+    iconv_alt_job*    done_head;        /* 完了キュー (mu) */
+    iconv_alt_job*    done_tail;
+};
+
+typedef struct {
+    size_t    in_off, len;              /* BUFFER / FILE: 入力の範囲 */
+    size_t    row_lo, row_hi;           /* COLUMN: 行の範囲 */
+    size_t    out_off;
+    size_t    result;                   /* 出力バイト数 / (size_t)-1 */
+    size_t    stop;                     /* 失敗位置 (入力先頭から) */
+    int       err;
+    pool_task task;
+} job_chunk;
+
+struct iconv_alt_job {
+    iconv_alt_thread_pool* pool;
+    iconv_alt_job_desc     d;
+    const iconv_ctx*       ctx;
+    pool_task              prep;
+    job_chunk*             c;
+    size_t                 n;
+    volatile uint32_t      remaining;   /* 現在の段で未完了のチャンク数 */
+    int                    phase;       /* 1 = 計測 / 2 = 変換 */
+    const char*            in;          /* FILE では map した入力 */
+    size_t                 inlen;
+    char*                  out;         /* FILE では map した出力 */
+    size_t                 outlen;
+    int                    mapped_in, have_out;
+    par_out_file           of;
+    int                    err;
+    size_t                 written, stop;
+    volatile uint32_t      done;
+    int                    in_done_queue;   /* (mu) */
+    iconv_alt_job*         next;
+};
+
+/* 眠っているワーカーがいれば起こす (queued を増やした後に呼ぶ) */
+static void wake_workers(iconv_alt_thread_pool* p)
+{
+    if (compat_load_sc_u32(&p->sleepers) == 0) return;
+    compat_mutex_lock(&p->mu);
+    compat_cond_broadcast(&p->work_cv);
+    compat_mutex_unlock(&p->mu);
+}
+
+/* ジョブのチャンクを自分の deque に積む。積めなければその場で実行する。
+   最後のチャンクを実行し終えるとジョブは解放され得るので、n と c は先に控える */
+static void run_task(pool_worker* w, pool_task* t);
+
+static void push_tasks(pool_worker* w, iconv_alt_job* job)
+{
+    iconv_alt_thread_pool* p = w->pool;
+    size_t n = job->n;
+    job_chunk* c = job->c;
+    compat_add_sc_u32(&p->queued, (uint32_t)n);        /* 先に数える (盗まれて減る前に) */
+    wake_workers(p);
+    for (size_t k = 0; k < n; ++k) {
+        if (cl_push(&w->dq, &c[k].task) == 0) continue;
+        compat_add_sc_u32(&p->queued, (uint32_t)-1);   /* ENOMEM: 自分でやる */
+        run_task(w, &c[k].task);
+    }
+}
+
+/*======================================================================
+ *  3.  ジョブの段階
+ *====================================================================*/
+static void job_finish(iconv_alt_job* job, int err)
+{
+    iconv_alt_thread_pool* p = job->pool;
+    if (job->have_out) {
+        if (err) par_file_discard(&job->of);
+        else if (par_file_commit(&job->of) < 0) err = errno;
+    }
+    if (job->mapped_in) par_file_release(job->in, job->inlen);
+    job->have_out = job->mapped_in = 0;
+    job->err = err;
+
+    iconv_alt_job_callback cb = job->d.callback;
+    void* user = job->d.user;
+    if (cb) {
+        compat_store_rel_u32(&job->done, 1);
+        cb(job, user);                                  /* ここで解放されてもよい */
+        compat_mutex_lock(&p->mu);
+    } else {
+        compat_mutex_lock(&p->mu);
+        compat_store_rel_u32(&job->done, 1);
+        job->next = NULL;
+        job->in_done_queue = 1;
+        if (p->done_tail) p->done_tail->next = job;
+        else p->done_head = job;
+        p->done_tail = job;
+        p->poll_pending--;
+    }
+    p->active--;
+    compat_cond_broadcast(&p->done_cv);
+    compat_mutex_unlock(&p->mu);
+}
+
+/* BUFFER / FILE: 入力を POOL_CHUNK 程度の文字境界で分ける */
+static int plan_bytes(iconv_alt_job* job)
+{
+    size_t most = job->inlen / (POOL_CHUNK / 2) + 2;
+    job->c = (job_chunk*)calloc(most, sizeof(job_chunk));
+    if (!job->c) return -1;
+    size_t lo = 0, n = 0;
+    do {
+        size_t hi = job->inlen;
+        if (hi - lo > POOL_CHUNK) {
+            hi = par_split_point(job->ctx, (const unsigned char*)job->in,
+                job->inlen, lo, lo + POOL_CHUNK);
+            if (hi <= lo) hi = job->inlen;
+        }
+        job->c[n].in_off = lo;
+        job->c[n].len = hi - lo;
+        ++n;
+        lo = hi;
+    } while (lo < job->inlen && n < most - 1);
+    if (lo < job->inlen) job->c[n - 1].len += job->inlen - lo;
+    job->n = n;
+    return 0;
+}
+
+/* COLUMN: 行をまとめて POOL_CHUNK 程度ずつ */
+static int plan_rows(iconv_alt_job* job)
+{
+    const size_t* o = job->d.in_offsets;
+    size_t rows = job->d.rows;
+    size_t most = (o[rows] - o[0]) / POOL_CHUNK + 2;
+    if (most > rows) most = rows ? rows : 1;
+    job->c = (job_chunk*)calloc(most, sizeof(job_chunk));
+    if (!job->c) return -1;
+    size_t n = 0, r = 0;
+    while (r < rows && n < most) {
+        size_t lo = r;
+        while (r < rows && (o[r] - o[lo] < POOL_CHUNK || r == lo)) ++r;
+        if (n == most - 1) r = rows;                   /* 残りは最後のチャンクへ */
+        job->c[n].row_lo = lo;
+        job->c[n].row_hi = r;
+        ++n;
+    }
+    job->n = n;
+    return 0;
+}
+
+static void chunk_measure(iconv_alt_job* job, job_chunk* c)
+{
+    iconv_t cd = (iconv_t)job->ctx;
+    c->err = 0;
+    if (job->d.kind != ICONV_ALT_JOB_COLUMN) {
+        c->result = iconv_alt_measure(cd, job->in + c->in_off, c->len, &c->stop);
+        if (c->result == (size_t)-1) { c->err = errno; c->stop += c->in_off; }
+        return;
+    }
+    /* 行ごとのサイズを out_offsets[row + 1] に仮置きする */
+    const size_t* o = job->d.in_offsets;
+    size_t sum = 0;
+    for (size_t r = c->row_lo; r < c->row_hi; ++r) {
+        size_t local = 0;
+        size_t m = iconv_alt_measure(cd, job->d.in + o[r], o[r + 1] - o[r], &local);
+        if (m == (size_t)-1) {
+            c->err = errno;
+            c->stop = o[r] + local;
+            c->result = (size_t)-1;
+            return;
+        }
+        job->d.out_offsets[r + 1] = m;
+        sum += m;
+    }
+    c->result = sum;
+}
+
+static void chunk_convert(iconv_alt_job* job, job_chunk* c)
+{
+    iconv_t cd = (iconv_t)job->ctx;
+    c->err = 0;
+    if (job->d.kind != ICONV_ALT_JOB_COLUMN) {
+        size_t r = iconv_alt_convert(cd, job->in + c->in_off, c->len,
+            job->out + c->out_off, c->result, &c->stop);
+        if (r == (size_t)-1) { c->err = errno; c->stop += c->in_off; }
+        return;
+    }
+    const size_t* o = job->d.in_offsets;
+    size_t* oo = job->d.out_offsets;
+    for (size_t r = c->row_lo; r < c->row_hi; ++r) {
+        size_t local = 0;
+        if (iconv_alt_convert(cd, job->d.in + o[r], o[r + 1] - o[r],
+                job->out + oo[r], oo[r + 1] - oo[r], &local) == (size_t)-1) {
+            c->err = errno;
+            c->stop = o[r] + local;
+            return;
+        }
+    }
+}
+
+/* 最初に失敗したチャンクの errno (無ければ 0) */
+static int first_error(iconv_alt_job* job)
+{
+    for (size_t k = 0; k < job->n; ++k) {
+        if (!job->c[k].err) continue;
+        int err = job->c[k].err;
+        /* バイト列の途中のチャンクが文字の途中で終わった = 逐次なら EILSEQ */
+        if (err == EINVAL && job->d.kind != ICONV_ALT_JOB_COLUMN && k + 1 < job->n) err = EILSEQ;
+        job->stop = job->c[k].stop;
+        return err;
+    }
+    return 0;
+}
+
+static void start_phase(pool_worker* w, iconv_alt_job* job, int phase)
+{
+    job->phase = phase;
+    compat_store_rel_u32(&job->remaining, (uint32_t)job->n);
+    push_tasks(w, job);
+}
+
+/* 計測が全部終わった: 出力位置を決めて変換段へ */
+static void job_measured(pool_worker* w, iconv_alt_job* job)
+{
+    int err = first_error(job);
+    if (err) { job_finish(job, err); return; }
+
+    size_t total = 0;
+    for (size_t k = 0; k < job->n; ++k) {
+        job->c[k].out_off = total;
+        total += job->c[k].result;
+    }
+    if (job->d.kind == ICONV_ALT_JOB_COLUMN) {
+        size_t* oo = job->d.out_offsets;
+        for (size_t r = 0; r < job->d.rows; ++r) oo[r + 1] += oo[r];
+    }
+
+    if (job->d.kind == ICONV_ALT_JOB_FILE) {
+        if (par_file_create(job->d.out_path, total, &job->of) < 0) { job_finish(job, errno); return; }
+        job->have_out = 1;
+        job->out = job->of.data;
+        job->outlen = total;
+    } else if (total > job->outlen) {
+        /* 収まらない。BUFFER は溢れるチャンクを逐次変換して停止位置を得る */
+        size_t k = 0;
+        while (job->c[k].out_off + job->c[k].result <= job->outlen) ++k;
+        if (job->d.kind == ICONV_ALT_JOB_BUFFER) {
+            job_chunk* c = &job->c[k];
+            size_t local = 0;
+            iconv_alt_convert((iconv_t)job->ctx, job->in + c->in_off, c->len,
+                job->out + c->out_off, job->outlen - c->out_off, &local);
+            job->stop = c->in_off + local;
+        } else {
+            const size_t* oo = job->d.out_offsets;
+            size_t r = job->c[k].row_lo;
+            while (oo[r + 1] <= job->outlen) ++r;
+            job->stop = job->d.in_offsets[r];
+        }
+        job_finish(job, E2BIG);
+        return;
+    }
+    job->written = total;
+    start_phase(w, job, 2);
+}
+
+static void job_prepare(pool_worker* w, iconv_alt_job* job)
+{
+    if (job->d.kind == ICONV_ALT_JOB_FILE) {
+        if (par_file_read(job->d.in_path, &job->in, &job->inlen) < 0) { job_finish(job, errno); return; }
+        job->mapped_in = 1;
+    }
+    if (job->d.kind == ICONV_ALT_JOB_COLUMN) {
+        job->d.out_offsets[0] = 0;
+        if (job->d.rows == 0) { job_finish(job, 0); return; }
+    }
+
+    /* 小さな BUFFER は計測せずにそのまま変換する */
+    if (job->d.kind == ICONV_ALT_JOB_BUFFER && job->inlen <= POOL_CHUNK) {
+        size_t r = iconv_alt_convert((iconv_t)job->ctx, job->in, job->inlen,
+            job->out, job->outlen, &job->stop);
+        if (r == (size_t)-1) { job_finish(job, errno); return; }
+        job->written = r;
+        job_finish(job, 0);
+        return;
+    }
+
+    int rc = (job->d.kind == ICONV_ALT_JOB_COLUMN) ? plan_rows(job) : plan_bytes(job);
+    if (rc < 0) { job_finish(job, ENOMEM); return; }
+    for (size_t k = 0; k < job->n; ++k) {
+        job->c[k].task.job = job;
+        job->c[k].task.index = k;
+    }
+    start_phase(w, job, 1);
+}
+
+static void run_task(pool_worker* w, pool_task* t)
+{
+    iconv_alt_job* job = t->job;
+    if (t->index == TASK_PREPARE) { job_prepare(w, job); return; }
+
+    job_chunk* c = &job->c[t->index];
+    if (job->phase == 1) chunk_measure(job, c);
+    else chunk_convert(job, c);
+
+    /* この段の最後のチャンクなら次へ進める */
+    if (compat_add_sc_u32(&job->remaining, (uint32_t)-1) != 0) return;
+    if (job->phase == 1) { job_measured(w, job); return; }
+    int err = first_error(job);
+    if (err) job->written = 0;
+    job_finish(job, err);
+}
+
+/*======================================================================
+ *  4.  ワーカー
+ *====================================================================*/
+static pool_task* pop_injected(iconv_alt_thread_pool* p)
+{
+    if (compat_load_sc_u32(&p->injected) == 0) return NULL;
+    compat_mutex_lock(&p->mu);
+    pool_task* t = p->inject_head;
+    if (t) {
+        p->inject_head = t->next;
+        if (!p->inject_head) p->inject_tail = NULL;
+        compat_add_sc_u32(&p->injected, (uint32_t)-1);
+    }
+    compat_mutex_unlock(&p->mu);
+    return t;
+}
+
+static pool_task* find_task(pool_worker* w)
+{
+    iconv_alt_thread_pool* p = w->pool;
+    pool_task* t = cl_take(&w->dq);
+    if (t) return t;
+    if ((t = pop_injected(p)) != NULL) return t;
+
+    w->rng ^= w->rng << 13; w->rng ^= w->rng >> 17; w->rng ^= w->rng << 5;
+    unsigned start = w->rng % p->n;
+    for (unsigned i = 0; i < p->n; ++i) {
+        pool_worker* v = &p->w[(start + i) % p->n];
+        if (v != w && (t = cl_steal(&v->dq)) != NULL) return t;
+    }
+    return NULL;
+}
+
+static void worker_main(void* arg)
+{
+    pool_worker* w = (pool_worker*)arg;
+    iconv_alt_thread_pool* p = w->pool;
+    for (;;) {
+        pool_task* t = find_task(w);
+        if (t) {
+            compat_add_sc_u32(&p->queued, (uint32_t)-1);
+            run_task(w, t);
+            continue;
+        }
+        if (compat_load_sc_u32(&p->queued) != 0) continue;   /* 盗みの競争に負けただけ */
+
+        compat_mutex_lock(&p->mu);
+        compat_add_sc_u32(&p->sleepers, 1);
+        while (!p->stop && compat_load_sc_u32(&p->queued) == 0)
+            compat_cond_wait(&p->work_cv, &p->mu);
+        compat_add_sc_u32(&p->sleepers, (uint32_t)-1);
+        int quit = p->stop && compat_load_sc_u32(&p->queued) == 0;
+        compat_mutex_unlock(&p->mu);
+        if (quit) return;
+    }
+}
+
+/*======================================================================
+ *  5.  公開 API
+ *====================================================================*/
+iconv_alt_thread_pool* iconv_alt_thread_pool_create(unsigned threads)
+{
+    if (threads == 0) threads = compat_cpu_count();
+    iconv_alt_thread_pool* p = (iconv_alt_thread_pool*)calloc(1, sizeof(*p));
+    if (!p) { errno = ENOMEM; return NULL; }
+    p->w = (pool_worker*)calloc(threads, sizeof(pool_worker));
+    if (!p->w) { free(p); errno = ENOMEM; return NULL; }
+    compat_mutex_init(&p->mu);
+    compat_cond_init(&p->work_cv);
+    compat_cond_init(&p->done_cv);
+
+    for (unsigned i = 0; i < threads; ++i) {
+        pool_worker* w = &p->w[i];
+        w->pool = p;
+        w->rng = 0x9E3779B9u * (i + 1);
+        if (cl_init(&w->dq) < 0) break;
+        p->n = i + 1;          /* 盗み先の数: deque を作った分だけ */
+    }
+    unsigned started = 0;
+    for (; started < p->n; ++started)
+        if (compat_thread_create(&p->w[started].th, worker_main, &p->w[started]) < 0) break;
+    if (started < threads) {
+        /* 全部そろわなければ失敗 */
+        compat_mutex_lock(&p->mu);
+        p->stop = 1;
+        compat_cond_broadcast(&p->work_cv);
+        compat_mutex_unlock(&p->mu);
+        for (unsigned i = 0; i < started; ++i) compat_thread_join(p->w[i].th);
+        for (unsigned i = 0; i < p->n; ++i) cl_destroy(&p->w[i].dq);
+        compat_cond_destroy(&p->done_cv);
+        compat_cond_destroy(&p->work_cv);
+        compat_mutex_destroy(&p->mu);
+        free(p->w);
+        free(p);
+        errno = ENOMEM;
+        return NULL;
+    }
+    return p;
+}
+
+void iconv_alt_thread_pool_destroy(iconv_alt_thread_pool* pool)
+{
+    if (!pool) return;
+    compat_mutex_lock(&pool->mu);
+    while (pool->active > 0) compat_cond_wait(&pool->done_cv, &pool->mu);
+    pool->stop = 1;
+    compat_cond_broadcast(&pool->work_cv);
+    compat_mutex_unlock(&pool->mu);
+
+    for (unsigned i = 0; i < pool->n; ++i) compat_thread_join(pool->w[i].th);
+    for (unsigned i = 0; i < pool->n; ++i) cl_destroy(&pool->w[i].dq);
+
+    iconv_alt_job* j = pool->done_head;
+    while (j) { iconv_alt_job* next = j->next; free(j->c); free(j); j = next; }
+
+    compat_cond_destroy(&pool->done_cv);
+    compat_cond_destroy(&pool->work_cv);
+    compat_mutex_destroy(&pool->mu);
+    free(pool->w);
+    free(pool);
+}
+
+iconv_alt_job* iconv_alt_thread_pool_submit(iconv_alt_thread_pool* pool,
+    const iconv_alt_job_desc* desc)
+{
+    if (!pool || !desc || !desc->cd || desc->cd == (iconv_t)-1) { errno = EINVAL; return NULL; }
+    switch (desc->kind) {
+    case ICONV_ALT_JOB_BUFFER:
+        if ((!desc->in && desc->inlen) || (!desc->out && desc->outlen)) { errno = EINVAL; return NULL; }
+        break;
+    case ICONV_ALT_JOB_FILE:
+        if (!desc->in_path || !desc->out_path) { errno = EINVAL; return NULL; }
+        break;
+    case ICONV_ALT_JOB_COLUMN:
+        if (!desc->in_offsets || !desc->out_offsets || (!desc->in && desc->rows) ||
+            (!desc->out && desc->outlen)) { errno = EINVAL; return NULL; }
+        break;
+    default:
+        errno = EINVAL; return NULL;
+    }
+
+    iconv_alt_job* job = (iconv_alt_job*)calloc(1, sizeof(*job));
+    if (!job) { errno = ENOMEM; return NULL; }
+    job->pool = pool;
+    job->d = *desc;
+    job->ctx = (const iconv_ctx*)desc->cd;
+    job->in = desc->in;
+    job->inlen = desc->inlen;
+    job->out = desc->out;
+    job->outlen = desc->outlen;
+    job->prep.job = job;
+    job->prep.index = TASK_PREPARE;
+
+    compat_mutex_lock(&pool->mu);
+    pool->active++;
+    if (!desc->callback) pool->poll_pending++;
+    if (pool->inject_tail) pool->inject_tail->next = &job->prep;
+    else pool->inject_head = &job->prep;
+    pool->inject_tail = &job->prep;
+    compat_add_sc_u32(&pool->injected, 1);
+    compat_add_sc_u32(&pool->queued, 1);
+    compat_cond_broadcast(&pool->work_cv);
+    compat_mutex_unlock(&pool->mu);
+    return job;
+}
+
+iconv_alt_job* iconv_alt_thread_pool_poll(iconv_alt_thread_pool* pool, int wait)
+{
+    if (!pool) return NULL;
+    compat_mutex_lock(&pool->mu);
+    while (!pool->done_head && wait && pool->poll_pending > 0)
+        compat_cond_wait(&pool->done_cv, &pool->mu);
+    iconv_alt_job* job = pool->done_head;
+    if (job) {
+        pool->done_head = job->next;
+        if (!pool->done_head) pool->done_tail = NULL;
+        job->in_done_queue = 0;
+    }
+    compat_mutex_unlock(&pool->mu);
+    return job;
+}
+
+int iconv_alt_job_done(const iconv_alt_job* job)
+{
+    return compat_load_acq_u32((volatile uint32_t*)&job->done) != 0;
+}
+
+void iconv_alt_job_wait(iconv_alt_job* job)
+{
+    iconv_alt_thread_pool* p = job->pool;
+    if (iconv_alt_job_done(job)) return;
+    compat_mutex_lock(&p->mu);
+    while (!iconv_alt_job_done(job)) compat_cond_wait(&p->done_cv, &p->mu);
+    compat_mutex_unlock(&p->mu);
+}
+
+int iconv_alt_job_result(const iconv_alt_job* job, size_t* written,
+    size_t* stop, void** user)
+{
+    if (written) *written = job->written;
+    if (stop) *stop = job->stop;
+    if (user) *user = job->d.user;
+    return job->err;
+}
+
+void iconv_alt_job_release(iconv_alt_job* job)
+{
+    if (!job) return;
+    iconv_alt_thread_pool* p = job->pool;
+    compat_mutex_lock(&p->mu);
+    if (job->in_done_queue) {                     /* poll せずに解放: キューから外す */
+        iconv_alt_job** pp = &p->done_head;
+        iconv_alt_job* prev = NULL;
+        while (*pp != job) { prev = *pp; pp = &(*pp)->next; }
+        *pp = job->next;
+        if (p->done_tail == job) p->done_tail = prev;
+    }
+    compat_mutex_unlock(&p->mu);
+    free(job->c);
+    free(job);
+}
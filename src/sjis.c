@@ -1,7 +1,8 @@
 /*----------------------------------------------------------------------
  *  src/sjis.c  —  Shift‑JIS ⇆ UTF‑8 変換コア
  *--------------------------------------------------------------------*/
-#include "sjis_table.h"   /* SJIS_MAP[] / sjis_pair_t                 */
+#include "sjis_table.h"   /* SJIS_DB2U[] / U2SJIS[] ほか              */
+#include "iconv_internal.h" /* sjis_is_lead                           */
 #include <stddef.h>       /* size_t                                   */
 #include <stdint.h>       /* uint16_t / uint32_t                      */
 #include <string.h>       /* memcpy                                   */
@@ -10,29 +11,24 @@
   *  1.  SJIS <-> Unicode ルックアップ
   *====================================================================*/
 
-  /*--- SJIS → Unicode --------------------------------------------------*/
+  /*--- SJIS → Unicode (2 段テーブル、分岐は 1 byte / 2 byte のみ) ----*/
 int sjis_to_unicode(uint16_t code, uint32_t* uni)
 {
-    int lo = 0, hi = (int)(sizeof(SJIS_MAP) / sizeof(SJIS_MAP[0])) - 1;
-    while (lo <= hi) {
-        int mid = (lo + hi) / 2;
-        if (SJIS_MAP[mid].sjis == code) { *uni = SJIS_MAP[mid].uni; return 0; }
-        (code < SJIS_MAP[mid].sjis) ? (hi = mid - 1) : (lo = mid + 1);
-    }
-    return -1;                 /* 該当なし */
+    uint16_t u = (code < 0x100) ? SJIS_SB2U[code]
+                                : SJIS_DB2U[SJIS_LEAD2ROW[code >> 8]][code & 0xFF];
+    if (u == SJIS_NOMAP) return -1;      /* 該当なし */
+    *uni = u;
+    return 0;
 }
 
-/*--- Unicode → SJIS --------------------------------------------------*/
+/*--- Unicode → SJIS (BMP を 256 コード点ごとのページで引く) ----------*/
 int unicode_to_sjis(uint32_t uni, uint16_t* sjis)
 {
-    /* 線形検索でも十分速い（17 k 件 × O(1)）が、簡易ハッシュで高速化 */
-    static const uint32_t HASH_MOD = 65521;   /* largest prime < 2^16      */
-    uint32_t start = uni % HASH_MOD;
-    for (size_t i = 0; i < sizeof(SJIS_MAP) / sizeof(SJIS_MAP[0]); ++i) {
-        size_t idx = (start + i) % (sizeof(SJIS_MAP) / sizeof(SJIS_MAP[0]));
-        if (SJIS_MAP[idx].uni == uni) { *sjis = SJIS_MAP[idx].sjis; return 0; }
-    }
-    return -1;
+    if (uni > 0xFFFF) return -1;         /* CP932 は BMP のみ */
+    uint16_t s = U2SJIS[U2SJIS_PAGE[uni >> 8]][uni & 0xFF];
+    if (s == SJIS_NOMAP) return -1;
+    *sjis = s;
+    return 0;
 }
 
 /*======================================================================
@@ -122,3 +118,52 @@ int sjis_put(uint16_t code, char** out, size_t* left)
     }
     return 0;
 }
+
+/*------------------------------------------------------------------*/
+/*  文字境界の再同期 (並列分割用)                                    */
+/*------------------------------------------------------------------*/
+/* buf[pos] を含む文字の先頭を返す。lo は pos 以下の既知の文字境界。
+   lead になり得るバイト (0x81–0x9F / 0xE0–0xFC) は trail にもなり得るので、
+   直前の「lead になり得ない」バイトまで戻り、そこからの連続数の偶奇で決める */
+size_t sjis_resync(const unsigned char* buf, size_t lo, size_t pos)
+{
+    size_t q = pos;
+    while (q > lo) {
+        if (!sjis_is_lead(buf[q - 1])) break;
+        --q;
+    }
+    return ((pos - q) & 1) ? pos - 1 : pos;
+}
+
+/*------------------------------------------------------------------*/
+/*  汎用変換 (M_PIVOT) 用の 1 文字処理                               */
+/*------------------------------------------------------------------*/
+/* 0x80 以上で半角カナ以外は 2 byte の先頭 (iconv() の SJIS → UTF-8 と同じ) */
+int cp932_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    (void)c;
+    uint16_t sj = p[0];
+    int len = 1;
+    if (sj >= 0x80 && !(sj >= 0xA1 && sj <= 0xDF)) {
+        if (n < 2) return 0;
+        sj = (uint16_t)((sj << 8) | p[1]);
+        len = 2;
+    }
+    return sjis_to_unicode(sj, cp) == 0 ? len : -1;
+}
+
+int cp932_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    (void)c;
+    uint16_t sj;
+    if (unicode_to_sjis(cp, &sj) != 0) return -1;
+    if (sj < 0x100) {
+        if (room < 1) return -2;
+        q[0] = (unsigned char)sj;
+        return 1;
+    }
+    if (room < 2) return -2;
+    q[0] = (unsigned char)(sj >> 8);
+    q[1] = (unsigned char)(sj & 0xFF);
+    return 2;
+}
@@ -0,0 +1,217 @@
+/*----------------------------------------------------------------------
+ *  src/sjis2004.c  —  Shift_JIS-2004 (JIS X 0213:2004) と UTF-8 ⇆ Shift_JIS-2004 の核
+ *
+ *  バイトの構造は CP932 と同じ (lead 0x81–0x9F / 0xE0–0xFC、trail 0x40–0xFC)。
+ *  表は scripts/gen_sjis2004_table.py が作る sjis2004_table.h:
+ *      SJ2004_DB2U   : 2 byte → コード点 (第 2 面の漢字は補助面)。
+ *                      25 字は 2 コード点 (か + U+309A など) → SJ2004_PAIRS
+ *      U2SJ2004      : コード点 → SJIS。合成の基底 (か・æ・˩ など 21 字) は
+ *                      SJ2004_BASE + 添字 → SJ2004_BASES
+ *  復号で 2 コード点になる文字は 2 つ目を c->dpend に置き、pivot_iconv() が続けて
+ *  符号化する (1 歩で 2 文字分書くので、1 歩の上限 ENC_STEP_MAX は prefix + 2 × max_out)。符号化では基底を c->ehold に預け、次のコード点が結合文字なら
+ *  合成済みの 1 コードで書く (1 文字の先読み)。預けた基底は次の文字か
+ *  iconv(cd, NULL, ...) → sjis2004_reset() で書き出す。基底以外の文字は
+ *  逆引きの値を 1 回比べるだけで、先読みの費用はかからない。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include "sjis2004_table.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+static inline int is_kana(unsigned b) { return b - 0xA1u <= 0x3Eu; }
+
+/* 逆引きの値が合成の基底か */
+static inline int is_base(uint16_t s) { return s >= SJ2004_BASE && s < 0x8100; }
+
+/* コード点 → SJIS / SJ2004_BASE + 添字 / SJ2004_U_NOMAP */
+static inline uint16_t u2sj(uint32_t cp)
+{
+    if (cp >= 0x30000) return SJ2004_U_NOMAP;
+    return U2SJ2004[U2SJ2004_PAGE[cp >> 8]][cp & 0xFF];
+}
+
+static inline size_t code_len(uint16_t s) { return s < 0x100 ? 1 : 2; }
+
+static inline unsigned char* put_code(unsigned char* q, uint16_t s)
+{
+    if (s < 0x100) { *q++ = (unsigned char)s; return q; }
+    q[0] = (unsigned char)(s >> 8);
+    q[1] = (unsigned char)(s & 0xFF);
+    return q + 2;
+}
+
+/*======================================================================
+ *  1.  1 文字の復号 / 符号化
+ *====================================================================*/
+int sjis2004_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    unsigned b = p[0];
+    if (b < 0x80)   { *cp = b; return 1; }
+    if (is_kana(b)) { *cp = b + 0xFEC0u; return 1; }
+    if (!sjis_is_lead(b)) return -1;                    /* 0x80 / 0xA0 / 0xFD– */
+    if (n < 2) return 0;
+    uint32_t v = SJ2004_DB2U[SJ2004_LEAD2ROW[b]][p[1]];
+    if (v == SJ2004_NOMAP) return -1;
+    if (v >= SJ2004_PAIR) {                             /* 基底 + 結合文字 */
+        *cp = SJ2004_PAIRS[v - SJ2004_PAIR][0];
+        c->dpend = SJ2004_PAIRS[v - SJ2004_PAIR][1];
+    }
+    else *cp = v;
+    return 2;
+}
+
+int sjis2004_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    uint16_t held = 0;
+    if (c->ehold) {
+        const sj2004_base_t* b = &SJ2004_BASES[u2sj(c->ehold) - SJ2004_BASE];
+        for (int k = 0; k < 2; ++k)
+            if (b->comb[k] && b->comb[k] == cp) {       /* 合成済みの 1 コードで書く */
+                if (room < 2) return -2;
+                put_code(q, b->with[k]);
+                c->ehold = 0;
+                return 2;
+            }
+        held = b->sjis;                                 /* 合成しない: 基底を先に書く */
+    }
+    uint16_t s = u2sj(cp);
+    if (s == SJ2004_U_NOMAP) return -1;                 /* 預けた基底はそのまま */
+    size_t hl = held ? code_len(held) : 0;
+    if (is_base(s)) {                                   /* 次の文字まで預ける */
+        if (room < hl) return -2;
+        if (held) put_code(q, held);
+        c->ehold = cp;
+        return (int)hl;
+    }
+    if (room < hl + code_len(s)) return -2;
+    if (held) q = put_code(q, held);
+    put_code(q, s);
+    c->ehold = 0;
+    return (int)(hl + code_len(s));
+}
+
+int sjis2004_reset(iconv_ctx* c, unsigned char* q, size_t room)
+{
+    if (!c->ehold) return 0;
+    uint16_t s = SJ2004_BASES[u2sj(c->ehold) - SJ2004_BASE].sjis;
+    if (room < code_len(s)) return -2;
+    put_code(q, s);
+    c->ehold = 0;
+    return (int)code_len(s);
+}
+
+/*======================================================================
+ *  2.  Shift_JIS-2004 ⇆ UTF-8 の核 (pair_kernel)
+ *====================================================================*/
+/* コード点を UTF-8 で書く (0x815F = U+005C のように 2 byte でも ASCII になる) */
+static inline unsigned char* put_utf8(unsigned char* q, uint32_t u)
+{
+    if (u < 0x80) { *q = (unsigned char)u; return q + 1; }
+    if (u < 0x800) {
+        q[0] = (unsigned char)(0xC0 | (u >> 6));
+        q[1] = (unsigned char)(0x80 | (u & 0x3F));
+        return q + 2;
+    }
+    if (u < 0x10000) {
+        q[0] = (unsigned char)(0xE0 | (u >> 12));
+        q[1] = (unsigned char)(0x80 | ((u >> 6) & 0x3F));
+        q[2] = (unsigned char)(0x80 | (u & 0x3F));
+        return q + 3;
+    }
+    q[0] = (unsigned char)(0xF0 | (u >> 18));
+    q[1] = (unsigned char)(0x80 | ((u >> 12) & 0x3F));
+    q[2] = (unsigned char)(0x80 | ((u >> 6) & 0x3F));
+    q[3] = (unsigned char)(0x80 | (u & 0x3F));
+    return q + 4;
+}
+
+/* 完結した正しい UTF-8 の 1 文字を読む。Return: 長さ / 0 = 途中・不正 (1 文字ずつの経路へ) */
+static inline int peek_utf8(const unsigned char* p, const unsigned char* end, uint32_t* cp)
+{
+    size_t n = (size_t)(end - p);
+    unsigned b = p[0];
+    if (b < 0x80) { *cp = b; return 1; }
+    if (b < 0xC2 || n < 2 || (p[1] & 0xC0) != 0x80) return 0;
+    if (b < 0xE0) { *cp = ((b & 0x1Fu) << 6) | (p[1] & 0x3Fu); return 2; }
+    if (n < 3 || (p[2] & 0xC0) != 0x80) return 0;
+    if (b < 0xF0) {
+        if ((b == 0xE0 && p[1] < 0xA0) || (b == 0xED && p[1] > 0x9F)) return 0;
+        *cp = ((b & 0x0Fu) << 12) | ((p[1] & 0x3Fu) << 6) | (p[2] & 0x3Fu);
+        return 3;
+    }
+    if (b > 0xF4 || n < 4 || (p[3] & 0xC0) != 0x80) return 0;
+    if ((b == 0xF0 && p[1] < 0x90) || (b == 0xF4 && p[1] > 0x8F)) return 0;
+    *cp = ((b & 0x07u) << 18) | ((p[1] & 0x3Fu) << 12) | ((p[2] & 0x3Fu) << 6) | (p[3] & 0x3Fu);
+    return 4;
+}
+
+void sjis2004_to_utf8_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    (void)c;
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        unsigned b = *p;
+        if (b < 0x80) {
+            size_t n = ascii_span(p, (size_t)(end - p));
+            if (n > (size_t)(qend - q)) n = (size_t)(qend - q);
+            if (n == 0) break;
+            memcpy(q, p, n);
+            p += n; q += n;
+            continue;
+        }
+        if (qend - q < 6) break;                        /* 2 コード点 (3 + 3) まで */
+        if (is_kana(b)) { q = put_utf8(q, b + 0xFEC0u); p += 1; continue; }
+        if (end - p < 2) break;
+        uint32_t v = SJ2004_DB2U[SJ2004_LEAD2ROW[b]][p[1]];
+        if (v == SJ2004_NOMAP) break;                   /* lead でない / 未定義 */
+        if (v >= SJ2004_PAIR) {
+            q = put_utf8(q, SJ2004_PAIRS[v - SJ2004_PAIR][0]);
+            q = put_utf8(q, SJ2004_PAIRS[v - SJ2004_PAIR][1]);
+        }
+        else q = put_utf8(q, v);
+        p += 2;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+void utf8_to_sjis2004_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+    if (c->ehold) return;                               /* 預けた基底は 1 文字ずつの経路で */
+
+    while (p < end) {
+        if (*p < 0x80) {
+            size_t n = ascii_span(p, (size_t)(end - p));
+            if (n > (size_t)(qend - q)) n = (size_t)(qend - q);
+            if (n == 0) break;
+            memcpy(q, p, n);
+            p += n; q += n;
+            continue;
+        }
+        uint32_t u;
+        int len = peek_utf8(p, end, &u);
+        if (len == 0 || qend - q < 2) break;
+        uint16_t s = u2sj(u);
+        if (s == SJ2004_U_NOMAP) break;
+        if (is_base(s)) {                               /* 次の文字を先読みして合成 */
+            const sj2004_base_t* b = &SJ2004_BASES[s - SJ2004_BASE];
+            uint32_t next;
+            int nl = p + len < end ? peek_utf8(p + len, end, &next) : 0;
+            if (nl == 0) break;                         /* 入力の終わり: 基底を預ける */
+            s = b->sjis;
+            for (int k = 0; k < 2; ++k)
+                if (b->comb[k] && b->comb[k] == next) { s = b->with[k]; len += nl; break; }
+        }
+        q = put_code(q, s);
+        p += len;
+    }
+    *pp = p;
+    *qq = q;
+}
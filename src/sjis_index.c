@@ -0,0 +1,140 @@
+/*----------------------------------------------------------------------
+ *  src/sjis_index.c  —  SJIS の文字境界 (resync と疎な境界インデックス)
+ *
+ *  チェックポイントは interval バイトごとに 1 個。各チェックポイントは
+ *  その位置以降で最初の文字境界のオフセットと、そこまでの文字数を持つ。
+ *  検索は二分探索でチェックポイントを選び、そこから前へ歩く。
+ *  ASCII の連続は ascii_span() でまとめて飛ばす (1 byte = 1 文字)。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include <errno.h>
+#include <stdlib.h>
+
+typedef struct {
+    size_t offset;      /* 文字境界 */
+    size_t chars;       /* offset より前の文字数 */
+} sjis_checkpoint;
+
+struct iconv_alt_sjis_index {
+    const unsigned char* buf;
+    size_t               len;
+    size_t               count;     /* 総文字数 */
+    size_t               n;         /* チェックポイント数 (cp[0] = {0, 0}) */
+    sjis_checkpoint      cp[];
+};
+
+/* buf[pos] から始まる文字のバイト数 */
+static size_t char_width(const iconv_alt_sjis_index* x, size_t pos)
+{
+    return (sjis_is_lead(x->buf[pos]) && pos + 1 < x->len) ? 2 : 1;
+}
+
+/*======================================================================
+ *  1.  resync
+ *====================================================================*/
+size_t iconv_alt_sjis_resync(const char* buf, size_t pos)
+{
+    return sjis_resync((const unsigned char*)buf, 0, pos);
+}
+
+/*======================================================================
+ *  2.  インデックスの構築
+ *====================================================================*/
+iconv_alt_sjis_index* iconv_alt_sjis_index_build(const char* buf, size_t len,
+    size_t interval)
+{
+    if (!buf && len) { errno = EINVAL; return NULL; }
+    if (interval == 0) interval = ICONV_ALT_SJIS_INDEX_INTERVAL;
+    size_t most = len / interval + 1;
+    iconv_alt_sjis_index* x = (iconv_alt_sjis_index*)malloc(
+        sizeof(*x) + most * sizeof(sjis_checkpoint));
+    if (!x) { errno = ENOMEM; return NULL; }
+    x->buf = (const unsigned char*)buf;
+    x->len = len;
+    x->cp[0].offset = 0;
+    x->cp[0].chars = 0;
+    x->n = 1;
+
+    size_t pos = 0, chars = 0, next = interval;
+    while (pos < len) {
+        if (pos >= next) {                     /* 2 byte 文字が跨いだら直後の境界 */
+            x->cp[x->n].offset = pos;
+            x->cp[x->n].chars = chars;
+            x->n++;
+            next = pos - pos % interval + interval;
+        }
+        size_t lim = (next < len ? next : len) - pos;
+        size_t run = ascii_span(x->buf + pos, lim);
+        if (run) { pos += run; chars += run; continue; }
+        pos += char_width(x, pos);
+        chars++;
+    }
+    x->count = chars;
+    return x;
+}
+
+void iconv_alt_sjis_index_free(iconv_alt_sjis_index* index)
+{
+    free(index);
+}
+
+size_t iconv_alt_sjis_index_count(const iconv_alt_sjis_index* index)
+{
+    return index->count;
+}
+
+/*======================================================================
+ *  3.  検索
+ *====================================================================*/
+/* key 以下で最後のチェックポイント (by_chars: 文字数で / 0: オフセットで) */
+static const sjis_checkpoint* find_checkpoint(const iconv_alt_sjis_index* x,
+    size_t key, int by_chars)
+{
+    size_t lo = 0, hi = x->n;                  /* cp[lo] <= key < cp[hi] */
+    while (hi - lo > 1) {
+        size_t mid = lo + (hi - lo) / 2;
+        size_t v = by_chars ? x->cp[mid].chars : x->cp[mid].offset;
+        if (v <= key) lo = mid;
+        else hi = mid;
+    }
+    return &x->cp[lo];
+}
+
+size_t iconv_alt_sjis_index_offset(const iconv_alt_sjis_index* index,
+    size_t char_index)
+{
+    const iconv_alt_sjis_index* x = index;
+    if (char_index > x->count) { errno = ERANGE; return (size_t)-1; }
+    if (char_index == x->count) return x->len;
+
+    const sjis_checkpoint* c = find_checkpoint(x, char_index, 1);
+    size_t pos = c->offset, chars = c->chars;
+    while (chars < char_index) {
+        size_t run = ascii_span(x->buf + pos, char_index - chars);
+        if (run) { pos += run; chars += run; continue; }
+        pos += char_width(x, pos);
+        chars++;
+    }
+    return pos;
+}
+
+size_t iconv_alt_sjis_index_char(const iconv_alt_sjis_index* index,
+    size_t offset, size_t* start)
+{
+    const iconv_alt_sjis_index* x = index;
+    if (offset > x->len) { errno = ERANGE; return (size_t)-1; }
+
+    const sjis_checkpoint* c = find_checkpoint(x, offset, 0);
+    size_t pos = c->offset, chars = c->chars;
+    while (pos < offset) {
+        size_t run = ascii_span(x->buf + pos, offset - pos);
+        if (run) { pos += run; chars += run; continue; }
+        size_t w = char_width(x, pos);
+        if (pos + w > offset) break;           /* offset はこの文字の trail */
+        pos += w;
+        chars++;
+    }
+    if (start) *start = pos;
+    return chars;
+}
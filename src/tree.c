@@ -0,0 +1,834 @@
+/*----------------------------------------------------------------------
+ *  src/tree.c  —  iconv_alt_convert_tree (ディレクトリ木の一括変換)
+ *
+ *  小さなファイルが大量にあると、変換より open / read / write / close の
+ *  システムコールの方が重い。Linux では io_uring (liburing は使わず生の
+ *  システムコール) で I/O をまとめて投げる:
+ *      I/O スレッド (呼び出し元):
+ *          openat → read … → close → [変換] → openat(tmp) → write … → close → rename
+ *      変換: iconv_alt_thread_pool の BUFFER ジョブ。完了は eventfd で
+ *            I/O スレッドへ知らせる (eventfd の POLL_ADD も ring に積む)
+ *  同時に扱うファイルは queue_depth 個。スロットごとの入出力バッファは
+ *  使い回す (大きなファイルのときだけ伸ばす)。cd は全ファイルで 1 つを共有する。
+ *
+ *  io_uring が無い・使えない環境では、スレッドごとに read → 変換 → write を
+ *  回す代替経路になる。どちらも一時ファイルへ書いてから rename するので、
+ *  出力先に書きかけのファイルは残らない。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include "compat_thread.h"
+#include <errno.h>
+#include <stdint.h>
+#include <stdio.h>          /* rename */
+#include <stdlib.h>
+#include <string.h>
+
+#if !defined(_WIN32)
+#  include <dirent.h>
+#  include <fcntl.h>
+#  include <limits.h>
+#  include <sys/stat.h>
+#  include <unistd.h>
+#  if defined(__linux__) && defined(__has_include)
+#    if __has_include(<linux/io_uring.h>)
+#      define TREE_HAVE_URING 1
+#      include <linux/io_uring.h>
+#      include <poll.h>
+#      include <sys/eventfd.h>
+#      include <sys/mman.h>
+#      include <sys/syscall.h>
+#    endif
+#  endif
+#endif
+
+#define TREE_DEPTH_DEFAULT  64
+#define TREE_BUF_INITIAL    (64 * 1024)          /* 1–50 KB のファイルが 1 回で読める */
+#define TREE_TMP_SUFFIX     ".iconv-alt.tmp"
+#ifndef PATH_MAX
+#  define PATH_MAX 4096
+#endif
+
+#if !defined(_WIN32)
+
+/*======================================================================
+ *  1.  ファイル一覧 (先に全部集めてから出力側のディレクトリを作る)
+ *====================================================================*/
+typedef struct {
+    char*   names;          /* 相対パスを NUL 区切りで詰めたもの */
+    size_t  used, cap;
+    size_t* files;          /* names 内の開始位置 */
+    size_t  nfiles, files_cap;
+    size_t* dirs;           /* 親が先に並ぶ (前順) */
+    size_t  ndirs, dirs_cap;
+} tree_list;
+
+static int push_index(size_t** a, size_t* n, size_t* cap, size_t v)
+{
+    if (*n == *cap) {
+        size_t c = *cap ? *cap * 2 : 256;
+        size_t* p = (size_t*)realloc(*a, c * sizeof(size_t));
+        if (!p) { errno = ENOMEM; return -1; }
+        *a = p; *cap = c;
+    }
+    (*a)[(*n)++] = v;
+    return 0;
+}
+
+static int push_name(tree_list* l, const char* rel, size_t len, size_t* at)
+{
+    if (l->used + len + 1 > l->cap) {
+        size_t c = l->cap ? l->cap : 4096;
+        while (c < l->used + len + 1) c *= 2;
+        char* p = (char*)realloc(l->names, c);
+        if (!p) { errno = ENOMEM; return -1; }
+        l->names = p; l->cap = c;
+    }
+    *at = l->used;
+    memcpy(l->names + l->used, rel, len + 1);
+    l->used += len + 1;
+    return 0;
+}
+
+static void list_free(tree_list* l)
+{
+    free(l->names); free(l->files); free(l->dirs);
+}
+
+/* dst = a + "/" + b + suffix (b が空なら a + suffix) */
+static int join_path(char* dst, const char* a, const char* b, const char* suffix)
+{
+    size_t la = strlen(a), lb = strlen(b), ls = strlen(suffix);
+    if (la + 1 + lb + ls + 1 > PATH_MAX) { errno = ENAMETOOLONG; return -1; }
+    memcpy(dst, a, la);
+    if (lb) { dst[la++] = '/'; memcpy(dst + la, b, lb); la += lb; }
+    memcpy(dst + la, suffix, ls + 1);
+    return 0;
+}
+
+static int has_tmp_suffix(const char* name, size_t len)
+{
+    size_t ls = sizeof(TREE_TMP_SUFFIX) - 1;
+    return len >= ls && memcmp(name + len - ls, TREE_TMP_SUFFIX, ls) == 0;
+}
+
+/* rel (root からの相対パス、長さ rel_len) の下を前順にたどる。
+   シンボリックリンクは辿らず、通常ファイルとディレクトリだけを拾う */
+static int walk(tree_list* l, const char* root, char* rel, size_t rel_len)
+{
+    char path[PATH_MAX];
+    if (join_path(path, root, rel, "") < 0) return -1;
+    DIR* d = opendir(path);
+    if (!d) return -1;
+
+    struct dirent* e;
+    int rc = 0;
+    while (rc == 0 && (errno = 0, e = readdir(d)) != NULL) {
+        const char* name = e->d_name;
+        if (name[0] == '.' && (name[1] == '\0' || (name[1] == '.' && name[2] == '\0'))) continue;
+        size_t nl = strlen(name);
+        if (has_tmp_suffix(name, nl)) continue;            /* 中断した実行の残り */
+        if (rel_len + nl + 2 > PATH_MAX) { errno = ENAMETOOLONG; rc = -1; break; }
+
+        size_t len = rel_len;
+        if (len) rel[len++] = '/';
+        memcpy(rel + len, name, nl + 1);
+        len += nl;
+
+        struct stat sb;
+        size_t at = 0;
+        if (fstatat(dirfd(d), name, &sb, AT_SYMLINK_NOFOLLOW) < 0) rc = -1;
+        else if (S_ISDIR(sb.st_mode))
+            rc = (push_name(l, rel, len, &at) < 0 || push_index(&l->dirs, &l->ndirs, &l->dirs_cap, at) < 0
+                  || walk(l, root, rel, len) < 0) ? -1 : 0;
+        else if (S_ISREG(sb.st_mode))
+            rc = (push_name(l, rel, len, &at) < 0
+                  || push_index(&l->files, &l->nfiles, &l->files_cap, at) < 0) ? -1 : 0;
+        rel[rel_len] = '\0';
+    }
+    if (rc == 0 && errno != 0) rc = -1;                    /* readdir の失敗 */
+    int err = errno;
+    closedir(d);
+    errno = err;
+    return rc;
+}
+
+static int make_dirs(const tree_list* l, const char* out_dir)
+{
+    char path[PATH_MAX];
+    if (mkdir(out_dir, 0777) < 0 && errno != EEXIST) return -1;
+    for (size_t i = 0; i < l->ndirs; ++i) {
+        if (join_path(path, out_dir, l->names + l->dirs[i], "") < 0) return -1;
+        if (mkdir(path, 0777) < 0 && errno != EEXIST) return -1;
+    }
+    return 0;
+}
+
+/*======================================================================
+ *  2.  実行の共有状態 / 結果の記録
+ *====================================================================*/
+typedef struct {
+    iconv_t                 cd;
+    const char*             in_dir;
+    const char*             out_dir;
+    const tree_list*        list;
+    iconv_alt_tree_options* opt;
+    compat_mutex            mu;          /* 以下と on_error を直列化 */
+    size_t                  done, failed;
+    unsigned long long      in_total, out_total;
+    int                     first_err;
+} tree_run;
+
+static int file_paths(const tree_run* r, size_t file, char* in, char* out, char* tmp)
+{
+    const char* rel = r->list->names + r->list->files[file];
+    if (join_path(in, r->in_dir, rel, "") < 0) return -1;
+    if (join_path(out, r->out_dir, rel, "") < 0) return -1;
+    return join_path(tmp, r->out_dir, rel, TREE_TMP_SUFFIX);
+}
+
+static void record_ok(tree_run* r, size_t in_len, size_t out_len)
+{
+    compat_mutex_lock(&r->mu);
+    r->done++;
+    r->in_total += in_len;
+    r->out_total += out_len;
+    compat_mutex_unlock(&r->mu);
+}
+
+static void record_failure(tree_run* r, const char* path, int err, size_t offset)
+{
+    compat_mutex_lock(&r->mu);
+    r->failed++;
+    if (!r->first_err) r->first_err = err;
+    if (r->opt && r->opt->on_error) r->opt->on_error(path, err, offset, r->opt->user);
+    compat_mutex_unlock(&r->mu);
+}
+
+/* 変換先に必要な大きさ (0 バイトのファイルでも malloc できるよう +1) */
+static size_t out_room(const tree_run* r, size_t in_len)
+{
+    return conv_max_output((const iconv_ctx*)r->cd, in_len) + 1;
+}
+
+static int grow(char** buf, size_t* cap, size_t need)
+{
+    if (*cap >= need) return 0;
+    size_t c = *cap ? *cap : TREE_BUF_INITIAL;
+    while (c < need) c *= 2;
+    char* p = (char*)realloc(*buf, c);
+    if (!p) { errno = ENOMEM; return -1; }
+    *buf = p; *cap = c;
+    return 0;
+}
+
+/*======================================================================
+ *  3.  代替経路: スレッドごとに read → 変換 → write → rename
+ *====================================================================*/
+typedef struct {
+    tree_run*         r;
+    volatile uint32_t next;              /* 次に取るファイル番号 + 1 */
+} tree_fallback;
+
+static int write_all(int fd, const char* p, size_t n)
+{
+    while (n > 0) {
+        ssize_t w = write(fd, p, n);
+        if (w < 0 && errno == EINTR) continue;
+        if (w <= 0) { if (w == 0) errno = EIO; return -1; }
+        p += w; n -= (size_t)w;
+    }
+    return 0;
+}
+
+static void fallback_worker(void* arg)
+{
+    tree_fallback* f = (tree_fallback*)arg;
+    tree_run* r = f->r;
+    char in_path[PATH_MAX], out_path[PATH_MAX], tmp_path[PATH_MAX];
+    char* in = NULL; char* out = NULL;
+    size_t in_cap = 0, out_cap = 0;
+
+    for (;;) {
+        size_t i = compat_add_sc_u32(&f->next, 1) - 1;
+        if (i >= r->list->nfiles) break;
+        if (file_paths(r, i, in_path, out_path, tmp_path) < 0) {
+            record_failure(r, r->list->names + r->list->files[i], errno, 0);
+            continue;
+        }
+
+        /* --- 読む --- */
+        int fd = open(in_path, O_RDONLY | O_CLOEXEC);
+        size_t len = 0, stop = 0;
+        int err = 0;
+        if (fd < 0) { record_failure(r, in_path, errno, 0); continue; }
+        for (;;) {
+            if (len == in_cap && grow(&in, &in_cap, len + 1) < 0) { err = errno; break; }
+            ssize_t n = read(fd, in + len, in_cap - len);
+            if (n < 0 && errno == EINTR) continue;
+            if (n < 0) { err = errno; break; }
+            if (n == 0) break;
+            len += (size_t)n;
+        }
+        close(fd);
+        if (err) { record_failure(r, in_path, err, 0); continue; }
+
+        /* --- 変換して一時ファイルへ書き、rename で置き換える --- */
+        if (grow(&out, &out_cap, out_room(r, len)) < 0) { record_failure(r, in_path, errno, 0); continue; }
+        size_t w = iconv_alt_convert(r->cd, in, len, out, out_cap, &stop);
+        if (w == (size_t)-1) { record_failure(r, in_path, errno, stop); continue; }
+        fd = open(tmp_path, O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC, 0666);
+        if (fd < 0) { record_failure(r, in_path, errno, 0); continue; }
+        if (write_all(fd, out, w) < 0) err = errno;
+        if (close(fd) < 0 && !err) err = errno;
+        if (!err && rename(tmp_path, out_path) < 0) err = errno;
+        if (err) { unlink(tmp_path); record_failure(r, in_path, err, 0); continue; }
+        record_ok(r, len, w);
+    }
+    free(in);
+    free(out);
+}
+
+static int run_fallback(tree_run* r, unsigned threads)
+{
+    tree_fallback f;
+    f.r = r;
+    f.next = 0;
+    if (threads > r->list->nfiles) threads = r->list->nfiles ? (unsigned)r->list->nfiles : 1u;
+    compat_thread* th = (compat_thread*)calloc(threads, sizeof(compat_thread));
+    if (!th) { errno = ENOMEM; return -1; }
+    unsigned started = 0;
+    for (; started + 1 < threads; ++started)            /* 呼び出し元も 1 本として働く */
+        if (compat_thread_create(&th[started], fallback_worker, &f) < 0) break;
+    fallback_worker(&f);
+    for (unsigned i = 0; i < started; ++i) compat_thread_join(th[i]);
+    free(th);
+    return 0;
+}
+
+/*======================================================================
+ *  4.  io_uring 経路
+ *====================================================================*/
+#if defined(TREE_HAVE_URING)
+
+typedef struct {
+    int                  fd;
+    unsigned*            sq_head;
+    unsigned*            sq_tail;
+    unsigned*            sq_mask;
+    unsigned*            sq_array;
+    unsigned             sq_entries;
+    struct io_uring_sqe* sqes;
+    unsigned*            cq_head;
+    unsigned*            cq_tail;
+    unsigned*            cq_mask;
+    struct io_uring_cqe* cqes;
+    void*                sq_map;
+    size_t               sq_map_len;
+    void*                cq_map;
+    size_t               cq_map_len;
+    size_t               sqes_len;
+    unsigned             to_submit;     /* 積んだがまだ enter していない数 */
+    int                  has_rename;    /* IORING_OP_RENAMEAT (5.11+) */
+} uring;
+
+static int uring_enter(uring* u, unsigned wait)
+{
+    for (;;) {
+        long r = syscall(__NR_io_uring_enter, u->fd, u->to_submit, wait,
+            wait ? IORING_ENTER_GETEVENTS : 0, NULL, 0);
+        if (r >= 0) { u->to_submit -= (unsigned)r; return 0; }
+        if (errno != EINTR) return -1;
+    }
+}
+
+static void uring_exit(uring* u)
+{
+    if (u->sqes) munmap(u->sqes, u->sqes_len);
+    if (u->cq_map && u->cq_map != u->sq_map) munmap(u->cq_map, u->cq_map_len);
+    if (u->sq_map) munmap(u->sq_map, u->sq_map_len);
+    if (u->fd >= 0) close(u->fd);
+}
+
+static int op_supported(const struct io_uring_probe* p, unsigned op)
+{
+    return op < p->ops_len && (p->ops[op].flags & IO_URING_OP_SUPPORTED);
+}
+
+/* Return: 0 / -1 (io_uring が無い、必要な命令が無いなど → 代替経路へ) */
+static int uring_init(uring* u, unsigned entries)
+{
+    struct io_uring_params p;
+    memset(u, 0, sizeof(*u));
+    memset(&p, 0, sizeof(p));
+    u->fd = (int)syscall(__NR_io_uring_setup, entries, &p);
+    if (u->fd < 0) return -1;
+
+    u->sq_map_len = p.sq_off.array + p.sq_entries * sizeof(unsigned);
+    u->cq_map_len = p.cq_off.cqes + p.cq_entries * sizeof(struct io_uring_cqe);
+    if (p.features & IORING_FEAT_SINGLE_MMAP) {
+        if (u->cq_map_len > u->sq_map_len) u->sq_map_len = u->cq_map_len;
+        u->cq_map_len = u->sq_map_len;
+    }
+    u->sq_map = mmap(NULL, u->sq_map_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+        u->fd, IORING_OFF_SQ_RING);
+    if (u->sq_map == MAP_FAILED) { u->sq_map = NULL; goto fail; }
+    if (p.features & IORING_FEAT_SINGLE_MMAP) u->cq_map = u->sq_map;
+    else {
+        u->cq_map = mmap(NULL, u->cq_map_len, PROT_READ | PROT_WRITE, MAP_SHARED | MAP_POPULATE,
+            u->fd, IORING_OFF_CQ_RING);
+        if (u->cq_map == MAP_FAILED) { u->cq_map = NULL; goto fail; }
+    }
+    u->sqes_len = p.sq_entries * sizeof(struct io_uring_sqe);
+    u->sqes = (struct io_uring_sqe*)mmap(NULL, u->sqes_len, PROT_READ | PROT_WRITE,
+        MAP_SHARED | MAP_POPULATE, u->fd, IORING_OFF_SQES);
+    if (u->sqes == MAP_FAILED) { u->sqes = NULL; goto fail; }
+
+    char* sq = (char*)u->sq_map;
+    char* cq = (char*)u->cq_map;
+    u->sq_head = (unsigned*)(sq + p.sq_off.head);
+    u->sq_tail = (unsigned*)(sq + p.sq_off.tail);
+    u->sq_mask = (unsigned*)(sq + p.sq_off.ring_mask);
+    u->sq_array = (unsigned*)(sq + p.sq_off.array);
+    u->sq_entries = p.sq_entries;
+    u->cq_head = (unsigned*)(cq + p.cq_off.head);
+    u->cq_tail = (unsigned*)(cq + p.cq_off.tail);
+    u->cq_mask = (unsigned*)(cq + p.cq_off.ring_mask);
+    u->cqes = (struct io_uring_cqe*)(cq + p.cq_off.cqes);
+
+    /* 使う命令が揃っているか (openat / close は 5.6+) */
+    size_t plen = sizeof(struct io_uring_probe) + 256 * sizeof(struct io_uring_probe_op);
+    struct io_uring_probe* pr = (struct io_uring_probe*)calloc(1, plen);
+    if (!pr) goto fail;
+    int ok = syscall(__NR_io_uring_register, u->fd, IORING_REGISTER_PROBE, pr, 256) == 0
+        && op_supported(pr, IORING_OP_OPENAT) && op_supported(pr, IORING_OP_READ)
+        && op_supported(pr, IORING_OP_WRITE) && op_supported(pr, IORING_OP_CLOSE)
+        && op_supported(pr, IORING_OP_POLL_ADD) && op_supported(pr, IORING_OP_ASYNC_CANCEL);
+    u->has_rename = ok && op_supported(pr, IORING_OP_RENAMEAT);
+    free(pr);
+    if (ok) return 0;
+fail:
+    uring_exit(u);
+    return -1;
+}
+
+/* 空きが無ければ先に enter して kernel に取らせる (in-flight は常に sq_entries 未満) */
+static struct io_uring_sqe* uring_sqe(uring* u)
+{
+    unsigned tail = *u->sq_tail;
+    if (tail - compat_load_acq_u32(u->sq_head) >= u->sq_entries) {
+        if (uring_enter(u, 0) < 0) return NULL;
+        if (tail - compat_load_acq_u32(u->sq_head) >= u->sq_entries) { errno = EBUSY; return NULL; }
+    }
+    unsigned idx = tail & *u->sq_mask;
+    struct io_uring_sqe* s = &u->sqes[idx];
+    memset(s, 0, sizeof(*s));
+    u->sq_array[idx] = idx;
+    compat_store_rel_u32(u->sq_tail, tail + 1);
+    u->to_submit++;
+    return s;
+}
+
+/*--- ファイル 1 個分の状態 ------------------------------------------*/
+enum {
+    ST_IDLE, ST_OPEN_IN, ST_READ, ST_CLOSE_IN, ST_CONVERT,
+    ST_OPEN_OUT, ST_WRITE, ST_CLOSE_OUT, ST_RENAME
+};
+
+typedef struct tree_slot {
+    struct tree_uring* t;
+    int                state;
+    int                fd;
+    int                tmp_made;       /* 一時ファイルを作った (失敗時に消す) */
+    char*              in;
+    size_t             in_cap, in_len;
+    char*              out;
+    size_t             out_cap, out_len, out_done;
+    int                err;            /* 変換結果 (ワーカーが書く) */
+    size_t             stop;
+    struct tree_slot*  next;           /* 変換済みキュー (mu) */
+    char               in_path[PATH_MAX];
+    char               out_path[PATH_MAX];
+    char               tmp_path[PATH_MAX];
+} tree_slot;
+
+typedef struct tree_uring {
+    tree_run*              r;
+    uring                  u;
+    iconv_alt_thread_pool* pool;
+    int                    efd;          /* 変換完了の通知 */
+    compat_mutex           mu;
+    tree_slot*             converted;    /* (mu) */
+    size_t                 next_file;
+    size_t                 busy;         /* ST_IDLE でないスロット数 */
+    size_t                 inflight;     /* 積んだがまだ CQE を受け取っていない sqe の数 */
+    int                    fatal;        /* ring が使えなくなった errno */
+} tree_uring;
+
+/* Return: 積んだ sqe (命令ごとの追加欄は呼び出し側が埋める) / NULL (t->fatal) */
+static struct io_uring_sqe* submit_op(tree_uring* t, tree_slot* s, unsigned op, int fd,
+    const void* addr, unsigned len, unsigned long long off)
+{
+    struct io_uring_sqe* q = uring_sqe(&t->u);
+    if (!q) { t->fatal = errno; return NULL; }
+    q->opcode = (uint8_t)op;
+    q->fd = fd;
+    q->addr = (uintptr_t)addr;
+    q->len = len;
+    q->off = off;
+    q->user_data = (uintptr_t)s;
+    t->inflight++;
+    return q;
+}
+
+static void arm_eventfd(tree_uring* t)
+{
+    struct io_uring_sqe* q = submit_op(t, NULL, IORING_OP_POLL_ADD, t->efd, NULL, 0, 0);
+    if (q) q->poll32_events = POLLIN;
+}
+
+static void read_more(tree_uring* t, tree_slot* s)
+{
+    if (s->in_len == s->in_cap && grow(&s->in, &s->in_cap, s->in_len + 1) < 0) {
+        t->fatal = errno;
+        return;
+    }
+    size_t n = s->in_cap - s->in_len;
+    if (n > 0x40000000u) n = 0x40000000u;
+    s->state = ST_READ;
+    submit_op(t, s, IORING_OP_READ, s->fd, s->in + s->in_len, (unsigned)n, s->in_len);
+}
+
+static void write_more(tree_uring* t, tree_slot* s)
+{
+    size_t n = s->out_len - s->out_done;
+    if (n > 0x40000000u) n = 0x40000000u;
+    s->state = ST_WRITE;
+    submit_op(t, s, IORING_OP_WRITE, s->fd, s->out + s->out_done, (unsigned)n, s->out_done);
+}
+
+static void start_next(tree_uring* t, tree_slot* s)
+{
+    for (;;) {
+        if (t->next_file >= t->r->list->nfiles) { s->state = ST_IDLE; t->busy--; return; }
+        size_t file = t->next_file++;
+        s->fd = -1;
+        s->tmp_made = 0;
+        s->in_len = s->out_len = s->out_done = 0;
+        if (file_paths(t->r, file, s->in_path, s->out_path, s->tmp_path) < 0) {
+            record_failure(t->r, t->r->list->names + t->r->list->files[file], errno, 0);
+            continue;
+        }
+        s->state = ST_OPEN_IN;
+        struct io_uring_sqe* q = submit_op(t, s, IORING_OP_OPENAT, AT_FDCWD, s->in_path, 0, 0);
+        if (q) q->open_flags = O_RDONLY | O_CLOEXEC;
+        return;
+    }
+}
+
+static void slot_failed(tree_uring* t, tree_slot* s, int err, size_t offset)
+{
+    if (s->fd >= 0) { close(s->fd); s->fd = -1; }
+    if (s->tmp_made) unlink(s->tmp_path);
+    record_failure(t->r, s->in_path, err, offset);
+    start_next(t, s);
+}
+
+static void slot_done(tree_uring* t, tree_slot* s)
+{
+    record_ok(t->r, s->in_len, s->out_len);
+    start_next(t, s);
+}
+
+/* ワーカースレッド上: 結果を控えて I/O スレッドへ返す */
+static void on_converted(iconv_alt_job* job, void* user)
+{
+    tree_slot* s = (tree_slot*)user;
+    tree_uring* t = s->t;
+    size_t written = 0, stop = 0;
+    s->err = iconv_alt_job_result(job, &written, &stop, NULL);
+    s->out_len = written;
+    s->stop = stop;
+    iconv_alt_job_release(job);
+
+    compat_mutex_lock(&t->mu);
+    s->next = t->converted;
+    t->converted = s;
+    compat_mutex_unlock(&t->mu);
+    uint64_t one = 1;
+    while (write(t->efd, &one, sizeof(one)) < 0 && errno == EINTR) {}
+}
+
+static void start_convert(tree_uring* t, tree_slot* s)
+{
+    if (grow(&s->out, &s->out_cap, out_room(t->r, s->in_len)) < 0) { slot_failed(t, s, errno, 0); return; }
+    iconv_alt_job_desc d;
+    memset(&d, 0, sizeof(d));
+    d.kind = ICONV_ALT_JOB_BUFFER;
+    d.cd = t->r->cd;
+    d.in = s->in;
+    d.inlen = s->in_len;
+    d.out = s->out;
+    d.outlen = s->out_cap;
+    d.callback = on_converted;
+    d.user = s;
+    s->state = ST_CONVERT;
+    if (!iconv_alt_thread_pool_submit(t->pool, &d)) slot_failed(t, s, errno, 0);
+}
+
+static void start_output(tree_uring* t, tree_slot* s)
+{
+    if (s->err) { slot_failed(t, s, s->err, s->stop); return; }
+    s->state = ST_OPEN_OUT;
+    struct io_uring_sqe* q = submit_op(t, s, IORING_OP_OPENAT, AT_FDCWD, s->tmp_path, 0666, 0);
+    if (q) q->open_flags = O_WRONLY | O_CREAT | O_TRUNC | O_CLOEXEC;
+}
+
+static void finish_output(tree_uring* t, tree_slot* s)
+{
+    if (!t->u.has_rename) {                         /* 古いカーネル: rename だけ同期で */
+        if (rename(s->tmp_path, s->out_path) < 0) slot_failed(t, s, errno, 0);
+        else slot_done(t, s);
+        return;
+    }
+    s->state = ST_RENAME;
+    struct io_uring_sqe* q = submit_op(t, s, IORING_OP_RENAMEAT, AT_FDCWD, s->tmp_path,
+        (unsigned)AT_FDCWD, 0);
+    if (q) q->addr2 = (uintptr_t)s->out_path;      /* 新しい名前 (newdirfd は len) */
+}
+
+static void on_completion(tree_uring* t, tree_slot* s, int res)
+{
+    switch (s->state) {
+    case ST_OPEN_IN:
+        if (res < 0) { slot_failed(t, s, -res, 0); return; }
+        s->fd = res;
+        read_more(t, s);
+        return;
+    case ST_READ:
+        if (res < 0) { slot_failed(t, s, -res, 0); return; }
+        if (res > 0) { s->in_len += (size_t)res; read_more(t, s); return; }
+        s->state = ST_CLOSE_IN;                     /* EOF */
+        submit_op(t, s, IORING_OP_CLOSE, s->fd, NULL, 0, 0);
+        s->fd = -1;
+        return;
+    case ST_CLOSE_IN:
+        start_convert(t, s);
+        return;
+    case ST_OPEN_OUT:
+        if (res < 0) { slot_failed(t, s, -res, 0); return; }
+        s->fd = res;
+        s->tmp_made = 1;
+        if (s->out_len > 0) { write_more(t, s); return; }
+        s->state = ST_CLOSE_OUT;
+        submit_op(t, s, IORING_OP_CLOSE, s->fd, NULL, 0, 0);
+        s->fd = -1;
+        return;
+    case ST_WRITE:
+        if (res <= 0) { slot_failed(t, s, res < 0 ? -res : EIO, 0); return; }
+        s->out_done += (size_t)res;
+        if (s->out_done < s->out_len) { write_more(t, s); return; }
+        s->state = ST_CLOSE_OUT;
+        submit_op(t, s, IORING_OP_CLOSE, s->fd, NULL, 0, 0);
+        s->fd = -1;
+        return;
+    case ST_CLOSE_OUT:
+        if (res < 0) { slot_failed(t, s, -res, 0); return; }
+        finish_output(t, s);
+        return;
+    case ST_RENAME:
+        if (res < 0) { slot_failed(t, s, -res, 0); return; }
+        slot_done(t, s);
+        return;
+    default:
+        return;
+    }
+}
+
+/* 取り消し命令自身の CQE の印 (スロットとも eventfd の NULL とも重ならない) */
+static char cancel_tag;
+
+/* fatal の後: 残っている I/O を取り消して CQE を全部受け取る。これが済むまで
+   バッファもパスもカーネルが触り得るので解放できない。
+   Return: 0 / -1 (受け取りきれなかった) */
+static int drain_uring(tree_uring* t, tree_slot* slots, unsigned depth)
+{
+    for (unsigned i = 0; i <= depth; ++i) {
+        tree_slot* s = i < depth ? &slots[i] : NULL;   /* 最後は eventfd の POLL_ADD */
+        if (s && (s->state == ST_IDLE || s->state == ST_CONVERT)) continue;
+        struct io_uring_sqe* q = submit_op(t, (tree_slot*)(void*)&cancel_tag,
+            IORING_OP_ASYNC_CANCEL, -1, s, 0, 0);
+        if (!q) return -1;
+    }
+    while (t->inflight > 0) {
+        if (uring_enter(&t->u, 1) < 0) return -1;
+        unsigned head = *t->u.cq_head;
+        unsigned tail = compat_load_acq_u32(t->u.cq_tail);
+        for (; head != tail; ++head) {
+            struct io_uring_cqe* c = &t->u.cqes[head & *t->u.cq_mask];
+            tree_slot* s = (tree_slot*)(uintptr_t)c->user_data;
+            int res = c->res;
+            compat_store_rel_u32(t->u.cq_head, head + 1);
+            t->inflight--;
+            if (!s || s == (tree_slot*)(void*)&cancel_tag || res < 0) continue;
+            /* 取り消しが間に合わず開けてしまったものは後で閉じる・消す */
+            if (s->state == ST_OPEN_IN) s->fd = res;
+            else if (s->state == ST_OPEN_OUT) { s->fd = res; s->tmp_made = 1; }
+        }
+    }
+    return 0;
+}
+
+/* Return: 0 / -1 (io_uring を使えなかった。何も処理していない) */
+static int run_uring(tree_run* r, unsigned threads, unsigned depth)
+{
+    tree_uring t;
+    memset(&t, 0, sizeof(t));
+    t.r = r;
+    if (depth > r->list->nfiles) depth = r->list->nfiles ? (unsigned)r->list->nfiles : 1u;
+    if (uring_init(&t.u, depth * 2 + 2) < 0) return -1;
+    t.efd = eventfd(0, EFD_CLOEXEC);
+    tree_slot* slots = (tree_slot*)calloc(depth, sizeof(tree_slot));
+    t.pool = (t.efd >= 0 && slots) ? iconv_alt_thread_pool_create(threads) : NULL;
+    if (!t.pool) {
+        free(slots);
+        if (t.efd >= 0) close(t.efd);
+        uring_exit(&t.u);
+        return -1;
+    }
+    compat_mutex_init(&t.mu);
+
+    arm_eventfd(&t);
+    t.busy = depth;
+    for (unsigned i = 0; i < depth; ++i) {
+        slots[i].t = &t;
+        slots[i].fd = -1;
+        start_next(&t, &slots[i]);
+    }
+
+    while (t.busy > 0 && !t.fatal) {
+        /* 変換の終わったスロットを書き出しへ */
+        compat_mutex_lock(&t.mu);
+        tree_slot* s = t.converted;
+        t.converted = NULL;
+        compat_mutex_unlock(&t.mu);
+        while (s) {
+            tree_slot* next = s->next;
+            start_output(&t, s);
+            s = next;
+        }
+        if (t.busy == 0 || t.fatal) break;
+
+        if (uring_enter(&t.u, 1) < 0) { t.fatal = errno; break; }
+        unsigned head = *t.u.cq_head;
+        unsigned tail = compat_load_acq_u32(t.u.cq_tail);
+        for (; head != tail && !t.fatal; ++head) {
+            struct io_uring_cqe* c = &t.u.cqes[head & *t.u.cq_mask];
+            tree_slot* slot = (tree_slot*)(uintptr_t)c->user_data;
+            int res = c->res;
+            compat_store_rel_u32(t.u.cq_head, head + 1);   /* 先に返して CQ を空ける */
+            t.inflight--;
+            if (slot) { on_completion(&t, slot, res); continue; }
+            uint64_t v;
+            while (read(t.efd, &v, sizeof(v)) < 0 && errno == EINTR) {}
+            arm_eventfd(&t);
+        }
+    }
+
+    iconv_alt_thread_pool_destroy(t.pool);              /* 変換中のジョブを待つ */
+    int fatal = t.fatal;
+    if (fatal && drain_uring(&t, slots, depth) < 0) {
+        /* 受け取りきれなかった I/O がバッファへ書き込み得るので、
+           スロットは解放せずに残す (一時ファイルだけ消す) */
+        for (unsigned i = 0; i < depth; ++i)
+            if (slots[i].state != ST_IDLE && slots[i].tmp_made) unlink(slots[i].tmp_path);
+        uring_exit(&t.u);
+        close(t.efd);
+        compat_mutex_destroy(&t.mu);
+        errno = fatal;
+        return -2;
+    }
+    uring_exit(&t.u);                                   /* もう in-flight の I/O は無い */
+    close(t.efd);
+    for (unsigned i = 0; fatal && i < depth; ++i) {
+        if (slots[i].state == ST_IDLE) continue;
+        if (slots[i].fd >= 0) close(slots[i].fd);
+        if (slots[i].tmp_made) unlink(slots[i].tmp_path);
+    }
+    for (unsigned i = 0; i < depth; ++i) { free(slots[i].in); free(slots[i].out); }
+    free(slots);
+    compat_mutex_destroy(&t.mu);
+    if (fatal) { errno = fatal; return -2; }
+    return 0;
+}
+
+#endif /* TREE_HAVE_URING */
+
+/*======================================================================
+ *  5.  公開 API
+ *====================================================================*/
+int iconv_alt_convert_tree(iconv_t cd, const char* in_dir, const char* out_dir,
+    iconv_alt_tree_options* options)
+{
+    if (!cd || cd == (iconv_t)-1 || !in_dir || !out_dir) { errno = EINVAL; return -1; }
+    unsigned threads = options ? options->threads : 0;
+    unsigned depth = options && options->queue_depth ? options->queue_depth : TREE_DEPTH_DEFAULT;
+    unsigned flags = options ? options->flags : 0;
+    if (threads == 0) threads = compat_cpu_count();
+
+    tree_list list;
+    memset(&list, 0, sizeof(list));
+    char rel[PATH_MAX] = "";
+    if (walk(&list, in_dir, rel, 0) < 0 || make_dirs(&list, out_dir) < 0) {
+        int err = errno;
+        list_free(&list);
+        errno = err;
+        return -1;
+    }
+
+    tree_run r;
+    memset(&r, 0, sizeof(r));
+    r.cd = cd;
+    r.in_dir = in_dir;
+    r.out_dir = out_dir;
+    r.list = &list;
+    r.opt = options;
+    compat_mutex_init(&r.mu);
+
+    int rc = -1, used_uring = 0;
+#if defined(TREE_HAVE_URING)
+    if (!(flags & ICONV_ALT_TREE_NO_URING) && list.nfiles > 0) {
+        rc = run_uring(&r, threads, depth);
+        used_uring = (rc != -1);
+    }
+#else
+    (void)depth; (void)flags;
+#endif
+    if (rc == -1) rc = run_fallback(&r, threads);
+    int err = errno;
+
+    if (options) {
+        options->files = r.done + r.failed;
+        options->failed = r.failed;
+        options->in_total = r.in_total;
+        options->out_total = r.out_total;
+        options->used_uring = used_uring;
+    }
+    compat_mutex_destroy(&r.mu);
+    list_free(&list);
+    if (rc < 0) { errno = err; return -1; }
+    if (r.first_err) { errno = r.first_err; return -1; }
+    return 0;
+}
+
+#else  /* _WIN32 */
+
+int iconv_alt_convert_tree(iconv_t cd, const char* in_dir, const char* out_dir,
+    iconv_alt_tree_options* options)
+{
+    (void)cd; (void)in_dir; (void)out_dir; (void)options;
+    errno = ENOSYS;
+    return -1;
+}
+
+#endif
@@ -0,0 +1,354 @@
+/*----------------------------------------------------------------------
+ *  src/unicode.c  —  UTF-8 ⇆ UTF-16 / UTF-32 の核 (pair_kernel)
+ *
+ *  16 byte ずつ「同じ長さの文字だけが並んでいるか」を SSE2 で調べ、
+ *  そうならその長さ専用のレーンで一気に変換する:
+ *      UTF-8 → UTF-16/32 : ASCII 16 文字 / 2 byte 8 文字 / 3 byte 5 文字 /
+ *                          4 byte 4 文字 (UTF-16 ではサロゲート対)
+ *      UTF-16/32 → UTF-8 : 同じ 4 種を 8 単位 (4 byte 文字は 4 つ) ずつ
+ *  レーンに合わない所は核の中で 1 文字だけ処理して次の 16 byte を試す。
+ *  不正・途中・出力不足の文字では核を抜け、pivot_iconv() の 1 文字ずつの
+ *  経路に errno と位置を決めさせる (判定は utf8_decode などと同じ)。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include <stddef.h>
+#include <stdint.h>
+#include <string.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define UNI_USE_SSE2 1
+#endif
+
+/*======================================================================
+ *  1.  コード単位の読み書き (w = 2 / 4 byte、be = ビッグエンディアン)
+ *====================================================================*/
+static inline uint32_t unit_get(const unsigned char* p, int w, int be)
+{
+    if (w == 2)
+        return be ? ((uint32_t)p[0] << 8 | p[1]) : ((uint32_t)p[1] << 8 | p[0]);
+    return be ? ((uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3])
+              : ((uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 | (uint32_t)p[1] << 8 | p[0]);
+}
+
+static inline void unit_put(unsigned char* q, uint32_t u, int w, int be)
+{
+    for (int k = 0; k < w; ++k)
+        q[be ? w - 1 - k : k] = (unsigned char)(u >> (8 * k));
+}
+
+#if defined(UNI_USE_SSE2)
+static inline __m128i bswap16(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+
+static inline __m128i bswap32(__m128i v)
+{
+    v = bswap16(v);
+    return _mm_shufflehi_epi16(_mm_shufflelo_epi16(v, 0xB1), 0xB1);
+}
+
+/* 16 bit 値 8 つを w byte 単位で書く */
+static inline void store8(unsigned char* q, __m128i u, int w, int be)
+{
+    if (w == 2) {
+        _mm_storeu_si128((__m128i*)q, be ? bswap16(u) : u);
+        return;
+    }
+    const __m128i zero = _mm_setzero_si128();
+    __m128i a = _mm_unpacklo_epi16(u, zero), b = _mm_unpackhi_epi16(u, zero);
+    if (be) { a = bswap32(a); b = bswap32(b); }
+    _mm_storeu_si128((__m128i*)q, a);
+    _mm_storeu_si128((__m128i*)(q + 16), b);
+}
+
+/* 3 byte 列の 16 bit 値: 各 16 bit レーンの下位 byte に lead / 続き 2 つ */
+static inline __m128i utf8_3byte(__m128i a, __m128i b, __m128i c)
+{
+    __m128i hi = _mm_slli_epi16(_mm_and_si128(a, _mm_set1_epi16(0x0F)), 12);
+    __m128i mid = _mm_slli_epi16(_mm_and_si128(b, _mm_set1_epi16(0x3F)), 6);
+    return _mm_or_si128(_mm_or_si128(hi, mid), _mm_and_si128(c, _mm_set1_epi16(0x3F)));
+}
+
+/* コード点 (32 bit レーン、U+10000 以上) を 4 byte の UTF-8 に */
+static inline __m128i utf8_4byte(__m128i cp)
+{
+    const __m128i m = _mm_set1_epi32(0x3F);
+    __m128i b0 = _mm_or_si128(_mm_srli_epi32(cp, 18), _mm_set1_epi32(0xF0));
+    __m128i b1 = _mm_and_si128(_mm_srli_epi32(cp, 12), m);
+    __m128i b2 = _mm_and_si128(_mm_srli_epi32(cp, 6), m);
+    __m128i b3 = _mm_and_si128(cp, m);
+    __m128i t = _mm_or_si128(_mm_slli_epi32(b1, 8), _mm_or_si128(_mm_slli_epi32(b2, 16),
+                                                                 _mm_slli_epi32(b3, 24)));
+    return _mm_or_si128(_mm_or_si128(b0, t), _mm_set1_epi32((int)0x80808000));
+}
+#endif
+
+/*======================================================================
+ *  2.  UTF-8 → UTF-16 / UTF-32
+ *====================================================================*/
+static inline void utf8_to_wide(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend, int w, int be)
+{
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        unsigned b = *p;
+#if defined(UNI_USE_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        if (b < 0x80) {                                   /* ASCII: 16 文字 */
+            while (end - p >= 16 && qend - q >= 16 * w) {
+                __m128i v = _mm_loadu_si128((const __m128i*)p);
+                if (_mm_movemask_epi8(v)) break;
+                store8(q, _mm_unpacklo_epi8(v, zero), w, be);
+                store8(q + 8 * w, _mm_unpackhi_epi8(v, zero), w, be);
+                p += 16; q += 16 * w;
+            }
+        }
+        else if (b < 0xE0) {                              /* 2 byte: 8 文字 */
+            while (end - p >= 16 && qend - q >= 8 * w) {
+                __m128i v = _mm_loadu_si128((const __m128i*)p);   /* レーン = lead | 続き << 8 */
+                __m128i form = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xC0E0)),
+                                               _mm_set1_epi16((short)0x80C0));
+                __m128i overlong = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1E)), zero);
+                if (_mm_movemask_epi8(_mm_andnot_si128(overlong, form)) != 0xFFFF) break;
+                __m128i u = _mm_or_si128(
+                    _mm_slli_epi16(_mm_and_si128(v, _mm_set1_epi16(0x1F)), 6),
+                    _mm_and_si128(_mm_srli_epi16(v, 8), _mm_set1_epi16(0x3F)));
+                store8(q, u, w, be);
+                p += 16; q += 8 * w;
+            }
+        }
+        else if (b < 0xF0) {                              /* 3 byte: 5 文字 (15 byte) */
+            while (end - p >= 16 && qend - q >= 5 * w) {
+                __m128i v = _mm_loadu_si128((const __m128i*)p);
+                int lead = _mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_and_si128(v, _mm_set1_epi8((char)0xF0)), _mm_set1_epi8((char)0xE0)));
+                int cont = _mm_movemask_epi8(_mm_cmpeq_epi8(
+                    _mm_and_si128(v, _mm_set1_epi8((char)0xC0)), _mm_set1_epi8((char)0x80)));
+                if ((lead & 0x7FFF) != 0x1249 || (cont & 0x7FFF) != 0x6DB6) break;
+                /* 偶数位置 (0, 6, 12) と奇数位置 (3, 9) の文字を 16 bit レーンで組み立てる */
+                __m128i ev = utf8_3byte(v, _mm_srli_si128(v, 1), _mm_srli_si128(v, 2));
+                __m128i od = utf8_3byte(_mm_srli_si128(v, 3), _mm_srli_si128(v, 4),
+                                        _mm_srli_si128(v, 5));
+                uint32_t u[5] = {
+                    (uint32_t)_mm_extract_epi16(ev, 0), (uint32_t)_mm_extract_epi16(od, 0),
+                    (uint32_t)_mm_extract_epi16(ev, 3), (uint32_t)_mm_extract_epi16(od, 3),
+                    (uint32_t)_mm_extract_epi16(ev, 6) };
+                unsigned bad = 0;
+                for (int k = 0; k < 5; ++k)                   /* 冗長表現 / サロゲート */
+                    bad |= (u[k] < 0x800) | ((u[k] & 0xF800) == 0xD800);
+                if (bad) break;
+                for (int k = 0; k < 5; ++k) unit_put(q + k * w, u[k], w, be);
+                p += 15; q += 5 * w;
+            }
+        }
+        else {                                            /* 4 byte: 4 文字 */
+            while (end - p >= 16 && qend - q >= 16) {
+                __m128i v = _mm_loadu_si128((const __m128i*)p);
+                __m128i form = _mm_cmpeq_epi32(_mm_and_si128(v, _mm_set1_epi32((int)0xC0C0C0F8)),
+                                               _mm_set1_epi32((int)0x808080F0));
+                const __m128i m = _mm_set1_epi32(0x3F);
+                __m128i cp = _mm_or_si128(
+                    _mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, _mm_set1_epi32(7)), 18),
+                                 _mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(v, 8), m), 12)),
+                    _mm_or_si128(_mm_slli_epi32(_mm_and_si128(_mm_srli_epi32(v, 16), m), 6),
+                                 _mm_and_si128(_mm_srli_epi32(v, 24), m)));
+                __m128i ok = _mm_and_si128(form,
+                    _mm_and_si128(_mm_cmpgt_epi32(cp, _mm_set1_epi32(0xFFFF)),
+                                  _mm_cmplt_epi32(cp, _mm_set1_epi32(0x110000))));
+                if (_mm_movemask_epi8(ok) != 0xFFFF) break;
+                if (w == 4) {
+                    _mm_storeu_si128((__m128i*)q, be ? bswap32(cp) : cp);
+                }
+                else {                                    /* サロゲート対: high | low << 16 */
+                    __m128i t = _mm_sub_epi32(cp, _mm_set1_epi32(0x10000));
+                    __m128i hi = _mm_or_si128(_mm_srli_epi32(t, 10), _mm_set1_epi32(0xD800));
+                    __m128i lo = _mm_or_si128(_mm_and_si128(t, _mm_set1_epi32(0x3FF)),
+                                              _mm_set1_epi32(0xDC00));
+                    __m128i pair = _mm_or_si128(hi, _mm_slli_epi32(lo, 16));
+                    _mm_storeu_si128((__m128i*)q, be ? bswap16(pair) : pair);
+                }
+                p += 16; q += 16;
+            }
+        }
+        if (p >= end) break;
+        b = *p;
+#endif
+        /* レーンに合わない 1 文字 */
+        uint32_t cp;
+        int r = 1;
+        if (b < 0x80) cp = b;
+        else if ((r = utf8_decode(c, p, (size_t)(end - p), &cp)) <= 0) break;
+        if (w == 2 && cp >= 0x10000) {
+            if (qend - q < 4) break;
+            cp -= 0x10000;
+            unit_put(q, 0xD800 | (cp >> 10), 2, be);
+            unit_put(q + 2, 0xDC00 | (cp & 0x3FF), 2, be);
+            q += 4;
+        }
+        else {
+            if (qend - q < w) break;
+            unit_put(q, cp, w, be);
+            q += w;
+        }
+        p += r;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+/*======================================================================
+ *  3.  UTF-16 / UTF-32 → UTF-8
+ *====================================================================*/
+static inline void wide_to_utf8(const unsigned char** pp, const unsigned char* end,
+    unsigned char** qq, unsigned char* qend, int w, int be)
+{
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (end - p >= w) {
+        uint32_t u = unit_get(p, w, be);
+#if defined(UNI_USE_SSE2)
+        const __m128i zero = _mm_setzero_si128();
+        if (u < 0x10000 && u - 0xD800u >= 0x800u) {
+            /* BMP: 8 単位を 16 bit レーンに読み、長さ別のレーンへ */
+            for (;;) {
+                if (end - p < 8 * w) break;
+                __m128i v;
+                if (w == 2) {
+                    v = _mm_loadu_si128((const __m128i*)p);
+                    if (be) v = bswap16(v);
+                }
+                else {                                    /* 32 → 16 bit (符号付き飽和を避ける) */
+                    __m128i a = _mm_loadu_si128((const __m128i*)p);
+                    __m128i b = _mm_loadu_si128((const __m128i*)(p + 16));
+                    if (be) { a = bswap32(a); b = bswap32(b); }
+                    __m128i high = _mm_and_si128(_mm_or_si128(a, b), _mm_set1_epi32((int)0xFFFF0000));
+                    if (_mm_movemask_epi8(_mm_cmpeq_epi32(high, zero)) != 0xFFFF) break;
+                    const __m128i bias = _mm_set1_epi32(0x8000);
+                    v = _mm_add_epi16(_mm_packs_epi32(_mm_sub_epi32(a, bias), _mm_sub_epi32(b, bias)),
+                                      _mm_set1_epi16((short)0x8000));
+                }
+                __m128i top = _mm_and_si128(v, _mm_set1_epi16((short)0xF800));
+                int ascii = _mm_movemask_epi8(_mm_cmpeq_epi16(
+                    _mm_and_si128(v, _mm_set1_epi16((short)0xFF80)), zero));
+                int two = _mm_movemask_epi8(_mm_cmpeq_epi16(top, zero));
+                if (ascii == 0xFFFF) {                    /* ASCII: 8 byte */
+                    if (qend - q < 8) break;
+                    _mm_storel_epi64((__m128i*)q, _mm_packus_epi16(v, v));
+                    q += 8;
+                }
+                else if (two == 0xFFFF && ascii == 0) {   /* 2 byte: 16 byte */
+                    if (qend - q < 16) break;
+                    __m128i lead = _mm_or_si128(_mm_srli_epi16(v, 6), _mm_set1_epi16(0xC0));
+                    __m128i tail = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi16(0x3F)),
+                                                _mm_set1_epi16(0x80));
+                    _mm_storeu_si128((__m128i*)q, _mm_or_si128(lead, _mm_slli_epi16(tail, 8)));
+                    q += 16;
+                }
+                else if (two == 0 && !_mm_movemask_epi8(_mm_cmpeq_epi16(
+                             top, _mm_set1_epi16((short)0xD800)))) {   /* 3 byte: 24 byte */
+                    if (qend - q < 24) break;
+                    __m128i b0 = _mm_or_si128(_mm_srli_epi16(v, 12), _mm_set1_epi16(0xE0));
+                    __m128i b1 = _mm_or_si128(_mm_and_si128(_mm_srli_epi16(v, 6), _mm_set1_epi16(0x3F)),
+                                              _mm_set1_epi16(0x80));
+                    __m128i b2 = _mm_or_si128(_mm_and_si128(v, _mm_set1_epi16(0x3F)),
+                                              _mm_set1_epi16(0x80));
+                    __m128i x = _mm_or_si128(b0, _mm_slli_epi16(b1, 8));
+                    __m128i lanes[2] = { _mm_unpacklo_epi16(x, b2), _mm_unpackhi_epi16(x, b2) };
+                    for (int k = 0; k < 8; ++k) {
+                        uint32_t t = (uint32_t)_mm_cvtsi128_si32(lanes[k >> 2]);
+                        lanes[k >> 2] = _mm_srli_si128(lanes[k >> 2], 4);
+                        memcpy(q + 3 * k, &t, 3);
+                    }
+                    q += 24;
+                }
+                else break;
+                p += 8 * w;
+            }
+        }
+        else {
+            /* U+10000 以上: 4 文字ずつ 4 byte の UTF-8 へ */
+            while (end - p >= 16 && qend - q >= 16) {
+                __m128i v = _mm_loadu_si128((const __m128i*)p);
+                __m128i cp;
+                if (w == 2) {                             /* レーン = high | low << 16 */
+                    if (be) v = bswap16(v);
+                    __m128i form = _mm_cmpeq_epi32(
+                        _mm_and_si128(v, _mm_set1_epi32((int)0xFC00FC00)),
+                        _mm_set1_epi32((int)0xDC00D800));
+                    if (_mm_movemask_epi8(form) != 0xFFFF) break;
+                    const __m128i m = _mm_set1_epi32(0x3FF);
+                    cp = _mm_add_epi32(_mm_or_si128(_mm_slli_epi32(_mm_and_si128(v, m), 10),
+                                                    _mm_and_si128(_mm_srli_epi32(v, 16), m)),
+                                       _mm_set1_epi32(0x10000));
+                }
+                else {
+                    cp = be ? bswap32(v) : v;
+                    __m128i ok = _mm_and_si128(_mm_cmpgt_epi32(cp, _mm_set1_epi32(0xFFFF)),
+                                               _mm_cmplt_epi32(cp, _mm_set1_epi32(0x110000)));
+                    if (_mm_movemask_epi8(ok) != 0xFFFF) break;
+                }
+                _mm_storeu_si128((__m128i*)q, utf8_4byte(cp));
+                p += 16; q += 16;
+            }
+        }
+        if (end - p < w) break;
+        u = unit_get(p, w, be);
+#endif
+        /* レーンに合わない 1 文字 */
+        int r = w;
+        if (u - 0xD800u < 0x800u) {
+            if (w == 4 || u >= 0xDC00 || end - p < 4) break;
+            uint32_t lo = unit_get(p + 2, 2, be);
+            if (lo - 0xDC00u >= 0x400u) break;
+            u = 0x10000 + ((u - 0xD800) << 10) + (lo - 0xDC00);
+            r = 4;
+        }
+        if (u > 0x10FFFF) break;
+        size_t len = u < 0x80 ? 1 : u < 0x800 ? 2 : u < 0x10000 ? 3 : 4;
+        if ((size_t)(qend - q) < len) break;
+        q += u32_to_utf8(u, (char*)q);
+        p += r;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+/*======================================================================
+ *  4.  組ごとの入口 (バイト順は BOM 付き形式なら BOM の後で決まる)
+ *====================================================================*/
+void utf8_to_utf16_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend)
+{
+    int order = conv_out_order(c);
+    if (order == BO_BE)      utf8_to_wide(c, p, end, q, qend, 2, 1);
+    else if (order == BO_LE) utf8_to_wide(c, p, end, q, qend, 2, 0);
+}
+
+void utf8_to_utf32_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend)
+{
+    int order = conv_out_order(c);
+    if (order == BO_BE)      utf8_to_wide(c, p, end, q, qend, 4, 1);
+    else if (order == BO_LE) utf8_to_wide(c, p, end, q, qend, 4, 0);
+}
+
+void utf16_to_utf8_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend)
+{
+    int order = conv_in_order(c);
+    if (order == BO_BE)      wide_to_utf8(p, end, q, qend, 2, 1);
+    else if (order == BO_LE) wide_to_utf8(p, end, q, qend, 2, 0);
+}
+
+void utf32_to_utf8_kernel(iconv_ctx* c, const unsigned char** p,
+    const unsigned char* end, unsigned char** q, unsigned char* qend)
+{
+    int order = conv_in_order(c);
+    if (order == BO_BE)      wide_to_utf8(p, end, q, qend, 4, 1);
+    else if (order == BO_LE) wide_to_utf8(p, end, q, qend, 4, 0);
+}
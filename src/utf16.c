@@ -0,0 +1,247 @@
+/*----------------------------------------------------------------------
+ *  src/utf16.c  —  UTF-16 / UTF-16LE / UTF-16BE と CP932 ⇆ UTF-16 の核
+ *
+ *  UTF-16LE / BE : BOM を特別扱いしない (U+FEFF はただの文字)
+ *  UTF-16        : 復号は先頭の BOM で順序を決め (無ければ BE)、
+ *                  符号化は先頭に BOM (FF FE) を付けて LE で書く
+ *  CP932 ⇆ UTF-16 は UTF-8 を経由せず、16 bit のコード単位で SJIS の
+ *  表 (SJIS_DB2U / U2SJIS) を直接引く。ASCII と半角カナの連続は
+ *  SSE2 で 16 文字ずつ広げる / 詰める (半角カナは U+FF61 - 0xA1 = 0xFEC0 の差)。
+ *  サロゲートや表に無い文字では核を抜け、pivot_iconv() の 1 文字ずつの経路に任せる。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include "sjis_table.h"
+#include <stddef.h>
+#include <stdint.h>
+
+#if defined(__SSE2__) || defined(_M_X64) || (defined(_M_IX86_FP) && _M_IX86_FP >= 2)
+#  include <emmintrin.h>
+#  define U16_USE_SSE2 1
+#endif
+
+/*======================================================================
+ *  1.  1 文字の復号 / 符号化
+ *====================================================================*/
+static inline uint32_t u16_get(const unsigned char* p, int be)
+{
+    return be ? ((uint32_t)p[0] << 8 | p[1]) : ((uint32_t)p[1] << 8 | p[0]);
+}
+
+static inline void u16_put(unsigned char* q, uint32_t u, int be)
+{
+    q[be]  = (unsigned char)(u & 0xFF);
+    q[!be] = (unsigned char)(u >> 8);
+}
+
+/* Return: 消費バイト数 (2 / 4) / 0 = 途中 / -1 = 対になっていないサロゲート */
+static int u16_decode(const unsigned char* p, size_t n, int be, uint32_t* cp)
+{
+    if (n < 2) return 0;
+    uint32_t u = u16_get(p, be);
+    if (u - 0xD800u >= 0x800u) { *cp = u; return 2; }
+    if (u >= 0xDC00) return -1;                         /* low が先に来た */
+    if (n < 4) return 0;
+    uint32_t lo = u16_get(p + 2, be);
+    if (lo - 0xDC00u >= 0x400u) return -1;
+    *cp = 0x10000 + ((u - 0xD800) << 10) + (lo - 0xDC00);
+    return 4;
+}
+
+static int u16_encode(uint32_t cp, unsigned char* q, size_t room, int be)
+{
+    if (cp > 0x10FFFF || cp - 0xD800u < 0x800u) return -1;
+    if (cp < 0x10000) {
+        if (room < 2) return -2;
+        u16_put(q, cp, be);
+        return 2;
+    }
+    if (room < 4) return -2;
+    cp -= 0x10000;
+    u16_put(q, 0xD800 | (cp >> 10), be);
+    u16_put(q + 2, 0xDC00 | (cp & 0x3FF), be);
+    return 4;
+}
+
+int utf16le_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    (void)c;
+    return u16_decode(p, n, 0, cp);
+}
+
+int utf16be_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    (void)c;
+    return u16_decode(p, n, 1, cp);
+}
+
+/* 先頭の BOM を読んで順序を決める (BOM は出力しない)。無ければ BE */
+int utf16_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    if (c->dstate == BO_UNSET) {
+        if (n < 2) return 0;
+        if (p[0] == 0xFE && p[1] == 0xFF) { c->dstate = BO_BE; *cp = CP_NONE; return 2; }
+        if (p[0] == 0xFF && p[1] == 0xFE) { c->dstate = BO_LE; *cp = CP_NONE; return 2; }
+        c->dstate = BO_BE;
+    }
+    return u16_decode(p, n, c->dstate == BO_BE, cp);
+}
+
+int utf16le_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    (void)c;
+    return u16_encode(cp, q, room, 0);
+}
+
+int utf16be_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    (void)c;
+    return u16_encode(cp, q, room, 1);
+}
+
+/* 最初の文字の前に BOM (FF FE) を付け、以後は LE */
+int utf16_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    if (c->estate != BO_UNSET) return u16_encode(cp, q, room, 0);
+    if (room < 2) return -2;
+    int n = u16_encode(cp, q + 2, room - 2, 0);
+    if (n < 0) return n;
+    q[0] = 0xFF; q[1] = 0xFE;
+    c->estate = BO_LE;
+    return n + 2;
+}
+
+/*======================================================================
+ *  2.  並列分割: 偶数位置に揃え、low サロゲートの前では切らない
+ *====================================================================*/
+static size_t u16_split(const unsigned char* in, size_t inlen, size_t pos, int be)
+{
+    pos &= ~(size_t)1;
+    if (pos + 2 <= inlen && (in[pos + !be] & 0xFC) == 0xDC) pos += 2;
+    return pos < inlen ? pos : inlen;
+}
+
+size_t utf16le_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos)
+{
+    (void)lo;
+    return u16_split(in, inlen, pos, 0);
+}
+
+size_t utf16be_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos)
+{
+    (void)lo;
+    return u16_split(in, inlen, pos, 1);
+}
+
+/*======================================================================
+ *  3.  CP932 ⇆ UTF-16 の核 (pair_kernel)
+ *====================================================================*/
+#if defined(U16_USE_SSE2)
+static inline __m128i bswap16(__m128i v)
+{
+    return _mm_or_si128(_mm_slli_epi16(v, 8), _mm_srli_epi16(v, 8));
+}
+#endif
+
+static inline int is_kana(unsigned b) { return b - 0xA1u <= 0x3Eu; }
+
+void sjis_to_utf16_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    int order = conv_out_order(c);
+    if (order == BO_UNSET) return;
+    int be = order == BO_BE;
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (p < end) {
+        unsigned b = *p;
+#if defined(U16_USE_SSE2)
+        /* 16 byte が全て ASCII / 半角カナなら 1 byte → 1 単位で広げる */
+        if (b < 0x80 || is_kana(b)) {
+            const __m128i zero = _mm_setzero_si128();
+            while (end - p >= 16 && qend - q >= 32) {
+                __m128i v = _mm_loadu_si128((const __m128i*)p);
+                __m128i t = _mm_sub_epi8(v, _mm_set1_epi8((char)0xA1));
+                __m128i kana = _mm_cmpeq_epi8(_mm_min_epu8(t, _mm_set1_epi8(0x3E)), t);
+                __m128i ascii = _mm_cmpgt_epi8(v, _mm_set1_epi8(-1));
+                if (_mm_movemask_epi8(_mm_or_si128(kana, ascii)) != 0xFFFF) break;
+                const __m128i diff = _mm_set1_epi16((short)0xFEC0);
+                __m128i lo = _mm_add_epi16(_mm_unpacklo_epi8(v, zero),
+                                           _mm_and_si128(_mm_unpacklo_epi8(kana, kana), diff));
+                __m128i hi = _mm_add_epi16(_mm_unpackhi_epi8(v, zero),
+                                           _mm_and_si128(_mm_unpackhi_epi8(kana, kana), diff));
+                if (be) { lo = bswap16(lo); hi = bswap16(hi); }
+                _mm_storeu_si128((__m128i*)q, lo);
+                _mm_storeu_si128((__m128i*)(q + 16), hi);
+                p += 16; q += 32;
+            }
+            if (p >= end) break;
+            b = *p;
+        }
+#endif
+        uint32_t u;
+        int n = 1;
+        if (b < 0x80)        u = b;
+        else if (is_kana(b)) u = b + 0xFEC0;
+        else {
+            if (end - p < 2) break;
+            u = SJIS_DB2U[SJIS_LEAD2ROW[b]][p[1]];
+            if (u == SJIS_NOMAP) break;
+            n = 2;
+        }
+        if (qend - q < 2) break;
+        u16_put(q, u, be);
+        p += n; q += 2;
+    }
+    *pp = p;
+    *qq = q;
+}
+
+void utf16_to_sjis_kernel(iconv_ctx* c, const unsigned char** pp,
+    const unsigned char* end, unsigned char** qq, unsigned char* qend)
+{
+    int order = conv_in_order(c);
+    if (order == BO_UNSET) return;
+    int be = order == BO_BE;
+    const unsigned char* p = *pp;
+    unsigned char* q = *qq;
+
+    while (end - p >= 2) {
+        uint32_t u = u16_get(p, be);
+#if defined(U16_USE_SSE2)
+        /* 8 単位が全て ASCII / 半角カナなら 1 単位 → 1 byte に詰める */
+        if (u < 0x80 || u - 0xFF61u <= 0x3Eu) {
+            const __m128i zero = _mm_setzero_si128();
+            while (end - p >= 16 && qend - q >= 8) {
+                __m128i v = _mm_loadu_si128((const __m128i*)p);
+                if (be) v = bswap16(v);
+                __m128i ascii = _mm_cmpeq_epi16(_mm_and_si128(v, _mm_set1_epi16((short)0xFF80)), zero);
+                __m128i t = _mm_sub_epi16(v, _mm_set1_epi16((short)0xFF61));
+                __m128i kana = _mm_cmpeq_epi16(_mm_subs_epu16(t, _mm_set1_epi16(0x3E)), zero);
+                if (_mm_movemask_epi8(_mm_or_si128(kana, ascii)) != 0xFFFF) break;
+                v = _mm_sub_epi16(v, _mm_and_si128(kana, _mm_set1_epi16((short)0xFEC0)));
+                _mm_storel_epi64((__m128i*)q, _mm_packus_epi16(v, v));
+                p += 16; q += 8;
+            }
+            if (end - p < 2) break;
+            u = u16_get(p, be);
+        }
+#endif
+        /* サロゲートも U2SJIS では対応なしなので、ここで抜けて 1 文字ずつの経路へ */
+        uint16_t s = U2SJIS[U2SJIS_PAGE[u >> 8]][u & 0xFF];
+        if (s == SJIS_NOMAP) break;
+        if (s < 0x100) {
+            if (q >= qend) break;
+            *q++ = (unsigned char)s;
+        }
+        else {
+            if (qend - q < 2) break;
+            q[0] = (unsigned char)(s >> 8);
+            q[1] = (unsigned char)(s & 0xFF);
+            q += 2;
+        }
+        p += 2;
+    }
+    *pp = p;
+    *qq = q;
+}
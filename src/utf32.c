@@ -0,0 +1,92 @@
+/*----------------------------------------------------------------------
+ *  src/utf32.c  —  UTF-32 / UTF-32LE / UTF-32BE (UCS-4 / WCHAR_T)
+ *
+ *  UTF-32LE / BE : BOM を特別扱いしない (U+FEFF はただの文字)
+ *  UTF-32        : 復号は先頭の BOM で順序を決め (無ければ BE)、
+ *                  符号化は先頭に BOM (FF FE 00 00) を付けて LE で書く
+ *  U+10FFFF 超とサロゲートは不正 (UCS-4 も同じ扱い)。
+ *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
+#include <stddef.h>
+#include <stdint.h>
+
+static inline uint32_t u32_get(const unsigned char* p, int be)
+{
+    return be ? ((uint32_t)p[0] << 24 | (uint32_t)p[1] << 16 | (uint32_t)p[2] << 8 | p[3])
+              : ((uint32_t)p[3] << 24 | (uint32_t)p[2] << 16 | (uint32_t)p[1] << 8 | p[0]);
+}
+
+static int u32_decode(const unsigned char* p, size_t n, int be, uint32_t* cp)
+{
+    if (n < 4) return 0;
+    uint32_t u = u32_get(p, be);
+    if (u > 0x10FFFF || u - 0xD800u < 0x800u) return -1;
+    *cp = u;
+    return 4;
+}
+
+static int u32_encode(uint32_t cp, unsigned char* q, size_t room, int be)
+{
+    if (cp > 0x10FFFF || cp - 0xD800u < 0x800u) return -1;
+    if (room < 4) return -2;
+    for (int k = 0; k < 4; ++k)
+        q[be ? 3 - k : k] = (unsigned char)(cp >> (8 * k));
+    return 4;
+}
+
+int utf32le_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    (void)c;
+    return u32_decode(p, n, 0, cp);
+}
+
+int utf32be_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    (void)c;
+    return u32_decode(p, n, 1, cp);
+}
+
+/* 先頭の BOM を読んで順序を決める (BOM は出力しない)。無ければ BE */
+int utf32_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    if (c->dstate == BO_UNSET) {
+        if (n < 4) return 0;
+        uint32_t u = u32_get(p, 1);
+        if (u == 0x0000FEFF) { c->dstate = BO_BE; *cp = CP_NONE; return 4; }
+        if (u == 0xFFFE0000) { c->dstate = BO_LE; *cp = CP_NONE; return 4; }
+        c->dstate = BO_BE;
+    }
+    return u32_decode(p, n, c->dstate == BO_BE, cp);
+}
+
+int utf32le_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    (void)c;
+    return u32_encode(cp, q, room, 0);
+}
+
+int utf32be_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    (void)c;
+    return u32_encode(cp, q, room, 1);
+}
+
+/* 最初の文字の前に BOM (FF FE 00 00) を付け、以後は LE */
+int utf32_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    if (c->estate != BO_UNSET) return u32_encode(cp, q, room, 0);
+    if (room < 4) return -2;
+    int n = u32_encode(cp, q + 4, room - 4, 0);
+    if (n < 0) return n;
+    q[0] = 0xFF; q[1] = 0xFE; q[2] = 0; q[3] = 0;
+    c->estate = BO_LE;
+    return n + 4;
+}
+
+/* 並列分割: 4 byte 境界に揃えるだけ */
+size_t utf32_split_point(const unsigned char* in, size_t inlen, size_t lo, size_t pos)
+{
+    (void)in; (void)lo;
+    pos &= ~(size_t)3;
+    return pos < inlen ? pos : inlen;
+}
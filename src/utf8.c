@@ -1,6 +1,7 @@
 /*----------------------------------------------------------------------
  *  src/utf8.c  —  UTF-8 encoding/decoding utilities
  *--------------------------------------------------------------------*/
+#include "iconv_internal.h"
 #include <stdint.h>
 #include <stddef.h>
 
@@ -65,3 +66,46 @@ int utf8_next(const unsigned char** p, const unsigned char* end, uint32_t* out_c
     /* 4 byte は Shift‑JIS に無いので不正とみなす */
     return -1;
 }
+
+/*======================================================================
+ *  utf8_decode / utf8_encode - 汎用変換 (M_PIVOT) 用の 1 文字処理
+ *
+ *  CP932 との専用経路と違い、UTF-16 などと組むときは Unicode 全域を扱う。
+ *  復号は厳格: 冗長表現・サロゲート・U+10FFFF 超は不正。2 byte 目で
+ *  不正と分かるものは、入力が途中で切れていても不正を返す。
+ *====================================================================*/
+int utf8_decode(iconv_ctx* c, const unsigned char* p, size_t n, uint32_t* cp)
+{
+    (void)c;
+    uint32_t b = p[0];
+    if (b < 0x80) { *cp = b; return 1; }
+
+    size_t len;
+    uint32_t v, lo = 0x80, hi = 0xBF;          /* 2 byte 目の範囲 */
+    if (b >= 0xC2 && b <= 0xDF)      { len = 2; v = b & 0x1F; }
+    else if ((b & 0xF0) == 0xE0)     { len = 3; v = b & 0x0F;
+                                       if (b == 0xE0) lo = 0xA0;
+                                       if (b == 0xED) hi = 0x9F; }
+    else if (b >= 0xF0 && b <= 0xF4) { len = 4; v = b & 0x07;
+                                       if (b == 0xF0) lo = 0x90;
+                                       if (b == 0xF4) hi = 0x8F; }
+    else return -1;
+
+    for (size_t k = 1; k < len; ++k) {
+        if (k >= n) return 0;
+        uint32_t t = p[k];
+        if (k == 1 ? (t < lo || t > hi) : (t & 0xC0) != 0x80) return -1;
+        v = (v << 6) | (t & 0x3F);
+    }
+    *cp = v;
+    return (int)len;
+}
+
+int utf8_encode(iconv_ctx* c, uint32_t cp, unsigned char* q, size_t room)
+{
+    (void)c;
+    if (cp > 0x10FFFF || cp - 0xD800u < 0x800u) return -1;
+    size_t len = cp < 0x80 ? 1 : cp < 0x800 ? 2 : cp < 0x10000 ? 3 : 4;
+    if (room < len) return -2;
+    return u32_to_utf8(cp, (char*)q);
+}
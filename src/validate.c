@@ -0,0 +1,91 @@
+/*----------------------------------------------------------------------
+ *  src/validate.c  —  iconv_alt_validate: 変換できるかだけを調べる
+ *
+ *  出力を作らずに、iconv_alt_convert() が成功するかと、失敗するなら
+ *  どこで止まるかを返す (判定は iconv() と 1 バイト単位で一致させる)。
+ *      ASCII の連続 : ascii_span() (SSE2 / NEON) で読み飛ばす
+ *      SJIS → UTF-8 : lead ごとの行表 SJIS_DB2U を 1 回引くだけ
+ *      UTF-8 → SJIS : 復号したコード点を 8 KB の U2SJIS_BITS で 1 bit 検査
+ *      その他の組   : iconv_alt_measure() (出力を捨てる変換) で代用
+ *  出力の組み立て・書き込みが無いので、変換よりずっと少ないメモリ帯域で済む。
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include "sjis_table.h"
+#include <errno.h>
+
+/* SJIS: 0x80 以上で半角カナ以外は全て 2 byte の先頭として扱う (iconv() と同じ) */
+static int validate_sjis(const unsigned char* p, size_t n, size_t* bad)
+{
+    size_t i = 0;
+    while (i < n) {
+        i += ascii_span(p + i, n - i);
+        while (i < n && p[i] >= 0x80) {
+            unsigned b = p[i];
+            if (b >= 0xA1 && b <= 0xDF) { ++i; continue; }
+            if (i + 1 >= n) { *bad = i; errno = EINVAL; return -1; }
+            if (SJIS_DB2U[SJIS_LEAD2ROW[b]][p[i + 1]] == SJIS_NOMAP) {
+                *bad = i; errno = EILSEQ; return -1;
+            }
+            i += 2;
+        }
+    }
+    return 0;
+}
+
+static inline int bmp_in_sjis(uint32_t u)
+{
+    return (int)((U2SJIS_BITS[u >> 6] >> (u & 63)) & 1);
+}
+
+/* UTF-8: iconv() と同じく 2 / 3 byte のみ受け付け、冗長表現も復号した値で判定 */
+static int validate_utf8(const unsigned char* p, size_t n, size_t* bad)
+{
+    size_t i = 0;
+    while (i < n) {
+        i += ascii_span(p + i, n - i);
+        while (i < n && p[i] >= 0x80) {
+            unsigned b = p[i];
+            if ((b & 0xF0) == 0xE0 && i + 3 <= n) {           /* 日本語の大半: 3 byte */
+                unsigned c1 = p[i + 1], c2 = p[i + 2];
+                uint32_t cp = ((b & 0x0Fu) << 12) | ((c1 & 0x3Fu) << 6) | (c2 & 0x3Fu);
+                if ((((c1 ^ 0x80) | (c2 ^ 0x80)) & 0xC0) || !bmp_in_sjis(cp)) {
+                    *bad = i; errno = EILSEQ; return -1;
+                }
+                i += 3;
+                continue;
+            }
+            size_t len;
+            uint32_t cp;
+            if ((b & 0xE0) == 0xC0)      { len = 2; cp = b & 0x1F; }
+            else if ((b & 0xF0) == 0xE0) { len = 3; cp = b & 0x0F; }
+            else { *bad = i; errno = EILSEQ; return -1; }
+
+            for (size_t k = 1; k < len; ++k) {
+                if (i + k >= n) { *bad = i; errno = EINVAL; return -1; }
+                unsigned c = p[i + k];
+                if ((c & 0xC0) != 0x80) { *bad = i; errno = EILSEQ; return -1; }
+                cp = (cp << 6) | (c & 0x3F);
+            }
+            if (!bmp_in_sjis(cp)) { *bad = i; errno = EILSEQ; return -1; }
+            i += len;
+        }
+    }
+    return 0;
+}
+
+int iconv_alt_validate(iconv_t cd, const char* buf, size_t len, size_t* bad_offset)
+{
+    const iconv_ctx* ctx = (const iconv_ctx*)cd;
+    if (!ctx || cd == (iconv_t)-1 || (!buf && len)) { errno = EINVAL; return -1; }
+
+    size_t bad = 0;
+    const unsigned char* p = (const unsigned char*)buf;
+    int rc;
+    if (ctx->mode == M_SJIS2U8)      rc = validate_sjis(p, len, &bad);
+    else if (ctx->mode == M_U82SJIS) rc = validate_utf8(p, len, &bad);
+    else                             /* その他の組は出力を捨てて数える */
+        rc = iconv_alt_measure(cd, buf, len, &bad) == (size_t)-1 ? -1 : 0;
+    if (rc < 0 && bad_offset) *bad_offset = bad;
+    return rc;
+}
@@ -0,0 +1,54 @@
+/*----------------------------------------------------------------------
+ *  src/view.c  —  iconv_alt_view / iconv_alt_result_free
+ *  純 ASCII 入力は借用で返し、コピーも確保もしない
+ *--------------------------------------------------------------------*/
+#include "iconv_alt.h"
+#include "iconv_internal.h"
+#include <errno.h>
+#include <stdlib.h>
+#include <string.h>
+
+int iconv_alt_view(iconv_t cd, const char* in, size_t inlen,
+    iconv_alt_result* result)
+{
+    const iconv_ctx* ctx = (const iconv_ctx*)cd;
+    if (!ctx || cd == (iconv_t)-1 || !result || (!in && inlen)) {
+        errno = EINVAL; return -1;
+    }
+    result->data = NULL; result->len = 0; result->owned = 0;
+
+    /* --- 純 ASCII: 両側で ASCII が同じ 1 byte なら入力をそのまま返す --- */
+    size_t ascii = conv_ascii_identity(ctx) ? ascii_span((const unsigned char*)in, inlen) : 0;
+    if (ascii == inlen) {
+        result->data = in; result->len = inlen;
+        return 0;
+    }
+
+    /* --- 非 ASCII を含む: ASCII 部分はコピー、残りだけ変換 --- */
+    size_t cap = ascii + conv_max_output(ctx, inlen - ascii);
+    char* buf = (char*)malloc(cap);
+    if (!buf) { errno = ENOMEM; return -1; }
+    memcpy(buf, in, ascii);
+
+    size_t wrote, used;                   /* cd の持ち越し状態は汚さない */
+    if (iconv_ctx_oneshot(ctx, in + ascii, inlen - ascii,
+            buf + ascii, cap - ascii, &wrote, &used) < 0) {
+        int e = errno;
+        free(buf);
+        result->len = ascii + used;       /* 停止位置を返す */
+        errno = e;
+        return -1;
+    }
+
+    result->data = buf;
+    result->len = ascii + wrote;
+    result->owned = 1;
+    return 0;
+}
+
+void iconv_alt_result_free(iconv_alt_result* result)
+{
+    if (!result) return;
+    if (result->owned) free((void*)result->data);
+    result->data = NULL; result->len = 0; result->owned = 0;
+}
@@ -0,0 +1,151 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <thread>
+#include <vector>
+
+/* -----------------------------------------------------------------
+ * 2 回目はキャッシュから返り、hit / miss が数えられる
+ * ----------------------------------------------------------------*/
+TEST(Cache, HitAfterMiss) {
+    iconv_alt_cache* cache = iconv_alt_cache_create(64);
+    ASSERT_NE(nullptr, cache);
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    const char sjis[] = "\x93\x8c\x8b\x9e\x93\x73";   // 東京都
+    for (int i = 0; i < 3; ++i) {
+        char out[32]{};
+        size_t n = iconv_alt_cache_convert(cache, cd, sjis, 6, out, sizeof(out));
+        ASSERT_EQ(9u, n);
+        EXPECT_EQ(std::string(u8"東京都"), std::string(out, n));
+    }
+
+    iconv_alt_cache_stats st{};
+    iconv_alt_cache_get_stats(cache, &st);
+    EXPECT_EQ(1u, st.misses);
+    EXPECT_EQ(2u, st.hits);
+    EXPECT_EQ(1u, st.inserts);
+
+    iconv_close(cd);
+    iconv_alt_cache_destroy(cache);
+}
+
+/* -----------------------------------------------------------------
+ * 変換方向もキーの一部 (同じバイト列でも別エントリ)
+ * ----------------------------------------------------------------*/
+TEST(Cache, KeyedByDirection) {
+    iconv_alt_cache* cache = iconv_alt_cache_create(64);
+    iconv_t to8 = iconv_open("UTF-8", "SHIFT_JIS");
+    iconv_t tosj = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, to8);
+    ASSERT_NE((iconv_t)-1, tosj);
+
+    char out[16];
+    EXPECT_EQ(3u, iconv_alt_cache_convert(cache, to8, "abc", 3, out, sizeof(out)));
+    EXPECT_EQ(3u, iconv_alt_cache_convert(cache, tosj, "abc", 3, out, sizeof(out)));
+
+    iconv_alt_cache_stats st{};
+    iconv_alt_cache_get_stats(cache, &st);
+    EXPECT_EQ(2u, st.misses);
+    EXPECT_EQ(0u, st.hits);
+
+    iconv_close(to8);
+    iconv_close(tosj);
+    iconv_alt_cache_destroy(cache);
+}
+
+/* -----------------------------------------------------------------
+ * 容量を超えると CLOCK で追い出されるが、結果は常に正しい
+ * ----------------------------------------------------------------*/
+TEST(Cache, EvictsWhenFull) {
+    iconv_alt_cache* cache = iconv_alt_cache_create(8);
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    for (int round = 0; round < 2; ++round) {
+        for (int i = 0; i < 100; ++i) {
+            std::string in = u8"品番-" + std::to_string(i);
+            std::string expect = "\x95\x69\x94\xd4-" + std::to_string(i);
+            char out[32];
+            size_t n = iconv_alt_cache_convert(cache, cd, in.c_str(), in.size(), out, sizeof(out));
+            ASSERT_EQ(expect.size(), n);
+            EXPECT_EQ(expect, std::string(out, n));
+        }
+    }
+
+    iconv_alt_cache_stats st{};
+    iconv_alt_cache_get_stats(cache, &st);
+    EXPECT_GT(st.evictions, 0u);
+    EXPECT_EQ(200u, st.hits + st.misses);
+
+    iconv_close(cd);
+    iconv_alt_cache_destroy(cache);
+}
+
+/* -----------------------------------------------------------------
+ * 長い入力は素通し、エラーはキャッシュされない
+ * ----------------------------------------------------------------*/
+TEST(Cache, BypassAndErrors) {
+    iconv_alt_cache* cache = iconv_alt_cache_create(16);
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    std::string longin(ICONV_ALT_CACHE_MAX_INPUT + 1, 'z');
+    std::vector<char> out(longin.size());
+    EXPECT_EQ(longin.size(),
+              iconv_alt_cache_convert(cache, cd, longin.c_str(), longin.size(), out.data(), out.size()));
+
+    const char bad[] = u8"😀";
+    char small[8];
+    for (int i = 0; i < 2; ++i) {
+        errno = 0;
+        EXPECT_EQ((size_t)-1, iconv_alt_cache_convert(cache, cd, bad, strlen(bad), small, sizeof(small)));
+        EXPECT_EQ(EILSEQ, errno);
+    }
+
+    /* ヒットでも出力先が小さければ E2BIG */
+    const char kana[] = u8"あいう";
+    EXPECT_EQ(6u, iconv_alt_cache_convert(cache, cd, kana, strlen(kana), small, sizeof(small)));
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv_alt_cache_convert(cache, cd, kana, strlen(kana), small, 3));
+    EXPECT_EQ(E2BIG, errno);
+
+    iconv_alt_cache_stats st{};
+    iconv_alt_cache_get_stats(cache, &st);
+    EXPECT_EQ(1u, st.bypassed);
+    EXPECT_EQ(1u, st.inserts);
+
+    iconv_close(cd);
+    iconv_alt_cache_destroy(cache);
+}
+
+/* -----------------------------------------------------------------
+ * 複数スレッドで同じ cache / cd を共有しても結果が壊れない
+ * ----------------------------------------------------------------*/
+TEST(Cache, ConcurrentReaders) {
+    iconv_alt_cache* cache = iconv_alt_cache_create(16);   // わざと小さくして追い出しを競合させる
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    std::vector<std::thread> th;
+    std::vector<int> bad(4, 0);
+    for (int t = 0; t < 4; ++t) {
+        th.emplace_back([&, t] {
+            for (int i = 0; i < 2000; ++i) {
+                std::string key = "\x82\xa0" + std::to_string((i * 7 + t) % 40);   // あN
+                std::string expect = u8"あ" + std::to_string((i * 7 + t) % 40);
+                char out[32];
+                size_t n = iconv_alt_cache_convert(cache, cd, key.c_str(), key.size(), out, sizeof(out));
+                if (n != expect.size() || std::string(out, n) != expect) bad[t]++;
+            }
+        });
+    }
+    for (auto& x : th) x.join();
+    for (int b : bad) EXPECT_EQ(0, b);
+
+    iconv_close(cd);
+    iconv_alt_cache_destroy(cache);
+}
@@ -0,0 +1,121 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/* iov を連結して 1 本の文字列に戻す (検証用) */
+static std::string join(const iconv_alt_chain* chain) {
+    std::vector<struct iovec> iov(iconv_alt_chain_iovcnt(chain));
+    int n = iconv_alt_chain_iov(chain, iov.data(), (int)iov.size());
+    std::string s;
+    for (int i = 0; i < n; ++i) s.append((const char*)iov[i].iov_base, iov[i].iov_len);
+    return s;
+}
+
+/* -----------------------------------------------------------------
+ * 小さいブロックに跨って書いても内容が一致する
+ * ----------------------------------------------------------------*/
+TEST(Chain, SpansManyBlocks) {
+    std::string sjis, expect;
+    for (int i = 0; i < 200; ++i) {
+        sjis += "\x82\xa0\xB1" "A";               // あｱA
+        expect += u8"あｱA";
+    }
+
+    iconv_alt_block_pool* pool = iconv_alt_block_pool_create(64, 0);
+    ASSERT_NE(nullptr, pool);
+    iconv_alt_chain* chain = iconv_alt_chain_create(pool);
+    ASSERT_NE(nullptr, chain);
+
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+    char* in = &sjis[0];
+    size_t inleft = sjis.size();
+    ASSERT_EQ(0u, iconv_alt_chain_convert(cd, chain, &in, &inleft));
+    EXPECT_EQ(0u, inleft);
+    iconv_close(cd);
+
+    EXPECT_EQ(expect.size(), iconv_alt_chain_size(chain));
+    EXPECT_GT(iconv_alt_chain_iovcnt(chain), 1);
+    EXPECT_EQ(expect, join(chain));
+
+    iconv_alt_chain_destroy(chain);
+    iconv_alt_block_pool_destroy(pool);
+}
+
+/* -----------------------------------------------------------------
+ * ストリーム: 文字が呼び出しを跨いでも続きから書ける
+ * ----------------------------------------------------------------*/
+TEST(Chain, StreamingAppends) {
+    const char utf8[] = u8"あいうえお";
+    iconv_alt_block_pool* pool = iconv_alt_block_pool_create(16, 0);
+    iconv_alt_chain* chain = iconv_alt_chain_create(pool);
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    char* in = (char*)utf8;
+    size_t first = 4, rest = strlen(utf8) - 4;      // 「い」の途中で分割
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv_alt_chain_convert(cd, chain, &in, &first));
+    EXPECT_EQ(EINVAL, errno);
+    EXPECT_EQ(0u, iconv_alt_chain_convert(cd, chain, &in, &rest));
+    iconv_close(cd);
+
+    EXPECT_EQ(std::string("\x82\xa0\x82\xa2\x82\xa4\x82\xa6\x82\xa8"), join(chain));
+    iconv_alt_chain_destroy(chain);
+    iconv_alt_block_pool_destroy(pool);
+}
+
+/* -----------------------------------------------------------------
+ * reset で返したブロックは次の変換で再利用される
+ * ----------------------------------------------------------------*/
+TEST(Chain, BlocksAreRecycled) {
+    iconv_alt_block_pool* pool = iconv_alt_block_pool_create(32, 0);
+    iconv_alt_chain* chain = iconv_alt_chain_create(pool);
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    const char sjis[] = "\x82\xa0";
+    char* in = (char*)sjis;
+    size_t inleft = 2;
+    ASSERT_EQ(0u, iconv_alt_chain_convert(cd, chain, &in, &inleft));
+    struct iovec a{};
+    ASSERT_EQ(1, iconv_alt_chain_iov(chain, &a, 1));
+
+    iconv_alt_chain_reset(chain);
+    EXPECT_EQ(0u, iconv_alt_chain_size(chain));
+
+    in = (char*)sjis; inleft = 2;
+    ASSERT_EQ(0u, iconv_alt_chain_convert(cd, chain, &in, &inleft));
+    struct iovec b{};
+    ASSERT_EQ(1, iconv_alt_chain_iov(chain, &b, 1));
+    EXPECT_EQ(a.iov_base, b.iov_base);              // 同じブロック
+
+    iconv_close(cd);
+    iconv_alt_chain_destroy(chain);
+    iconv_alt_block_pool_destroy(pool);
+}
+
+/* -----------------------------------------------------------------
+ * 変換エラーは iconv() と同じく errno で返る
+ * ----------------------------------------------------------------*/
+TEST(Chain, IllegalSequence) {
+    iconv_alt_block_pool* pool = iconv_alt_block_pool_create(0, 0);
+    iconv_alt_chain* chain = iconv_alt_chain_create(pool);
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    const char utf8[] = u8"x😀";
+    char* in = (char*)utf8;
+    size_t inleft = strlen(utf8);
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv_alt_chain_convert(cd, chain, &in, &inleft));
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(1u, iconv_alt_chain_size(chain));
+
+    iconv_close(cd);
+    iconv_alt_chain_destroy(chain);
+    iconv_alt_block_pool_destroy(pool);
+}
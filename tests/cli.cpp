@@ -0,0 +1,206 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cstdio>
+#include <cstdlib>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+#if !defined(_WIN32)
+#  include <sys/stat.h>
+#  include <sys/wait.h>
+#endif
+
+#ifndef ICONV_ALT_CLI
+#error "ICONV_ALT_CLI (iconv-alt の実行ファイルのパス) を定義すること"
+#endif
+
+/* テストごとに別の名前 (ctest -j で並行して走っても同じファイルを使わない) */
+static std::string tmp(const char* name)
+{
+    return ::testing::TempDir() + ::testing::UnitTest::GetInstance()->current_test_info()->name() +
+           "_" + name;
+}
+
+static void write_file(const std::string& path, const std::string& data)
+{
+    std::ofstream(path, std::ios::binary) << data;
+}
+
+static std::string read_file(const std::string& path)
+{
+    std::ifstream f(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), {});
+}
+
+/* コマンドを実行して終了コードを返す (stderr は捨てる) */
+static int run(const std::string& args)
+{
+    std::string cmd = std::string("\"") + ICONV_ALT_CLI + "\" " + args + " 2>" + tmp("cli_err.txt");
+    int rc = std::system(cmd.c_str());
+#if !defined(_WIN32)
+    if (rc != -1 && WIFEXITED(rc)) rc = WEXITSTATUS(rc);
+#endif
+    return rc;
+}
+
+static const std::string kU8 = "請求書ｱｲｳabc①\n表予定";
+static const std::string kSjis = "\x90\xbf\x8b\x81\x8f\x91\xb1\xb2\xb3" "abc\x87\x40\n\x95\x5c\x97\x5c\x92\xe8";
+
+TEST(Cli, ConvertsFilesAndPipes) {
+    write_file(tmp("cli_in.txt"), kSjis);
+    ASSERT_EQ(0, run("-f CP932 -t UTF-8 -o \"" + tmp("cli_out.txt") + "\" \"" + tmp("cli_in.txt") + "\""));
+    EXPECT_EQ(kU8, read_file(tmp("cli_out.txt")));
+
+    /* 標準入力 / 複数入力の連結 / 長いオプション */
+    ASSERT_EQ(0, run("--from-code=SJIS --to-code UTF-8 < \"" + tmp("cli_in.txt") + "\" > \"" +
+                     tmp("cli_out.txt") + "\""));
+    EXPECT_EQ(kU8, read_file(tmp("cli_out.txt")));
+    ASSERT_EQ(0, run("-fCP932 -tUTF-8 \"" + tmp("cli_in.txt") + "\" - \"" + tmp("cli_in.txt") +
+                     "\" < \"" + tmp("cli_in.txt") + "\" > \"" + tmp("cli_out.txt") + "\""));
+    EXPECT_EQ(kU8 + kU8 + kU8, read_file(tmp("cli_out.txt")));
+}
+
+TEST(Cli, OutputOverInput) {
+    /* -o が入力と同じファイルでも、全部読んでから置き換える (iconv(1) と同じ) */
+    std::string u8;
+    while (u8.size() < (6u << 20)) u8 += kU8;                  // mmap の経路も
+    for (const std::string& text : { kU8, u8 }) {
+        write_file(tmp("cli_self.txt"), text);
+        ASSERT_EQ(0, run("-f UTF-8 -t UTF-16LE -o \"" + tmp("cli_self.txt") + "\" \"" + tmp("cli_self.txt") + "\""));
+        std::string u16 = read_file(tmp("cli_self.txt"));
+        EXPECT_EQ(0u, u16.size() % 2);
+        EXPECT_GT(u16.size(), text.size() / 2);
+        ASSERT_EQ(0, run("-f UTF-16LE -t UTF-8 -o \"" + tmp("cli_self.txt") + "\" \"" + tmp("cli_self.txt") + "\""));
+        EXPECT_TRUE(read_file(tmp("cli_self.txt")) == text);
+    }
+    /* 変換エラーでも手前までの出力は残る */
+    write_file(tmp("cli_self.txt"), std::string("\x90\xbf" "\x81\x7f", 4));
+    EXPECT_EQ(1, run("-f CP932 -t UTF-8 -o \"" + tmp("cli_self.txt") + "\" \"" + tmp("cli_self.txt") + "\""));
+    EXPECT_EQ("請", read_file(tmp("cli_self.txt")));
+
+#if !defined(_WIN32)
+    /* 置き換えても既存の出力先の許可は変わらない */
+    write_file(tmp("cli_self.txt"), "abc");
+    ASSERT_EQ(0, chmod(tmp("cli_self.txt").c_str(), 0640));
+    ASSERT_EQ(0, run("-f UTF-8 -t UTF-16LE -o \"" + tmp("cli_self.txt") + "\" \"" + tmp("cli_self.txt") + "\""));
+    struct stat sb;
+    ASSERT_EQ(0, stat(tmp("cli_self.txt").c_str(), &sb));
+    EXPECT_EQ(0640u, (unsigned)(sb.st_mode & 07777));
+#endif
+}
+
+TEST(Cli, LargeFileUsesParallelPath) {
+    std::string u8;
+    while (u8.size() < (6u << 20)) u8 += kU8;
+    write_file(tmp("cli_big.txt"), u8);
+    ASSERT_EQ(0, run("-f UTF-8 -t CP932 -j 3 --stats -o \"" + tmp("cli_big_sj.txt") + "\" \"" +
+                     tmp("cli_big.txt") + "\""));
+    EXPECT_NE(std::string::npos, read_file(tmp("cli_err.txt")).find("mmap 1"));
+    ASSERT_EQ(0, run("-f CP932 -t UTF-8 -o \"" + tmp("cli_big_rt.txt") + "\" \"" +
+                     tmp("cli_big_sj.txt") + "\""));
+    EXPECT_TRUE(read_file(tmp("cli_big_rt.txt")) == u8);
+}
+
+TEST(Cli, InvalidInput) {
+    write_file(tmp("cli_bad.txt"), std::string("\x90\xbf" "\x81\x7f" "x", 5));
+    EXPECT_EQ(1, run("-f CP932 -t UTF-8 \"" + tmp("cli_bad.txt") + "\" > \"" + tmp("cli_out.txt") + "\""));
+    EXPECT_EQ("請", read_file(tmp("cli_out.txt")));              // 手前までは出る
+    EXPECT_NE(std::string::npos, read_file(tmp("cli_err.txt")).find("position 2"));
+
+    /* -c / //IGNORE: 不正なバイトを捨てて続ける (終了コードは 1) */
+    EXPECT_EQ(1, run("-c -f CP932 -t UTF-8 \"" + tmp("cli_bad.txt") + "\" > \"" + tmp("cli_out.txt") + "\""));
+    EXPECT_EQ("請\x7fx", read_file(tmp("cli_out.txt")));
+    EXPECT_EQ(1, run("-f CP932 -t UTF-8//IGNORE -s < \"" + tmp("cli_bad.txt") + "\" > \"" +
+                     tmp("cli_out.txt") + "\""));
+    EXPECT_EQ("請\x7fx", read_file(tmp("cli_out.txt")));
+
+    /* 表せない文字は丸ごと捨てる (① は CP1252 に無い。0x40 '@' を残さない) */
+    write_file(tmp("cli_unmapped.txt"), "\x87\x40X");
+    EXPECT_EQ(1, run("-c -f CP932 -t CP1252 \"" + tmp("cli_unmapped.txt") + "\" > \"" + tmp("cli_out.txt") + "\""));
+    EXPECT_EQ("X", read_file(tmp("cli_out.txt")));
+
+    /* UTF-16: サロゲート対は 4 byte まとめて、不正な単独の下位サロゲートは 2 byte 捨てる */
+    write_file(tmp("cli_bad16.txt"), std::string("a\0\x3d\xd8\x00\xde" "b\0\x00\xdc" "c\0", 12));
+    EXPECT_EQ(1, run("-c -f UTF-16LE -t CP932 \"" + tmp("cli_bad16.txt") + "\" > \"" + tmp("cli_out.txt") + "\""));
+    EXPECT_EQ("abc", read_file(tmp("cli_out.txt")));
+
+    write_file(tmp("cli_trunc.txt"), "\x90");
+    EXPECT_EQ(1, run("-f CP932 -t UTF-8 \"" + tmp("cli_trunc.txt") + "\""));
+    EXPECT_NE(std::string::npos, read_file(tmp("cli_err.txt")).find("incomplete"));
+}
+
+TEST(Cli, ListAndUsageErrors) {
+    write_file(tmp("cli_in.txt"), kSjis);
+    ASSERT_EQ(0, run("-l > \"" + tmp("cli_out.txt") + "\""));
+    std::string list = read_file(tmp("cli_out.txt"));
+    EXPECT_NE(std::string::npos, list.find("CP932"));
+    EXPECT_NE(std::string::npos, list.find("UTF-8"));
+
+    EXPECT_EQ(1, run("-f EBCDIC-US -t UTF-8 < \"" + tmp("cli_in.txt") + "\""));
+    EXPECT_EQ(1, run("--no-such-option"));
+    EXPECT_EQ(1, run("-f"));
+    EXPECT_EQ(1, run("-f CP932 -t UTF-8 \"" + tmp("cli_missing.txt") + "\""));
+}
+
+#if !defined(_WIN32)
+TEST(Cli, TreeSubcommand) {
+    std::string in = tmp("cli_tree_in"), out = tmp("cli_tree_out");
+    ASSERT_EQ(0, std::system(("rm -rf \"" + in + "\" \"" + out + "\" && mkdir -p \"" + in +
+                              "/sub\"").c_str()));
+    write_file(in + "/a.txt", kSjis);
+    write_file(in + "/sub/b.txt", kSjis + kSjis);
+    ASSERT_EQ(0, run("tree -f CP932 -t UTF-8 --stats \"" + in + "\" \"" + out + "\""));
+    EXPECT_NE(std::string::npos, read_file(tmp("cli_err.txt")).find("2 files (0 failed)"));
+    EXPECT_EQ(kU8, read_file(out + "/a.txt"));
+    EXPECT_EQ(kU8 + kU8, read_file(out + "/sub/b.txt"));
+
+    /* 失敗したファイルは名前と位置を出して 1 で終わる (出力は作らない) */
+    write_file(in + "/sub/bad.txt", std::string("\x90\xbf" "\x81\x7f", 4));
+    EXPECT_EQ(1, run("tree --no-uring -j 2 -f CP932 -t UTF-8 \"" + in + "\" \"" + out + "\""));
+    std::string err = read_file(tmp("cli_err.txt"));
+    EXPECT_NE(std::string::npos, err.find("bad.txt"));
+    EXPECT_NE(std::string::npos, err.find("position 2"));
+    EXPECT_EQ("", read_file(out + "/sub/bad.txt"));
+
+    EXPECT_EQ(1, run("tree -f CP932 -t UTF-8 \"" + in + "\""));            // 出力先が無い
+    EXPECT_EQ(1, run("tree -c -f CP932 -t UTF-8 \"" + in + "\" \"" + out + "\""));
+    write_file(tmp("cli_in.txt"), kSjis);
+    EXPECT_EQ(1, run("--no-uring -f CP932 -t UTF-8 \"" + tmp("cli_in.txt") + "\""));
+    EXPECT_EQ(1, run("tree -f CP932 -t UTF-8 \"" + tmp("cli_tree_missing") + "\" \"" + out + "\""));
+}
+#endif
+
+static int collect(unsigned int n, const char* const* names, void* data)
+{
+    static_cast<std::vector<std::vector<std::string>>*>(data)->emplace_back(names, names + n);
+    return 0;
+}
+
+TEST(Cli, LibraryEncodingList) {
+    std::vector<std::vector<std::string>> fam;
+    iconv_alt_list(collect, &fam);
+    ASSERT_GE(fam.size(), 26u);
+    EXPECT_EQ("CP932", fam[0][0]);
+    EXPECT_EQ("UTF-8", fam[1][0]);
+    EXPECT_EQ("UTF-16", fam[2][0]);
+    EXPECT_EQ("UTF-16LE", fam[3][0]);
+    EXPECT_EQ("UTF-16BE", fam[4][0]);
+    EXPECT_EQ("UTF-32", fam[5][0]);
+    EXPECT_EQ("UTF-32LE", fam[6][0]);
+    EXPECT_EQ("UTF-32BE", fam[7][0]);
+    EXPECT_EQ("EUC-JP", fam[8][0]);
+    EXPECT_EQ("ISO-2022-JP", fam[9][0]);
+    EXPECT_EQ("CP50221", fam[10][0]);
+    EXPECT_EQ("SHIFT_JIS-2004", fam[11][0]);
+    EXPECT_EQ("CP936", fam[12][0]);
+    EXPECT_EQ("CP1258", fam[23][0]);
+    EXPECT_EQ("IBM-930", fam[24][0]);
+    EXPECT_EQ("IBM-939", fam[25][0]);
+    for (const auto& f : fam)                      // どの別名も CP932 と組んで開ける
+        for (const auto& n : f) {
+            iconv_t cd = iconv_open("CP932", n.c_str());
+            EXPECT_NE((iconv_t)-1, cd) << n;
+            if (cd != (iconv_t)-1) iconv_close(cd);
+        }
+}
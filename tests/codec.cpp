@@ -0,0 +1,111 @@
+#include <gtest/gtest.h>
+#include <iconv_alt_codec.hpp>
+#include <iconv.h>
+#include <string>
+
+namespace enc = iconv_alt::encoding;
+namespace pol = iconv_alt::policy;
+
+template <class Codec>
+static std::string run(const std::string& in, iconv_alt::codec_result* res = nullptr)
+{
+    std::string out(Codec::max_output(in.size()), '\0');
+    auto r = Codec::convert(in.data(), in.size(), &out[0], out.size());
+    out.resize(r.written);
+    if (res) *res = r;
+    return out;
+}
+
+static std::string via_iconv(const char* to, const char* from, const std::string& in)
+{
+    iconv_t cd = iconv_open(to, from);
+    std::string out(in.size() * 3, '\0');
+    char* ip = const_cast<char*>(in.data());
+    size_t il = in.size();
+    char* op = &out[0];
+    size_t ol = out.size();
+    size_t r = iconv(cd, &ip, &il, &op, &ol);
+    iconv_close(cd);
+    EXPECT_NE((size_t)-1, r);
+    out.resize(out.size() - ol);
+    return out;
+}
+
+/* -----------------------------------------------------------------
+ * 全 CP932 コードで iconv() と同じ結果 (表を共有している)
+ * ----------------------------------------------------------------*/
+TEST(Codec, MatchesIconvForAllCodes) {
+    std::string sj;
+    for (const auto& e : SJIS_MAP) {
+        if (e.sjis > 0xFF) sj += static_cast<char>(e.sjis >> 8);
+        sj += static_cast<char>(e.sjis & 0xFF);
+    }
+    iconv_alt::codec_result r{};
+    std::string u8 = run<iconv_alt::codec<enc::sjis, enc::utf8>>(sj, &r);
+    EXPECT_EQ(std::errc{}, r.ec);
+    EXPECT_EQ(sj.size(), r.read);
+    EXPECT_EQ(via_iconv("UTF-8", "CP932", sj), u8);
+
+    std::string back = run<iconv_alt::codec<enc::utf8, enc::sjis, pol::stop, pol::unchecked>>(u8, &r);
+    EXPECT_EQ(std::errc{}, r.ec);
+    EXPECT_EQ(via_iconv("CP932", "UTF-8", u8), back);
+}
+
+/* -----------------------------------------------------------------
+ * stop: 停止位置と errc
+ * ----------------------------------------------------------------*/
+TEST(Codec, StopReportsPosition) {
+    using to_sjis = iconv_alt::codec<enc::utf8, enc::sjis>;
+    iconv_alt::codec_result r{};
+
+    run<to_sjis>("ab\xF0\x9F\x98\x80" "cd", &r);                  // 😀 は変換不能
+    EXPECT_EQ(std::errc::illegal_byte_sequence, r.ec);
+    EXPECT_EQ(2u, r.read);
+    EXPECT_EQ(2u, r.written);
+
+    run<to_sjis>("ab\xE3\x81", &r);                               // 途中で終わる
+    EXPECT_EQ(std::errc::invalid_argument, r.ec);
+    EXPECT_EQ(2u, r.read);
+
+    char small[3];
+    const char in[] = "\xE3\x81\x82\xE3\x81\x84";                 // あい
+    r = to_sjis::convert(in, 6, small, sizeof(small));
+    EXPECT_EQ(std::errc::argument_list_too_long, r.ec);
+    EXPECT_EQ(3u, r.read);
+    EXPECT_EQ(2u, r.written);
+}
+
+/* -----------------------------------------------------------------
+ * skip / replace
+ * ----------------------------------------------------------------*/
+TEST(Codec, SkipAndReplace) {
+    const std::string bad_sj = "A\x85\x40" "B\xFF" "C\x82";       // 未定義 2 byte, 不正 1 byte, 途中終了
+    EXPECT_EQ("ABC", (run<iconv_alt::codec<enc::sjis, enc::utf8, pol::skip>>(bad_sj)));
+    EXPECT_EQ("A\xEF\xBF\xBD" "B\xEF\xBF\xBD" "C\xEF\xBF\xBD",
+              (run<iconv_alt::codec<enc::sjis, enc::utf8, pol::replace>>(bad_sj)));
+
+    /* trail にならないバイトは lead だけを不正にし、次の文字として読む */
+    const std::string torn = "a\x82\n" "b\x82 \x82\xA0";
+    EXPECT_EQ("a\nb あ", (run<iconv_alt::codec<enc::sjis, enc::utf8, pol::skip>>(torn)));
+    EXPECT_EQ("a\xEF\xBF\xBD\nb\xEF\xBF\xBD あ", (run<iconv_alt::codec<enc::sjis, enc::utf8, pol::replace>>(torn)));
+
+    const std::string u8 = "x\xE2\x82\xAC" "y\xC0\xAF" "z";       // €, 冗長表現
+    EXPECT_EQ("x?y??z", (run<iconv_alt::codec<enc::utf8, enc::sjis, pol::replace, pol::unchecked>>(u8)));
+}
+
+/* -----------------------------------------------------------------
+ * checked: 置換文字も含めて出力境界を越えない
+ * ----------------------------------------------------------------*/
+TEST(Codec, CheckedNeverOverruns) {
+    using c = iconv_alt::codec<enc::sjis, enc::utf8, pol::replace>;
+    const std::string in = "abcdefghij\xB1\xB2\xFF\x82\xA0";      // ｱｲ, 不正, あ
+    const std::string full = run<c>(in);
+    for (size_t cap = 0; cap < full.size(); ++cap) {
+        std::string out(cap + 1, '#');
+        auto r = c::convert(in.data(), in.size(), &out[0], cap);
+        EXPECT_EQ(std::errc::argument_list_too_long, r.ec);
+        EXPECT_LE(r.written, cap);
+        EXPECT_EQ('#', out[cap]);
+        EXPECT_EQ(full.substr(0, r.written), out.substr(0, r.written));
+    }
+}
@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+/* iconv_alt_convert で一括変換。失敗は空文字列と err / stop */
+static std::string conv(const char* to, const char* from, const std::string& in,
+    size_t* stop = nullptr, int* err = nullptr)
+{
+    iconv_t cd = iconv_open(to, from);
+    EXPECT_NE((iconv_t)-1, cd) << from << " -> " << to;
+    std::string out(in.size() * 4 + 4, '\0');
+    size_t s = 0;
+    errno = 0;
+    size_t r = iconv_alt_convert(cd, in.data(), in.size(), &out[0], out.size(), &s);
+    if (err) *err = r == (size_t)-1 ? errno : 0;
+    if (stop) *stop = s;
+    iconv_close(cd);
+    out.resize(r == (size_t)-1 ? 0 : r);
+    return out;
+}
+
+/* iconv() に 1 byte ずつ入力し、出力は 4 byte ずつ空ける */
+static std::string trickle(const char* to, const char* from, const std::string& in)
+{
+    iconv_t cd = iconv_open(to, from);
+    std::string out;
+    for (size_t i = 0; i < in.size(); ++i) {
+        char* ip = const_cast<char*>(in.data() + i);
+        size_t il = 1;
+        for (;;) {
+            char buf[4];
+            char* op = buf;
+            size_t ol = sizeof(buf);
+            size_t r = iconv(cd, &ip, &il, &op, &ol);
+            out.append(buf, sizeof(buf) - ol);
+            if (r != (size_t)-1 || errno == EINVAL) break;
+            EXPECT_EQ(E2BIG, errno);
+        }
+    }
+    iconv_close(cd);
+    return out;
+}
+
+struct Page { const char* name; bool dbcs; int mapped; };
+
+/* 生成した表の文字数 (ASCII を含む 1 byte の文字 + 2 byte の文字) */
+static const Page kPages[] = {
+    { "CP936", true, 129 + 21791 }, { "CP949", true, 128 + 17048 }, { "CP950", true, 128 + 13752 },
+    { "CP1250", false, 251 }, { "CP1251", false, 255 }, { "CP1252", false, 251 },
+    { "CP1253", false, 239 }, { "CP1254", false, 249 }, { "CP1255", false, 233 },
+    { "CP1256", false, 256 }, { "CP1257", false, 244 }, { "CP1258", false, 247 },
+};
+
+TEST(Codepage, KnownCodes) {
+    EXPECT_EQ("\xd6\xd0\xce\xc4", conv("GBK", "UTF-8", "中文"));
+    EXPECT_EQ("\x80", conv("CP936", "UTF-8", "€"));
+    EXPECT_EQ("\xc7\xd1\xb1\xb9\xbe\xee", conv("CP949", "UTF-8", "한국어"));
+    EXPECT_EQ("\xa4\xa4\xa4\xe5", conv("BIG5", "UTF-8", "中文"));
+    EXPECT_EQ("\xb3", conv("CP1250", "UTF-8", "ł"));
+    EXPECT_EQ("\xcf\xf0\xe8\xe2\xe5\xf2", conv("WINDOWS-1251", "UTF-8", "Привет"));
+    EXPECT_EQ("\x80\xe9", conv("CP1252", "UTF-8", "€é"));
+    EXPECT_EQ("\xe1", conv("CP1253", "UTF-8", "α"));
+    EXPECT_EQ("\xf0", conv("CP1254", "UTF-8", "ğ"));
+    EXPECT_EQ("\xe0", conv("CP1255", "UTF-8", "א"));
+    EXPECT_EQ("\xda", conv("CP1256", "UTF-8", "ع"));
+    EXPECT_EQ("\xe0", conv("CP1257", "UTF-8", "ą"));
+    EXPECT_EQ("\xfe", conv("CP1258", "UTF-8", "₫"));
+    EXPECT_EQ("中文", conv("UTF-8", "CP950", "\xa4\xa4\xa4\xe5"));
+    EXPECT_EQ("\xa4\x51\xa4\xca", conv("CP950", "UTF-8", "十卅"));      // 重複は漢字の位置 (Windows / glibc と同じ)
+    EXPECT_EQ("十卅", conv("UTF-8", "CP950", "\xa2\xcc\xa2\xce"));
+    EXPECT_EQ("\x92\x86\x95\xb6", conv("CP932", "CP936", "\xd6\xd0\xce\xc4"));   // 核の無い組
+    EXPECT_EQ("ab\xd6\xd0", conv("CP936", "UTF-16LE", conv("UTF-16LE", "UTF-8", "ab中")));
+}
+
+TEST(Codepage, EveryCodeMatchesPivot) {
+    /* 全ての 1 / 2 byte: UTF-8 の核と UTF-16 を介した 1 文字ずつの経路が同じで、
+       符号化すると同じ文字に戻る (CP950 の重複は最小のコードへ) */
+    for (const Page& pg : kPages) {
+        int mapped = 0x80;
+        for (unsigned c = 0x80; c <= (pg.dbcs ? 0xFEFEu : 0xFFu); ++c) {
+            if (c >= 0x100 && (c < 0x8100 || (c & 0xFF) < 0x40 || (c & 0xFF) == 0xFF)) continue;
+            std::string in = c < 0x100 ? std::string(1, (char)c)
+                                       : std::string{ (char)(c >> 8), (char)(c & 0xFF) };
+            in = "a" + in + "\n";                          // lead byte の単独は \n で EILSEQ
+            int err = 0;
+            std::string u8 = conv("UTF-8", pg.name, in, nullptr, &err);
+            if (err) { EXPECT_EQ(EILSEQ, err) << pg.name << " " << std::hex << c; continue; }
+            ++mapped;
+            EXPECT_EQ(conv("UTF-16LE", "UTF-8", u8), conv("UTF-16LE", pg.name, in))
+                << pg.name << " " << std::hex << c;
+            std::string back = conv(pg.name, "UTF-8", u8);
+            EXPECT_EQ(u8, conv("UTF-8", pg.name, back)) << pg.name << " " << std::hex << c;
+            EXPECT_EQ(back, conv(pg.name, "UTF-16LE", conv("UTF-16LE", "UTF-8", u8)))
+                << pg.name << " " << std::hex << c;
+        }
+        EXPECT_EQ(pg.mapped, mapped) << pg.name;
+    }
+}
+
+TEST(Codepage, Errors) {
+    size_t stop = 0;
+    int err = 0;
+    conv("UTF-8", "CP936", "ab\xff", &stop, &err);                 // 未定義の 1 byte
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "CP949", "ab\x81\x20", &stop, &err);             // trail にならない
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "CP950", "ab\xa4", &stop, &err);                 // 途中で終わる
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "CP1253", "ab\xaa", &stop, &err);                // CP1253 の空き
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("CP1252", "UTF-8", "ab中", &stop, &err);                  // 表せない
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("CP936", "UTF-8", "a\xf0\x9f\x98\x80", &stop, &err);      // BMP の外
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+    conv("CP949", "UTF-8", "a\xed\xa0\x80", &stop, &err);          // サロゲート
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+}
+
+TEST(Codepage, StreamingAndParallel) {
+    const struct { const char* name; const char* text; } kTexts[] = {
+        { "CP936", "中文abc，简体字€\n" }, { "CP949", "한국어 텍스트abc\n" },
+        { "CP950", "中文abc，繁體字\n" }, { "CP1251", "Привет, мир\n" },
+        { "CP1252", "Café €5 naïve\n" },
+    };
+    for (const auto& t : kTexts) {
+        std::string text;
+        while (text.size() < 600) text += t.text;
+        std::string enc = conv(t.name, "UTF-8", text);
+        ASSERT_FALSE(enc.empty()) << t.name;
+        EXPECT_EQ(text, trickle("UTF-8", t.name, enc)) << t.name;
+        EXPECT_EQ(enc, trickle(t.name, "UTF-8", text)) << t.name;
+        EXPECT_EQ(conv("UTF-16BE", "UTF-8", text), trickle("UTF-16BE", t.name, enc)) << t.name;
+
+        /* ASCII の無い長い 2 byte の連続 (走査窓より長い) でも文字の途中で切らない */
+        std::string big;
+        std::string block = conv(t.name, "UTF-8", std::string(t.text).substr(0, 6));
+        for (int k = 0; k < 3000; ++k) big += block;
+        while (big.size() < (1u << 20)) big += enc;
+        for (const char* to : { "UTF-8", "UTF-16LE" }) {
+            iconv_t cd = iconv_open(to, t.name);
+            std::string out(big.size() * 3, '\0');
+            size_t n = iconv_alt_convert_parallel(cd, big.data(), big.size(), &out[0], out.size(), 4, nullptr);
+            iconv_close(cd);
+            ASSERT_NE((size_t)-1, n) << t.name << " -> " << to;
+            out.resize(n);
+            EXPECT_EQ(conv(to, t.name, big), out) << t.name << " -> " << to;
+        }
+    }
+}
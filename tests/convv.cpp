@@ -0,0 +1,158 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <cstring>
+#include <string>
+#include <vector>
+
+/* 文字列を指定サイズのフラグメントに切る (検証用) */
+static std::vector<struct iovec> cut(std::string& s, std::initializer_list<size_t> sizes) {
+    std::vector<struct iovec> v;
+    size_t off = 0;
+    for (size_t n : sizes) {
+        struct iovec f;
+        f.iov_base = &s[0] + off;
+        f.iov_len = n;
+        v.push_back(f);
+        off += n;
+    }
+    return v;
+}
+
+/* -----------------------------------------------------------------
+ * 入力側で分断された SJIS 文字 (lead | trail) を繋いで変換する
+ * ----------------------------------------------------------------*/
+TEST(Convv, SjisSplitAcrossInputFragments) {
+    std::string sjis = "A\x82\xa0\x82\xa2" "B";    // A あ い B
+    auto in = cut(sjis, { 2, 0, 2, 2 });           // "A\x82" | "" | "\xa0\x82" | "\xa2B"
+
+    char buf[32]{};
+    struct iovec out = { buf, sizeof(buf) };
+    iconv_alt_progress pr{};
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+    ASSERT_EQ(0u, iconv_alt_convv(cd, in.data(), (int)in.size(), &out, 1, &pr));
+    iconv_close(cd);
+
+    EXPECT_EQ(sjis.size(), pr.in_total);
+    EXPECT_EQ(std::string(u8"AあいB"), std::string(buf, pr.out_total));
+}
+
+/* -----------------------------------------------------------------
+ * 出力側: 入りきらない文字は次のフラグメントへ跨いで連続に書く
+ * ----------------------------------------------------------------*/
+TEST(Convv, OutputSpansFragments) {
+    std::string utf8 = u8"あいうえお";             // 15 byte
+    auto in = cut(utf8, { 1, 5, 9 });              // UTF-8 の途中で切る
+
+    std::string sjis_out(10, '\0');
+    auto out = cut(sjis_out, { 1, 3, 1, 5 });
+    iconv_alt_progress pr{};
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+    ASSERT_EQ(0u, iconv_alt_convv(cd, in.data(), (int)in.size(),
+                                  out.data(), (int)out.size(), &pr));
+    iconv_close(cd);
+
+    EXPECT_EQ(10u, pr.out_total);
+    EXPECT_EQ(std::string("\x82\xa0\x82\xa2\x82\xa4\x82\xa6\x82\xa8"), sjis_out);
+}
+
+/* -----------------------------------------------------------------
+ * 1 歩の出力が 4 byte を超える方式 (BOM + UTF-32 の 8 byte、
+ * エスケープ + 区点の 5 byte、2 コード点の か゚ を BOM 付き UTF-32 へ 12 byte)
+ * も小さなフラグメントへ跨いで書く
+ * ----------------------------------------------------------------*/
+TEST(Convv, LongestCharacterOutputSpansFragments) {
+    struct { const char* to; const char* from; std::string in, expect; } cases[] = {
+        { "UTF-32", "UTF-8", u8"日", std::string("\xff\xfe\0\0\xe5\x65\0\0", 8) },
+        { "ISO-2022-JP", "UTF-8", u8"日", "\x1b$BF|" },
+        { "UTF-32", "SHIFT_JIS-2004", "\x82\xf5",
+          std::string("\xff\xfe\0\0\x4b\x30\0\0\x9a\x30\0\0", 12) },
+    };
+    for (auto& c : cases) {
+        auto in = cut(c.in, { c.in.size() });
+        /* 1 byte ずつ / 先頭だけ短い {4, 100} */
+        for (bool bytewise : { true, false }) {
+            std::string got(bytewise ? c.expect.size() : 104, '\0');
+            std::vector<struct iovec> out;
+            if (bytewise)
+                for (size_t k = 0; k < got.size(); ++k) out.push_back({ &got[k], 1 });
+            else
+                out = cut(got, { 4, 100 });
+            iconv_alt_progress pr{};
+            iconv_t cd = iconv_open(c.to, c.from);
+            ASSERT_NE((iconv_t)-1, cd);
+            EXPECT_EQ(0u, iconv_alt_convv(cd, in.data(), 1, out.data(), (int)out.size(), &pr)) << c.to;
+            iconv_close(cd);
+            EXPECT_EQ(c.in.size(), pr.in_total) << c.to;
+            EXPECT_EQ(c.expect, got.substr(0, pr.out_total)) << c.to;
+        }
+    }
+}
+
+/* -----------------------------------------------------------------
+ * E2BIG: 出力を差し替えて続きから再開できる
+ * ----------------------------------------------------------------*/
+TEST(Convv, ResumeAfterE2big) {
+    std::string sjis = "\x82\xa0\x82\xa2\x82\xa4";  // あいう
+    auto in = cut(sjis, { 3, 3 });
+
+    char a[5]{}, b[16]{};
+    struct iovec out1 = { a, sizeof(a) };
+    iconv_alt_progress pr{};
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv_alt_convv(cd, in.data(), 2, &out1, 1, &pr));
+    EXPECT_EQ(E2BIG, errno);
+    std::string got(a, pr.out_total);
+    EXPECT_EQ(3u, got.size());                     // あ のみ (後続フラグメント無しでは分割しない)
+    EXPECT_EQ(1, pr.in_index);                     // い の lead は cd が保持
+    EXPECT_EQ(0u, pr.in_offset);
+
+    struct iovec out2 = { b, sizeof(b) };
+    pr.out_index = 0; pr.out_offset = 0;
+    ASSERT_EQ(0u, iconv_alt_convv(cd, in.data(), 2, &out2, 1, &pr));
+    got.append(b, pr.out_total);
+    iconv_close(cd);
+    EXPECT_EQ(std::string(u8"あいう"), got);
+}
+
+/* -----------------------------------------------------------------
+ * 最後のフラグメントが文字の途中で終わる → EINVAL
+ * ----------------------------------------------------------------*/
+TEST(Convv, IncompleteAtEnd) {
+    std::string utf8 = "\xE3\x81";
+    auto in = cut(utf8, { 1, 1 });
+    char buf[8]{};
+    struct iovec out = { buf, sizeof(buf) };
+    iconv_alt_progress pr{};
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv_alt_convv(cd, in.data(), 2, &out, 1, &pr));
+    EXPECT_EQ(EINVAL, errno);
+    iconv_close(cd);
+}
+
+/* -----------------------------------------------------------------
+ * EILSEQ: progress は不正な文字の位置を指す
+ * ----------------------------------------------------------------*/
+TEST(Convv, IllegalSequencePosition) {
+    std::string utf8 = u8"ab" u8"😀";
+    auto in = cut(utf8, { 1, 5 });
+    char buf[8]{};
+    struct iovec out = { buf, sizeof(buf) };
+    iconv_alt_progress pr{};
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv_alt_convv(cd, in.data(), 2, &out, 1, &pr));
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(1, pr.in_index);
+    EXPECT_EQ(1u, pr.in_offset);
+    EXPECT_EQ(2u, pr.out_total);
+    iconv_close(cd);
+}
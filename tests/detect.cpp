@@ -0,0 +1,124 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <string>
+
+static const std::string kU8 = "日本語のテキストを自動で判定します。";
+static const std::string kEuc =
+    "\xc6\xfc\xcb\xdc\xb8\xec\xa4\xce\xa5\xc6\xa5\xad\xa5\xb9\xa5\xc8\xa4\xf2"
+    "\xbc\xab\xc6\xb0\xa4\xc7\xc8\xbd\xc4\xea\xa4\xb7\xa4\xde\xa4\xb9\xa1\xa3";
+static const std::string kIso = "\x1b$BF|K\\8l$N%F%-%9%H$r<+F0$GH=Dj$7$^$9!#\x1b(B";
+
+static std::string to_sjis(const std::string& u8)
+{
+    iconv_t cd = iconv_open("CP932", "UTF-8");
+    std::string out(u8.size(), '\0');
+    size_t written = iconv_alt_convert(cd, u8.data(), u8.size(), &out[0], out.size(), nullptr);
+    EXPECT_NE((size_t)-1, written);
+    iconv_close(cd);
+    out.resize(written);
+    return out;
+}
+
+static iconv_alt_detect_result detect(const std::string& s, int expect_rc = 0)
+{
+    iconv_alt_detect_result r;
+    EXPECT_EQ(expect_rc, iconv_alt_detect(s.data(), s.size(), &r));
+    return r;
+}
+
+TEST(Detect, JapaneseEncodings) {
+    auto r = detect("id,name\n1," + kU8 + "\n");
+    EXPECT_EQ(ICONV_ALT_DETECT_UTF8, r.best);
+    EXPECT_STREQ("UTF-8", r.name);
+    EXPECT_EQ(100u, r.confidence);
+    EXPECT_FALSE(r.valid[ICONV_ALT_DETECT_SJIS]);
+    EXPECT_EQ(18u, r.chars[ICONV_ALT_DETECT_UTF8]);
+
+    r = detect("id,name\n1," + to_sjis(kU8) + "\n");
+    EXPECT_EQ(ICONV_ALT_DETECT_SJIS, r.best);
+    EXPECT_STREQ("CP932", r.name);
+    EXPECT_FALSE(r.valid[ICONV_ALT_DETECT_UTF8]);
+    EXPECT_FALSE(r.valid[ICONV_ALT_DETECT_ISO2022JP]);
+
+    r = detect(kEuc);
+    EXPECT_EQ(ICONV_ALT_DETECT_EUCJP, r.best);
+    EXPECT_STREQ("EUC-JP", r.name);
+    EXPECT_EQ(18u, r.chars[ICONV_ALT_DETECT_EUCJP]);
+
+    r = detect("Subject: " + kIso + "\r\n");
+    EXPECT_EQ(ICONV_ALT_DETECT_ISO2022JP, r.best);
+    EXPECT_STREQ("ISO-2022-JP", r.name);
+    EXPECT_EQ(18u, r.chars[ICONV_ALT_DETECT_ISO2022JP]);
+    EXPECT_TRUE(r.valid[ICONV_ALT_DETECT_ASCII]);
+}
+
+TEST(Detect, AmbiguousBytesUseScores) {
+    /* 半角カナだけの SJIS は EUC-JP としても正しいが、点は SJIS が上 */
+    auto r = detect("\xd4\xcf\xc0\xde \xc0\xdb\xb3\xb4");
+    EXPECT_TRUE(r.valid[ICONV_ALT_DETECT_EUCJP]);
+    EXPECT_EQ(ICONV_ALT_DETECT_SJIS, r.best);
+    EXPECT_LT(r.confidence, 100u);
+
+    /* ひらがなの EUC-JP は SJIS の半角カナとしても読めるが、EUC-JP が上 */
+    r = detect("\xa4\xb3\xa4\xf3\xa4\xcb\xa4\xc1\xa4\xcf");
+    EXPECT_EQ(ICONV_ALT_DETECT_EUCJP, r.best);
+
+    /* UTF-8 の BOM */
+    r = detect("\xef\xbb\xbf" "abc");
+    EXPECT_EQ(ICONV_ALT_DETECT_UTF8, r.best);
+}
+
+TEST(Detect, AsciiAndInvalid) {
+    auto r = detect("plain ascii, no escapes\n");
+    EXPECT_EQ(ICONV_ALT_DETECT_ASCII, r.best);
+    EXPECT_STREQ("UTF-8", r.name);
+    EXPECT_EQ(100u, r.confidence);
+
+    r = detect("");
+    EXPECT_EQ(ICONV_ALT_DETECT_ASCII, r.best);
+
+    /* どの方式でも不正 */
+    r = detect(std::string("\xff\xfe\x00\x41", 4), -1);
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(ICONV_ALT_DETECT_UNKNOWN, r.best);
+    EXPECT_EQ(nullptr, r.name);
+
+    /* 入力の終わりで文字が途中 */
+    r = detect(kU8.substr(0, kU8.size() - 1), -1);
+    EXPECT_FALSE(r.valid[ICONV_ALT_DETECT_UTF8]);
+    r = detect("\x1b$B$");
+    EXPECT_FALSE(r.valid[ICONV_ALT_DETECT_ISO2022JP]);
+    EXPECT_EQ(ICONV_ALT_DETECT_ASCII, r.best);
+
+    /* 冗長な UTF-8 / サロゲート / 未定義の SJIS */
+    EXPECT_FALSE(detect("\xc0\xaf").valid[ICONV_ALT_DETECT_UTF8]);
+    EXPECT_FALSE(detect("\xed\xa0\x80", -1).valid[ICONV_ALT_DETECT_UTF8]);
+    EXPECT_FALSE(detect("\x85\x40", -1).valid[ICONV_ALT_DETECT_SJIS]);
+
+    iconv_alt_detect_result res;
+    EXPECT_EQ(-1, iconv_alt_detect("x", 1, nullptr));
+    EXPECT_EQ(EINVAL, errno);
+    EXPECT_EQ(0, iconv_alt_detect(nullptr, 0, &res));
+}
+
+TEST(Detect, StopsEarlyAndBoundsTheScan) {
+    /* 候補が 1 つに絞れたら残りは読まない */
+    std::string sj, big;
+    for (int i = 0; i < 20; ++i) sj += to_sjis(kU8) + "\n";
+    while (big.size() < (4u << 20)) big += sj;
+    auto r = detect(big);
+    EXPECT_EQ(ICONV_ALT_DETECT_SJIS, r.best);
+    EXPECT_LT(r.scanned, 4096u);
+    EXPECT_GE(r.chars[ICONV_ALT_DETECT_SJIS], (size_t)ICONV_ALT_DETECT_CONFIDENT);
+
+    /* 先頭 ICONV_ALT_DETECT_MAX_SCAN バイトしか見ない */
+    std::string ascii(ICONV_ALT_DETECT_MAX_SCAN, 'a');
+    r = detect(ascii + "\xff");
+    EXPECT_EQ(ICONV_ALT_DETECT_ASCII, r.best);
+    EXPECT_EQ((size_t)ICONV_ALT_DETECT_MAX_SCAN, r.scanned);
+
+    /* 区切りで文字が途中でも打ち切りなら不正にしない */
+    r = detect(std::string(ICONV_ALT_DETECT_MAX_SCAN - 1, 'a') + "\xe6\x97\xa5");
+    EXPECT_TRUE(r.valid[ICONV_ALT_DETECT_UTF8]);
+}
@@ -0,0 +1,193 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+/* iconv_alt_convert で一括変換。失敗は空文字列と err / stop */
+static std::string conv(const char* to, const char* from, const std::string& in,
+    size_t* stop = nullptr, int* err = nullptr)
+{
+    iconv_t cd = iconv_open(to, from);
+    EXPECT_NE((iconv_t)-1, cd) << from << " -> " << to;
+    std::string out(in.size() * 4 + 4, '\0');
+    size_t s = 0;
+    errno = 0;
+    size_t r = iconv_alt_convert(cd, in.data(), in.size(), &out[0], out.size(), &s);
+    if (err) *err = r == (size_t)-1 ? errno : 0;
+    if (stop) *stop = s;
+    iconv_close(cd);
+    out.resize(r == (size_t)-1 ? 0 : r);
+    return out;
+}
+
+/* iconv() に 1 byte ずつ入力し、出力は 3 byte (SO + 2 byte) ずつ空ける。
+   最後に iconv(cd, NULL, ...) */
+static std::string trickle(const char* to, const char* from, const std::string& in)
+{
+    iconv_t cd = iconv_open(to, from);
+    std::string out;
+    for (size_t i = 0; i <= in.size(); ++i) {
+        char* ip = const_cast<char*>(in.data() + i);
+        size_t il = 1;
+        for (;;) {
+            char buf[3];
+            char* op = buf;
+            size_t ol = sizeof(buf);
+            size_t r = i < in.size() ? iconv(cd, &ip, &il, &op, &ol) : iconv(cd, nullptr, nullptr, &op, &ol);
+            out.append(buf, sizeof(buf) - ol);
+            if (r != (size_t)-1 || errno == EINVAL) break;
+            EXPECT_EQ(E2BIG, errno);
+        }
+    }
+    iconv_close(cd);
+    return out;
+}
+
+TEST(Ebcdic, KnownCodes) {
+    /* 1 byte は EBCDIC、SO (0x0E) と SI (0x0F) の間は DBCS */
+    EXPECT_EQ("\xc1\xc2\xc3\x40\x81\x82\x83\x40\xf1\xf2\xf3\x40\x0e\x45\x62\x45\x66\x48\xe7\x0f\x25",
+              conv("IBM-939", "UTF-8", "ABC abc 123 日本語\n"));
+    EXPECT_EQ("\xc1\xc2\xc3\x40\xf1\xf2\xf3\x40\x0e\x45\x62\x45\x66\x0f\x81\x25",
+              conv("IBM-930", "UTF-8", "ABC 123 日本ｱ\n"));   // 930 の 1 byte は半角カナ
+    EXPECT_EQ("\x62\x63\x64", conv("IBM930", "UTF-8", "abc"));
+    EXPECT_EQ("\x5b", conv("CP939", "UTF-8", "$"));
+    EXPECT_EQ("\xe0", conv("CP930", "UTF-8", "$"));
+    EXPECT_EQ("日本語\n", conv("UTF-8", "IBM-939", "\x0e\x45\x62\x45\x66\x48\xe7\x0f\x25"));
+    EXPECT_EQ("\x93\xfa\x96\x7b" "A", conv("CP932", "IBM-939", "\x0e\x45\x62\x45\x66\x0f\xc1"));
+    EXPECT_EQ("\x81\x40", conv("CP932", "IBM-930", "\x0e\x40\x40\x0f"));      // 全角空白
+    for (const char* name : { "IBM-930", "IBM-939", "csIBM939" }) {
+        const std::string s = "請求書 No.123 ｶﾅ 全角ＡＢＣ 〒\n";
+        std::string host = conv(name, "UTF-8", s);
+        ASSERT_FALSE(host.empty()) << name;
+        EXPECT_EQ(s, conv("UTF-8", name, host)) << name;
+        EXPECT_EQ(conv("UTF-16LE", "UTF-8", s), conv("UTF-16LE", name, host)) << name;
+    }
+}
+
+TEST(Ebcdic, ShiftState) {
+    /* SO / SI は文字集合が変わるときだけ。DBCS で終われば SI を足す */
+    EXPECT_EQ("\x0e\x45\x62\x45\x66\x0f", conv("IBM-939", "UTF-8", "日本"));
+    EXPECT_EQ("\x0e\x45\x62\x0f\xc1\x0e\x45\x66\x0f", conv("IBM-939", "UTF-8", "日A本"));
+    EXPECT_EQ(conv("IBM-939", "UTF-8", "日A本"),
+              conv("IBM-939", "UTF-16LE", conv("UTF-16LE", "UTF-8", "日A本")));
+    /* 余分な SO / SI と空の DBCS は何も出さない */
+    EXPECT_EQ("A日", conv("UTF-8", "IBM-939", "\x0e\x0f\xc1\x0e\x0e\x45\x62\x0f\x0f"));
+    EXPECT_EQ("", conv("UTF-8", "IBM-939", "\x0e\x0f"));
+    /* 状態は呼び出しをまたいで続く */
+    iconv_t cd = iconv_open("UTF-8", "IBM-939");
+    std::string a = "\xc1\x0e\x45", b = "\x62\x0f\xc1";
+    char out[16];
+    char* op = out;
+    size_t ol = sizeof(out);
+    char* ip = &a[0];
+    size_t il = a.size();
+    EXPECT_EQ((size_t)-1, iconv(cd, &ip, &il, &op, &ol));       // 2 byte の途中で終わる
+    EXPECT_EQ(EINVAL, errno);
+    ip = &b[0]; il = b.size();
+    EXPECT_EQ(0u, iconv(cd, &ip, &il, &op, &ol));
+    EXPECT_EQ("A日A", std::string(out, sizeof(out) - ol));
+    iconv_close(cd);
+
+    /* 出力が足りなければ SO ごと書かず、状態は文字の前のまま */
+    cd = iconv_open("IBM-939", "UTF-16LE");
+    std::string in = conv("UTF-16LE", "UTF-8", "A日");
+    ip = &in[0]; il = in.size();
+    op = out; ol = 2;
+    EXPECT_EQ((size_t)-1, iconv(cd, &ip, &il, &op, &ol));
+    EXPECT_EQ(E2BIG, errno);
+    EXPECT_EQ(2u, il);
+    EXPECT_EQ(1u, ol);
+    ol = 3;
+    EXPECT_EQ(0u, iconv(cd, &ip, &il, &op, &ol));
+    ol = 0;
+    EXPECT_EQ((size_t)-1, iconv(cd, nullptr, nullptr, &op, &ol));    // SI を書く場所が無い
+    EXPECT_EQ(E2BIG, errno);
+    ol = 1;
+    EXPECT_EQ(0u, iconv(cd, nullptr, nullptr, &op, &ol));
+    EXPECT_EQ("\xc1\x0e\x45\x62\x0f", std::string(out, 5));
+    iconv_close(cd);
+}
+
+TEST(Ebcdic, EveryCodeMatchesPivot) {
+    /* 全ての 1 byte と SO/SI の間の 2 byte: UTF-8 / CP932 の核と UTF-16 を介した
+       1 文字ずつの経路が同じで、符号化すると同じコードに戻る */
+    for (const char* name : { "IBM-930", "IBM-939" }) {
+        int single = 0, dbcs = 0;
+        for (unsigned c = 0; c <= 0xFEFE; ++c) {
+            if (c == 0x0E || c == 0x0F || (c > 0xFF && c < 0x4040)) continue;
+            if (c > 0xFF && ((c & 0xFF) < 0x40 || (c & 0xFF) == 0xFF)) continue;
+            std::string code = c < 0x100 ? std::string(1, (char)c)
+                                         : std::string{ '\x0e', (char)(c >> 8), (char)(c & 0xFF), '\x0f' };
+            std::string in = "\xc1\xc2\xc3\xc4\xc5\xc6\xc7\xc8" + code + "\xc1";   // 核の 8 byte の塊に乗せる
+            int err = 0;
+            std::string u8 = conv("UTF-8", name, in, nullptr, &err);
+            if (err) { EXPECT_EQ(EILSEQ, err) << name << " " << std::hex << c; continue; }
+            ++(c < 0x100 ? single : dbcs);
+            EXPECT_EQ(conv("UTF-16LE", "UTF-8", u8), conv("UTF-16LE", name, in)) << name << " " << std::hex << c;
+            int e1 = 0, e2 = 0;
+            std::string sj = conv("CP932", name, in, nullptr, &e1);
+            EXPECT_EQ(conv("CP932", "UTF-16LE", conv("UTF-16LE", "UTF-8", u8), nullptr, &e2), sj)
+                << name << " " << std::hex << c;
+            EXPECT_EQ(e1, e2);
+            EXPECT_EQ(in, conv(name, "UTF-8", u8)) << name << " " << std::hex << c;
+        }
+        EXPECT_EQ(226, single) << name;                         // SO / SI を除く
+        EXPECT_EQ(11635, dbcs) << name;
+    }
+}
+
+TEST(Ebcdic, Errors) {
+    size_t stop = 0;
+    int err = 0;
+    conv("UTF-8", "IBM-939", "\xc1\xc2\xfe", &stop, &err);           // 1 byte の空き
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "IBM-939", "\xc1\x0e\x45\x0f", &stop, &err);       // 2 byte の途中で SI
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "IBM-930", "\xc1\x0e\x45", &stop, &err);           // 途中で終わる
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "IBM-930", "\xc1\x0e\x20\x20\x0f", &stop, &err);   // DBCS に制御文字は無い
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("IBM-939", "UTF-8", "A\xe2\x82\xac", &stop, &err);          // € は無い
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+    conv("IBM-939", "UTF-8", "A\x0e", &stop, &err);                  // 状態を壊す文字
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+    conv("IBM-930", "UTF-8", "A\xf0\x9f\x98\x80", &stop, &err);      // BMP の外
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+    conv("CP932", "IBM-930", "\xc1\x5b", &stop, &err);               // ¥ は CP932 に無い
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+}
+
+TEST(Ebcdic, Streaming) {
+    const std::string line = "ホスト抽出 ID=0042 ｶﾅ 日本語テキスト、\n";
+    std::string text;
+    while (text.size() < 600) text += line;
+    for (const char* name : { "IBM-930", "IBM-939" }) {
+        std::string host = conv(name, "UTF-8", text);
+        ASSERT_FALSE(host.empty()) << name;
+        EXPECT_EQ(text, trickle("UTF-8", name, host)) << name;
+        EXPECT_EQ(host, trickle(name, "UTF-8", text)) << name;
+        EXPECT_EQ(host, trickle(name, "UTF-16BE", conv("UTF-16BE", "UTF-8", text))) << name;
+        EXPECT_EQ(conv("CP932", "UTF-8", text), trickle("CP932", name, host)) << name;
+        EXPECT_EQ(host, conv(name, name, host)) << name;
+
+        /* 長い入力も状態を引き継いで 1 本で変換する (並列に分けない) */
+        std::string big;
+        while (big.size() < (1u << 20)) big += host;
+        iconv_t cd = iconv_open("UTF-8", name);
+        std::string out(big.size() * 3, '\0');
+        size_t n = iconv_alt_convert_parallel(cd, big.data(), big.size(), &out[0], out.size(), 4, nullptr);
+        iconv_close(cd);
+        ASSERT_NE((size_t)-1, n) << name;
+        out.resize(n);
+        EXPECT_EQ(conv("UTF-8", name, big), out) << name;
+    }
+}
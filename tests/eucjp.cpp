@@ -0,0 +1,205 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+static const std::string kU8 = "請求書ｱｲｳabc①\n表予定,ソ能～∥－￢ひらがなカタカナ纊";
+
+/* iconv_alt_convert で一括変換。失敗は空文字列と err / stop */
+static std::string conv(const char* to, const char* from, const std::string& in,
+    size_t* stop = nullptr, int* err = nullptr)
+{
+    iconv_t cd = iconv_open(to, from);
+    EXPECT_NE((iconv_t)-1, cd) << from << " -> " << to;
+    std::string out(in.size() * 4 + 4, '\0');
+    size_t s = 0;
+    errno = 0;
+    size_t r = iconv_alt_convert(cd, in.data(), in.size(), &out[0], out.size(), &s);
+    if (err) *err = r == (size_t)-1 ? errno : 0;
+    if (stop) *stop = s;
+    iconv_close(cd);
+    out.resize(r == (size_t)-1 ? 0 : r);
+    return out;
+}
+
+/* iconv() に 1 byte ずつ入力し、出力は 2 byte ずつ空ける */
+static std::string trickle(const char* to, const char* from, const std::string& in)
+{
+    iconv_t cd = iconv_open(to, from);
+    std::string out;
+    for (size_t i = 0; i < in.size(); ++i) {
+        char* ip = const_cast<char*>(in.data() + i);
+        size_t il = 1;
+        for (;;) {
+            char buf[4];
+            char* op = buf;
+            size_t ol = sizeof(buf);
+            size_t r = iconv(cd, &ip, &il, &op, &ol);
+            out.append(buf, sizeof(buf) - ol);
+            if (r != (size_t)-1 || errno == EINVAL) break;
+            EXPECT_EQ(E2BIG, errno);
+        }
+    }
+    iconv_close(cd);
+    return out;
+}
+
+/* EUC-JP の 2 byte → SJIS (テスト側の算術) */
+static std::string euc_to_sjis(unsigned e1, unsigned e2)
+{
+    unsigned j1 = e1 - 0x80, j2 = e2 - 0x80;
+    unsigned s1 = ((j1 + 1) >> 1) + (j1 <= 0x5E ? 0x70 : 0xB0);
+    unsigned s2 = j2 + ((j1 & 1) ? (j2 < 0x60 ? 0x1F : 0x20) : 0x7E);
+    return { (char)s1, (char)s2 };
+}
+
+TEST(EucJp, KnownCodes) {
+    EXPECT_EQ("\xc6\xfc\xcb\xdc\xb8\xec", conv("EUC-JP", "UTF-8", "日本語"));
+    EXPECT_EQ("\x8e\xb1" "a", conv("EUC-JP", "UTF-8", "ｱa"));
+    EXPECT_EQ("\xad\xa1", conv("EUC-JP", "UTF-8", "①"));          // NEC 特殊文字 13 区
+    EXPECT_EQ("\xf9\xa1", conv("EUC-JP", "UTF-8", "纊"));          // IBM 拡張 → NEC 選定 89 区
+    EXPECT_EQ("\xf9\xa1", conv("EUC-JP", "CP932", "\xfa\x5c"));
+    EXPECT_EQ("\xa1\xc1", conv("EUC-JP", "UTF-8", "～"));          // CP51932 と同じ FF5E
+    for (const char* name : { "EUCJP", "CP51932", "eucJP-ms", "csEUCPkdFmtJapanese", "x-euc-jp" })
+        EXPECT_EQ(kU8, conv("UTF-8", name, conv(name, "UTF-8", kU8))) << name;
+}
+
+TEST(EucJp, EveryCodeMatchesCp932) {
+    /* 2 byte の全ての組: EUC-JP の復号 = 算術で SJIS にしてからの復号 */
+    const std::string kanji = "\xb4\xc1\xbb\xfa\xa4\xab\xa4\xca";   // 核の高速経路に乗る前置き
+    for (unsigned e1 = 0xA1; e1 <= 0xFE; ++e1)
+        for (unsigned e2 = 0xA1; e2 <= 0xFE; ++e2) {
+            std::string euc = { (char)e1, (char)e2 };
+            int err_e = 0, err_s = 0;
+            std::string u8 = conv("UTF-8", "EUC-JP", "x" + euc + "y", nullptr, &err_e);
+            std::string ref = conv("UTF-8", "CP932", "x" + euc_to_sjis(e1, e2) + "y", nullptr, &err_s);
+            ASSERT_EQ(err_s, err_e) << std::hex << e1 << e2;
+            ASSERT_EQ(ref, u8) << std::hex << e1 << e2;
+            if (err_e) continue;
+            /* CP932 へは核 (算術) でも 1 文字ずつ (表) でも同じ */
+            std::string sj = conv("CP932", "UTF-8", u8);
+            EXPECT_EQ(conv("CP932", "UTF-8", conv("UTF-8", "EUC-JP", kanji)) + sj,
+                      conv("CP932", "EUC-JP", kanji + "x" + euc + "y")) << std::hex << e1 << e2;
+            /* 逆向きも: SJIS → EUC-JP は Unicode 経由と同じ */
+            EXPECT_EQ(conv("EUC-JP", "UTF-8", u8), conv("EUC-JP", "CP932", sj)) << std::hex << e1 << e2;
+        }
+    /* 全ての 2 byte SJIS: 直接でも Unicode 経由でも同じ (IBM 拡張は NEC 選定へ) */
+    for (unsigned c = 0x8140; c <= 0xFCFC; ++c) {
+        if (c >= 0xA000 && c < 0xE000) continue;
+        std::string sj = { 'a', (char)(c >> 8), (char)(c & 0xFF), 'b' };
+        int err_d = 0, err_p = 0;
+        std::string direct = conv("EUC-JP", "CP932", sj, nullptr, &err_d);
+        std::string u8 = conv("UTF-8", "CP932", sj, nullptr, &err_p);
+        if (!err_p) u8 = conv("EUC-JP", "UTF-8", u8, nullptr, &err_p);
+        ASSERT_EQ(err_p, err_d) << std::hex << c;
+        EXPECT_EQ(u8, direct) << std::hex << c;
+    }
+}
+
+/* SJIS の lead ごとに、CP932 で定義された全ての trail を並べた連続 */
+static std::vector<std::string> sjis_rows()
+{
+    std::vector<std::string> rows;
+    for (unsigned lead = 0x81; lead <= 0xFC; ++lead) {
+        if (lead >= 0xA0 && lead < 0xE0) continue;
+        std::string row;
+        for (unsigned t = 0x40; t <= 0xFC; ++t) {
+            std::string sj = { (char)lead, (char)t };
+            int err = 0;
+            conv("UTF-16LE", "CP932", sj, nullptr, &err);
+            if (!err) row += sj;
+        }
+        if (!row.empty()) rows.push_back(row);
+    }
+    return rows;
+}
+
+TEST(EucJp, RowRunsMatchPivot) {
+    /* 16 byte 以上の 2 byte の連続 (SIMD のレーンに乗る) と、記号・NEC / IBM 拡張の
+       行 (表で正規化する) が混ざる連続: 核と UTF-16 を介した 1 文字ずつの経路が同じ */
+    std::string all;
+    for (const std::string& row : sjis_rows()) {
+        for (const std::string& sj : { row, "a" + row, row + "\x81\x40" + row }) {   // 奇数の位置からも
+            int err_d = 0, err_p = 0;
+            std::string euc = conv("EUC-JP", "CP932", sj, nullptr, &err_d);
+            std::string ref = conv("EUC-JP", "UTF-16LE", conv("UTF-16LE", "CP932", sj), nullptr, &err_p);
+            ASSERT_EQ(err_p, err_d) << std::hex << (unsigned)(unsigned char)row[0];
+            EXPECT_EQ(ref, euc) << std::hex << (unsigned)(unsigned char)row[0];
+            if (err_d) continue;                        /* 95 区以降 (外字) の行など */
+            EXPECT_EQ(conv("CP932", "UTF-16LE", conv("UTF-16LE", "EUC-JP", euc)), conv("CP932", "EUC-JP", euc))
+                << std::hex << (unsigned)(unsigned char)row[0];
+        }
+        all += row;
+    }
+    /* 出力を少しずつ空けても文字の途中で切らない */
+    std::string sj = all.substr(0, 4000);
+    EXPECT_EQ(conv("EUC-JP", "CP932", sj), trickle("EUC-JP", "CP932", sj));
+    std::string euc = conv("EUC-JP", "UTF-8", kU8) + "\xb4\xc1\xbb\xfa\xb4\xc1\xbb\xfa\xb4\xc1\xbb\xfa\xb4\xc1\xbb\xfa\xa1\xa1";
+    EXPECT_EQ(conv("CP932", "EUC-JP", euc), trickle("CP932", "EUC-JP", euc));
+    /* レーンの塊の中に表せない文字があれば、その文字で止まる */
+    size_t stop = 0;
+    int err = 0;
+    std::string bad = "\xb4\xc1\xbb\xfa\xb4\xc1\xbb\xfa\xb4\xc1\xa9\xa1\xb4\xc1\xbb\xfa\xb4\xc1\xbb\xfa";   // 9 区
+    conv("CP932", "EUC-JP", bad, &stop, &err);
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(10u, stop);
+    conv("EUC-JP", "CP932", "\x8a\xbf\x8e\x9a\x8a\xbf\x8e\x9a\x8a\xbf\xf0\x40\x8a\xbf\x8e\x9a\x8a\xbf\x8e\x9a", &stop, &err);   // 外字
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(10u, stop);
+}
+
+TEST(EucJp, HalfWidthKanaAndErrors) {
+    for (unsigned k = 0xA1; k <= 0xDF; ++k) {
+        std::string euc = { '\x8e', (char)k };
+        EXPECT_EQ(std::string(1, (char)k), conv("CP932", "EUC-JP", euc));
+        EXPECT_EQ(euc, conv("EUC-JP", "CP932", std::string(1, (char)k)));
+    }
+    size_t stop = 0;
+    int err = 0;
+    conv("UTF-8", "EUC-JP", "ab\x8f\xb0\xa1", &stop, &err);        // JIS X 0212 は無い
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("CP932", "EUC-JP", "ab\x8e\xe0", &stop, &err);            // SS2 の後ろが半角カナでない
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("CP932", "EUC-JP", "\xc6\xfc\xa9\xa1", &stop, &err);      // 9 区は未定義
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "EUC-JP", "\xc6\xfc\xc6", &stop, &err);          // 途中で終わる
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(2u, stop);
+    conv("EUC-JP", "UTF-8", "a\xf0\x9f\x98\x80", &stop, &err);     // BMP の外
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+    conv("EUC-JP", "CP932", "a\x80" "b", &stop, &err);             // CP932 に無い 0x80
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+}
+
+TEST(EucJp, StreamingAndParallel) {
+    std::string text;
+    while (text.size() < 600) text += kU8;
+    std::string euc = conv("EUC-JP", "UTF-8", text);
+    std::string sj = conv("CP932", "UTF-8", text);
+    EXPECT_EQ(text, trickle("UTF-8", "EUC-JP", euc));
+    EXPECT_EQ(euc, trickle("EUC-JP", "UTF-8", text));
+    EXPECT_EQ(sj, trickle("CP932", "EUC-JP", euc));
+    EXPECT_EQ(euc, trickle("EUC-JP", "CP932", sj));
+
+    /* ASCII の無い長い 2 byte の連続 (走査窓より長い) でも文字の途中で切らない */
+    std::string block;
+    for (int k = 0; k < 5000; ++k) block += "\xb4\xc1";
+    block += "a" + euc;
+    std::string big;
+    while (big.size() < (1u << 20)) big += block;
+    for (const char* to : { "UTF-8", "CP932", "UTF-16LE" }) {
+        iconv_t cd = iconv_open(to, "EUC-JP");
+        std::string out(big.size() * 3, '\0');
+        size_t n = iconv_alt_convert_parallel(cd, big.data(), big.size(), &out[0], out.size(), 4, nullptr);
+        iconv_close(cd);
+        ASSERT_NE((size_t)-1, n) << to;
+        out.resize(n);
+        EXPECT_EQ(conv(to, "EUC-JP", big), out) << to;
+    }
+}
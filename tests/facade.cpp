@@ -0,0 +1,123 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.hpp>
+#include <array>
+#include <cstddef>
+#include <memory_resource>
+#include <string>
+#include <type_traits>
+
+using iconv_alt::converter;
+
+/* -----------------------------------------------------------------
+ * 短い入力も計測経由の長い入力も同じ結果になる
+ * ----------------------------------------------------------------*/
+TEST(Facade, ConvertSmallAndLarge) {
+    converter to8("UTF-8", "SHIFT_JIS");
+    converter tosj("SHIFT_JIS", "UTF-8");
+
+    auto a = to8.convert("\x82\xa0\x82\xa2\x82\xa4");              // あいう
+    ASSERT_TRUE(a);
+    EXPECT_EQ(std::string("あいう"), *a);
+
+    std::string big_u8, big_sj;
+    for (int i = 0; i < 500; ++i) {
+        big_u8 += "漢字abc";
+        big_sj += "\x8a\xbf\x8e\x9a" "abc";
+    }
+    auto m = tosj.measure(big_u8);
+    ASSERT_TRUE(m);
+    EXPECT_EQ(big_sj.size(), *m);
+
+    auto b = tosj.convert(big_u8);
+    ASSERT_TRUE(b.has_value());
+    EXPECT_EQ(big_sj, b.value());
+    EXPECT_EQ(big_u8, to8.convert(big_sj).value());
+}
+
+/* -----------------------------------------------------------------
+ * SSO に収まる出力はヒープを使わない
+ * ----------------------------------------------------------------*/
+TEST(Facade, SmallOutputStaysInSso) {
+    converter tosj("SHIFT_JIS", "UTF-8");
+    auto s = tosj.convert("東京");
+    ASSERT_TRUE(s);
+    EXPECT_EQ(4u, s->size());
+    EXPECT_EQ(std::string().capacity(), s->capacity());
+}
+
+/* -----------------------------------------------------------------
+ * エラーは errc と入力オフセットを持つ
+ * ----------------------------------------------------------------*/
+TEST(Facade, ErrorCarriesOffset) {
+    converter tosj("SHIFT_JIS", "UTF-8");
+
+    auto bad = tosj.convert("ab😀");
+    ASSERT_FALSE(bad);
+    EXPECT_EQ(std::errc::illegal_byte_sequence, bad.error().code);
+    EXPECT_EQ(2u, bad.error().offset);
+    EXPECT_THROW(bad.value(), std::system_error);
+
+    auto cut = tosj.measure("abc\xe3\x81");                         // あ の途中で終わる
+    ASSERT_FALSE(cut);
+    EXPECT_EQ(std::errc::invalid_argument, cut.error().code);
+    EXPECT_EQ(3u, cut.error().offset);
+
+    std::string longbad(200, 'x');
+    longbad += "\xff";
+    auto lb = tosj.convert(longbad);
+    ASSERT_FALSE(lb);
+    EXPECT_EQ(200u, lb.error().offset);
+}
+
+/* -----------------------------------------------------------------
+ * converter は move-only、移動元は無効になる
+ * ----------------------------------------------------------------*/
+TEST(Facade, MoveOnly) {
+    static_assert(!std::is_copy_constructible<converter>::value, "copyable");
+    static_assert(std::is_nothrow_move_constructible<converter>::value, "move");
+
+    auto r = converter::open("UTF-8", "CP932");
+    ASSERT_TRUE(r);
+    converter a = std::move(*r);
+    EXPECT_FALSE(r->valid());
+    EXPECT_TRUE(a.valid());
+
+    converter b;
+    b = std::move(a);
+    EXPECT_FALSE(a.valid());
+    EXPECT_EQ("abc", b.convert("abc").value());
+
+    EXPECT_FALSE(converter::open("UTF-8", "KLINGON"));
+    EXPECT_THROW(converter("UTF-8", "KLINGON"), std::system_error);
+}
+
+/* -----------------------------------------------------------------
+ * pmr::string へ追記: アリーナからだけ確保する
+ * ----------------------------------------------------------------*/
+TEST(Facade, PmrArena) {
+    converter to8("UTF-8", "SHIFT_JIS");
+    std::array<std::byte, 4096> arena;
+    std::pmr::monotonic_buffer_resource mr(arena.data(), arena.size(),
+                                           std::pmr::null_memory_resource());
+
+    std::pmr::string out(&mr);
+    std::string sj;
+    for (int i = 0; i < 100; ++i) sj += "\x83\x65\x83\x58\x83\x67";  // テスト
+    auto n = to8.convert_into(sj, out);
+    ASSERT_TRUE(n);
+    EXPECT_EQ(900u, *n);
+
+    const std::byte tail[] = { std::byte{0x81}, std::byte{0x42} };  // 。
+    n = to8.convert_into(std::span<const std::byte>(tail), out);
+    ASSERT_TRUE(n);
+    EXPECT_EQ(903u, out.size());
+    EXPECT_EQ(std::string("。"), std::string(out.substr(900)));
+
+    n = to8.convert_into(std::string_view("\x85\x40"), out);        // 未定義
+    ASSERT_FALSE(n);
+    EXPECT_EQ(903u, out.size());                                    // 追記前に戻る
+
+    auto p = to8.convert("\x83\x65", &mr);
+    ASSERT_TRUE(p);
+    EXPECT_EQ(&mr, p->get_allocator().resource());
+}
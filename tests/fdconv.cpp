@@ -0,0 +1,179 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.hpp>
+#include <atomic>
+#include <cerrno>
+#include <chrono>
+#include <cstdio>
+#include <string>
+#include <thread>
+#ifndef _WIN32
+#  include <unistd.h>
+#endif
+
+static std::string sample_utf8()
+{
+    std::string s;
+    for (int i = 0; i < 400; ++i)
+        s += "行" + std::to_string(i) + ": 請求書ｱｲｳ①\n";
+    return s;
+}
+
+/* 内容を書いて先頭に戻した一時ファイル */
+static FILE* temp_with(const std::string& s)
+{
+    FILE* f = std::tmpfile();
+    std::fwrite(s.data(), 1, s.size(), f);
+    std::fflush(f);
+    std::rewind(f);
+    return f;
+}
+
+static std::string read_all(FILE* f)
+{
+    std::fflush(f);
+    std::rewind(f);
+    std::string s;
+    char buf[4096];
+    size_t n;
+    while ((n = std::fread(buf, 1, sizeof(buf), f)) > 0) s.append(buf, n);
+    return s;
+}
+
+static int run_fd(const char* to, const char* from, FILE* in, FILE* out,
+                  iconv_alt_fd_options* opt)
+{
+    iconv_t cd = iconv_open(to, from);
+    int rc = iconv_alt_convert_fd(cd, fileno(in), fileno(out), opt);
+    int e = errno;
+    iconv_close(cd);
+    errno = e;
+    return rc;
+}
+
+/* -----------------------------------------------------------------
+ * ブロック境界で文字が分断されても、スレッドの有無によらず同じ結果
+ * ----------------------------------------------------------------*/
+TEST(FdConv, RoundTripAcrossBlocks) {
+    const std::string u8 = sample_utf8();
+    const std::string sj = iconv_alt::converter("CP932", "UTF-8").convert(u8).value();
+
+    for (unsigned flags : {0u, ICONV_ALT_FD_NO_THREADS}) {
+        for (size_t block : {64, 65, 1000, 0}) {
+            iconv_alt_fd_options opt{};
+            opt.block_size = block;
+            opt.flags = flags;
+
+            FILE* in = temp_with(sj);
+            FILE* mid = std::tmpfile();
+            ASSERT_EQ(0, run_fd("UTF-8", "CP932", in, mid, &opt)) << block;
+            EXPECT_EQ(sj.size(), opt.in_total);
+            EXPECT_EQ(u8.size(), opt.out_total);
+            EXPECT_EQ(u8, read_all(mid)) << "block " << block << " flags " << flags;
+
+            std::rewind(mid);
+            FILE* back = std::tmpfile();
+            ASSERT_EQ(0, run_fd("CP932", "UTF-8", mid, back, &opt));
+            EXPECT_EQ(sj, read_all(back));
+            std::fclose(in); std::fclose(mid); std::fclose(back);
+        }
+    }
+}
+
+/* -----------------------------------------------------------------
+ * 全 ASCII のブロックは変換せずにそのまま書く
+ * ----------------------------------------------------------------*/
+TEST(FdConv, AsciiBlocksForwarded) {
+    std::string text(10000, 'a');
+    text += "請求書";                         // 最後のブロックだけ非 ASCII
+    FILE* in = temp_with(text);
+    FILE* out = std::tmpfile();
+    iconv_alt_fd_options opt{};
+    opt.block_size = 1000;
+    ASSERT_EQ(0, run_fd("CP932", "UTF-8", in, out, &opt));
+    EXPECT_EQ(10u, opt.ascii_blocks);
+    EXPECT_EQ(std::string(10000, 'a') + "\x90\xbf\x8b\x81\x8f\x91", read_all(out));
+    std::fclose(in); std::fclose(out);
+}
+
+/* -----------------------------------------------------------------
+ * エラー: 手前までは書き出し、in_total が停止位置
+ * ----------------------------------------------------------------*/
+TEST(FdConv, IllegalSequenceStopsAtOffset) {
+    std::string text(300, 'x');
+    text += "\x82\xa0";                       // あ
+    text += "\x81";                           // 不正な trail
+    text += "\x7f";
+    text += std::string(300, 'y');
+    FILE* in = temp_with(text);
+    FILE* out = std::tmpfile();
+    iconv_alt_fd_options opt{};
+    opt.block_size = 128;
+    EXPECT_EQ(-1, run_fd("UTF-8", "CP932", in, out, &opt));
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(302u, opt.in_total);
+    EXPECT_EQ(std::string(300, 'x') + "あ", read_all(out));
+    std::fclose(in); std::fclose(out);
+}
+
+TEST(FdConv, TruncatedTailIsEinval) {
+    FILE* in = temp_with("abc\xe8\xab");      // 「請」の途中で EOF
+    FILE* out = std::tmpfile();
+    iconv_alt_fd_options opt{};
+    EXPECT_EQ(-1, run_fd("CP932", "UTF-8", in, out, &opt));
+    EXPECT_EQ(EINVAL, errno);
+    EXPECT_EQ("abc", read_all(out));
+    std::fclose(in); std::fclose(out);
+}
+
+#ifndef _WIN32
+/* -----------------------------------------------------------------
+ * パイプ: read が短く返っても繋がる
+ * ----------------------------------------------------------------*/
+TEST(FdConv, PipeInput) {
+    const std::string sj = iconv_alt::converter("CP932", "UTF-8").convert(sample_utf8()).value();
+    int p[2];
+    ASSERT_EQ(0, pipe(p));
+    std::thread feeder([&] {
+        for (size_t i = 0; i < sj.size(); i += 7)      // 7 byte ずつ (文字を分断)
+            ASSERT_GT(write(p[1], sj.data() + i, std::min<size_t>(7, sj.size() - i)), 0);
+        close(p[1]);
+    });
+    FILE* out = std::tmpfile();
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    EXPECT_EQ(0, iconv_alt_convert_fd(cd, p[0], fileno(out), nullptr));
+    iconv_close(cd);
+    feeder.join();
+    close(p[0]);
+    EXPECT_EQ(sample_utf8(), read_all(out));
+    std::fclose(out);
+}
+
+/* 不正な入力で止まったら、書き手がパイプを開けたままでもすぐ戻る
+   (reader の read() の完了を待たない) */
+TEST(FdConv, IllegalSequenceOnOpenPipeReturnsPromptly) {
+    int p[2];
+    ASSERT_EQ(0, pipe(p));
+    ASSERT_EQ(3, write(p[1], "a\xff" "b", 3));
+    FILE* out = std::tmpfile();
+    iconv_t cd = iconv_open("CP932", "UTF-8");
+    int rc = 0, e = 0;
+    std::atomic<bool> returned{false};
+    std::thread conv([&] {
+        rc = iconv_alt_convert_fd(cd, p[0], fileno(out), nullptr);
+        e = errno;
+        returned = true;
+    });
+    for (int i = 0; i < 500 && !returned; ++i)
+        std::this_thread::sleep_for(std::chrono::milliseconds(10));
+    bool prompt = returned;
+    close(p[1]);                                   // 戻っていなければここで解放する
+    conv.join();
+    iconv_close(cd);
+    close(p[0]);
+    EXPECT_TRUE(prompt);
+    EXPECT_EQ(-1, rc);
+    EXPECT_EQ(EILSEQ, e);
+    EXPECT_EQ("a", read_all(out));
+    std::fclose(out);
+}
+#endif
@@ -0,0 +1,258 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <iconv_alt_stream.hpp>
+#include <cerrno>
+#include <cstdio>
+#include <sstream>
+#include <string>
+
+#define ESC "\x1b"
+
+static const std::string kU8  = "請求書abc①\n表予定,ソ能～∥－￢ひらがなカタカナ纊 §×÷\n";
+static const std::string kU8k = kU8 + "ｱｲｳﾞ｡ﾟ漢ｶﾅ";                // 半角カナ入り (CP50221)
+
+/* iconv_alt_convert で一括変換。失敗は空文字列と err / stop */
+static std::string conv(const char* to, const char* from, const std::string& in,
+    size_t* stop = nullptr, int* err = nullptr)
+{
+    iconv_t cd = iconv_open(to, from);
+    EXPECT_NE((iconv_t)-1, cd) << from << " -> " << to;
+    std::string out(in.size() * 5 + 8, '\0');
+    size_t s = 0;
+    errno = 0;
+    size_t r = iconv_alt_convert(cd, in.data(), in.size(), &out[0], out.size(), &s);
+    if (err) *err = r == (size_t)-1 ? errno : 0;
+    if (stop) *stop = s;
+    iconv_close(cd);
+    out.resize(r == (size_t)-1 ? 0 : r);
+    return out;
+}
+
+/* iconv() に 1 byte ずつ入力し (エスケープも分断される)、出力は 8 byte ずつ空ける。
+   最後に iconv(cd, NULL, ...) で出力の状態を戻す */
+static std::string trickle(const char* to, const char* from, const std::string& in)
+{
+    iconv_t cd = iconv_open(to, from);
+    std::string out;
+    char buf[8];
+    for (size_t i = 0; i < in.size(); ++i) {
+        char* ip = const_cast<char*>(in.data() + i);
+        size_t il = 1;
+        for (;;) {
+            char* op = buf;
+            size_t ol = sizeof(buf);
+            size_t r = iconv(cd, &ip, &il, &op, &ol);
+            out.append(buf, sizeof(buf) - ol);
+            if (r != (size_t)-1 || errno == EINVAL) break;
+            EXPECT_EQ(E2BIG, errno);
+        }
+    }
+    char* op = buf;
+    size_t ol = sizeof(buf);
+    EXPECT_EQ(0u, iconv(cd, nullptr, nullptr, &op, &ol));
+    out.append(buf, sizeof(buf) - ol);
+    iconv_close(cd);
+    return out;
+}
+
+TEST(Iso2022Jp, KnownBytesAndMinimalEscapes) {
+    EXPECT_EQ(ESC "$BF|K\\8l" ESC "(B", conv("ISO-2022-JP", "UTF-8", "日本語"));
+    EXPECT_EQ("abc", conv("ISO-2022-JP", "UTF-8", "abc"));                 // ASCII だけならエスケープ無し
+    EXPECT_EQ("a" ESC "$BF|" ESC "(Bb" ESC "$BK\\8l" ESC "(B\n",
+              conv("ISO-2022-JP", "UTF-8", "a日b本語\n"));
+    EXPECT_EQ(ESC "$B-!" ESC "(B", conv("ISO-2022-JP", "UTF-8", "①"));    // NEC 特殊文字 13 区
+    EXPECT_EQ(ESC "$By!" ESC "(B", conv("ISO-2022-JP", "CP932", "\xfa\x5c"));   // IBM 拡張 → 89 区
+    EXPECT_EQ(ESC "(I1" ESC "$BF|" ESC "(B", conv("CP50221", "UTF-8", "ｱ日"));
+    EXPECT_EQ("日本語", conv("UTF-8", "ISO-2022-JP", ESC "$@F|K\\8l" ESC "(J"));   // 旧 JIS / ローマ字
+    EXPECT_EQ("a\\~ｱ", conv("UTF-8", "CP50221", ESC "(Ja\\~" ESC "(I1"));
+    EXPECT_EQ("a" ESC "$BF|" ESC "(B", conv("ISO-2022-JP", "CP932", "a\x93\xfa"));
+    for (const char* name : { "ISO2022JP", "csISO2022JP", "cp50221", "ISO-2022-JP-MS" })
+        EXPECT_EQ(kU8, conv("UTF-8", name, conv(name, "UTF-8", kU8))) << name;
+    EXPECT_EQ(kU8k, conv("UTF-8", "CP50221", conv("CP50221", "UTF-8", kU8k)));
+}
+
+TEST(Iso2022Jp, EveryCodeMatchesEucJp) {
+    /* 区点の全ての組: ISO-2022-JP の復号 = 同じ区点の EUC-JP の復号 */
+    for (unsigned j1 = 0x21; j1 <= 0x7E; ++j1)
+        for (unsigned j2 = 0x21; j2 <= 0x7E; ++j2) {
+            std::string jis = std::string(ESC "$B") + (char)j1 + (char)j2 + "F|" ESC "(Bx";
+            std::string euc = std::string{ (char)(j1 | 0x80), (char)(j2 | 0x80) } + "\xc6\xfc" "x";
+            int err_j = 0, err_e = 0;
+            std::string u8 = conv("UTF-8", "ISO-2022-JP", jis, nullptr, &err_j);
+            ASSERT_EQ(conv("UTF-8", "EUC-JP", euc, nullptr, &err_e), u8) << std::hex << j1 << j2;
+            ASSERT_EQ(err_e, err_j) << std::hex << j1 << j2;
+            if (err_j) continue;
+            /* CP932 へは核でも Unicode 経由でも同じ */
+            EXPECT_EQ(conv("CP932", "UTF-8", u8), conv("CP932", "ISO-2022-JP", jis)) << std::hex << j1 << j2;
+            /* 符号化し直すと同じ区点 (NEC / IBM の重複は EUC-JP と同じ側へ) */
+            EXPECT_EQ(conv("EUC-JP", "UTF-8", u8), conv("EUC-JP", "ISO-2022-JP", conv("ISO-2022-JP", "UTF-8", u8)));
+        }
+    /* 半角カナ: ESC ( I の 0x21–0x5F は U+FF61–FF9F */
+    for (unsigned k = 0x21; k <= 0x5F; ++k) {
+        std::string jis = std::string(ESC "(I") + (char)k;
+        EXPECT_EQ(std::string(1, (char)(k + 0x80)), conv("CP932", "CP50221", jis));
+        EXPECT_EQ(conv("UTF-8", "CP932", std::string(1, (char)(k + 0x80))), conv("UTF-8", "CP50221", jis));
+        EXPECT_EQ(jis + ESC "(B", conv("CP50221", "CP932", std::string(1, (char)(k + 0x80))));
+    }
+}
+
+TEST(Iso2022Jp, FromCp932MatchesPivot) {
+    /* CP932 → ISO-2022-JP / CP50221 の核: 全ての 2 byte SJIS と lead ごとの長い連続
+       (SIMD のレーンに乗る) で、UTF-16 を介した 1 文字ずつの経路と同じ */
+    std::string all;
+    for (unsigned lead = 0x81; lead <= 0xFC; ++lead) {
+        if (lead >= 0xA0 && lead < 0xE0) continue;
+        std::string row;
+        for (unsigned t = 0x40; t <= 0xFC; ++t) {
+            std::string sj = { 'a', (char)lead, (char)t, 'b' };
+            int err_d = 0, err_p = 0;
+            std::string direct = conv("ISO-2022-JP", "CP932", sj, nullptr, &err_d);
+            std::string u16 = conv("UTF-16LE", "CP932", sj, nullptr, &err_p);
+            std::string ref = err_p ? "" : conv("ISO-2022-JP", "UTF-16LE", u16, nullptr, &err_p);
+            ASSERT_EQ(err_p, err_d) << std::hex << lead << t;
+            EXPECT_EQ(ref, direct) << std::hex << lead << t;
+            if (!err_d) row += sj.substr(1, 2);
+        }
+        for (const char* to : { "ISO-2022-JP", "CP50221" })
+            EXPECT_EQ(conv(to, "UTF-16LE", conv("UTF-16LE", "CP932", "x" + row)), conv(to, "CP932", "x" + row))
+                << to << " " << std::hex << lead;
+        all += row + "\n";
+    }
+    /* 半角カナは CP50221 だけ。エスケープは集合が変わるときだけ */
+    EXPECT_EQ("a" ESC "$BF|" ESC "(I1" ESC "(Bb", conv("CP50221", "CP932", "a\x93\xfa\xb1" "b"));
+    size_t stop = 0;
+    int err = 0;
+    conv("ISO-2022-JP", "CP932", "a\x93\xfa\xb1", &stop, &err);
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(3u, stop);
+    conv("ISO-2022-JP", "CP932", "a\x1b", &stop, &err);
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+    /* 出力を 8 byte ずつ空けても、エスケープと文字を分けない */
+    std::string sj = all.substr(0, 6000) + conv("CP932", "UTF-8", kU8k);
+    EXPECT_EQ(conv("CP50221", "CP932", sj), trickle("CP50221", "CP932", sj));
+    EXPECT_EQ(conv("UTF-16LE", "CP932", sj), conv("UTF-16LE", "CP50221", conv("CP50221", "CP932", sj)));
+}
+
+TEST(Iso2022Jp, EscapesSplitAcrossCalls) {
+    std::string text;
+    while (text.size() < 600) text += kU8;
+    std::string jis = conv("ISO-2022-JP", "UTF-8", text);
+    EXPECT_EQ(jis, trickle("ISO-2022-JP", "UTF-8", text));
+    EXPECT_EQ(text, trickle("UTF-8", "ISO-2022-JP", jis));
+    EXPECT_EQ(conv("CP932", "UTF-8", text), trickle("CP932", "ISO-2022-JP", jis));
+    EXPECT_EQ(conv("UTF-16LE", "UTF-8", text), trickle("UTF-16LE", "ISO-2022-JP", jis));
+    std::string k = conv("CP50221", "UTF-8", kU8k + kU8k);
+    EXPECT_EQ(kU8k + kU8k, trickle("UTF-8", "CP50221", k));
+    EXPECT_EQ(k, trickle("CP50221", "UTF-8", kU8k + kU8k));
+
+    /* 出力不足で止まっても状態は文字の前へ戻り、エスケープが重複・欠落しない */
+    iconv_t cd = iconv_open("ISO-2022-JP", "UTF-8");
+    std::string in = "a日";
+    char* ip = &in[0];
+    size_t il = in.size();
+    char buf[4];
+    char* op = buf;
+    size_t ol = sizeof(buf);
+    EXPECT_EQ((size_t)-1, iconv(cd, &ip, &il, &op, &ol));
+    EXPECT_EQ(E2BIG, errno);
+    EXPECT_EQ(3u, ol);                                       // "a" だけ
+    std::string out(buf, 1);
+    char big[16];
+    op = big; ol = sizeof(big);
+    EXPECT_EQ(0u, iconv(cd, &ip, &il, &op, &ol));
+    EXPECT_EQ(0u, iconv(cd, nullptr, nullptr, &op, &ol));
+    out.append(big, sizeof(big) - ol);
+    EXPECT_EQ("a" ESC "$BF|" ESC "(B", out);
+    iconv_close(cd);
+}
+
+TEST(Iso2022Jp, Errors) {
+    size_t stop = 0;
+    int err = 0;
+    conv("UTF-8", "ISO-2022-JP", "ab" ESC "$(DF|", &stop, &err);          // JIS X 0212 は無い
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "ISO-2022-JP", "ab\xa4\xa2", &stop, &err);                // 8 bit
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("CP932", "ISO-2022-JP", ESC "$BF|)!", &stop, &err);              // 9 区は未定義
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(5u, stop);
+    conv("UTF-8", "ISO-2022-JP", ESC "$BF|F", &stop, &err);               // 区点の途中で終わる
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(5u, stop);
+    conv("UTF-8", "ISO-2022-JP", "ab" ESC "$", &stop, &err);              // エスケープの途中で終わる
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "ISO-2022-JP", ESC "(I`", &stop, &err);                 // 片仮名の範囲外
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(3u, stop);
+    conv("ISO-2022-JP", "UTF-8", "a日ｱ", &stop, &err);                    // ISO-2022-JP に半角カナは無い
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(4u, stop);
+    conv("ISO-2022-JP", "UTF-8", "a" ESC "b", &stop, &err);               // ESC そのものは書けない
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+    EXPECT_EQ("\n\t", conv("UTF-8", "ISO-2022-JP", ESC "$B\n\t"));        // 制御文字はどこでも通す
+}
+
+TEST(Iso2022Jp, ResetAtEndOfOutput) {
+    /* iconv(cd, NULL, ...) は ESC ( B を書く。入らなければ E2BIG で状態はそのまま */
+    iconv_t cd = iconv_open("ISO-2022-JP", "UTF-8");
+    std::string in = "日";
+    char* ip = &in[0];
+    size_t il = in.size();
+    char buf[16];
+    char* op = buf;
+    size_t ol = sizeof(buf);
+    EXPECT_EQ(0u, iconv(cd, &ip, &il, &op, &ol));
+    size_t room = 2;
+    char* tail = op;
+    EXPECT_EQ((size_t)-1, iconv(cd, nullptr, nullptr, &tail, &room));
+    EXPECT_EQ(E2BIG, errno);
+    EXPECT_EQ(0u, iconv(cd, nullptr, nullptr, &op, &ol));
+    EXPECT_EQ(ESC "$BF|" ESC "(B", std::string(buf, sizeof(buf) - ol));
+    EXPECT_EQ(0u, iconv(cd, nullptr, nullptr, &op, &ol));       // 既に ASCII なら何も書かない
+    EXPECT_EQ(0u, iconv(cd, nullptr, nullptr, nullptr, nullptr));
+    iconv_close(cd);
+
+    /* 出力を小さく区切る API でも終わりのエスケープまで出る */
+    std::string jis = conv("ISO-2022-JP", "UTF-8", kU8);
+    cd = iconv_open("ISO-2022-JP", "UTF-8");
+    EXPECT_EQ(jis.size(), iconv_alt_measure(cd, kU8.data(), kU8.size(), nullptr));
+    std::string small(jis.size() - 1, '\0');
+    EXPECT_EQ((size_t)-1, iconv_alt_convert(cd, kU8.data(), kU8.size(), &small[0], small.size(), nullptr));
+    EXPECT_EQ(E2BIG, errno);
+    iconv_close(cd);
+
+    /* fd: 入力の終わりで状態を戻す */
+    std::string u8 = "表" + kU8 + "終";
+    FILE* fin = std::tmpfile();
+    FILE* fout = std::tmpfile();
+    std::fwrite(u8.data(), 1, u8.size(), fin);
+    std::rewind(fin);
+    cd = iconv_open("ISO-2022-JP", "UTF-8");
+    EXPECT_EQ(0, iconv_alt_convert_fd(cd, fileno(fin), fileno(fout), nullptr));
+    iconv_close(cd);
+    std::rewind(fout);
+    std::string got;
+    char rb[4096];
+    size_t n;
+    while ((n = std::fread(rb, 1, sizeof(rb), fout)) > 0) got.append(rb, n);
+    std::fclose(fin);
+    std::fclose(fout);
+    EXPECT_EQ(conv("ISO-2022-JP", "UTF-8", u8), got);
+
+    /* iostream: 読み出しは EOF で、書き込みは締めるときに ESC ( B */
+    std::istringstream src(u8);
+    iconv_alt::transcoding_istream is(src, "ISO-2022-JP", "UTF-8");
+    std::string read((std::istreambuf_iterator<char>(is)), std::istreambuf_iterator<char>());
+    EXPECT_EQ(got, read);
+    std::ostringstream sink;
+    {
+        iconv_alt::transcoding_ostream os(sink, "ISO-2022-JP", "UTF-8");
+        os << u8;
+    }
+    EXPECT_EQ(got, sink.str());
+}
@@ -0,0 +1,54 @@
+#include <gtest/gtest.h>
+#include <iconv_alt_literal.hpp>
+#include <iconv.h>
+#include <string>
+
+using namespace iconv_alt::literals;
+
+/* ここまで来ればコンパイル時に変換済み */
+constexpr auto kInvoice = u8"請求書"_sjis;
+static_assert(kInvoice.size() == 6, "3 文字 × 2 byte");
+static_assert(kInvoice[0] == '\x90' && kInvoice[1] == '\xbf', "請 = 0x90BF");
+
+static_assert(iconv_alt::sjis_representable(u8"①ｱ～"), "NEC 特殊文字・半角カナ・全角チルダ");
+static_assert(!iconv_alt::sjis_representable(u8"😀"), "BMP 外");
+static_assert(!iconv_alt::sjis_representable(u8"한"), "ハングル");
+
+static std::string bytes(const auto& a) { return std::string(a.begin(), a.end()); }
+
+static std::string via_iconv(const std::string& u8)
+{
+    iconv_t cd = iconv_open("CP932", "UTF-8");
+    std::string out(u8.size(), '\0');
+    char* ip = const_cast<char*>(u8.data());
+    size_t il = u8.size();
+    char* op = &out[0];
+    size_t ol = out.size();
+    EXPECT_EQ(0u, iconv(cd, &ip, &il, &op, &ol));
+    iconv_close(cd);
+    out.resize(out.size() - ol);
+    return out;
+}
+
+/* -----------------------------------------------------------------
+ * _sjis / sjis_literal<> は iconv() と同じバイト列
+ * ----------------------------------------------------------------*/
+TEST(Literal, MatchesIconv) {
+    constexpr auto a = u8"お支払期限：２０２５年３月末日（ｶﾅ）①"_sjis;
+    EXPECT_EQ(via_iconv("お支払期限：２０２５年３月末日（ｶﾅ）①"), bytes(a));
+
+    constexpr auto b = iconv_alt::sjis_literal<"髙﨑 ∵ ￢ ⅰ">();       // 重複コードは MS と同じ選択
+    EXPECT_EQ(via_iconv("髙﨑 ∵ ￢ ⅰ"), bytes(b));
+    EXPECT_EQ(std::string("\xfb\xfc\xfa\xb1 \x81\xe6 \x81\xca \xfa\x40"), bytes(b));
+}
+
+/* -----------------------------------------------------------------
+ * 終端 NUL は含まない / 空文字列・ASCII
+ * ----------------------------------------------------------------*/
+TEST(Literal, ExactLength) {
+    constexpr auto empty = u8""_sjis;
+    static_assert(empty.size() == 0, "empty");
+    constexpr auto ascii = "abc\n"_sjis;
+    static_assert(ascii.size() == 4, "ascii");
+    EXPECT_EQ("abc\n", bytes(ascii));
+}
@@ -0,0 +1,185 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.hpp>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#if !defined(_WIN32)
+#  include <sys/stat.h>
+#  include <unistd.h>
+#endif
+
+/* 4 チャンク以上に分かれる大きさの UTF-8 (newline = false なら 0x40 未満を含まない) */
+static std::string big_utf8(bool newline)
+{
+    std::string s;
+    int i = 0;
+    while (s.size() < 4 * ICONV_ALT_PARALLEL_MIN_CHUNK + 1000) {
+        s += "請求書ｱｲｳ①表予";
+        if (newline && ++i % 7 == 0) s += "\n";
+    }
+    return s;
+}
+
+static std::string to_sjis(const std::string& u8)
+{
+    return iconv_alt::converter("CP932", "UTF-8").convert(u8).value();
+}
+
+static size_t run_parallel(const char* to, const char* from, const std::string& in,
+                           std::string& out, unsigned threads, size_t* stop)
+{
+    iconv_t cd = iconv_open(to, from);
+    size_t r = iconv_alt_convert_parallel(cd, in.data(), in.size(), &out[0], out.size(),
+                                          threads, stop);
+    int e = errno;
+    iconv_close(cd);
+    errno = e;
+    if (r != (size_t)-1) out.resize(r);
+    return r;
+}
+
+/* -----------------------------------------------------------------
+ * 逐次変換と同じバイト列 (改行あり / 改行なし = 後方再同期)
+ * ----------------------------------------------------------------*/
+TEST(Parallel, MatchesSequential) {
+    for (bool nl : {true, false}) {
+        const std::string u8 = big_utf8(nl);
+        const std::string sj = to_sjis(u8);
+        for (unsigned threads : {0u, 1u, 3u, 4u, 7u}) {
+            std::string out(u8.size(), '\0');
+            ASSERT_NE((size_t)-1, run_parallel("UTF-8", "CP932", sj, out, threads, nullptr));
+            EXPECT_EQ(u8, out) << "nl " << nl << " threads " << threads;
+
+            std::string back(sj.size(), '\0');
+            ASSERT_NE((size_t)-1, run_parallel("CP932", "UTF-8", u8, back, threads, nullptr));
+            EXPECT_EQ(sj, back) << "nl " << nl << " threads " << threads;
+        }
+    }
+}
+
+/* -----------------------------------------------------------------
+ * エラー位置は逐次変換と同じ
+ * ----------------------------------------------------------------*/
+TEST(Parallel, ErrorOffsetMatchesSequential) {
+    std::string sj = to_sjis(big_utf8(false));
+    size_t bad = sj.find("\x90\xbf", sj.size() * 3 / 4);   // 「請」
+    sj[bad + 1] = '\x7f';                                 // trail を不正に
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    size_t seq_stop = 0;
+    ASSERT_EQ((size_t)-1, iconv_alt_measure(cd, sj.data(), sj.size(), &seq_stop));
+    iconv_close(cd);
+
+    std::string out(sj.size() * 3, '\0');
+    size_t stop = 0;
+    EXPECT_EQ((size_t)-1, run_parallel("UTF-8", "CP932", sj, out, 4, &stop));
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(seq_stop, stop);
+
+    /* 末尾が文字の途中 */
+    std::string u8 = big_utf8(true);
+    u8.resize(u8.size() - 1);
+    std::string out2(u8.size(), '\0');
+    EXPECT_EQ((size_t)-1, run_parallel("CP932", "UTF-8", u8, out2, 4, &stop));
+    EXPECT_EQ(EINVAL, errno);
+}
+
+TEST(Parallel, OutputTooSmall) {
+    const std::string u8 = big_utf8(true);
+    const std::string sj = to_sjis(u8);
+    std::string out(u8.size() / 2, '\0');
+    size_t stop = 0;
+    EXPECT_EQ((size_t)-1, run_parallel("UTF-8", "CP932", sj, out, 4, &stop));
+    EXPECT_EQ(E2BIG, errno);
+
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    size_t seq_stop = 0;
+    iconv_alt_convert(cd, sj.data(), sj.size(), &out[0], out.size(), &seq_stop);
+    iconv_close(cd);
+    EXPECT_EQ(seq_stop, stop);
+}
+
+/* -----------------------------------------------------------------
+ * ファイル: mmap 入力 → ftruncate + mmap 出力
+ * ----------------------------------------------------------------*/
+static std::string slurp(const std::string& path)
+{
+    std::ifstream f(path, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), {});
+}
+
+TEST(Parallel, FileRoundTrip) {
+    const std::string u8 = big_utf8(true);
+    const std::string in_path = ::testing::TempDir() + "parallel_in.txt";
+    const std::string out_path = ::testing::TempDir() + "parallel_out.txt";
+    std::ofstream(in_path, std::ios::binary) << to_sjis(u8);
+
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    ASSERT_EQ(0, iconv_alt_convert_file(cd, in_path.c_str(), out_path.c_str(), 4, nullptr));
+    EXPECT_EQ(u8, slurp(out_path));
+
+    std::ofstream(in_path, std::ios::binary | std::ios::trunc);      // 空ファイル
+    ASSERT_EQ(0, iconv_alt_convert_file(cd, in_path.c_str(), out_path.c_str(), 4, nullptr));
+    EXPECT_EQ("", slurp(out_path));
+
+    std::ofstream(in_path, std::ios::binary | std::ios::trunc) << "ok\x82";
+    std::remove(out_path.c_str());
+    size_t stop = 0;
+    EXPECT_EQ(-1, iconv_alt_convert_file(cd, in_path.c_str(), out_path.c_str(), 4, &stop));
+    EXPECT_EQ(EINVAL, errno);
+    EXPECT_EQ(2u, stop);
+    EXPECT_FALSE(std::ifstream(out_path).good());                    // 出力は作られない
+    iconv_close(cd);
+    std::remove(in_path.c_str());
+}
+
+#if !defined(_WIN32)
+TEST(Parallel, FileOntoItself) {
+    /* 出力が入力と同じファイル (またはハードリンク) でも、map した入力は壊れない */
+    const std::string u8 = big_utf8(true);
+    const std::string path = ::testing::TempDir() + "parallel_self.txt";
+    const std::string link = ::testing::TempDir() + "parallel_self_link.txt";
+    const std::string u16 = iconv_alt::converter("UTF-16LE", "UTF-8").convert(u8).value();
+    std::ofstream(path, std::ios::binary) << u8;
+
+    iconv_t cd = iconv_open("UTF-16LE", "UTF-8");
+    ASSERT_EQ(0, iconv_alt_convert_file(cd, path.c_str(), path.c_str(), 4, nullptr));
+    EXPECT_EQ(u16, slurp(path));
+    iconv_close(cd);
+
+    cd = iconv_open("UTF-8", "UTF-16LE");
+    std::remove(link.c_str());
+    ASSERT_EQ(0, ::link(path.c_str(), link.c_str()));
+    ASSERT_EQ(0, iconv_alt_convert_file(cd, path.c_str(), link.c_str(), 4, nullptr));
+    EXPECT_EQ(u8, slurp(link));
+    EXPECT_EQ(u16, slurp(path));                                     // 入力はそのまま
+
+    /* 変換エラーなら出力先は変わらない */
+    std::ofstream(path, std::ios::binary | std::ios::trunc) << std::string("a\0\0\xd8", 4);
+    EXPECT_EQ(-1, iconv_alt_convert_file(cd, path.c_str(), link.c_str(), 4, nullptr));
+    EXPECT_EQ(u8, slurp(link));
+    iconv_close(cd);
+    std::remove(path.c_str());
+    std::remove(link.c_str());
+}
+
+TEST(Parallel, FileKeepsExistingMode) {
+    /* 一時ファイル + rename で置き換えても、既存の出力先の許可は変わらない */
+    const std::string in_path = ::testing::TempDir() + "parallel_mode_in.txt";
+    const std::string out_path = ::testing::TempDir() + "parallel_mode_out.txt";
+    std::ofstream(in_path, std::ios::binary) << "abc";
+    std::ofstream(out_path, std::ios::binary | std::ios::trunc) << "old";
+    ASSERT_EQ(0, ::chmod(out_path.c_str(), 0640));
+
+    iconv_t cd = iconv_open("UTF-16LE", "UTF-8");
+    ASSERT_EQ(0, iconv_alt_convert_file(cd, in_path.c_str(), out_path.c_str(), 4, nullptr));
+    iconv_close(cd);
+    struct stat sb;
+    ASSERT_EQ(0, ::stat(out_path.c_str(), &sb));
+    EXPECT_EQ(0640u, (unsigned)(sb.st_mode & 07777));
+    EXPECT_EQ(std::string("a\0b\0c\0", 6), slurp(out_path));
+    std::remove(in_path.c_str());
+    std::remove(out_path.c_str());
+}
+#endif
@@ -0,0 +1,240 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.hpp>
+#include <atomic>
+#include <cerrno>
+#include <cstdio>
+#include <fstream>
+#include <iterator>
+#include <string>
+#include <vector>
+
+static std::string make_utf8(size_t bytes, unsigned seed)
+{
+    static const char* const parts[] = { "請求書", "ｱｲｳ", "abc", "①", "\n", "表予定" };
+    std::string s;
+    while (s.size() < bytes) {
+        seed = seed * 1103515245u + 12345u;
+        s += parts[(seed >> 16) % 6];
+    }
+    return s;
+}
+
+static std::string to_sjis(const std::string& u8)
+{
+    return iconv_alt::converter("CP932", "UTF-8").convert(u8).value();
+}
+
+struct Pool {
+    iconv_alt_thread_pool* p;
+    explicit Pool(unsigned n) : p(iconv_alt_thread_pool_create(n)) {}
+    ~Pool() { iconv_alt_thread_pool_destroy(p); }
+};
+
+/* -----------------------------------------------------------------
+ * 大小混在のバッファ: poll で全部受け取り、逐次変換と一致
+ * ----------------------------------------------------------------*/
+TEST(Pool, MixedBuffersPolled) {
+    Pool pool(4);
+    ASSERT_NE(nullptr, pool.p);
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+
+    const size_t sizes[] = { 0, 10, 1000, 300000, 5, 2 * ICONV_ALT_PARALLEL_MIN_CHUNK + 7,
+                             64 * 1024, 3 * ICONV_ALT_PARALLEL_MIN_CHUNK, 1 };
+    std::vector<std::string> in, expect, out;
+    for (size_t i = 0; i < std::size(sizes); ++i) {
+        expect.push_back(make_utf8(sizes[i], (unsigned)i));
+        in.push_back(to_sjis(expect.back()));
+        out.emplace_back(expect.back().size(), '\0');
+    }
+    for (size_t i = 0; i < in.size(); ++i) {
+        iconv_alt_job_desc d{};
+        d.kind = ICONV_ALT_JOB_BUFFER;
+        d.cd = cd;
+        d.in = in[i].data();
+        d.inlen = in[i].size();
+        d.out = &out[i][0];
+        d.outlen = out[i].size();
+        d.user = reinterpret_cast<void*>(i);
+        ASSERT_NE(nullptr, iconv_alt_thread_pool_submit(pool.p, &d));
+    }
+    size_t got = 0;
+    while (iconv_alt_job* job = iconv_alt_thread_pool_poll(pool.p, 1)) {
+        size_t written = 0;
+        void* user = nullptr;
+        EXPECT_EQ(0, iconv_alt_job_result(job, &written, nullptr, &user));
+        size_t i = reinterpret_cast<size_t>(user);
+        EXPECT_TRUE(iconv_alt_job_done(job));
+        EXPECT_EQ(expect[i].size(), written);
+        EXPECT_EQ(expect[i], out[i]) << "job " << i;
+        iconv_alt_job_release(job);
+        ++got;
+    }
+    EXPECT_EQ(in.size(), got);
+    EXPECT_EQ(nullptr, iconv_alt_thread_pool_poll(pool.p, 0));
+    iconv_close(cd);
+}
+
+/* -----------------------------------------------------------------
+ * callback: ワーカー上で呼ばれ、その中で解放できる
+ * ----------------------------------------------------------------*/
+static std::atomic<int> g_ok{0};
+
+static void on_done(iconv_alt_job* job, void*)
+{
+    if (iconv_alt_job_result(job, nullptr, nullptr, nullptr) == 0) ++g_ok;
+    iconv_alt_job_release(job);
+}
+
+TEST(Pool, CallbacksFromWorkers) {
+    const std::string u8 = make_utf8(600000, 7);
+    const std::string sj = to_sjis(u8);
+    std::vector<std::string> out(40, std::string(u8.size(), '\0'));
+    g_ok = 0;
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    {
+        Pool pool(3);
+        for (auto& o : out) {
+            iconv_alt_job_desc d{};
+            d.kind = ICONV_ALT_JOB_BUFFER;
+            d.cd = cd;
+            d.in = sj.data();
+            d.inlen = sj.size();
+            d.out = &o[0];
+            d.outlen = o.size();
+            d.callback = on_done;
+            ASSERT_NE(nullptr, iconv_alt_thread_pool_submit(pool.p, &d));
+        }
+        EXPECT_EQ(nullptr, iconv_alt_thread_pool_poll(pool.p, 1));   // callback ジョブは来ない
+    }                                                                 // destroy が全部待つ
+    iconv_close(cd);
+    EXPECT_EQ(40, g_ok.load());
+    for (auto& o : out) EXPECT_EQ(u8, o);
+}
+
+/* -----------------------------------------------------------------
+ * 列 (Arrow 形式のオフセット)
+ * ----------------------------------------------------------------*/
+TEST(Pool, ColumnJob) {
+    std::vector<std::string> rows;
+    std::string data;
+    std::vector<size_t> in_off{0};
+    size_t u8_total = 0;
+    for (unsigned i = 0; i < 40000; ++i) {
+        rows.push_back(make_utf8(i % 37, i));
+        u8_total += rows.back().size();
+        data += to_sjis(rows.back());
+        in_off.push_back(data.size());
+    }
+    std::string out(u8_total, '\0');
+    std::vector<size_t> out_off(rows.size() + 1, 0);
+
+    Pool pool(4);
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    iconv_alt_job_desc d{};
+    d.kind = ICONV_ALT_JOB_COLUMN;
+    d.cd = cd;
+    d.in = data.data();
+    d.in_offsets = in_off.data();
+    d.rows = rows.size();
+    d.out = &out[0];
+    d.outlen = out.size();
+    d.out_offsets = out_off.data();
+    iconv_alt_job* job = iconv_alt_thread_pool_submit(pool.p, &d);
+    ASSERT_NE(nullptr, job);
+    iconv_alt_job_wait(job);
+    size_t written = 0;
+    EXPECT_EQ(0, iconv_alt_job_result(job, &written, nullptr, nullptr));
+    iconv_alt_job_release(job);                      // poll せずに解放してよい
+    EXPECT_EQ(u8_total, written);
+    for (size_t i = 0; i < rows.size(); ++i)
+        ASSERT_EQ(rows[i], out.substr(out_off[i], out_off[i + 1] - out_off[i])) << "row " << i;
+
+    /* 不正な行: stop は in 基準 */
+    data[in_off[30000]] = '\x81';
+    data[in_off[30000] + 1] = '\x7f';
+    std::string bad_row = data.substr(in_off[30000], in_off[30001] - in_off[30000]);
+    job = iconv_alt_thread_pool_submit(pool.p, &d);
+    iconv_alt_job_wait(job);
+    size_t stop = 0;
+    EXPECT_EQ(bad_row.size() >= 2 ? EILSEQ : EINVAL, iconv_alt_job_result(job, nullptr, &stop, nullptr));
+    EXPECT_EQ(in_off[30000], stop);
+    iconv_alt_job_release(job);
+    iconv_close(cd);
+}
+
+/* -----------------------------------------------------------------
+ * エラー位置 / E2BIG は逐次変換と同じ
+ * ----------------------------------------------------------------*/
+TEST(Pool, BufferErrorsMatchSequential) {
+    std::string sj = to_sjis(make_utf8(4 * ICONV_ALT_PARALLEL_MIN_CHUNK, 3));
+    size_t bad = sj.find("\x90\xbf", sj.size() * 2 / 3);   // 「請」
+    sj[bad + 1] = '\x7f';
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    std::string out(sj.size() * 3, '\0');
+
+    Pool pool(4);
+    iconv_alt_job_desc d{};
+    d.kind = ICONV_ALT_JOB_BUFFER;
+    d.cd = cd;
+    d.in = sj.data();
+    d.inlen = sj.size();
+    d.out = &out[0];
+    d.outlen = out.size();
+    iconv_alt_job* job = iconv_alt_thread_pool_submit(pool.p, &d);
+    iconv_alt_job_wait(job);
+    size_t stop = 0;
+    EXPECT_EQ(EILSEQ, iconv_alt_job_result(job, nullptr, &stop, nullptr));
+    EXPECT_EQ(bad, stop);
+    iconv_alt_job_release(job);
+
+    sj[bad + 1] = '\xbf';
+    d.outlen = sj.size();                          // UTF-8 はもっと長い
+    job = iconv_alt_thread_pool_submit(pool.p, &d);
+    iconv_alt_job_wait(job);
+    size_t seq_stop = 0;
+    iconv_alt_convert(cd, sj.data(), sj.size(), &out[0], d.outlen, &seq_stop);
+    EXPECT_EQ(E2BIG, iconv_alt_job_result(job, nullptr, &stop, nullptr));
+    EXPECT_EQ(seq_stop, stop);
+    iconv_alt_job_release(job);
+    iconv_close(cd);
+
+    EXPECT_EQ(nullptr, iconv_alt_thread_pool_submit(pool.p, nullptr));
+    EXPECT_EQ(EINVAL, errno);
+}
+
+/* -----------------------------------------------------------------
+ * ファイル / poll されないまま destroy
+ * ----------------------------------------------------------------*/
+TEST(Pool, FileJobAndUnpolledDestroy) {
+    const std::string u8 = make_utf8(3 * ICONV_ALT_PARALLEL_MIN_CHUNK, 11);
+    const std::string in_path = ::testing::TempDir() + "pool_in.txt";
+    const std::string out_path = ::testing::TempDir() + "pool_out.txt";
+    std::ofstream(in_path, std::ios::binary) << to_sjis(u8);
+
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    {
+        Pool pool(2);
+        iconv_alt_job_desc d{};
+        d.kind = ICONV_ALT_JOB_FILE;
+        d.cd = cd;
+        d.in_path = in_path.c_str();
+        d.out_path = out_path.c_str();
+        iconv_alt_job* job = iconv_alt_thread_pool_submit(pool.p, &d);
+        ASSERT_NE(nullptr, job);
+        EXPECT_EQ(job, iconv_alt_thread_pool_poll(pool.p, 1));
+        size_t written = 0;
+        EXPECT_EQ(0, iconv_alt_job_result(job, &written, nullptr, nullptr));
+        EXPECT_EQ(u8.size(), written);
+        iconv_alt_job_release(job);
+
+        std::ifstream f(out_path, std::ios::binary);
+        EXPECT_EQ(u8, std::string(std::istreambuf_iterator<char>(f), {}));
+
+        d.in_path = "/nonexistent/iconv_alt_pool_in";
+        for (int i = 0; i < 3; ++i)                         // poll しない: destroy が解放
+            ASSERT_NE(nullptr, iconv_alt_thread_pool_submit(pool.p, &d));
+    }
+    iconv_close(cd);
+    std::remove(in_path.c_str());
+    std::remove(out_path.c_str());
+}
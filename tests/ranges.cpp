@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <iconv_alt_ranges.hpp>
+#include <iconv.h>
+#include <cstddef>
+#include <ranges>
+#include <span>
+#include <string>
+#include <string_view>
+#include <vector>
+
+namespace views = iconv_alt::views;
+
+static_assert(std::ranges::forward_range<iconv_alt::codepoint_view<iconv_alt::encoding::sjis>>);
+static_assert(std::ranges::view<iconv_alt::codepoint_view<iconv_alt::encoding::utf8>>);
+static_assert(std::ranges::borrowed_range<iconv_alt::codepoint_view<iconv_alt::encoding::utf8>>);
+
+/* UTF-8 → char32_t (比較用の素朴な実装) */
+static std::u32string decode_u8(const std::string& s)
+{
+    std::u32string out;
+    for (size_t i = 0; i < s.size();) {
+        unsigned char b = s[i];
+        int n = b < 0x80 ? 1 : b < 0xE0 ? 2 : b < 0xF0 ? 3 : 4;
+        char32_t c = n == 1 ? b : b & (0x7F >> n);
+        for (int k = 1; k < n; ++k) c = (c << 6) | (s[i + k] & 0x3F);
+        out += c;
+        i += n;
+    }
+    return out;
+}
+
+static std::string to_utf8(const std::string& sj)
+{
+    iconv_t cd = iconv_open("UTF-8", "CP932");
+    std::string out(sj.size() * 3, '\0');
+    char* ip = const_cast<char*>(sj.data());
+    size_t il = sj.size();
+    char* op = &out[0];
+    size_t ol = out.size();
+    EXPECT_EQ(0u, iconv(cd, &ip, &il, &op, &ol));
+    iconv_close(cd);
+    out.resize(out.size() - ol);
+    return out;
+}
+
+template <class R>
+static std::u32string collect(R&& r)
+{
+    std::u32string out;
+    for (char32_t c : r) out += c;
+    return out;
+}
+
+/* -----------------------------------------------------------------
+ * 全 CP932 コード: iconv() → UTF-8 → デコードと同じコード点列
+ * (ブロック境界・ASCII 展開を何度も跨ぐ)
+ * ----------------------------------------------------------------*/
+TEST(Ranges, SjisMatchesIconv) {
+    std::string sj;
+    for (const auto& e : SJIS_MAP) {
+        if (e.sjis > 0xFF) sj += static_cast<char>(e.sjis >> 8);
+        sj += static_cast<char>(e.sjis & 0xFF);
+        if (e.sjis % 7 == 0) sj += "ascii run";
+    }
+    EXPECT_EQ(decode_u8(to_utf8(sj)), collect(views::sjis_codepoints(sj)));
+}
+
+TEST(Ranges, Utf8Codepoints) {
+    const std::string s = "abc\xE3\x81\x82\xF0\x9F\x98\x80\xC2\xA9";   // abcあ😀©
+    EXPECT_EQ(U"abcあ😀©", collect(s | views::utf8_codepoints));
+
+    auto v = views::utf8_codepoints(std::string_view("x\xC0\xAFy\xE3\x81"));
+    EXPECT_EQ(U"x��y�", collect(v));                 // 冗長表現・途中終了
+}
+
+/* -----------------------------------------------------------------
+ * offset() / 他の view との合成 / span<const std::byte>
+ * ----------------------------------------------------------------*/
+TEST(Ranges, OffsetsAndComposition) {
+    const std::string sj = "a\x82\xa0\xb1z";                         // a あ ｱ z
+    auto v = views::sjis_codepoints(sj);
+    std::vector<size_t> offs;
+    for (auto it = v.begin(); it != v.end(); ++it) offs.push_back(it.offset());
+    EXPECT_EQ((std::vector<size_t>{0, 1, 3, 4}), offs);
+    EXPECT_EQ(4, std::ranges::distance(v));
+
+    std::span<const std::byte> bytes(reinterpret_cast<const std::byte*>(sj.data()), sj.size());
+    auto kana = bytes | views::sjis_codepoints
+              | std::views::filter([](char32_t c) { return c >= 0x3000; });
+    EXPECT_EQ(U"あｱ", collect(kana));
+
+    auto it = std::ranges::find(v, U'ｱ');
+    EXPECT_EQ(3u, it.offset());
+}
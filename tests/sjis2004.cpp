@@ -0,0 +1,163 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+static const std::string kU8 = "請求書ｱｲｳabc①\n表予定,か゚き゚æ̀˩˥𠀋𪚲俱剝ひらがなカタカナ";
+
+/* iconv_alt_convert で一括変換。失敗は空文字列と err / stop */
+static std::string conv(const char* to, const char* from, const std::string& in,
+    size_t* stop = nullptr, int* err = nullptr)
+{
+    iconv_t cd = iconv_open(to, from);
+    EXPECT_NE((iconv_t)-1, cd) << from << " -> " << to;
+    std::string out(in.size() * 4 + 4, '\0');
+    size_t s = 0;
+    errno = 0;
+    size_t r = iconv_alt_convert(cd, in.data(), in.size(), &out[0], out.size(), &s);
+    if (err) *err = r == (size_t)-1 ? errno : 0;
+    if (stop) *stop = s;
+    iconv_close(cd);
+    out.resize(r == (size_t)-1 ? 0 : r);
+    return out;
+}
+
+/* iconv() に 1 byte ずつ入力し、出力は 6 byte (2 コード点の文字の UTF-8) ずつ空ける。
+   最後に iconv(cd, NULL, ...) */
+static std::string trickle(const char* to, const char* from, const std::string& in)
+{
+    iconv_t cd = iconv_open(to, from);
+    std::string out;
+    for (size_t i = 0; i <= in.size(); ++i) {
+        char* ip = const_cast<char*>(in.data() + i);
+        size_t il = 1;
+        for (;;) {
+            char buf[6];
+            char* op = buf;
+            size_t ol = sizeof(buf);
+            size_t r = i < in.size() ? iconv(cd, &ip, &il, &op, &ol) : iconv(cd, nullptr, nullptr, &op, &ol);
+            out.append(buf, sizeof(buf) - ol);
+            if (r != (size_t)-1 || errno == EINVAL) break;
+            EXPECT_EQ(E2BIG, errno);
+        }
+    }
+    iconv_close(cd);
+    return out;
+}
+
+TEST(Sjis2004, KnownCodes) {
+    EXPECT_EQ("\x93\xfa\x96\x7b", conv("SHIFT_JIS-2004", "UTF-8", "日本"));
+    EXPECT_EQ("\x82\xf5", conv("SHIFT_JIS-2004", "UTF-8", "か゚"));      // 基底 + 結合文字 → 1 コード
+    EXPECT_EQ("か゚", conv("UTF-8", "SHIFT_JIS-2004", "\x82\xf5"));
+    EXPECT_EQ("\x86\x63", conv("SHIFT_JIS-2004", "UTF-8", "æ̀"));
+    EXPECT_EQ("\x87\xa0", conv("SHIFT_JIS-2004", "UTF-8", "𠀋"));      // 第 1 面の補助面
+    EXPECT_EQ("\xfc\xf4", conv("SHIFT_JIS-2004", "UTF-8", "𪚲"));      // 第 2 面
+    EXPECT_EQ("𪚲", conv("UTF-8", "SHIFT_JIS-2004", "\xfc\xf4"));
+    EXPECT_EQ("\\~\xb1", conv("SHIFT_JIS-2004", "UTF-8", "\\~ｱ"));   // 1 byte は CP932 と同じ
+    for (const char* name : { "SHIFT_JISX0213", "SJIS-2004", "shift-jis-2004" })
+        EXPECT_EQ(kU8, conv("UTF-8", name, conv(name, "UTF-8", kU8))) << name;
+    EXPECT_EQ(conv("UTF-16LE", "UTF-8", kU8), conv("UTF-16LE", "SHIFT_JIS-2004", conv("SHIFT_JIS-2004", "UTF-8", kU8)));
+}
+
+TEST(Sjis2004, CompositionLookahead) {
+    EXPECT_EQ("\x82\xa9", conv("SHIFT_JIS-2004", "UTF-8", "か"));        // 預けた基底は終わりで書く
+    EXPECT_EQ("\x82\xa9\x82\xa9", conv("SHIFT_JIS-2004", "UTF-8", "かか"));
+    EXPECT_EQ("\x82\xa9" "a", conv("SHIFT_JIS-2004", "UTF-8", "かa"));
+    EXPECT_EQ("\x85\x7b\x86\x79", conv("SHIFT_JIS-2004", "UTF-8", "æ\xcc\x81")); // U+0301 とは合成しない
+    EXPECT_EQ("\x86\x85\x86\x84", conv("SHIFT_JIS-2004", "UTF-8", "˩˥˩"));     // 合成した後の ˩ は基底
+    EXPECT_EQ("\x86\x86", conv("SHIFT_JIS-2004", "UTF-8", "˥˩"));
+    /* 1 文字ずつの経路 (UTF-16 から) でも同じ */
+    for (const char* s : { "か゚", "かか", "æ̀", "˩˥˩", "˥˩", "か" })
+        EXPECT_EQ(conv("SHIFT_JIS-2004", "UTF-8", s),
+                  conv("SHIFT_JIS-2004", "UTF-16LE", conv("UTF-16LE", "UTF-8", s))) << s;
+
+    /* 書けない文字は基底を預けたまま止まる */
+    size_t stop = 0;
+    int err = 0;
+    conv("SHIFT_JIS-2004", "UTF-8", "か\xc2\xa5", &stop, &err);             // ¥
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(3u, stop);
+    conv("SHIFT_JIS-2004", "UTF-8", "a\xe3\x82\x9a", &stop, &err);          // 結合文字だけ
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+
+    /* 出力が足りない: 預けた基底を書く場所が無ければ E2BIG で、状態は文字の前のまま */
+    iconv_t cd = iconv_open("SHIFT_JIS-2004", "UTF-16LE");
+    std::string in = conv("UTF-16LE", "UTF-8", "かか");
+    char* ip = &in[0];
+    size_t il = in.size();
+    char buf[4];
+    char* op = buf;
+    size_t ol = 1;
+    EXPECT_EQ((size_t)-1, iconv(cd, &ip, &il, &op, &ol));
+    EXPECT_EQ(E2BIG, errno);
+    EXPECT_EQ(2u, il);                                    // 1 つ目は預けた、2 つ目で前の基底を書けない
+    EXPECT_EQ(1u, ol);
+    ol = 2;
+    EXPECT_EQ(0u, iconv(cd, &ip, &il, &op, &ol));
+    EXPECT_EQ(0u, ol);
+    ol = 1;
+    EXPECT_EQ((size_t)-1, iconv(cd, nullptr, nullptr, &op, &ol));    // 2 つ目を書く場所が無い
+    EXPECT_EQ(E2BIG, errno);
+    ol = 2;
+    EXPECT_EQ(0u, iconv(cd, nullptr, nullptr, &op, &ol));
+    EXPECT_EQ("\x82\xa9\x82\xa9", std::string(buf, 4));
+    iconv_close(cd);
+}
+
+TEST(Sjis2004, EveryCodeRoundTrips) {
+    /* 全ての 2 byte: 復号できれば符号化で元に戻る (U+005C / U+007E は 1 byte の ASCII へ) */
+    const std::string kanji = "\x8a\xbf\x8e\x9a\x82\xa9\x82\xc8";   // 核の高速経路に乗る前置き
+    int mapped = 0;
+    for (unsigned c = 0x8140; c <= 0xFCFC; ++c) {
+        if (c >= 0xA000 && c < 0xE000) continue;
+        std::string sj = { 'a', (char)(c >> 8), (char)(c & 0xFF), 'b' };
+        int err = 0;
+        std::string u8 = conv("UTF-8", "SHIFT_JIS-2004", sj, nullptr, &err);
+        if (err) { EXPECT_EQ(EILSEQ, err) << std::hex << c; continue; }
+        ++mapped;
+        /* 核 (UTF-8) と 1 文字ずつの経路 (UTF-16) が同じ */
+        EXPECT_EQ(conv("UTF-16LE", "UTF-8", u8), conv("UTF-16LE", "SHIFT_JIS-2004", sj)) << std::hex << c;
+        EXPECT_EQ(conv("UTF-8", "SHIFT_JIS-2004", kanji) + u8, conv("UTF-8", "SHIFT_JIS-2004", kanji + sj));
+        std::string back = conv("SHIFT_JIS-2004", "UTF-8", u8);
+        if (u8.size() == 3 && (u8[1] == '\\' || u8[1] == '~')) continue;
+        EXPECT_EQ(sj, back) << std::hex << c;
+        EXPECT_EQ(sj, conv("SHIFT_JIS-2004", "UTF-16LE", conv("UTF-16LE", "UTF-8", u8))) << std::hex << c;
+    }
+    EXPECT_EQ(11233, mapped);                             // JIS X 0213:2004 の全ての 2 byte 文字
+    for (unsigned k = 0xA1; k <= 0xDF; ++k)
+        EXPECT_EQ(std::string(1, (char)k),
+                  conv("SHIFT_JIS-2004", "UTF-8", conv("UTF-8", "SHIFT_JIS-2004", std::string(1, (char)k))));
+}
+
+TEST(Sjis2004, Errors) {
+    size_t stop = 0;
+    int err = 0;
+    conv("UTF-8", "SHIFT_JIS-2004", "ab\x80", &stop, &err);
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "SHIFT_JIS-2004", "ab\xfd\x40", &stop, &err);
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "SHIFT_JIS-2004", "ab\x82", &stop, &err);              // 途中で終わる
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(2u, stop);
+    conv("SHIFT_JIS-2004", "UTF-8", "a\xc2\xa5", &stop, &err);           // ¥ は 1 byte を ASCII にしたので無い
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+    conv("SHIFT_JIS-2004", "UTF-8", "か\xe3\x82", &stop, &err);          // 基底の後ろが途中で終わる
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(3u, stop);
+}
+
+TEST(Sjis2004, Streaming) {
+    std::string text;
+    while (text.size() < 600) text += kU8;
+    std::string sj = conv("SHIFT_JIS-2004", "UTF-8", text);
+    EXPECT_EQ(text, trickle("UTF-8", "SHIFT_JIS-2004", sj));
+    EXPECT_EQ(sj, trickle("SHIFT_JIS-2004", "UTF-8", text));
+    EXPECT_EQ(sj, trickle("SHIFT_JIS-2004", "UTF-16BE", conv("UTF-16BE", "UTF-8", text)));
+    EXPECT_EQ(sj, conv("SHIFT_JIS-2004", "SHIFT_JIS-2004", sj));
+    EXPECT_EQ(sj + "\x82\xa9", trickle("SHIFT_JIS-2004", "UTF-8", text + "か"));
+}
@@ -0,0 +1,97 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <cstdint>
+#include <string>
+#include <vector>
+
+/* 各バイトの属する文字の先頭 / 文字番号 (先頭から素直に数えた正解) */
+struct Truth {
+    std::vector<size_t> start, index, offsets;   // offsets: 文字番号 → 先頭 (+ len)
+};
+
+static bool is_lead(unsigned char b) { return (b >= 0x81 && b <= 0x9F) || (b >= 0xE0 && b <= 0xFC); }
+
+static Truth truth(const std::string& s)
+{
+    Truth t;
+    for (size_t i = 0; i < s.size();) {
+        size_t w = (is_lead((unsigned char)s[i]) && i + 1 < s.size()) ? 2 : 1;
+        for (size_t k = 0; k < w; ++k) {
+            t.start.push_back(i);
+            t.index.push_back(t.offsets.size());
+        }
+        t.offsets.push_back(i);
+        i += w;
+    }
+    t.offsets.push_back(s.size());
+    return t;
+}
+
+/* ASCII / 半角カナ / 2 byte 文字 / lead 候補だけが続く 2 byte 文字の混在 */
+static std::string make_sjis(size_t n, uint32_t seed)
+{
+    std::string s;
+    auto rnd = [&] { seed = seed * 1664525u + 1013904223u; return seed >> 8; };
+    auto lead = [&] { unsigned v = rnd() % 60; return char(v < 31 ? 0x81 + v : 0xE0 + (v - 31)); };
+    while (s.size() < n) {
+        switch (rnd() % 5) {
+        case 0: s += "abc\n"; break;
+        case 1: s += char(0xA1 + rnd() % 63); break;                  // 半角カナ
+        case 2: s += "\x95\x5c"; break;                               // 「表」trail = '\\'
+        default:                                                      // 曖昧な連続
+            for (unsigned k = rnd() % 40; k > 0; --k) { s += lead(); s += lead(); }
+        }
+    }
+    return s;
+}
+
+TEST(SjisIndex, ResyncFindsCharacterStart) {
+    for (uint32_t seed = 1; seed <= 5; ++seed) {
+        std::string s = make_sjis(20000, seed);
+        Truth t = truth(s);
+        for (size_t i = 0; i < s.size(); ++i)
+            ASSERT_EQ(t.start[i], iconv_alt_sjis_resync(s.data(), i)) << "seed " << seed << " pos " << i;
+    }
+    EXPECT_EQ(0u, iconv_alt_sjis_resync("\x82\xa0", 0));
+    EXPECT_EQ(0u, iconv_alt_sjis_resync("\x82\xa0", 1));
+    EXPECT_EQ(2u, iconv_alt_sjis_resync("\x82\xa0" "A", 2));
+}
+
+TEST(SjisIndex, OffsetAndCharMatchLinearScan) {
+    const size_t intervals[] = { 1, 7, 64, 4096, 0 };
+    std::string s = make_sjis(3 * 4096 + 100, 42);
+    s += '\x88';                                                      // 末尾で途切れた lead
+    Truth t = truth(s);
+    for (size_t iv : intervals) {
+        iconv_alt_sjis_index* x = iconv_alt_sjis_index_build(s.data(), s.size(), iv);
+        ASSERT_NE(nullptr, x);
+        ASSERT_EQ(t.offsets.size() - 1, iconv_alt_sjis_index_count(x));
+        const size_t step = (iv == 0) ? 37 : 1;      // 既定 (64 KB) は全体を歩くので間引く
+        for (size_t k = 0; k < t.offsets.size(); k += step)
+            ASSERT_EQ(t.offsets[k], iconv_alt_sjis_index_offset(x, k)) << "interval " << iv << " char " << k;
+        for (size_t i = 0; i < s.size(); i += step) {
+            size_t start = 0;
+            ASSERT_EQ(t.index[i], iconv_alt_sjis_index_char(x, i, &start)) << "interval " << iv << " pos " << i;
+            ASSERT_EQ(t.start[i], start);
+        }
+        EXPECT_EQ(iconv_alt_sjis_index_count(x), iconv_alt_sjis_index_char(x, s.size(), nullptr));
+
+        errno = 0;
+        EXPECT_EQ((size_t)-1, iconv_alt_sjis_index_offset(x, t.offsets.size()));
+        EXPECT_EQ(ERANGE, errno);
+        errno = 0;
+        EXPECT_EQ((size_t)-1, iconv_alt_sjis_index_char(x, s.size() + 1, nullptr));
+        EXPECT_EQ(ERANGE, errno);
+        iconv_alt_sjis_index_free(x);
+    }
+}
+
+TEST(SjisIndex, EmptyBuffer) {
+    iconv_alt_sjis_index* x = iconv_alt_sjis_index_build(nullptr, 0, 0);
+    ASSERT_NE(nullptr, x);
+    EXPECT_EQ(0u, iconv_alt_sjis_index_count(x));
+    EXPECT_EQ(0u, iconv_alt_sjis_index_offset(x, 0));
+    EXPECT_EQ(0u, iconv_alt_sjis_index_char(x, 0, nullptr));
+    iconv_alt_sjis_index_free(x);
+}
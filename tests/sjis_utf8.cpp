@@ -198,3 +198,63 @@ TEST(Alias, InvalidEncoding) {
     iconv_t cd = iconv_open("UTF-8", "UNKNOWN");
     EXPECT_EQ((iconv_t)-1, cd);
 }
+
+/* -----------------------------------------------------------------
+ * E2BIG から再開: 書けなかった文字は入力に残り、続きで取りこぼさない
+ * ----------------------------------------------------------------*/
+TEST(Error, SjisToUtf8_BufferTooSmallResume) {
+    const char sjis[] = "\x82\xa0\x82\xa2\x82\xa4";  // あいう
+    char utf8[16]{};
+    char* in = (char*)sjis, * out = utf8;
+    size_t inleft = sizeof(sjis) - 1, outleft = 4;  // 1 文字分 + 1
+
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv(cd, &in, &inleft, &out, &outleft));
+    EXPECT_EQ(E2BIG, errno);
+    EXPECT_EQ(4u, inleft);                          // い の先頭で停止
+
+    outleft = sizeof(utf8) - (size_t)(out - utf8) - 1;
+    EXPECT_EQ(0u, iconv(cd, &in, &inleft, &out, &outleft));
+    iconv_close(cd);
+    EXPECT_STREQ(u8"あいう", utf8);
+}
+
+TEST(Error, Utf8ToSjis_BufferTooSmallResume) {
+    const char utf8[] = u8"あいう";
+    char sjis[16]{};
+    char* in = (char*)utf8, * out = sjis;
+    size_t inleft = strlen(utf8), outleft = 3;
+
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv(cd, &in, &inleft, &out, &outleft));
+    EXPECT_EQ(E2BIG, errno);
+    EXPECT_EQ(6u, inleft);
+
+    outleft = sizeof(sjis) - (size_t)(out - sjis) - 1;
+    EXPECT_EQ(0u, iconv(cd, &in, &inleft, &out, &outleft));
+    iconv_close(cd);
+    EXPECT_STREQ("\x82\xa0\x82\xa2\x82\xa4", sjis);
+}
+
+/* -----------------------------------------------------------------
+ * EILSEQ: 入力位置は不正な文字の先頭を指す
+ * ----------------------------------------------------------------*/
+TEST(Error, Utf8ToSjis_IllegalSequencePosition) {
+    const char utf8[] = u8"ab😀cd";
+    char sjis[16]{};
+    char* in = (char*)utf8, * out = sjis;
+    size_t inleft = strlen(utf8), outleft = sizeof(sjis);
+
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+    errno = 0;
+    EXPECT_EQ((size_t)-1, iconv(cd, &in, &inleft, &out, &outleft));
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(utf8 + 2, in);
+    EXPECT_EQ(6u, inleft);
+    iconv_close(cd);
+}
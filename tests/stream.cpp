@@ -0,0 +1,94 @@
+#include <gtest/gtest.h>
+#include <iconv_alt_stream.hpp>
+#include <sstream>
+#include <string>
+
+static std::string sample_utf8()
+{
+    std::string s;
+    for (int i = 0; i < 300; ++i)
+        s += "行" + std::to_string(i) + ": 請求書ｱｲｳ①\n";
+    return s;
+}
+
+static std::string sample_sjis()
+{
+    iconv_alt::converter c("CP932", "UTF-8");
+    return c.convert(sample_utf8()).value();
+}
+
+/* -----------------------------------------------------------------
+ * 入力: 小さなブロックで文字が何度も分断されても結果は同じ
+ * ----------------------------------------------------------------*/
+TEST(Stream, InputSplitsAcrossBlocks) {
+    for (size_t block : {16, 17, 100, 65536}) {
+        std::istringstream raw(sample_sjis());
+        iconv_alt::transcoding_istreambuf buf(raw.rdbuf(), "UTF-8", "CP932", block);
+        std::istream in(&buf);
+        std::ostringstream all;
+        all << in.rdbuf();
+        EXPECT_EQ(sample_utf8(), all.str()) << "block " << block;
+    }
+}
+
+TEST(Stream, GetlineThroughIstream) {
+    std::istringstream raw(sample_sjis());
+    iconv_alt::transcoding_istream in(raw, "UTF-8", "CP932");
+    std::string line;
+    int n = 0;
+    while (std::getline(in, line)) {
+        EXPECT_EQ("行" + std::to_string(n) + ": 請求書ｱｲｳ①", line);
+        ++n;
+    }
+    EXPECT_EQ(300, n);
+    EXPECT_TRUE(in.eof());
+    EXPECT_FALSE(in.bad());
+}
+
+/* -----------------------------------------------------------------
+ * 出力: 1 byte ずつ / 大きな塊のどちらでも同じ
+ * ----------------------------------------------------------------*/
+TEST(Stream, OutputBytewiseAndBulk) {
+    const std::string u8 = sample_utf8();
+
+    std::ostringstream raw1;
+    {
+        iconv_alt::transcoding_ostreambuf buf(raw1.rdbuf(), "CP932", "UTF-8", 16);
+        std::ostream out(&buf);
+        for (char c : u8) out.put(c);
+        out.flush();
+        EXPECT_FALSE(buf.incomplete());
+    }
+    EXPECT_EQ(sample_sjis(), raw1.str());
+
+    std::ostringstream raw2;
+    {
+        iconv_alt::transcoding_ostream out(raw2, "CP932", "UTF-8");
+        out << u8.substr(0, 5);                      // バッファ経由
+        out.write(u8.data() + 5, u8.size() - 5);     // 直接変換
+    }
+    EXPECT_EQ(sample_sjis(), raw2.str());
+}
+
+/* -----------------------------------------------------------------
+ * エラー: badbit / 例外。手前までは読める
+ * ----------------------------------------------------------------*/
+TEST(Stream, ErrorsSetBadbit) {
+    std::istringstream raw("ok\x85\x40ng");
+    iconv_alt::transcoding_istream in(raw, "UTF-8", "CP932");
+    std::string s;
+    in >> s;
+    EXPECT_EQ("ok", s);
+    EXPECT_TRUE(in.bad());
+
+    std::istringstream cut("abc\x82");
+    iconv_alt::transcoding_istream in2(cut, "UTF-8", "CP932");
+    in2.exceptions(std::ios::badbit);
+    std::string all;
+    EXPECT_THROW(std::getline(in2, all), std::system_error);
+
+    std::ostringstream sink;
+    iconv_alt::transcoding_ostream out(sink, "CP932", "UTF-8");
+    out << "x\xF0\x9F\x98\x80" << std::flush;
+    EXPECT_TRUE(out.bad());
+}
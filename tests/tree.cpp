@@ -0,0 +1,142 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.hpp>
+#include <cerrno>
+#include <filesystem>
+#include <fstream>
+#include <iterator>
+#include <map>
+#include <string>
+#include <vector>
+
+namespace fs = std::filesystem;
+
+static void write_file(const fs::path& p, const std::string& data)
+{
+    fs::create_directories(p.parent_path());
+    std::ofstream(p, std::ios::binary) << data;
+}
+
+static std::string read_file(const fs::path& p)
+{
+    std::ifstream f(p, std::ios::binary);
+    return std::string(std::istreambuf_iterator<char>(f), {});
+}
+
+static std::string make_utf8(size_t bytes, unsigned seed)
+{
+    static const char* const parts[] = { "請求書", "ｱｲｳ", "abc", "①", "\n", "表予定" };
+    std::string s;
+    while (s.size() < bytes) {
+        seed = seed * 1103515245u + 12345u;
+        s += parts[(seed >> 16) % 6];
+    }
+    return s;
+}
+
+/* 入れ子のディレクトリに小さなファイルを並べ、空 / 大きいファイルも混ぜる */
+static std::map<std::string, std::string> make_tree(const fs::path& root)
+{
+    fs::remove_all(root);
+    iconv_alt::converter to_sjis("CP932", "UTF-8");
+    std::map<std::string, std::string> expect;             // 相対パス → UTF-8
+    for (unsigned i = 0; i < 300; ++i) {
+        std::string rel = "d" + std::to_string(i % 7) + "/s" + std::to_string(i % 3) +
+                          "/f" + std::to_string(i) + ".txt";
+        expect[rel] = make_utf8(1000 + (i * 173) % 50000, i);
+    }
+    expect["empty.txt"] = "";
+    expect["big/large.txt"] = make_utf8(700 * 1024, 99);  // 読みバッファを伸ばす / 分割変換
+    for (const auto& [rel, u8] : expect) write_file(root / rel, to_sjis.convert(u8).value());
+    fs::create_directories(root / "emptydir");
+    return expect;
+}
+
+class Tree : public ::testing::TestWithParam<unsigned> {
+protected:
+    /* 経路ごとに別のディレクトリ (ctest -j で Uring / Threads が並行して走る) */
+    static fs::path scratch(const char* name)
+    {
+        return fs::path(::testing::TempDir()) /
+               (std::string(name) + (GetParam() & ICONV_ALT_TREE_NO_URING ? "_threads" : "_uring"));
+    }
+};
+
+TEST_P(Tree, MirrorsDirectoryTree) {
+    fs::path in = scratch("tree_in");
+    fs::path out = scratch("tree_out");
+    auto expect = make_tree(in);
+    fs::remove_all(out);
+    fs::create_symlink(in / "empty.txt", in / "link.txt");  // 辿らない
+
+    iconv_alt::converter cv("UTF-8", "CP932");
+    iconv_alt_tree_options o{};
+    o.flags = GetParam();
+    o.queue_depth = 16;
+    ASSERT_EQ(0, iconv_alt_convert_tree(cv.native_handle(), in.c_str(), out.c_str(), &o));
+    EXPECT_EQ(expect.size(), o.files);
+    EXPECT_EQ(0u, o.failed);
+    if (GetParam() & ICONV_ALT_TREE_NO_URING) {
+        EXPECT_EQ(0, o.used_uring);
+    }
+
+    unsigned long long total = 0;
+    for (const auto& [rel, u8] : expect) {
+        ASSERT_EQ(u8, read_file(out / rel)) << rel;
+        total += u8.size();
+    }
+    EXPECT_EQ(total, o.out_total);
+    EXPECT_TRUE(fs::is_directory(out / "emptydir"));
+    EXPECT_FALSE(fs::exists(out / "link.txt"));
+    for (const auto& e : fs::recursive_directory_iterator(out))
+        EXPECT_EQ(std::string::npos, e.path().string().find(".iconv-alt.tmp"));
+}
+
+struct Failure { std::string path; int err; size_t offset; };
+
+static void on_error(const char* path, int err, size_t offset, void* user)
+{
+    static_cast<std::vector<Failure>*>(user)->push_back({ path, err, offset });
+}
+
+TEST_P(Tree, BadFileLeavesNoOutput) {
+    fs::path in = scratch("tree_bad");
+    fs::remove_all(in);
+    write_file(in / "ok.txt", "\x90\xbf\x8b\x81");          // 請求
+    write_file(in / "sub/bad.txt", std::string("ab\x81\x7f", 4));
+
+    /* 置き換え (in == out): 失敗したファイルは元のまま */
+    iconv_alt::converter cv("UTF-8", "CP932");
+    std::vector<Failure> failures;
+    iconv_alt_tree_options o{};
+    o.flags = GetParam();
+    o.on_error = on_error;
+    o.user = &failures;
+    errno = 0;
+    EXPECT_EQ(-1, iconv_alt_convert_tree(cv.native_handle(), in.c_str(), in.c_str(), &o));
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(2u, o.files);
+    EXPECT_EQ(1u, o.failed);
+    ASSERT_EQ(1u, failures.size());
+    EXPECT_NE(std::string::npos, failures[0].path.find("sub/bad.txt"));
+    EXPECT_EQ(EILSEQ, failures[0].err);
+    EXPECT_EQ(2u, failures[0].offset);
+
+    EXPECT_EQ("請求", read_file(in / "ok.txt"));
+    EXPECT_EQ(std::string("ab\x81\x7f", 4), read_file(in / "sub/bad.txt"));
+    EXPECT_FALSE(fs::exists(in / "sub/bad.txt.iconv-alt.tmp"));
+}
+
+INSTANTIATE_TEST_SUITE_P(Paths, Tree,
+    ::testing::Values(0u, ICONV_ALT_TREE_NO_URING),
+    [](const ::testing::TestParamInfo<unsigned>& i) { return i.param ? "Threads" : "Uring"; });
+
+TEST(TreeErrors, MissingInputDirectory) {
+    iconv_alt::converter cv("UTF-8", "CP932");
+    fs::path out = fs::path(::testing::TempDir()) / "tree_none_out";
+    errno = 0;
+    EXPECT_EQ(-1, iconv_alt_convert_tree(cv.native_handle(), "/nonexistent/iconv_alt_tree",
+                                         out.c_str(), nullptr));
+    EXPECT_EQ(ENOENT, errno);
+    EXPECT_EQ(-1, iconv_alt_convert_tree(cv.native_handle(), nullptr, out.c_str(), nullptr));
+    EXPECT_EQ(EINVAL, errno);
+}
@@ -0,0 +1,209 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <cwchar>
+#include <random>
+#include <string>
+#include <vector>
+
+static const std::string kU8 = "請求書ｱｲｳabc①\n表予定,ソ能～∥－￢ひらがなカタカナ";
+
+/* 期待値: 厳密な UTF-8 の復号 (テスト側の素朴な実装)。err = 0 / EILSEQ / EINVAL */
+struct Ref {
+    std::vector<uint32_t> cps;
+    size_t stop = 0;
+    int err = 0;
+};
+
+static Ref ref_utf8(const std::string& s)
+{
+    Ref r;
+    size_t i = 0;
+    while (i < s.size()) {
+        unsigned b = (unsigned char)s[i];
+        size_t len;
+        uint32_t v;
+        unsigned lo = 0x80, hi = 0xBF;
+        if (b < 0x80)                    { len = 1; v = b; }
+        else if (b >= 0xC2 && b <= 0xDF) { len = 2; v = b & 0x1F; }
+        else if (b >= 0xE0 && b <= 0xEF) { len = 3; v = b & 0x0F; lo = b == 0xE0 ? 0xA0 : lo; hi = b == 0xED ? 0x9F : hi; }
+        else if (b >= 0xF0 && b <= 0xF4) { len = 4; v = b & 0x07; lo = b == 0xF0 ? 0x90 : lo; hi = b == 0xF4 ? 0x8F : hi; }
+        else { r.stop = i; r.err = EILSEQ; return r; }
+        for (size_t k = 1; k < len; ++k) {
+            if (i + k >= s.size()) { r.stop = i; r.err = EINVAL; return r; }
+            unsigned t = (unsigned char)s[i + k];
+            if (k == 1 ? (t < lo || t > hi) : (t & 0xC0) != 0x80) { r.stop = i; r.err = EILSEQ; return r; }
+            v = (v << 6) | (t & 0x3F);
+        }
+        r.cps.push_back(v);
+        i += len;
+    }
+    r.stop = i;
+    return r;
+}
+
+static std::string wide(const std::vector<uint32_t>& cps, int w, bool be)
+{
+    std::string out;
+    auto put = [&](uint32_t u) {
+        for (int k = 0; k < w; ++k) out += (char)(u >> (8 * (be ? w - 1 - k : k)));
+    };
+    for (uint32_t cp : cps) {
+        if (w == 4 || cp < 0x10000) put(cp);
+        else { cp -= 0x10000; put(0xD800 | (cp >> 10)); put(0xDC00 | (cp & 0x3FF)); }
+    }
+    return out;
+}
+
+static std::string conv(const char* to, const char* from, const std::string& in,
+    size_t* stop = nullptr, int* err = nullptr)
+{
+    iconv_t cd = iconv_open(to, from);
+    EXPECT_NE((iconv_t)-1, cd) << from << " -> " << to;
+    std::string out(in.size() * 4 + 4, '\0');
+    size_t s = 0;
+    errno = 0;
+    size_t r = iconv_alt_convert(cd, in.data(), in.size(), &out[0], out.size(), &s);
+    if (err) *err = r == (size_t)-1 ? errno : 0;
+    if (stop) *stop = s;
+    iconv_close(cd);
+    out.resize(r == (size_t)-1 ? 0 : r);
+    return out;
+}
+
+/* iconv() に 1 byte ずつ入力し、出力は 1 文字 + BOM 分 (8 byte) ずつ空ける */
+static std::string trickle(const char* to, const char* from, const std::string& in)
+{
+    iconv_t cd = iconv_open(to, from);
+    std::string out;
+    for (size_t i = 0; i < in.size(); ++i) {
+        char* ip = const_cast<char*>(in.data() + i);
+        size_t il = 1;
+        for (;;) {
+            char buf[8];
+            char* op = buf;
+            size_t ol = sizeof(buf);
+            size_t r = iconv(cd, &ip, &il, &op, &ol);
+            out.append(buf, sizeof(buf) - ol);
+            if (r != (size_t)-1 || errno == EINVAL) break;
+            EXPECT_EQ(E2BIG, errno);
+        }
+    }
+    iconv_close(cd);
+    return out;
+}
+
+struct Form { const char* name; int w; bool be; };
+static const Form kForms[] = {
+    { "UTF-16LE", 2, false }, { "UTF-16BE", 2, true },
+    { "UTF-32LE", 4, false }, { "UTF-32BE", 4, true },
+};
+
+/* 各レーン (ASCII / 2 byte / 3 byte / 4 byte) の長い連続と、その混在 */
+static std::string lanes_text()
+{
+    std::string t = std::string(100, 'a');
+    for (int k = 0; k < 40; ++k) t += "äöüßéñ";                      // 2 byte
+    for (int k = 0; k < 40; ++k) t += "日本語のテキスト";              // 3 byte
+    for (int k = 0; k < 40; ++k) t += "\xf0\x9f\x98\x80\xf0\xa0\x80\x8b";   // 4 byte
+    t += kU8 + "x\xc3\xa9" "y\xe3\x81\x82\xf0\x9f\x8d\xa3z" + kU8;
+    t += "\xef\xbf\xbf\xee\x80\x80\xed\x9f\xbf\xf4\x8f\xbf\xbf\xc2\x80\xe0\xa0\x80";   // 境界の値
+    return t;
+}
+
+TEST(Unicode, RoundTripEveryLane) {
+    const std::string text = lanes_text();
+    const Ref ref = ref_utf8(text);
+    ASSERT_EQ(0, ref.err);
+    for (const Form& f : kForms) {
+        std::string w = wide(ref.cps, f.w, f.be);
+        EXPECT_EQ(w, conv(f.name, "UTF-8", text)) << f.name;
+        EXPECT_EQ(text, conv("UTF-8", f.name, w)) << f.name;
+        EXPECT_EQ(w, trickle(f.name, "UTF-8", text)) << f.name;
+        EXPECT_EQ(text, trickle("UTF-8", f.name, w)) << f.name;
+        /* 全ての開始位置 (レーンの途中から始まる 16 byte) */
+        for (size_t i = 0; i < 64; ++i) {
+            std::string sub = text.substr(i, 300);
+            Ref r = ref_utf8(sub);
+            if (r.err) continue;
+            EXPECT_EQ(wide(r.cps, f.w, f.be), conv(f.name, "UTF-8", sub)) << f.name << " " << i;
+        }
+    }
+    /* 全ての BMP / 一部の補助面を 1 つの長い列で */
+    std::vector<uint32_t> all;
+    for (uint32_t cp = 1; cp < 0x110000; cp += cp < 0x10000 ? 1 : 37)
+        if (cp - 0xD800u >= 0x800u) all.push_back(cp);
+    std::string u8 = conv("UTF-8", "UTF-32LE", wide(all, 4, false));
+    ASSERT_EQ(all, ref_utf8(u8).cps);
+    for (const Form& f : kForms) {
+        EXPECT_EQ(wide(all, f.w, f.be), conv(f.name, "UTF-8", u8)) << f.name;
+        EXPECT_EQ(u8, conv("UTF-8", f.name, wide(all, f.w, f.be))) << f.name;
+    }
+}
+
+TEST(Unicode, ByteOrderMarkAndWchar) {
+    const std::string text = lanes_text();
+    const Ref ref = ref_utf8(text);
+    std::string le = wide(ref.cps, 4, false), be = wide(ref.cps, 4, true);
+    EXPECT_EQ(text, conv("UTF-8", "UTF-32", std::string("\xff\xfe\0\0", 4) + le));
+    EXPECT_EQ(text, conv("UTF-8", "UTF-32", std::string("\0\0\xfe\xff", 4) + be));
+    EXPECT_EQ(text, conv("UTF-8", "UTF-32", be));                 // BOM 無しは BE
+    EXPECT_EQ(text, trickle("UTF-8", "UTF-32", std::string("\xff\xfe\0\0", 4) + le));
+    EXPECT_EQ(std::string("\xff\xfe\0\0", 4) + le, conv("UTF-32", "UTF-8", text));
+    EXPECT_EQ(std::string("\xff\xfe\0\0", 4) + le, trickle("UTF-32", "UTF-8", text));
+    EXPECT_EQ(be, conv("UCS-4", "UTF-8", text));
+    EXPECT_EQ(le, conv("UCS-4LE", "UTF-8", text));
+
+    /* WCHAR_T は処理系の wchar_t と同じ並び */
+    const wchar_t* ws = L"請求書 abc \U0001F600";
+    std::string native((const char*)ws, std::wcslen(ws) * sizeof(wchar_t));
+    EXPECT_EQ(native, conv("WCHAR_T", "UTF-8", "請求書 abc \xf0\x9f\x98\x80"));
+    EXPECT_EQ("請求書 abc \xf0\x9f\x98\x80", conv("UTF-8", "WCHAR_T", native));
+}
+
+TEST(Unicode, ErrorsMatchReference) {
+    std::mt19937 rng(7);
+    const std::string text = lanes_text();
+    for (int round = 0; round < 3000; ++round) {
+        std::string s = text.substr(rng() % 200, 200);
+        for (int k = 0; k < 2; ++k)                              // 0–2 バイトを壊す
+            if (rng() % 2) s[rng() % s.size()] = (char)(rng() & 0xFF);
+        s.resize(rng() % (s.size() + 1));                         // 途中で切る
+        const Ref ref = ref_utf8(s);
+        for (const Form& f : kForms) {
+            size_t stop = 0;
+            int err = 0;
+            std::string out = conv(f.name, "UTF-8", s, &stop, &err);
+            ASSERT_EQ(ref.err, err) << f.name << testing::PrintToString(s);
+            if (err) EXPECT_EQ(ref.stop, stop) << f.name << testing::PrintToString(s);
+            else     EXPECT_EQ(wide(ref.cps, f.w, f.be), out) << f.name;
+
+            /* 逆向き: 正しい列の 1 単位を壊し、止まる位置を確かめる */
+            if (ref.cps.empty()) continue;
+            std::vector<uint32_t> cps = ref.cps;
+            size_t at = rng() % cps.size();
+            uint32_t badv = f.w == 4 ? (rng() % 2 ? 0x110000u : 0xDFFFu) : 0xDC00u;
+            cps.insert(cps.begin() + (long)at, badv);
+            std::string w = wide(cps, f.w, f.be);
+            conv("UTF-8", f.name, w, &stop, &err);
+            EXPECT_EQ(EILSEQ, err) << f.name;
+            EXPECT_EQ(wide(std::vector<uint32_t>(ref.cps.begin(), ref.cps.begin() + (long)at),
+                           f.w, f.be).size(), stop) << f.name;
+        }
+    }
+}
+
+TEST(Unicode, ParallelSplitsOnUnits) {
+    std::string text;
+    while (text.size() < (1u << 20)) text += lanes_text();
+    for (const Form& f : kForms) {
+        std::string in = conv(f.name, "UTF-8", text);
+        iconv_t cd = iconv_open("UTF-8", f.name);
+        std::string out(in.size() * 2, '\0');
+        size_t n = iconv_alt_convert_parallel(cd, in.data(), in.size(), &out[0], out.size(), 4, nullptr);
+        iconv_close(cd);
+        ASSERT_NE((size_t)-1, n) << f.name;
+        out.resize(n);
+        EXPECT_EQ(text, out) << f.name;
+    }
+}
@@ -0,0 +1,196 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <string>
+#include <vector>
+
+static const std::string kU8 = "請求書ｱｲｳabc①\n表予定,ソ能～∥－￢ひらがなカタカナ";
+
+/* UTF-8 → UTF-16 (テスト側の素朴な実装) */
+static std::string u16(const std::string& u8, bool be)
+{
+    std::string out;
+    auto put = [&](uint32_t u) {
+        char lo = (char)(u & 0xFF), hi = (char)(u >> 8);
+        if (be) { out += hi; out += lo; } else { out += lo; out += hi; }
+    };
+    for (size_t i = 0; i < u8.size();) {
+        unsigned char b = (unsigned char)u8[i];
+        int len = b < 0x80 ? 1 : b < 0xE0 ? 2 : b < 0xF0 ? 3 : 4;
+        uint32_t cp = len == 1 ? b : len == 2 ? (b & 0x1F) : len == 3 ? (b & 0x0F) : (b & 0x07);
+        for (int k = 1; k < len; ++k) cp = (cp << 6) | ((unsigned char)u8[i + k] & 0x3F);
+        i += len;
+        if (cp < 0x10000) put(cp);
+        else { cp -= 0x10000; put(0xD800 | (cp >> 10)); put(0xDC00 | (cp & 0x3FF)); }
+    }
+    return out;
+}
+
+/* iconv_alt_convert で一括変換。失敗は rc / stop で返す */
+static std::string conv(const char* to, const char* from, const std::string& in,
+    size_t* stop = nullptr, int* err = nullptr)
+{
+    iconv_t cd = iconv_open(to, from);
+    EXPECT_NE((iconv_t)-1, cd) << from << " -> " << to;
+    std::string out(in.size() * 4 + 4, '\0');
+    size_t s = 0;
+    errno = 0;
+    size_t r = iconv_alt_convert(cd, in.data(), in.size(), &out[0], out.size(), &s);
+    if (err) *err = r == (size_t)-1 ? errno : 0;
+    if (stop) *stop = s;
+    iconv_close(cd);
+    out.resize(r == (size_t)-1 ? 0 : r);
+    return out;
+}
+
+/* iconv() に 1 byte ずつ入力し、出力は 1 文字分 (4 byte) ずつ空ける */
+static std::string trickle(const char* to, const char* from, const std::string& in)
+{
+    iconv_t cd = iconv_open(to, from);
+    std::string out;
+    for (size_t i = 0; i < in.size(); ++i) {
+        char* ip = const_cast<char*>(in.data() + i);
+        size_t il = 1;
+        for (;;) {
+            char buf[4];
+            char* op = buf;
+            size_t ol = sizeof(buf);
+            size_t r = iconv(cd, &ip, &il, &op, &ol);
+            out.append(buf, sizeof(buf) - ol);
+            if (r != (size_t)-1 || errno == EINVAL) break;
+            EXPECT_EQ(E2BIG, errno);
+        }
+    }
+    iconv_close(cd);
+    return out;
+}
+
+TEST(Utf16, Cp932RoundTrip) {
+    std::string sj = conv("CP932", "UTF-8", kU8);
+    /* ASCII / 半角カナの長い連続 (SIMD) と 2 byte 文字の混在 */
+    std::string text = std::string(100, 'a') + kU8 + std::string(37, 'z') + "ｱｲｳｴｵｶｷｸｹｺｻｼｽｾｿﾀﾁﾂﾃﾄ" + kU8;
+    std::string sjt = conv("CP932", "UTF-8", text);
+    for (bool be : { false, true }) {
+        const char* name = be ? "UTF-16BE" : "UTF-16LE";
+        EXPECT_EQ(u16(kU8, be), conv(name, "CP932", sj)) << name;
+        EXPECT_EQ(sj, conv("CP932", name, u16(kU8, be))) << name;
+        EXPECT_EQ(u16(text, be), conv(name, "CP932", sjt)) << name;
+        EXPECT_EQ(sjt, conv("CP932", name, u16(text, be))) << name;
+        EXPECT_EQ(u16(text, be), trickle(name, "CP932", sjt)) << name;
+        EXPECT_EQ(sjt, trickle("CP932", name, u16(text, be))) << name;
+        EXPECT_EQ(u16(text, be), conv(name, "UTF-8", text)) << name;
+        EXPECT_EQ(text, conv("UTF-8", name, u16(text, be))) << name;
+    }
+    /* 全ての 2 byte SJIS を往復 */
+    iconv_t to = iconv_open("UTF-16LE", "CP932"), back = iconv_open("CP932", "UTF-16LE");
+    for (unsigned c = 0x8140; c <= 0xFCFC; ++c) {
+        if (c >= 0xA000 && c < 0xE000) continue;                  // 半角カナ + 1 byte
+        char in[2] = { (char)(c >> 8), (char)(c & 0xFF) }, mid[8], out[4];
+        size_t n = iconv_alt_convert(to, in, 2, mid, sizeof(mid), nullptr);
+        if (n == (size_t)-1) continue;
+        ASSERT_EQ(2u, n);
+        size_t m = iconv_alt_convert(back, mid, n, out, sizeof(out), nullptr);
+        ASSERT_NE((size_t)-1, m) << std::hex << c;
+        /* NEC / IBM 重複は代表の 1 つへ寄る */
+        std::string again = conv("UTF-16LE", "CP932", std::string(out, m));
+        EXPECT_EQ(std::string(mid, n), again) << std::hex << c;
+    }
+    iconv_close(to);
+    iconv_close(back);
+}
+
+TEST(Utf16, ByteOrderMark) {
+    std::string le = u16(kU8, false), be = u16(kU8, true);
+    std::string sj = conv("CP932", "UTF-8", kU8);
+    EXPECT_EQ(sj, conv("CP932", "UTF-16", "\xff\xfe" + le));
+    EXPECT_EQ(sj, conv("CP932", "UTF-16", "\xfe\xff" + be));
+    EXPECT_EQ(sj, conv("CP932", "UTF-16", be));                   // BOM 無しは BE
+    EXPECT_EQ(sj, trickle("CP932", "UTF-16", "\xff\xfe" + le));
+
+    /* 出力は BOM (FF FE) を 1 回だけ付けて LE */
+    EXPECT_EQ("\xff\xfe" + le, conv("UTF-16", "CP932", sj));
+    EXPECT_EQ("\xff\xfe" + le, trickle("UTF-16", "CP932", sj));
+    EXPECT_EQ("", conv("UTF-16", "CP932", ""));
+
+    /* LE / BE 指定では U+FEFF はただの文字 */
+    EXPECT_EQ("\xef\xbb\xbf" "a", conv("UTF-8", "UTF-16LE", std::string("\xff\xfe" "a\0", 4)));
+
+    /* BOM 付き形式は並列でも分割しない (区間ごとに BOM が付かない) */
+    std::string big;
+    while (big.size() < (1u << 20)) big += sj;
+    iconv_t cd = iconv_open("UTF-16", "CP932");
+    std::string out(big.size() * 2 + 2, '\0');
+    size_t n = iconv_alt_convert_parallel(cd, big.data(), big.size(), &out[0], out.size(), 4, nullptr);
+    iconv_close(cd);
+    ASSERT_NE((size_t)-1, n);
+    out.resize(n);
+    EXPECT_EQ(conv("UTF-16", "CP932", big), out);
+}
+
+TEST(Utf16, SurrogatesAndErrors) {
+    const std::string emoji = "\xf0\x9f\x98\x80";                  // U+1F600
+    std::string le = u16("ab" + emoji + "c", false);
+    EXPECT_EQ(std::string("a\0b\0\x3d\xd8\x00\xde" "c\0", 10), le);
+    EXPECT_EQ("ab" + emoji + "c", conv("UTF-8", "UTF-16LE", le));
+    EXPECT_EQ(u16(emoji, true), conv("UTF-16BE", "UTF-8", emoji));
+
+    size_t stop = 0;
+    int err = 0;
+    conv("CP932", "UTF-16LE", le, &stop, &err);                   // CP932 に無い
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(4u, stop);
+    conv("CP932", "UTF-16LE", std::string("a\0\x00\xdc", 4), &stop, &err);   // low が先
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "UTF-16LE", std::string("a\0\x3d\xd8", 4), &stop, &err);   // 対が来ない
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-8", "UTF-16LE", std::string("a\0\x3d\xd8" "b\0", 6), &stop, &err);
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-16LE", "CP932", "ab\x85\x40", &stop, &err);          // 未定義の SJIS
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(2u, stop);
+    conv("UTF-16LE", "UTF-8", "a\xed\xa0\x80", &stop, &err);       // UTF-8 のサロゲート
+    EXPECT_EQ(EILSEQ, err);
+    EXPECT_EQ(1u, stop);
+
+    /* 奇数バイトは末尾の途中の文字 */
+    conv("CP932", "UTF-16BE", std::string("\0a\0", 3), &stop, &err);
+    EXPECT_EQ(EINVAL, err);
+    EXPECT_EQ(2u, stop);
+
+    /* ストリーム: 持ち越しの途中で不正になっても位置は入力の先頭 */
+    iconv_t cd = iconv_open("UTF-8", "UTF-16LE");
+    char out[16];
+    char* ip = const_cast<char*>("\x3d\xd8");
+    size_t il = 2;
+    char* op = out;
+    size_t ol = sizeof(out);
+    EXPECT_EQ((size_t)-1, iconv(cd, &ip, &il, &op, &ol));
+    EXPECT_EQ(EINVAL, errno);
+    EXPECT_EQ(0u, il);
+    ip = const_cast<char*>("a\0");
+    il = 2;
+    EXPECT_EQ((size_t)-1, iconv(cd, &ip, &il, &op, &ol));
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(2u, il);
+    EXPECT_EQ(0, iconv(cd, &ip, &il, &op, &ol));                    // 預けた分は捨てた
+    EXPECT_EQ("a", std::string(out, op));
+    iconv_close(cd);
+}
+
+TEST(Utf16, ParallelSplitsOnUnits) {
+    std::string text;
+    while (text.size() < (1u << 20)) text += kU8 + "\xf0\x9f\x98\x80 ";
+    for (const char* name : { "UTF-16LE", "UTF-16BE" }) {
+        std::string in = conv(name, "UTF-8", text);
+        iconv_t cd = iconv_open("UTF-8", name);
+        std::string out(in.size() * 2, '\0');
+        size_t n = iconv_alt_convert_parallel(cd, in.data(), in.size(), &out[0], out.size(), 4, nullptr);
+        iconv_close(cd);
+        ASSERT_NE((size_t)-1, n) << name;
+        out.resize(n);
+        EXPECT_EQ(text, out) << name;
+    }
+}
@@ -0,0 +1,91 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <random>
+#include <string>
+#include <vector>
+
+static const std::string kU8 = "請求書ｱｲｳabc①\n表予定,ソ能～∥－￢";
+
+/* 検証の結果 (rc, errno, stop) が実際の変換と一致するか */
+static void expect_same(iconv_t cd, const std::string& in)
+{
+    std::vector<char> out(in.size() * 3 + 1);
+    size_t stop_c = 12345, stop_v = 12345;
+    errno = 0;
+    size_t r = iconv_alt_convert(cd, in.data(), in.size(), out.data(), out.size(), &stop_c);
+    int err_c = errno;
+    errno = 0;
+    int v = iconv_alt_validate(cd, in.data(), in.size(), &stop_v);
+    int err_v = errno;
+
+    ASSERT_EQ(r == (size_t)-1, v == -1) << testing::PrintToString(in);
+    if (v == -1) {
+        EXPECT_EQ(err_c, err_v) << testing::PrintToString(in);
+        EXPECT_EQ(stop_c, stop_v) << testing::PrintToString(in);
+    }
+}
+
+static std::string u8(uint32_t cp)
+{
+    std::string s;
+    if (cp < 0x80) s += (char)cp;
+    else if (cp < 0x800) { s += (char)(0xC0 | (cp >> 6)); s += (char)(0x80 | (cp & 0x3F)); }
+    else {
+        s += (char)(0xE0 | (cp >> 12));
+        s += (char)(0x80 | ((cp >> 6) & 0x3F));
+        s += (char)(0x80 | (cp & 0x3F));
+    }
+    return s;
+}
+
+TEST(Validate, EveryCodeMatchesConversion) {
+    iconv_t to_sjis = iconv_open("CP932", "UTF-8");
+    iconv_t to_u8 = iconv_open("UTF-8", "CP932");
+    for (uint32_t cp = 0; cp <= 0xFFFF; ++cp) expect_same(to_sjis, "a" + u8(cp) + "b");
+    for (unsigned c = 0; c <= 0xFF; ++c) expect_same(to_u8, std::string(1, (char)c));
+    for (unsigned c = 0x8000; c <= 0xFFFF; ++c)
+        expect_same(to_u8, std::string{ 'x', (char)(c >> 8), (char)(c & 0xFF), 'y' });
+    iconv_close(to_sjis);
+    iconv_close(to_u8);
+}
+
+TEST(Validate, MutatedInputsMatchConversion) {
+    iconv_t to_sjis = iconv_open("CP932", "UTF-8");
+    iconv_t to_u8 = iconv_open("UTF-8", "CP932");
+    std::string sj(kU8.size(), '\0');
+    sj.resize(iconv_alt_convert(to_sjis, kU8.data(), kU8.size(), &sj[0], sj.size(), nullptr));
+
+    std::mt19937 rng(42);
+    for (int round = 0; round < 2000; ++round) {
+        for (int dir = 0; dir < 2; ++dir) {
+            std::string s = dir ? sj : kU8;
+            for (int k = 0; k < 3; ++k)                          // 0–2 バイトを壊す
+                if (rng() % 2) s[rng() % s.size()] = (char)(rng() & 0xFF);
+            s.resize(rng() % (s.size() + 1));                     // 途中で切る
+            expect_same(dir ? to_u8 : to_sjis, s);
+        }
+    }
+
+    /* 長い ASCII の後ろの不正 (SIMD で読み飛ばした先の位置) */
+    std::string tail = std::string(1000, 'a') + kU8 + "\xf0\x9f\x98\x80";
+    expect_same(to_sjis, tail);
+    size_t bad = 0;
+    EXPECT_EQ(-1, iconv_alt_validate(to_sjis, tail.data(), tail.size(), &bad));
+    EXPECT_EQ(1000 + kU8.size(), bad);
+    iconv_close(to_sjis);
+    iconv_close(to_u8);
+}
+
+TEST(Validate, ValidInputAndArguments) {
+    iconv_t cd = iconv_open("CP932", "UTF-8");
+    size_t bad = 7;
+    EXPECT_EQ(0, iconv_alt_validate(cd, kU8.data(), kU8.size(), &bad));
+    EXPECT_EQ(7u, bad);                                           // 成功時は触らない
+    EXPECT_EQ(0, iconv_alt_validate(cd, nullptr, 0, nullptr));
+    EXPECT_EQ(-1, iconv_alt_validate(cd, "\xe8\xab", 2, nullptr));
+    EXPECT_EQ(EINVAL, errno);
+    EXPECT_EQ(-1, iconv_alt_validate((iconv_t)-1, "a", 1, nullptr));
+    EXPECT_EQ(EINVAL, errno);
+    iconv_close(cd);
+}
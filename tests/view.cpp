@@ -0,0 +1,92 @@
+#include <gtest/gtest.h>
+#include <iconv_alt.h>
+#include <cerrno>
+#include <cstring>
+#include <string>
+
+/* -----------------------------------------------------------------
+ * 純 ASCII は両方向とも入力ポインタをそのまま借用する
+ * ----------------------------------------------------------------*/
+TEST(View, AsciiIsBorrowed) {
+    const char text[] = "PRODUCT-0042, Tokyo\t\\~";
+    const char* dirs[][2] = { { "UTF-8", "SHIFT_JIS" }, { "SHIFT_JIS", "UTF-8" } };
+
+    for (auto& d : dirs) {
+        iconv_t cd = iconv_open(d[0], d[1]);
+        ASSERT_NE((iconv_t)-1, cd);
+
+        iconv_alt_result r{};
+        ASSERT_EQ(0, iconv_alt_view(cd, text, sizeof(text) - 1, &r));
+        EXPECT_EQ(text, r.data);                 // 同じポインタ
+        EXPECT_EQ(sizeof(text) - 1, r.len);
+        EXPECT_EQ(0, r.owned);
+        iconv_alt_result_free(&r);
+        iconv_close(cd);
+    }
+}
+
+/* -----------------------------------------------------------------
+ * 長い純 ASCII (SIMD ブロック + 端数) も借用になる
+ * ----------------------------------------------------------------*/
+TEST(View, LongAsciiIsBorrowed) {
+    std::string text(1000 + 7, 'a');
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    iconv_alt_result r{};
+    ASSERT_EQ(0, iconv_alt_view(cd, text.data(), text.size(), &r));
+    EXPECT_EQ(text.data(), r.data);
+    EXPECT_EQ(0, r.owned);
+    iconv_close(cd);
+}
+
+/* -----------------------------------------------------------------
+ * 非 ASCII を含む場合は変換して所有権付きで返す
+ * ----------------------------------------------------------------*/
+TEST(View, NonAsciiIsConverted) {
+    // 100 バイトの ASCII の後に あいう
+    std::string sjis(100, 'x');
+    sjis += "\x82\xa0\x82\xa2\x82\xa4";
+
+    iconv_t cd = iconv_open("UTF-8", "SHIFT_JIS");
+    ASSERT_NE((iconv_t)-1, cd);
+    iconv_alt_result r{};
+    ASSERT_EQ(0, iconv_alt_view(cd, sjis.data(), sjis.size(), &r));
+    EXPECT_EQ(1, r.owned);
+    EXPECT_EQ(std::string(100, 'x') + u8"あいう", std::string(r.data, r.len));
+    iconv_alt_result_free(&r);
+    EXPECT_EQ(nullptr, r.data);
+    iconv_close(cd);
+
+    cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+    const char utf8[] = u8"ｱｲｳABC";
+    ASSERT_EQ(0, iconv_alt_view(cd, utf8, strlen(utf8), &r));
+    EXPECT_EQ(1, r.owned);
+    EXPECT_EQ(std::string("\xB1\xB2\xB3" "ABC"), std::string(r.data, r.len));
+    iconv_alt_result_free(&r);
+    iconv_close(cd);
+}
+
+/* -----------------------------------------------------------------
+ * 変換不能文字 → -1 / EILSEQ、cd のストリーム状態は影響を受けない
+ * ----------------------------------------------------------------*/
+TEST(View, ErrorLeavesDescriptorUsable) {
+    iconv_t cd = iconv_open("SHIFT_JIS", "UTF-8");
+    ASSERT_NE((iconv_t)-1, cd);
+
+    const char bad[] = u8"ok😀";
+    iconv_alt_result r{};
+    errno = 0;
+    EXPECT_EQ(-1, iconv_alt_view(cd, bad, strlen(bad), &r));
+    EXPECT_EQ(EILSEQ, errno);
+    EXPECT_EQ(0, r.owned);
+
+    const char utf8[] = u8"あ";
+    char sjis[8]{};
+    char* in = (char*)utf8, * out = sjis;
+    size_t inleft = strlen(utf8), outleft = sizeof(sjis);
+    EXPECT_EQ(0u, iconv(cd, &in, &inleft, &out, &outleft));
+    EXPECT_STREQ("\x82\xa0", sjis);
+    iconv_close(cd);
+}
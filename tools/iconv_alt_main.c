@@ -0,0 +1,609 @@
+/*----------------------------------------------------------------------
+ *  tools/iconv_alt_main.c  —  iconv-alt コマンド (iconv(1) 互換の CLI)
+ *
+ *      iconv-alt -f CP932 -t UTF-8 [-c] [-o OUT] [FILE...]
+ *      iconv-alt -l
+ *      iconv-alt tree -f CP932 -t UTF-8 [-j N] [--depth N] [--no-uring] IN_DIR OUT_DIR
+ *
+ *  入力ごとに経路を選ぶ:
+ *      大きな通常ファイル   : mmap して iconv_alt_convert_parallel()
+ *                             (64 MB 区切り、区切りの文字は次の区間へ回す)
+ *      パイプ / 小さなファイル: iconv_alt_convert_fd() (読み・変換・書きを重ねる)
+ *      -c (変換できない文字を捨てる): 1 MB の整列バッファで iconv() を回し、
+ *                             EILSEQ の 1 コード単位 (UTF-16 は 2 byte、UTF-32 は 4 byte)
+ *                             を読み飛ばす
+ *  BOM 付きの UTF-16 / UTF-32 は先頭で状態が決まるので区間に分けず、常に逐次で変換する。
+ *  tree は IN_DIR 以下の全ファイルを OUT_DIR の同じ相対パスへ変換する
+ *  (iconv_alt_convert_tree(): io_uring が使えなければスレッドで読み書き)。
+ *  -o は同じディレクトリの一時ファイルへ書き、最後の入力の後で rename して置き換える
+ *  (iconv(1) と同じく、出力が入力と同じファイルでもよい)。
+ *  --stats で入出力バイト数・経過時間・スループットを stderr に出す。
+ *  終了コードは iconv(1) と同じ: 0 = 成功 / 1 = 変換エラー・引数エラー。
+ *--------------------------------------------------------------------*/
+#define _CRT_SECURE_NO_WARNINGS
+#include "iconv_alt.h"
+#include <errno.h>
+#include <fcntl.h>
+#include <stdio.h>
+#include <stdlib.h>
+#include <string.h>
+#include <sys/stat.h>
+#include <time.h>
+#if defined(_WIN32)
+#  include <io.h>
+#  include <malloc.h>
+#  include <process.h>
+#  include <windows.h>
+#  define open   _open
+#  define close  _close
+#  define fstat  _fstat
+#  define stat   _stat
+#  define getpid _getpid
+#  define O_CREAT_EXCL   (_O_WRONLY | _O_CREAT | _O_EXCL | _O_BINARY)
+#else
+#  include <sys/mman.h>
+#  include <unistd.h>
+#  define O_CREAT_EXCL   (O_WRONLY | O_CREAT | O_EXCL)
+#  ifndef O_BINARY
+#    define O_BINARY 0
+#  endif
+#endif
+
+#define CLI_BLOCK       (1u << 20)           /* 読み書きの単位 (ページ整列)       */
+#define CLI_MMAP_MIN    (4u << 20)           /* これ以上の通常ファイルは mmap     */
+#define CLI_SEGMENT     ((size_t)64 << 20)   /* mmap 入力を並列変換する区間       */
+#define CLI_MAX_GROWTH  4                    /* 入力 1 byte あたりの出力の上限    */
+#define CLI_TMP_SUFFIX  ".iconv-alt.tmp"     /* -o の一時ファイル (OUT.<pid> + これ) */
+
+static const char* prog = "iconv-alt";
+
+typedef struct {
+    const char*        from;
+    const char*        to;
+    int                skip_invalid;   /* -c / //IGNORE */
+    int                silent;         /* -s */
+    int                stats;          /* --stats */
+    unsigned           threads;        /* -j (0 = 全 CPU) */
+    int                out_fd;
+    unsigned long long in_total, out_total;
+    unsigned long long omitted;        /* -c で捨てたバイト数 */
+    unsigned           n_mapped, n_streamed, n_skipping;
+    unsigned           depth;          /* tree --depth (0 = 既定) */
+    int                no_uring;       /* tree --no-uring */
+    unsigned           unit;           /* -c で読み飛ばす幅 (入力のコード単位) */
+    int                stateful;       /* BOM など: 区間に分けて変換できない */
+} cli;
+
+/*======================================================================
+ *  1.  下回り (整列バッファ / 書き込み / 時計)
+ *====================================================================*/
+static void* aligned_block(size_t n)
+{
+#if defined(_WIN32)
+    return _aligned_malloc(n, 4096);
+#else
+    void* p = NULL;
+    return posix_memalign(&p, 4096, n) == 0 ? p : NULL;
+#endif
+}
+
+static void aligned_free(void* p)
+{
+#if defined(_WIN32)
+    _aligned_free(p);
+#else
+    free(p);
+#endif
+}
+
+static int write_all(int fd, const char* p, size_t n)
+{
+    while (n > 0) {
+#if defined(_WIN32)
+        int r = _write(fd, p, (unsigned)(n > 0x40000000u ? 0x40000000u : n));
+#else
+        ssize_t r = write(fd, p, n);
+        if (r < 0 && errno == EINTR) continue;
+#endif
+        if (r <= 0) { if (r == 0) errno = EIO; return -1; }
+        p += r; n -= (size_t)r;
+    }
+    return 0;
+}
+
+static long read_some(int fd, char* buf, size_t n)
+{
+#if defined(_WIN32)
+    return _read(fd, buf, (unsigned)n);
+#else
+    for (;;) {
+        ssize_t r = read(fd, buf, n);
+        if (r < 0 && errno == EINTR) continue;
+        return (long)r;
+    }
+#endif
+}
+
+/* -o: 出力先と同じディレクトリに一時ファイルを作る。既存の出力先の許可と
+   所有者は引き継ぐ。Return: fd / -1 + errno */
+static int open_output_tmp(const char* output, char** tmp)
+{
+    size_t cap = strlen(output) + sizeof(CLI_TMP_SUFFIX) + 24;
+    if (!(*tmp = (char*)malloc(cap))) { errno = ENOMEM; return -1; }
+    int fd = -1;
+    for (unsigned k = 0; fd < 0 && k < 100; ++k) {
+        snprintf(*tmp, cap, "%s.%ld.%u" CLI_TMP_SUFFIX, output, (long)getpid(), k);
+        fd = open(*tmp, O_CREAT_EXCL, 0666);
+        if (fd < 0 && errno != EEXIST) break;
+    }
+#if !defined(_WIN32)
+    struct stat sb;                     /* chown は set-id を落とすので先に。root 以外は失敗してよい */
+    if (fd >= 0 && stat(output, &sb) == 0) {
+        if (fchown(fd, sb.st_uid, sb.st_gid) < 0) {}
+        if (fchmod(fd, sb.st_mode & 07777) < 0) {
+            int e = errno;
+            close(fd); remove(*tmp);
+            fd = -1; errno = e;
+        }
+    }
+#endif
+    if (fd < 0) { int e = errno; free(*tmp); *tmp = NULL; errno = e; }
+    return fd;
+}
+
+/* 一時ファイルで出力先を置き換える */
+static int replace_output(const char* tmp, const char* output)
+{
+#if defined(_WIN32)
+    if (MoveFileExA(tmp, output, MOVEFILE_REPLACE_EXISTING)) return 0;
+    errno = EACCES;
+    return -1;
+#else
+    return rename(tmp, output);
+#endif
+}
+
+static double now_seconds(void)
+{
+    struct timespec ts;
+    timespec_get(&ts, TIME_UTC);
+    return (double)ts.tv_sec + ts.tv_nsec / 1e9;
+}
+
+/*======================================================================
+ *  2.  エラー表示 (iconv(1) と同じ文言)
+ *====================================================================*/
+static int conversion_error(const cli* c, const char* name, int err,
+    unsigned long long offset)
+{
+    (void)c;
+    if (err == EILSEQ)
+        fprintf(stderr, "%s: %s: cannot convert, illegal input sequence at position %llu\n",
+            prog, name, offset);
+    else if (err == EINVAL)
+        fprintf(stderr, "%s: %s: incomplete character or shift sequence at end of buffer\n",
+            prog, name);
+    else
+        fprintf(stderr, "%s: %s: %s\n", prog, name, strerror(err));
+    return 1;
+}
+
+/*======================================================================
+ *  3.  変換の経路
+ *====================================================================*/
+/* パイプ / 小さなファイル: iconv_alt_convert_fd に任せる */
+static int convert_streamed(cli* c, iconv_t cd, int fd, const char* name, int regular)
+{
+    iconv_alt_fd_options o;
+    memset(&o, 0, sizeof(o));
+    o.block_size = CLI_BLOCK;
+    if (regular) o.flags = ICONV_ALT_FD_NO_THREADS;   /* 読みが待たないので重ねる意味が薄い */
+    int rc = iconv_alt_convert_fd(cd, fd, c->out_fd, &o);
+    int err = errno;
+    c->in_total += o.in_total;
+    c->out_total += o.out_total;
+    c->n_streamed++;
+    return rc < 0 ? conversion_error(c, name, err, o.in_total) : 0;
+}
+
+/* -c: 変換できないバイトを読み飛ばしながら iconv() を回す */
+static int convert_skipping(cli* c, iconv_t cd, int fd, const char* name)
+{
+    char* in = (char*)aligned_block(CLI_BLOCK);
+    char* out = (char*)aligned_block(CLI_BLOCK);
+    if (!in || !out) {
+        aligned_free(in); aligned_free(out);
+        return conversion_error(c, name, ENOMEM, 0);
+    }
+    c->n_skipping++;
+    int pending = 0, status = 0;
+    for (;;) {
+        long n = read_some(fd, in, CLI_BLOCK);
+        if (n < 0) { status = conversion_error(c, name, errno, 0); break; }
+        if (n == 0) {
+            if (pending) { status = conversion_error(c, name, EINVAL, c->in_total); break; }
+            char* op = out;                            /* 終わりのエスケープ */
+            size_t ol = CLI_BLOCK;
+            iconv(cd, NULL, NULL, &op, &ol);
+            if (write_all(c->out_fd, out, CLI_BLOCK - ol) < 0)
+                status = conversion_error(c, "(output)", errno, 0);
+            c->out_total += CLI_BLOCK - ol;
+            break;
+        }
+        c->in_total += (unsigned long long)n;
+        char* ip = in;
+        size_t il = (size_t)n;
+        while (il > 0) {
+            char* op = out;
+            size_t ol = CLI_BLOCK;
+            size_t before = il;
+            size_t r = iconv(cd, &ip, &il, &op, &ol);
+            int err = errno;
+            if (write_all(c->out_fd, out, CLI_BLOCK - ol) < 0) {
+                status = conversion_error(c, "(output)", errno, 0);
+                goto done;
+            }
+            c->out_total += CLI_BLOCK - ol;
+            if (r != (size_t)-1) { if (before > il) pending = 0; break; }
+            if (err == EINVAL) { pending = 1; break; }     /* 続きは次のブロック */
+            pending = 0;
+            if (err == EILSEQ) {          /* その 1 文字を捨てる (読めない並びなら 1 コード単位) */
+                int len = iconv_alt_char_length(cd, ip, il);
+                size_t k = len > 0 ? (size_t)len : (il < c->unit ? il : c->unit);
+                ip += k; il -= k; c->omitted += k;
+            }
+        }
+    }
+done:
+    aligned_free(in);
+    aligned_free(out);
+    return status;
+}
+
+#if !defined(_WIN32)
+/* 大きな通常ファイル: mmap して区間ごとに並列変換 */
+static int convert_mapped(cli* c, iconv_t cd, int fd, const char* name, size_t size)
+{
+    const char* map = (const char*)mmap(NULL, size, PROT_READ, MAP_PRIVATE, fd, 0);
+    if (map == (const char*)MAP_FAILED) return convert_streamed(c, cd, fd, name, 1);
+    madvise((void*)map, size, MADV_SEQUENTIAL);
+
+    size_t cap = (size < CLI_SEGMENT ? size : CLI_SEGMENT) * CLI_MAX_GROWTH;
+    char* out = (char*)malloc(cap);
+    if (!out) { munmap((void*)map, size); return convert_streamed(c, cd, fd, name, 1); }
+    c->n_mapped++;
+
+    int status = 0;
+    size_t pos = 0;
+    while (pos < size) {
+        size_t n = size - pos < CLI_SEGMENT ? size - pos : CLI_SEGMENT;
+        size_t stop = 0;
+        size_t r = iconv_alt_convert_parallel(cd, map + pos, n, out, cap, c->threads, &stop);
+        int err = errno;
+        if (r == (size_t)-1) {
+            /* 手前までを書き出す。区間末尾で途切れた文字は次の区間の先頭へ回す */
+            int more = pos + n < size;
+            if (stop > 0) {
+                r = iconv_alt_convert_parallel(cd, map + pos, stop, out, cap, c->threads, NULL);
+                if (r == (size_t)-1 || write_all(c->out_fd, out, r) < 0) {
+                    status = conversion_error(c, r == (size_t)-1 ? name : "(output)", errno, pos);
+                    break;
+                }
+                c->out_total += r;
+                c->in_total += stop;
+                pos += stop;
+            }
+            if (err == EINVAL && more && stop > 0) continue;
+            status = conversion_error(c, name, err, pos);
+            break;
+        }
+        if (write_all(c->out_fd, out, r) < 0) {
+            status = conversion_error(c, "(output)", errno, 0);
+            break;
+        }
+        c->out_total += r;
+        c->in_total += n;
+        pos += n;
+    }
+    free(out);
+    munmap((void*)map, size);
+    return status;
+}
+#endif
+
+/* 1 入力 (path = NULL / "-" は標準入力) */
+static int convert_one(cli* c, const char* path)
+{
+    int fd = 0;
+    const char* name = "(stdin)";
+    if (path && strcmp(path, "-") != 0) {
+        fd = open(path, O_RDONLY | O_BINARY);
+        if (fd < 0) {
+            fprintf(stderr, "%s: cannot open input file `%s': %s\n", prog, path, strerror(errno));
+            return 1;
+        }
+        name = path;
+    }
+    iconv_t cd = iconv_open(c->to, c->from);          /* 入力ごとに状態を空にする */
+    if (cd == (iconv_t)-1) {
+        if (fd != 0) close(fd);
+        return conversion_error(c, name, errno, 0);
+    }
+
+    struct stat sb;
+    int regular = fstat(fd, &sb) == 0 && (sb.st_mode & S_IFMT) == S_IFREG;
+    int status;
+    if (c->skip_invalid)
+        status = convert_skipping(c, cd, fd, name);
+#if !defined(_WIN32)
+    else if (regular && !c->stateful && (unsigned long long)sb.st_size >= CLI_MMAP_MIN)
+        status = convert_mapped(c, cd, fd, name, (size_t)sb.st_size);
+#endif
+    else
+        status = convert_streamed(c, cd, fd, name, regular);
+
+    iconv_close(cd);
+    if (fd != 0) close(fd);
+    return status;
+}
+
+/* tree: 失敗したファイルは iconv(1) と同じ文言で 1 行ずつ報告する */
+static void tree_error(const char* path, int err, size_t offset, void* user)
+{
+    const cli* c = (const cli*)user;
+    if (c->silent) return;
+    if (err == EILSEQ)
+        fprintf(stderr, "%s: %s: cannot convert, illegal input sequence at position %llu\n",
+            prog, path, (unsigned long long)offset);
+    else if (err == EINVAL)
+        fprintf(stderr, "%s: %s: incomplete character or shift sequence at end of buffer\n",
+            prog, path);
+    else
+        fprintf(stderr, "%s: %s: %s\n", prog, path, strerror(err));
+}
+
+static int convert_tree(cli* c, const char* in_dir, const char* out_dir)
+{
+    iconv_t cd = iconv_open(c->to, c->from);
+    if (cd == (iconv_t)-1) return 1;
+    iconv_alt_tree_options opt;
+    memset(&opt, 0, sizeof(opt));
+    opt.threads = c->threads;
+    opt.queue_depth = c->depth;
+    opt.flags = c->no_uring ? ICONV_ALT_TREE_NO_URING : 0;
+    opt.on_error = tree_error;
+    opt.user = c;
+
+    double t0 = now_seconds();
+    int rc = iconv_alt_convert_tree(cd, in_dir, out_dir, &opt);
+    double dt = now_seconds() - t0;
+    int err = errno;
+    iconv_close(cd);
+
+    if (rc != 0 && opt.failed == 0 && !c->silent)   /* 個々のファイル以外の失敗 */
+        fprintf(stderr, "%s: %s: %s\n", prog, in_dir, strerror(err));
+    if (c->stats) {
+        double mb = (double)opt.in_total / (1024.0 * 1024.0);
+        fprintf(stderr, "%s: %zu files (%zu failed), %llu bytes in, %llu bytes out, %.3f s, "
+            "%.1f MB/s (%s)\n", prog, opt.files, opt.failed, opt.in_total, opt.out_total, dt,
+            dt > 0 ? mb / dt : 0.0, opt.used_uring ? "io_uring" : "threads");
+    }
+    return rc == 0 ? 0 : 1;
+}
+
+/*======================================================================
+ *  4.  引数
+ *====================================================================*/
+static int print_family(unsigned int count, const char* const* names, void* data)
+{
+    (void)data;
+    for (unsigned int i = 0; i < count; ++i)
+        printf("%s%s", names[i], i + 1 < count ? " " : "\n");
+    return 0;
+}
+
+static void usage(FILE* fp)
+{
+    fprintf(fp,
+        "Usage: %s [-c] [-s] [-f FROM] [-t TO] [-o OUTPUT] [-j N] [--stats] [FILE...]\n"
+        "       %s -l\n"
+        "       %s tree [-s] [-f FROM] [-t TO] [-j N] [--depth N] [--no-uring] [--stats] IN_DIR OUT_DIR\n"
+        "  -f, --from-code=NAME   input encoding (default UTF-8)\n"
+        "  -t, --to-code=NAME     output encoding (default UTF-8; //IGNORE = -c)\n"
+        "  -c                     omit characters that cannot be converted\n"
+        "  -o, --output=FILE      write to FILE instead of standard output\n"
+        "  -l, --list             list the supported encodings\n"
+        "  -s, --silent           suppress warnings\n"
+        "  -j, --threads=N        threads for large files (default: all CPUs)\n"
+        "      --stats            print bytes, time and throughput to stderr\n"
+        "  tree: convert every file under IN_DIR into the same path under OUT_DIR\n"
+        "      --depth=N          io_uring queue depth (files in flight)\n"
+        "      --no-uring         use worker threads instead of io_uring\n",
+        prog, prog, prog);
+}
+
+/* 名前から CLI が知る必要のある性質だけを調べる (大文字小文字・'-'・'_' は無視)。
+   UTF-16 系はコード単位が 2 byte、BOM 付き形式 (UTF-16) は先頭で状態が決まる。
+   ISO-2022-JP 系はエスケープの後ろの文字集合が状態、Shift_JIS-2004 は合成を待つ基底が状態 */
+static void code_traits(const char* code, unsigned* unit, int* stateful)
+{
+    char n[64];
+    size_t k = 0;
+    for (const char* s = code; *s && k + 1 < sizeof(n); ++s) {
+        if (*s == '-' || *s == '_') continue;
+        n[k++] = (*s >= 'a' && *s <= 'z') ? (char)(*s - 32) : *s;
+    }
+    n[k] = '\0';
+    const char* u = strncmp(n, "CS", 2) == 0 ? n + 2 : n;
+    if (strncmp(u, "UTF16", 5) == 0)                                   *unit = 2;
+    else if (strncmp(u, "UTF32", 5) == 0 || strncmp(u, "UCS4", 4) == 0) *unit = 4;
+    else if (strcmp(u, "ISO10646UCS4") == 0)                           *unit = 4;
+    else if (strcmp(u, "WCHART") == 0)                                 *unit = (unsigned)sizeof(wchar_t);
+    else                                                               *unit = 1;
+    *stateful = strcmp(u, "UTF16") == 0 || strcmp(u, "UTF32") == 0
+             || strncmp(u, "ISO2022JP", 9) == 0                          /* エスケープで切り替え */
+             || strcmp(u, "CP50221") == 0 || strcmp(u, "WINDOWS50221") == 0
+             || strcmp(u, "SHIFTJIS2004") == 0 || strcmp(u, "SHIFTJISX0213") == 0 /* 合成の先読み */
+             || strcmp(u, "SJIS2004") == 0
+             || strcmp(u, "IBM930") == 0 || strcmp(u, "IBM939") == 0          /* SO/SI で切り替え */
+             || strcmp(u, "CP930") == 0 || strcmp(u, "CP939") == 0;
+}
+
+/* "NAME//IGNORE//TRANSLIT" の接尾辞を外す (IGNORE は -c と同じ) */
+static const char* strip_suffix(cli* c, char* code)
+{
+    char* s = strstr(code, "//");
+    if (!s) return code;
+    for (char* p = s; *p; ++p) if (*p >= 'a' && *p <= 'z') *p = (char)(*p - 32);
+    if (strstr(s, "//IGNORE")) c->skip_invalid = 1;
+    *s = '\0';
+    return code;
+}
+
+/* --name=value / --name value / -xvalue / -x value の値を取り出す */
+static const char* option_value(int argc, char** argv, int* i, const char* inline_value)
+{
+    if (inline_value && *inline_value) return inline_value;
+    if (*i + 1 >= argc) return NULL;
+    return argv[++*i];
+}
+
+int main(int argc, char** argv)
+{
+    cli c;
+    memset(&c, 0, sizeof(c));
+    c.out_fd = 1;
+    const char* output = NULL;
+    char** inputs = (char**)calloc((size_t)argc, sizeof(char*));
+    int n_inputs = 0, list = 0, only_files = 0;
+    int tree = argc > 1 && strcmp(argv[1], "tree") == 0;
+    const char* bad_arg = NULL;
+    if (!inputs) return 1;
+
+    for (int i = tree ? 2 : 1; i < argc; ++i) {
+        char* a = argv[i];
+        bad_arg = a;
+        if (only_files || a[0] != '-' || a[1] == '\0') { inputs[n_inputs++] = a; continue; }
+        if (strcmp(a, "--") == 0) { only_files = 1; continue; }
+        if (a[1] == '-') {
+            char* eq = strchr(a, '=');
+            size_t len = eq ? (size_t)(eq - a) : strlen(a);
+            const char* v = eq ? eq + 1 : NULL;
+#define IS(name) (len == sizeof(name) - 1 && strncmp(a, name, len) == 0)
+            if (IS("--from-code"))     { if (!(c.from = option_value(argc, argv, &i, v))) goto bad; }
+            else if (IS("--to-code"))  { if (!(c.to = option_value(argc, argv, &i, v))) goto bad; }
+            else if (IS("--output"))   { if (!(output = option_value(argc, argv, &i, v))) goto bad; }
+            else if (IS("--threads"))  { if (!(v = option_value(argc, argv, &i, v))) goto bad;
+                                         c.threads = (unsigned)strtoul(v, NULL, 10); }
+            else if (IS("--depth") && tree) { if (!(v = option_value(argc, argv, &i, v))) goto bad;
+                                         c.depth = (unsigned)strtoul(v, NULL, 10); }
+            else if (IS("--no-uring") && tree) c.no_uring = 1;
+            else if (IS("--list"))     list = 1;
+            else if (IS("--silent"))   c.silent = 1;
+            else if (IS("--stats"))    c.stats = 1;
+            else if (IS("--help"))     { usage(stdout); free(inputs); return 0; }
+            else goto bad;
+#undef IS
+            continue;
+        }
+        for (char* p = a + 1; *p; ++p) {
+            const char* v;
+            switch (*p) {
+            case 'c': c.skip_invalid = 1; continue;
+            case 's': c.silent = 1; continue;
+            case 'l': list = 1; continue;
+            case 'f': case 't': case 'o': case 'j':
+                if (!(v = option_value(argc, argv, &i, p + 1))) goto bad;
+                if (*p == 'f') c.from = v;
+                else if (*p == 't') c.to = v;
+                else if (*p == 'o') output = v;
+                else c.threads = (unsigned)strtoul(v, NULL, 10);
+                break;
+            default:
+                goto bad;
+            }
+            break;                                  /* 値を取ったら次の引数へ */
+        }
+    }
+
+    if (list) {
+        iconv_alt_list(print_family, NULL);
+        free(inputs);
+        return 0;
+    }
+
+    char from[64], to[64];
+    snprintf(from, sizeof(from), "%s", c.from ? c.from : "UTF-8");
+    snprintf(to, sizeof(to), "%s", c.to ? c.to : "UTF-8");
+    c.from = strip_suffix(&c, from);
+    c.to = strip_suffix(&c, to);
+    unsigned to_unit;
+    int from_state, to_state;
+    code_traits(c.from, &c.unit, &from_state);
+    code_traits(c.to, &to_unit, &to_state);
+    c.stateful = from_state || to_state;
+    iconv_t probe = iconv_open(c.to, c.from);
+    if (probe == (iconv_t)-1) {
+        fprintf(stderr, "%s: conversion from `%s' to `%s' is not supported\n", prog, c.from, c.to);
+        free(inputs);
+        return 1;
+    }
+    iconv_close(probe);
+
+    if (tree) {                                     /* -c / -o は木の変換では使わない */
+        if (n_inputs != 2 || c.skip_invalid || output) {
+            bad_arg = "tree";
+            goto bad;
+        }
+        int status = convert_tree(&c, inputs[0], inputs[1]);
+        free(inputs);
+        return status;
+    }
+
+    char* out_tmp = NULL;
+    if (output) {
+        c.out_fd = open_output_tmp(output, &out_tmp);
+        if (c.out_fd < 0) {
+            fprintf(stderr, "%s: cannot open output file `%s': %s\n", prog, output, strerror(errno));
+            free(inputs);
+            return 1;
+        }
+    }
+#if defined(_WIN32)
+    _setmode(0, _O_BINARY);
+    if (!output) _setmode(1, _O_BINARY);
+#endif
+
+    double t0 = now_seconds();
+    int status = 0;
+    if (n_inputs == 0) status = convert_one(&c, NULL);
+    for (int i = 0; i < n_inputs && status == 0; ++i) status = convert_one(&c, inputs[i]);
+    double dt = now_seconds() - t0;
+
+    if (c.skip_invalid && c.omitted > 0) {
+        if (!c.silent)
+            fprintf(stderr, "%s: omitted %llu byte(s) that could not be converted\n", prog, c.omitted);
+        status = 1;                                 /* iconv(1) -c と同じく 1 で終わる */
+    }
+    if (c.stats) {
+        double mb = (double)c.in_total / (1024.0 * 1024.0);
+        fprintf(stderr, "%s: %llu bytes in, %llu bytes out, %.3f s, %.1f MB/s "
+            "(mmap %u, stream %u, skip %u)\n", prog, c.in_total, c.out_total, dt,
+            dt > 0 ? mb / dt : 0.0, c.n_mapped, c.n_streamed, c.n_skipping);
+    }
+    /* 変換エラーでもそこまでの出力は残す (iconv(1) と同じ) */
+    if (output && (close(c.out_fd) < 0 || replace_output(out_tmp, output) < 0)) {
+        fprintf(stderr, "%s: %s: %s\n", prog, output, strerror(errno));
+        remove(out_tmp);
+        status = 1;
+    }
+    free(out_tmp);
+    free(inputs);
+    return status;
+
+bad:
+    fprintf(stderr, "%s: invalid option or missing value: `%s'\n", prog, bad_arg);
+    usage(stderr);
+    free(inputs);
+    return 1;
+}